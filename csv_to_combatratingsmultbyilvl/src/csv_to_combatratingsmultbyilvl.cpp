@@ -19,7 +19,6 @@ namespace {
       fprintf(header_,
         "#pragma once\n"
         "#include <cstdint>\n"
-        "#include <unordered_map>\n"
         "\n"
         "namespace prescience_helper::sim::dbc {\n"
         "  struct Combat_ratings_mult_by_ilvl {\n"
@@ -33,40 +32,66 @@ namespace {
         "      ilvl(ilvl), armor(armor), weapon(weapon), trinket(trinket), jewelry(jewelry) { }\n"
         "  };\n"
         "\n"
-        "  extern const std::unordered_map<std::uint16_t, Combat_ratings_mult_by_ilvl> COMBAT_RATINGS_MULT_BY_ILVL;\n"
+        "  //nullptr if the ilvl isn't in the table\n"
+        "  Combat_ratings_mult_by_ilvl const* combat_ratings_mult_by_ilvl(std::uint16_t ilvl) noexcept;\n"
         "}\n"
         "\n");
 
       fprintf(source_,
         "#include <prescience_helper/sim/dbc/combat_ratings_mult_by_ilvl.hpp>\n"
+        "#include <prescience_helper/sim/dbc/pack.hpp>\n"
+        "#include <array>\n"
+        "#include <span>\n"
         "namespace dbc = prescience_helper::sim::dbc;\n"
+        "namespace pack = prescience_helper::sim::dbc::pack;\n"
         "\n"
-        "const std::unordered_map<std::uint16_t, dbc::Combat_ratings_mult_by_ilvl> dbc::COMBAT_RATINGS_MULT_BY_ILVL = []() {\n"
-        "  std::unordered_map<std::uint16_t, dbc::Combat_ratings_mult_by_ilvl> returning;\n");
+        "namespace {\n"
+        "  //indexed by ilvl - 1, gaps have ilvl 0\n");
     }
 
     void data(std::string_view ilvl, std::string_view armor, std::string_view weapon, std::string_view trinket, std::string_view jewelry) {
+      std::string row = "    dbc::Combat_ratings_mult_by_ilvl{ ";
+      for (const auto column : { ilvl, armor, weapon, trinket }) {
+        row.append(column).append(", ");
+      }
+      row.append(jewelry).append(" },\n");
+      const auto index = csv_to_include::parse_int<std::uint16_t>(ilvl);
+      rows_.set(index, std::move(row));
 
-      fprintf(source_,
-        "  returning.emplace(%.*s, Combat_ratings_mult_by_ilvl{ %.*s,"
-        " %.*s, %.*s, %.*s, %.*s });\n",
-        (std::int32_t)ilvl.size(), ilvl.data(),
-        (std::int32_t)ilvl.size(), ilvl.data(),
-        (std::int32_t)armor.size(), armor.data(),
-        (std::int32_t)weapon.size(), weapon.data(),
-        (std::int32_t)trinket.size(), trinket.data(),
-        (std::int32_t)jewelry.size(), jewelry.data());
+      csv_to_include::pack::Combat_ratings_record record{};
+      record.ilvl = index;
+      record.armor = csv_to_include::parse_float(armor);
+      record.weapon = csv_to_include::parse_float(weapon);
+      record.trinket = csv_to_include::parse_float(trinket);
+      record.jewelry = csv_to_include::parse_float(jewelry);
+      csv_to_include::set_ilvl_record(records_, index, record);
     }
 
     ~Combat_rating_mult_by_ilvl() {
+      if (pack_ != nullptr) {
+        pack_->set(csv_to_include::pack::Section::combat_ratings_mult_by_ilvl, std::span<const csv_to_include::pack::Combat_ratings_record>{ records_ });
+      }
+      rows_.write(source_, "dbc::Combat_ratings_mult_by_ilvl", "COMBAT_RATINGS_MULT_BY_ILVL", "    dbc::Combat_ratings_mult_by_ilvl{ 0, 0, 0, 0, 0 },\n");
       fprintf(source_,
-        "  return returning;\n"
-        "}();\n"
+        "}\n"
+        "\n"
+        "dbc::Combat_ratings_mult_by_ilvl const* dbc::combat_ratings_mult_by_ilvl(std::uint16_t ilvl) noexcept {\n"
+        "  //ilvl 0 wraps around and fails the bounds check\n"
+        "  const std::uint32_t index = static_cast<std::uint32_t>(ilvl) - 1;\n"
+        "  const auto table = pack::table(pack::Section::combat_ratings_mult_by_ilvl, std::span<const dbc::Combat_ratings_mult_by_ilvl>{ COMBAT_RATINGS_MULT_BY_ILVL });\n"
+        "  if (index >= table.size() || table[index].ilvl != ilvl) {\n"
+        "    return nullptr;\n"
+        "  }\n"
+        "  return &table[index];\n"
+        "}\n"
         "\n");
     }
+  private:
+    csv_to_include::Ilvl_rows rows_;
+    std::vector<csv_to_include::pack::Combat_ratings_record> records_;
   };
 }
 
 int main(int argc, const char** argv) {
   return csv_to_include::main<Combat_rating_mult_by_ilvl>(argc, argv);
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <prescience_helper/sim/dbc_pack.hpp>
 #include <array>
 #include <string_view>
 #include <cassert>
@@ -6,15 +7,251 @@
 #include <vector>
 #include <optional>
 #include <span>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <future>
+#include <thread>
+#include <utility>
 
 namespace csv_to_include {
-  constexpr std::size_t BUFFER_SIZE = 64 * 1024 * 1024; //64mb
+  namespace pack = prescience_helper::sim::dbc::pack;
+
+  //outputs are written through a buffer this big, generated sources are mostly many small fprintfs
+  constexpr std::size_t OUTPUT_BUFFER_SIZE = 4 * 1024 * 1024; //4mb
+  //inputs smaller than this per thread aren't worth splitting further
+  constexpr std::size_t MIN_CHUNK_SIZE = 1024 * 1024; //1mb
+
+  //a read only view of a whole input file, unmapped when destroyed
+  struct Mapped_input {
+  public:
+    //throws std::runtime_error if path can't be mapped
+    Mapped_input(const char* path);
+    Mapped_input(Mapped_input const&) = delete;
+    Mapped_input& operator=(Mapped_input const&) = delete;
+    ~Mapped_input();
+
+    std::string_view view() const noexcept {
+      return { data_, size_ };
+    }
+  private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+  };
+
+  //fopen for writing with a OUTPUT_BUFFER_SIZE buffer, nullptr if it couldn't be opened
+  FILE* open_output(const char* path);
 
   template<typename Settings, std::size_t ...i>
   void forward_to_data(Settings& to, std::span<std::string_view, Settings::n> columns, std::span<std::size_t, Settings::columns.size()> indexes, std::index_sequence<i...>) {
     to.data(columns[indexes[i]]...);
   }
 
+  template<typename Settings, std::size_t ...i>
+  void forward_row_to_data(Settings& to, std::span<const std::string_view, Settings::columns.size()> row, std::index_sequence<i...>) {
+    to.data(row[i]...);
+  }
+
+  template<typename T>
+  T parse_int(std::string_view in) {
+    T returning{};
+    const auto res = std::from_chars(in.data(), in.data() + in.size(), returning);
+    if (res.ec != std::errc() || res.ptr != in.data() + in.size()) {
+      throw std::runtime_error{ "Couldn't parse '" + std::string{ in } + "' as an integer" };
+    }
+    return returning;
+  }
+
+  //parsed as a double and then narrowed, same as the generated source's literals
+  inline float parse_float(std::string_view in) {
+    double returning = 0;
+    const auto res = std::from_chars(in.data(), in.data() + in.size(), returning);
+    if (res.ec != std::errc() || res.ptr != in.data() + in.size()) {
+      throw std::runtime_error{ "Couldn't parse '" + std::string{ in } + "' as a number" };
+    }
+    return static_cast<float>(returning);
+  }
+
+  //one row per element of a constexpr array indexed by (ilvl - 1), so lookups are a bounds check and a load.
+  //rows can come in any order, missing ilvls are filled with gap
+  struct Ilvl_rows {
+  public:
+    void set(std::uint32_t ilvl, std::string row) {
+      if (ilvl == 0) {
+        throw std::runtime_error{ "ilvl 0 can't be in an ilvl indexed table" };
+      }
+      if (rows_.size() < ilvl) {
+        rows_.resize(ilvl);
+      }
+      rows_[ilvl - 1] = std::move(row);
+    }
+
+    void write(FILE* out, std::string_view type, std::string_view name, std::string_view gap) const {
+      fprintf(out, "  constexpr std::array<%.*s, %zu> %.*s{\n",
+        (std::int32_t)type.size(), type.data(),
+        rows_.size(),
+        (std::int32_t)name.size(), name.data());
+      for (auto const& row : rows_) {
+        const std::string_view writing = row.empty() ? gap : row;
+        fprintf(out, "%.*s", (std::int32_t)writing.size(), writing.data());
+      }
+      fprintf(out, "  };\n");
+    }
+  private:
+    std::vector<std::string> rows_;
+  };
+
+  //sorted and deduplicated, for std::binary_search
+  struct Id_set {
+  public:
+    static constexpr std::size_t PER_LINE = 12;
+
+    void add(std::string_view id) {
+      ids_.push_back(parse_int<std::uint32_t>(id));
+    }
+    void add(std::uint32_t id) {
+      ids_.push_back(id);
+    }
+
+    std::span<const std::uint32_t> sorted() {
+      std::sort(ids_.begin(), ids_.end());
+      ids_.erase(std::unique(ids_.begin(), ids_.end()), ids_.end());
+      return ids_;
+    }
+
+    //hex for ids that pack more than one field
+    void write(FILE* out, std::string_view name, bool hex = false) {
+      sorted();
+
+      fprintf(out, "  constexpr std::array<std::uint32_t, %zu> %.*s{\n", ids_.size(), (std::int32_t)name.size(), name.data());
+      for (std::size_t i = 0; i < ids_.size(); ++i) {
+        fprintf(out, hex ? "%s0x%08X,%s" : "%s%u,%s",
+          i % PER_LINE == 0 ? "    " : " ",
+          ids_[i],
+          i % PER_LINE == PER_LINE - 1 || i + 1 == ids_.size() ? "\n" : "");
+      }
+      fprintf(out, "  };\n");
+    }
+  private:
+    std::vector<std::uint32_t> ids_;
+  };
+
+  //ilvl indexed records for a pack section, indexed by (ilvl - 1) like Ilvl_rows
+  template<typename T>
+  void set_ilvl_record(std::vector<T>& records, std::uint32_t ilvl, T record) {
+    if (ilvl == 0) {
+      throw std::runtime_error{ "ilvl 0 can't be in an ilvl indexed table" };
+    }
+    if (records.size() < ilvl) {
+      records.resize(ilvl);
+    }
+    records[ilvl - 1] = record;
+  }
+
+  //a dbc pack being written. Each tool replaces its own sections, so they can all write into one pack
+  struct Pack_builder {
+  public:
+    //reads path if it's already a pack
+    Pack_builder(std::filesystem::path path) :
+      path_(std::move(path)) {
+
+      std::ifstream in{ path_, std::ios::binary };
+      if (!in) {
+        return;
+      }
+      std::vector<char> bytes{ std::istreambuf_iterator<char>{ in }, std::istreambuf_iterator<char>{} };
+      if (bytes.size() < sizeof(pack::Header)) {
+        throw std::runtime_error{ "Existing pack is too small" };
+      }
+      std::memcpy(&header_, bytes.data(), sizeof(pack::Header));
+      if (header_.magic != pack::MAGIC || header_.version != pack::VERSION) {
+        throw std::runtime_error{ "Existing file isn't a pack this version can update" };
+      }
+      for (std::uint32_t i = 0; i < header_.section_count; ++i) {
+        pack::Section_entry entry;
+        const std::size_t entry_at = sizeof(pack::Header) + i * sizeof(pack::Section_entry);
+        if (entry_at + sizeof(entry) > bytes.size()) {
+          throw std::runtime_error{ "Existing pack's section table is truncated" };
+        }
+        std::memcpy(&entry, bytes.data() + entry_at, sizeof(entry));
+        const std::uint64_t size = entry.count * entry.record_size;
+        if (entry.offset > bytes.size() || size > bytes.size() - entry.offset) {
+          throw std::runtime_error{ "Existing pack's section is truncated" };
+        }
+        auto& section = sections_[entry.id];
+        section.record_size = entry.record_size;
+        section.count = entry.count;
+        section.bytes.assign(bytes.data() + entry.offset, bytes.data() + entry.offset + size);
+      }
+    }
+
+    template<typename T>
+    void set(pack::Section id, std::span<const T> records) {
+      auto& section = sections_[id];
+      section.record_size = sizeof(T);
+      section.count = records.size();
+      section.bytes.resize(records.size_bytes());
+      std::memcpy(section.bytes.data(), records.data(), records.size_bytes());
+    }
+
+    //"expac.patch.minor", e.g. 10.2.5
+    void set_build(std::string_view build) {
+      const auto first_dot = build.find('.');
+      const auto second_dot = first_dot == std::string_view::npos ? std::string_view::npos : build.find('.', first_dot + 1);
+      if (second_dot == std::string_view::npos) {
+        throw std::runtime_error{ "Expected a build like 10.2.5" };
+      }
+      header_.expac = parse_int<std::uint8_t>(build.substr(0, first_dot));
+      header_.patch = parse_int<std::uint8_t>(build.substr(first_dot + 1, second_dot - first_dot - 1));
+      header_.minor = parse_int<std::uint8_t>(build.substr(second_dot + 1));
+    }
+
+    void save() {
+      header_.magic = pack::MAGIC;
+      header_.version = pack::VERSION;
+      header_.section_count = static_cast<std::uint32_t>(sections_.size());
+
+      std::vector<char> out(sizeof(pack::Header) + sections_.size() * sizeof(pack::Section_entry));
+      std::memcpy(out.data(), &header_, sizeof(header_));
+      std::size_t entry_at = sizeof(pack::Header);
+      for (auto const& [id, section] : sections_) {
+        out.resize((out.size() + pack::ALIGNMENT - 1) / pack::ALIGNMENT * pack::ALIGNMENT);
+        const pack::Section_entry entry{ id, section.record_size, out.size(), section.count };
+        std::memcpy(out.data() + entry_at, &entry, sizeof(entry));
+        entry_at += sizeof(entry);
+        out.insert(out.end(), section.bytes.begin(), section.bytes.end());
+      }
+
+      std::ofstream writing{ path_, std::ios::binary | std::ios::trunc };
+      writing.write(out.data(), static_cast<std::streamsize>(out.size()));
+      if (!writing) {
+        throw std::runtime_error{ "Couldn't write pack to " + path_.string() };
+      }
+    }
+  private:
+    struct Stored {
+      std::uint32_t record_size = 0;
+      std::uint64_t count = 0;
+      std::vector<char> bytes;
+    };
+
+    std::filesystem::path path_;
+    pack::Header header_{};
+    std::map<pack::Section, Stored> sections_;
+  };
+
   struct Parsed {
     std::string_view rest;
     bool found = false;
@@ -73,6 +310,8 @@ namespace csv_to_include {
 
     FILE* header_ = nullptr;
     FILE* source_ = nullptr;
+    //set when a pack path was given, sections are added to it as the output source is finished
+    Pack_builder* pack_ = nullptr;
   };
 
   template<typename Settings>
@@ -88,6 +327,33 @@ namespace csv_to_include {
   public:
     using Settings::Settings;
 
+    //in is the whole csv. It's split at row boundaries into a chunk per thread, the chunks are
+    //tokenized in parallel and their rows then go to data() in file order, on this thread.
+    //in has to outlive the parser, the views data() gets point into it
+    void read_all(std::string_view in) {
+      assert(!parsed_header_ && saved_.empty());
+
+      //the header says which columns we want, so it's done first
+      const Parsed header = base_.parse_for<using_line_delim_, '"'>(in);
+      if (!header.found) {
+        return;
+      }
+      parse_line_(header.found_str);
+      in = header.rest;
+
+      std::vector<std::future<std::vector<Row_>>> tokenizing;
+      for (const std::string_view chunk : split_chunks_(in)) {
+        tokenizing.push_back(std::async(std::launch::async, [this, chunk]() {
+          return tokenize_(chunk);
+          }));
+      }
+      for (auto& chunk : tokenizing) {
+        for (Row_ const& row : chunk.get()) {
+          forward_row_to_data<Settings>(*this, row, std::make_index_sequence<interesting_columns_n>{});
+        }
+      }
+    }
+
     void read(std::string_view in) {
       Parsed res;
 
@@ -104,28 +370,99 @@ namespace csv_to_include {
       saved_.append(in);
     }
   private:
-    void parse_line_(std::string_view in) {
+    using Row_ = std::array<std::string_view, interesting_columns_n>;
+
+    //splits in at row boundaries into about one chunk per thread. A row boundary is a line delim outside
+    //of quotes, so quotes are counted per chunk in parallel to know whether each chunk starts inside quotes
+    static std::vector<std::string_view> split_chunks_(std::string_view in) {
+      const std::size_t threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+      const std::size_t chunk_n = std::clamp<std::size_t>(in.size() / MIN_CHUNK_SIZE, 1, threads);
+
+      std::vector<std::size_t> starts;
+      std::vector<std::future<std::size_t>> counting;
+      for (std::size_t i = 0; i < chunk_n; ++i) {
+        starts.push_back(in.size() * i / chunk_n);
+      }
+      for (std::size_t i = 0; i + 1 < chunk_n; ++i) {
+        const auto counting_in = in.substr(starts[i], starts[i + 1] - starts[i]);
+        counting.push_back(std::async(std::launch::async, [counting_in]() {
+          return static_cast<std::size_t>(std::count(counting_in.begin(), counting_in.end(), '"'));
+          }));
+      }
+
+      std::vector<std::string_view> returning;
+      std::size_t chunk_start = 0;
+      bool in_quotes = false;
+      for (std::size_t i = 1; i < chunk_n; ++i) {
+        in_quotes ^= (counting[i - 1].get() % 2) != 0;
+
+        bool scanning_in_quotes = in_quotes;
+        std::size_t boundary = starts[i];
+        for (; boundary < in.size(); ++boundary) {
+          if (in[boundary] == '"') {
+            scanning_in_quotes = !scanning_in_quotes;
+          } else if (in[boundary] == using_line_delim_ && !scanning_in_quotes) {
+            ++boundary;
+            break;
+          }
+        }
+        //a row longer than a chunk can swallow the next start
+        if (boundary > chunk_start) {
+          returning.push_back(in.substr(chunk_start, boundary - chunk_start));
+          chunk_start = boundary;
+        }
+      }
+      returning.push_back(in.substr(chunk_start));
+      return returning;
+    }
+
+    //like read, a last row without a line delim after it isn't used
+    std::vector<Row_> tokenize_(std::string_view in) const {
+      std::vector<Row_> returning;
+      Parser_base base;
       std::array<std::string_view, column_n_> columns;
 
+      Parsed res;
+      while ((res = base.parse_for<using_line_delim_, '"'>(in)).found) {
+        split_line_(base, res.found_str, columns);
+        Row_& row = returning.emplace_back();
+        for (std::size_t i = 0; i < interesting_columns_n; ++i) {
+          row[i] = columns[interesting_columns_indexes_[i]];
+        }
+        in = res.rest;
+      }
+      return returning;
+    }
+
+    static void split_line_(Parser_base& base, std::string_view in, std::array<std::string_view, column_n_>& columns) {
+      //inputs are mapped as they are on disk, so windows line endings are ours to drop
+      if (using_line_delim_ == '\n' && !in.empty() && in.back() == '\r') {
+        in.remove_suffix(1);
+      }
       Parsed res;
       std::size_t in_i = 0;
-      while ((res = base_.parse_for<using_column_delim_, '"'>(in)).found) {
+      while ((res = base.parse_for<using_column_delim_, '"'>(in)).found) {
         if (column_n_ <= in_i) {
-          throw std::exception{ "Too many columns in row to generate an output row" };
+          throw std::runtime_error{ "Too many columns in row to generate an output row" };
         }
         columns[in_i] = res.found_str;
         ++in_i;
         in = res.rest;
       }
       if (column_n_ <= in_i) {
-        throw std::exception{ "Too many columns in row to generate an output row" };
+        throw std::runtime_error{ "Too many columns in row to generate an output row" };
       }
       columns[in_i] = in;
       ++in_i;
 
       if (in_i != column_n_) {
-        throw std::exception{ "Not enough columns in row to generate output row" };
+        throw std::runtime_error{ "Not enough columns in row to generate output row" };
       }
+    }
+
+    void parse_line_(std::string_view in) {
+      std::array<std::string_view, column_n_> columns;
+      split_line_(base_, in, columns);
 
       if (parsed_header_) {
         forward_to_data(*this, columns, interesting_columns_indexes_, std::make_index_sequence<interesting_columns_n>{});
@@ -152,10 +489,17 @@ namespace csv_to_include {
     std::string saved_;
   };
 
+  //maps the csv at path and gives all of it to parser. throws std::runtime_error if it can't be mapped
+  template<typename Settings>
+  void read_csv(const char* path, Parser<Settings>& parser) {
+    const Mapped_input in{ path };
+    parser.read_all(in.view());
+  }
+
   template<typename Settings>
   int main(int argc, const char** argv) {
     if (argc < 4) {
-      fprintf(stderr, "Expected %s <input csv path> <output header path> <output source path>\n", argv[0]);
+      fprintf(stderr, "Expected %s <input csv path> <output header path> <output source path> [<dbc pack path> [<build, e.g. 10.2.5>]]\n", argv[0]);
       return -1;
     }
 
@@ -163,31 +507,43 @@ namespace csv_to_include {
     const char* const header_out_path = argv[2];
     const char* const source_out_path = argv[3];
 
-    FILE* in = fopen(in_path, "r");
-    if (in == nullptr) {
-      fprintf(stderr, "Couldn't open input at '%s'\n", in_path);
+    std::optional<Mapped_input> in;
+    try {
+      in.emplace(in_path);
+    } catch (std::runtime_error const& e) {
+      fprintf(stderr, "%s\n", e.what());
       return -2;
     }
-    FILE* header_out = fopen(header_out_path, "w");
+    FILE* header_out = open_output(header_out_path);
     if (header_out == nullptr) {
       fprintf(stderr, "Couldn't open output at '%s'\n", header_out_path);
       return -3;
     }
-    FILE* source_out = fopen(source_out_path, "w");
+    FILE* source_out = open_output(source_out_path);
     if (source_out == nullptr) {
       fprintf(stderr, "Couldn't open output at '%s'\n", source_out_path);
       return -4;
     }
 
-    Parser<Settings> impl{ header_out, source_out };
-
-    std::vector<char> buffer;
-    buffer.resize(BUFFER_SIZE);
+    std::optional<Pack_builder> pack;
+    if (argc > 4) {
+      pack.emplace(argv[4]);
+      if (argc > 5) {
+        pack->set_build(argv[5]);
+      }
+    }
 
-    std::size_t read = 0;
+    {
+      Parser<Settings> impl{ header_out, source_out };
+      impl.pack_ = pack ? &*pack : nullptr;
+      impl.read_all(in->view());
+    }
+    fclose(header_out);
+    fclose(source_out);
 
-    while ((read = fread(buffer.data(), sizeof(char), BUFFER_SIZE, in)) > 0) {
-      impl.read(std::string_view{ buffer.data(), read });
+    //the settings add their sections when they're destroyed
+    if (pack) {
+      pack->save();
     }
 
     return 0;
@@ -1 +1,90 @@
-#include <csv_to_include/csv_to_include.hpp>
\ No newline at end of file
+#include <csv_to_include/csv_to_include.hpp>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+csv_to_include::Mapped_input::Mapped_input(const char* path) {
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error{ std::string{ "Couldn't open input at '" } + path + "'" };
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    throw std::runtime_error{ std::string{ "Couldn't map input at '" } + path + "'" };
+  }
+  if (size.QuadPart == 0) {
+    //nothing to map, an empty view
+    CloseHandle(file);
+    return;
+  }
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  const void* view = mapping == nullptr ? nullptr : MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    if (mapping != nullptr) {
+      CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    throw std::runtime_error{ std::string{ "Couldn't map input at '" } + path + "'" };
+  }
+  file_ = file;
+  mapping_ = mapping;
+  data_ = static_cast<const char*>(view);
+  size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error{ std::string{ "Couldn't open input at '" } + path + "'" };
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    throw std::runtime_error{ std::string{ "Couldn't map input at '" } + path + "'" };
+  }
+  if (info.st_size == 0) {
+    //nothing to map, an empty view
+    close(fd);
+    return;
+  }
+  void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  //the mapping keeps the file alive
+  close(fd);
+  if (view == MAP_FAILED) {
+    throw std::runtime_error{ std::string{ "Couldn't map input at '" } + path + "'" };
+  }
+  //read front to back by each chunk's thread
+  madvise(view, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+  data_ = static_cast<const char*>(view);
+  size_ = static_cast<std::size_t>(info.st_size);
+#endif
+}
+
+csv_to_include::Mapped_input::~Mapped_input() {
+  if (data_ == nullptr) {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_);
+  CloseHandle(file_);
+#else
+  munmap(const_cast<char*>(data_), size_);
+#endif
+}
+
+FILE* csv_to_include::open_output(const char* path) {
+  FILE* returning = fopen(path, "w");
+  if (returning != nullptr) {
+    setvbuf(returning, nullptr, _IOFBF, OUTPUT_BUFFER_SIZE);
+  }
+  return returning;
+}
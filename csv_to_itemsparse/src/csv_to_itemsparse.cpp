@@ -108,6 +108,18 @@ namespace {
         return;
       }
 
+      csv_to_include::pack::Item_sparse_record record{};
+      record.id = csv_to_include::parse_int<std::uint32_t>(id);
+      record.slot = csv_to_include::parse_int<std::int32_t>(slot);
+      const std::array<std::string_view, 10> types{ stat_type0, stat_type1, stat_type2, stat_type3, stat_type4, stat_type5, stat_type6, stat_type7, stat_type8, stat_type9 };
+      const std::array<std::string_view, 10> amounts{ stat_amount0, stat_amount1, stat_amount2, stat_amount3, stat_amount4, stat_amount5, stat_amount6, stat_amount7, stat_amount8, stat_amount9 };
+      for (std::size_t i = 0; i < types.size(); ++i) {
+        //same narrowing as Item_sparse::Stat's constructor
+        record.stat_types[i] = static_cast<std::int8_t>(csv_to_include::parse_int<int>(types[i]));
+        record.stat_amounts[i] = static_cast<std::uint16_t>(csv_to_include::parse_int<int>(amounts[i]));
+      }
+      records_.push_back(record);
+
       fprintf(source_,
         "    returning.emplace(%.*s, dbc::Item_sparse{ %.*s,"
         " %.*s, %.*s, %.*s, %.*s,"
@@ -132,11 +144,19 @@ namespace {
     }
 
     ~Item_sparse() {
+      if (pack_ != nullptr) {
+        std::sort(records_.begin(), records_.end(), [](auto const& lhs, auto const& rhs) {
+          return lhs.id < rhs.id;
+          });
+        pack_->set(csv_to_include::pack::Section::item_sparse, std::span<const csv_to_include::pack::Item_sparse_record>{ records_ });
+      }
       fprintf(source_,
         "    return returning;\n"
         "  }();\n"
         "\n");
     }
+  private:
+    std::vector<csv_to_include::pack::Item_sparse_record> records_;
   };
 }
 
@@ -33,7 +33,6 @@ namespace {
         "#pragma once\n"
         "#include <cstdint>\n"
         "#include <array>\n"
-        "#include <unordered_map>"
         "\n"
         "namespace prescience_helper::sim::dbc {\n"
         "  struct Rand_prop_point {\n"
@@ -43,55 +42,88 @@ namespace {
         "    std::array<float,5> budget;\n"
         "  };\n"
         "\n"
-        "  extern const std::unordered_map<std::uint32_t,Rand_prop_point> RAND_PROP_POINT;\n"
+        "  //nullptr if the ilvl isn't in the table\n"
+        "  Rand_prop_point const* rand_prop_point(std::uint32_t ilvl) noexcept;\n"
         "}\n"
         "\n");
 
       fprintf(source_,
         "#include <prescience_helper/sim/dbc/rand_prop_points.hpp>\n"
+        "#include <prescience_helper/sim/dbc/pack.hpp>\n"
+        "#include <array>\n"
+        "#include <span>\n"
         "namespace dbc = prescience_helper::sim::dbc;\n"
+        "namespace pack = prescience_helper::sim::dbc::pack;\n"
         "\n"
-        "const std::unordered_map<std::uint32_t, dbc::Rand_prop_point> dbc::RAND_PROP_POINT = []() {\n"
-        "  std::unordered_map<std::uint32_t, dbc::Rand_prop_point> returning;\n");
+        "namespace {\n"
+        "  //indexed by ilvl - 1, gaps have ilvl 0\n");
     }
     void data(std::string_view id, std::string_view damage_replace_stat, std::string_view damage_secondary,
       std::string_view epic0, std::string_view epic1, std::string_view epic2, std::string_view epic3, std::string_view epic4,
       std::string_view superior0, std::string_view superior1, std::string_view superior2, std::string_view superior3, std::string_view superior4,
       std::string_view good0, std::string_view good1, std::string_view good2, std::string_view good3, std::string_view good4) {
       if (epic0 != superior0 || superior0 != good0) {
-        throw std::exception{ "Stat weights vary by item type" };
+        throw std::runtime_error{ "Stat weights vary by item type" };
       }
       if (epic1 != superior1 || superior1 != good1) {
-        throw std::exception{ "Stat weights vary by item type" };
+        throw std::runtime_error{ "Stat weights vary by item type" };
       }
       if (epic2 != superior2 || superior2 != good2) {
-        throw std::exception{ "Stat weights vary by item type" };
+        throw std::runtime_error{ "Stat weights vary by item type" };
       }
       if (epic3 != superior3 || superior3 != good3) {
-        throw std::exception{ "Stat weights vary by item type" };
+        throw std::runtime_error{ "Stat weights vary by item type" };
       }
       if (epic4 != superior4 || superior4 != good4) {
-        throw std::exception{ "Stat weights vary by item type" };
+        throw std::runtime_error{ "Stat weights vary by item type" };
       }
 
-      fprintf(source_,
-        "  returning.emplace(%.*s, Rand_prop_point{ %.*s, %.*s, %.*s, { %.*s, %.*s, %.*s, %.*s, %.*s } });\n",
-        (std::int32_t)id.size(), id.data(),
-        (std::int32_t)id.size(), id.data(),
-        (std::int32_t)damage_replace_stat.size(), damage_replace_stat.data(),
-        (std::int32_t)damage_secondary.size(), damage_secondary.data(),
-        (std::int32_t)epic0.size(), epic0.data(),
-        (std::int32_t)epic1.size(), epic1.data(),
-        (std::int32_t)epic2.size(), epic2.data(),
-        (std::int32_t)epic3.size(), epic3.data(),
-        (std::int32_t)epic4.size(), epic4.data());
+      std::string row = "    dbc::Rand_prop_point{ ";
+      for (const auto column : { id, damage_replace_stat, damage_secondary }) {
+        row.append(column).append(", ");
+      }
+      row.append("{ ");
+      for (const auto column : { epic0, epic1, epic2, epic3 }) {
+        row.append(column).append(", ");
+      }
+      row.append(epic4).append(" } },\n");
+      const auto ilvl = csv_to_include::parse_int<std::uint32_t>(id);
+      rows_.set(ilvl, std::move(row));
+
+      csv_to_include::pack::Rand_prop_point_record record{};
+      record.ilvl = ilvl;
+      record.damage_replace_stat = csv_to_include::parse_float(damage_replace_stat);
+      record.damage_secondary = csv_to_include::parse_float(damage_secondary);
+      record.budget = {
+        csv_to_include::parse_float(epic0),
+        csv_to_include::parse_float(epic1),
+        csv_to_include::parse_float(epic2),
+        csv_to_include::parse_float(epic3),
+        csv_to_include::parse_float(epic4) };
+      csv_to_include::set_ilvl_record(records_, ilvl, record);
     }
     ~Rand_prop_points() {
+      if (pack_ != nullptr) {
+        pack_->set(csv_to_include::pack::Section::rand_prop_points, std::span<const csv_to_include::pack::Rand_prop_point_record>{ records_ });
+      }
+      rows_.write(source_, "dbc::Rand_prop_point", "RAND_PROP_POINT", "    dbc::Rand_prop_point{ 0, 0, 0, { 0, 0, 0, 0, 0 } },\n");
       fprintf(source_,
-        "  return returning;\n"
-        "}();\n"
+        "}\n"
+        "\n"
+        "dbc::Rand_prop_point const* dbc::rand_prop_point(std::uint32_t ilvl) noexcept {\n"
+        "  //ilvl 0 wraps around and fails the bounds check\n"
+        "  const std::uint32_t index = ilvl - 1;\n"
+        "  const auto table = pack::table(pack::Section::rand_prop_points, std::span<const dbc::Rand_prop_point>{ RAND_PROP_POINT });\n"
+        "  if (index >= table.size() || table[index].ilvl != ilvl) {\n"
+        "    return nullptr;\n"
+        "  }\n"
+        "  return &table[index];\n"
+        "}\n"
         "\n");
     }
+  private:
+    csv_to_include::Ilvl_rows rows_;
+    std::vector<csv_to_include::pack::Rand_prop_point_record> records_;
   };
 }
 
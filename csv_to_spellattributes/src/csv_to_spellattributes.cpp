@@ -0,0 +1,180 @@
+#include <csv_to_include/csv_to_include.hpp>
+#include <clogparser/parser.hpp>
+#include <span>
+#include <bit>
+
+namespace {
+  namespace pack = csv_to_include::pack;
+
+  constexpr std::uint64_t CAN_NOT_CRIT = 0x20000000;
+  constexpr std::uint64_t ALLOW_CLASS_ABILITY_PROCS = 0x1;
+
+  static constexpr std::string_view SCHOOL_DAMAGE = "2";
+
+  //every spell with any attribute, by id
+  using Attributes = std::map<std::uint32_t, std::uint8_t>;
+
+  void add_attribute(Attributes& to, std::string_view spell_id_str, std::uint8_t attribute) {
+    const auto spell_id = csv_to_include::parse_int<std::uint32_t>(spell_id_str);
+    if (spell_id > pack::SPELL_ID_MAX) {
+      throw std::runtime_error{ "Spell id " + std::string{ spell_id_str } + " doesn't fit next to its attributes" };
+    }
+    to[spell_id] |= attribute;
+  }
+
+  struct Spell_effect : csv_to_include::Parser_settings_base {
+    static constexpr std::size_t n = 36;
+    static constexpr std::array<std::string_view, 5> columns{
+      "SpellID",
+      "Effect",
+      "EffectBonusCoefficient",
+      "BonusCoefficientFromAP",
+      "DifficultyID"
+    };
+
+    Spell_effect(Attributes& attributes) : Parser_settings_base(nullptr, nullptr),
+      attributes_(attributes) {}
+
+    void data(std::string_view spell_id, std::string_view effect, std::string_view coefficient, std::string_view ap_coefficient, std::string_view difficulty_id) {
+
+      if (effect != SCHOOL_DAMAGE || (coefficient == "0"  && ap_coefficient == "0") || difficulty_id != "0") {
+        return;
+      }
+
+      add_attribute(attributes_, spell_id, pack::SPELL_SCALES_WITH_PRIMARY);
+    }
+  private:
+    Attributes& attributes_;
+  };
+
+  struct Spell_misc : csv_to_include::Parser_settings_base {
+    static constexpr std::size_t n = 31;
+    static constexpr std::array<std::string_view, 3> columns{
+      "SpellID",
+      "Attributes_2",
+      "Attributes_13"
+    };
+
+    Spell_misc(Attributes& attributes) : Parser_settings_base(nullptr, nullptr),
+      attributes_(attributes) {}
+
+    void data(std::string_view spell_id, std::string_view attr2_str, std::string_view attr13_str) {
+      const std::uint64_t attr2 = std::bit_cast<std::uint64_t>(clogparser::helpers::parseInt<std::int64_t>(attr2_str));
+      if ((attr2 & CAN_NOT_CRIT) != 0) {
+        add_attribute(attributes_, spell_id, pack::SPELL_CAN_NOT_CRIT);
+      }
+
+      const std::uint64_t attr13 = std::bit_cast<std::uint64_t>(clogparser::helpers::parseInt<std::int64_t>(attr13_str));
+      if ((attr13 & ALLOW_CLASS_ABILITY_PROCS) != 0) {
+        add_attribute(attributes_, spell_id, pack::SPELL_ALLOW_CLASS_ABILITY_PROCS);
+      }
+    }
+  private:
+    Attributes& attributes_;
+  };
+
+  template<typename Settings>
+  bool read(const char* path, Attributes& attributes) {
+    csv_to_include::Parser<Settings> parser{ attributes };
+    try {
+      csv_to_include::read_csv(path, parser);
+    } catch (std::runtime_error const& e) {
+      fprintf(stderr, "%s\n", e.what());
+      return false;
+    }
+    return true;
+  }
+
+  void write_header(FILE* header) {
+    fprintf(header,
+      "#pragma once\n"
+      "#include <cstdint>\n"
+      "\n"
+      "namespace prescience_helper::sim::dbc {\n"
+      "  constexpr std::uint8_t SPELL_CAN_NOT_CRIT = %u;\n"
+      "  constexpr std::uint8_t SPELL_ALLOW_CLASS_ABILITY_PROCS = %u;\n"
+      "  constexpr std::uint8_t SPELL_SCALES_WITH_PRIMARY = %u;\n"
+      "\n"
+      "  //the SPELL_* bits that apply to spell_id, 0 for spells we know nothing about\n"
+      "  std::uint8_t spell_attributes(std::uint64_t spell_id) noexcept;\n"
+      "}\n"
+      "\n",
+      pack::SPELL_CAN_NOT_CRIT,
+      pack::SPELL_ALLOW_CLASS_ABILITY_PROCS,
+      pack::SPELL_SCALES_WITH_PRIMARY);
+  }
+
+  void write_source(FILE* source, csv_to_include::Id_set& packed) {
+    fprintf(source,
+      "#include <prescience_helper/sim/dbc/spell_attributes.hpp>\n"
+      "#include <prescience_helper/sim/dbc/pack.hpp>\n"
+      "#include <algorithm>\n"
+      "#include <array>\n"
+      "#include <span>\n"
+      "\n"
+      "namespace dbc = prescience_helper::sim::dbc;\n"
+      "namespace pack = prescience_helper::sim::dbc::pack;\n"
+      "\n"
+      "namespace {\n"
+      "  //(spell id << 8) | attributes, so one binary search finds both\n");
+    packed.write(source, "SPELL_ATTRIBUTES", true);
+    fprintf(source,
+      "}\n"
+      "\n"
+      "std::uint8_t dbc::spell_attributes(std::uint64_t spell_id) noexcept {\n"
+      "  if (spell_id > pack::SPELL_ID_MAX) {\n"
+      "    return 0;\n"
+      "  }\n"
+      "  const auto entries = pack::table(pack::Section::spell_attributes, std::span<const std::uint32_t>{ SPELL_ATTRIBUTES });\n"
+      "  const auto found = std::lower_bound(entries.begin(), entries.end(), static_cast<std::uint32_t>(spell_id << 8));\n"
+      "  if (found == entries.end() || (*found >> 8) != spell_id) {\n"
+      "    return 0;\n"
+      "  }\n"
+      "  return static_cast<std::uint8_t>(*found & 0xFF);\n"
+      "}\n"
+      "\n");
+  }
+}
+
+int main(int argc, const char** argv) {
+  if (argc < 5) {
+    fprintf(stderr, "Expected %s <SpellEffect csv path> <SpellMisc csv path> <output header path> <output source path> [<dbc pack path> [<build, e.g. 10.2.5>]]\n", argv[0]);
+    return -1;
+  }
+
+  Attributes attributes;
+  if (!read<Spell_effect>(argv[1], attributes) || !read<Spell_misc>(argv[2], attributes)) {
+    return -2;
+  }
+
+  csv_to_include::Id_set packed;
+  for (auto const& [spell_id, attribute] : attributes) {
+    packed.add(spell_id << 8 | attribute);
+  }
+
+  FILE* header_out = csv_to_include::open_output(argv[3]);
+  if (header_out == nullptr) {
+    fprintf(stderr, "Couldn't open output at '%s'\n", argv[3]);
+    return -3;
+  }
+  FILE* source_out = csv_to_include::open_output(argv[4]);
+  if (source_out == nullptr) {
+    fprintf(stderr, "Couldn't open output at '%s'\n", argv[4]);
+    return -4;
+  }
+  write_header(header_out);
+  write_source(source_out, packed);
+  fclose(header_out);
+  fclose(source_out);
+
+  if (argc > 5) {
+    csv_to_include::Pack_builder building{ argv[5] };
+    if (argc > 6) {
+      building.set_build(argv[6]);
+    }
+    building.set(pack::Section::spell_attributes, packed.sorted());
+    building.save();
+  }
+
+  return 0;
+}
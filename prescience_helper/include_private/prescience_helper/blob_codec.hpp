@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+//every Logged blob starts with a codec id and the format of the payload it holds,
+//compressed payloads then have their uncompressed size as a little endian uint32
+namespace prescience_helper::blob_codec {
+  enum class Codec : std::uint8_t {
+    raw = 0,
+    lz4 = 1,
+    zstd = 2,
+  };
+
+  constexpr std::array<std::string_view, 3> CODEC_NAMES{
+    "raw",
+    "lz4",
+    "zstd"
+  };
+
+  //Configs rows choosing the codec new blobs are written with, in Logged column order
+  constexpr std::array<std::string_view, 4> CODEC_CONFIGS{
+    "damage_codec",
+    "stats_codec",
+    "deaths_codec",
+    "rezzes_codec"
+  };
+
+  //payload layouts are recorded per blob, so a column's layout can change without rewriting old rows
+  constexpr std::uint8_t FORMAT_EMPTY = 0;
+  constexpr std::uint8_t FORMAT_FIXED_WIDTH = 1;
+  //stats only, see logged::serialize(sim::Stats_timeline)
+  constexpr std::uint8_t FORMAT_STATS_DELTA = 2;
+  //Summary rows, see logged::serialize(sim::summary::Summary)
+  constexpr std::uint8_t FORMAT_SUMMARY = 3;
+
+  constexpr std::size_t HEADER_SIZE = 2;
+  constexpr std::size_t COMPRESSED_HEADER_SIZE = HEADER_SIZE + sizeof(std::uint32_t);
+
+  //whether this build can encode/decode the codec
+  bool available(Codec codec) noexcept;
+
+  std::optional<Codec> from_name(std::string_view name) noexcept;
+
+  //codecs this build doesn't support are written as raw
+  void encode(Codec codec, std::uint8_t format, std::span<const std::byte> payload, std::vector<std::byte>& out);
+
+  struct Decoded {
+    Codec codec;
+    std::uint8_t format;
+    //either points into the input, or into the scratch buffer passed to decode
+    std::span<const std::byte> payload;
+  };
+
+  //an empty (or NULL) blob decodes to an empty raw payload with FORMAT_EMPTY
+  Decoded decode(std::span<const std::byte> in, std::vector<std::byte>& scratch);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <prescience_helper/ingest.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+//logs that were archived, read without unpacking them first. Offsets into them are offsets into what they
+//decompress to, and as archives don't grow they're read once
+namespace prescience_helper::compressed {
+  enum class Format : std::uint8_t {
+    plain,
+    gzip,
+    zstd,
+    //every member of the archive, one after the other
+    zip
+  };
+
+  //by extension, .gz, .zst and .zip. Anything else is plain
+  Format format_of(std::filesystem::path const& path) noexcept;
+
+  //false if the library the format needs wasn't found at build time
+  bool is_supported(Format format) noexcept;
+
+  //decompresses into one buffer on its own thread while the parser reads the other
+  struct Decompressing_file final : public File {
+  public:
+    //each of the 2 buffers is half of buffer_size
+    Decompressing_file(std::size_t buffer_size);
+    ~Decompressing_file();
+
+    Decompressing_file(Decompressing_file const&) = delete;
+    Decompressing_file& operator=(Decompressing_file const&) = delete;
+
+    //skips the first offset bytes of what path decompresses to. Throws if format isn't supported
+    void open(std::filesystem::path path, Format format, std::uintmax_t offset);
+
+    //rethrows whatever went wrong decompressing
+    std::string_view next() override final;
+
+    //bytes of the archive itself decompressed so far
+    std::uint64_t compressed_read() const noexcept {
+      return compressed_read_.load(std::memory_order_relaxed);
+    }
+  private:
+    struct Buffer {
+      std::vector<char> data;
+      std::size_t size = 0;
+      bool full = false;
+    };
+
+    void stop_() noexcept;
+    void decompress_(std::filesystem::path path, Format format, std::uintmax_t offset);
+
+    std::size_t buffer_size_;
+    std::array<Buffer, 2> buffers_;
+    //the buffer next returns next
+    std::size_t reading_ = 0;
+    //the buffer next returned last, handed back to the decompressor on the next call
+    bool holding_ = false;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    bool done_ = false;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+    std::atomic<std::uint64_t> compressed_read_{ 0 };
+
+    std::thread thread_;
+  };
+}
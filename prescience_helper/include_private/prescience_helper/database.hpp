@@ -0,0 +1,44 @@
+#pragma once
+
+#include <prescience_helper/sqlite3_wrapper.hpp>
+#include <prescience_helper/migrations.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+//opening prescience_helper.db and getting it to the schema this build expects
+namespace prescience_helper::database {
+  constexpr std::int32_t EXPECTED_VERSION = 8;
+
+  constexpr std::string_view DEFAULT_PATH = "./prescience_helper.db";
+
+  enum class Result {
+    ready,
+    //the db was empty, and creating our tables failed
+    couldnt_create,
+    too_new,
+    no_path,
+  };
+
+  //each connection should only be used from one thread at a time
+  std::optional<Db> open(std::filesystem::path const& path);
+  //for connections that only ever generate, the db must already be prepared
+  std::optional<Db> open_read_only(std::filesystem::path const& path);
+
+  //lets readers keep going while the parser writes. Stays set in the db file
+  bool enable_concurrent_readers(Db const& db);
+
+  //table is Encounter_type or Difficulty, looked up by id or name
+  std::optional<std::int32_t> find_id(Db const& db, std::string_view table, std::string_view id_or_name);
+
+  //the step of query's plan that scans a whole Logged, Encounter, Player or Summary table, nullopt if it only uses indexes
+  std::optional<std::string> full_scan(Db const& db, std::string_view query);
+
+  //creates the tables in a new db, or migrates an old one up to EXPECTED_VERSION. Then rebuilds Summary
+  //if the half life setting changed since it was built
+  Result prepare(Db const& db, std::function<void(migrations::Progress const&)> const& progress);
+}
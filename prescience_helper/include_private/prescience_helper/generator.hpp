@@ -0,0 +1,47 @@
+#pragma once
+
+#include <prescience_helper/sqlite3_wrapper.hpp>
+#include <prescience_helper/sim.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace prescience_helper {
+  struct Generated {
+    //the string to paste back into the addon, empty if generation failed
+    std::string output;
+    //why generation failed, empty on success
+    std::string error;
+  };
+
+  //builds addon input strings out of the addon's output string and our Summary rows
+  struct Generator {
+  public:
+    //every pull is already merged into the one row, however many there are
+    static constexpr std::string_view MEMBER_SUMMARY_QUERY =
+      "SELECT Summary.summary FROM Summary"
+      " INNER JOIN Player ON Summary.player = Player.id"
+      " WHERE Player.blizz_guid = ? AND Summary.spec = ? AND Summary.type = ? AND Summary.difficulty = ?;";
+
+    static constexpr std::string_view AUG_SUMMARY_QUERY =
+      "SELECT Summary.summary FROM Summary"
+      " INNER JOIN Player ON Summary.player = Player.id"
+      " WHERE Player.blizz_guid = ? AND Summary.spec = 1473 AND Summary.type = ? AND Summary.difficulty = ?;";
+
+    Generator(Db const& db);
+
+    Generator(Generator const&) = delete;
+    Generator& operator=(Generator const&) = delete;
+
+    Generated generate(std::string_view input, std::int32_t encounter, std::int32_t difficulty, clogparser::Period window_size);
+  private:
+    Stmt get_aug_summary_;
+    Stmt get_member_summary_;
+
+    //compressed blobs are decompressed into this, then deserialized straight out of it
+    std::vector<std::byte> decode_scratch_;
+  };
+}
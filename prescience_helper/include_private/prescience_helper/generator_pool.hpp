@@ -0,0 +1,59 @@
+#pragma once
+
+#include <prescience_helper/generator.hpp>
+#include <prescience_helper/sqlite3_wrapper.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace prescience_helper {
+  //read only connections, each with its own Generator, handed out to one thread at a time
+  struct Generator_pool {
+  public:
+    struct Connection {
+      Db db;
+      Generator generator;
+
+      Connection(Db db_in);
+    };
+
+    struct Lease {
+    public:
+      Lease(Generator_pool& pool, std::unique_ptr<Connection> connection);
+      Lease(Lease&&) = default;
+      Lease& operator=(Lease&&) = delete;
+      ~Lease();
+
+      Connection& operator*() const noexcept {
+        return *connection_;
+      }
+      Connection* operator->() const noexcept {
+        return connection_.get();
+      }
+    private:
+      Generator_pool& pool_;
+      std::unique_ptr<Connection> connection_;
+    };
+
+    //false from valid() if any connection couldn't be opened
+    Generator_pool(std::filesystem::path const& path, std::size_t size);
+
+    bool valid() const noexcept {
+      return valid_;
+    }
+
+    //blocks until a connection is free
+    Lease acquire();
+  private:
+    void release_(std::unique_ptr<Connection> connection);
+
+    std::mutex mutex_;
+    std::condition_variable released_;
+    std::vector<std::unique_ptr<Connection>> free_;
+    bool valid_ = true;
+  };
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <prescience_helper/blob_codec.hpp>
+#include <prescience_helper/compressed_log.hpp>
+#include <prescience_helper/ingest.hpp>
+#include <prescience_helper/log_finder.hpp>
+#include <prescience_helper/logged_writer.hpp>
+#include <prescience_helper/memory.hpp>
+#include <prescience_helper/progress.hpp>
+#include <prescience_helper/sim.hpp>
+#include <prescience_helper/sim/summary.hpp>
+#include <prescience_helper/sqlite3_wrapper.hpp>
+#include <prescience_helper/summaries.hpp>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+//turning logs into Encounter/Logged rows. Preparing (reading, simulating and encoding) doesn't touch the db,
+//so it can be spread over threads, while storing has to happen on the thread owning the db connection
+namespace prescience_helper {
+  struct Patch {
+    clogparser::events::Combat_log_version::Build_version build;
+    std::int32_t id;
+  };
+
+  //per Log_preparer, overridden by the ingest_memory_budget_mb config if it's set
+  constexpr std::size_t DEFAULT_MEMORY_BUDGET = 1024 * 1024 * 1024; //1gb
+  constexpr std::string_view MEMORY_BUDGET_CONFIG = "ingest_memory_budget_mb";
+  //where each simulated pull's events are kept in an encounter_cache file, for resimulating. Unset keeps none
+  constexpr std::string_view ENCOUNTER_CACHE_CONFIG = "encounter_cache_dir";
+
+  //every stored pull, so preparing can skip pulls we already have at their ENCOUNTER_START instead of
+  //reading and simulating them only for the store to throw them away. Shared by the preparers and the store
+  struct Stored_encounters {
+  public:
+    //Encounter's unique key
+    struct Key {
+      std::int64_t start_time_ms;
+      std::int32_t type;
+      std::int32_t difficulty;
+      std::int32_t patch;
+
+      constexpr bool operator==(Key const&) const noexcept = default;
+    };
+
+    void load(Db const& db);
+
+    bool contains(Key const& key) const;
+    void insert(Key const& key);
+  private:
+    struct Hash {
+      std::size_t operator()(Key const& key) const noexcept;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_set<Key, Hash> keys_;
+  };
+
+  //the encounter_cache file of the pull with key in directory
+  std::filesystem::path encounter_cache_path(std::filesystem::path const& directory, Stored_encounters::Key const& key);
+
+  //what preparing needs from the db, read once up front
+  struct Ingest_config {
+    std::vector<Patch> patches;
+    std::unordered_set<std::int32_t> difficulty_ids;
+    //damage, stats, deaths, rezzes
+    std::array<blob_codec::Codec, 4> codecs{};
+    Ingest_options ingest_options{ DEFAULT_MEMORY_BUDGET };
+    //copies of the config share it, so every preparer of a pipeline reuses the same raiders' gear
+    std::shared_ptr<sim::Gear_cache> gear_cache = std::make_shared<sim::Gear_cache>();
+    //the store's, nullptr to simulate every pull and let the store sort out what it already has
+    std::shared_ptr<Stored_encounters> stored;
+    //from ENCOUNTER_CACHE_CONFIG, empty to not write encounter_cache files
+    std::filesystem::path cache_directory;
+  };
+
+  Ingest_config load_ingest_config(Db const& db);
+
+  struct Log_file final : public File {
+  public:
+    static constexpr std::size_t BUFFER_SIZE = 128 * 1024 * 1024; //128mb
+
+    Log_file();
+    Log_file(std::size_t buffer_size);
+
+    //offset is into what the log decompresses to when format isn't plain. With until set, reading stops after
+    //the line that starts there
+    void open(std::filesystem::path path, compressed::Format format, std::uintmax_t offset, std::optional<std::uintmax_t> until = std::nullopt);
+
+    std::string_view next() override final;
+
+    //each chunk read is added to reporter, nullptr to stop
+    void report_to(progress::Reporter* reporter) noexcept {
+      reporter_ = reporter;
+    }
+  private:
+    //cuts read short at the end of the line starting at until_
+    std::string_view limit_(std::string_view read) noexcept;
+
+    std::vector<char> buffer_;
+    std::ifstream input_;
+    std::optional<std::uintmax_t> until_;
+    //of the next byte read
+    std::uintmax_t position_ = 0;
+    bool reached_until_ = false;
+    compressed::Decompressing_file decompressing_;
+    bool is_compressed_ = false;
+    //of decompressing_.compressed_read(), so progress is in bytes of the file like the backlog is
+    std::uint64_t compressed_reported_ = 0;
+    progress::Reporter* reporter_ = nullptr;
+  };
+
+  struct Prepared_player {
+    std::string guid;
+    std::int32_t spec;
+    //encoded Logged blobs, damage, stats, deaths, rezzes
+    std::array<std::vector<std::byte>, 4> blobs;
+    //merged into the player's Summary row as it's stored
+    sim::summary::Summary summary;
+  };
+
+  struct Prepared_encounter {
+    std::int32_t type;
+    std::string name;
+    std::int32_t difficulty;
+    std::int32_t patch;
+    std::int64_t start_time_ms;
+    std::int64_t duration_ms;
+    std::vector<Prepared_player> players;
+    memory::Encounter_usage memory_usage;
+  };
+
+  //an encounter from a build newer than we can simulate, kept in Deferred_encounter so that once we can only it
+  //is read again, not the whole log. Offsets are from the start of the log
+  struct Deferred_encounter {
+    std::filesystem::path path;
+    std::uintmax_t start_byte;
+    std::uintmax_t end_byte;
+    clogparser::events::Combat_log_version::Build_version build;
+  };
+
+  struct Prepared_log {
+    //old_useful and last_patch are moved forward as encounters are prepared
+    Log_finder::Log log;
+    std::uintmax_t read_from = 0;
+    //encounters from a patch newer than we can simulate, stored by finish_log
+    std::vector<Deferred_encounter> deferred;
+    //set when only this deferred encounter is read, rather than the rest of the log
+    std::optional<Deferred_encounter> rereading;
+    //only filled by callers that prepare a whole log before storing it
+    std::vector<Prepared_encounter> encounters;
+    //filled in by open, then each encounter next returns is added
+    memory::Log_usage memory_usage;
+  };
+
+  //a Prepared_log to reread each deferred encounter we can simulate now
+  std::vector<Prepared_log> load_ready_deferred(Db const& db);
+
+  struct Log_preparer {
+  public:
+    Log_preparer(Ingest_config config);
+    Log_preparer(Ingest_config config, std::size_t buffer_size);
+
+    Log_preparer(Log_preparer const&) = delete;
+    Log_preparer& operator=(Log_preparer const&) = delete;
+
+    //reads the rest of the log, its encounters are then simulated one at a time by next
+    void open(Prepared_log& log);
+
+    //false once there are no encounters left worth storing
+    bool next(Prepared_log& log, Prepared_encounter& out);
+
+    //simulates and encodes an encounter we already know the patch of, what next does for each encounter it returns
+    void simulate(Encounter const& encounter, std::int32_t patch, Prepared_encounter& out);
+
+    //reports reading and simulating to reporter, which must outlive us. nullptr to stop
+    void report_to(progress::Reporter* reporter) noexcept;
+  private:
+    //the patch of an encounter with no build of its own is the last one we saw in the log
+    std::optional<std::int32_t> patch_of_(Encounter const& encounter, std::optional<std::int32_t> last_patch) const;
+
+    Ingest_config config_;
+    progress::Reporter* reporter_ = nullptr;
+    Log_file reader_;
+    clogparser::String_store strings_;
+    std::vector<Encounter> ingested_;
+    std::size_t ingested_pos_ = 0;
+    //the encounter last handed to next, freed (spill file and all) when the next one is
+    Encounter current_;
+
+    std::vector<std::byte> serialized_;
+  };
+
+  struct Encounter_store {
+  public:
+    //run for every encounter stored whose type we already have
+    static constexpr std::string_view EXISTING_ENCOUNTER_QUERY =
+      "SELECT COUNT(1) FROM Encounter WHERE start_time = ? AND type = ? AND difficulty = ? AND patch = ?;";
+
+    Encounter_store(Db const& db);
+
+    Encounter_store(Encounter_store const&) = delete;
+    Encounter_store& operator=(Encounter_store const&) = delete;
+
+    //returns the amount of encounters committed if this caused a flush, 0 otherwise.
+    //encounters we already have are skipped
+    std::size_t store(Prepared_encounter const& encounter);
+
+    //records how far we've read the log and what of it was deferred, in the same transaction as its encounters.
+    //A reread deferred encounter is no longer deferred
+    void finish_log(Prepared_log const& log, Log_finder& finder);
+
+    //swaps the Logged rows of a stored encounter for encounter's, and takes it out of Pending_resimulation.
+    //Summary isn't touched, so it has to be rebuilt once everything is replaced
+    std::size_t replace(std::int64_t encounter_id, Prepared_encounter const& encounter);
+
+    //encounter types seen for the first time since the last call, name and id
+    void take_new_encounter_types(std::vector<std::pair<std::string, std::int32_t>>& into);
+
+    bool has_new_encounter_types() const noexcept {
+      return !new_encounter_types_.empty();
+    }
+
+    Logged_writer& writer() noexcept {
+      return writer_;
+    }
+
+    //for Ingest_config::stored, kept up to date with every encounter stored
+    std::shared_ptr<Stored_encounters> const& stored() const noexcept {
+      return stored_;
+    }
+  private:
+    Db const& db_;
+
+    Stmt insert_encounter_type_stmt_;
+    Stmt check_for_existing_encounter_stmt_;
+    Stmt insert_encounter_stmt_;
+    Stmt update_log_read_;
+    Stmt insert_deferred_stmt_;
+    Stmt delete_deferred_stmt_;
+    Stmt delete_logged_stmt_;
+    Stmt delete_pending_stmt_;
+
+    Logged_writer writer_;
+    summaries::Merger merger_;
+
+    std::unordered_set<std::int32_t> encounter_ids_;
+    std::vector<std::pair<std::string, std::int32_t>> new_encounter_types_;
+    std::shared_ptr<Stored_encounters> stored_ = std::make_shared<Stored_encounters>();
+  };
+}
@@ -1,6 +1,12 @@
+#pragma once
+
+#include <prescience_helper/compressed_log.hpp>
+
 #include <filesystem>
 #include <unordered_map>
 #include <optional>
+#include <vector>
+#include <cstdint>
 
 namespace prescience_helper {
   struct Log_finder {
@@ -11,6 +17,7 @@ namespace prescience_helper {
       std::uintmax_t old_total;
       std::uintmax_t new_total;
       std::optional<std::int32_t> last_patch;
+      compressed::Format format = compressed::Format::plain;
     };
 
     Log_finder(std::filesystem::path);
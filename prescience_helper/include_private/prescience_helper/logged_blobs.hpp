@@ -0,0 +1,52 @@
+#pragma once
+
+#include <prescience_helper/blob_codec.hpp>
+#include <prescience_helper/sim.hpp>
+#include <prescience_helper/sim/summary.hpp>
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+//the payloads stored in the Logged blob columns, before blob_codec wraps them
+namespace prescience_helper::logged {
+  void serialize(std::vector<Event<sim::Damage>> const& in, std::vector<std::byte>& returning);
+  void deserialize(std::span<const std::byte> in, std::vector<Event<sim::Damage>>& out);
+
+  //FORMAT_STATS_DELTA: per change, the zigzag varint of its when minus the previous change's (0 for the first),
+  //a u8 of the changed Combat_stat fields and then their doubles in Combat_stat order
+  void serialize(sim::Stats_timeline const& in, std::vector<std::byte>& returning);
+  //format is the blob's, stats were written FORMAT_FIXED_WIDTH as a when and every field per change before FORMAT_STATS_DELTA
+  void deserialize(std::uint8_t format, std::span<const std::byte> in, sim::Stats_timeline& out);
+
+  //deaths and rezzes
+  void serialize(std::vector<Event<void>> const& in, std::vector<std::byte>& returning);
+  void deserialize(std::span<const std::byte> in, std::vector<Event<void>>& out);
+
+  //FORMAT_SUMMARY, for the Summary table: newest_start_ms, the varint slice count, then per slice a u8 of its
+  //non zero fields and their doubles in Field order
+  void serialize(sim::summary::Summary const& in, std::vector<std::byte>& returning);
+  void deserialize(std::span<const std::byte> in, sim::summary::Summary& out);
+
+  //decodes a blob as stored in Logged, then deserializes its payload
+  template<typename T>
+  void deserialize_blob(std::span<const std::byte> in, std::vector<std::byte>& scratch, std::vector<T>& out) {
+    const auto decoded = blob_codec::decode(in, scratch);
+    if (decoded.format != blob_codec::FORMAT_FIXED_WIDTH && !decoded.payload.empty()) {
+      throw std::runtime_error{ "Unknown Logged blob format" };
+    }
+    deserialize(decoded.payload, out);
+  }
+  inline void deserialize_blob(std::span<const std::byte> in, std::vector<std::byte>& scratch, sim::Stats_timeline& out) {
+    const auto decoded = blob_codec::decode(in, scratch);
+    deserialize(decoded.format, decoded.payload, out);
+  }
+  inline void deserialize_blob(std::span<const std::byte> in, std::vector<std::byte>& scratch, sim::summary::Summary& out) {
+    const auto decoded = blob_codec::decode(in, scratch);
+    if (decoded.format != blob_codec::FORMAT_SUMMARY && !decoded.payload.empty()) {
+      throw std::runtime_error{ "Unknown Summary blob format" };
+    }
+    deserialize(decoded.payload, out);
+  }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <prescience_helper/sqlite3_wrapper.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace prescience_helper {
+  //batches Logged rows (and anything else executed between begin() and flush()) into as few
+  //transactions as the flush policy allows, and caches Player ids so we don't look them up per row
+  struct Logged_writer {
+  public:
+    struct Flush_policy {
+      std::size_t max_rows = 50000;
+      std::size_t max_encounters = 256;
+      std::chrono::milliseconds max_age{ 5000 };
+    };
+
+    struct Stats {
+      std::uint64_t rows = 0;
+      std::uint64_t encounters = 0;
+      std::uint64_t commits = 0;
+      //spent binding, stepping and committing, not the time transactions were open
+      std::chrono::steady_clock::duration active{ 0 };
+
+      double rows_per_second() const noexcept;
+    };
+
+    Logged_writer(Db const& db);
+    Logged_writer(Db const& db, Flush_policy policy);
+
+    Logged_writer(Logged_writer const&) = delete;
+    Logged_writer& operator=(Logged_writer const&) = delete;
+
+    //opens a transaction if we don't have one open already
+    void begin();
+
+    std::int64_t player_id(std::string_view blizz_guid);
+
+    //blobs are bound without copying, so they only have to live until this returns
+    void insert_logged(std::int64_t player, std::int32_t spec, std::int64_t encounter,
+      std::span<const std::byte> damage,
+      std::span<const std::byte> stats,
+      std::span<const std::byte> deaths,
+      std::span<const std::byte> rezzes);
+
+    //returns the amount of encounters committed if this caused a flush, 0 otherwise
+    std::size_t end_encounter();
+
+    //commits everything pending, returns the amount of encounters committed
+    std::size_t flush();
+
+    void rollback();
+
+    bool in_transaction() const noexcept {
+      return in_transaction_;
+    }
+
+    Stats const& stats() const noexcept {
+      return stats_;
+    }
+  private:
+    bool should_flush_() const noexcept;
+
+    struct String_hash {
+      using is_transparent = void;
+      std::size_t operator()(std::string_view in) const noexcept {
+        return std::hash<std::string_view>{}(in);
+      }
+      std::size_t operator()(std::string const& in) const noexcept {
+        return std::hash<std::string_view>{}(in);
+      }
+    };
+
+    Db const& db_;
+    Flush_policy policy_;
+
+    Stmt find_player_stmt_;
+    Stmt insert_player_stmt_;
+    Stmt insert_logged_stmt_;
+
+    std::unordered_map<std::string, std::int64_t, String_hash, std::equal_to<void>> player_ids_;
+    std::vector<std::string> uncommitted_players_;
+
+    bool in_transaction_ = false;
+    std::chrono::steady_clock::time_point transaction_start_;
+    std::size_t pending_rows_ = 0;
+    std::size_t pending_encounters_ = 0;
+
+    Stats stats_;
+  };
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <prescience_helper/sqlite3_wrapper.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace prescience_helper::migrations {
+  enum class Blob_column {
+    damage,
+    stats,
+    deaths,
+    rezzes,
+  };
+
+  constexpr std::array<std::string_view, 4> BLOB_COLUMN_NAMES{
+    "damage",
+    "stats",
+    "deaths",
+    "rezzes"
+  };
+
+  struct Migration {
+    std::int32_t from;
+    std::string_view description;
+    //ran once, in the same transaction we record that the migration started in
+    std::string_view schema;
+    //if set, every Logged blob is passed through this in batches. out starts empty
+    std::function<void(Blob_column column, std::span<const std::byte> in, std::vector<std::byte>& out)> reencode;
+    //if not empty, a condition on Logged for rows whose data is wrong and can only be fixed by simulating again.
+    //Only their encounters are put in Pending_resimulation, their rows stay until resimulate replaces them
+    std::string_view resimulate_where;
+  };
+
+  struct Progress {
+    Migration const* migration;
+    std::int32_t from;
+    std::int32_t to;
+    std::uint64_t done;
+    std::uint64_t total;
+  };
+
+  enum class Result {
+    success,
+    //the database is from a newer version than us
+    too_new,
+    //we have no way to get from the database's version to the one wanted
+    no_path,
+    //a migration's schema script failed, nothing it did was kept
+    failed,
+  };
+
+  //the version recorded in Configs. Databases created as version 2 didn't record it
+  std::optional<std::int32_t> version(Db const& db);
+
+  Result migrate(Db const& db, std::int32_t to, std::function<void(Progress const&)> const& progress);
+}
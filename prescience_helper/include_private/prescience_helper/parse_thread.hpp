@@ -0,0 +1,64 @@
+#pragma once
+
+#include <prescience_helper/ingest_pipeline.hpp>
+#include <prescience_helper/log_finder.hpp>
+#include <prescience_helper/memory.hpp>
+#include <prescience_helper/progress.hpp>
+#include <prescience_helper/sqlite3_wrapper.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace prescience_helper {
+  struct Thread_activity {
+    std::vector<std::pair<std::string, std::int32_t>> new_encounter_ids;
+    //the newest progress published since the last call, if any
+    std::optional<progress::Snapshot> progress;
+    //since the thread started, not reset by clear
+    memory::Log_usage memory_high_water;
+
+    void clear() {
+      new_encounter_ids.clear();
+      progress.reset();
+    }
+  };
+
+  //watches a log directory and stores anything new in it, one log at a time
+  struct Parse_thread {
+  public:
+    Parse_thread(std::filesystem::path base, Db db);
+
+    Db db_;
+    std::thread thread;
+
+    //only for the rarely changing parts of thread_activity_ and base, progress goes through progress_
+    std::mutex mutex_;
+    Log_finder log_finder;
+    std::atomic<bool> should_stop{ false };
+    Thread_activity thread_activity_;
+    std::filesystem::path base;
+
+    progress::Channel progress_;
+    progress::Reporter reporter_;
+
+    Encounter_store store_;
+    Log_preparer preparer_;
+
+    void change_finder_base(std::filesystem::path new_base);
+    void check_if_finder_base_should_change();
+
+    bool check_if_should_stop(std::uint32_t add_encounters_stored = 0);
+    void stop();
+
+    Thread_activity get_thread_activity();
+
+    static void run(Parse_thread* state);
+  };
+}
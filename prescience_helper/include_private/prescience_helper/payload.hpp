@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+//the binary payload inside the addon's input string, before ascii85. The addon picks the version
+//by the prefix of its output string ("2?..." or "3?..."), and we answer with the same version
+namespace prescience_helper::payload {
+  enum class Version {
+    //fixed 6 bytes per window
+    v2,
+    //varint/zigzag deltas per raider, optionally through a static prefix code
+    v3,
+  };
+
+  std::optional<Version> parse_version(std::string_view version) noexcept;
+  std::string_view version_prefix(Version version) noexcept;
+
+  //one window of one raider, already scaled how the addon shows it
+  struct Window {
+    //windows since the pull started
+    std::int64_t index;
+    //thousands of damage
+    std::uint16_t base;
+    //percent extra from each buff
+    std::uint8_t ebon_might;
+    std::uint8_t prescience;
+    std::uint8_t shifting_sands;
+
+    constexpr bool operator==(Window const&) const noexcept = default;
+  };
+
+  struct Raider {
+    std::uint16_t server_id;
+    std::uint32_t player_uid;
+    //ascending index
+    std::vector<Window> windows;
+
+    bool operator==(Raider const&) const noexcept = default;
+  };
+
+  struct Payload {
+    //in 100ms units
+    std::uint8_t window_size;
+    std::vector<Raider> raiders;
+
+    bool operator==(Payload const&) const noexcept = default;
+  };
+
+  //v2:
+  //  u8 window size, u8 raider count, then per raider u16 server id, u32 player uid, its windows and a 255.
+  //  each window is u8 (index delta - 1), u16 base, u8 ebon might, u8 prescience, u8 shifting sands
+  //v3:
+  //  u8 flags. If flags & FLAG_PREFIX_CODED, a varint byte count and then the body through the prefix code
+  //  (MSB first, zero padded to a byte), otherwise the body as is. The body is
+  //  u8 window size, u8 raider count, then per raider u16 server id, u32 player uid, varint window count,
+  //  and per window varint (index delta - 1) and the zigzag deltas of base, ebon might, prescience and shifting sands,
+  //  each from the raider's previous window (starting at 0)
+  //multibyte integers are little endian
+  constexpr std::uint8_t FLAG_PREFIX_CODED = 1;
+
+  void encode(Version version, Payload const& payload, std::vector<std::byte>& out);
+
+  //v3 only, false if in is malformed. Up to 3 trailing zero bytes (ascii85's padding) are ignored
+  bool decode_v3(std::span<const std::byte> in, Payload& out);
+
+  //the static prefix code's length for each byte value, shortest for the small values varints are mostly made of.
+  //codes are canonical: ordered by length, then byte value
+  std::span<const std::uint8_t, 256> prefix_code_lengths() noexcept;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+//ingest progress, published by the thread doing the work without ever waiting on whoever shows it
+namespace prescience_helper::progress {
+  enum class Stage : std::uint8_t {
+    idle,
+    finding_logs,
+    reading,
+    simulating,
+    storing,
+    committing,
+    COUNT
+  };
+
+  constexpr std::array<std::string_view, static_cast<std::size_t>(Stage::COUNT)> STAGE_NAMES{
+    "Idle",
+    "Finding logs",
+    "Reading",
+    "Simulating",
+    "Storing",
+    "Committing"
+  };
+
+  //totals since the producer started, so a reader that misses some snapshots only loses resolution
+  struct Snapshot {
+    Stage stage = Stage::idle;
+    //bytes of logs found that still needed reading when they were found
+    std::uint64_t backlog_bytes = 0;
+    std::uint64_t bytes_read = 0;
+    std::uint64_t lines_read = 0;
+    std::uint64_t encounters_found = 0;
+    std::uint64_t encounters_stored = 0;
+    //the log being read
+    std::uint64_t log_bytes_read = 0;
+    std::uint64_t log_bytes_total = 0;
+    double rows_per_second = 0;
+  };
+
+  //single producer single consumer, neither side ever blocks. Pushing to a full ring drops the value
+  template<typename T, std::size_t N>
+  struct Ring {
+  public:
+    static_assert(N != 0 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+    bool try_push(T const& value) noexcept {
+      const auto tail = tail_.load(std::memory_order_relaxed);
+      if (tail - head_.load(std::memory_order_acquire) == N) {
+        return false;
+      }
+      items_[tail & (N - 1)] = value;
+      tail_.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+
+    std::optional<T> pop() noexcept {
+      const auto head = head_.load(std::memory_order_relaxed);
+      if (head == tail_.load(std::memory_order_acquire)) {
+        return std::nullopt;
+      }
+      T returning = items_[head & (N - 1)];
+      head_.store(head + 1, std::memory_order_release);
+      return returning;
+    }
+  private:
+    std::array<T, N> items_{};
+    //on their own cache lines, so the two threads don't fight over them
+    alignas(64) std::atomic<std::size_t> head_{ 0 };
+    alignas(64) std::atomic<std::size_t> tail_{ 0 };
+  };
+
+  using Channel = Ring<Snapshot, 256>;
+
+  //everything published since the last drain, only the newest matters
+  std::optional<Snapshot> drain(Channel& channel) noexcept;
+
+  //the producer's side, publishes a Snapshot on every change. If the channel was full the next call publishes
+  //again even if nothing changed, so a producer that goes idle still gets its last state out
+  struct Reporter {
+  public:
+    Reporter(Channel& channel) :
+      channel_(channel) {
+
+    }
+
+    Reporter(Reporter const&) = delete;
+    Reporter& operator=(Reporter const&) = delete;
+
+    void stage(Stage stage) noexcept;
+    void add_backlog(std::uint64_t bytes) noexcept;
+    void start_log(std::uint64_t bytes_total) noexcept;
+    void add_read(std::uint64_t bytes, std::uint64_t lines) noexcept;
+    void add_found(std::uint64_t encounters) noexcept;
+    void add_stored(std::uint64_t encounters, double rows_per_second) noexcept;
+
+    Snapshot const& current() const noexcept {
+      return current_;
+    }
+  private:
+    void publish_() noexcept {
+      pending_ = !channel_.try_push(current_);
+    }
+
+    Channel& channel_;
+    Snapshot current_;
+    bool pending_ = false;
+  };
+
+  //the consumer's side, works out rates between updates
+  struct Meter {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    void update(Snapshot const& latest, Clock::time_point now) noexcept;
+
+    Snapshot const& latest() const noexcept {
+      return latest_;
+    }
+
+    double bytes_per_second() const noexcept {
+      return bytes_per_second_;
+    }
+
+    double lines_per_second() const noexcept {
+      return lines_per_second_;
+    }
+
+    //until the backlog is read at the current rate, nullopt until there is a rate
+    std::optional<std::chrono::seconds> eta() const noexcept;
+  private:
+    Snapshot latest_;
+    std::optional<Clock::time_point> at_;
+    double bytes_per_second_ = 0;
+    double lines_per_second_ = 0;
+  };
+
+  //rates, counts and ETA on one line, without the stage
+  std::string describe(Meter const& meter);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <span>
 #include <vector>
 #include <cstddef>
@@ -7,7 +8,8 @@
 #include <cstdint>
 #include <limits>
 #include <bit>
-#include <sstream>
+#include <string>
+#include <string_view>
 
 static_assert(std::numeric_limits<double>::is_iec559);
 static_assert(std::numeric_limits<float>::is_iec559);
@@ -35,6 +37,20 @@ namespace prescience_helper::serialize {
       this->write(clamped);
     }
 
+    //LEB128, 7 bits per byte with the high bit set on all but the last
+    void write_varint(std::uint64_t val) {
+      while (val >= 0x80) {
+        underlying_.push_back(static_cast<std::byte>((val & 0x7F) | 0x80));
+        val >>= 7;
+      }
+      underlying_.push_back(static_cast<std::byte>(val));
+    }
+
+    //small magnitudes of either sign stay short: 0, -1, 1, -2... become 0, 1, 2, 3...
+    void write_zigzag(std::int64_t val) {
+      write_varint((static_cast<std::uint64_t>(val) << 1) ^ static_cast<std::uint64_t>(val >> 63));
+    }
+
     template<typename First, typename ...Rest>
     void write(First first, Rest... rest) {
       write(first);
@@ -86,6 +102,11 @@ namespace prescience_helper::serialize {
       return underlying_.empty();
     }
 
+    //bytes left to read
+    constexpr std::size_t size() const {
+      return underlying_.size();
+    }
+
     template<typename T>
     constexpr T read() {
       assert(underlying_.size() >= sizeof(T));
@@ -93,6 +114,24 @@ namespace prescience_helper::serialize {
       underlying_ = underlying_.subspan(sizeof(T));
       return returning;
     }
+
+    constexpr std::uint64_t read_varint() {
+      std::uint64_t returning = 0;
+      for (std::size_t shift = 0;; shift += 7) {
+        assert(!underlying_.empty() && shift < 64);
+        const auto byte = static_cast<std::uint64_t>(underlying_.front());
+        underlying_ = underlying_.subspan(1);
+        returning |= (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+          return returning;
+        }
+      }
+    }
+
+    constexpr std::int64_t read_zigzag() {
+      const auto raw = read_varint();
+      return static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+    }
   private:
     template<typename T>
     constexpr T read_impl_() {
@@ -121,5 +160,18 @@ namespace prescience_helper::serialize {
     std::span<const std::byte> underlying_;
   };
 
-  void to_ascii_85(std::stringstream& out, std::span<const std::byte> in);
+  //the addon's ascii85: each little endian quad is 5 digits, least significant first and offset by 32,
+  //or z if the quad is 0. A partial last quad is zero padded
+  constexpr std::size_t ascii_85_max_size(std::size_t bytes) noexcept {
+    return (bytes + 3) / 4 * 5;
+  }
+
+  //out must hold at least ascii_85_max_size(in.size()) chars, returns how many were written
+  std::size_t to_ascii_85(std::span<char> out, std::span<const std::byte> in) noexcept;
+  //appends to out
+  void to_ascii_85(std::string& out, std::span<const std::byte> in);
+
+  //appends whole quads to out, so padding the encoder added comes back as zeroes.
+  //false if in isn't valid, what was appended is then unspecified
+  bool from_ascii_85(std::string_view in, std::vector<std::byte>& out);
 }
\ No newline at end of file
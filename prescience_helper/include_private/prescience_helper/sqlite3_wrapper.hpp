@@ -1,5 +1,13 @@
+#pragma once
+
 #include <sqlite3.h>
 
+#include <prescience_helper/trace.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <functional>
 #include <memory>
 #include <string_view>
 #include <unordered_map>
@@ -8,8 +16,14 @@
 #include <vector>
 #include <thread>
 #include <cstddef>
+#include <string>
 
 namespace prescience_helper {
+
+  //a blob bound without sqlite taking a copy, it must outlive the exec it's bound for
+  struct Static_blob {
+    std::span<const std::byte> data;
+  };
   
   namespace internal {
     void bind_val(sqlite3_stmt* stmt, int i, std::string_view val);
@@ -20,6 +34,8 @@ namespace prescience_helper {
 
     void bind_val(sqlite3_stmt* stmt, int i, std::span<const std::byte> val);
 
+    void bind_val(sqlite3_stmt* stmt, int i, Static_blob val);
+
     template<typename T>
     void bind_val(sqlite3_stmt* stmt, int i, std::optional<T> val) {
       if (val) {
@@ -73,6 +89,7 @@ namespace prescience_helper {
 
     template<typename ...Out, typename ...In, typename Func>
     void execEx(sqlite3* db, Func&& cb, In&&... in) const requires std::is_invocable_v<Func, Out...> {
+      PRESCIENCE_HELPER_TRACE_SPAN_DETAIL("sql", sqlite3_sql(stmt_.get()));
       sqlite3_reset(stmt_.get());
       internal::bind_loop(stmt_.get(), 1, std::forward<In>(in)...);
       int v;
@@ -117,6 +134,8 @@ namespace prescience_helper {
     void rollback() const noexcept;
     void commit() const noexcept;
     std::int64_t last_insert_rowid() const noexcept;
+    //runs every statement in script, false if any of them failed
+    bool exec_script(std::string_view script) const noexcept;
     template<typename ...Out, typename ...In, typename Func>
     void exec(std::string_view query, Func&& cb, In&&... in) const requires std::is_invocable_v<Func, Out...> {
       Stmt created = prepare(query);
@@ -125,6 +144,9 @@ namespace prescience_helper {
     }
 
     Stmt prepare(std::string_view query) const;
+
+    //the detail column of EXPLAIN QUERY PLAN for query, in order
+    std::vector<std::string> query_plan(std::string_view query) const;
   private:
     struct Sqlite3_closer_ {
     void operator()(sqlite3 * db);
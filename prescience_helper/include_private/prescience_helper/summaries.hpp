@@ -0,0 +1,66 @@
+#pragma once
+
+#include <prescience_helper/blob_codec.hpp>
+#include <prescience_helper/sim/summary.hpp>
+#include <prescience_helper/sqlite3_wrapper.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+//the Summary table, every pull of a (player, spec, encounter type, difficulty) merged into one sim::summary::Summary.
+//generation reads one row per raider instead of their pulls, so how many pulls count costs nothing there
+namespace prescience_helper::summaries {
+  //how many days old a pull has to be for it to count half as much as the newest. 0 counts every pull the same
+  constexpr std::string_view HALF_LIFE_CONFIG = "summary_half_life_days";
+  constexpr std::int64_t DEFAULT_HALF_LIFE_DAYS = 14;
+  constexpr std::string_view CODEC_CONFIG = "summary_codec";
+  //the half life Summary was last built with, when it differs from HALF_LIFE_CONFIG the table is rebuilt
+  constexpr std::string_view BUILT_HALF_LIFE_CONFIG = "summary_built_half_life";
+
+  struct Key {
+    std::int64_t player;
+    std::int32_t spec;
+    std::int32_t type;
+    std::int32_t difficulty;
+
+    constexpr bool operator==(Key const&) const noexcept = default;
+  };
+
+  struct Merger {
+  public:
+    Merger(Db const& db);
+
+    Merger(Merger const&) = delete;
+    Merger& operator=(Merger const&) = delete;
+
+    //merges one pull into its key's row, in whatever transaction is open
+    void add(Key const& key, sim::summary::Summary const& pull);
+
+    //replaces the key's row
+    void put(Key const& key, sim::summary::Summary const& summary);
+
+    std::chrono::milliseconds half_life() const noexcept {
+      return half_life_;
+    }
+  private:
+    Stmt get_stmt_;
+    Stmt put_stmt_;
+
+    std::chrono::milliseconds half_life_;
+    blob_codec::Codec codec_ = blob_codec::Codec::raw;
+
+    sim::summary::Summary merging_;
+    std::vector<std::byte> scratch_;
+    std::vector<std::byte> serialized_;
+    std::vector<std::byte> encoded_;
+  };
+
+  //summarizes every Logged row again and merges them into a new Summary table
+  void rebuild(Db const& db);
+
+  //rebuilds if Summary was built with another half life, or never. Expects a prepared db
+  void ensure_current(Db const& db);
+}
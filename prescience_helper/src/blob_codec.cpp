@@ -0,0 +1,196 @@
+#include <prescience_helper/blob_codec.hpp>
+#include <prescience_helper/serialize.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef PRESCIENCE_HELPER_HAS_LZ4
+#include <lz4.h>
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace blob_codec = prescience_helper::blob_codec;
+
+namespace {
+  constexpr int ZSTD_LEVEL = 3;
+
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+  struct Zstd_contexts {
+    ZSTD_CCtx* compress = ZSTD_createCCtx();
+    ZSTD_DCtx* decompress = ZSTD_createDCtx();
+
+    ~Zstd_contexts() {
+      ZSTD_freeCCtx(compress);
+      ZSTD_freeDCtx(decompress);
+    }
+  };
+
+  Zstd_contexts& zstd_contexts() {
+    thread_local Zstd_contexts returning;
+    return returning;
+  }
+#endif
+
+  void write_header(std::vector<std::byte>& out, blob_codec::Codec codec, std::uint8_t format) {
+    prescience_helper::serialize::Write_buffer header{ out };
+    header.write(static_cast<std::uint8_t>(codec), format);
+  }
+
+  //returns the size of the compressed data written into into
+  std::size_t compress(blob_codec::Codec codec, std::span<const std::byte> payload, std::span<std::byte> into) {
+    switch (codec) {
+#ifdef PRESCIENCE_HELPER_HAS_LZ4
+    case blob_codec::Codec::lz4:
+    {
+      const int written = LZ4_compress_default(
+        reinterpret_cast<const char*>(payload.data()), reinterpret_cast<char*>(into.data()),
+        static_cast<int>(payload.size()), static_cast<int>(into.size()));
+      if (written <= 0) {
+        throw std::runtime_error{ "Couldn't lz4 compress blob" };
+      }
+      return static_cast<std::size_t>(written);
+    }
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+    case blob_codec::Codec::zstd:
+    {
+      const std::size_t written = ZSTD_compressCCtx(zstd_contexts().compress,
+        into.data(), into.size(), payload.data(), payload.size(), ZSTD_LEVEL);
+      if (ZSTD_isError(written)) {
+        throw std::runtime_error{ "Couldn't zstd compress blob" };
+      }
+      return written;
+    }
+#endif
+    default:
+      throw std::runtime_error{ "Unsupported blob codec" };
+    }
+  }
+
+  std::size_t compress_bound(blob_codec::Codec codec, std::size_t size) {
+    switch (codec) {
+#ifdef PRESCIENCE_HELPER_HAS_LZ4
+    case blob_codec::Codec::lz4: return static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(size)));
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+    case blob_codec::Codec::zstd: return ZSTD_compressBound(size);
+#endif
+    default: return size;
+    }
+  }
+
+  void decompress(blob_codec::Codec codec, std::span<const std::byte> compressed, std::span<std::byte> into) {
+    switch (codec) {
+#ifdef PRESCIENCE_HELPER_HAS_LZ4
+    case blob_codec::Codec::lz4:
+    {
+      const int read = LZ4_decompress_safe(
+        reinterpret_cast<const char*>(compressed.data()), reinterpret_cast<char*>(into.data()),
+        static_cast<int>(compressed.size()), static_cast<int>(into.size()));
+      if (read < 0 || static_cast<std::size_t>(read) != into.size()) {
+        throw std::runtime_error{ "Corrupt lz4 blob" };
+      }
+      return;
+    }
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+    case blob_codec::Codec::zstd:
+    {
+      const std::size_t read = ZSTD_decompressDCtx(zstd_contexts().decompress,
+        into.data(), into.size(), compressed.data(), compressed.size());
+      if (ZSTD_isError(read) || read != into.size()) {
+        throw std::runtime_error{ "Corrupt zstd blob" };
+      }
+      return;
+    }
+#endif
+    default:
+      throw std::runtime_error{ "Blob uses a codec this build doesn't support" };
+    }
+  }
+}
+
+bool blob_codec::available(Codec codec) noexcept {
+  switch (codec) {
+  case Codec::raw: return true;
+#ifdef PRESCIENCE_HELPER_HAS_LZ4
+  case Codec::lz4: return true;
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+  case Codec::zstd: return true;
+#endif
+  default: return false;
+  }
+}
+
+std::optional<blob_codec::Codec> blob_codec::from_name(std::string_view name) noexcept {
+  const auto found = std::find(CODEC_NAMES.begin(), CODEC_NAMES.end(), name);
+  if (found == CODEC_NAMES.end()) {
+    return std::nullopt;
+  }
+  return static_cast<Codec>(std::distance(CODEC_NAMES.begin(), found));
+}
+
+void blob_codec::encode(Codec codec, std::uint8_t format, std::span<const std::byte> payload, std::vector<std::byte>& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("blob_codec::encode");
+  out.clear();
+
+  //not worth a header for compression on nothing
+  if (!available(codec) || payload.empty()) {
+    codec = Codec::raw;
+  }
+
+  if (codec == Codec::raw) {
+    out.reserve(HEADER_SIZE + payload.size());
+    write_header(out, codec, format);
+    out.insert(out.end(), payload.begin(), payload.end());
+    return;
+  }
+
+  write_header(out, codec, format);
+  prescience_helper::serialize::Write_buffer{ out }.write(static_cast<std::uint32_t>(payload.size()));
+
+  out.resize(COMPRESSED_HEADER_SIZE + compress_bound(codec, payload.size()));
+  const std::size_t written = compress(codec, payload, std::span{ out }.subspan(COMPRESSED_HEADER_SIZE));
+
+  //incompressible, don't pay for decompression
+  if (written >= payload.size()) {
+    encode(Codec::raw, format, payload, out);
+    return;
+  }
+
+  out.resize(COMPRESSED_HEADER_SIZE + written);
+}
+
+blob_codec::Decoded blob_codec::decode(std::span<const std::byte> in, std::vector<std::byte>& scratch) {
+  PRESCIENCE_HELPER_TRACE_SPAN("blob_codec::decode");
+  if (in.empty()) {
+    return Decoded{ Codec::raw, FORMAT_EMPTY, in };
+  }
+  if (in.size() < HEADER_SIZE) {
+    throw std::runtime_error{ "Blob is missing its header" };
+  }
+
+  prescience_helper::serialize::Read_buffer header{ in };
+  Decoded returning;
+  returning.codec = static_cast<Codec>(header.read<std::uint8_t>());
+  returning.format = header.read<std::uint8_t>();
+
+  if (returning.codec == Codec::raw) {
+    returning.payload = in.subspan(HEADER_SIZE);
+    return returning;
+  }
+
+  if (in.size() < COMPRESSED_HEADER_SIZE) {
+    throw std::runtime_error{ "Blob is missing its header" };
+  }
+  const auto uncompressed_size = header.read<std::uint32_t>();
+
+  scratch.resize(uncompressed_size);
+  decompress(returning.codec, in.subspan(COMPRESSED_HEADER_SIZE), scratch);
+  returning.payload = scratch;
+  return returning;
+}
@@ -0,0 +1,561 @@
+#include <prescience_helper/compressed_log.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#ifdef PRESCIENCE_HELPER_HAS_ZLIB
+#include <zlib.h>
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace compressed = prescience_helper::compressed;
+
+namespace {
+  //how much of the archive is read at once
+  constexpr std::size_t INPUT_SIZE = 1024 * 1024; //1mb
+
+  //the archive itself, counting what's read of it
+  struct Input {
+  public:
+    Input(std::filesystem::path const& path, std::atomic<std::uint64_t>& counted) :
+      file_(path, std::ios::binary | std::ios::in),
+      counted_(counted) {
+
+      if (!file_.is_open()) {
+        throw std::runtime_error("Can't open " + path.string());
+      }
+      buffer_.resize(INPUT_SIZE);
+    }
+
+    //the next at most limit bytes, empty at the end of the file
+    std::string_view read(std::uint64_t limit) {
+      file_.read(buffer_.data(), static_cast<std::streamsize>(std::min<std::uint64_t>(buffer_.size(), limit)));
+      const auto read = static_cast<std::size_t>(file_.gcount());
+      counted_.fetch_add(read, std::memory_order_relaxed);
+      return { buffer_.data(), read };
+    }
+
+    void read_exact(char* out, std::size_t size) {
+      file_.read(out, static_cast<std::streamsize>(size));
+      if (static_cast<std::size_t>(file_.gcount()) != size) {
+        throw std::runtime_error("Archive is cut short");
+      }
+    }
+
+    void seek(std::uint64_t offset) {
+      file_.clear();
+      file_.seekg(static_cast<std::streamoff>(offset));
+    }
+
+    std::uint64_t size() {
+      file_.clear();
+      file_.seekg(0, std::ios::end);
+      return static_cast<std::uint64_t>(file_.tellg());
+    }
+  private:
+    std::ifstream file_;
+    std::vector<char> buffer_;
+    std::atomic<std::uint64_t>& counted_;
+  };
+
+  //what an archive decompresses to
+  struct Source {
+  public:
+    virtual ~Source() = default;
+
+    //fills as much of out as it can in one go, 0 once there's nothing left
+    virtual std::size_t read(char* out, std::size_t size) = 0;
+  };
+
+#ifdef PRESCIENCE_HELPER_HAS_ZLIB
+  struct Inflater {
+  public:
+    //window_bits as inflateInit2 takes them, 15 + 32 for gzip (or zlib) headers, -15 for raw deflate
+    Inflater(int window_bits) {
+      if (inflateInit2(&stream, window_bits) != Z_OK) {
+        throw std::runtime_error("Can't start inflating");
+      }
+    }
+
+    ~Inflater() {
+      inflateEnd(&stream);
+    }
+
+    Inflater(Inflater const&) = delete;
+    Inflater& operator=(Inflater const&) = delete;
+
+    //inflates from what's in stream into out, true at the end of a deflate stream
+    bool inflate_into(char* out, std::size_t size, std::size_t& produced) {
+      stream.next_out = reinterpret_cast<Bytef*>(out);
+      stream.avail_out = static_cast<uInt>(std::min<std::size_t>(size, std::numeric_limits<uInt>::max()));
+      const auto before = stream.avail_out;
+      const int result = inflate(&stream, Z_NO_FLUSH);
+      produced = before - stream.avail_out;
+      if (result == Z_STREAM_END) {
+        return true;
+      }
+      if (result != Z_OK && result != Z_BUF_ERROR) {
+        throw std::runtime_error(std::string{ "Can't inflate log: " } + (stream.msg != nullptr ? stream.msg : "unknown error"));
+      }
+      return false;
+    }
+
+    void give(std::string_view in) {
+      stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+      stream.avail_in = static_cast<uInt>(in.size());
+    }
+
+    z_stream stream{};
+  };
+
+  //gzip members one after the other, like gzip -d does
+  struct Gzip_source final : public Source {
+  public:
+    Gzip_source(std::filesystem::path const& path, std::atomic<std::uint64_t>& counted) :
+      input_(path, counted),
+      inflater_(15 + 32) {
+
+    }
+
+    std::size_t read(char* out, std::size_t size) override final {
+      std::size_t returning = 0;
+      while (returning < size) {
+        if (inflater_.stream.avail_in == 0) {
+          const auto in = input_.read(INPUT_SIZE);
+          if (in.empty()) {
+            if (in_member_) {
+              throw std::runtime_error("gzip log is cut short");
+            }
+            break;
+          }
+          inflater_.give(in);
+        }
+
+        in_member_ = true;
+        std::size_t produced = 0;
+        const bool ended = inflater_.inflate_into(out + returning, size - returning, produced);
+        returning += produced;
+        if (ended) {
+          inflateReset(&inflater_.stream);
+          in_member_ = false;
+        }
+      }
+      return returning;
+    }
+  private:
+    Input input_;
+    Inflater inflater_;
+    bool in_member_ = false;
+  };
+
+  std::uint16_t le16(const char* data) {
+    const auto bytes = reinterpret_cast<const unsigned char*>(data);
+    return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8));
+  }
+
+  std::uint32_t le32(const char* data) {
+    return le16(data) | (static_cast<std::uint32_t>(le16(data + 2)) << 16);
+  }
+
+  //every file in the archive, in central directory order. Stored and deflated members, no zip64
+  struct Zip_source final : public Source {
+  public:
+    Zip_source(std::filesystem::path const& path, std::atomic<std::uint64_t>& counted) :
+      input_(path, counted) {
+
+      read_central_directory_();
+    }
+
+    std::size_t read(char* out, std::size_t size) override final {
+      std::size_t returning = 0;
+      while (returning < size) {
+        if (!member_open_) {
+          if (next_member_ == members_.size()) {
+            break;
+          }
+          open_member_(members_[next_member_++]);
+        }
+
+        if (inflater_ == nullptr) {
+          const auto in = input_.read(std::min<std::uint64_t>(remaining_, size - returning));
+          if (in.empty()) {
+            throw std::runtime_error("zip member is cut short");
+          }
+          std::memcpy(out + returning, in.data(), in.size());
+          returning += in.size();
+          remaining_ -= in.size();
+          member_open_ = remaining_ != 0;
+          continue;
+        }
+
+        if (inflater_->stream.avail_in == 0) {
+          const auto in = input_.read(remaining_);
+          if (in.empty()) {
+            throw std::runtime_error("zip member is cut short");
+          }
+          remaining_ -= in.size();
+          inflater_->give(in);
+        }
+
+        std::size_t produced = 0;
+        const bool ended = inflater_->inflate_into(out + returning, size - returning, produced);
+        returning += produced;
+        if (ended) {
+          member_open_ = false;
+        }
+      }
+      return returning;
+    }
+  private:
+    static constexpr std::uint32_t END_SIGNATURE = 0x06054b50;
+    static constexpr std::uint32_t CENTRAL_SIGNATURE = 0x02014b50;
+    static constexpr std::uint32_t LOCAL_SIGNATURE = 0x04034b50;
+    static constexpr std::size_t END_SIZE = 22;
+    static constexpr std::size_t CENTRAL_SIZE = 46;
+    static constexpr std::size_t LOCAL_SIZE = 30;
+    static constexpr std::uint16_t STORED = 0;
+    static constexpr std::uint16_t DEFLATED = 8;
+
+    struct Member {
+      std::uint16_t method;
+      std::uint64_t compressed_size;
+      std::uint64_t local_header;
+    };
+
+    void read_central_directory_() {
+      //the end of central directory record is last, followed by a comment of at most 65535 bytes
+      const auto file_size = input_.size();
+      const auto tail_size = static_cast<std::size_t>(std::min<std::uint64_t>(file_size, END_SIZE + 0xFFFF));
+      std::vector<char> tail(tail_size);
+      input_.seek(file_size - tail_size);
+      input_.read_exact(tail.data(), tail.size());
+
+      std::optional<std::size_t> end;
+      for (std::size_t i = tail_size >= END_SIZE ? tail_size - END_SIZE + 1 : 0; i-- > 0;) {
+        if (le32(tail.data() + i) == END_SIGNATURE) {
+          end = i;
+          break;
+        }
+      }
+      if (!end) {
+        throw std::runtime_error("Not a zip archive");
+      }
+
+      const auto count = le16(tail.data() + *end + 10);
+      const auto directory_size = le32(tail.data() + *end + 12);
+      const auto directory_offset = le32(tail.data() + *end + 16);
+      if (count == 0xFFFF || directory_size == 0xFFFFFFFF || directory_offset == 0xFFFFFFFF) {
+        throw std::runtime_error("zip64 archives aren't supported");
+      }
+
+      std::vector<char> directory(directory_size);
+      input_.seek(directory_offset);
+      input_.read_exact(directory.data(), directory.size());
+
+      std::size_t at = 0;
+      for (std::uint16_t i = 0; i < count; ++i) {
+        if (at + CENTRAL_SIZE > directory.size() || le32(directory.data() + at) != CENTRAL_SIGNATURE) {
+          throw std::runtime_error("zip central directory is corrupt");
+        }
+        const char* entry = directory.data() + at;
+        const auto method = le16(entry + 10);
+        const auto compressed_size = le32(entry + 20);
+        const auto name_length = le16(entry + 28);
+        const auto extra_length = le16(entry + 30);
+        const auto comment_length = le16(entry + 32);
+        const auto local_header = le32(entry + 42);
+        if (compressed_size == 0xFFFFFFFF || le32(entry + 24) == 0xFFFFFFFF || local_header == 0xFFFFFFFF) {
+          throw std::runtime_error("zip64 archives aren't supported");
+        }
+
+        const std::string_view name{ entry + CENTRAL_SIZE, std::min<std::size_t>(name_length, directory.size() - at - CENTRAL_SIZE) };
+        at += CENTRAL_SIZE + name_length + extra_length + comment_length;
+
+        if (name.ends_with('/')) {
+          continue; //directory
+        }
+        if (method != STORED && method != DEFLATED) {
+          throw std::runtime_error("zip member " + std::string{ name } + " uses a compression method that isn't supported");
+        }
+        members_.push_back(Member{ method, compressed_size, local_header });
+      }
+    }
+
+    void open_member_(Member const& member) {
+      char header[LOCAL_SIZE];
+      input_.seek(member.local_header);
+      input_.read_exact(header, LOCAL_SIZE);
+      if (le32(header) != LOCAL_SIGNATURE) {
+        throw std::runtime_error("zip local header is corrupt");
+      }
+      input_.seek(member.local_header + LOCAL_SIZE + le16(header + 26) + le16(header + 28));
+
+      remaining_ = member.compressed_size;
+      if (member.method == DEFLATED) {
+        inflater_ = std::make_unique<Inflater>(-15);
+      } else {
+        inflater_.reset();
+      }
+      member_open_ = remaining_ != 0 || inflater_ != nullptr;
+    }
+
+    Input input_;
+    std::vector<Member> members_;
+    std::size_t next_member_ = 0;
+    bool member_open_ = false;
+    //of the open member's compressed bytes
+    std::uint64_t remaining_ = 0;
+    //nullptr for stored members
+    std::unique_ptr<Inflater> inflater_;
+  };
+#endif
+
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+  //zstd frames one after the other
+  struct Zstd_source final : public Source {
+  public:
+    Zstd_source(std::filesystem::path const& path, std::atomic<std::uint64_t>& counted) :
+      input_(path, counted),
+      stream_(ZSTD_createDStream()) {
+
+      if (stream_ == nullptr) {
+        throw std::runtime_error("Can't create zstd stream");
+      }
+    }
+
+    ~Zstd_source() {
+      ZSTD_freeDStream(stream_);
+    }
+
+    Zstd_source(Zstd_source const&) = delete;
+    Zstd_source& operator=(Zstd_source const&) = delete;
+
+    std::size_t read(char* out, std::size_t size) override final {
+      ZSTD_outBuffer output{ out, size, 0 };
+      while (output.pos < output.size) {
+        if (in_.pos == in_.size) {
+          const auto read = input_.read(INPUT_SIZE);
+          if (read.empty()) {
+            if (in_frame_) {
+              throw std::runtime_error("zstd log is cut short");
+            }
+            break;
+          }
+          in_ = ZSTD_inBuffer{ read.data(), read.size(), 0 };
+        }
+
+        const auto result = ZSTD_decompressStream(stream_, &output, &in_);
+        if (ZSTD_isError(result)) {
+          throw std::runtime_error(std::string{ "Can't decompress zstd log: " } + ZSTD_getErrorName(result));
+        }
+        in_frame_ = result != 0;
+      }
+      return output.pos;
+    }
+  private:
+    Input input_;
+    ZSTD_DStream* stream_;
+    ZSTD_inBuffer in_{ nullptr, 0, 0 };
+    bool in_frame_ = false;
+  };
+#endif
+
+  std::unique_ptr<Source> make_source(std::filesystem::path const& path, compressed::Format format, std::atomic<std::uint64_t>& counted) {
+    switch (format) {
+#ifdef PRESCIENCE_HELPER_HAS_ZLIB
+    case compressed::Format::gzip:
+      return std::make_unique<Gzip_source>(path, counted);
+    case compressed::Format::zip:
+      return std::make_unique<Zip_source>(path, counted);
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+    case compressed::Format::zstd:
+      return std::make_unique<Zstd_source>(path, counted);
+#endif
+    default:
+      throw std::runtime_error("Can't read " + path.string() + ", this build can't decompress it");
+    }
+  }
+
+  bool extension_is(std::filesystem::path const& path, std::string_view extension) {
+    const auto has = path.extension().string();
+    return std::equal(has.begin(), has.end(), extension.begin(), extension.end(), [](char c1, char c2) {
+      return std::tolower(static_cast<unsigned char>(c1)) == c2;
+      });
+  }
+}
+
+compressed::Format compressed::format_of(std::filesystem::path const& path) noexcept {
+  if (extension_is(path, ".gz")) {
+    return Format::gzip;
+  }
+  if (extension_is(path, ".zst")) {
+    return Format::zstd;
+  }
+  if (extension_is(path, ".zip")) {
+    return Format::zip;
+  }
+  return Format::plain;
+}
+
+bool compressed::is_supported(Format format) noexcept {
+  switch (format) {
+  case Format::plain:
+    return true;
+#ifdef PRESCIENCE_HELPER_HAS_ZLIB
+  case Format::gzip:
+  case Format::zip:
+    return true;
+#endif
+#ifdef PRESCIENCE_HELPER_HAS_ZSTD
+  case Format::zstd:
+    return true;
+#endif
+  default:
+    return false;
+  }
+}
+
+compressed::Decompressing_file::Decompressing_file(std::size_t buffer_size) :
+  buffer_size_(std::max<std::size_t>(2, buffer_size)) {
+
+}
+
+compressed::Decompressing_file::~Decompressing_file() {
+  stop_();
+}
+
+void compressed::Decompressing_file::open(std::filesystem::path path, Format format, std::uintmax_t offset) {
+  stop_();
+  if (format == Format::plain || !is_supported(format)) {
+    throw std::runtime_error("Can't read " + path.string() + ", this build can't decompress it");
+  }
+
+  for (auto& buffer : buffers_) {
+    //allocated on first use, most logs aren't compressed
+    buffer.data.resize(buffer_size_ / 2);
+    buffer.size = 0;
+    buffer.full = false;
+  }
+  reading_ = 0;
+  holding_ = false;
+  done_ = false;
+  stopping_ = false;
+  error_ = nullptr;
+  compressed_read_.store(0, std::memory_order_relaxed);
+
+  thread_ = std::thread{ [this, path = std::move(path), format, offset]() {
+    decompress_(path, format, offset);
+    } };
+}
+
+std::string_view compressed::Decompressing_file::next() {
+  std::unique_lock lock{ mutex_ };
+  if (!thread_.joinable()) {
+    return {};
+  }
+
+  if (holding_) {
+    buffers_[reading_ ^ 1].full = false;
+    holding_ = false;
+    changed_.notify_all();
+  }
+
+  auto& buffer = buffers_[reading_];
+  changed_.wait(lock, [this, &buffer]() {
+    return buffer.full || done_;
+    });
+
+  if (!buffer.full) {
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+    return {};
+  }
+
+  holding_ = true;
+  reading_ ^= 1;
+  return { buffer.data.data(), buffer.size };
+}
+
+void compressed::Decompressing_file::stop_() noexcept {
+  if (!thread_.joinable()) {
+    return;
+  }
+  {
+    std::lock_guard lock{ mutex_ };
+    stopping_ = true;
+  }
+  changed_.notify_all();
+  thread_.join();
+}
+
+void compressed::Decompressing_file::decompress_(std::filesystem::path path, Format format, std::uintmax_t offset) {
+  const auto should_stop = [this]() {
+    std::lock_guard lock{ mutex_ };
+    return stopping_;
+  };
+
+  try {
+    auto source = make_source(path, format, compressed_read_);
+
+    //nobody reads the first buffer until it's full, so it's scratch space until then
+    while (offset != 0 && !should_stop()) {
+      const auto skipped = source->read(buffers_[0].data.data(), static_cast<std::size_t>(std::min<std::uintmax_t>(offset, buffers_[0].data.size())));
+      if (skipped == 0) {
+        break;
+      }
+      offset -= skipped;
+    }
+
+    for (std::size_t filling = 0;; filling ^= 1) {
+      auto& buffer = buffers_[filling];
+      {
+        std::unique_lock lock{ mutex_ };
+        changed_.wait(lock, [this, &buffer]() {
+          return stopping_ || !buffer.full;
+          });
+        if (stopping_) {
+          return;
+        }
+      }
+
+      //the buffer isn't full, so next leaves it alone until we say it is
+      std::size_t size = 0;
+      while (size < buffer.data.size()) {
+        const auto read = source->read(buffer.data.data() + size, buffer.data.size() - size);
+        if (read == 0) {
+          break;
+        }
+        size += read;
+      }
+
+      std::lock_guard lock{ mutex_ };
+      if (size != 0) {
+        buffer.size = size;
+        buffer.full = true;
+      }
+      if (size < buffer.data.size()) {
+        done_ = true;
+      }
+      changed_.notify_all();
+      if (done_) {
+        return;
+      }
+    }
+  } catch (...) {
+    std::lock_guard lock{ mutex_ };
+    error_ = std::current_exception();
+    done_ = true;
+    changed_.notify_all();
+  }
+}
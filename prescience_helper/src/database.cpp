@@ -0,0 +1,184 @@
+#include <prescience_helper/database.hpp>
+#include <prescience_helper/summaries.hpp>
+
+#include <array>
+#include <string>
+
+namespace database = prescience_helper::database;
+
+namespace {
+  //any of these showing up in the query plan of a hot query means we're missing an index
+  constexpr std::array<std::string_view, 4> FULL_SCANS{
+    "SCAN Logged",
+    "SCAN Encounter",
+    "SCAN Player",
+    "SCAN Summary"
+  };
+
+  constexpr std::string_view INIT_DB =
+    "CREATE TABLE Patch("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " expac INTEGER NOT NULL,"
+    " patch INTEGER NOT NULL,"
+    " minor INTEGER NOT NULL);"
+    "INSERT INTO Patch(expac,patch,minor) VALUES"
+    " (10,2,0),"
+    " (10,2,5);"
+    "CREATE TABLE Configs("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " name TEXT NOT NULL,"
+    " value TEXT NOT NULL);"
+    "INSERT INTO Configs(name,value) VALUES"
+    " ('log_location','C:\\Program Files (x86)\\World of Warcraft\\_retail_\\Logs'),"
+    " ('version','8'),"
+    " ('damage_codec','zstd'),"
+    " ('stats_codec','zstd'),"
+    " ('deaths_codec','raw'),"
+    " ('rezzes_codec','raw'),"
+    " ('summary_half_life_days','14'),"
+    " ('summary_codec','zstd');"
+    "CREATE TABLE Logs_read("
+    " path TEXT NOT NULL PRIMARY KEY,"
+    " useful_amount INTEGER NOT NULL,"
+    " total_amount INTEGER NOT NULL,"
+    " last_patch INTEGER NULL,"
+    " FOREIGN KEY(last_patch) REFERENCES Patch(id));"
+    //encounters from a build newer than we could simulate, reread on their own once we can. The build may not be in Patch yet
+    "CREATE TABLE Deferred_encounter("
+    " path TEXT NOT NULL,"
+    " start_byte INTEGER NOT NULL,"
+    " end_byte INTEGER NOT NULL,"
+    " expac INTEGER NOT NULL,"
+    " patch INTEGER NOT NULL,"
+    " minor INTEGER NOT NULL,"
+    " PRIMARY KEY(path, start_byte));"
+    "CREATE TABLE Difficulty("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " name TEXT NOT NULL);"
+    "INSERT INTO Difficulty(id,name) VALUES"
+    " (16,'Mythic'),"
+    " (15,'Heroic'),"
+    " (14,'Normal');"
+    "CREATE TABLE Encounter_type("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " name TEXT NOT NULL);"
+    "CREATE TABLE Encounter("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " type INTEGER NOT NULL,"
+    " patch INTEGER NOT NULL,"
+    " difficulty INTEGER NOT NULL,"
+    " start_time INTEGER NOT NULL,"
+    " duration_ms INTEGER NOT NULL,"
+    " FOREIGN KEY(type) REFERENCES Encounter_type(id),"
+    " FOREIGN KEY(patch) REFERENCES Patch(id),"
+    " FOREIGN KEY(difficulty) REFERENCES Difficulty(id));"
+    "CREATE TABLE Player("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " blizz_guid TEXT NOT NULL);"
+    "CREATE TABLE Logged("
+    " id INTEGER NOT NULL PRIMARY KEY,"
+    " player INTEGER NOT NULL,"
+    " spec INT NOT NULL,"
+    " encounter BIGINT NOT NULL,"
+    " damage BLOB NULL,"
+    " stats BLOB NOT NULL,"
+    " deaths BLOB NULL,"
+    " rezzes BLOB NULL,"
+    " FOREIGN KEY(player) REFERENCES Player(id),"
+    " FOREIGN KEY(encounter) REFERENCES Encounter(id));"
+    //pulls whose Logged rows a migration found wrong, kept as they are until resimulate replaces them
+    "CREATE TABLE Pending_resimulation("
+    " encounter INTEGER NOT NULL PRIMARY KEY,"
+    " FOREIGN KEY(encounter) REFERENCES Encounter(id));"
+    //every pull of a player's spec on an encounter and difficulty merged into one, what generation reads
+    "CREATE TABLE Summary("
+    " player INTEGER NOT NULL,"
+    " spec INT NOT NULL,"
+    " type INTEGER NOT NULL,"
+    " difficulty INTEGER NOT NULL,"
+    " summary BLOB NOT NULL,"
+    " PRIMARY KEY(player, spec, type, difficulty),"
+    " FOREIGN KEY(player) REFERENCES Player(id),"
+    " FOREIGN KEY(type) REFERENCES Encounter_type(id),"
+    " FOREIGN KEY(difficulty) REFERENCES Difficulty(id));"
+    //generation looks up by player guid, then their Logged rows by spec, then sorts by Encounter.start_time
+    "CREATE UNIQUE INDEX Player_blizz_guid ON Player(blizz_guid);"
+    "CREATE INDEX Logged_player_spec_encounter ON Logged(player, spec, encounter);"
+    //resimulate replaces an encounter's rows at a time
+    "CREATE INDEX Logged_encounter ON Logged(encounter);"
+    //covers both the generation filter/order and the existing encounter check in the parse thread
+    "CREATE INDEX Encounter_type_difficulty_start_time ON Encounter(type, difficulty, start_time, patch, duration_ms);";
+}
+
+std::optional<prescience_helper::Db> database::open(std::filesystem::path const& path) {
+  sqlite3* db_raw = nullptr;
+  if (sqlite3_open_v2(path.string().c_str(), &db_raw, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK) {
+    sqlite3_close_v2(db_raw);
+    return std::nullopt;
+  }
+  return Db{ db_raw };
+}
+
+std::optional<prescience_helper::Db> database::open_read_only(std::filesystem::path const& path) {
+  sqlite3* db_raw = nullptr;
+  if (sqlite3_open_v2(path.string().c_str(), &db_raw, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr) != SQLITE_OK) {
+    sqlite3_close_v2(db_raw);
+    return std::nullopt;
+  }
+  return Db{ db_raw };
+}
+
+bool database::enable_concurrent_readers(Db const& db) {
+  std::string mode;
+  db.exec<std::string_view>("PRAGMA journal_mode=WAL;", [&mode](std::string_view result) {
+    mode = result;
+    });
+  return mode == "wal";
+}
+
+std::optional<std::int32_t> database::find_id(Db const& db, std::string_view table, std::string_view id_or_name) {
+  std::optional<std::int32_t> returning;
+  db.exec<std::int32_t, std::string_view>("SELECT id, name FROM " + std::string{ table } + ";",
+    [&returning, id_or_name](std::int32_t id, std::string_view name) {
+      if (name == id_or_name || std::to_string(id) == id_or_name) {
+        returning = id;
+      }
+    });
+  return returning;
+}
+
+std::optional<std::string> database::full_scan(Db const& db, std::string_view query) {
+  for (auto& step : db.query_plan(query)) {
+    for (auto const& full_scan : FULL_SCANS) {
+      if (step.starts_with(full_scan)) {
+        return std::move(step);
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+database::Result database::prepare(Db const& db, std::function<void(migrations::Progress const&)> const& progress) {
+  if (!db.exec_script("SELECT COUNT(1) FROM Patch;")) {
+    if (!db.exec_script(INIT_DB)) {
+      return Result::couldnt_create;
+    }
+    summaries::ensure_current(db);
+    return Result::ready;
+  }
+
+  if (migrations::version(db) == EXPECTED_VERSION) {
+    summaries::ensure_current(db);
+    return Result::ready;
+  }
+
+  switch (migrations::migrate(db, EXPECTED_VERSION, progress)) {
+  case migrations::Result::success:
+    summaries::ensure_current(db);
+    return Result::ready;
+  case migrations::Result::too_new:
+    return Result::too_new;
+  default:
+    return Result::no_path;
+  }
+}
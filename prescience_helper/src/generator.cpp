@@ -0,0 +1,126 @@
+#include <prescience_helper/generator.hpp>
+#include <prescience_helper/logged_blobs.hpp>
+#include <prescience_helper/payload.hpp>
+#include <prescience_helper/serialize.hpp>
+#include <prescience_helper/sim/summary.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <charconv>
+#include <cstdio>
+#include <string>
+
+namespace {
+  prescience_helper::Generated failed(std::string error) {
+    return prescience_helper::Generated{ "", std::move(error) };
+  }
+
+  //same as Write_buffer::write_clamped
+  template<typename U, typename T>
+  U clamped(T val) {
+    return std::min<T>(val, std::numeric_limits<U>::max());
+  }
+}
+
+prescience_helper::Generator::Generator(Db const& db) :
+  get_aug_summary_(db.prepare(AUG_SUMMARY_QUERY)),
+  get_member_summary_(db.prepare(MEMBER_SUMMARY_QUERY)) {
+
+}
+
+prescience_helper::Generated prescience_helper::Generator::generate(std::string_view input, std::int32_t encounter, std::int32_t difficulty, clogparser::Period window_size) {
+  PRESCIENCE_HELPER_TRACE_SPAN("generate");
+  std::string_view input_working = input;
+  const auto found_version_delim = input_working.find('?');
+  if (found_version_delim == std::string_view::npos) {
+    return failed("Couldn't find a version in the input string");
+  }
+  const std::string_view version = input_working.substr(0, found_version_delim);
+  input_working = input_working.substr(found_version_delim + 1);
+  const auto payload_version = payload::parse_version(version);
+  if (!payload_version) {
+    return failed("Unsupported input version. Input has version '" + std::string{ version } + "' while we expected '2' or '3'");
+  }
+  std::vector<std::string_view> member_raw = clogparser::helpers::parse_array(input_working);
+
+  if (member_raw.empty() || (member_raw.size() == 1 && member_raw.front() == "")) {
+    return failed("Invalid input");
+  }
+
+  const std::string_view aug_guid = member_raw[0];
+
+  sim::summary::Summary aug_summary;
+  get_aug_summary_.exec<std::span<const std::byte>>([this, &aug_summary](std::span<const std::byte> summary) {
+    logged::deserialize_blob(summary, decode_scratch_, aug_summary);
+    }, aug_guid, encounter, difficulty);
+
+  sim::summary::Summary member_summary;
+  std::vector<std::string_view> member_members;
+
+  payload::Payload building;
+  building.window_size = static_cast<std::uint8_t>(std::chrono::duration_cast<std::chrono::milliseconds>(window_size).count() / 100);
+  building.raiders.reserve(member_raw.size() - 1);
+  for (std::size_t i = 1; i < member_raw.size(); ++i) {
+    member_members.clear();
+    clogparser::helpers::parse_array(member_members, member_raw[i]);
+
+    if (member_members.size() != 3) {
+      return failed("Invalid member info, didn't have exactly 3 values");
+    }
+
+    const auto guid = member_members[0];
+    std::int32_t spec_id = -1;
+    try {
+      spec_id = clogparser::helpers::parseInt<std::int32_t>(member_members[2]);
+    } catch (...) {
+      return failed("Couldn't parse spec id");
+    }
+
+    const auto first_dash = guid.find('-');
+    if (first_dash == std::string_view::npos) {
+      return failed("Unexpected GUID format in '" + std::string{ guid } + '\'');
+    }
+    const auto second_dash = guid.find('-', first_dash + 1);
+    if (second_dash == std::string_view::npos) {
+      return failed("Unexpected GUID format in '" + std::string{ guid } + '\'');
+    }
+    const std::string_view guid_server_id_str = guid.substr(first_dash + 1, second_dash - first_dash - 1);
+    const std::string_view guid_player_uid_str = guid.substr(second_dash + 1);
+
+    auto& raider = building.raiders.emplace_back();
+    try {
+      raider.server_id = clogparser::helpers::parseInt<std::uint16_t>(guid_server_id_str);
+    } catch (std::exception const&) {
+      return failed("Unexpected GUID format in '" + std::string{ guid } + '\'');
+    }
+
+    std::from_chars_result guid_player_uid_res = std::from_chars(guid_player_uid_str.data(), guid_player_uid_str.data() + guid_player_uid_str.size(), raider.player_uid, 16);
+    if (guid_player_uid_res.ec != std::errc()) {
+      return failed("Unexpected GUID format in '" + std::string{ guid } + '\'');
+    }
+
+    member_summary = sim::summary::Summary{};
+    get_member_summary_.exec<std::span<const std::byte>>([this, &member_summary](std::span<const std::byte> summary) {
+      logged::deserialize_blob(summary, decode_scratch_, member_summary);
+      }, guid, spec_id, encounter, difficulty);
+
+    const auto agged_damage = sim::summary::aggregate_damage(member_summary, aug_summary, true, window_size);
+
+    raider.windows.reserve(agged_damage.size());
+    for (auto const& damage : agged_damage) {
+      raider.windows.push_back(payload::Window{
+        damage.when / window_size,
+        clamped<std::uint16_t>(damage.what.base / 1000),
+        clamped<std::uint8_t>((damage.what.with_ebon_mult - 1) * 100),
+        clamped<std::uint8_t>((damage.what.with_prescience_mult - 1) * 100),
+        clamped<std::uint8_t>((damage.what.with_shifting_sands_mult - 1) * 100)
+      });
+    }
+  }
+
+  std::vector<std::byte> payload_underlying;
+  payload::encode(*payload_version, building, payload_underlying);
+
+  std::string output{ payload::version_prefix(*payload_version) };
+  serialize::to_ascii_85(output, payload_underlying);
+  return Generated{ std::move(output), "" };
+}
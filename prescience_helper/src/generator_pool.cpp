@@ -0,0 +1,48 @@
+#include <prescience_helper/generator_pool.hpp>
+#include <prescience_helper/database.hpp>
+
+prescience_helper::Generator_pool::Connection::Connection(Db db_in) :
+  db(std::move(db_in)),
+  generator(db) {
+
+}
+
+prescience_helper::Generator_pool::Lease::Lease(Generator_pool& pool, std::unique_ptr<Connection> connection) :
+  pool_(pool),
+  connection_(std::move(connection)) {
+
+}
+
+prescience_helper::Generator_pool::Lease::~Lease() {
+  if (connection_) {
+    pool_.release_(std::move(connection_));
+  }
+}
+
+prescience_helper::Generator_pool::Generator_pool(std::filesystem::path const& path, std::size_t size) {
+  free_.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    auto db = database::open_read_only(path);
+    if (!db) {
+      valid_ = false;
+      return;
+    }
+    free_.push_back(std::make_unique<Connection>(std::move(*db)));
+  }
+}
+
+prescience_helper::Generator_pool::Lease prescience_helper::Generator_pool::acquire() {
+  std::unique_lock lock{ mutex_ };
+  released_.wait(lock, [this]() { return !free_.empty(); });
+  auto connection = std::move(free_.back());
+  free_.pop_back();
+  return Lease{ *this, std::move(connection) };
+}
+
+void prescience_helper::Generator_pool::release_(std::unique_ptr<Connection> connection) {
+  {
+    std::lock_guard lock{ mutex_ };
+    free_.push_back(std::move(connection));
+  }
+  released_.notify_one();
+}
@@ -0,0 +1,548 @@
+#include <prescience_helper/encounter_cache.hpp>
+#include <prescience_helper/ingest_pipeline.hpp>
+#include <prescience_helper/logged_blobs.hpp>
+#include <prescience_helper/sim/on_rails.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <mutex>
+
+namespace {
+  //Encounter.start_time, the log's timestamps don't have the year
+  std::int64_t start_time_ms(clogparser::Timestamp const& start_time) {
+    const std::chrono::milliseconds time =
+      std::chrono::days{ 31 } * start_time.month
+      + std::chrono::days{ start_time.day }
+      + std::chrono::hours{ start_time.hour }
+      + std::chrono::minutes{ start_time.minute }
+      + std::chrono::seconds{ start_time.second }
+      + std::chrono::milliseconds{ start_time.millisecond };
+    return time.count();
+  }
+}
+
+void prescience_helper::Stored_encounters::load(Db const& db) {
+  std::unique_lock lock{ mutex_ };
+  keys_.clear();
+  db.exec<std::int64_t, std::int32_t, std::int32_t, std::int32_t>("SELECT start_time, type, difficulty, patch FROM Encounter;",
+    [this](std::int64_t start_time, std::int32_t type, std::int32_t difficulty, std::int32_t patch) {
+      keys_.insert(Key{ start_time, type, difficulty, patch });
+    });
+}
+
+bool prescience_helper::Stored_encounters::contains(Key const& key) const {
+  std::shared_lock lock{ mutex_ };
+  return keys_.count(key) != 0;
+}
+
+void prescience_helper::Stored_encounters::insert(Key const& key) {
+  std::unique_lock lock{ mutex_ };
+  keys_.insert(key);
+}
+
+std::size_t prescience_helper::Stored_encounters::Hash::operator()(Key const& key) const noexcept {
+  std::size_t returning = std::hash<std::int64_t>{}(key.start_time_ms);
+  for (const std::int32_t part : { key.type, key.difficulty, key.patch }) {
+    returning = returning * 31 + std::hash<std::int32_t>{}(part);
+  }
+  return returning;
+}
+
+std::filesystem::path prescience_helper::encounter_cache_path(std::filesystem::path const& directory, Stored_encounters::Key const& key) {
+  auto name = std::to_string(key.start_time_ms) + '-' + std::to_string(key.type) + '-' + std::to_string(key.difficulty) + '-' + std::to_string(key.patch);
+  name += encounter_cache::EXTENSION;
+  return directory / name;
+}
+
+prescience_helper::Ingest_config prescience_helper::load_ingest_config(Db const& db) {
+  Ingest_config returning;
+
+  //a dbc pack can be for a build newer than any the db was made with, its pulls need a Patch row to be stored
+  const auto simulating = sim::simulating_for();
+  db.exec("INSERT INTO Patch(expac,patch,minor) SELECT ?1, ?2, ?3"
+    " WHERE NOT EXISTS (SELECT 1 FROM Patch WHERE expac = ?1 AND patch = ?2 AND minor = ?3);", []() {},
+    static_cast<std::int32_t>(simulating.expac),
+    static_cast<std::int32_t>(simulating.patch),
+    static_cast<std::int32_t>(simulating.minor));
+
+  db.exec<std::int32_t, std::int32_t, std::int32_t, std::int32_t>("SELECT id, expac, patch, minor FROM Patch;",
+    [&returning](std::int32_t id, std::int32_t expac, std::int32_t patch, std::int32_t minor) {
+      returning.patches.push_back(Patch{
+        clogparser::events::Combat_log_version::Build_version{
+          static_cast<std::uint8_t>(expac),
+          static_cast<std::uint8_t>(patch),
+          static_cast<std::uint8_t>(minor)},
+        id,
+        });
+    });
+
+  db.exec<std::int32_t>("SELECT id FROM Difficulty;", [&returning](std::int32_t id) {
+    returning.difficulty_ids.insert(id);
+    });
+
+  db.exec<std::string_view, std::string_view>("SELECT name, value FROM Configs;", [&returning](std::string_view name, std::string_view value) {
+    if (name == MEMORY_BUDGET_CONFIG) {
+      std::size_t megabytes = 0;
+      if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), megabytes); ec == std::errc{}) {
+        returning.ingest_options.memory_budget = megabytes * 1024 * 1024;
+      }
+      return;
+    }
+    if (name == ENCOUNTER_CACHE_CONFIG) {
+      returning.cache_directory = std::filesystem::path{ value };
+      return;
+    }
+    const auto found = std::find(blob_codec::CODEC_CONFIGS.begin(), blob_codec::CODEC_CONFIGS.end(), name);
+    if (found == blob_codec::CODEC_CONFIGS.end()) {
+      return;
+    }
+    if (const auto codec = blob_codec::from_name(value); codec) {
+      returning.codecs[std::distance(blob_codec::CODEC_CONFIGS.begin(), found)] = *codec;
+    }
+    });
+
+  return returning;
+}
+
+prescience_helper::Log_file::Log_file() :
+  Log_file(BUFFER_SIZE) {
+
+}
+
+prescience_helper::Log_file::Log_file(std::size_t buffer_size) :
+  decompressing_(buffer_size) {
+  buffer_.resize(buffer_size);
+}
+
+void prescience_helper::Log_file::open(std::filesystem::path path, compressed::Format format, std::uintmax_t offset, std::optional<std::uintmax_t> until) {
+  if (input_.is_open()) {
+    input_.close();
+  }
+  until_ = until;
+  position_ = offset;
+  reached_until_ = false;
+  is_compressed_ = format != compressed::Format::plain;
+  if (is_compressed_) {
+    compressed_reported_ = 0;
+    decompressing_.open(std::move(path), format, offset);
+    return;
+  }
+  input_.open(path, std::ios::binary | std::ios::in);
+  input_.seekg(offset);
+}
+
+std::string_view prescience_helper::Log_file::next() {
+  if (reached_until_) {
+    return {};
+  }
+
+  if (is_compressed_) {
+    const auto returning = limit_(decompressing_.next());
+    if (reporter_ != nullptr) {
+      const auto compressed_read = decompressing_.compressed_read();
+      reporter_->add_read(compressed_read - compressed_reported_, static_cast<std::uint64_t>(std::count(returning.begin(), returning.end(), '\n')));
+      compressed_reported_ = compressed_read;
+    }
+    return returning;
+  }
+
+  std::size_t reading = buffer_.size();
+  if (until_) {
+    //rereads are one encounter, don't read a whole buffer past it. The line at until_ usually fits in the slack,
+    //if it doesn't the next call reads more
+    constexpr std::size_t LINE_SLACK = 64 * 1024;
+    const auto to_until = *until_ > position_ ? *until_ - position_ : 0;
+    reading = static_cast<std::size_t>(std::min<std::uintmax_t>(reading, to_until + LINE_SLACK));
+  }
+  input_.read(buffer_.data(), reading);
+  const auto read = limit_({ buffer_.data(), static_cast<std::size_t>(input_.gcount()) });
+
+  if (reporter_ != nullptr) {
+    reporter_->add_read(read.size(), static_cast<std::uint64_t>(std::count(read.begin(), read.end(), '\n')));
+  }
+
+  return read;
+}
+
+std::string_view prescience_helper::Log_file::limit_(std::string_view read) noexcept {
+  const auto start = position_;
+  position_ += read.size();
+  if (!until_ || position_ <= *until_) {
+    return read;
+  }
+  const auto line_end = read.find('\n', static_cast<std::size_t>(*until_ > start ? *until_ - start : 0));
+  if (line_end == std::string_view::npos) {
+    return read;
+  }
+  reached_until_ = true;
+  return read.substr(0, line_end + 1);
+}
+
+prescience_helper::Log_preparer::Log_preparer(Ingest_config config) :
+  config_(std::move(config)) {
+
+}
+
+prescience_helper::Log_preparer::Log_preparer(Ingest_config config, std::size_t buffer_size) :
+  config_(std::move(config)),
+  reader_(buffer_size) {
+
+}
+
+void prescience_helper::Log_preparer::open(Prepared_log& log) {
+  log.read_from = log.log.old_useful;
+  strings_.clear();
+  current_ = Encounter{};
+  ingested_.clear();
+  ingested_pos_ = 0;
+
+  if (reporter_ != nullptr) {
+    reporter_->stage(progress::Stage::reading);
+    reporter_->start_log(log.log.new_total > log.log.old_useful ? log.log.new_total - log.log.old_useful : 0);
+  }
+
+  if (config_.stored) {
+    config_.ingest_options.skip_encounter = [this, last_patch = log.log.last_patch](Encounter const& encounter) {
+      const auto difficulty = static_cast<std::int32_t>(encounter.start.difficulty_id);
+      //next would throw it away before simulating anyway
+      if (config_.difficulty_ids.count(difficulty) == 0) {
+        return true;
+      }
+      const auto patch = patch_of_(encounter, last_patch);
+      return patch && config_.stored->contains(Stored_encounters::Key{
+        start_time_ms(encounter.start_time),
+        static_cast<std::int32_t>(encounter.start.encounter_id),
+        difficulty,
+        *patch });
+    };
+  }
+
+  std::optional<std::uintmax_t> until;
+  if (log.rereading) {
+    until = log.rereading->end_byte;
+  }
+  reader_.open(log.log.path, log.log.format, log.log.old_useful, until);
+  prescience_helper::ingest(reader_, strings_, ingested_, config_.ingest_options);
+
+  if (reporter_ != nullptr) {
+    reporter_->add_found(ingested_.size());
+  }
+
+  log.memory_usage = memory::Log_usage{};
+  log.memory_usage.ingested = memory::measure_ingested(ingested_);
+}
+
+bool prescience_helper::Log_preparer::next(Prepared_log& prepared, Prepared_encounter& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("prepare encounter");
+  auto& log = prepared.log;
+  if (reporter_ != nullptr) {
+    reporter_->stage(progress::Stage::simulating);
+  }
+
+  while (ingested_pos_ < ingested_.size()) {
+    //moved out so the last encounter, and its spill file, is freed as soon as we're past it
+    current_ = std::move(ingested_[ingested_pos_++]);
+    auto const& encounter = current_;
+
+    clogparser::events::Combat_log_version::Build_version build{ 0 };
+    if (encounter.build) {
+      build = *encounter.build;
+    } else if (log.last_patch) {
+      const auto found = std::find_if(config_.patches.begin(), config_.patches.end(), [id = *log.last_patch](Patch const& patch) {
+        return patch.id == id;
+        });
+      if (found != config_.patches.end()) {
+        build = found->build;
+      } else {
+        //can't find patch, skip
+        continue;
+      }
+    } else {
+      //can't find patch, skip
+      continue;
+    }
+
+    //ingest's offsets are from where we started reading
+    const auto end_byte = prepared.read_from + encounter.end_byte;
+    if (end_byte > log.old_useful) {
+      log.old_useful = end_byte;
+    }
+
+    const auto is_valid = (build <=> sim::simulating_for());
+    if (is_valid == std::strong_ordering::less) {
+      continue; //old, ignore
+    } else if (is_valid == std::strong_ordering::greater) {
+      //new, we can't parse this yet. Only it is reread once we can
+      if (!encounter.skipped) {
+        prepared.deferred.push_back(Deferred_encounter{ log.path, prepared.read_from + encounter.start_byte, end_byte, build });
+      }
+      continue;
+    }
+
+    const auto found_patch = std::find_if(config_.patches.begin(), config_.patches.end(), [build](Patch const& patch) {
+      return patch.build == build;
+      });
+
+    //load_ingest_config always has a row for simulating_for, and anything else was skipped above
+    assert(found_patch != config_.patches.end());
+
+    log.last_patch = found_patch->id;
+
+    //a pull we already have, or of a difficulty we don't keep, its events weren't even read
+    if (encounter.skipped) {
+      continue;
+    }
+
+    //checked before simulating, so we don't simulate pulls we'd throw away
+    if (config_.difficulty_ids.count((std::int32_t)encounter.start.difficulty_id) == 0) {
+      continue;
+    }
+
+    if (!config_.cache_directory.empty()) {
+      const auto path = encounter_cache_path(config_.cache_directory, Stored_encounters::Key{
+        start_time_ms(encounter.start_time),
+        static_cast<std::int32_t>(encounter.start.encounter_id),
+        static_cast<std::int32_t>(encounter.start.difficulty_id),
+        found_patch->id });
+      try {
+        std::filesystem::create_directories(config_.cache_directory);
+        encounter_cache::write(path, encounter);
+      } catch (std::exception const& e) {
+        //only resimulating needs it, not worth losing the pull over
+        fprintf(stderr, "%s\n", e.what());
+      }
+    }
+
+    simulate(encounter, found_patch->id, out);
+    prepared.memory_usage.add(out.memory_usage);
+
+    return true;
+  }
+
+  return false;
+}
+
+void prescience_helper::Log_preparer::simulate(Encounter const& encounter, std::int32_t patch, Prepared_encounter& out) {
+  const auto simulated = sim::on_rails::simulate(encounter, config_.gear_cache.get());
+
+  out.type = encounter.start.encounter_id;
+  out.name = encounter.start.encounter_name;
+  out.difficulty = (std::int32_t)encounter.start.difficulty_id;
+  out.patch = patch;
+  out.start_time_ms = start_time_ms(encounter.start_time);
+  out.duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(encounter.end_time - encounter.start_time).count();
+
+  //reuse the blobs of whatever out held before
+  std::size_t players_used = 0;
+  for (auto const& player : simulated.players) {
+    if (player.damage_events.empty()) {
+      //if player did no damage (e.g. reset or maybe a carry) ignore this pull
+      continue;
+    }
+    if (players_used == out.players.size()) {
+      out.players.emplace_back();
+    }
+    auto& adding = out.players[players_used++];
+    adding.guid = player.ingest_player->info.guid;
+    adding.spec = (std::int32_t)player.ingest_player->info.current_spec_id;
+
+    serialized_.clear();
+    logged::serialize(player.damage_events, serialized_);
+    blob_codec::encode(config_.codecs[0], blob_codec::FORMAT_FIXED_WIDTH, serialized_, adding.blobs[0]);
+    serialized_.clear();
+    logged::serialize(player.stat_events, serialized_);
+    blob_codec::encode(config_.codecs[1], blob_codec::FORMAT_STATS_DELTA, serialized_, adding.blobs[1]);
+    serialized_.clear();
+    logged::serialize(player.died, serialized_);
+    blob_codec::encode(config_.codecs[2], blob_codec::FORMAT_FIXED_WIDTH, serialized_, adding.blobs[2]);
+    serialized_.clear();
+    logged::serialize(player.rezzed, serialized_);
+    blob_codec::encode(config_.codecs[3], blob_codec::FORMAT_FIXED_WIDTH, serialized_, adding.blobs[3]);
+
+    adding.summary = sim::summary::summarize(
+      out.start_time_ms,
+      std::chrono::duration_cast<clogparser::Period>(std::chrono::milliseconds{ out.duration_ms }),
+      player.damage_events, player.stat_events, player.died, player.rezzed);
+  }
+  out.players.resize(players_used);
+
+  out.memory_usage = memory::measure(encounter);
+  out.memory_usage.simulated = memory::heap_bytes(simulated);
+  for (auto const& player : out.players) {
+    for (auto const& blob : player.blobs) {
+      out.memory_usage.blobs += memory::heap_bytes(blob);
+    }
+    out.memory_usage.blobs += memory::heap_bytes(player.summary.slices);
+  }
+}
+
+std::vector<prescience_helper::Prepared_log> prescience_helper::load_ready_deferred(Db const& db) {
+  std::vector<Prepared_log> returning;
+
+  //builds we can simulate now but that nothing has added to Patch yet, their encounters are stored with it
+  const auto simulating = sim::simulating_for();
+  db.exec("INSERT INTO Patch(expac,patch,minor) SELECT DISTINCT expac, patch, minor FROM Deferred_encounter"
+    " WHERE (expac, patch, minor) <= (?, ?, ?) AND NOT EXISTS (SELECT 1 FROM Patch"
+    " WHERE Patch.expac = Deferred_encounter.expac AND Patch.patch = Deferred_encounter.patch AND Patch.minor = Deferred_encounter.minor);", []() {},
+    static_cast<std::int32_t>(simulating.expac),
+    static_cast<std::int32_t>(simulating.patch),
+    static_cast<std::int32_t>(simulating.minor));
+
+  db.exec<std::string_view, std::int64_t, std::int64_t, std::int32_t, std::int32_t, std::int32_t, std::optional<std::int32_t>>(
+    "SELECT Deferred_encounter.path, Deferred_encounter.start_byte, Deferred_encounter.end_byte,"
+    " Deferred_encounter.expac, Deferred_encounter.patch, Deferred_encounter.minor, Patch.id FROM Deferred_encounter"
+    " LEFT JOIN Patch ON Patch.expac = Deferred_encounter.expac AND Patch.patch = Deferred_encounter.patch AND Patch.minor = Deferred_encounter.minor;",
+    [&returning](std::string_view path, std::int64_t start_byte, std::int64_t end_byte, std::int32_t expac, std::int32_t patch, std::int32_t minor, std::optional<std::int32_t> patch_id) {
+      const clogparser::events::Combat_log_version::Build_version build{
+        static_cast<std::uint8_t>(expac),
+        static_cast<std::uint8_t>(patch),
+        static_cast<std::uint8_t>(minor) };
+      //still too new, everything else was given a Patch row above
+      if (!patch_id || (build <=> sim::simulating_for()) == std::strong_ordering::greater) {
+        return;
+      }
+
+      auto& adding = returning.emplace_back();
+      //the encounter has no COMBAT_LOG_VERSION line of its own, so its build comes from last_patch
+      adding.log = Log_finder::Log{
+        std::filesystem::path{ path },
+        static_cast<std::uintmax_t>(start_byte),
+        static_cast<std::uintmax_t>(start_byte),
+        static_cast<std::uintmax_t>(end_byte),
+        *patch_id,
+        compressed::format_of(path) };
+      adding.rereading = Deferred_encounter{
+        adding.log.path,
+        static_cast<std::uintmax_t>(start_byte),
+        static_cast<std::uintmax_t>(end_byte),
+        build };
+    });
+  return returning;
+}
+
+std::optional<std::int32_t> prescience_helper::Log_preparer::patch_of_(Encounter const& encounter, std::optional<std::int32_t> last_patch) const {
+  if (!encounter.build) {
+    return last_patch;
+  }
+  const auto found = std::find_if(config_.patches.begin(), config_.patches.end(), [build = *encounter.build](Patch const& patch) {
+    return patch.build == build;
+    });
+  if (found == config_.patches.end()) {
+    return std::nullopt;
+  }
+  return found->id;
+}
+
+void prescience_helper::Log_preparer::report_to(progress::Reporter* reporter) noexcept {
+  reporter_ = reporter;
+  reader_.report_to(reporter);
+}
+
+prescience_helper::Encounter_store::Encounter_store(Db const& db) :
+  db_(db),
+  insert_encounter_type_stmt_(db_.prepare("INSERT INTO Encounter_type(id,name) VALUES (?,?);")),
+  check_for_existing_encounter_stmt_(db_.prepare(EXISTING_ENCOUNTER_QUERY)),
+  insert_encounter_stmt_(db_.prepare("INSERT INTO Encounter(type, patch, difficulty, start_time, duration_ms) VALUES (?, ?, ?, ?, ?);")),
+  update_log_read_(db_.prepare("INSERT INTO Logs_read(path, useful_amount, total_amount,last_patch) VALUES(?, ?, ?, ?) ON CONFLICT(path) DO UPDATE SET useful_amount = excluded.useful_amount, total_amount = excluded.total_amount, last_patch = excluded.last_patch;")),
+  insert_deferred_stmt_(db_.prepare("INSERT OR IGNORE INTO Deferred_encounter(path, start_byte, end_byte, expac, patch, minor) VALUES (?, ?, ?, ?, ?, ?);")),
+  delete_deferred_stmt_(db_.prepare("DELETE FROM Deferred_encounter WHERE path = ? AND start_byte = ?;")),
+  delete_logged_stmt_(db_.prepare("DELETE FROM Logged WHERE encounter = ?;")),
+  delete_pending_stmt_(db_.prepare("DELETE FROM Pending_resimulation WHERE encounter = ?;")),
+  writer_(db_),
+  merger_(db_) {
+
+  db_.exec<std::int32_t>("SELECT id FROM Encounter_type;", [this](std::int32_t id) {
+    encounter_ids_.insert(id);
+    });
+  stored_->load(db_);
+}
+
+std::size_t prescience_helper::Encounter_store::store(Prepared_encounter const& encounter) {
+  PRESCIENCE_HELPER_TRACE_SPAN("store encounter");
+  writer_.begin();
+
+  if (encounter_ids_.count(encounter.type) == 0) {
+    insert_encounter_type_stmt_.exec([]() {}, encounter.type, encounter.name);
+    encounter_ids_.insert(encounter.type);
+    new_encounter_types_.push_back({ encounter.name, encounter.type });
+  } else { //if the encounter type didn't exist, the encounter can't have existed, so don't check
+    std::int32_t count = 0;
+    check_for_existing_encounter_stmt_.exec<std::int32_t>([&count](std::int32_t res) {
+      count = res;
+      }, encounter.start_time_ms, encounter.type, encounter.difficulty, encounter.patch);
+
+    if (count != 0) {
+      stored_->insert(Stored_encounters::Key{ encounter.start_time_ms, encounter.type, encounter.difficulty, encounter.patch });
+      return 0;
+    }
+  }
+
+  insert_encounter_stmt_.exec([]() {},
+    encounter.type,
+    encounter.patch,
+    encounter.difficulty,
+    encounter.start_time_ms,
+    encounter.duration_ms);
+
+  const auto encounter_id = db_.last_insert_rowid();
+  stored_->insert(Stored_encounters::Key{ encounter.start_time_ms, encounter.type, encounter.difficulty, encounter.patch });
+
+  for (auto const& player : encounter.players) {
+    const std::int64_t player_id = writer_.player_id(player.guid);
+
+    writer_.insert_logged(
+      player_id, player.spec, encounter_id, player.blobs[0], player.blobs[1], player.blobs[2], player.blobs[3]);
+    merger_.add(summaries::Key{ player_id, player.spec, encounter.type, encounter.difficulty }, player.summary);
+  }
+
+  return writer_.end_encounter();
+}
+
+std::size_t prescience_helper::Encounter_store::replace(std::int64_t encounter_id, Prepared_encounter const& encounter) {
+  PRESCIENCE_HELPER_TRACE_SPAN("replace encounter");
+  writer_.begin();
+
+  delete_logged_stmt_.exec([]() {}, encounter_id);
+  delete_pending_stmt_.exec([]() {}, encounter_id);
+  for (auto const& player : encounter.players) {
+    writer_.insert_logged(
+      writer_.player_id(player.guid), player.spec, encounter_id, player.blobs[0], player.blobs[1], player.blobs[2], player.blobs[3]);
+  }
+
+  return writer_.end_encounter();
+}
+
+void prescience_helper::Encounter_store::finish_log(Prepared_log const& log, Log_finder& finder) {
+  //goes in the same transaction as the encounters, so we never mark a log read without its rows
+  writer_.begin();
+  const auto path_string = log.log.path.string();
+
+  if (log.rereading) {
+    //the rest of the log was already read
+    delete_deferred_stmt_.exec([]() {}, path_string, (std::int64_t)log.rereading->start_byte);
+  } else {
+    if (log.log.old_useful > log.read_from) {
+      finder.set_log_read(log.log.path, log.log.old_useful, log.log.new_total, log.log.last_patch);
+    }
+    update_log_read_.exec([]() {}, path_string, (std::int64_t)log.log.old_useful, (std::int64_t)log.log.new_total, log.log.last_patch);
+  }
+
+  for (auto const& deferred : log.deferred) {
+    insert_deferred_stmt_.exec([]() {},
+      path_string,
+      (std::int64_t)deferred.start_byte,
+      (std::int64_t)deferred.end_byte,
+      (std::int32_t)deferred.build.expac,
+      (std::int32_t)deferred.build.patch,
+      (std::int32_t)deferred.build.minor);
+  }
+}
+
+void prescience_helper::Encounter_store::take_new_encounter_types(std::vector<std::pair<std::string, std::int32_t>>& into) {
+  for (auto& adding : new_encounter_types_) {
+    into.push_back(std::move(adding));
+  }
+  new_encounter_types_.clear();
+}
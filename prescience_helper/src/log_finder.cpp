@@ -33,6 +33,12 @@ void prescience_helper::Log_finder::check(std::vector<Log>& returning) {
         continue;
       }
 
+      //archived logs this build can't decompress are left alone
+      const auto format = compressed::format_of(dir_entry.path());
+      if (!compressed::is_supported(format)) {
+        continue;
+      }
+
       const auto file_size = dir_entry.file_size();
       const auto found = cache_.find(dir_entry.path());
 
@@ -42,7 +48,9 @@ void prescience_helper::Log_finder::check(std::vector<Log>& returning) {
           dir_entry.path(),
           0,
           0,
-          file_size });
+          file_size,
+          std::nullopt,
+          format });
       } else {
         if (found->second.total < file_size) {
           returning.push_back({
@@ -50,7 +58,8 @@ void prescience_helper::Log_finder::check(std::vector<Log>& returning) {
             found->second.useful,
             found->second.total,
             file_size,
-            found->second.last_patch 
+            found->second.last_patch,
+            format
             });
           found->second.total = file_size;
         }
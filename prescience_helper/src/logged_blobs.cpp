@@ -0,0 +1,226 @@
+#include <prescience_helper/logged_blobs.hpp>
+#include <prescience_helper/serialize.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <array>
+#include <bit>
+
+namespace logged = prescience_helper::logged;
+
+namespace {
+  constexpr std::uint32_t LOGGED_DAMAGE_FLAG1_SCALES_WITH_PRIMARY = 1 << 0;
+  constexpr std::uint32_t LOGGED_DAMAGE_FLAG1_CAN_NOT_CRIT = 1 << 1;
+  constexpr std::uint32_t LOGGED_DAMAGE_FLAG1_ALLOW_CLASS_ABILITY_PROCS = 1 << 2;
+
+  constexpr std::size_t SIZEOF_DAMAGE_EVENT =
+    sizeof(clogparser::Period::rep)
+    + sizeof(double) * 3
+    + sizeof(std::uint8_t);
+
+  constexpr std::size_t SIZEOF_STATS_EVENT =
+    sizeof(clogparser::Period::rep)
+    + sizeof(prescience_helper::sim::Combat_stats::value_type) * prescience_helper::sim::Combat_stats::size;
+
+  //a one or two byte when delta, the changed byte and one value
+  constexpr std::size_t SIZEOF_STATS_DELTA_GUESS = 2 + sizeof(std::uint8_t) + sizeof(double);
+
+  constexpr std::size_t SIZEOF_DIED_REZZED_EVENT =
+    sizeof(clogparser::Period::rep);
+}
+
+void logged::serialize(std::vector<Event<sim::Damage>> const& in, std::vector<std::byte>& returning) {
+  PRESCIENCE_HELPER_TRACE_SPAN("serialize damage");
+
+  serialize::Write_buffer buffer{ returning };
+  buffer.reserve_more(in.size() * SIZEOF_DAMAGE_EVENT);
+
+  for (auto const& damage : in) {
+    const std::uint8_t flags =
+      (damage.what.allow_class_ability_procs ? LOGGED_DAMAGE_FLAG1_ALLOW_CLASS_ABILITY_PROCS : 0)
+      | (damage.what.can_not_crit ? LOGGED_DAMAGE_FLAG1_CAN_NOT_CRIT : 0)
+      | (damage.what.scales_with_primary ? LOGGED_DAMAGE_FLAG1_SCALES_WITH_PRIMARY : 0);
+
+    buffer.write(
+      damage.when.count(),
+      damage.what.base_scaling,
+      damage.what.amp.crit_amp,
+      damage.what.amp.crit_chance_add,
+      flags);
+  }
+}
+
+void logged::deserialize(std::span<const std::byte> in, std::vector<Event<sim::Damage>>& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("deserialize damage");
+  if (in.size() % SIZEOF_DAMAGE_EVENT != 0) {
+    throw std::runtime_error{ "In doesn't contain a whole multiple of the event" };
+  }
+
+  out.reserve(in.size() / SIZEOF_DAMAGE_EVENT);
+
+  serialize::Read_buffer buffer{ in };
+
+  while (!buffer.empty()) {
+    Event<sim::Damage> adding;
+    adding.when = clogparser::Period{ buffer.read<clogparser::Period::rep>() };
+    adding.what.base_scaling = buffer.read<double>();
+    adding.what.amp.crit_amp = buffer.read<double>();
+    adding.what.amp.crit_chance_add = buffer.read<double>();
+
+    const auto flags = buffer.read<std::uint8_t>();
+
+    adding.what.allow_class_ability_procs = (flags & LOGGED_DAMAGE_FLAG1_ALLOW_CLASS_ABILITY_PROCS) != 0;
+    adding.what.can_not_crit = (flags & LOGGED_DAMAGE_FLAG1_CAN_NOT_CRIT) != 0;
+    adding.what.scales_with_primary = (flags & LOGGED_DAMAGE_FLAG1_SCALES_WITH_PRIMARY) != 0;
+
+    out.push_back(std::move(adding));
+  }
+}
+
+void logged::serialize(sim::Stats_timeline const& in, std::vector<std::byte>& returning) {
+  PRESCIENCE_HELPER_TRACE_SPAN("serialize stats");
+
+  serialize::Write_buffer buffer{ returning };
+  //most changes are one field
+  buffer.reserve_more(in.size() * SIZEOF_STATS_DELTA_GUESS);
+
+  clogparser::Period::rep last_when = 0;
+  for (auto const& event : in) {
+    buffer.write_zigzag(event.when.count() - last_when);
+    last_when = event.when.count();
+    buffer.write(event.what.changed);
+    for (int i = 0; i < std::popcount(event.what.changed); ++i) {
+      buffer.write(event.what.values[i]);
+    }
+  }
+}
+
+void logged::deserialize(std::uint8_t format, std::span<const std::byte> in, sim::Stats_timeline& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("deserialize stats");
+
+  serialize::Read_buffer buffer{ in };
+
+  if (format == blob_codec::FORMAT_FIXED_WIDTH || format == blob_codec::FORMAT_EMPTY) {
+    if (in.size() % SIZEOF_STATS_EVENT != 0) {
+      throw std::runtime_error{ "In doesn't contain a whole multiple of the event" };
+    }
+    sim::Combat_stats last;
+    while (!buffer.empty()) {
+      const clogparser::Period when{ buffer.read<clogparser::Period::rep>() };
+      sim::Combat_stats stats;
+      for (auto& stat : stats) {
+        stat = buffer.read<double>();
+      }
+      out.push_back(when, last, stats);
+      last = stats;
+    }
+    return;
+  }
+  if (format != blob_codec::FORMAT_STATS_DELTA) {
+    throw std::runtime_error{ "Unknown Logged blob format" };
+  }
+
+  std::array<double, sim::Combat_stats::size> values;
+  clogparser::Period::rep when = 0;
+  while (!buffer.empty()) {
+    when += buffer.read_zigzag();
+    if (buffer.empty()) {
+      throw std::runtime_error{ "Stats change cut short" };
+    }
+    const auto changed = buffer.read<std::uint8_t>();
+    const auto count = static_cast<std::size_t>(std::popcount(changed));
+    if (count > values.size() || buffer.size() < count * sizeof(double)) {
+      throw std::runtime_error{ "Stats change cut short" };
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      values[i] = buffer.read<double>();
+    }
+    out.push_back(clogparser::Period{ when }, changed, std::span{ values }.first(count));
+  }
+}
+
+void logged::serialize(std::vector<Event<void>> const& in, std::vector<std::byte>& returning) {
+  PRESCIENCE_HELPER_TRACE_SPAN("serialize events");
+
+  serialize::Write_buffer buffer{ returning };
+  buffer.reserve_more(in.size() * SIZEOF_DIED_REZZED_EVENT);
+
+  for (auto const& event : in) {
+    buffer.write(event.when.count());
+  }
+}
+
+void logged::deserialize(std::span<const std::byte> in, std::vector<Event<void>>& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("deserialize events");
+  if (in.size() % SIZEOF_DIED_REZZED_EVENT != 0) {
+    throw std::runtime_error{ "In doesn't contain a whole multiple of the event" };
+  }
+
+  out.reserve(in.size() / SIZEOF_DIED_REZZED_EVENT);
+
+  serialize::Read_buffer buffer{ in };
+
+  while (!buffer.empty()) {
+    out.push_back(Event<void>{
+      clogparser::Period{ buffer.read<clogparser::Period::rep>() }
+    });
+  }
+}
+
+void logged::serialize(sim::summary::Summary const& in, std::vector<std::byte>& returning) {
+  PRESCIENCE_HELPER_TRACE_SPAN("serialize summary");
+
+  serialize::Write_buffer buffer{ returning };
+  //slices with damage in them have most fields set
+  buffer.reserve_more(sizeof(std::int64_t) + 2 + in.slices.size() * (sizeof(std::uint8_t) + sim::summary::Slice::size * sizeof(double)));
+
+  buffer.write(in.newest_start_ms);
+  buffer.write_varint(in.slices.size());
+  for (auto const& slice : in.slices) {
+    std::uint8_t set = 0;
+    for (std::size_t i = 0; i < sim::summary::Slice::size; ++i) {
+      if (slice[static_cast<sim::summary::Field>(i)] != 0) {
+        set |= static_cast<std::uint8_t>(1 << i);
+      }
+    }
+    buffer.write(set);
+    for (std::size_t i = 0; i < sim::summary::Slice::size; ++i) {
+      if ((set & (1 << i)) != 0) {
+        buffer.write(slice[static_cast<sim::summary::Field>(i)]);
+      }
+    }
+  }
+}
+
+void logged::deserialize(std::span<const std::byte> in, sim::summary::Summary& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("deserialize summary");
+  out = sim::summary::Summary{};
+  if (in.empty()) {
+    return;
+  }
+
+  serialize::Read_buffer buffer{ in };
+  if (buffer.size() < sizeof(std::int64_t) + 1) {
+    throw std::runtime_error{ "Summary cut short" };
+  }
+  out.newest_start_ms = buffer.read<std::int64_t>();
+  const auto count = buffer.read_varint();
+  //every slice is at least its set byte
+  if (count > buffer.size()) {
+    throw std::runtime_error{ "Summary cut short" };
+  }
+  out.slices.resize(static_cast<std::size_t>(count));
+  for (auto& slice : out.slices) {
+    if (buffer.empty()) {
+      throw std::runtime_error{ "Summary cut short" };
+    }
+    const auto set = buffer.read<std::uint8_t>();
+    if (buffer.size() < static_cast<std::size_t>(std::popcount(set)) * sizeof(double)) {
+      throw std::runtime_error{ "Summary cut short" };
+    }
+    for (std::size_t i = 0; i < sim::summary::Slice::size; ++i) {
+      if ((set & (1 << i)) != 0) {
+        slice[static_cast<sim::summary::Field>(i)] = buffer.read<double>();
+      }
+    }
+  }
+}
@@ -0,0 +1,140 @@
+#include <prescience_helper/logged_writer.hpp>
+
+namespace {
+  //adds how long doing takes to into, so Stats only counts time spent in sqlite and not whatever
+  //the caller does while the transaction is open
+  template<typename F>
+  void timed(std::chrono::steady_clock::duration& into, F&& doing) {
+    const auto start = std::chrono::steady_clock::now();
+    doing();
+    into += std::chrono::steady_clock::now() - start;
+  }
+}
+
+double prescience_helper::Logged_writer::Stats::rows_per_second() const noexcept {
+  const auto seconds = std::chrono::duration<double>(active).count();
+  if (seconds <= 0) {
+    return 0;
+  }
+  return rows / seconds;
+}
+
+prescience_helper::Logged_writer::Logged_writer(Db const& db) :
+  Logged_writer(db, Flush_policy{}) {
+
+}
+
+prescience_helper::Logged_writer::Logged_writer(Db const& db, Flush_policy policy) :
+  db_(db),
+  policy_(policy),
+  find_player_stmt_(db.prepare("SELECT id FROM Player WHERE blizz_guid = ?;")),
+  insert_player_stmt_(db.prepare("INSERT INTO Player (blizz_guid) VALUES (?);")),
+  insert_logged_stmt_(db.prepare("INSERT INTO Logged (player,spec,encounter,damage,stats,deaths,rezzes) VALUES (?,?,?,?,?,?,?);")) {
+
+  db_.exec<std::int64_t, std::string_view>("SELECT id,blizz_guid FROM Player;", [this](std::int64_t id, std::string_view guid) {
+    player_ids_.emplace(std::string{ guid }, id);
+    });
+}
+
+void prescience_helper::Logged_writer::begin() {
+  if (in_transaction_) {
+    return;
+  }
+  timed(stats_.active, [this]() { db_.begin(); });
+  in_transaction_ = true;
+  transaction_start_ = std::chrono::steady_clock::now();
+}
+
+std::int64_t prescience_helper::Logged_writer::player_id(std::string_view blizz_guid) {
+  if (const auto found = player_ids_.find(blizz_guid); found != player_ids_.end()) {
+    return found->second;
+  }
+
+  //someone else may have added them since we loaded our cache
+  std::optional<std::int64_t> id;
+  timed(stats_.active, [&]() {
+    find_player_stmt_.exec<std::int64_t>([&id](std::int64_t found) {
+      id = found;
+      }, blizz_guid);
+    });
+
+  if (!id) {
+    begin();
+    timed(stats_.active, [&]() {
+      insert_player_stmt_.exec([]() {}, blizz_guid);
+      id = db_.last_insert_rowid();
+      });
+    uncommitted_players_.emplace_back(blizz_guid);
+  }
+
+  player_ids_.emplace(std::string{ blizz_guid }, *id);
+  return *id;
+}
+
+void prescience_helper::Logged_writer::insert_logged(std::int64_t player, std::int32_t spec, std::int64_t encounter,
+  std::span<const std::byte> damage,
+  std::span<const std::byte> stats,
+  std::span<const std::byte> deaths,
+  std::span<const std::byte> rezzes) {
+
+  begin();
+  timed(stats_.active, [&]() {
+    insert_logged_stmt_.exec([]() {},
+      player, spec, encounter,
+      Static_blob{ damage }, Static_blob{ stats }, Static_blob{ deaths }, Static_blob{ rezzes });
+    });
+  ++pending_rows_;
+}
+
+std::size_t prescience_helper::Logged_writer::end_encounter() {
+  ++pending_encounters_;
+  if (should_flush_()) {
+    return flush();
+  }
+  return 0;
+}
+
+std::size_t prescience_helper::Logged_writer::flush() {
+  if (!in_transaction_) {
+    return 0;
+  }
+  timed(stats_.active, [this]() { db_.commit(); });
+  in_transaction_ = false;
+
+  const auto committed = pending_encounters_;
+
+  stats_.rows += pending_rows_;
+  stats_.encounters += pending_encounters_;
+  stats_.commits += 1;
+
+  pending_rows_ = 0;
+  pending_encounters_ = 0;
+  uncommitted_players_.clear();
+
+  return committed;
+}
+
+void prescience_helper::Logged_writer::rollback() {
+  if (!in_transaction_) {
+    return;
+  }
+  db_.rollback();
+  in_transaction_ = false;
+
+  //these ids don't exist anymore
+  for (auto const& guid : uncommitted_players_) {
+    if (const auto found = player_ids_.find(guid); found != player_ids_.end()) {
+      player_ids_.erase(found);
+    }
+  }
+
+  pending_rows_ = 0;
+  pending_encounters_ = 0;
+  uncommitted_players_.clear();
+}
+
+bool prescience_helper::Logged_writer::should_flush_() const noexcept {
+  return pending_rows_ >= policy_.max_rows
+    || pending_encounters_ >= policy_.max_encounters
+    || (std::chrono::steady_clock::now() - transaction_start_) >= policy_.max_age;
+}
@@ -0,0 +1,285 @@
+#include <prescience_helper/migrations.hpp>
+#include <prescience_helper/blob_codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <string>
+
+namespace migrations = prescience_helper::migrations;
+
+namespace {
+  constexpr std::int32_t UNVERSIONED_DB_VERSION = 2;
+  constexpr std::int64_t REENCODE_BATCH_SIZE = 512;
+
+  //Configs row that lets us resume a re-encode after being closed part way through
+  constexpr std::string_view POSITION_CONFIG = "migration_position";
+
+  const std::vector<migrations::Migration>& all_migrations() {
+    static const std::vector<migrations::Migration> returning{
+      migrations::Migration{
+        2,
+        "Adding indexes",
+        //older versions could add a player twice, their rows go to the first one so the unique index can be made
+        "UPDATE Logged SET player = (SELECT MIN(Kept.id) FROM Player INNER JOIN Player AS Kept ON Kept.blizz_guid = Player.blizz_guid"
+        " WHERE Player.id = Logged.player)"
+        " WHERE player NOT IN (SELECT MIN(id) FROM Player GROUP BY blizz_guid);"
+        "DELETE FROM Player WHERE id NOT IN (SELECT MIN(id) FROM Player GROUP BY blizz_guid);"
+        "CREATE UNIQUE INDEX IF NOT EXISTS Player_blizz_guid ON Player(blizz_guid);"
+        "CREATE INDEX IF NOT EXISTS Logged_player_spec_encounter ON Logged(player, spec, encounter);"
+        "CREATE INDEX IF NOT EXISTS Encounter_type_difficulty_start_time ON Encounter(type, difficulty, start_time, patch, duration_ms);",
+        nullptr
+      },
+      migrations::Migration{
+        3,
+        "Adding codec headers to stored data",
+        "DELETE FROM Configs WHERE name IN ('damage_codec','stats_codec','deaths_codec','rezzes_codec');"
+        "INSERT INTO Configs(name,value) VALUES"
+        " ('damage_codec','zstd'),"
+        " ('stats_codec','zstd'),"
+        " ('deaths_codec','raw'),"
+        " ('rezzes_codec','raw');",
+        [](migrations::Blob_column, std::span<const std::byte> in, std::vector<std::byte>& out) {
+          //leave these uncompressed, they'll be compressed as they're rewritten
+          prescience_helper::blob_codec::encode(prescience_helper::blob_codec::Codec::raw, prescience_helper::blob_codec::FORMAT_FIXED_WIDTH, in, out);
+        }
+      },
+      migrations::Migration{
+        4,
+        "Adding pull summaries",
+        //filled in by summaries::ensure_current once we're migrated
+        "CREATE TABLE IF NOT EXISTS Summary("
+        " player INTEGER NOT NULL,"
+        " spec INT NOT NULL,"
+        " type INTEGER NOT NULL,"
+        " difficulty INTEGER NOT NULL,"
+        " summary BLOB NOT NULL,"
+        " PRIMARY KEY(player, spec, type, difficulty),"
+        " FOREIGN KEY(player) REFERENCES Player(id),"
+        " FOREIGN KEY(type) REFERENCES Encounter_type(id),"
+        " FOREIGN KEY(difficulty) REFERENCES Difficulty(id));"
+        "DELETE FROM Configs WHERE name IN ('summary_half_life_days','summary_codec');"
+        "INSERT INTO Configs(name,value) VALUES"
+        " ('summary_half_life_days','14'),"
+        " ('summary_codec','zstd');",
+        nullptr
+      },
+      migrations::Migration{
+        5,
+        "Deferring encounters from newer patches",
+        //logs we stopped marking as read because of them are read once more, and their encounters deferred then
+        "CREATE TABLE IF NOT EXISTS Deferred_encounter("
+        " path TEXT NOT NULL,"
+        " start_byte INTEGER NOT NULL,"
+        " end_byte INTEGER NOT NULL,"
+        " expac INTEGER NOT NULL,"
+        " patch INTEGER NOT NULL,"
+        " minor INTEGER NOT NULL,"
+        " PRIMARY KEY(path, start_byte));",
+        nullptr
+      },
+      migrations::Migration{
+        6,
+        "Indexing stored data by encounter",
+        "CREATE INDEX IF NOT EXISTS Logged_encounter ON Logged(encounter);",
+        nullptr
+      },
+      migrations::Migration{
+        7,
+        "Tracking pulls to simulate again",
+        "CREATE TABLE IF NOT EXISTS Pending_resimulation("
+        " encounter INTEGER NOT NULL PRIMARY KEY,"
+        " FOREIGN KEY(encounter) REFERENCES Encounter(id));",
+        nullptr
+      },
+    };
+    return returning;
+  }
+
+  std::optional<std::int32_t> to_int(std::string_view in) {
+    std::int32_t returning = 0;
+    const auto res = std::from_chars(in.data(), in.data() + in.size(), returning);
+    if (res.ec != std::errc() || res.ptr != in.data() + in.size()) {
+      return std::nullopt;
+    }
+    return returning;
+  }
+
+  struct Position {
+    std::int32_t to;
+    std::int64_t last_id;
+  };
+
+  std::optional<Position> get_position(prescience_helper::Db const& db) {
+    std::optional<Position> returning;
+    db.exec<std::string_view>("SELECT value FROM Configs WHERE name = ?;", [&returning](std::string_view value) {
+      const auto colon = value.find(':');
+      if (colon == std::string_view::npos) {
+        return;
+      }
+      const auto to = to_int(value.substr(0, colon));
+      std::int64_t last_id = 0;
+      const auto last_id_str = value.substr(colon + 1);
+      if (!to || std::from_chars(last_id_str.data(), last_id_str.data() + last_id_str.size(), last_id).ec != std::errc()) {
+        return;
+      }
+      returning = Position{ *to, last_id };
+      }, POSITION_CONFIG);
+    return returning;
+  }
+
+  void set_config(prescience_helper::Db const& db, std::string_view name, std::string const& value) {
+    db.exec("DELETE FROM Configs WHERE name = ?;", []() {}, name);
+    db.exec("INSERT INTO Configs(name,value) VALUES (?,?);", []() {}, name, std::string_view{ value });
+  }
+
+  void set_position(prescience_helper::Db const& db, Position position) {
+    set_config(db, POSITION_CONFIG, std::to_string(position.to) + ':' + std::to_string(position.last_id));
+  }
+
+  std::uint64_t count(prescience_helper::Db const& db, std::string const& query) {
+    std::uint64_t returning = 0;
+    db.exec<std::int64_t>(query, [&returning](std::int64_t got) {
+      returning = static_cast<std::uint64_t>(got);
+      });
+    return returning;
+  }
+
+  void reencode(prescience_helper::Db const& db, migrations::Migration const& migration, std::int32_t to, std::int64_t start_after,
+    std::function<void(migrations::Progress const&)> const& progress) {
+
+    struct Row {
+      std::int64_t id;
+      std::array<std::optional<std::vector<std::byte>>, 4> blobs;
+    };
+
+    const std::uint64_t total = count(db, "SELECT COUNT(1) FROM Logged;");
+    std::uint64_t done = count(db, "SELECT COUNT(1) FROM Logged WHERE id <= " + std::to_string(start_after) + ";");
+
+    const auto select_stmt = db.prepare("SELECT id,damage,stats,deaths,rezzes FROM Logged WHERE id > ? ORDER BY id LIMIT ?;");
+    const auto update_stmt = db.prepare("UPDATE Logged SET damage = ?, stats = ?, deaths = ?, rezzes = ? WHERE id = ?;");
+
+    std::vector<Row> batch;
+    std::array<std::vector<std::byte>, 4> encoded;
+    std::int64_t last_id = start_after;
+
+    for (;;) {
+      batch.clear();
+      select_stmt.exec<std::int64_t, std::optional<std::span<const std::byte>>, std::optional<std::span<const std::byte>>, std::optional<std::span<const std::byte>>, std::optional<std::span<const std::byte>>>(
+        [&batch](std::int64_t id, auto damage, auto stats, auto deaths, auto rezzes) {
+          Row adding{ id };
+          const std::array<std::optional<std::span<const std::byte>>, 4> columns{ damage, stats, deaths, rezzes };
+          for (std::size_t i = 0; i < columns.size(); ++i) {
+            if (columns[i]) {
+              adding.blobs[i].emplace(columns[i]->begin(), columns[i]->end());
+            }
+          }
+          batch.push_back(std::move(adding));
+        }, last_id, REENCODE_BATCH_SIZE);
+
+      if (batch.empty()) {
+        return;
+      }
+
+      db.begin();
+      for (auto const& row : batch) {
+        std::array<std::optional<std::span<const std::byte>>, 4> binding;
+        for (std::size_t i = 0; i < row.blobs.size(); ++i) {
+          if (row.blobs[i]) {
+            encoded[i].clear();
+            migration.reencode(static_cast<migrations::Blob_column>(i), *row.blobs[i], encoded[i]);
+            binding[i] = encoded[i];
+          }
+        }
+        update_stmt.exec([]() {}, binding[0], binding[1], binding[2], binding[3], row.id);
+      }
+      last_id = batch.back().id;
+      set_position(db, Position{ to, last_id });
+      db.commit();
+
+      done += batch.size();
+      if (progress) {
+        progress(migrations::Progress{ &migration, migration.from, to, done, total });
+      }
+    }
+  }
+}
+
+std::optional<std::int32_t> migrations::version(Db const& db) {
+  std::optional<std::int32_t> returning;
+  bool found = false;
+  db.exec<std::string_view>("SELECT value FROM Configs WHERE name='version';", [&returning, &found](std::string_view value) {
+    found = true;
+    returning = to_int(value);
+    });
+  if (!found) {
+    return UNVERSIONED_DB_VERSION;
+  }
+  return returning;
+}
+
+migrations::Result migrations::migrate(Db const& db, std::int32_t to, std::function<void(Progress const&)> const& progress) {
+  const auto current = version(db);
+  if (!current) {
+    return Result::no_path;
+  }
+  if (*current > to) {
+    return Result::too_new;
+  }
+
+  //check we can get all the way there before touching anything
+  for (std::int32_t checking = *current; checking < to; ++checking) {
+    const auto found = std::find_if(all_migrations().begin(), all_migrations().end(), [checking](Migration const& m) {
+      return m.from == checking;
+      });
+    if (found == all_migrations().end()) {
+      return Result::no_path;
+    }
+  }
+
+  for (std::int32_t at = *current; at < to; ++at) {
+    Migration const& migration = *std::find_if(all_migrations().begin(), all_migrations().end(), [at](Migration const& m) {
+      return m.from == at;
+      });
+
+    if (progress) {
+      progress(Progress{ &migration, at, at + 1, 0, 0 });
+    }
+
+    auto position = get_position(db);
+    if (!position || position->to != at + 1) {
+      db.begin();
+      if (!db.exec_script(migration.schema)) {
+        db.rollback();
+        return Result::failed;
+      }
+      position = Position{ at + 1, 0 };
+      set_position(db, *position);
+      db.commit();
+    }
+
+    if (migration.reencode) {
+      reencode(db, migration, at + 1, position->last_id, progress);
+    }
+
+    db.begin();
+    if (!migration.resimulate_where.empty()) {
+      const auto before = count(db, "SELECT COUNT(1) FROM Pending_resimulation;");
+      //only marks them, the logs they came from may be long gone so nothing is deleted or reread
+      if (!db.exec_script("INSERT OR IGNORE INTO Pending_resimulation(encounter) SELECT DISTINCT encounter FROM Logged WHERE "
+        + std::string{ migration.resimulate_where } + ";")) {
+        db.rollback();
+        return Result::failed;
+      }
+      if (progress) {
+        const auto marked = count(db, "SELECT COUNT(1) FROM Pending_resimulation;") - before;
+        progress(Progress{ &migration, at, at + 1, marked, marked });
+      }
+    }
+    set_config(db, "version", std::to_string(at + 1));
+    db.exec("DELETE FROM Configs WHERE name = ?;", []() {}, POSITION_CONFIG);
+    db.commit();
+  }
+
+  return Result::success;
+}
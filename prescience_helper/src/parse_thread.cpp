@@ -0,0 +1,141 @@
+#include <prescience_helper/parse_thread.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <chrono>
+
+prescience_helper::Parse_thread::Parse_thread(std::filesystem::path base, Db db) :
+  db_(std::move(db)),
+  log_finder(base),
+  base(base),
+  reporter_(progress_),
+  store_(db_),
+  preparer_([this]() {
+    auto config = load_ingest_config(db_);
+    config.stored = store_.stored();
+    return config;
+    }()) {
+
+  preparer_.report_to(&reporter_);
+}
+
+void prescience_helper::Parse_thread::change_finder_base(std::filesystem::path new_base) {
+  std::lock_guard lock{ mutex_ };
+  base = std::move(new_base);
+}
+
+void prescience_helper::Parse_thread::check_if_finder_base_should_change() {
+  std::lock_guard lock{ mutex_ };
+  if (base != log_finder.path()) {
+    log_finder.change_path(base);
+  }
+}
+
+bool prescience_helper::Parse_thread::check_if_should_stop(std::uint32_t add_encounters_stored) {
+  reporter_.add_stored(add_encounters_stored, store_.writer().stats().rows_per_second());
+  //only a new boss needs the lock, which is a handful of times per log at most
+  if (store_.has_new_encounter_types()) {
+    std::lock_guard lock{ mutex_ };
+    store_.take_new_encounter_types(thread_activity_.new_encounter_ids);
+  }
+  return should_stop.load(std::memory_order_relaxed);
+}
+
+void prescience_helper::Parse_thread::stop() {
+  should_stop.store(true, std::memory_order_relaxed);
+}
+
+prescience_helper::Thread_activity prescience_helper::Parse_thread::get_thread_activity() {
+  std::lock_guard lock{ mutex_ };
+  auto returning{ std::move(thread_activity_) };
+  thread_activity_.clear();
+  thread_activity_.memory_high_water = returning.memory_high_water;
+  returning.progress = progress::drain(progress_);
+  return returning;
+}
+
+void prescience_helper::Parse_thread::run(Parse_thread* state) {
+  trace::name_thread("parse thread");
+  std::vector<Log_finder::Log> logs;
+  Prepared_log prepared;
+  Prepared_encounter encounter;
+  auto& reporter = state->reporter_;
+
+  //false if we should stop
+  const auto read = [state, &prepared, &encounter, &reporter]() {
+    state->preparer_.open(prepared);
+
+    while (state->preparer_.next(prepared, encounter)) {
+      reporter.stage(progress::Stage::storing);
+      if (state->check_if_should_stop(state->store_.store(encounter))) {
+        state->store_.writer().flush();
+        return false;
+      }
+    }
+
+    state->store_.finish_log(prepared, state->log_finder);
+
+    std::lock_guard lock{ state->mutex_ };
+    state->thread_activity_.memory_high_water.high_water(prepared.memory_usage);
+    return true;
+  };
+
+  //encounters deferred until we could simulate their patch, only ever more of them after an update
+  auto rereads = load_ready_deferred(state->db_);
+  if (!rereads.empty()) {
+    std::uint64_t backlog = 0;
+    for (auto const& reread : rereads) {
+      backlog += reread.log.new_total - reread.log.old_useful;
+    }
+    reporter.add_backlog(backlog);
+
+    for (auto& reread : rereads) {
+      prepared = std::move(reread);
+      if (!read()) {
+        return;
+      }
+    }
+
+    reporter.stage(progress::Stage::committing);
+    if (state->check_if_should_stop(state->store_.writer().flush())) {
+      return;
+    }
+  }
+
+  for (;;) {
+    logs.clear();
+
+    reporter.stage(progress::Stage::finding_logs);
+    state->check_if_finder_base_should_change();
+    state->log_finder.check(logs);
+
+    if (state->check_if_should_stop()) {
+      return;
+    }
+
+    if (logs.empty()) {
+      reporter.stage(progress::Stage::idle);
+      std::this_thread::sleep_for(std::chrono::milliseconds{ 500 });
+      continue;
+    }
+
+    std::uint64_t backlog = 0;
+    for (auto const& log : logs) {
+      if (log.new_total > log.old_useful) {
+        backlog += log.new_total - log.old_useful;
+      }
+    }
+    reporter.add_backlog(backlog);
+
+    for (auto& log : logs) {
+      prepared = Prepared_log{ std::move(log) };
+      if (!read()) {
+        return;
+      }
+    }
+
+    reporter.stage(progress::Stage::committing);
+    if (state->check_if_should_stop(state->store_.writer().flush())) {
+      return;
+    }
+  }
+}
@@ -0,0 +1,314 @@
+#include <prescience_helper/payload.hpp>
+#include <prescience_helper/serialize.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace payload = prescience_helper::payload;
+
+namespace {
+  constexpr std::size_t MAX_CODE_LENGTH = 12;
+  constexpr std::uint8_t V2_END_OF_RAIDER = std::numeric_limits<std::uint8_t>::max();
+
+  constexpr std::array<std::uint8_t, 256> CODE_LENGTHS = []() {
+    std::array<std::uint8_t, 256> returning{};
+    for (std::size_t i = 0; i < returning.size(); ++i) {
+      if (i == 0) {
+        returning[i] = 2;
+      } else if (i < 4) {
+        returning[i] = 3;
+      } else if (i < 12) {
+        returning[i] = 5;
+      } else if (i < 44) {
+        returning[i] = 9;
+      } else {
+        returning[i] = 12;
+      }
+    }
+    return returning;
+  }();
+
+  struct Prefix_code {
+    std::array<std::uint16_t, 256> codes{};
+    //per length, the first code, how many codes and where they start in symbols
+    std::array<std::uint32_t, MAX_CODE_LENGTH + 1> first_code{};
+    std::array<std::uint32_t, MAX_CODE_LENGTH + 1> count{};
+    std::array<std::uint32_t, MAX_CODE_LENGTH + 1> first_symbol{};
+    //ordered by length, then value
+    std::array<std::uint8_t, 256> symbols{};
+  };
+
+  constexpr Prefix_code PREFIX_CODE = []() {
+    Prefix_code returning;
+    for (const auto length : CODE_LENGTHS) {
+      ++returning.count[length];
+    }
+
+    std::uint32_t code = 0;
+    std::uint32_t symbol = 0;
+    std::uint64_t kraft = 0;
+    for (std::size_t length = 1; length <= MAX_CODE_LENGTH; ++length) {
+      code = (code + returning.count[length - 1]) << 1;
+      returning.first_code[length] = code;
+      returning.first_symbol[length] = symbol;
+      symbol += returning.count[length];
+      kraft += static_cast<std::uint64_t>(returning.count[length]) << (MAX_CODE_LENGTH - length);
+    }
+    if (kraft > (1u << MAX_CODE_LENGTH)) {
+      throw "code lengths don't make a prefix code";
+    }
+
+    std::array<std::uint32_t, MAX_CODE_LENGTH + 1> next_code = returning.first_code;
+    std::array<std::uint32_t, MAX_CODE_LENGTH + 1> next_symbol = returning.first_symbol;
+    for (std::size_t i = 0; i < CODE_LENGTHS.size(); ++i) {
+      const auto length = CODE_LENGTHS[i];
+      returning.codes[i] = static_cast<std::uint16_t>(next_code[length]++);
+      returning.symbols[next_symbol[length]++] = static_cast<std::uint8_t>(i);
+    }
+    return returning;
+  }();
+
+  void encode_v2(payload::Payload const& in, std::vector<std::byte>& out) {
+    prescience_helper::serialize::Write_buffer writing{ out };
+    writing.write(in.window_size, static_cast<std::uint8_t>(in.raiders.size()));
+    for (auto const& raider : in.raiders) {
+      writing.write(raider.server_id, raider.player_uid);
+      std::int64_t prev_index = -1;
+      for (auto const& window : raider.windows) {
+        auto delta = window.index - prev_index;
+        //long gaps are split over several copies of the window, the addon treats them as one
+        do {
+          const auto ours = std::min<std::int64_t>(delta, std::numeric_limits<std::uint8_t>::max());
+          writing.write(
+            static_cast<std::uint8_t>(ours - 1),
+            window.base,
+            window.ebon_might,
+            window.prescience,
+            window.shifting_sands);
+          delta -= ours;
+        } while (delta > std::numeric_limits<std::uint8_t>::max());
+        prev_index = window.index;
+      }
+      writing.write(V2_END_OF_RAIDER);
+    }
+  }
+
+  void encode_v3_body(payload::Payload const& in, std::vector<std::byte>& out) {
+    prescience_helper::serialize::Write_buffer writing{ out };
+    writing.write(in.window_size, static_cast<std::uint8_t>(in.raiders.size()));
+    for (auto const& raider : in.raiders) {
+      writing.write(raider.server_id, raider.player_uid);
+      writing.write_varint(raider.windows.size());
+      std::int64_t prev_index = -1;
+      payload::Window prev{ 0, 0, 0, 0, 0 };
+      for (auto const& window : raider.windows) {
+        writing.write_varint(static_cast<std::uint64_t>(window.index - prev_index - 1));
+        writing.write_zigzag(static_cast<std::int64_t>(window.base) - prev.base);
+        writing.write_zigzag(static_cast<std::int64_t>(window.ebon_might) - prev.ebon_might);
+        writing.write_zigzag(static_cast<std::int64_t>(window.prescience) - prev.prescience);
+        writing.write_zigzag(static_cast<std::int64_t>(window.shifting_sands) - prev.shifting_sands);
+        prev_index = window.index;
+        prev = window;
+      }
+    }
+  }
+
+  void prefix_code(std::span<const std::byte> in, std::vector<std::byte>& out) {
+    std::uint64_t bits = 0;
+    std::size_t bit_count = 0;
+    for (const auto byte : in) {
+      const auto symbol = static_cast<std::uint8_t>(byte);
+      bits = (bits << CODE_LENGTHS[symbol]) | PREFIX_CODE.codes[symbol];
+      bit_count += CODE_LENGTHS[symbol];
+      while (bit_count >= 8) {
+        bit_count -= 8;
+        out.push_back(static_cast<std::byte>((bits >> bit_count) & 0xFF));
+      }
+    }
+    if (bit_count != 0) {
+      out.push_back(static_cast<std::byte>((bits << (8 - bit_count)) & 0xFF));
+    }
+  }
+
+  //in is moved past the bytes the code used
+  bool prefix_decode(std::span<const std::byte>& in, std::size_t count, std::vector<std::byte>& out) {
+    std::size_t bit = 0;
+    const std::size_t total_bits = in.size() * 8;
+    out.reserve(out.size() + count);
+    for (std::size_t i = 0; i < count; ++i) {
+      std::uint32_t code = 0;
+      std::size_t length = 0;
+      for (;;) {
+        if (bit == total_bits || length == MAX_CODE_LENGTH) {
+          return false;
+        }
+        code = (code << 1) | ((static_cast<std::uint32_t>(in[bit / 8]) >> (7 - bit % 8)) & 1);
+        ++bit;
+        ++length;
+        if (code - PREFIX_CODE.first_code[length] < PREFIX_CODE.count[length]) {
+          out.push_back(static_cast<std::byte>(PREFIX_CODE.symbols[PREFIX_CODE.first_symbol[length] + code - PREFIX_CODE.first_code[length]]));
+          break;
+        }
+      }
+    }
+    in = in.subspan((bit + 7) / 8);
+    return true;
+  }
+
+  //ascii85 zero pads the payload to a multiple of 4 bytes
+  bool only_padding(std::span<const std::byte> left) noexcept {
+    return left.size() < 4 && std::all_of(left.begin(), left.end(), [](std::byte b) { return b == std::byte{ 0 }; });
+  }
+
+  //Read_buffer asserts rather than failing, so every read is checked against what's left first
+  struct Checked_reader {
+    std::span<const std::byte> left;
+
+    template<typename T>
+    bool read(T& out) {
+      if (left.size() < sizeof(T)) {
+        return false;
+      }
+      prescience_helper::serialize::Read_buffer reading{ left };
+      out = reading.read<T>();
+      left = left.subspan(sizeof(T));
+      return true;
+    }
+
+    bool read_varint(std::uint64_t& out) {
+      out = 0;
+      for (std::size_t shift = 0; shift < 64; shift += 7) {
+        if (left.empty()) {
+          return false;
+        }
+        const auto byte = static_cast<std::uint64_t>(left.front());
+        left = left.subspan(1);
+        out |= (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    template<typename T>
+    bool read_delta(T prev, T& out) {
+      std::uint64_t raw;
+      if (!read_varint(raw)) {
+        return false;
+      }
+      const auto delta = static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+      const auto val = static_cast<std::int64_t>(prev) + delta;
+      if (val < std::numeric_limits<T>::min() || val > std::numeric_limits<T>::max()) {
+        return false;
+      }
+      out = static_cast<T>(val);
+      return true;
+    }
+  };
+}
+
+std::optional<payload::Version> payload::parse_version(std::string_view version) noexcept {
+  if (version == "2") {
+    return Version::v2;
+  } else if (version == "3") {
+    return Version::v3;
+  }
+  return std::nullopt;
+}
+
+std::string_view payload::version_prefix(Version version) noexcept {
+  switch (version) {
+  case Version::v2:
+    return "2?";
+  default:
+    return "3?";
+  }
+}
+
+void payload::encode(Version version, Payload const& payload, std::vector<std::byte>& out) {
+  if (version == Version::v2) {
+    encode_v2(payload, out);
+    return;
+  }
+
+  std::vector<std::byte> body;
+  encode_v3_body(payload, body);
+
+  std::vector<std::byte> coded;
+  serialize::Write_buffer coded_writer{ coded };
+  coded_writer.write_varint(body.size());
+  prefix_code(body, coded);
+
+  //only prefix coded if that's actually smaller
+  serialize::Write_buffer writing{ out };
+  if (coded.size() < body.size()) {
+    writing.write(FLAG_PREFIX_CODED);
+    out.insert(out.end(), coded.begin(), coded.end());
+  } else {
+    writing.write(std::uint8_t{ 0 });
+    out.insert(out.end(), body.begin(), body.end());
+  }
+}
+
+bool payload::decode_v3(std::span<const std::byte> in, Payload& out) {
+  Checked_reader reading{ in };
+  std::uint8_t flags;
+  if (!reading.read(flags)) {
+    return false;
+  }
+
+  const bool prefix_coded = (flags & FLAG_PREFIX_CODED) != 0;
+  std::vector<std::byte> decoded;
+  if (prefix_coded) {
+    std::uint64_t body_size;
+    //every byte is at least 2 bits
+    if (!reading.read_varint(body_size) || body_size > reading.left.size() * 4) {
+      return false;
+    }
+    if (!prefix_decode(reading.left, static_cast<std::size_t>(body_size), decoded) || !only_padding(reading.left)) {
+      return false;
+    }
+    reading.left = decoded;
+  }
+
+  std::uint8_t raider_count;
+  if (!reading.read(out.window_size) || !reading.read(raider_count)) {
+    return false;
+  }
+  out.raiders.clear();
+  out.raiders.resize(raider_count);
+  for (auto& raider : out.raiders) {
+    std::uint64_t window_count;
+    if (!reading.read(raider.server_id) || !reading.read(raider.player_uid) || !reading.read_varint(window_count)) {
+      return false;
+    }
+    //every window is at least 5 bytes
+    if (window_count > reading.left.size() / 5) {
+      return false;
+    }
+    raider.windows.resize(static_cast<std::size_t>(window_count));
+    std::int64_t prev_index = -1;
+    Window prev{ 0, 0, 0, 0, 0 };
+    for (auto& window : raider.windows) {
+      std::uint64_t index_delta;
+      if (!reading.read_varint(index_delta)
+        || index_delta > static_cast<std::uint64_t>(std::numeric_limits<std::int32_t>::max())
+        || !reading.read_delta(prev.base, window.base)
+        || !reading.read_delta(prev.ebon_might, window.ebon_might)
+        || !reading.read_delta(prev.prescience, window.prescience)
+        || !reading.read_delta(prev.shifting_sands, window.shifting_sands)) {
+        return false;
+      }
+      window.index = prev_index + 1 + static_cast<std::int64_t>(index_delta);
+      prev_index = window.index;
+      prev = window;
+    }
+  }
+  return prefix_coded ? reading.left.empty() : only_padding(reading.left);
+}
+
+std::span<const std::uint8_t, 256> payload::prefix_code_lengths() noexcept {
+  return CODE_LENGTHS;
+}
@@ -0,0 +1,127 @@
+#include <prescience_helper/progress.hpp>
+#include <prescience_helper/memory.hpp>
+
+#include <algorithm>
+#include <cstdio>
+
+namespace progress = prescience_helper::progress;
+
+namespace {
+  //how much of a rate is the newest update, so one slow chunk doesn't swing the ETA around
+  constexpr double RATE_SMOOTHING = 0.5;
+
+  double smoothed(double previous, double now) {
+    if (previous == 0) {
+      return now;
+    }
+    return previous + (now - previous) * RATE_SMOOTHING;
+  }
+
+  std::string format_duration(std::chrono::seconds duration) {
+    const auto hours = std::chrono::duration_cast<std::chrono::hours>(duration);
+    const auto minutes = std::chrono::duration_cast<std::chrono::minutes>(duration - hours);
+    const auto seconds = duration - hours - minutes;
+    char buffer[32];
+    if (hours.count() != 0) {
+      std::snprintf(buffer, sizeof(buffer), "%lldh%02lldm", static_cast<long long>(hours.count()), static_cast<long long>(minutes.count()));
+    } else if (minutes.count() != 0) {
+      std::snprintf(buffer, sizeof(buffer), "%lldm%02llds", static_cast<long long>(minutes.count()), static_cast<long long>(seconds.count()));
+    } else {
+      std::snprintf(buffer, sizeof(buffer), "%llds", static_cast<long long>(seconds.count()));
+    }
+    return buffer;
+  }
+}
+
+std::optional<progress::Snapshot> progress::drain(Channel& channel) noexcept {
+  std::optional<Snapshot> returning;
+  while (auto popped = channel.pop()) {
+    returning = *popped;
+  }
+  return returning;
+}
+
+void progress::Reporter::stage(Stage stage) noexcept {
+  if (current_.stage == stage && !pending_) {
+    return;
+  }
+  current_.stage = stage;
+  publish_();
+}
+
+void progress::Reporter::add_backlog(std::uint64_t bytes) noexcept {
+  current_.backlog_bytes += bytes;
+  publish_();
+}
+
+void progress::Reporter::start_log(std::uint64_t bytes_total) noexcept {
+  current_.log_bytes_read = 0;
+  current_.log_bytes_total = bytes_total;
+  publish_();
+}
+
+void progress::Reporter::add_read(std::uint64_t bytes, std::uint64_t lines) noexcept {
+  current_.bytes_read += bytes;
+  current_.log_bytes_read += bytes;
+  current_.lines_read += lines;
+  publish_();
+}
+
+void progress::Reporter::add_found(std::uint64_t encounters) noexcept {
+  current_.encounters_found += encounters;
+  publish_();
+}
+
+void progress::Reporter::add_stored(std::uint64_t encounters, double rows_per_second) noexcept {
+  if (encounters == 0 && !pending_) {
+    return;
+  }
+  current_.encounters_stored += encounters;
+  current_.rows_per_second = rows_per_second;
+  publish_();
+}
+
+void progress::Meter::update(Snapshot const& latest, Clock::time_point now) noexcept {
+  if (at_) {
+    const double seconds = std::chrono::duration<double>(now - *at_).count();
+    if (seconds <= 0) {
+      latest_ = latest;
+      return;
+    }
+    bytes_per_second_ = smoothed(bytes_per_second_, (latest.bytes_read - latest_.bytes_read) / seconds);
+    lines_per_second_ = smoothed(lines_per_second_, (latest.lines_read - latest_.lines_read) / seconds);
+  }
+  latest_ = latest;
+  at_ = now;
+}
+
+std::optional<std::chrono::seconds> progress::Meter::eta() const noexcept {
+  if (latest_.bytes_read >= latest_.backlog_bytes) {
+    return std::chrono::seconds{ 0 };
+  }
+  if (bytes_per_second_ <= 0) {
+    return std::nullopt;
+  }
+  return std::chrono::seconds{ static_cast<std::int64_t>((latest_.backlog_bytes - latest_.bytes_read) / bytes_per_second_) };
+}
+
+std::string progress::describe(Meter const& meter) {
+  auto const& latest = meter.latest();
+
+  char buffer[128];
+  std::snprintf(buffer, sizeof(buffer), "%s/s, %.0f lines/s, %llu encounter(s) found, %llu stored",
+    memory::format_bytes(static_cast<std::size_t>(meter.bytes_per_second())).c_str(),
+    meter.lines_per_second(),
+    static_cast<unsigned long long>(latest.encounters_found),
+    static_cast<unsigned long long>(latest.encounters_stored));
+  std::string returning{ buffer };
+
+  if (latest.backlog_bytes != 0) {
+    const auto percent = std::min<std::uint64_t>(100, latest.bytes_read * 100 / latest.backlog_bytes);
+    returning += ", " + std::to_string(percent) + "% of " + memory::format_bytes(static_cast<std::size_t>(latest.backlog_bytes));
+  }
+  if (const auto eta = meter.eta(); eta) {
+    returning += ", ETA " + format_duration(*eta);
+  }
+  return returning;
+}
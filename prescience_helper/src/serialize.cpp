@@ -1,46 +1,166 @@
 #include <prescience_helper/serialize.hpp>
-#include <optional>
+#include <prescience_helper/trace.hpp>
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 namespace {
-  void write_quad(std::stringstream& out, std::uint32_t in) {
-    if (in == 0) {
-      out << 'z';
-    } else {
-      for (std::size_t j = 0; j < 5; ++j) {
-        const auto rem = in % 85;
-        in /= 85;
+  //digits are least significant first, offset by 32. An all zero quad is just a z
+  constexpr char ZERO_QUAD = 'z';
+  constexpr std::uint8_t DIGIT_OFFSET = 32;
+  constexpr std::uint32_t BASE = 85;
+  constexpr std::uint32_t BASE_SQUARED = BASE * BASE;
+  constexpr std::uint8_t INVALID_DIGIT = 0xFF;
 
-        out << std::bit_cast<char>(static_cast<std::uint8_t>(rem + 32));
-      }
+  //two digits per lookup, so a quad is 2 divisions rather than 4
+  constexpr auto DIGIT_PAIRS = []() {
+    std::array<std::array<char, 2>, BASE_SQUARED> returning{};
+    for (std::uint32_t i = 0; i < BASE_SQUARED; ++i) {
+      returning[i] = {
+        static_cast<char>(i % BASE + DIGIT_OFFSET),
+        static_cast<char>(i / BASE + DIGIT_OFFSET) };
+    }
+    return returning;
+  }();
+
+  constexpr auto DIGIT_VALUES = []() {
+    std::array<std::uint8_t, 256> returning{};
+    returning.fill(INVALID_DIGIT);
+    for (std::uint32_t i = 0; i < BASE; ++i) {
+      returning[i + DIGIT_OFFSET] = static_cast<std::uint8_t>(i);
     }
+    return returning;
+  }();
+
+  std::uint32_t load_quad(const std::byte* in) noexcept {
+    return static_cast<std::uint32_t>(in[0])
+      | static_cast<std::uint32_t>(in[1]) << 8
+      | static_cast<std::uint32_t>(in[2]) << 16
+      | static_cast<std::uint32_t>(in[3]) << 24;
   }
-}
 
-void prescience_helper::serialize::to_ascii_85(std::stringstream& out, std::span<const std::byte> in) {
-  const auto quad_count = in.size() / 4;
-  std::optional<std::array<std::byte,4>> last_quad;
-  if (const auto rem = in.size() % 4; rem != 0) {
-    std::array<std::byte, 4> constructing;
-    for (std::size_t i = 0; i < rem; ++i) {
-      constructing[i] = in[in.size() - rem + i];
+  void store_quad(std::byte* out, std::uint32_t in) noexcept {
+    out[0] = static_cast<std::byte>(in & 0xFF);
+    out[1] = static_cast<std::byte>((in >> 8) & 0xFF);
+    out[2] = static_cast<std::byte>((in >> 16) & 0xFF);
+    out[3] = static_cast<std::byte>(in >> 24);
+  }
+
+  char* write_quad(char* out, std::uint32_t in) noexcept {
+    if (in == 0) {
+      *out = ZERO_QUAD;
+      return out + 1;
     }
-    for (std::size_t i = rem; i < 4; ++i) {
-      constructing[i] = std::byte{ 0 };
+    std::memcpy(out, DIGIT_PAIRS[in % BASE_SQUARED].data(), 2);
+    in /= BASE_SQUARED;
+    std::memcpy(out + 2, DIGIT_PAIRS[in % BASE_SQUARED].data(), 2);
+    out[4] = static_cast<char>(in / BASE_SQUARED + DIGIT_OFFSET);
+    return out + 5;
+  }
+
+  //false if any digit is invalid, or the digits don't fit in 32 bits
+  bool read_quad(const char* in, std::uint32_t& out) noexcept {
+    const auto d0 = DIGIT_VALUES[static_cast<unsigned char>(in[0])];
+    const auto d1 = DIGIT_VALUES[static_cast<unsigned char>(in[1])];
+    const auto d2 = DIGIT_VALUES[static_cast<unsigned char>(in[2])];
+    const auto d3 = DIGIT_VALUES[static_cast<unsigned char>(in[3])];
+    const auto d4 = DIGIT_VALUES[static_cast<unsigned char>(in[4])];
+    //valid digits are below 0x80, so one check covers all 5
+    if (((d0 | d1 | d2 | d3 | d4) & 0x80) != 0) {
+      return false;
     }
-    last_quad = constructing;
+    //the low 4 digits always fit in 32 bits, only the top one can overflow
+    const std::uint32_t low = d0 + BASE * (d1 + BASE * (d2 + BASE * static_cast<std::uint32_t>(d3)));
+    const std::uint64_t value = static_cast<std::uint64_t>(d4) * (BASE_SQUARED * BASE_SQUARED) + low;
+    out = static_cast<std::uint32_t>(value);
+    return value <= std::numeric_limits<std::uint32_t>::max();
   }
+}
+
+std::size_t prescience_helper::serialize::to_ascii_85(std::span<char> out, std::span<const std::byte> in) noexcept {
+  assert(out.size() >= ascii_85_max_size(in.size()));
+  PRESCIENCE_HELPER_TRACE_SPAN("to_ascii_85");
 
-  Read_buffer reader{ in };
+  char* writing = out.data();
+  const std::byte* reading = in.data();
+  const std::byte* const whole_quads_end = reading + in.size() / 4 * 4;
+
+  //4 quads per iteration, so the loads don't wait on the last quad's output
+  while (whole_quads_end - reading >= 16) {
+    const std::uint32_t q0 = load_quad(reading);
+    const std::uint32_t q1 = load_quad(reading + 4);
+    const std::uint32_t q2 = load_quad(reading + 8);
+    const std::uint32_t q3 = load_quad(reading + 12);
+    writing = write_quad(writing, q0);
+    writing = write_quad(writing, q1);
+    writing = write_quad(writing, q2);
+    writing = write_quad(writing, q3);
+    reading += 16;
+  }
+  for (; reading != whole_quads_end; reading += 4) {
+    writing = write_quad(writing, load_quad(reading));
+  }
 
-  for (std::size_t i = 0; i < quad_count; ++i) {
-    const std::uint32_t writing = reader.read<std::uint32_t>();
-    write_quad(out, writing);
+  //the last partial quad is zero padded
+  if (const auto rem = in.size() % 4; rem != 0) {
+    std::array<std::byte, 4> last{};
+    std::memcpy(last.data(), reading, rem);
+    writing = write_quad(writing, load_quad(last.data()));
   }
 
-  if (last_quad) {
-    Read_buffer last_quad_reader{ *last_quad };
-    const std::uint32_t writing = last_quad_reader.read<std::uint32_t>();
-    write_quad(out, writing);
+  return static_cast<std::size_t>(writing - out.data());
+}
+
+void prescience_helper::serialize::to_ascii_85(std::string& out, std::span<const std::byte> in) {
+  const auto start = out.size();
+  out.resize(start + ascii_85_max_size(in.size()));
+  const auto written = to_ascii_85(std::span<char>{ out }.subspan(start), in);
+  out.resize(start + written);
+}
+
+bool prescience_helper::serialize::from_ascii_85(std::string_view in, std::vector<std::byte>& out) {
+  PRESCIENCE_HELPER_TRACE_SPAN("from_ascii_85");
+  //exact for valid input, a z is a quad and so is every 5 other chars
+  const auto start = out.size();
+  const auto zero_quads = static_cast<std::size_t>(std::count(in.begin(), in.end(), ZERO_QUAD));
+  out.resize(start + (zero_quads + (in.size() - zero_quads) / 5) * 4);
+  std::byte* writing = out.data() + start;
+
+  const char* reading = in.data();
+  const char* const end = reading + in.size();
+  std::uint32_t value = 0;
+
+  while (reading != end) {
+    //4 quads at a time while there's no z among them
+    if (end - reading >= 20 && std::memchr(reading, ZERO_QUAD, 20) == nullptr) {
+      std::array<std::uint32_t, 4> values;
+      bool valid = true;
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        valid &= read_quad(reading + i * 5, values[i]);
+      }
+      if (!valid) {
+        return false;
+      }
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        store_quad(writing + i * 4, values[i]);
+      }
+      reading += 20;
+      writing += 16;
+      continue;
+    }
+
+    if (*reading == ZERO_QUAD) {
+      value = 0;
+      ++reading;
+    } else if (end - reading < 5 || !read_quad(reading, value)) {
+      return false;
+    } else {
+      reading += 5;
+    }
+    store_quad(writing, value);
+    writing += 4;
   }
-}
\ No newline at end of file
+
+  out.resize(static_cast<std::size_t>(writing - out.data()));
+  return true;
+}
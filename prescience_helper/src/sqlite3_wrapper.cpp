@@ -16,6 +16,10 @@ void prescience_helper::internal::bind_val(sqlite3_stmt* stmt, int i, std::span<
   sqlite3_bind_blob(stmt, i, val.data(), (int)val.size(), SQLITE_TRANSIENT);
 }
 
+void prescience_helper::internal::bind_val(sqlite3_stmt* stmt, int i, Static_blob val) {
+  sqlite3_bind_blob(stmt, i, val.data.data(), (int)val.data.size(), SQLITE_STATIC);
+}
+
 std::int64_t prescience_helper::internal::column(sqlite3_stmt* from, int i, Tag<std::int64_t>) {
   return sqlite3_column_int64(from, i);
 }
@@ -70,6 +74,11 @@ std::int64_t prescience_helper::Db::last_insert_rowid() const noexcept {
   return sqlite3_last_insert_rowid(db_.get());
 }
 
+bool prescience_helper::Db::exec_script(std::string_view script) const noexcept {
+  const std::string terminated{ script };
+  return sqlite3_exec(db_.get(), terminated.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+}
+
 prescience_helper::Stmt prescience_helper::Db::prepare(std::string_view query) const {
   sqlite3_stmt* stmt = nullptr;
 
@@ -82,6 +91,25 @@ prescience_helper::Stmt prescience_helper::Db::prepare(std::string_view query) c
   }
 }
 
+std::vector<std::string> prescience_helper::Db::query_plan(std::string_view query) const {
+  std::vector<std::string> returning;
+
+  std::string explaining{ "EXPLAIN QUERY PLAN " };
+  explaining.append(query);
+
+  const Stmt stmt = prepare(explaining);
+  if (!stmt.valid()) {
+    return returning;
+  }
+
+  //bind nothing, the plan doesn't depend on parameter values
+  stmt.exec<std::int32_t, std::int32_t, std::int32_t, std::string_view>([&returning](std::int32_t, std::int32_t, std::int32_t, std::string_view detail) {
+    returning.emplace_back(detail);
+    });
+
+  return returning;
+}
+
 void prescience_helper::Db::Sqlite3_closer_::operator()(sqlite3* db) {
   sqlite3_close_v2(db);
 }
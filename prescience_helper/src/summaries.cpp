@@ -0,0 +1,132 @@
+#include <prescience_helper/summaries.hpp>
+#include <prescience_helper/logged_blobs.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <charconv>
+#include <cstdio>
+#include <optional>
+#include <string>
+
+namespace summaries = prescience_helper::summaries;
+
+namespace {
+  std::optional<std::string> get_config(prescience_helper::Db const& db, std::string_view name) {
+    std::optional<std::string> returning;
+    db.exec<std::string_view>("SELECT value FROM Configs WHERE name = ?;", [&returning](std::string_view value) {
+      returning = std::string{ value };
+      }, name);
+    return returning;
+  }
+
+  std::int64_t half_life_days(prescience_helper::Db const& db) {
+    const auto value = get_config(db, summaries::HALF_LIFE_CONFIG);
+    std::int64_t days = 0;
+    if (!value
+      || std::from_chars(value->data(), value->data() + value->size(), days).ec != std::errc{}
+      || days < 0) {
+      return summaries::DEFAULT_HALF_LIFE_DAYS;
+    }
+    return days;
+  }
+}
+
+summaries::Merger::Merger(Db const& db) :
+  get_stmt_(db.prepare("SELECT summary FROM Summary WHERE player = ? AND spec = ? AND type = ? AND difficulty = ?;")),
+  put_stmt_(db.prepare("INSERT INTO Summary(player,spec,type,difficulty,summary) VALUES (?,?,?,?,?) ON CONFLICT(player,spec,type,difficulty) DO UPDATE SET summary = excluded.summary;")),
+  half_life_(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::days{ half_life_days(db) })) {
+
+  if (const auto name = get_config(db, CODEC_CONFIG); name) {
+    if (const auto codec = blob_codec::from_name(*name); codec) {
+      codec_ = *codec;
+    }
+  }
+}
+
+void summaries::Merger::add(Key const& key, sim::summary::Summary const& pull) {
+  PRESCIENCE_HELPER_TRACE_SPAN("merge summary");
+  merging_ = sim::summary::Summary{};
+  get_stmt_.exec<std::span<const std::byte>>([this](std::span<const std::byte> blob) {
+    logged::deserialize_blob(blob, scratch_, merging_);
+    }, key.player, key.spec, key.type, key.difficulty);
+
+  merging_.add_pull(pull, half_life_);
+  put(key, merging_);
+}
+
+void summaries::Merger::put(Key const& key, sim::summary::Summary const& summary) {
+  serialized_.clear();
+  logged::serialize(summary, serialized_);
+  blob_codec::encode(codec_, blob_codec::FORMAT_SUMMARY, serialized_, encoded_);
+
+  put_stmt_.exec([]() {}, key.player, key.spec, key.type, key.difficulty, Static_blob{ encoded_ });
+}
+
+void summaries::rebuild(Db const& db) {
+  PRESCIENCE_HELPER_TRACE_SPAN("rebuild summaries");
+
+  db.begin();
+  db.exec("DELETE FROM Summary;", []() {});
+
+  Merger merger{ db };
+
+  //ordered by key, so only one key's summary is held at a time
+  std::optional<Key> building_key;
+  sim::summary::Summary building;
+
+  std::vector<std::byte> scratch;
+  std::vector<Event<sim::Damage>> damage;
+  sim::Stats_timeline stats;
+  std::vector<Event<void>> deaths;
+  std::vector<Event<void>> rezzes;
+
+  db.exec<std::int64_t, std::int32_t, std::int32_t, std::int32_t, std::int64_t, std::int64_t,
+    std::span<const std::byte>, std::span<const std::byte>, std::span<const std::byte>, std::span<const std::byte>>(
+    "SELECT Logged.player,Logged.spec,Encounter.type,Encounter.difficulty,Encounter.start_time,Encounter.duration_ms,"
+    "Logged.damage,Logged.stats,Logged.deaths,Logged.rezzes FROM Logged"
+    " INNER JOIN Encounter ON Logged.encounter = Encounter.id"
+    " ORDER BY Logged.player, Logged.spec, Encounter.type, Encounter.difficulty;",
+    [&](std::int64_t player, std::int32_t spec, std::int32_t type, std::int32_t difficulty, std::int64_t start_time, std::int64_t duration,
+      std::span<const std::byte> damage_blob, std::span<const std::byte> stats_blob, std::span<const std::byte> deaths_blob, std::span<const std::byte> rezzes_blob) {
+
+      const Key key{ player, spec, type, difficulty };
+      if (building_key && !(*building_key == key)) {
+        merger.put(*building_key, building);
+        building = sim::summary::Summary{};
+      }
+      building_key = key;
+
+      damage.clear();
+      stats = sim::Stats_timeline{};
+      deaths.clear();
+      rezzes.clear();
+      try {
+        logged::deserialize_blob(damage_blob, scratch, damage);
+        logged::deserialize_blob(stats_blob, scratch, stats);
+        logged::deserialize_blob(deaths_blob, scratch, deaths);
+        logged::deserialize_blob(rezzes_blob, scratch, rezzes);
+      } catch (std::exception const& e) {
+        fprintf(stderr, "Skipping unreadable Logged row while summarizing: %s\n", e.what());
+        return;
+      }
+
+      building.add_pull(sim::summary::summarize(
+        start_time,
+        std::chrono::duration_cast<clogparser::Period>(std::chrono::milliseconds{ duration }),
+        damage, stats, deaths, rezzes), merger.half_life());
+    });
+
+  if (building_key) {
+    merger.put(*building_key, building);
+  }
+
+  const auto built = std::to_string(half_life_days(db));
+  db.exec("DELETE FROM Configs WHERE name = ?;", []() {}, BUILT_HALF_LIFE_CONFIG);
+  db.exec("INSERT INTO Configs(name,value) VALUES (?,?);", []() {}, BUILT_HALF_LIFE_CONFIG, std::string_view{ built });
+  db.commit();
+}
+
+void summaries::ensure_current(Db const& db) {
+  if (get_config(db, BUILT_HALF_LIFE_CONFIG) != std::to_string(half_life_days(db))) {
+    rebuild(db);
+  }
+}
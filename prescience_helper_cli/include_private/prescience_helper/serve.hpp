@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+//loopback http service generating input strings, so several people can share one warm db
+namespace prescience_helper::serve {
+  constexpr std::uint16_t DEFAULT_PORT = 7473;
+
+  struct Options {
+    std::filesystem::path db_path;
+    std::uint16_t port = DEFAULT_PORT;
+    //read connections, generation requests beyond this wait for one to free up
+    std::size_t connections = 4;
+    //if set, also keep parsing new logs from here while serving
+    std::optional<std::filesystem::path> logs;
+  };
+
+  //serves until interrupted, returns the process exit code
+  int run(Options const& options);
+}
@@ -0,0 +1,873 @@
+#include <prescience_helper/blob_codec.hpp>
+#include <prescience_helper/database.hpp>
+#include <prescience_helper/encounter_cache.hpp>
+#include <prescience_helper/generator.hpp>
+#include <prescience_helper/ingest_pipeline.hpp>
+#include <prescience_helper/log_finder.hpp>
+#include <prescience_helper/migrations.hpp>
+#include <prescience_helper/payload.hpp>
+#include <prescience_helper/progress.hpp>
+#include <prescience_helper/serialize.hpp>
+#include <prescience_helper/serve.hpp>
+#include <prescience_helper/sim/dbc_pack.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <random>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+  //workers each hold a read buffer, so keep it well under the gui's
+  constexpr std::size_t WORKER_BUFFER_SIZE = 16 * 1024 * 1024; //16mb
+
+  //prepared logs waiting on the writer, per worker
+  constexpr std::size_t QUEUED_LOGS_PER_WORKER = 2;
+
+  //resimulated encounters waiting on the writer, per worker
+  constexpr std::size_t QUEUED_ENCOUNTERS_PER_WORKER = 16;
+
+  //how often ingest prints its throughput and ETA
+  constexpr std::chrono::seconds PROGRESS_INTERVAL{ 2 };
+
+  constexpr std::int32_t DEFAULT_WINDOW_SIZE = 10;
+  constexpr std::int32_t DEFAULT_TIMING_REPEATS = 20;
+  //blobs per Logged column timing reencodes with every codec, enough for stable numbers without a full pass
+  constexpr std::uint64_t CODEC_SAMPLE_BLOBS = 2000;
+  //an odd size, so the partial last quad is covered too
+  constexpr std::size_t ASCII_85_TIMING_BYTES = 16 * 1024 * 1024 + 3;
+
+  using Clock = std::chrono::steady_clock;
+
+  double to_seconds(Clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+  }
+
+  void usage() {
+    fprintf(stderr,
+      "usage: prescience_helper_cli [--db <path>] [--dbc-pack <path>] [--trace <path>] <command> [options]\n"
+      "\n"
+      "commands:\n"
+      "  ingest <log directory> [--threads <n>] [--memory-budget <mb>] [--spill-dir <path>] [--cache-dir <path>]\n"
+      "    parses every new log in the directory into the db, printing throughput and an ETA as it goes. Events past\n"
+      "    the memory budget (shared by all threads, 0 for none) are spilled to temporary files in --spill-dir,\n"
+      "    or the system temp directory. With --cache-dir, or the encounter_cache_dir config, each pull's events are\n"
+      "    kept there for resimulate\n"
+      "  resimulate [--cache-dir <path>] [--threads <n>] [--only pending]\n"
+      "    simulates every stored pull again from its cached events, without the logs, replacing its Logged rows.\n"
+      "    With --only pending, just the pulls a database upgrade found wrong\n"
+      "  generate --encounter <id or name> --difficulty <id or name> [--window <100ms units>]\n"
+      "    reads an addon output string from stdin, writes the addon input string to stdout\n"
+      "  timing [--encounter <id or name> --difficulty <id or name> [--window <100ms units>] [--repeat <n>]]\n"
+      "    reports stored size and decode speed of every Logged column, and of a sample of each reencoded with every\n"
+      "    codec. Then ascii85 speed and whether the hot queries use indexes, failing if one scans a whole table. With an\n"
+      "    encounter and difficulty, also times generating for the addon output string on stdin\n"
+      "  serve [--port <port>] [--connections <n>] [--logs <log directory>]\n"
+      "    answers POST /generate?encounter=..&difficulty=..&window=.. on 127.0.0.1, the body being an addon output string.\n"
+      "    With --logs, new logs there are parsed while serving\n"
+      "\n"
+      "--dbc-pack replaces the compiled in spell and item tables, defaulting to prescience_helper.dbcpack next to the db if it's there\n"
+      "--trace writes a chrome trace of the command, if built with PRESCIENCE_HELPER_TRACING\n");
+  }
+
+  struct Args {
+  public:
+    Args(int argc, char** argv) {
+      for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg.starts_with("--")) {
+          if (i + 1 < argc) {
+            options_.emplace_back(arg.substr(2), argv[++i]);
+          } else {
+            options_.emplace_back(arg.substr(2), "");
+          }
+        } else {
+          positional_.push_back(arg);
+        }
+      }
+    }
+
+    std::optional<std::string_view> option(std::string_view name) const {
+      const auto found = std::find_if(options_.begin(), options_.end(), [name](auto const& option) {
+        return option.first == name;
+        });
+      if (found == options_.end()) {
+        return std::nullopt;
+      }
+      return found->second;
+    }
+
+    std::optional<std::int32_t> int_option(std::string_view name, std::int32_t default_value) const {
+      const auto found = option(name);
+      if (!found) {
+        return default_value;
+      }
+      std::int32_t returning = 0;
+      const auto res = std::from_chars(found->data(), found->data() + found->size(), returning);
+      if (res.ec != std::errc() || res.ptr != found->data() + found->size()) {
+        fprintf(stderr, "--%.*s expects a number\n", (std::int32_t)name.size(), name.data());
+        return std::nullopt;
+      }
+      return returning;
+    }
+
+    std::span<const std::string_view> positional() const noexcept {
+      return positional_;
+    }
+  private:
+    std::vector<std::pair<std::string_view, std::string_view>> options_;
+    std::vector<std::string_view> positional_;
+  };
+
+  std::optional<std::int32_t> find_id(prescience_helper::Db const& db, std::string_view table, std::string_view id_or_name) {
+    const auto returning = prescience_helper::database::find_id(db, table, id_or_name);
+    if (!returning) {
+      fprintf(stderr, "Unknown %.*s '%.*s'\n", (std::int32_t)table.size(), table.data(), (std::int32_t)id_or_name.size(), id_or_name.data());
+    }
+    return returning;
+  }
+
+  std::string read_stdin() {
+    std::string returning{ std::istreambuf_iterator<char>{ std::cin }, std::istreambuf_iterator<char>{} };
+    while (!returning.empty() && std::isspace(static_cast<unsigned char>(returning.back()))) {
+      returning.pop_back();
+    }
+    return returning;
+  }
+
+  struct Generate_args {
+    std::int32_t encounter;
+    std::int32_t difficulty;
+    clogparser::Period window_size;
+  };
+
+  std::optional<Generate_args> generate_args(prescience_helper::Db const& db, Args const& args) {
+    const auto encounter_arg = args.option("encounter");
+    const auto difficulty_arg = args.option("difficulty");
+    if (!encounter_arg || !difficulty_arg) {
+      usage();
+      return std::nullopt;
+    }
+    const auto encounter = find_id(db, "Encounter_type", *encounter_arg);
+    const auto difficulty = find_id(db, "Difficulty", *difficulty_arg);
+    const auto window = args.int_option("window", DEFAULT_WINDOW_SIZE);
+    if (!encounter || !difficulty || !window) {
+      return std::nullopt;
+    }
+    if (*window < 1 || *window > 300) {
+      fprintf(stderr, "--window must be between 1 and 300\n");
+      return std::nullopt;
+    }
+    return Generate_args{ *encounter, *difficulty, std::chrono::milliseconds{ *window * 100 } };
+  }
+
+  //workers prepare whole logs and hand them over, the calling thread is the only one touching the db
+  int ingest(prescience_helper::Db const& db, Args const& args) {
+    if (args.positional().size() != 2) {
+      usage();
+      return 1;
+    }
+    const std::filesystem::path directory{ args.positional()[1] };
+    if (!std::filesystem::is_directory(directory)) {
+      fprintf(stderr, "'%s' isn't a directory\n", directory.string().c_str());
+      return 1;
+    }
+
+    const auto thread_count = args.int_option("threads", std::max<std::int32_t>(1, std::thread::hardware_concurrency()));
+    if (!thread_count || *thread_count < 1) {
+      return 1;
+    }
+
+    prescience_helper::Log_finder finder{ directory };
+    db.exec<std::string_view, std::int64_t, std::int64_t, std::optional<std::int32_t>>("SELECT path,useful_amount,total_amount,last_patch FROM Logs_read;",
+      [&finder](std::string_view path, std::int64_t useful_amount, std::int64_t total_amount, std::optional<std::int32_t> last_patch) {
+        finder.set_log_read(path, useful_amount, total_amount, last_patch);
+      });
+    //encounters deferred until we could simulate their patch first, then whatever is new
+    auto to_read = prescience_helper::load_ready_deferred(db);
+    for (auto& log : finder.check()) {
+      to_read.push_back(prescience_helper::Prepared_log{ std::move(log) });
+    }
+
+    std::uint64_t backlog_bytes = 0;
+    for (auto const& reading : to_read) {
+      if (reading.log.new_total > reading.log.old_useful) {
+        backlog_bytes += reading.log.new_total - reading.log.old_useful;
+      }
+    }
+
+    auto config = prescience_helper::load_ingest_config(db);
+    //the budget is for the whole command, each worker gets its share
+    const auto default_budget_mb = static_cast<std::int32_t>(config.ingest_options.memory_budget / (1024 * 1024));
+    const auto budget_mb = args.int_option("memory-budget", default_budget_mb);
+    if (!budget_mb || *budget_mb < 0) {
+      return 1;
+    }
+    config.ingest_options.memory_budget = static_cast<std::size_t>(*budget_mb) * 1024 * 1024 / *thread_count;
+    if (const auto spill_directory = args.option("spill-dir")) {
+      config.ingest_options.spill_directory = *spill_directory;
+    }
+    if (const auto cache_directory = args.option("cache-dir")) {
+      config.cache_directory = *cache_directory;
+    }
+    prescience_helper::Encounter_store store{ db };
+    config.stored = store.stored();
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<prescience_helper::Prepared_log> prepared;
+    std::size_t workers_running = static_cast<std::size_t>(*thread_count);
+    const std::size_t max_queued = workers_running * QUEUED_LOGS_PER_WORKER;
+    std::atomic<std::size_t> next_log{ 0 };
+
+    //one channel per worker, they each only have the one reader
+    std::vector<prescience_helper::progress::Channel> channels(static_cast<std::size_t>(*thread_count));
+
+    const auto start = Clock::now();
+
+    std::vector<std::thread> workers;
+    for (std::int32_t i = 0; i < *thread_count; ++i) {
+      workers.emplace_back([&, i]() {
+        prescience_helper::trace::name_thread("ingest worker");
+        prescience_helper::progress::Reporter reporter{ channels[i] };
+        prescience_helper::Log_preparer preparer{ config, WORKER_BUFFER_SIZE };
+        preparer.report_to(&reporter);
+        prescience_helper::Prepared_encounter encounter;
+
+        for (std::size_t log_index = next_log++; log_index < to_read.size(); log_index = next_log++) {
+          //each index is taken by one worker, so they never move the same one
+          auto log = std::move(to_read[log_index]);
+          try {
+            preparer.open(log);
+            while (preparer.next(log, encounter)) {
+              log.encounters.push_back(std::move(encounter));
+            }
+          } catch (std::exception const& e) {
+            fprintf(stderr, "Couldn't parse %s: %s\n", log.log.path.string().c_str(), e.what());
+            continue;
+          }
+
+          std::unique_lock lock{ mutex };
+          changed.wait(lock, [&]() { return prepared.size() < max_queued; });
+          prepared.push_back(std::move(log));
+          changed.notify_all();
+        }
+
+        std::lock_guard lock{ mutex };
+        --workers_running;
+        changed.notify_all();
+      });
+    }
+
+    std::size_t logs_stored = 0;
+    std::size_t encounters_stored = 0;
+    prescience_helper::memory::Log_usage memory_high_water;
+
+    std::vector<prescience_helper::progress::Snapshot> worker_progress(channels.size());
+    prescience_helper::progress::Meter meter;
+    auto last_progress = start;
+    const auto report_progress = [&]() {
+      const auto now = Clock::now();
+      if (now - last_progress < PROGRESS_INTERVAL) {
+        return;
+      }
+      last_progress = now;
+
+      prescience_helper::progress::Snapshot total;
+      total.backlog_bytes = backlog_bytes;
+      total.encounters_stored = encounters_stored;
+      for (std::size_t i = 0; i < channels.size(); ++i) {
+        if (const auto latest = prescience_helper::progress::drain(channels[i]); latest) {
+          worker_progress[i] = *latest;
+        }
+        total.bytes_read += worker_progress[i].bytes_read;
+        total.lines_read += worker_progress[i].lines_read;
+        total.encounters_found += worker_progress[i].encounters_found;
+      }
+      meter.update(total, now);
+      fprintf(stderr, "%s\n", prescience_helper::progress::describe(meter).c_str());
+    };
+
+    for (;;) {
+      prescience_helper::Prepared_log log;
+      {
+        std::unique_lock lock{ mutex };
+        if (!changed.wait_for(lock, PROGRESS_INTERVAL, [&]() { return !prepared.empty() || workers_running == 0; })) {
+          lock.unlock();
+          report_progress();
+          continue;
+        }
+        if (prepared.empty()) {
+          break;
+        }
+        log = std::move(prepared.front());
+        prepared.pop_front();
+        changed.notify_all();
+      }
+
+      for (auto const& encounter : log.encounters) {
+        store.store(encounter);
+      }
+      store.finish_log(log, finder);
+
+      ++logs_stored;
+      encounters_stored += log.encounters.size();
+      memory_high_water.high_water(log.memory_usage);
+      fprintf(stderr, "[%zu/%zu] %s: %zu encounter(s), %s ingested, %s largest encounter\n",
+        logs_stored,
+        to_read.size(),
+        log.log.path.filename().string().c_str(),
+        log.encounters.size(),
+        prescience_helper::memory::format_bytes(log.memory_usage.ingested).c_str(),
+        prescience_helper::memory::format_bytes(log.memory_usage.encounter_total_high_water).c_str());
+      report_progress();
+    }
+
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    store.writer().flush();
+
+    const auto elapsed = to_seconds(Clock::now() - start);
+    auto const& stats = store.writer().stats();
+    fprintf(stdout, "ingested %zu log(s), %zu encounter(s), %llu row(s) in %.2fs with %d thread(s) (%.0f rows/s written, %llu commit(s))\n",
+      logs_stored,
+      encounters_stored,
+      static_cast<unsigned long long>(stats.rows),
+      elapsed,
+      *thread_count,
+      stats.rows_per_second(),
+      static_cast<unsigned long long>(stats.commits));
+
+    auto const& peak = memory_high_water.encounter_high_water;
+    fprintf(stdout, "peak memory: %s ingested per log, %s per encounter (targets %s, players %s, friendlies %s, simulated %s, blobs %s), %s spilled\n",
+      prescience_helper::memory::format_bytes(memory_high_water.ingested).c_str(),
+      prescience_helper::memory::format_bytes(memory_high_water.encounter_total_high_water).c_str(),
+      prescience_helper::memory::format_bytes(peak.targets).c_str(),
+      prescience_helper::memory::format_bytes(peak.players).c_str(),
+      prescience_helper::memory::format_bytes(peak.friendlies).c_str(),
+      prescience_helper::memory::format_bytes(peak.simulated).c_str(),
+      prescience_helper::memory::format_bytes(peak.blobs).c_str(),
+      prescience_helper::memory::format_bytes(peak.spilled).c_str());
+
+    const auto gear = config.gear_cache->stats();
+    fprintf(stdout, "gear cache: %zu gear set(s), %llu hit(s), %llu miss(es)\n",
+      gear.size,
+      static_cast<unsigned long long>(gear.hits),
+      static_cast<unsigned long long>(gear.misses));
+    return 0;
+  }
+
+  //workers read and simulate cached pulls, the calling thread swaps their Logged rows and rebuilds Summary once done
+  int resimulate(prescience_helper::Db const& db, Args const& args) {
+    auto config = prescience_helper::load_ingest_config(db);
+    if (const auto cache_directory = args.option("cache-dir")) {
+      config.cache_directory = *cache_directory;
+    }
+    if (config.cache_directory.empty()) {
+      fprintf(stderr, "No encounter cache, pass --cache-dir or set the %.*s config\n",
+        (std::int32_t)prescience_helper::ENCOUNTER_CACHE_CONFIG.size(), prescience_helper::ENCOUNTER_CACHE_CONFIG.data());
+      return 1;
+    }
+    const auto cache_directory = config.cache_directory;
+    //resimulating doesn't write the cache it reads
+    config.cache_directory.clear();
+
+    const auto thread_count = args.int_option("threads", std::max<std::int32_t>(1, std::thread::hardware_concurrency()));
+    if (!thread_count || *thread_count < 1) {
+      return 1;
+    }
+    const auto only = args.option("only");
+    if (only && *only != "pending") {
+      usage();
+      return 1;
+    }
+
+    struct Cached {
+      std::int64_t encounter_id;
+      std::int32_t patch;
+      std::filesystem::path path;
+    };
+    std::vector<Cached> cached;
+    std::size_t missing = 0;
+    db.exec<std::int64_t, std::int64_t, std::int32_t, std::int32_t, std::int32_t>(only
+      ? "SELECT id, start_time, type, difficulty, patch FROM Encounter INNER JOIN Pending_resimulation ON Pending_resimulation.encounter = Encounter.id;"
+      : "SELECT id, start_time, type, difficulty, patch FROM Encounter;",
+      [&](std::int64_t id, std::int64_t start_time, std::int32_t type, std::int32_t difficulty, std::int32_t patch) {
+        auto path = prescience_helper::encounter_cache_path(cache_directory, prescience_helper::Stored_encounters::Key{ start_time, type, difficulty, patch });
+        if (!std::filesystem::exists(path)) {
+          ++missing;
+          return;
+        }
+        cached.push_back(Cached{ id, patch, std::move(path) });
+      });
+
+    struct Resimulated {
+      std::int64_t encounter_id;
+      prescience_helper::Prepared_encounter encounter;
+    };
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<Resimulated> resimulated;
+    std::size_t workers_running = static_cast<std::size_t>(*thread_count);
+    const std::size_t max_queued = workers_running * QUEUED_ENCOUNTERS_PER_WORKER;
+    std::atomic<std::size_t> next_encounter{ 0 };
+    std::atomic<std::size_t> failed{ 0 };
+
+    const auto start = Clock::now();
+
+    std::vector<std::thread> workers;
+    for (std::int32_t i = 0; i < *thread_count; ++i) {
+      workers.emplace_back([&]() {
+        prescience_helper::trace::name_thread("resimulate worker");
+        //the preparer never reads a log, so it doesn't need much of a buffer
+        prescience_helper::Log_preparer preparer{ config, 0 };
+
+        for (std::size_t index = next_encounter++; index < cached.size(); index = next_encounter++) {
+          auto const& reading = cached[index];
+          Resimulated adding{ reading.encounter_id, {} };
+          try {
+            //a fresh store per pull, so strings don't pile up over the whole run
+            clogparser::String_store strings;
+            const auto encounter = prescience_helper::encounter_cache::read(reading.path, strings);
+            preparer.simulate(encounter, reading.patch, adding.encounter);
+          } catch (std::exception const& e) {
+            fprintf(stderr, "Couldn't resimulate %s: %s\n", reading.path.string().c_str(), e.what());
+            ++failed;
+            continue;
+          }
+
+          std::unique_lock lock{ mutex };
+          changed.wait(lock, [&]() { return resimulated.size() < max_queued; });
+          resimulated.push_back(std::move(adding));
+          changed.notify_all();
+        }
+
+        std::lock_guard lock{ mutex };
+        --workers_running;
+        changed.notify_all();
+      });
+    }
+
+    prescience_helper::Encounter_store store{ db };
+    std::size_t replaced = 0;
+    for (;;) {
+      Resimulated replacing;
+      {
+        std::unique_lock lock{ mutex };
+        changed.wait(lock, [&]() { return !resimulated.empty() || workers_running == 0; });
+        if (resimulated.empty()) {
+          break;
+        }
+        replacing = std::move(resimulated.front());
+        resimulated.pop_front();
+        changed.notify_all();
+      }
+
+      store.replace(replacing.encounter_id, replacing.encounter);
+      ++replaced;
+    }
+
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    store.writer().flush();
+    prescience_helper::summaries::rebuild(db);
+
+    std::int64_t pending = 0;
+    db.exec<std::int64_t>("SELECT COUNT(1) FROM Pending_resimulation;", [&pending](std::int64_t count) {
+      pending = count;
+      });
+
+    fprintf(stdout, "resimulated %zu encounter(s) in %.2fs with %d thread(s), %zu failed, %zu without a cache file, %lld still pending\n",
+      replaced,
+      to_seconds(Clock::now() - start),
+      *thread_count,
+      failed.load(),
+      missing,
+      static_cast<long long>(pending));
+    return failed == 0 ? 0 : 1;
+  }
+
+  int generate(prescience_helper::Db const& db, Args const& args) {
+    const auto parsed = generate_args(db, args);
+    if (!parsed) {
+      return 1;
+    }
+
+    prescience_helper::Generator generator{ db };
+    const auto generated = generator.generate(read_stdin(), parsed->encounter, parsed->difficulty, parsed->window_size);
+    if (!generated.error.empty()) {
+      fprintf(stderr, "%s\n", generated.error.c_str());
+      return 1;
+    }
+    fprintf(stdout, "%s\n", generated.output.c_str());
+    return 0;
+  }
+
+  //round trips a payload like the addon's (mostly small values, some zero quads) and reports MB/s each way
+  bool time_ascii_85() {
+    std::mt19937 random{ 85 };
+    std::vector<std::byte> payload(ASCII_85_TIMING_BYTES);
+    for (std::size_t i = 0; i < payload.size(); ++i) {
+      const bool zero_run = (i / 64) % 8 == 0;
+      payload[i] = zero_run ? std::byte{ 0 } : static_cast<std::byte>(random() % 128);
+    }
+
+    std::string encoded;
+    const auto encode_start = Clock::now();
+    prescience_helper::serialize::to_ascii_85(encoded, payload);
+    const auto encode_seconds = to_seconds(Clock::now() - encode_start);
+
+    std::vector<std::byte> decoded;
+    const auto decode_start = Clock::now();
+    const bool valid = prescience_helper::serialize::from_ascii_85(encoded, decoded);
+    const auto decode_seconds = to_seconds(Clock::now() - decode_start);
+
+    const bool round_tripped = valid
+      && decoded.size() == (payload.size() + 3) / 4 * 4
+      && std::equal(payload.begin(), payload.end(), decoded.begin())
+      && std::all_of(decoded.begin() + payload.size(), decoded.end(), [](std::byte b) { return b == std::byte{ 0 }; });
+
+    const double payload_mb = payload.size() / (1024.0 * 1024.0);
+    fprintf(stdout, "ascii85: %.2fMB -> %zu chars, encode %.1f MB/s, decode %.1f MB/s, round trip %s\n",
+      payload_mb,
+      encoded.size(),
+      encode_seconds == 0 ? 0.0 : payload_mb / encode_seconds,
+      decode_seconds == 0 ? 0.0 : payload_mb / decode_seconds,
+      round_tripped ? "ok" : "FAILED");
+    return round_tripped;
+  }
+
+  //the generated string decodes and re-encodes to itself, and a v3 payload re-encodes to the same bytes
+  bool round_trips(std::string_view generated) {
+    const auto found_version_delim = generated.find('?');
+    if (found_version_delim == std::string_view::npos) {
+      return false;
+    }
+    const auto version = prescience_helper::payload::parse_version(generated.substr(0, found_version_delim));
+    if (!version) {
+      return false;
+    }
+    generated.remove_prefix(found_version_delim + 1);
+    std::vector<std::byte> decoded;
+    if (!prescience_helper::serialize::from_ascii_85(generated, decoded)) {
+      return false;
+    }
+    std::string encoded;
+    prescience_helper::serialize::to_ascii_85(encoded, decoded);
+    if (encoded != generated) {
+      return false;
+    }
+    if (*version != prescience_helper::payload::Version::v3) {
+      return true;
+    }
+
+    prescience_helper::payload::Payload payload;
+    if (!prescience_helper::payload::decode_v3(decoded, payload)) {
+      return false;
+    }
+    std::vector<std::byte> reencoded;
+    prescience_helper::payload::encode(*version, payload, reencoded);
+    //decoded still has ascii85's zero padding
+    reencoded.resize((reencoded.size() + 3) / 4 * 4, std::byte{ 0 });
+    return reencoded == decoded;
+  }
+
+  //false if any query we run per row or per request scans a whole table
+  bool report_index_use(prescience_helper::Db const& db) {
+    const std::array<std::pair<std::string_view, std::string_view>, 3> queries{ {
+      { "member summary", prescience_helper::Generator::MEMBER_SUMMARY_QUERY },
+      { "aug summary", prescience_helper::Generator::AUG_SUMMARY_QUERY },
+      { "existing encounter", prescience_helper::Encounter_store::EXISTING_ENCOUNTER_QUERY },
+    } };
+
+    bool returning = true;
+    for (auto const& [name, query] : queries) {
+      if (const auto scan = prescience_helper::database::full_scan(db, query); scan) {
+        fprintf(stdout, "%-20s FAIL, %s\n", std::string{ name }.c_str(), scan->c_str());
+        returning = false;
+      } else {
+        fprintf(stdout, "%-20s ok, uses indexes\n", std::string{ name }.c_str());
+      }
+    }
+    return returning;
+  }
+
+  int timing(prescience_helper::Db const& db, Args const& args) {
+    struct Column_timing {
+      std::uint64_t blobs = 0;
+      std::uint64_t stored = 0;
+      std::uint64_t payload = 0;
+      std::array<std::uint64_t, prescience_helper::blob_codec::CODEC_NAMES.size()> codecs{};
+      Clock::duration decoding{ 0 };
+    };
+
+    //a sample of the column reencoded with one codec
+    struct Codec_timing {
+      std::uint64_t stored = 0;
+      std::uint64_t payload = 0;
+      Clock::duration decoding{ 0 };
+    };
+    using Codec_timings = std::array<Codec_timing, prescience_helper::blob_codec::CODEC_NAMES.size()>;
+
+    std::array<Column_timing, 4> columns;
+    std::array<Codec_timings, 4> sampled{};
+    std::array<std::uint64_t, 4> sampled_blobs{};
+    std::vector<std::byte> scratch;
+    std::vector<std::byte> reencoded;
+    std::vector<std::byte> reencoded_scratch;
+
+    using Blob = std::optional<std::span<const std::byte>>;
+    db.exec<Blob, Blob, Blob, Blob>("SELECT damage, stats, deaths, rezzes FROM Logged;",
+      [&](Blob damage, Blob stats, Blob deaths, Blob rezzes) {
+        const std::array<Blob, 4> blobs{ damage, stats, deaths, rezzes };
+        for (std::size_t i = 0; i < blobs.size(); ++i) {
+          if (!blobs[i]) {
+            continue;
+          }
+          auto& column = columns[i];
+          const auto start = Clock::now();
+          const auto decoded = prescience_helper::blob_codec::decode(*blobs[i], scratch);
+          column.decoding += Clock::now() - start;
+
+          ++column.blobs;
+          column.stored += blobs[i]->size();
+          column.payload += decoded.payload.size();
+          if (static_cast<std::size_t>(decoded.codec) < column.codecs.size()) {
+            ++column.codecs[static_cast<std::size_t>(decoded.codec)];
+          }
+
+          if (sampled_blobs[i] == CODEC_SAMPLE_BLOBS || decoded.payload.empty()) {
+            continue;
+          }
+          ++sampled_blobs[i];
+          for (std::size_t codec = 0; codec < sampled[i].size(); ++codec) {
+            if (!prescience_helper::blob_codec::available(static_cast<prescience_helper::blob_codec::Codec>(codec))) {
+              continue;
+            }
+            reencoded.clear();
+            prescience_helper::blob_codec::encode(static_cast<prescience_helper::blob_codec::Codec>(codec), decoded.format, decoded.payload, reencoded);
+
+            auto& timing = sampled[i][codec];
+            const auto decode_start = Clock::now();
+            const auto redecoded = prescience_helper::blob_codec::decode(reencoded, reencoded_scratch);
+            timing.decoding += Clock::now() - decode_start;
+            timing.stored += reencoded.size();
+            timing.payload += redecoded.payload.size();
+          }
+        }
+      });
+
+    fprintf(stdout, "%-8s %10s %12s %12s %7s %12s  %s\n", "column", "blobs", "stored MB", "payload MB", "ratio", "decode MB/s", "codecs");
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+      auto const& column = columns[i];
+      const double stored_mb = column.stored / (1024.0 * 1024.0);
+      const double payload_mb = column.payload / (1024.0 * 1024.0);
+      const double decode_seconds = to_seconds(column.decoding);
+
+      std::string codecs;
+      for (std::size_t codec = 0; codec < column.codecs.size(); ++codec) {
+        if (column.codecs[codec] != 0) {
+          codecs += std::string{ prescience_helper::blob_codec::CODEC_NAMES[codec] } + ":" + std::to_string(column.codecs[codec]) + " ";
+        }
+      }
+
+      fprintf(stdout, "%-8s %10llu %12.2f %12.2f %7.2f %12.1f  %s\n",
+        std::string{ prescience_helper::migrations::BLOB_COLUMN_NAMES[i] }.c_str(),
+        static_cast<unsigned long long>(column.blobs),
+        stored_mb,
+        payload_mb,
+        column.stored == 0 ? 0.0 : static_cast<double>(column.payload) / column.stored,
+        decode_seconds == 0 ? 0.0 : payload_mb / decode_seconds,
+        codecs.c_str());
+    }
+
+    //what each column would cost on disk and to read with every codec, on the same sample
+    fprintf(stdout, "\n%-8s %-6s %10s %12s %7s %12s\n", "column", "codec", "sample", "stored MB", "ratio", "decode MB/s");
+    for (std::size_t i = 0; i < sampled.size(); ++i) {
+      for (std::size_t codec = 0; codec < sampled[i].size(); ++codec) {
+        const auto name = std::string{ prescience_helper::blob_codec::CODEC_NAMES[codec] };
+        const auto column_name = std::string{ prescience_helper::migrations::BLOB_COLUMN_NAMES[i] };
+        if (!prescience_helper::blob_codec::available(static_cast<prescience_helper::blob_codec::Codec>(codec))) {
+          fprintf(stdout, "%-8s %-6s %10s\n", column_name.c_str(), name.c_str(), "n/a");
+          continue;
+        }
+        auto const& timing = sampled[i][codec];
+        const double decode_seconds = to_seconds(timing.decoding);
+        fprintf(stdout, "%-8s %-6s %10llu %12.2f %7.2f %12.1f\n",
+          column_name.c_str(),
+          name.c_str(),
+          static_cast<unsigned long long>(sampled_blobs[i]),
+          timing.stored / (1024.0 * 1024.0),
+          timing.stored == 0 ? 0.0 : static_cast<double>(timing.payload) / timing.stored,
+          decode_seconds == 0 ? 0.0 : timing.payload / (1024.0 * 1024.0) / decode_seconds);
+      }
+    }
+    fprintf(stdout, "\n");
+
+    const bool indexed = report_index_use(db);
+
+    if (!time_ascii_85()) {
+      return 1;
+    }
+
+    if (!args.option("encounter") && !args.option("difficulty")) {
+      return indexed ? 0 : 1;
+    }
+
+    const auto parsed = generate_args(db, args);
+    const auto repeats = args.int_option("repeat", DEFAULT_TIMING_REPEATS);
+    if (!parsed || !repeats || *repeats < 1) {
+      return 1;
+    }
+
+    const std::string input = read_stdin();
+    prescience_helper::Generator generator{ db };
+    std::vector<double> took;
+    for (std::int32_t i = 0; i < *repeats; ++i) {
+      const auto start = Clock::now();
+      const auto generated = generator.generate(input, parsed->encounter, parsed->difficulty, parsed->window_size);
+      took.push_back(to_seconds(Clock::now() - start) * 1000);
+      if (!generated.error.empty()) {
+        fprintf(stderr, "%s\n", generated.error.c_str());
+        return 1;
+      }
+      if (i == 0 && !round_trips(generated.output)) {
+        fprintf(stderr, "Generated output didn't survive a round trip\n");
+        return 1;
+      }
+    }
+    std::sort(took.begin(), took.end());
+    fprintf(stdout, "generate x%d: min %.2fms, median %.2fms, max %.2fms\n", *repeats, took.front(), took[took.size() / 2], took.back());
+
+    //the same input answered in each payload version
+    const auto found_version_delim = input.find('?');
+    if (found_version_delim != std::string::npos) {
+      for (const auto version : { prescience_helper::payload::Version::v2, prescience_helper::payload::Version::v3 }) {
+        const std::string_view prefix = prescience_helper::payload::version_prefix(version);
+        const auto generated = generator.generate(std::string{ prefix } + input.substr(found_version_delim + 1), parsed->encounter, parsed->difficulty, parsed->window_size);
+        if (!generated.error.empty() || !round_trips(generated.output)) {
+          fprintf(stderr, "Couldn't generate payload version %.*s\n", static_cast<std::int32_t>(prefix.size() - 1), prefix.data());
+          return 1;
+        }
+        fprintf(stdout, "payload v%.*s: %zu chars\n", static_cast<std::int32_t>(prefix.size() - 1), prefix.data(), generated.output.size());
+      }
+    }
+    return indexed ? 0 : 1;
+  }
+
+  int serve(std::filesystem::path const& db_path, Args const& args) {
+    const auto port = args.int_option("port", prescience_helper::serve::DEFAULT_PORT);
+    const auto connections = args.int_option("connections", std::max<std::int32_t>(1, std::thread::hardware_concurrency()));
+    if (!port || *port < 1 || *port > 65535 || !connections || *connections < 1) {
+      return 1;
+    }
+
+    prescience_helper::serve::Options options;
+    options.db_path = db_path;
+    options.port = static_cast<std::uint16_t>(*port);
+    options.connections = static_cast<std::size_t>(*connections);
+    if (const auto logs = args.option("logs"); logs) {
+      options.logs = std::filesystem::path{ *logs };
+      if (!std::filesystem::is_directory(*options.logs)) {
+        fprintf(stderr, "'%s' isn't a directory\n", options.logs->string().c_str());
+        return 1;
+      }
+    }
+    return prescience_helper::serve::run(options);
+  }
+}
+
+int main(int argc, char** argv) {
+  const Args args{ argc, argv };
+  if (args.positional().empty()) {
+    usage();
+    return 1;
+  }
+
+  const std::filesystem::path db_path{ args.option("db").value_or(prescience_helper::database::DEFAULT_PATH) };
+  auto db = prescience_helper::database::open(db_path);
+  if (!db) {
+    fprintf(stderr, "Couldn't open database: %s\n", db_path.string().c_str());
+    return 1;
+  }
+
+  const auto prepared = prescience_helper::database::prepare(*db, [](prescience_helper::migrations::Progress const& progress) {
+    fprintf(stderr, "%.*s (%d -> %d): %llu/%llu\n",
+      (std::int32_t)progress.migration->description.size(), progress.migration->description.data(),
+      progress.from,
+      progress.to,
+      static_cast<unsigned long long>(progress.done),
+      static_cast<unsigned long long>(progress.total));
+    });
+  switch (prepared) {
+  case prescience_helper::database::Result::ready:
+    break;
+  case prescience_helper::database::Result::couldnt_create:
+    fprintf(stderr, "Couldn't create tables in %s\n", db_path.string().c_str());
+    return 1;
+  case prescience_helper::database::Result::too_new:
+    fprintf(stderr, "%s was made by a newer version of Prescience Helper\n", db_path.string().c_str());
+    return 1;
+  default:
+    fprintf(stderr, "%s can't be upgraded to this version of Prescience Helper\n", db_path.string().c_str());
+    return 1;
+  }
+
+  const auto dbc_pack_arg = args.option("dbc-pack");
+  const std::filesystem::path dbc_pack_path = dbc_pack_arg
+    ? std::filesystem::path{ *dbc_pack_arg }
+    : db_path.parent_path() / prescience_helper::sim::dbc::pack::DEFAULT_FILE_NAME;
+  if (dbc_pack_arg || std::filesystem::exists(dbc_pack_path)) {
+    try {
+      prescience_helper::sim::dbc::pack::load(dbc_pack_path);
+    } catch (std::exception const& e) {
+      fprintf(stderr, "%s\n", e.what());
+      return 1;
+    }
+  }
+
+  prescience_helper::trace::name_thread("main");
+  const auto command = args.positional()[0];
+  const int result = [&]() {
+    if (command == "ingest") {
+      return ingest(*db, args);
+    } else if (command == "resimulate") {
+      return resimulate(*db, args);
+    } else if (command == "generate") {
+      return generate(*db, args);
+    } else if (command == "timing") {
+      return timing(*db, args);
+    } else if (command == "serve") {
+      return serve(db_path, args);
+    }
+    usage();
+    return 1;
+  }();
+
+  if (const auto trace_path = args.option("trace")) {
+    if (!prescience_helper::trace::ENABLED) {
+      fprintf(stderr, "Not writing a trace, this build doesn't have PRESCIENCE_HELPER_TRACING\n");
+    } else if (!prescience_helper::trace::write(std::filesystem::path{ *trace_path })) {
+      fprintf(stderr, "Couldn't write trace: %.*s\n", (std::int32_t)trace_path->size(), trace_path->data());
+    }
+  }
+  return result;
+}
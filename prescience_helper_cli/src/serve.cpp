@@ -0,0 +1,447 @@
+#include <prescience_helper/serve.hpp>
+#include <prescience_helper/database.hpp>
+#include <prescience_helper/generator_pool.hpp>
+#include <prescience_helper/parse_thread.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace serve = prescience_helper::serve;
+
+namespace {
+#ifdef _WIN32
+  using Socket = SOCKET;
+  constexpr Socket INVALID = INVALID_SOCKET;
+
+  void close_socket(Socket socket) {
+    closesocket(socket);
+  }
+#else
+  using Socket = int;
+  constexpr Socket INVALID = -1;
+
+  void close_socket(Socket socket) {
+    close(socket);
+  }
+#endif
+
+  constexpr std::size_t MAX_HEADER_SIZE = 16 * 1024;
+  constexpr std::size_t MAX_BODY_SIZE = 1024 * 1024;
+  constexpr std::chrono::seconds RECEIVE_TIMEOUT{ 5 };
+  constexpr std::chrono::milliseconds ACCEPT_POLL{ 500 };
+  //http workers per read connection, so slow clients don't hold a connection idle
+  constexpr std::size_t WORKERS_PER_CONNECTION = 2;
+
+  constexpr std::int32_t DEFAULT_WINDOW_SIZE = 10;
+
+  std::atomic<bool> interrupted = false;
+
+  extern "C" void on_interrupt(int) {
+    interrupted = true;
+  }
+
+  struct Request {
+    std::string method;
+    std::string path;
+    std::string query;
+    std::string body;
+  };
+
+  struct Response {
+    int status;
+    std::string body;
+  };
+
+  std::string_view status_text(int status) {
+    switch (status) {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 413: return "Payload Too Large";
+    default: return "Internal Server Error";
+    }
+  }
+
+  int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  }
+
+  std::string url_decode(std::string_view in) {
+    std::string returning;
+    returning.reserve(in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      if (in[i] == '+') {
+        returning.push_back(' ');
+      } else if (in[i] == '%' && i + 2 < in.size() && hex_value(in[i + 1]) >= 0 && hex_value(in[i + 2]) >= 0) {
+        returning.push_back(static_cast<char>(hex_value(in[i + 1]) * 16 + hex_value(in[i + 2])));
+        i += 2;
+      } else {
+        returning.push_back(in[i]);
+      }
+    }
+    return returning;
+  }
+
+  std::optional<std::string> query_param(std::string_view query, std::string_view name) {
+    while (!query.empty()) {
+      const auto amp = query.find('&');
+      const auto pair = query.substr(0, amp);
+      const auto equals = pair.find('=');
+      if (pair.substr(0, equals) == name) {
+        return equals == std::string_view::npos ? std::string{} : url_decode(pair.substr(equals + 1));
+      }
+      if (amp == std::string_view::npos) {
+        break;
+      }
+      query = query.substr(amp + 1);
+    }
+    return std::nullopt;
+  }
+
+  bool send_all(Socket socket, std::string_view data) {
+    while (!data.empty()) {
+      const auto sent = send(socket, data.data(), static_cast<int>(data.size()), 0);
+      if (sent <= 0) {
+        return false;
+      }
+      data = data.substr(static_cast<std::size_t>(sent));
+    }
+    return true;
+  }
+
+  void send_response(Socket socket, Response const& response) {
+    const auto status = status_text(response.status);
+    std::string writing =
+      "HTTP/1.1 " + std::to_string(response.status) + " " + std::string{ status } + "\r\n"
+      "Content-Type: text/plain; charset=utf-8\r\n"
+      "Content-Length: " + std::to_string(response.body.size()) + "\r\n"
+      "Connection: close\r\n"
+      "\r\n";
+    writing += response.body;
+    send_all(socket, writing);
+  }
+
+  //returns the status to reply with if the request couldn't be read, 0 on success
+  int read_request(Socket socket, Request& out) {
+    std::string received;
+    std::size_t header_end = std::string::npos;
+    char buffer[4096];
+
+    while (header_end == std::string::npos) {
+      if (received.size() > MAX_HEADER_SIZE) {
+        return 413;
+      }
+      const auto got = recv(socket, buffer, sizeof(buffer), 0);
+      if (got <= 0) {
+        return 400;
+      }
+      received.append(buffer, static_cast<std::size_t>(got));
+      header_end = received.find("\r\n\r\n");
+    }
+
+    const std::string_view header{ received.data(), header_end };
+    const auto request_line_end = header.find("\r\n");
+    const auto request_line = header.substr(0, request_line_end);
+
+    const auto first_space = request_line.find(' ');
+    const auto second_space = request_line.find(' ', first_space + 1);
+    if (first_space == std::string_view::npos || second_space == std::string_view::npos) {
+      return 400;
+    }
+    out.method = request_line.substr(0, first_space);
+    const auto target = request_line.substr(first_space + 1, second_space - first_space - 1);
+    const auto question = target.find('?');
+    out.path = target.substr(0, question);
+    out.query = question == std::string_view::npos ? std::string_view{} : target.substr(question + 1);
+
+    std::size_t content_length = 0;
+    std::string_view headers = request_line_end == std::string_view::npos ? std::string_view{} : header.substr(request_line_end + 2);
+    while (!headers.empty()) {
+      const auto line_end = headers.find("\r\n");
+      const auto line = headers.substr(0, line_end);
+      const auto colon = line.find(':');
+      if (colon != std::string_view::npos) {
+        std::string name{ line.substr(0, colon) };
+        for (auto& c : name) {
+          c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        auto value = line.substr(colon + 1);
+        while (!value.empty() && value.front() == ' ') {
+          value.remove_prefix(1);
+        }
+        if (name == "content-length") {
+          const auto res = std::from_chars(value.data(), value.data() + value.size(), content_length);
+          if (res.ec != std::errc()) {
+            return 400;
+          }
+        }
+      }
+      if (line_end == std::string_view::npos) {
+        break;
+      }
+      headers = headers.substr(line_end + 2);
+    }
+
+    if (content_length > MAX_BODY_SIZE) {
+      return 413;
+    }
+
+    out.body = received.substr(header_end + 4);
+    while (out.body.size() < content_length) {
+      const auto got = recv(socket, buffer, sizeof(buffer), 0);
+      if (got <= 0) {
+        return 400;
+      }
+      out.body.append(buffer, static_cast<std::size_t>(got));
+    }
+    out.body.resize(content_length);
+
+    while (!out.body.empty() && std::isspace(static_cast<unsigned char>(out.body.back()))) {
+      out.body.pop_back();
+    }
+
+    return 0;
+  }
+
+  Response generate(prescience_helper::Generator_pool& pool, Request const& request) {
+    const auto encounter_arg = query_param(request.query, "encounter");
+    const auto difficulty_arg = query_param(request.query, "difficulty");
+    if (!encounter_arg || !difficulty_arg) {
+      return Response{ 400, "encounter and difficulty are required" };
+    }
+
+    std::int32_t window = DEFAULT_WINDOW_SIZE;
+    if (const auto window_arg = query_param(request.query, "window"); window_arg) {
+      const auto res = std::from_chars(window_arg->data(), window_arg->data() + window_arg->size(), window);
+      if (res.ec != std::errc() || window < 1 || window > 300) {
+        return Response{ 400, "window must be between 1 and 300" };
+      }
+    }
+
+    auto connection = pool.acquire();
+
+    const auto encounter = prescience_helper::database::find_id(connection->db, "Encounter_type", *encounter_arg);
+    if (!encounter) {
+      return Response{ 400, "Unknown encounter '" + *encounter_arg + "'" };
+    }
+    const auto difficulty = prescience_helper::database::find_id(connection->db, "Difficulty", *difficulty_arg);
+    if (!difficulty) {
+      return Response{ 400, "Unknown difficulty '" + *difficulty_arg + "'" };
+    }
+
+    const auto generated = connection->generator.generate(request.body, *encounter, *difficulty, std::chrono::milliseconds{ window * 100 });
+    if (!generated.error.empty()) {
+      return Response{ 400, generated.error };
+    }
+    return Response{ 200, generated.output };
+  }
+
+  void handle(prescience_helper::Generator_pool& pool, Socket socket) {
+    Request request;
+    if (const auto failed = read_request(socket, request); failed != 0) {
+      send_response(socket, Response{ failed, std::string{ status_text(failed) } });
+      return;
+    }
+
+    if (request.path == "/generate") {
+      if (request.method != "POST") {
+        send_response(socket, Response{ 405, "POST the addon output string" });
+        return;
+      }
+      try {
+        send_response(socket, generate(pool, request));
+      } catch (std::exception const& e) {
+        send_response(socket, Response{ 500, e.what() });
+      }
+    } else if (request.path == "/health") {
+      send_response(socket, Response{ 200, "ok" });
+    } else {
+      send_response(socket, Response{ 404, "Not found" });
+    }
+  }
+
+  void set_receive_timeout(Socket socket) {
+#ifdef _WIN32
+    const DWORD timeout = static_cast<DWORD>(std::chrono::duration_cast<std::chrono::milliseconds>(RECEIVE_TIMEOUT).count());
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+#else
+    timeval timeout{};
+    timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(RECEIVE_TIMEOUT.count());
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+#endif
+  }
+
+  Socket listen_on(std::uint16_t port) {
+    const Socket listening = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listening == INVALID) {
+      return INVALID;
+    }
+
+    const int reuse = 1;
+    setsockopt(listening, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    //loopback only, this isn't meant to be reachable from outside the machine
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(listening, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+      || listen(listening, SOMAXCONN) != 0) {
+      close_socket(listening);
+      return INVALID;
+    }
+    return listening;
+  }
+
+  //true if a connection is waiting, false on timeout
+  bool wait_for_connection(Socket listening) {
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(listening, &readable);
+    timeval timeout{};
+    timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>(std::chrono::duration_cast<std::chrono::microseconds>(ACCEPT_POLL).count());
+    return select(static_cast<int>(listening) + 1, &readable, nullptr, nullptr, &timeout) > 0;
+  }
+}
+
+int serve::run(Options const& options) {
+#ifdef _WIN32
+  WSADATA wsa_data;
+  if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0) {
+    fprintf(stderr, "Couldn't start winsock\n");
+    return 1;
+  }
+#endif
+
+  std::optional<Parse_thread> parse_thread;
+  if (options.logs) {
+    auto parser_db = database::open(options.db_path);
+    if (!parser_db) {
+      fprintf(stderr, "Couldn't open database: %s\n", options.db_path.string().c_str());
+      return 1;
+    }
+    database::enable_concurrent_readers(*parser_db);
+    parse_thread.emplace(*options.logs, std::move(*parser_db));
+    parse_thread->db_.exec<std::string_view, std::int64_t, std::int64_t, std::optional<std::int32_t>>("SELECT path,useful_amount,total_amount,last_patch FROM Logs_read;",
+      [&parse_thread](std::string_view path, std::int64_t useful_amount, std::int64_t total_amount, std::optional<std::int32_t> last_patch) {
+        parse_thread->log_finder.set_log_read(path, useful_amount, total_amount, last_patch);
+      });
+  }
+
+  Generator_pool pool{ options.db_path, options.connections };
+  if (!pool.valid()) {
+    fprintf(stderr, "Couldn't open read connections to %s\n", options.db_path.string().c_str());
+    return 1;
+  }
+
+  const Socket listening = listen_on(options.port);
+  if (listening == INVALID) {
+    fprintf(stderr, "Couldn't listen on 127.0.0.1:%hu\n", options.port);
+    return 1;
+  }
+
+  std::signal(SIGINT, on_interrupt);
+  std::signal(SIGTERM, on_interrupt);
+#ifndef _WIN32
+  //a client hanging up before its reply is written would otherwise kill us, send_all sees EPIPE instead
+  std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+  if (parse_thread) {
+    parse_thread->thread = std::thread{ Parse_thread::run, &*parse_thread };
+  }
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::deque<Socket> accepted;
+  bool stopping = false;
+
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < options.connections * WORKERS_PER_CONNECTION; ++i) {
+    workers.emplace_back([&]() {
+      trace::name_thread("http worker");
+      for (;;) {
+        Socket handling;
+        {
+          std::unique_lock lock{ mutex };
+          changed.wait(lock, [&]() { return !accepted.empty() || stopping; });
+          if (accepted.empty()) {
+            return;
+          }
+          handling = accepted.front();
+          accepted.pop_front();
+        }
+        handle(pool, handling);
+        close_socket(handling);
+      }
+    });
+  }
+
+  fprintf(stderr, "Serving on http://127.0.0.1:%hu with %zu read connection(s)\n", options.port, options.connections);
+
+  while (!interrupted) {
+    if (!wait_for_connection(listening)) {
+      continue;
+    }
+    const Socket client = accept(listening, nullptr, nullptr);
+    if (client == INVALID) {
+      continue;
+    }
+    set_receive_timeout(client);
+    {
+      std::lock_guard lock{ mutex };
+      accepted.push_back(client);
+    }
+    changed.notify_one();
+  }
+
+  {
+    std::lock_guard lock{ mutex };
+    stopping = true;
+  }
+  changed.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  close_socket(listening);
+
+  if (parse_thread) {
+    parse_thread->stop();
+    parse_thread->thread.join();
+  }
+
+#ifdef _WIN32
+  WSACleanup();
+#endif
+  return 0;
+}
@@ -1,6 +1,5 @@
 #pragma once
 #include <cstdint>
-#include <unordered_map>
 
 namespace prescience_helper::sim::dbc {
   struct Combat_ratings_mult_by_ilvl {
@@ -14,6 +13,7 @@ namespace prescience_helper::sim::dbc {
       ilvl(ilvl), armor(armor), weapon(weapon), trinket(trinket), jewelry(jewelry) { }
   };
 
-  extern const std::unordered_map<std::uint16_t, Combat_ratings_mult_by_ilvl> COMBAT_RATINGS_MULT_BY_ILVL;
+  //nullptr if the ilvl isn't in the table
+  Combat_ratings_mult_by_ilvl const* combat_ratings_mult_by_ilvl(std::uint16_t ilvl) noexcept;
 }
 
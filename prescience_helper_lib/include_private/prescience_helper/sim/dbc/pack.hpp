@@ -0,0 +1,34 @@
+#pragma once
+
+#include <prescience_helper/sim/dbc_pack.hpp>
+#include <prescience_helper/sim/dbc/item_sparse.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace prescience_helper::sim::dbc::pack {
+  struct Mapped_section {
+    const std::byte* data;
+    std::uint64_t count;
+  };
+
+  //nullptr unless a loaded pack has section
+  Mapped_section const* mapped(Section section) noexcept;
+
+  //the loaded pack's section, or compiled if there isn't one. load checked the section's records are Ts
+  template<typename T>
+  std::span<const T> table(Section section, std::span<const T> compiled) noexcept {
+    const auto found = mapped(section);
+    if (found == nullptr) {
+      return compiled;
+    }
+    return { reinterpret_cast<const T*>(found->data), static_cast<std::size_t>(found->count) };
+  }
+}
+
+namespace prescience_helper::sim::dbc {
+  //from the loaded pack if it has items, ITEM_SPARSE otherwise
+  std::optional<Item_sparse> find_item_sparse(std::uint64_t id) noexcept;
+}
@@ -1,7 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <array>
-#include <unordered_map>
+
 namespace prescience_helper::sim::dbc {
   struct Rand_prop_point {
     std::uint32_t ilvl;
@@ -10,6 +10,7 @@ namespace prescience_helper::sim::dbc {
     std::array<float,5> budget;
   };
 
-  extern const std::unordered_map<std::uint32_t,Rand_prop_point> RAND_PROP_POINT;
+  //nullptr if the ilvl isn't in the table
+  Rand_prop_point const* rand_prop_point(std::uint32_t ilvl) noexcept;
 }
 
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+namespace prescience_helper::sim::dbc {
+  constexpr std::uint8_t SPELL_CAN_NOT_CRIT = 1;
+  constexpr std::uint8_t SPELL_ALLOW_CLASS_ABILITY_PROCS = 2;
+  constexpr std::uint8_t SPELL_SCALES_WITH_PRIMARY = 4;
+
+  //the SPELL_* bits that apply to spell_id, 0 for spells we know nothing about
+  std::uint8_t spell_attributes(std::uint64_t spell_id) noexcept;
+}
+
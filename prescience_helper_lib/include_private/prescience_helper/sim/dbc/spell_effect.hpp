@@ -1,7 +0,0 @@
-#pragma once
-#include <cstdint>
-
-namespace prescience_helper::sim::dbc {
-  bool scales_with_primary(std::uint64_t) noexcept;
-}
-
@@ -1,7 +1,32 @@
 #pragma once
 
 #include <prescience_helper/sim.hpp>
+#include <prescience_helper/sim/spells.hpp>
 
 namespace prescience_helper::sim::specs {
-  std::unique_ptr<Player_state> create_aug(clogparser::events::Combatant_info const&);
-}
\ No newline at end of file
+  struct Aug_player_state final : public Player_state {
+  public:
+    static constexpr std::uint64_t UPHEAVAL = 396288;
+
+    Aug_player_state(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache);
+
+    static bool handles(clogparser::SpecId spec) noexcept {
+      return spec == clogparser::SpecId::evoker_augmentation;
+    }
+
+    Damage impact(std::uint64_t spell_id, std::uint8_t attributes, bool crit, Target_state const& target, std::int64_t historical_damage_done) const override {
+      switch (spell_id) {
+      case UPHEAVAL: return calc_spell(attributes, crit, *this, target, historical_damage_done, spell_scaling_.upheaval);
+      default: return calc_spell(attributes, crit, *this, target, historical_damage_done);
+      }
+    }
+  protected:
+    void handle_aura(Unit caster, std::uint64_t spell_id, std::uint8_t new_stacks, std::uint8_t old_stacks) override;
+  private:
+    void apply_talent_(clogparser::events::Combatant_info::Talent const& talent);
+
+    struct {
+      Damage_amp upheaval;
+    } spell_scaling_;
+  };
+}
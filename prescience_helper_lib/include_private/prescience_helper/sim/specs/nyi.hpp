@@ -0,0 +1,19 @@
+#pragma once
+
+#include <prescience_helper/sim.hpp>
+#include <optional>
+
+namespace prescience_helper::sim::specs {
+  //every spec without a module of its own, with the primary stat of its role and flat crit and mastery
+  struct Nyi_spec final : public Player_state {
+  public:
+    Nyi_spec(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache);
+
+    static bool handles(clogparser::SpecId spec) noexcept {
+      return primary_stat_of(spec).has_value();
+    }
+
+    //nullopt for specs we don't know
+    static std::optional<clogparser::Attribute_rating> primary_stat_of(clogparser::SpecId spec) noexcept;
+  };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <prescience_helper/sim.hpp>
+#include <prescience_helper/sim/specs/aug.hpp>
+#include <prescience_helper/sim/specs/nyi.hpp>
+#include <memory>
+#include <stdexcept>
+
+namespace prescience_helper::sim::specs {
+  template<typename ...Specs>
+  struct Spec_list {};
+
+  //every spec module. Each is final, constructed from (Combatant_info const&, Gear_cache*) and has
+  //static bool handles(clogparser::SpecId). A spec goes to the first module that handles it, so Nyi_spec is last
+  using All = Spec_list<Aug_player_state, Nyi_spec>;
+
+  namespace registry_impl {
+    template<typename Spec, typename ...Rest, typename With>
+    decltype(auto) create(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache, With& with) {
+      if (Spec::handles(c_info.current_spec_id)) {
+        return with(std::make_unique<Spec>(c_info, gear_cache));
+      }
+      if constexpr (sizeof...(Rest) > 0) {
+        return create<Rest...>(c_info, gear_cache, with);
+      } else {
+        throw std::runtime_error("Unknown spec");
+      }
+    }
+
+    template<typename With, typename ...Specs>
+    decltype(auto) create(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache, With& with, Spec_list<Specs...>) {
+      return create<Specs...>(c_info, gear_cache, with);
+    }
+  }
+
+  //creates c_info's spec module and calls with with a std::unique_ptr to the module's own type, so with can
+  //call it without virtual dispatch. with has to return the same type for every module.
+  //throws std::runtime_error if no module handles the spec
+  template<typename With>
+  decltype(auto) create(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache, With&& with) {
+    return registry_impl::create(c_info, gear_cache, with, All{});
+  }
+}
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <prescience_helper/sim.hpp>
+#include <prescience_helper/sim/helpers.hpp>
+#include <prescience_helper/sim/dbc/spell_attributes.hpp>
 #include <clogparser/types.hpp>
+#include <cassert>
 
+//inline, so the per spec event loops in on_rails can inline the whole calculation
 namespace prescience_helper::sim {
 
   template<typename ...Amps>
@@ -13,6 +17,54 @@ namespace prescience_helper::sim {
     return returning;
   }
 
-  Damage calc_swing(bool crit, Player_state const& caster, Target_state const& castee, std::int64_t historical_damage_done, Damage_amp = {});
-  Damage calc_spell(std::uint64_t spell_id, bool crit, Player_state const& caster, Target_state const& castee, std::int64_t historical_damage_done, Damage_amp = {});
-}
\ No newline at end of file
+  namespace spells_impl {
+    inline Damage calc(bool crit, Player_state const& caster, Target_state const& castee, std::int64_t historical_damage_done, Damage_amp scaling, std::uint8_t attributes) {
+      Damage returning;
+
+      const bool scales_with_primary = (attributes & dbc::SPELL_SCALES_WITH_PRIMARY) != 0;
+      const bool can_not_crit = (attributes & dbc::SPELL_CAN_NOT_CRIT) != 0;
+      returning.allow_class_ability_procs = (attributes & dbc::SPELL_ALLOW_CLASS_ABILITY_PROCS) != 0;
+
+      //only changes on aura events, so it's worked out once per change rather than per hit
+      auto const& effective = caster.effective_stats();
+
+      Damage_amp amp = calc_amps(scaling, caster.damage_done, castee.damage_taken);
+
+      //set base
+      returning.base_scaling = historical_damage_done;
+
+      //handle primary scaling
+      returning.scales_with_primary = scales_with_primary;
+      if (scales_with_primary) {
+        returning.base_scaling /= effective.primary;
+      }
+
+      //handle vers scaling
+      returning.base_scaling /= effective.vers_mult;
+
+      returning.can_not_crit = can_not_crit;
+      assert(!(can_not_crit && crit));
+      if (can_not_crit) {
+        returning.amp.crit_amp = 1;
+        returning.amp.crit_chance_add = 0;
+      } else {
+        //handle crit
+        returning.amp = amp;
+        if (crit) { //if crit take that away
+          returning.base_scaling /= amp.crit_amp * 2;
+        }
+      }
+
+      return returning;
+    }
+  }
+
+  inline Damage calc_swing(bool crit, Player_state const& caster, Target_state const& castee, std::int64_t historical_damage_done, Damage_amp scaling = {}) {
+    //melee swings scale with primary and can crit
+    return spells_impl::calc(crit, caster, castee, historical_damage_done, scaling, dbc::SPELL_SCALES_WITH_PRIMARY);
+  }
+  //attributes are the spell's dbc::spell_attributes
+  inline Damage calc_spell(std::uint8_t attributes, bool crit, Player_state const& caster, Target_state const& castee, std::int64_t historical_damage_done, Damage_amp scaling = {}) {
+    return spells_impl::calc(crit, caster, castee, historical_damage_done, scaling, attributes);
+  }
+}
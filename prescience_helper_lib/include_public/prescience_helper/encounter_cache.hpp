@@ -0,0 +1,23 @@
+#pragma once
+
+#include <prescience_helper/ingest.hpp>
+
+#include <cstdint>
+#include <filesystem>
+
+//ingested encounters kept on disk, so they can be simulated again after the simulator changes without the log they
+//came from. Events are fixed width records in arrays, units and strings are indexes into tables at the front.
+//Only what simulating reads of the combatant info and encounter start is kept
+namespace prescience_helper::encounter_cache {
+  //bumped whenever the layout changes, files written with another version aren't read
+  constexpr std::uint32_t VERSION = 1;
+
+  constexpr std::string_view EXTENSION = ".phenc";
+
+  //spilled events are read back from the encounter's spill file. Throws std::runtime_error if it can't be written
+  void write(std::filesystem::path const& path, Encounter const& encounter);
+
+  //the encounter's strings are put in strings, which has to outlive it. Every event is in memory, sorted.
+  //Throws std::runtime_error if the file can't be read, is cut short or was written with another VERSION
+  Encounter read(std::filesystem::path const& path, clogparser::String_store& strings);
+}
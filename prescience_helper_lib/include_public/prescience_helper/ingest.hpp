@@ -1,8 +1,13 @@
 #pragma once
 
+#include <prescience_helper/spill.hpp>
+
 #include <vector>
 #include <string_view>
 #include <chrono>
+#include <filesystem>
+#include <functional>
+#include <memory>
 #include <clogparser/parser.hpp>
 
 
@@ -30,12 +35,16 @@ namespace prescience_helper {
   struct Spell_impact {
     std::uint64_t id;
     bool crit;
+    //the spell's sim::dbc SPELL_* bits, resolved at ingest so simulating never looks them up
+    std::uint8_t attributes;
     std::int64_t damage_done;
     Target* target;
   };
   struct Spell_tick {
     std::uint64_t id;
     bool crit;
+    //the spell's sim::dbc SPELL_* bits, resolved at ingest so simulating never looks them up
+    std::uint8_t attributes;
     std::int64_t damage_done;
     Target* target;
   };
@@ -51,17 +60,42 @@ namespace prescience_helper {
     Swing swing;
   };
   
+  //one kind of event for one unit. When ingest goes over its memory budget, in_memory is sorted and
+  //moved to the encounter's spill file as a new run. Every run, and in_memory once the encounter ends, is sorted by when
+  template<typename T>
+  struct Event_column {
+    std::vector<Event<T>> in_memory;
+    std::vector<Spill_segment> spilled;
+
+    void push_back(Event<T> const& event) {
+      in_memory.push_back(event);
+    }
+
+    std::size_t size() const noexcept {
+      std::size_t returning = in_memory.size();
+      for (auto const& segment : spilled) {
+        returning += segment.count;
+      }
+      return returning;
+    }
+
+    bool empty() const noexcept {
+      return size() == 0;
+    }
+  };
+
+
   struct Target {
     std::string_view name;
-    std::vector<Event<Aura_changed>> aura_changed;
+    Event_column<Aura_changed> aura_changed;
   };
 
   struct Player : public Target {
     clogparser::events::Combatant_info info;
-    std::vector<Event<Spell_impact>> spell_impact;
-    std::vector<Event<Spell_tick>> spell_tick;
-    std::vector<Event<Swing>> swing;
-    std::vector<Event<Pet_swing>> pet_swing;
+    Event_column<Spell_impact> spell_impact;
+    Event_column<Spell_tick> spell_tick;
+    Event_column<Swing> swing;
+    Event_column<Pet_swing> pet_swing;
     std::vector<Event<void>> died;
     std::vector<Event<void>> rezzed;
   };
@@ -83,11 +117,26 @@ namespace prescience_helper {
     std::unordered_map<std::string_view, Player> players;
     std::size_t start_byte = 0;
     std::size_t end_byte = 0;
+    //Ingest_options::skip_encounter matched at ENCOUNTER_START, only the start, the build and when and where it ended are filled in
+    bool skipped = false;
+    //heap bytes of ingest's pet/guardian staging when the encounter ended, see memory.hpp
+    std::size_t friendlies_bytes = 0;
+    //only created if some of this encounter's events were spilled
+    std::shared_ptr<Spill_file> spill;
   };
 
   struct File {
     virtual std::string_view next() = 0;
   };
 
-  void ingest(File& log, clogparser::String_store& strings, std::vector<Encounter>& out);
+  struct Ingest_options {
+    //bytes of events ingest may keep in memory before spilling them, 0 for no limit
+    std::size_t memory_budget = 0;
+    //where spill files are made, the system's temp directory if empty
+    std::filesystem::path spill_directory;
+    //asked at every ENCOUNTER_START, true fast-forwards to the encounter's end without keeping any of its events
+    std::function<bool(Encounter const&)> skip_encounter;
+  };
+
+  void ingest(File& log, clogparser::String_store& strings, std::vector<Encounter>& out, Ingest_options const& options = {});
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <prescience_helper/ingest.hpp>
+#include <prescience_helper/sim/on_rails.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//walks ingest and simulation structures, adding up the heap bytes their containers asked the allocator for.
+//allocator overhead isn't counted, and strings are views into a String_store so only the view is
+namespace prescience_helper::memory {
+#if defined(_MSC_VER)
+  //std::list node (next, prev) per element, and a first/last iterator pair per bucket
+  constexpr std::size_t MAP_NODE_OVERHEAD = 2 * sizeof(void*);
+  constexpr std::size_t MAP_BUCKET_SIZE = 2 * sizeof(void*);
+  template<typename Key>
+  constexpr std::size_t MAP_CACHED_HASH = 0;
+#else
+  //libstdc++ and libc++, next pointer per node and a pointer per bucket. libstdc++ also keeps the hash of non integer keys
+  constexpr std::size_t MAP_NODE_OVERHEAD = sizeof(void*);
+  constexpr std::size_t MAP_BUCKET_SIZE = sizeof(void*);
+  template<typename Key>
+  constexpr std::size_t MAP_CACHED_HASH = std::is_integral_v<Key> ? 0 : sizeof(std::size_t);
+#endif
+
+  template<typename T>
+  std::size_t heap_bytes(std::vector<T> const& vec) noexcept {
+    return vec.capacity() * sizeof(T);
+  }
+
+  //only the map itself, not anything its values own
+  template<typename Key, typename Value, typename ...Rest>
+  std::size_t heap_bytes(std::unordered_map<Key, Value, Rest...> const& map) noexcept {
+    return map.size() * (sizeof(std::pair<const Key, Value>) + MAP_NODE_OVERHEAD + MAP_CACHED_HASH<Key>)
+      + map.bucket_count() * MAP_BUCKET_SIZE;
+  }
+
+  //only what's in memory, spilled events are on disk
+  template<typename T>
+  std::size_t heap_bytes(Event_column<T> const& column) noexcept {
+    return heap_bytes(column.in_memory) + heap_bytes(column.spilled);
+  }
+
+  std::size_t heap_bytes(Target const& target) noexcept;
+  std::size_t heap_bytes(Player const& player) noexcept;
+  //the specs' extra members aren't counted, they're a handful of bytes per player
+  std::size_t heap_bytes(sim::Player_state const& player) noexcept;
+  std::size_t heap_bytes(sim::on_rails::Encounter const& encounter) noexcept;
+
+  struct Encounter_usage {
+    //the maps and everything the Targets/Players in them own
+    std::size_t targets = 0;
+    std::size_t players = 0;
+    //ingest's staging area for pets and guardians, at its largest just before the encounter ended
+    std::size_t friendlies = 0;
+    //the on_rails::Encounter simulating it produced
+    std::size_t simulated = 0;
+    //encoded Logged blobs, and the pulls' summaries
+    std::size_t blobs = 0;
+    //on disk in the encounter's spill file, not part of total
+    std::size_t spilled = 0;
+
+    std::size_t total() const noexcept {
+      return targets + players + friendlies + simulated + blobs;
+    }
+
+    //each field becomes the larger of the two
+    void high_water(Encounter_usage const& other) noexcept {
+      targets = std::max(targets, other.targets);
+      players = std::max(players, other.players);
+      friendlies = std::max(friendlies, other.friendlies);
+      simulated = std::max(simulated, other.simulated);
+      blobs = std::max(blobs, other.blobs);
+      spilled = std::max(spilled, other.spilled);
+    }
+  };
+
+  //fills targets, players, friendlies and spilled
+  Encounter_usage measure(Encounter const& encounter) noexcept;
+
+  struct Log_usage {
+    //every encounter in a log is ingested before the first is simulated, so this is all of them together
+    std::size_t ingested = 0;
+    //the largest of each field over the log's encounters
+    Encounter_usage encounter_high_water;
+    std::size_t encounter_total_high_water = 0;
+
+    void add(Encounter_usage const& encounter) noexcept {
+      encounter_high_water.high_water(encounter);
+      encounter_total_high_water = std::max(encounter_total_high_water, encounter.total());
+    }
+
+    void high_water(Log_usage const& other) noexcept {
+      ingested = std::max(ingested, other.ingested);
+      encounter_high_water.high_water(other.encounter_high_water);
+      encounter_total_high_water = std::max(encounter_total_high_water, other.encounter_total_high_water);
+    }
+  };
+
+  //the ingested encounters, and the vector holding them
+  std::size_t measure_ingested(std::vector<Encounter> const& encounters) noexcept;
+
+  //e.g. 512B, 1.5KB, 20.3MB
+  std::string format_bytes(std::size_t bytes);
+}
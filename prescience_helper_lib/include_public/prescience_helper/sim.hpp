@@ -4,10 +4,16 @@
 #include <clogparser/parser.hpp>
 #include <cstdint>
 #include <array>
+#include <bit>
 #include <vector>
 #include <cassert>
 #include <string_view>
 #include <numeric>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <unordered_map>
 #include <prescience_helper/ingest.hpp>
 
 namespace prescience_helper::sim {
@@ -55,6 +61,93 @@ namespace prescience_helper::sim {
 
   using Combat_stats = clogparser::Enum_indexed_array<Combat_stat, double, Combat_stat::COUNT>;
 
+  //one change of a Stats_timeline, points into the timeline it came from
+  struct Stats_delta {
+    //bit i set if Combat_stat i changed
+    std::uint8_t changed;
+    //the new values of the changed fields, in Combat_stat order
+    const double* values;
+
+    void apply(Combat_stats& stats) const noexcept {
+      std::size_t value = 0;
+      for (std::size_t i = 0; i < Combat_stats::size; ++i) {
+        if ((changed & (1 << i)) != 0) {
+          stats[static_cast<Combat_stat>(i)] = values[value++];
+        }
+      }
+    }
+  };
+
+  //a player's Combat_stats over time. Most changes touch one field, so each keeps which fields it changed and only
+  //their new values rather than all of them. Starts from all zero stats, and changes at the same time are merged
+  struct Stats_timeline {
+  public:
+    static_assert(Combat_stats::size <= 8, "the changed fields have to fit Stats_delta::changed");
+
+    struct Iterator {
+    public:
+      using value_type = Event<Stats_delta>;
+      using difference_type = std::ptrdiff_t;
+
+      Iterator() = default;
+      Iterator(Stats_timeline const* timeline, std::size_t change, std::size_t value) :
+        timeline_(timeline),
+        change_(change),
+        value_(value) {
+
+      }
+
+      value_type operator*() const noexcept {
+        return { timeline_->whens_[change_], Stats_delta{ timeline_->changed_[change_], timeline_->values_.data() + value_ } };
+      }
+      Iterator& operator++() noexcept {
+        value_ += std::popcount(timeline_->changed_[change_]);
+        ++change_;
+        return *this;
+      }
+      Iterator operator++(int) noexcept {
+        auto returning = *this;
+        ++*this;
+        return returning;
+      }
+      bool operator==(Iterator const& o) const noexcept {
+        return change_ == o.change_;
+      }
+    private:
+      Stats_timeline const* timeline_ = nullptr;
+      std::size_t change_ = 0;
+      std::size_t value_ = 0;
+    };
+
+    //records the fields of to that differ from from, nothing if none do
+    void push_back(clogparser::Period when, Combat_stats const& from, Combat_stats const& to);
+    //values are the new values of the changed fields, in Combat_stat order
+    void push_back(clogparser::Period when, std::uint8_t changed, std::span<const double> values);
+
+    Iterator begin() const noexcept {
+      return { this, 0, 0 };
+    }
+    Iterator end() const noexcept {
+      return { this, whens_.size(), values_.size() };
+    }
+    bool empty() const noexcept {
+      return whens_.empty();
+    }
+    std::size_t size() const noexcept {
+      return whens_.size();
+    }
+
+    std::size_t heap_bytes() const noexcept {
+      return whens_.capacity() * sizeof(clogparser::Period)
+        + changed_.capacity() * sizeof(std::uint8_t)
+        + values_.capacity() * sizeof(double);
+    }
+  private:
+    std::vector<clogparser::Period> whens_;
+    std::vector<std::uint8_t> changed_;
+    std::vector<double> values_;
+  };
+
   struct Calced_damage {
     double base = 0;
     double with_ebon_mult = 1;
@@ -110,6 +203,18 @@ namespace prescience_helper::sim {
     }
   };
 
+  //what Damage::calc works out, before the aug's stats are known. Each buff's damage is base plus its
+  //per stat amount times what the aug gives
+  struct Damage_terms {
+    double base = 0;
+    //per point of primary ebon might gives
+    double ebon_might_per_primary = 0;
+    //per point of versatility shifting sands gives
+    double shifting_sands_per_vers = 0;
+    //the damage with prescience's crit, without fate mirror
+    double prescience = 0;
+  };
+
   struct Damage {
     double base_scaling = 1;
     bool scales_with_primary = false;
@@ -118,6 +223,7 @@ namespace prescience_helper::sim {
     Damage_amp amp;
 
     Calced_damage calc(Combat_stats const& damager, Combat_stats const& aug, bool fate_mirror) const noexcept;
+    Damage_terms terms(Combat_stats const& damager) const noexcept;
   };
 
   struct Aug_buff {
@@ -127,6 +233,47 @@ namespace prescience_helper::sim {
     bool shifting_sands = false;
   };
 
+  //the stats a spec and its gear start with, before talents and auras. Raiders wear the same gear for most of
+  //a night's pulls, so one cache for everything a pipeline parses saves redoing the item lookups every pull.
+  //keyed by a fingerprint of the spec, primary stat, item ids, ilvls and enchants. Safe to share between threads
+  struct Gear_cache {
+  public:
+    struct Stats {
+      std::uint64_t hits = 0;
+      std::uint64_t misses = 0;
+      std::size_t size = 0;
+    };
+
+    Combat_stats base_stats(clogparser::SpecId spec, clogparser::Attribute_rating primary_stat, std::span<const clogparser::Item> items);
+
+    Stats stats() const;
+  private:
+    struct Item_key {
+      std::uint64_t item_id;
+      std::uint16_t ilvl;
+      decltype(clogparser::Item::permanent_enchant_id) permanent_enchant_id;
+
+      bool operator==(Item_key const&) const noexcept = default;
+    };
+    struct Key {
+      std::uint64_t fingerprint;
+      clogparser::SpecId spec;
+      clogparser::Attribute_rating primary_stat;
+      std::vector<Item_key> items;
+
+      bool operator==(Key const&) const noexcept = default;
+    };
+    struct Key_hash {
+      std::size_t operator()(Key const& key) const noexcept {
+        return static_cast<std::size_t>(key.fingerprint);
+      }
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, Combat_stats, Key_hash> cache_;
+    Stats stats_;
+  };
+
   struct Player_state : public Target_state {
   public:
     clogparser::SpecId spec;
@@ -141,14 +288,52 @@ namespace prescience_helper::sim {
 
     virtual Damage swing(bool crit, Target_state const& target, std::int64_t historical_damage_done) const;
     virtual Damage pet_swing(bool crit, Target_state const& target, std::int64_t historical_damage_done) const;
-    virtual Damage impact(std::uint64_t spell_id, bool crit, Target_state const& target, std::int64_t historical_damage_done) const;
+    //attributes are the spell's sim::dbc SPELL_* bits
+    virtual Damage impact(std::uint64_t spell_id, std::uint8_t attributes, bool crit, Target_state const& target, std::int64_t historical_damage_done) const;
     
-    static std::unique_ptr<Player_state> create(clogparser::events::Combatant_info const&);
+    //gear_cache is optional, without one the gear's stats are worked out every time
+    static std::unique_ptr<Player_state> create(clogparser::events::Combatant_info const&, Gear_cache* gear_cache = nullptr);
+
+    //current_stats with aug_buffs applied, only what damage normalization reads
+    struct Effective_stats {
+      double primary = 0;
+      //1 + versatility
+      double vers_mult = 1;
+    };
+    //cached until an aura changes this player's stats or buffs, or the stats of an aug buffing them
+    Effective_stats const& effective_stats() const {
+      if (effective_.version != stats_version_ || effective_.aug_versions.size() != aug_buffs.size()) {
+        refresh_effective_stats_();
+      } else {
+        for (std::size_t i = 0; i < aug_buffs.size(); ++i) {
+          if (effective_.aug_versions[i] != aug_buffs[i].aug->stats_version_) {
+            refresh_effective_stats_();
+            break;
+          }
+        }
+      }
+      return effective_.stats;
+    }
 
     virtual ~Player_state() {}
   protected:
     virtual void handle_aura(Unit caster, std::uint64_t spell_id, std::uint8_t new_stacks, std::uint8_t old_stacks) override;
-    Player_state(clogparser::events::Combatant_info const&, clogparser::Attribute_rating primary_stat);
+    Player_state(clogparser::events::Combatant_info const&, clogparser::Attribute_rating primary_stat, Gear_cache* gear_cache);
+
+    //for overrides of handle_aura that change current_stats or aug_buffs without going through Player_state::handle_aura
+    void mark_stats_dirty_() noexcept {
+      ++stats_version_;
+    }
+  private:
+    void refresh_effective_stats_() const;
+
+    std::uint64_t stats_version_ = 0;
+    //nothing matches the initial version, so the first effective_stats works them out
+    mutable struct {
+      std::uint64_t version = ~std::uint64_t{ 0 };
+      std::vector<std::uint64_t> aug_versions;
+      Effective_stats stats;
+    } effective_;
   };
 
   constexpr clogparser::events::Combat_log_version::Build_version valid_for{
@@ -156,4 +341,7 @@ namespace prescience_helper::sim {
     2,
     5
   };
+
+  //valid_for, or the patch of the loaded dbc pack if it says
+  clogparser::events::Combat_log_version::Build_version simulating_for() noexcept;
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+//the dbc tables as one versioned binary file, so a new patch needs a new pack rather than a new binary.
+//the csv_to_* tools write them, load maps one and the tables are used in place from then on.
+//the layout is the in memory one of a little endian machine, so a pack only loads where the structs match
+namespace prescience_helper::sim::dbc::pack {
+  constexpr std::array<char, 8> MAGIC{ 'P', 'H', 'D', 'B', 'P', 'A', 'C', 'K' };
+  constexpr std::uint32_t VERSION = 1;
+  //every section's offset is a multiple of this
+  constexpr std::uint64_t ALIGNMENT = 8;
+  //the default file name, looked for next to the db
+  constexpr std::string_view DEFAULT_FILE_NAME = "prescience_helper.dbcpack";
+
+  enum class Section : std::uint32_t {
+    //1 to 3 were separate spell id sets, replaced by spell_attributes. Packs that still have them load, they're just not read
+    //Rand_prop_point_record indexed by ilvl - 1, gaps have ilvl 0
+    rand_prop_points = 4,
+    //Combat_ratings_record indexed by ilvl - 1, gaps have ilvl 0
+    combat_ratings_mult_by_ilvl = 5,
+    //Item_sparse_record sorted by id
+    item_sparse = 6,
+    //sorted std::uint32_t, (spell id << 8) | SPELL_* attribute bits
+    spell_attributes = 7,
+  };
+  constexpr std::size_t SECTION_COUNT = 8;
+
+  //the bits of a spell's attribute byte
+  constexpr std::uint8_t SPELL_CAN_NOT_CRIT = 1 << 0;
+  constexpr std::uint8_t SPELL_ALLOW_CLASS_ABILITY_PROCS = 1 << 1;
+  constexpr std::uint8_t SPELL_SCALES_WITH_PRIMARY = 1 << 2;
+  //spell ids have to fit in the 24 bits above the attribute byte
+  constexpr std::uint64_t SPELL_ID_MAX = 0xFFFFFF;
+
+  //followed by section_count Section_entry
+  struct Header {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t section_count;
+    //the patch the tables are from, all 0 if the pack doesn't say
+    std::uint8_t expac;
+    std::uint8_t patch;
+    std::uint8_t minor;
+    std::array<std::uint8_t, 5> reserved;
+  };
+  static_assert(sizeof(Header) == 24);
+
+  struct Section_entry {
+    Section id;
+    std::uint32_t record_size;
+    std::uint64_t offset;
+    std::uint64_t count;
+  };
+  static_assert(sizeof(Section_entry) == 24);
+
+  struct Rand_prop_point_record {
+    std::uint32_t ilvl;
+    float damage_replace_stat;
+    float damage_secondary;
+    std::array<float, 5> budget;
+  };
+  static_assert(sizeof(Rand_prop_point_record) == 32);
+
+  struct Combat_ratings_record {
+    std::uint16_t ilvl;
+    std::uint16_t reserved;
+    float armor;
+    float weapon;
+    float trinket;
+    float jewelry;
+  };
+  static_assert(sizeof(Combat_ratings_record) == 20);
+
+  struct Item_sparse_record {
+    std::uint32_t id;
+    std::int32_t slot;
+    std::array<std::int8_t, 10> stat_types;
+    std::uint16_t reserved;
+    std::array<std::uint16_t, 10> stat_amounts;
+  };
+  static_assert(sizeof(Item_sparse_record) == 40);
+
+  //maps path and uses its sections instead of the compiled in tables (and its patch instead of sim::valid_for)
+  //until the process exits. Sections the pack doesn't have keep using the compiled in tables.
+  //call before anything is simulated. throws std::runtime_error if path can't be mapped or isn't a pack we understand
+  void load(std::filesystem::path const& path);
+
+  bool loaded() noexcept;
+}
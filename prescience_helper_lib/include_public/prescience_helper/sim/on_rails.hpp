@@ -7,7 +7,7 @@ namespace prescience_helper::sim::on_rails {
     const prescience_helper::Player* ingest_player = nullptr;
     std::unique_ptr<Player_state> sim_player;
     std::vector<Event<Damage>> damage_events;
-    std::vector<Event<Combat_stats>> stat_events;
+    Stats_timeline stat_events;
     std::vector<Event<void>> died;
     std::vector<Event<void>> rezzed;
   };
@@ -25,11 +25,12 @@ namespace prescience_helper::sim::on_rails {
     return span.subspan(start);
   }
 
-  Encounter simulate(prescience_helper::Encounter const& encounter);
+  //gear_cache is passed on to Player_state::create, and can be shared by encounters simulated on other threads
+  Encounter simulate(prescience_helper::Encounter const& encounter, Gear_cache* gear_cache = nullptr);
 
   std::vector<prescience_helper::Event<Combat_stats>> aggregate_stats(
     std::span<const clogparser::Period> player_duration,
-    std::span<const std::vector<Event<Combat_stats>>> stats,
+    std::span<const Stats_timeline> stats,
     std::span<const std::vector<Event<void>>> died,
     std::span<const std::vector<Event<void>>> rezzed,
     std::span<const double> weights) noexcept;
@@ -38,7 +39,7 @@ namespace prescience_helper::sim::on_rails {
     std::span<const Event<Combat_stats>> aug,
     std::span<const clogparser::Period> player_duration,
     std::span<const std::vector<Event<Damage>>> player_damage,
-    std::span<const std::vector<Event<Combat_stats>>> player_stats,
+    std::span<const Stats_timeline> player_stats,
     std::span<const std::vector<Event<void>>> player_died,
     std::span<const std::vector<Event<void>>> player_rezzed,
     std::span<const double> weights,
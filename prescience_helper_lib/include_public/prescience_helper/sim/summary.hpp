@@ -0,0 +1,58 @@
+#pragma once
+#include <prescience_helper/sim.hpp>
+
+#include <chrono>
+
+//a pull boiled down to what generation needs of it, in fixed slices of the fight. Everything in a slice is a sum,
+//so any number of pulls merge into one summary by adding up their slices, and generating from that costs the same
+//however many pulls went into it
+namespace prescience_helper::sim::summary {
+  //generation windows are whole numbers of slices
+  constexpr clogparser::Period SLICE = std::chrono::milliseconds{ 100 };
+
+  //everything but alive is only counted while alive, and once merged everything is times the pull's weight
+  enum class Field {
+    INITIAL = 0,
+    //how much of the slice the player was alive for, 0 to 1
+    alive = 0,
+    //Damage_terms of the damage done in the slice
+    base,
+    ebon_might_per_primary,
+    shifting_sands_per_vers,
+    prescience,
+    //alive times the player's stats, for augs giving their buffs
+    primary,
+    mastery_rating,
+    mastery_val,
+    COUNT
+  };
+
+  using Slice = clogparser::Enum_indexed_array<Field, double, Field::COUNT>;
+
+  struct Summary {
+  public:
+    //Encounter.start_time of the newest pull in the summary, weights are relative to it
+    std::int64_t newest_start_ms = 0;
+    std::vector<Slice> slices;
+
+    //adds a one pull summary, weighting every pull by half for each half_life it started before the newest one.
+    //a half_life of 0 weights them all the same
+    void add_pull(Summary const& pull, std::chrono::milliseconds half_life);
+  };
+
+  Summary summarize(
+    std::int64_t start_ms,
+    clogparser::Period duration,
+    std::span<const Event<Damage>> damage,
+    Stats_timeline const& stats,
+    std::span<const Event<void>> died,
+    std::span<const Event<void>> rezzed);
+
+  //on_rails::aggregate_damage from summaries, with the aug's stats averaged per slice rather than exact.
+  //window_size is rounded down to whole slices
+  std::vector<Event<Calced_damage>> aggregate_damage(
+    Summary const& player,
+    Summary const& aug,
+    bool fate_mirror,
+    clogparser::Period window_size = std::chrono::seconds{ 1 });
+}
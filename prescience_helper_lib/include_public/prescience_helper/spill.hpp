@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+//events that didn't fit in ingest's memory budget. They're written as raw bytes, so they
+//(and the pointers in them) are only meaningful to the process that wrote them
+namespace prescience_helper {
+  //where a run of spilled events is in its Spill_file. Runs are sorted by when
+  struct Spill_segment {
+    std::uint64_t offset;
+    std::size_t count;
+  };
+
+  //a temporary file, removed when destroyed
+  struct Spill_file {
+  public:
+    //throws std::runtime_error if a file can't be created in directory
+    Spill_file(std::filesystem::path const& directory);
+    Spill_file(Spill_file const&) = delete;
+    Spill_file& operator=(Spill_file const&) = delete;
+    ~Spill_file();
+
+    template<typename T>
+    Spill_segment write(std::span<const T> in) requires std::is_trivially_copyable_v<T> {
+      const Spill_segment returning{ size_, in.size() };
+      write_bytes_(std::as_bytes(in));
+      return returning;
+    }
+
+    template<typename T>
+    void read(std::uint64_t offset, std::span<T> out) requires std::is_trivially_copyable_v<T> {
+      read_bytes_(offset, std::as_writable_bytes(out));
+    }
+
+    std::uint64_t size() const noexcept {
+      return size_;
+    }
+  private:
+    void write_bytes_(std::span<const std::byte> in);
+    void read_bytes_(std::uint64_t offset, std::span<std::byte> out);
+
+    std::filesystem::path path_;
+    std::fstream file_;
+    std::uint64_t size_ = 0;
+  };
+
+  //reads a Spill_segment back a chunk at a time
+  template<typename T>
+  struct Spill_reader {
+  public:
+    static constexpr std::size_t CHUNK_SIZE = 1024;
+
+    Spill_reader(Spill_file& file, Spill_segment segment) :
+      file_(&file),
+      segment_(segment) {
+
+    }
+
+    std::optional<T> next() {
+      if (pos_ == chunk_.size()) {
+        if (read_ == segment_.count) {
+          return std::nullopt;
+        }
+        chunk_.resize(std::min(CHUNK_SIZE, segment_.count - read_));
+        file_->read(segment_.offset + read_ * sizeof(T), std::span<T>{ chunk_ });
+        read_ += chunk_.size();
+        pos_ = 0;
+      }
+      return chunk_[pos_++];
+    }
+  private:
+    Spill_file* file_;
+    Spill_segment segment_;
+    std::size_t read_ = 0;
+    std::vector<T> chunk_;
+    std::size_t pos_ = 0;
+  };
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+//scoped spans, written out as a chrome trace (chrome://tracing or ui.perfetto.dev)
+//the macros compile to nothing unless PRESCIENCE_HELPER_TRACING is defined
+namespace prescience_helper::trace {
+#ifdef PRESCIENCE_HELPER_TRACING
+  constexpr bool ENABLED = true;
+
+  struct Span {
+  public:
+    //name must live as long as the process, string literals only
+    explicit Span(const char* name) noexcept;
+    //detail is copied, it shows up in the span's args
+    Span(const char* name, std::string_view detail);
+    Span(Span const&) = delete;
+    Span& operator=(Span const&) = delete;
+    ~Span();
+  private:
+    const char* name_;
+    std::string detail_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  //labels the calling thread's track
+  void name_thread(std::string_view name);
+#else
+  constexpr bool ENABLED = false;
+
+  inline void name_thread(std::string_view) {}
+#endif
+
+  //writes the spans finished so far, only the newest 65536 of each thread are kept
+  //false if tracing is compiled out or path couldn't be written
+  bool write(std::filesystem::path const& path);
+}
+
+#define PRESCIENCE_HELPER_TRACE_CONCAT_IMPL_(a, b) a##b
+#define PRESCIENCE_HELPER_TRACE_CONCAT_(a, b) PRESCIENCE_HELPER_TRACE_CONCAT_IMPL_(a, b)
+
+#ifdef PRESCIENCE_HELPER_TRACING
+#define PRESCIENCE_HELPER_TRACE_SPAN(name) \
+  const ::prescience_helper::trace::Span PRESCIENCE_HELPER_TRACE_CONCAT_(trace_span_, __LINE__){ name }
+#define PRESCIENCE_HELPER_TRACE_SPAN_DETAIL(name, detail) \
+  const ::prescience_helper::trace::Span PRESCIENCE_HELPER_TRACE_CONCAT_(trace_span_, __LINE__){ name, detail }
+#else
+//detail isn't evaluated when tracing is compiled out
+#define PRESCIENCE_HELPER_TRACE_SPAN(name) static_cast<void>(0)
+#define PRESCIENCE_HELPER_TRACE_SPAN_DETAIL(name, detail) static_cast<void>(0)
+#endif
@@ -1,1308 +1,1323 @@
 #include <prescience_helper/sim/dbc/combat_ratings_mult_by_ilvl.hpp>
+#include <prescience_helper/sim/dbc/pack.hpp>
+#include <array>
+#include <span>
 namespace dbc = prescience_helper::sim::dbc;
+namespace pack = prescience_helper::sim::dbc::pack;
 
-const std::unordered_map<std::uint16_t, dbc::Combat_ratings_mult_by_ilvl> dbc::COMBAT_RATINGS_MULT_BY_ILVL = []() {
-  std::unordered_map<std::uint16_t, dbc::Combat_ratings_mult_by_ilvl> returning;
-  returning.emplace(1, Combat_ratings_mult_by_ilvl{ 1, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(2, Combat_ratings_mult_by_ilvl{ 2, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(3, Combat_ratings_mult_by_ilvl{ 3, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(4, Combat_ratings_mult_by_ilvl{ 4, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(5, Combat_ratings_mult_by_ilvl{ 5, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(6, Combat_ratings_mult_by_ilvl{ 6, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(7, Combat_ratings_mult_by_ilvl{ 7, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(8, Combat_ratings_mult_by_ilvl{ 8, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(9, Combat_ratings_mult_by_ilvl{ 9, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(10, Combat_ratings_mult_by_ilvl{ 10, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(11, Combat_ratings_mult_by_ilvl{ 11, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(12, Combat_ratings_mult_by_ilvl{ 12, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(13, Combat_ratings_mult_by_ilvl{ 13, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(14, Combat_ratings_mult_by_ilvl{ 14, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(15, Combat_ratings_mult_by_ilvl{ 15, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(16, Combat_ratings_mult_by_ilvl{ 16, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(17, Combat_ratings_mult_by_ilvl{ 17, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(18, Combat_ratings_mult_by_ilvl{ 18, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(19, Combat_ratings_mult_by_ilvl{ 19, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(20, Combat_ratings_mult_by_ilvl{ 20, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(21, Combat_ratings_mult_by_ilvl{ 21, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(22, Combat_ratings_mult_by_ilvl{ 22, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(23, Combat_ratings_mult_by_ilvl{ 23, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(24, Combat_ratings_mult_by_ilvl{ 24, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(25, Combat_ratings_mult_by_ilvl{ 25, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(26, Combat_ratings_mult_by_ilvl{ 26, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(27, Combat_ratings_mult_by_ilvl{ 27, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(28, Combat_ratings_mult_by_ilvl{ 28, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(29, Combat_ratings_mult_by_ilvl{ 29, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(30, Combat_ratings_mult_by_ilvl{ 30, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(31, Combat_ratings_mult_by_ilvl{ 31, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(32, Combat_ratings_mult_by_ilvl{ 32, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(33, Combat_ratings_mult_by_ilvl{ 33, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(34, Combat_ratings_mult_by_ilvl{ 34, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(35, Combat_ratings_mult_by_ilvl{ 35, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(36, Combat_ratings_mult_by_ilvl{ 36, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(37, Combat_ratings_mult_by_ilvl{ 37, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(38, Combat_ratings_mult_by_ilvl{ 38, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(39, Combat_ratings_mult_by_ilvl{ 39, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(40, Combat_ratings_mult_by_ilvl{ 40, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(41, Combat_ratings_mult_by_ilvl{ 41, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(42, Combat_ratings_mult_by_ilvl{ 42, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(43, Combat_ratings_mult_by_ilvl{ 43, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(44, Combat_ratings_mult_by_ilvl{ 44, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(45, Combat_ratings_mult_by_ilvl{ 45, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(46, Combat_ratings_mult_by_ilvl{ 46, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(47, Combat_ratings_mult_by_ilvl{ 47, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(48, Combat_ratings_mult_by_ilvl{ 48, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(49, Combat_ratings_mult_by_ilvl{ 49, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(50, Combat_ratings_mult_by_ilvl{ 50, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(51, Combat_ratings_mult_by_ilvl{ 51, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(52, Combat_ratings_mult_by_ilvl{ 52, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(53, Combat_ratings_mult_by_ilvl{ 53, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(54, Combat_ratings_mult_by_ilvl{ 54, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(55, Combat_ratings_mult_by_ilvl{ 55, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(56, Combat_ratings_mult_by_ilvl{ 56, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(57, Combat_ratings_mult_by_ilvl{ 57, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(58, Combat_ratings_mult_by_ilvl{ 58, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(59, Combat_ratings_mult_by_ilvl{ 59, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(60, Combat_ratings_mult_by_ilvl{ 60, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(61, Combat_ratings_mult_by_ilvl{ 61, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(62, Combat_ratings_mult_by_ilvl{ 62, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(63, Combat_ratings_mult_by_ilvl{ 63, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(64, Combat_ratings_mult_by_ilvl{ 64, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(65, Combat_ratings_mult_by_ilvl{ 65, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(66, Combat_ratings_mult_by_ilvl{ 66, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(67, Combat_ratings_mult_by_ilvl{ 67, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(68, Combat_ratings_mult_by_ilvl{ 68, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(69, Combat_ratings_mult_by_ilvl{ 69, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(70, Combat_ratings_mult_by_ilvl{ 70, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(71, Combat_ratings_mult_by_ilvl{ 71, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(72, Combat_ratings_mult_by_ilvl{ 72, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(73, Combat_ratings_mult_by_ilvl{ 73, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(74, Combat_ratings_mult_by_ilvl{ 74, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(75, Combat_ratings_mult_by_ilvl{ 75, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(76, Combat_ratings_mult_by_ilvl{ 76, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(77, Combat_ratings_mult_by_ilvl{ 77, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(78, Combat_ratings_mult_by_ilvl{ 78, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(79, Combat_ratings_mult_by_ilvl{ 79, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(80, Combat_ratings_mult_by_ilvl{ 80, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(81, Combat_ratings_mult_by_ilvl{ 81, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(82, Combat_ratings_mult_by_ilvl{ 82, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(83, Combat_ratings_mult_by_ilvl{ 83, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(84, Combat_ratings_mult_by_ilvl{ 84, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(85, Combat_ratings_mult_by_ilvl{ 85, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(86, Combat_ratings_mult_by_ilvl{ 86, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(87, Combat_ratings_mult_by_ilvl{ 87, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(88, Combat_ratings_mult_by_ilvl{ 88, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(89, Combat_ratings_mult_by_ilvl{ 89, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(90, Combat_ratings_mult_by_ilvl{ 90, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(91, Combat_ratings_mult_by_ilvl{ 91, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(92, Combat_ratings_mult_by_ilvl{ 92, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(93, Combat_ratings_mult_by_ilvl{ 93, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(94, Combat_ratings_mult_by_ilvl{ 94, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(95, Combat_ratings_mult_by_ilvl{ 95, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(96, Combat_ratings_mult_by_ilvl{ 96, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(97, Combat_ratings_mult_by_ilvl{ 97, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(98, Combat_ratings_mult_by_ilvl{ 98, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(99, Combat_ratings_mult_by_ilvl{ 99, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(100, Combat_ratings_mult_by_ilvl{ 100, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(101, Combat_ratings_mult_by_ilvl{ 101, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(102, Combat_ratings_mult_by_ilvl{ 102, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(103, Combat_ratings_mult_by_ilvl{ 103, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(104, Combat_ratings_mult_by_ilvl{ 104, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(105, Combat_ratings_mult_by_ilvl{ 105, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(106, Combat_ratings_mult_by_ilvl{ 106, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(107, Combat_ratings_mult_by_ilvl{ 107, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(108, Combat_ratings_mult_by_ilvl{ 108, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(109, Combat_ratings_mult_by_ilvl{ 109, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(110, Combat_ratings_mult_by_ilvl{ 110, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(111, Combat_ratings_mult_by_ilvl{ 111, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(112, Combat_ratings_mult_by_ilvl{ 112, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(113, Combat_ratings_mult_by_ilvl{ 113, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(114, Combat_ratings_mult_by_ilvl{ 114, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(115, Combat_ratings_mult_by_ilvl{ 115, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(116, Combat_ratings_mult_by_ilvl{ 116, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(117, Combat_ratings_mult_by_ilvl{ 117, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(118, Combat_ratings_mult_by_ilvl{ 118, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(119, Combat_ratings_mult_by_ilvl{ 119, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(120, Combat_ratings_mult_by_ilvl{ 120, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(121, Combat_ratings_mult_by_ilvl{ 121, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(122, Combat_ratings_mult_by_ilvl{ 122, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(123, Combat_ratings_mult_by_ilvl{ 123, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(124, Combat_ratings_mult_by_ilvl{ 124, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(125, Combat_ratings_mult_by_ilvl{ 125, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(126, Combat_ratings_mult_by_ilvl{ 126, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(127, Combat_ratings_mult_by_ilvl{ 127, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(128, Combat_ratings_mult_by_ilvl{ 128, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(129, Combat_ratings_mult_by_ilvl{ 129, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(130, Combat_ratings_mult_by_ilvl{ 130, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(131, Combat_ratings_mult_by_ilvl{ 131, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(132, Combat_ratings_mult_by_ilvl{ 132, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(133, Combat_ratings_mult_by_ilvl{ 133, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(134, Combat_ratings_mult_by_ilvl{ 134, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(135, Combat_ratings_mult_by_ilvl{ 135, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(136, Combat_ratings_mult_by_ilvl{ 136, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(137, Combat_ratings_mult_by_ilvl{ 137, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(138, Combat_ratings_mult_by_ilvl{ 138, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(139, Combat_ratings_mult_by_ilvl{ 139, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(140, Combat_ratings_mult_by_ilvl{ 140, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(141, Combat_ratings_mult_by_ilvl{ 141, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(142, Combat_ratings_mult_by_ilvl{ 142, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(143, Combat_ratings_mult_by_ilvl{ 143, 1.5, 1.5, 1.5, 1.5 });
-  returning.emplace(144, Combat_ratings_mult_by_ilvl{ 144, 1.495998794, 1.495998794, 1.495998794, 1.486076062 });
-  returning.emplace(145, Combat_ratings_mult_by_ilvl{ 145, 1.492008262, 1.492008262, 1.492008262, 1.472281374 });
-  returning.emplace(146, Combat_ratings_mult_by_ilvl{ 146, 1.488028374, 1.488028374, 1.488028374, 1.458614737 });
-  returning.emplace(147, Combat_ratings_mult_by_ilvl{ 147, 1.484059103, 1.484059103, 1.484059103, 1.445074963 });
-  returning.emplace(148, Combat_ratings_mult_by_ilvl{ 148, 1.480100419, 1.480100419, 1.480100419, 1.431660873 });
-  returning.emplace(149, Combat_ratings_mult_by_ilvl{ 149, 1.476152295, 1.476152295, 1.476152295, 1.418371301 });
-  returning.emplace(150, Combat_ratings_mult_by_ilvl{ 150, 1.472214702, 1.472214702, 1.472214702, 1.405205091 });
-  returning.emplace(151, Combat_ratings_mult_by_ilvl{ 151, 1.468287613, 1.468287613, 1.468287613, 1.392161099 });
-  returning.emplace(152, Combat_ratings_mult_by_ilvl{ 152, 1.464371, 1.464371, 1.464371, 1.379238188 });
-  returning.emplace(153, Combat_ratings_mult_by_ilvl{ 153, 1.460464833, 1.460464833, 1.460464833, 1.366435237 });
-  returning.emplace(154, Combat_ratings_mult_by_ilvl{ 154, 1.456569087, 1.456569087, 1.456569087, 1.35375113 });
-  returning.emplace(155, Combat_ratings_mult_by_ilvl{ 155, 1.452683732, 1.452683732, 1.452683732, 1.341184765 });
-  returning.emplace(156, Combat_ratings_mult_by_ilvl{ 156, 1.448808741, 1.448808741, 1.448808741, 1.328735049 });
-  returning.emplace(157, Combat_ratings_mult_by_ilvl{ 157, 1.444944086, 1.444944086, 1.444944086, 1.316400899 });
-  returning.emplace(158, Combat_ratings_mult_by_ilvl{ 158, 1.441089741, 1.441089741, 1.441089741, 1.304181242 });
-  returning.emplace(159, Combat_ratings_mult_by_ilvl{ 159, 1.437245677, 1.437245677, 1.437245677, 1.292075016 });
-  returning.emplace(160, Combat_ratings_mult_by_ilvl{ 160, 1.433411866, 1.433411866, 1.433411866, 1.280081168 });
-  returning.emplace(161, Combat_ratings_mult_by_ilvl{ 161, 1.429588283, 1.429588283, 1.429588283, 1.268198653 });
-  returning.emplace(162, Combat_ratings_mult_by_ilvl{ 162, 1.425774898, 1.425774898, 1.425774898, 1.25642644 });
-  returning.emplace(163, Combat_ratings_mult_by_ilvl{ 163, 1.421971686, 1.421971686, 1.421971686, 1.244763504 });
-  returning.emplace(164, Combat_ratings_mult_by_ilvl{ 164, 1.418178619, 1.418178619, 1.418178619, 1.23320883 });
-  returning.emplace(165, Combat_ratings_mult_by_ilvl{ 165, 1.414395669, 1.414395669, 1.414395669, 1.221761415 });
-  returning.emplace(166, Combat_ratings_mult_by_ilvl{ 166, 1.410622811, 1.410622811, 1.410622811, 1.210420261 });
-  returning.emplace(167, Combat_ratings_mult_by_ilvl{ 167, 1.406860016, 1.406860016, 1.406860016, 1.199184383 });
-  returning.emplace(168, Combat_ratings_mult_by_ilvl{ 168, 1.403107259, 1.403107259, 1.403107259, 1.188052803 });
-  returning.emplace(169, Combat_ratings_mult_by_ilvl{ 169, 1.399364512, 1.399364512, 1.399364512, 1.177024554 });
-  returning.emplace(170, Combat_ratings_mult_by_ilvl{ 170, 1.395631748, 1.395631748, 1.395631748, 1.166098675 });
-  returning.emplace(171, Combat_ratings_mult_by_ilvl{ 171, 1.391908942, 1.391908942, 1.391908942, 1.155274218 });
-  returning.emplace(172, Combat_ratings_mult_by_ilvl{ 172, 1.388196066, 1.388196066, 1.388196066, 1.14455024 });
-  returning.emplace(173, Combat_ratings_mult_by_ilvl{ 173, 1.384493094, 1.384493094, 1.384493094, 1.133925809 });
-  returning.emplace(174, Combat_ratings_mult_by_ilvl{ 174, 1.3808, 1.3808, 1.3808, 1.1234 });
-  returning.emplace(175, Combat_ratings_mult_by_ilvl{ 175, 1.379858402, 1.379858402, 1.379858402, 1.132286482 });
-  returning.emplace(176, Combat_ratings_mult_by_ilvl{ 176, 1.378815505, 1.378815505, 1.378815505, 1.14091151 });
-  returning.emplace(177, Combat_ratings_mult_by_ilvl{ 177, 1.377673271, 1.377673271, 1.377673271, 1.149279169 });
-  returning.emplace(178, Combat_ratings_mult_by_ilvl{ 178, 1.37643363, 1.37643363, 1.37643363, 1.157393491 });
-  returning.emplace(179, Combat_ratings_mult_by_ilvl{ 179, 1.375098487, 1.375098487, 1.375098487, 1.165258455 });
-  returning.emplace(180, Combat_ratings_mult_by_ilvl{ 180, 1.373669722, 1.373669722, 1.373669722, 1.172877989 });
-  returning.emplace(181, Combat_ratings_mult_by_ilvl{ 181, 1.372149185, 1.372149185, 1.372149185, 1.180255968 });
-  returning.emplace(182, Combat_ratings_mult_by_ilvl{ 182, 1.370538701, 1.370538701, 1.370538701, 1.187396218 });
-  returning.emplace(183, Combat_ratings_mult_by_ilvl{ 183, 1.36884007, 1.36884007, 1.36884007, 1.194302513 });
-  returning.emplace(184, Combat_ratings_mult_by_ilvl{ 184, 1.367055065, 1.367055065, 1.367055065, 1.200978579 });
-  returning.emplace(185, Combat_ratings_mult_by_ilvl{ 185, 1.365185434, 1.365185434, 1.365185434, 1.207428092 });
-  returning.emplace(186, Combat_ratings_mult_by_ilvl{ 186, 1.3632329, 1.3632329, 1.3632329, 1.21365468 });
-  returning.emplace(187, Combat_ratings_mult_by_ilvl{ 187, 1.361199162, 1.361199162, 1.361199162, 1.219661923 });
-  returning.emplace(188, Combat_ratings_mult_by_ilvl{ 188, 1.359085895, 1.359085895, 1.359085895, 1.225453355 });
-  returning.emplace(189, Combat_ratings_mult_by_ilvl{ 189, 1.356894747, 1.356894747, 1.356894747, 1.231032461 });
-  returning.emplace(190, Combat_ratings_mult_by_ilvl{ 190, 1.354627346, 1.354627346, 1.354627346, 1.236402682 });
-  returning.emplace(191, Combat_ratings_mult_by_ilvl{ 191, 1.352285294, 1.352285294, 1.352285294, 1.241567412 });
-  returning.emplace(192, Combat_ratings_mult_by_ilvl{ 192, 1.349870172, 1.349870172, 1.349870172, 1.246530001 });
-  returning.emplace(193, Combat_ratings_mult_by_ilvl{ 193, 1.347383535, 1.347383535, 1.347383535, 1.251293754 });
-  returning.emplace(194, Combat_ratings_mult_by_ilvl{ 194, 1.344826917, 1.344826917, 1.344826917, 1.255861932 });
-  returning.emplace(195, Combat_ratings_mult_by_ilvl{ 195, 1.342201832, 1.342201832, 1.342201832, 1.260237754 });
-  returning.emplace(196, Combat_ratings_mult_by_ilvl{ 196, 1.339509769, 1.339509769, 1.339509769, 1.264424393 });
-  returning.emplace(197, Combat_ratings_mult_by_ilvl{ 197, 1.336752195, 1.336752195, 1.336752195, 1.268424984 });
-  returning.emplace(198, Combat_ratings_mult_by_ilvl{ 198, 1.333930558, 1.333930558, 1.333930558, 1.272242616 });
-  returning.emplace(199, Combat_ratings_mult_by_ilvl{ 199, 1.331046282, 1.331046282, 1.331046282, 1.275880339 });
-  returning.emplace(200, Combat_ratings_mult_by_ilvl{ 200, 1.328100774, 1.328100774, 1.328100774, 1.279341162 });
-  returning.emplace(201, Combat_ratings_mult_by_ilvl{ 201, 1.325095415, 1.325095415, 1.325095415, 1.282628053 });
-  returning.emplace(202, Combat_ratings_mult_by_ilvl{ 202, 1.32203157, 1.32203157, 1.32203157, 1.285743941 });
-  returning.emplace(203, Combat_ratings_mult_by_ilvl{ 203, 1.318910583, 1.318910583, 1.318910583, 1.288691714 });
-  returning.emplace(204, Combat_ratings_mult_by_ilvl{ 204, 1.315733776, 1.315733776, 1.315733776, 1.291474224 });
-  returning.emplace(205, Combat_ratings_mult_by_ilvl{ 205, 1.312502453, 1.312502453, 1.312502453, 1.294094281 });
-  returning.emplace(206, Combat_ratings_mult_by_ilvl{ 206, 1.309217899, 1.309217899, 1.309217899, 1.29655466 });
-  returning.emplace(207, Combat_ratings_mult_by_ilvl{ 207, 1.305881379, 1.305881379, 1.305881379, 1.298858097 });
-  returning.emplace(208, Combat_ratings_mult_by_ilvl{ 208, 1.30249414, 1.30249414, 1.30249414, 1.301007291 });
-  returning.emplace(209, Combat_ratings_mult_by_ilvl{ 209, 1.299057408, 1.299057408, 1.299057408, 1.303004906 });
-  returning.emplace(210, Combat_ratings_mult_by_ilvl{ 210, 1.295572395, 1.295572395, 1.295572395, 1.304853568 });
-  returning.emplace(211, Combat_ratings_mult_by_ilvl{ 211, 1.29204029, 1.29204029, 1.29204029, 1.306555869 });
-  returning.emplace(212, Combat_ratings_mult_by_ilvl{ 212, 1.288462266, 1.288462266, 1.288462266, 1.308114363 });
-  returning.emplace(213, Combat_ratings_mult_by_ilvl{ 213, 1.28483948, 1.28483948, 1.28483948, 1.309531571 });
-  returning.emplace(214, Combat_ratings_mult_by_ilvl{ 214, 1.28117307, 1.28117307, 1.28117307, 1.310809982 });
-  returning.emplace(215, Combat_ratings_mult_by_ilvl{ 215, 1.277464155, 1.277464155, 1.277464155, 1.311952046 });
-  returning.emplace(216, Combat_ratings_mult_by_ilvl{ 216, 1.273713841, 1.273713841, 1.273713841, 1.312960183 });
-  returning.emplace(217, Combat_ratings_mult_by_ilvl{ 217, 1.269923213, 1.269923213, 1.269923213, 1.313836779 });
-  returning.emplace(218, Combat_ratings_mult_by_ilvl{ 218, 1.266093343, 1.266093343, 1.266093343, 1.314584187 });
-  returning.emplace(219, Combat_ratings_mult_by_ilvl{ 219, 1.262225283, 1.262225283, 1.262225283, 1.315204728 });
-  returning.emplace(220, Combat_ratings_mult_by_ilvl{ 220, 1.258320073, 1.258320073, 1.258320073, 1.315700691 });
-  returning.emplace(221, Combat_ratings_mult_by_ilvl{ 221, 1.254378733, 1.254378733, 1.254378733, 1.316074333 });
-  returning.emplace(222, Combat_ratings_mult_by_ilvl{ 222, 1.250402269, 1.250402269, 1.250402269, 1.31632788 });
-  returning.emplace(223, Combat_ratings_mult_by_ilvl{ 223, 1.246391673, 1.246391673, 1.246391673, 1.316463529 });
-  returning.emplace(224, Combat_ratings_mult_by_ilvl{ 224, 1.242347918, 1.242347918, 1.242347918, 1.316483442 });
-  returning.emplace(225, Combat_ratings_mult_by_ilvl{ 225, 1.238271966, 1.238271966, 1.238271966, 1.316389757 });
-  returning.emplace(226, Combat_ratings_mult_by_ilvl{ 226, 1.234164762, 1.234164762, 1.234164762, 1.316184578 });
-  returning.emplace(227, Combat_ratings_mult_by_ilvl{ 227, 1.230027234, 1.230027234, 1.230027234, 1.315869981 });
-  returning.emplace(228, Combat_ratings_mult_by_ilvl{ 228, 1.2258603, 1.2258603, 1.2258603, 1.315448014 });
-  returning.emplace(229, Combat_ratings_mult_by_ilvl{ 229, 1.221664861, 1.221664861, 1.221664861, 1.314920695 });
-  returning.emplace(230, Combat_ratings_mult_by_ilvl{ 230, 1.217441803, 1.217441803, 1.217441803, 1.314290014 });
-  returning.emplace(231, Combat_ratings_mult_by_ilvl{ 231, 1.213191999, 1.213191999, 1.213191999, 1.313557934 });
-  returning.emplace(232, Combat_ratings_mult_by_ilvl{ 232, 1.20891631, 1.20891631, 1.20891631, 1.31272639 });
-  returning.emplace(233, Combat_ratings_mult_by_ilvl{ 233, 1.204615581, 1.204615581, 1.204615581, 1.31179729 });
-  returning.emplace(234, Combat_ratings_mult_by_ilvl{ 234, 1.200290643, 1.200290643, 1.200290643, 1.310772515 });
-  returning.emplace(235, Combat_ratings_mult_by_ilvl{ 235, 1.195942317, 1.195942317, 1.195942317, 1.30965392 });
-  returning.emplace(236, Combat_ratings_mult_by_ilvl{ 236, 1.191571407, 1.191571407, 1.191571407, 1.308443332 });
-  returning.emplace(237, Combat_ratings_mult_by_ilvl{ 237, 1.187178707, 1.187178707, 1.187178707, 1.307142554 });
-  returning.emplace(238, Combat_ratings_mult_by_ilvl{ 238, 1.182764996, 1.182764996, 1.182764996, 1.305753364 });
-  returning.emplace(239, Combat_ratings_mult_by_ilvl{ 239, 1.178331043, 1.178331043, 1.178331043, 1.304277513 });
-  returning.emplace(240, Combat_ratings_mult_by_ilvl{ 240, 1.173877602, 1.173877602, 1.173877602, 1.302716728 });
-  returning.emplace(241, Combat_ratings_mult_by_ilvl{ 241, 1.169405416, 1.169405416, 1.169405416, 1.301072712 });
-  returning.emplace(242, Combat_ratings_mult_by_ilvl{ 242, 1.164915216, 1.164915216, 1.164915216, 1.299347141 });
-  returning.emplace(243, Combat_ratings_mult_by_ilvl{ 243, 1.16040772, 1.16040772, 1.16040772, 1.297541672 });
-  returning.emplace(244, Combat_ratings_mult_by_ilvl{ 244, 1.155883637, 1.155883637, 1.155883637, 1.295657933 });
-  returning.emplace(245, Combat_ratings_mult_by_ilvl{ 245, 1.15134366, 1.15134366, 1.15134366, 1.293697532 });
-  returning.emplace(246, Combat_ratings_mult_by_ilvl{ 246, 1.146788475, 1.146788475, 1.146788475, 1.291662053 });
-  returning.emplace(247, Combat_ratings_mult_by_ilvl{ 247, 1.142218753, 1.142218753, 1.142218753, 1.289553057 });
-  returning.emplace(248, Combat_ratings_mult_by_ilvl{ 248, 1.137635155, 1.137635155, 1.137635155, 1.287372083 });
-  returning.emplace(249, Combat_ratings_mult_by_ilvl{ 249, 1.133038334, 1.133038334, 1.133038334, 1.285120648 });
-  returning.emplace(250, Combat_ratings_mult_by_ilvl{ 250, 1.128428927, 1.128428927, 1.128428927, 1.282800245 });
-  returning.emplace(251, Combat_ratings_mult_by_ilvl{ 251, 1.123807564, 1.123807564, 1.123807564, 1.280412348 });
-  returning.emplace(252, Combat_ratings_mult_by_ilvl{ 252, 1.119174863, 1.119174863, 1.119174863, 1.277958408 });
-  returning.emplace(253, Combat_ratings_mult_by_ilvl{ 253, 1.114531432, 1.114531432, 1.114531432, 1.275439856 });
-  returning.emplace(254, Combat_ratings_mult_by_ilvl{ 254, 1.109877867, 1.109877867, 1.109877867, 1.272858101 });
-  returning.emplace(255, Combat_ratings_mult_by_ilvl{ 255, 1.105214758, 1.105214758, 1.105214758, 1.270214531 });
-  returning.emplace(256, Combat_ratings_mult_by_ilvl{ 256, 1.10054268, 1.10054268, 1.10054268, 1.267510517 });
-  returning.emplace(257, Combat_ratings_mult_by_ilvl{ 257, 1.095862202, 1.095862202, 1.095862202, 1.264747406 });
-  returning.emplace(258, Combat_ratings_mult_by_ilvl{ 258, 1.09117388, 1.09117388, 1.09117388, 1.261926526 });
-  returning.emplace(259, Combat_ratings_mult_by_ilvl{ 259, 1.086478264, 1.086478264, 1.086478264, 1.259049188 });
-  returning.emplace(260, Combat_ratings_mult_by_ilvl{ 260, 1.081775891, 1.081775891, 1.081775891, 1.25611668 });
-  returning.emplace(261, Combat_ratings_mult_by_ilvl{ 261, 1.077067291, 1.077067291, 1.077067291, 1.253130275 });
-  returning.emplace(262, Combat_ratings_mult_by_ilvl{ 262, 1.072352983, 1.072352983, 1.072352983, 1.250091222 });
-  returning.emplace(263, Combat_ratings_mult_by_ilvl{ 263, 1.06763348, 1.06763348, 1.06763348, 1.247000757 });
-  returning.emplace(264, Combat_ratings_mult_by_ilvl{ 264, 1.062909281, 1.062909281, 1.062909281, 1.243860094 });
-  returning.emplace(265, Combat_ratings_mult_by_ilvl{ 265, 1.058180881, 1.058180881, 1.058180881, 1.24067043 });
-  returning.emplace(266, Combat_ratings_mult_by_ilvl{ 266, 1.053448764, 1.053448764, 1.053448764, 1.237432944 });
-  returning.emplace(267, Combat_ratings_mult_by_ilvl{ 267, 1.048713405, 1.048713405, 1.048713405, 1.234148797 });
-  returning.emplace(268, Combat_ratings_mult_by_ilvl{ 268, 1.043975271, 1.043975271, 1.043975271, 1.230819133 });
-  returning.emplace(269, Combat_ratings_mult_by_ilvl{ 269, 1.039234822, 1.039234822, 1.039234822, 1.22744508 });
-  returning.emplace(270, Combat_ratings_mult_by_ilvl{ 270, 1.034492508, 1.034492508, 1.034492508, 1.224027746 });
-  returning.emplace(271, Combat_ratings_mult_by_ilvl{ 271, 1.02974877, 1.02974877, 1.02974877, 1.220568225 });
-  returning.emplace(272, Combat_ratings_mult_by_ilvl{ 272, 1.025004044, 1.025004044, 1.025004044, 1.217067593 });
-  returning.emplace(273, Combat_ratings_mult_by_ilvl{ 273, 1.020258756, 1.020258756, 1.020258756, 1.21352691 });
-  returning.emplace(274, Combat_ratings_mult_by_ilvl{ 274, 1.015513323, 1.015513323, 1.015513323, 1.20994722 });
-  returning.emplace(275, Combat_ratings_mult_by_ilvl{ 275, 1.010768158, 1.010768158, 1.010768158, 1.206329552 });
-  returning.emplace(276, Combat_ratings_mult_by_ilvl{ 276, 1.006023663, 1.006023663, 1.006023663, 1.202674918 });
-  returning.emplace(277, Combat_ratings_mult_by_ilvl{ 277, 1.001280234, 1.001280234, 1.001280234, 1.198984313 });
-  returning.emplace(278, Combat_ratings_mult_by_ilvl{ 278, 0.996538259, 0.996538259, 0.996538259, 1.195258721 });
-  returning.emplace(279, Combat_ratings_mult_by_ilvl{ 279, 0.991798119, 0.991798119, 0.991798119, 1.191499107 });
-  returning.emplace(280, Combat_ratings_mult_by_ilvl{ 280, 0.987060189, 0.987060189, 0.987060189, 1.187706423 });
-  returning.emplace(281, Combat_ratings_mult_by_ilvl{ 281, 0.982324834, 0.982324834, 0.982324834, 1.183881605 });
-  returning.emplace(282, Combat_ratings_mult_by_ilvl{ 282, 0.977592415, 0.977592415, 0.977592415, 1.180025577 });
-  returning.emplace(283, Combat_ratings_mult_by_ilvl{ 283, 0.972863284, 0.972863284, 0.972863284, 1.176139245 });
-  returning.emplace(284, Combat_ratings_mult_by_ilvl{ 284, 0.968137787, 0.968137787, 0.968137787, 1.172223503 });
-  returning.emplace(285, Combat_ratings_mult_by_ilvl{ 285, 0.963416265, 0.963416265, 0.963416265, 1.168279232 });
-  returning.emplace(286, Combat_ratings_mult_by_ilvl{ 286, 0.958699048, 0.958699048, 0.958699048, 1.164307297 });
-  returning.emplace(287, Combat_ratings_mult_by_ilvl{ 287, 0.953986465, 0.953986465, 0.953986465, 1.16030855 });
-  returning.emplace(288, Combat_ratings_mult_by_ilvl{ 288, 0.949278834, 0.949278834, 0.949278834, 1.156283831 });
-  returning.emplace(289, Combat_ratings_mult_by_ilvl{ 289, 0.944576469, 0.944576469, 0.944576469, 1.152233965 });
-  returning.emplace(290, Combat_ratings_mult_by_ilvl{ 290, 0.939879677, 0.939879677, 0.939879677, 1.148159765 });
-  returning.emplace(291, Combat_ratings_mult_by_ilvl{ 291, 0.935188759, 0.935188759, 0.935188759, 1.144062031 });
-  returning.emplace(292, Combat_ratings_mult_by_ilvl{ 292, 0.930504011, 0.930504011, 0.930504011, 1.139941549 });
-  returning.emplace(293, Combat_ratings_mult_by_ilvl{ 293, 0.925825721, 0.925825721, 0.925825721, 1.135799093 });
-  returning.emplace(294, Combat_ratings_mult_by_ilvl{ 294, 0.921154173, 0.921154173, 0.921154173, 1.131635427 });
-  returning.emplace(295, Combat_ratings_mult_by_ilvl{ 295, 0.916489643, 0.916489643, 0.916489643, 1.127451299 });
-  returning.emplace(296, Combat_ratings_mult_by_ilvl{ 296, 0.911832404, 0.911832404, 0.911832404, 1.123247447 });
-  returning.emplace(297, Combat_ratings_mult_by_ilvl{ 297, 0.907182721, 0.907182721, 0.907182721, 1.119024597 });
-  returning.emplace(298, Combat_ratings_mult_by_ilvl{ 298, 0.902540855, 0.902540855, 0.902540855, 1.114783463 });
-  returning.emplace(299, Combat_ratings_mult_by_ilvl{ 299, 0.897907061, 0.897907061, 0.897907061, 1.110524747 });
-  returning.emplace(300, Combat_ratings_mult_by_ilvl{ 300, 0.893281588, 0.893281588, 0.893281588, 1.10624914 });
-  returning.emplace(301, Combat_ratings_mult_by_ilvl{ 301, 0.888664681, 0.888664681, 0.888664681, 1.101957322 });
-  returning.emplace(302, Combat_ratings_mult_by_ilvl{ 302, 0.884056578, 0.884056578, 0.884056578, 1.097649961 });
-  returning.emplace(303, Combat_ratings_mult_by_ilvl{ 303, 0.879457514, 0.879457514, 0.879457514, 1.093327714 });
-  returning.emplace(304, Combat_ratings_mult_by_ilvl{ 304, 0.874867716, 0.874867716, 0.874867716, 1.088991229 });
-  returning.emplace(305, Combat_ratings_mult_by_ilvl{ 305, 0.870287409, 0.870287409, 0.870287409, 1.08464114 });
-  returning.emplace(306, Combat_ratings_mult_by_ilvl{ 306, 0.865716812, 0.865716812, 0.865716812, 1.080278074 });
-  returning.emplace(307, Combat_ratings_mult_by_ilvl{ 307, 0.861156137, 0.861156137, 0.861156137, 1.075902645 });
-  returning.emplace(308, Combat_ratings_mult_by_ilvl{ 308, 0.856605595, 0.856605595, 0.856605595, 1.071515458 });
-  returning.emplace(309, Combat_ratings_mult_by_ilvl{ 309, 0.85206539, 0.85206539, 0.85206539, 1.067117107 });
-  returning.emplace(310, Combat_ratings_mult_by_ilvl{ 310, 0.847535721, 0.847535721, 0.847535721, 1.062708177 });
-  returning.emplace(311, Combat_ratings_mult_by_ilvl{ 311, 0.843016783, 0.843016783, 0.843016783, 1.058289242 });
-  returning.emplace(312, Combat_ratings_mult_by_ilvl{ 312, 0.858663173, 0.858663173, 0.858663173, 1.06237734 });
-  returning.emplace(313, Combat_ratings_mult_by_ilvl{ 313, 0.874599961, 0.874599961, 0.874599961, 1.066481229 });
-  returning.emplace(314, Combat_ratings_mult_by_ilvl{ 314, 0.890832536, 0.890832536, 0.890832536, 1.070600972 });
-  returning.emplace(315, Combat_ratings_mult_by_ilvl{ 315, 0.907366387, 0.907366387, 0.907366387, 1.074736629 });
-  returning.emplace(316, Combat_ratings_mult_by_ilvl{ 316, 0.924207106, 0.924207106, 0.924207106, 1.078888262 });
-  returning.emplace(317, Combat_ratings_mult_by_ilvl{ 317, 0.941360389, 0.941360389, 0.941360389, 1.083055933 });
-  returning.emplace(318, Combat_ratings_mult_by_ilvl{ 318, 0.958832037, 0.958832037, 0.958832037, 1.087239703 });
-  returning.emplace(319, Combat_ratings_mult_by_ilvl{ 319, 0.976627959, 0.976627959, 0.976627959, 1.091439634 });
-  returning.emplace(320, Combat_ratings_mult_by_ilvl{ 320, 0.994754173, 0.994754173, 0.994754173, 1.095655789 });
-  returning.emplace(321, Combat_ratings_mult_by_ilvl{ 321, 1.013216809, 1.013216809, 1.013216809, 1.099888232 });
-  returning.emplace(322, Combat_ratings_mult_by_ilvl{ 322, 1.032022112, 1.032022112, 1.032022112, 1.104137023 });
-  returning.emplace(323, Combat_ratings_mult_by_ilvl{ 323, 1.051176442, 1.051176442, 1.051176442, 1.108402228 });
-  returning.emplace(324, Combat_ratings_mult_by_ilvl{ 324, 1.070686276, 1.070686276, 1.070686276, 1.112683909 });
-  returning.emplace(325, Combat_ratings_mult_by_ilvl{ 325, 1.090558212, 1.090558212, 1.090558212, 1.116982129 });
-  returning.emplace(326, Combat_ratings_mult_by_ilvl{ 326, 1.110798971, 1.110798971, 1.110798971, 1.121296954 });
-  returning.emplace(327, Combat_ratings_mult_by_ilvl{ 327, 1.131415399, 1.131415399, 1.131415399, 1.125628446 });
-  returning.emplace(328, Combat_ratings_mult_by_ilvl{ 328, 1.152414468, 1.152414468, 1.152414468, 1.12997667 });
-  returning.emplace(329, Combat_ratings_mult_by_ilvl{ 329, 1.173803279, 1.173803279, 1.173803279, 1.134341692 });
-  returning.emplace(330, Combat_ratings_mult_by_ilvl{ 330, 1.195589067, 1.195589067, 1.195589067, 1.138723575 });
-  returning.emplace(331, Combat_ratings_mult_by_ilvl{ 331, 1.217779199, 1.217779199, 1.217779199, 1.143122385 });
-  returning.emplace(332, Combat_ratings_mult_by_ilvl{ 332, 1.24038118, 1.24038118, 1.24038118, 1.147538187 });
-  returning.emplace(333, Combat_ratings_mult_by_ilvl{ 333, 1.263402653, 1.263402653, 1.263402653, 1.151971047 });
-  returning.emplace(334, Combat_ratings_mult_by_ilvl{ 334, 1.286851405, 1.286851405, 1.286851405, 1.156421031 });
-  returning.emplace(335, Combat_ratings_mult_by_ilvl{ 335, 1.310735366, 1.310735366, 1.310735366, 1.160888205 });
-  returning.emplace(336, Combat_ratings_mult_by_ilvl{ 336, 1.335062614, 1.335062614, 1.335062614, 1.165372636 });
-  returning.emplace(337, Combat_ratings_mult_by_ilvl{ 337, 1.359841374, 1.359841374, 1.359841374, 1.169874389 });
-  returning.emplace(338, Combat_ratings_mult_by_ilvl{ 338, 1.385080029, 1.385080029, 1.385080029, 1.174393533 });
-  returning.emplace(339, Combat_ratings_mult_by_ilvl{ 339, 1.410787113, 1.410787113, 1.410787113, 1.178930133 });
-  returning.emplace(340, Combat_ratings_mult_by_ilvl{ 340, 1.436971321, 1.436971321, 1.436971321, 1.183484259 });
-  returning.emplace(341, Combat_ratings_mult_by_ilvl{ 341, 1.463641507, 1.463641507, 1.463641507, 1.188055976 });
-  returning.emplace(342, Combat_ratings_mult_by_ilvl{ 342, 1.490806692, 1.490806692, 1.490806692, 1.192645354 });
-  returning.emplace(343, Combat_ratings_mult_by_ilvl{ 343, 1.48887512, 1.48887512, 1.48887512, 1.200615658 });
-  returning.emplace(344, Combat_ratings_mult_by_ilvl{ 344, 1.48685115, 1.48685115, 1.48685115, 1.208335546 });
-  returning.emplace(345, Combat_ratings_mult_by_ilvl{ 345, 1.484736663, 1.484736663, 1.484736663, 1.215808976 });
-  returning.emplace(346, Combat_ratings_mult_by_ilvl{ 346, 1.482533511, 1.482533511, 1.482533511, 1.223039857 });
-  returning.emplace(347, Combat_ratings_mult_by_ilvl{ 347, 1.480243521, 1.480243521, 1.480243521, 1.230032045 });
-  returning.emplace(348, Combat_ratings_mult_by_ilvl{ 348, 1.477868493, 1.477868493, 1.477868493, 1.236789344 });
-  returning.emplace(349, Combat_ratings_mult_by_ilvl{ 349, 1.475410201, 1.475410201, 1.475410201, 1.243315511 });
-  returning.emplace(350, Combat_ratings_mult_by_ilvl{ 350, 1.472870394, 1.472870394, 1.472870394, 1.249614251 });
-  returning.emplace(351, Combat_ratings_mult_by_ilvl{ 351, 1.470250796, 1.470250796, 1.470250796, 1.255689221 });
-  returning.emplace(352, Combat_ratings_mult_by_ilvl{ 352, 1.467553104, 1.467553104, 1.467553104, 1.26154403 });
-  returning.emplace(353, Combat_ratings_mult_by_ilvl{ 353, 1.464778993, 1.464778993, 1.464778993, 1.267182239 });
-  returning.emplace(354, Combat_ratings_mult_by_ilvl{ 354, 1.461930112, 1.461930112, 1.461930112, 1.272607363 });
-  returning.emplace(355, Combat_ratings_mult_by_ilvl{ 355, 1.459008087, 1.459008087, 1.459008087, 1.277822868 });
-  returning.emplace(356, Combat_ratings_mult_by_ilvl{ 356, 1.456014519, 1.456014519, 1.456014519, 1.282832176 });
-  returning.emplace(357, Combat_ratings_mult_by_ilvl{ 357, 1.452950987, 1.452950987, 1.452950987, 1.287638663 });
-  returning.emplace(358, Combat_ratings_mult_by_ilvl{ 358, 1.449819046, 1.449819046, 1.449819046, 1.292245661 });
-  returning.emplace(359, Combat_ratings_mult_by_ilvl{ 359, 1.446620228, 1.446620228, 1.446620228, 1.296656456 });
-  returning.emplace(360, Combat_ratings_mult_by_ilvl{ 360, 1.443356043, 1.443356043, 1.443356043, 1.300874291 });
-  returning.emplace(361, Combat_ratings_mult_by_ilvl{ 361, 1.440027979, 1.440027979, 1.440027979, 1.304902366 });
-  returning.emplace(362, Combat_ratings_mult_by_ilvl{ 362, 1.436637501, 1.436637501, 1.436637501, 1.308743837 });
-  returning.emplace(363, Combat_ratings_mult_by_ilvl{ 363, 1.433186053, 1.433186053, 1.433186053, 1.31240182 });
-  returning.emplace(364, Combat_ratings_mult_by_ilvl{ 364, 1.429675058, 1.429675058, 1.429675058, 1.315879388 });
-  returning.emplace(365, Combat_ratings_mult_by_ilvl{ 365, 1.426105917, 1.426105917, 1.426105917, 1.319179571 });
-  returning.emplace(366, Combat_ratings_mult_by_ilvl{ 366, 1.422480011, 1.422480011, 1.422480011, 1.322305362 });
-  returning.emplace(367, Combat_ratings_mult_by_ilvl{ 367, 1.418798699, 1.418798699, 1.418798699, 1.325259712 });
-  returning.emplace(368, Combat_ratings_mult_by_ilvl{ 368, 1.415063321, 1.415063321, 1.415063321, 1.32804553 });
-  returning.emplace(369, Combat_ratings_mult_by_ilvl{ 369, 1.411275196, 1.411275196, 1.411275196, 1.33066569 });
-  returning.emplace(370, Combat_ratings_mult_by_ilvl{ 370, 1.407435625, 1.407435625, 1.407435625, 1.333123025 });
-  returning.emplace(371, Combat_ratings_mult_by_ilvl{ 371, 1.403545887, 1.403545887, 1.403545887, 1.335420328 });
-  returning.emplace(372, Combat_ratings_mult_by_ilvl{ 372, 1.399607243, 1.399607243, 1.399607243, 1.337560357 });
-  returning.emplace(373, Combat_ratings_mult_by_ilvl{ 373, 1.395620934, 1.395620934, 1.395620934, 1.339545832 });
-  returning.emplace(374, Combat_ratings_mult_by_ilvl{ 374, 1.391588184, 1.391588184, 1.391588184, 1.341379435 });
-  returning.emplace(375, Combat_ratings_mult_by_ilvl{ 375, 1.387510197, 1.387510197, 1.387510197, 1.343063813 });
-  returning.emplace(376, Combat_ratings_mult_by_ilvl{ 376, 1.383388159, 1.383388159, 1.383388159, 1.344601575 });
-  returning.emplace(377, Combat_ratings_mult_by_ilvl{ 377, 1.379223237, 1.379223237, 1.379223237, 1.345995297 });
-  returning.emplace(378, Combat_ratings_mult_by_ilvl{ 378, 1.375016582, 1.375016582, 1.375016582, 1.347247518 });
-  returning.emplace(379, Combat_ratings_mult_by_ilvl{ 379, 1.370769325, 1.370769325, 1.370769325, 1.348360741 });
-  returning.emplace(380, Combat_ratings_mult_by_ilvl{ 380, 1.366482582, 1.366482582, 1.366482582, 1.349337439 });
-  returning.emplace(381, Combat_ratings_mult_by_ilvl{ 381, 1.362157451, 1.362157451, 1.362157451, 1.350180048 });
-  returning.emplace(382, Combat_ratings_mult_by_ilvl{ 382, 1.357795012, 1.357795012, 1.357795012, 1.35089097 });
-  returning.emplace(383, Combat_ratings_mult_by_ilvl{ 383, 1.353396329, 1.353396329, 1.353396329, 1.351472576 });
-  returning.emplace(384, Combat_ratings_mult_by_ilvl{ 384, 1.348962449, 1.348962449, 1.348962449, 1.351927203 });
-  returning.emplace(385, Combat_ratings_mult_by_ilvl{ 385, 1.344494405, 1.344494405, 1.344494405, 1.352257156 });
-  returning.emplace(386, Combat_ratings_mult_by_ilvl{ 386, 1.33999321, 1.33999321, 1.33999321, 1.352464709 });
-  returning.emplace(387, Combat_ratings_mult_by_ilvl{ 387, 1.335459865, 1.335459865, 1.335459865, 1.352552104 });
-  returning.emplace(388, Combat_ratings_mult_by_ilvl{ 388, 1.330895352, 1.330895352, 1.330895352, 1.352521552 });
-  returning.emplace(389, Combat_ratings_mult_by_ilvl{ 389, 1.32630064, 1.32630064, 1.32630064, 1.352375233 });
-  returning.emplace(390, Combat_ratings_mult_by_ilvl{ 390, 1.321676681, 1.321676681, 1.321676681, 1.352115296 });
-  returning.emplace(391, Combat_ratings_mult_by_ilvl{ 391, 1.317024413, 1.317024413, 1.317024413, 1.351743862 });
-  returning.emplace(392, Combat_ratings_mult_by_ilvl{ 392, 1.312344759, 1.312344759, 1.312344759, 1.351263022 });
-  returning.emplace(393, Combat_ratings_mult_by_ilvl{ 393, 1.307638627, 1.307638627, 1.307638627, 1.350674836 });
-  returning.emplace(394, Combat_ratings_mult_by_ilvl{ 394, 1.302906911, 1.302906911, 1.302906911, 1.349981337 });
-  returning.emplace(395, Combat_ratings_mult_by_ilvl{ 395, 1.298150489, 1.298150489, 1.298150489, 1.349184529 });
-  returning.emplace(396, Combat_ratings_mult_by_ilvl{ 396, 1.293370228, 1.293370228, 1.293370228, 1.348286387 });
-  returning.emplace(397, Combat_ratings_mult_by_ilvl{ 397, 1.288566978, 1.288566978, 1.288566978, 1.347288861 });
-  returning.emplace(398, Combat_ratings_mult_by_ilvl{ 398, 1.283741577, 1.283741577, 1.283741577, 1.34619387 });
-  returning.emplace(399, Combat_ratings_mult_by_ilvl{ 399, 1.278894848, 1.278894848, 1.278894848, 1.345003308 });
-  returning.emplace(400, Combat_ratings_mult_by_ilvl{ 400, 1.274027604, 1.274027604, 1.274027604, 1.343719043 });
-  returning.emplace(401, Combat_ratings_mult_by_ilvl{ 401, 1.26914064, 1.26914064, 1.26914064, 1.342342914 });
-  returning.emplace(402, Combat_ratings_mult_by_ilvl{ 402, 1.264234742, 1.264234742, 1.264234742, 1.340876736 });
-  returning.emplace(403, Combat_ratings_mult_by_ilvl{ 403, 1.259310681, 1.259310681, 1.259310681, 1.339322297 });
-  returning.emplace(404, Combat_ratings_mult_by_ilvl{ 404, 1.254369215, 1.254369215, 1.254369215, 1.337681361 });
-  returning.emplace(405, Combat_ratings_mult_by_ilvl{ 405, 1.249411092, 1.249411092, 1.249411092, 1.335955666 });
-  returning.emplace(406, Combat_ratings_mult_by_ilvl{ 406, 1.244437045, 1.244437045, 1.244437045, 1.334146925 });
-  returning.emplace(407, Combat_ratings_mult_by_ilvl{ 407, 1.239447795, 1.239447795, 1.239447795, 1.332256826 });
-  returning.emplace(408, Combat_ratings_mult_by_ilvl{ 408, 1.234444054, 1.234444054, 1.234444054, 1.330287036 });
-  returning.emplace(409, Combat_ratings_mult_by_ilvl{ 409, 1.229426518, 1.229426518, 1.229426518, 1.328239193 });
-  returning.emplace(410, Combat_ratings_mult_by_ilvl{ 410, 1.224395874, 1.224395874, 1.224395874, 1.326114916 });
-  returning.emplace(411, Combat_ratings_mult_by_ilvl{ 411, 1.219352796, 1.219352796, 1.219352796, 1.323915798 });
-  returning.emplace(412, Combat_ratings_mult_by_ilvl{ 412, 1.214297949, 1.214297949, 1.214297949, 1.32164341 });
-  returning.emplace(413, Combat_ratings_mult_by_ilvl{ 413, 1.209231983, 1.209231983, 1.209231983, 1.319299301 });
-  returning.emplace(414, Combat_ratings_mult_by_ilvl{ 414, 1.20415554, 1.20415554, 1.20415554, 1.316884996 });
-  returning.emplace(415, Combat_ratings_mult_by_ilvl{ 415, 1.199069251, 1.199069251, 1.199069251, 1.314401998 });
-  returning.emplace(416, Combat_ratings_mult_by_ilvl{ 416, 1.193973733, 1.193973733, 1.193973733, 1.31185179 });
-  returning.emplace(417, Combat_ratings_mult_by_ilvl{ 417, 1.188869597, 1.188869597, 1.188869597, 1.309235832 });
-  returning.emplace(418, Combat_ratings_mult_by_ilvl{ 418, 1.18375744, 1.18375744, 1.18375744, 1.306555562 });
-  returning.emplace(419, Combat_ratings_mult_by_ilvl{ 419, 1.178637849, 1.178637849, 1.178637849, 1.303812399 });
-  returning.emplace(420, Combat_ratings_mult_by_ilvl{ 420, 1.173511403, 1.173511403, 1.173511403, 1.301007739 });
-  returning.emplace(421, Combat_ratings_mult_by_ilvl{ 421, 1.168378669, 1.168378669, 1.168378669, 1.29814296 });
-  returning.emplace(422, Combat_ratings_mult_by_ilvl{ 422, 1.163240204, 1.163240204, 1.163240204, 1.295219417 });
-  returning.emplace(423, Combat_ratings_mult_by_ilvl{ 423, 1.158096557, 1.158096557, 1.158096557, 1.292238447 });
-  returning.emplace(424, Combat_ratings_mult_by_ilvl{ 424, 1.152948265, 1.152948265, 1.152948265, 1.289201367 });
-  returning.emplace(425, Combat_ratings_mult_by_ilvl{ 425, 1.147795857, 1.147795857, 1.147795857, 1.286109473 });
-  returning.emplace(426, Combat_ratings_mult_by_ilvl{ 426, 1.142639851, 1.142639851, 1.142639851, 1.282964044 });
-  returning.emplace(427, Combat_ratings_mult_by_ilvl{ 427, 1.137480759, 1.137480759, 1.137480759, 1.279766339 });
-  returning.emplace(428, Combat_ratings_mult_by_ilvl{ 428, 1.132319081, 1.132319081, 1.132319081, 1.276517597 });
-  returning.emplace(429, Combat_ratings_mult_by_ilvl{ 429, 1.127155308, 1.127155308, 1.127155308, 1.273219041 });
-  returning.emplace(430, Combat_ratings_mult_by_ilvl{ 430, 1.121989923, 1.121989923, 1.121989923, 1.269871874 });
-  returning.emplace(431, Combat_ratings_mult_by_ilvl{ 431, 1.1168234, 1.1168234, 1.1168234, 1.266477281 });
-  returning.emplace(432, Combat_ratings_mult_by_ilvl{ 432, 1.111656205, 1.111656205, 1.111656205, 1.263036429 });
-  returning.emplace(433, Combat_ratings_mult_by_ilvl{ 433, 1.106488794, 1.106488794, 1.106488794, 1.259550469 });
-  returning.emplace(434, Combat_ratings_mult_by_ilvl{ 434, 1.101321616, 1.101321616, 1.101321616, 1.256020534 });
-  returning.emplace(435, Combat_ratings_mult_by_ilvl{ 435, 1.096155111, 1.096155111, 1.096155111, 1.252447739 });
-  returning.emplace(436, Combat_ratings_mult_by_ilvl{ 436, 1.090989712, 1.090989712, 1.090989712, 1.248833182 });
-  returning.emplace(437, Combat_ratings_mult_by_ilvl{ 437, 1.085825841, 1.085825841, 1.085825841, 1.245177945 });
-  returning.emplace(438, Combat_ratings_mult_by_ilvl{ 438, 1.080663914, 1.080663914, 1.080663914, 1.241483095 });
-  returning.emplace(439, Combat_ratings_mult_by_ilvl{ 439, 1.075504341, 1.075504341, 1.075504341, 1.237749679 });
-  returning.emplace(440, Combat_ratings_mult_by_ilvl{ 440, 1.070347521, 1.070347521, 1.070347521, 1.233978732 });
-  returning.emplace(441, Combat_ratings_mult_by_ilvl{ 441, 1.065193847, 1.065193847, 1.065193847, 1.230171269 });
-  returning.emplace(442, Combat_ratings_mult_by_ilvl{ 442, 1.060043703, 1.060043703, 1.060043703, 1.226328294 });
-  returning.emplace(443, Combat_ratings_mult_by_ilvl{ 443, 1.054897469, 1.054897469, 1.054897469, 1.222450792 });
-  returning.emplace(444, Combat_ratings_mult_by_ilvl{ 444, 1.049755514, 1.049755514, 1.049755514, 1.218539734 });
-  returning.emplace(445, Combat_ratings_mult_by_ilvl{ 445, 1.044618201, 1.044618201, 1.044618201, 1.214596077 });
-  returning.emplace(446, Combat_ratings_mult_by_ilvl{ 446, 1.039485888, 1.039485888, 1.039485888, 1.21062076 });
-  returning.emplace(447, Combat_ratings_mult_by_ilvl{ 447, 1.034358922, 1.034358922, 1.034358922, 1.206614711 });
-  returning.emplace(448, Combat_ratings_mult_by_ilvl{ 448, 1.029237646, 1.029237646, 1.029237646, 1.202578841 });
-  returning.emplace(449, Combat_ratings_mult_by_ilvl{ 449, 1.024122396, 1.024122396, 1.024122396, 1.198514049 });
-  returning.emplace(450, Combat_ratings_mult_by_ilvl{ 450, 1.0190135, 1.0190135, 1.0190135, 1.194421217 });
-  returning.emplace(451, Combat_ratings_mult_by_ilvl{ 451, 1.01391128, 1.01391128, 1.01391128, 1.190301216 });
-  returning.emplace(452, Combat_ratings_mult_by_ilvl{ 452, 1.008816052, 1.008816052, 1.008816052, 1.186154902 });
-  returning.emplace(453, Combat_ratings_mult_by_ilvl{ 453, 1.003728126, 1.003728126, 1.003728126, 1.181983116 });
-  returning.emplace(454, Combat_ratings_mult_by_ilvl{ 454, 0.998647803, 0.998647803, 0.998647803, 1.177786688 });
-  returning.emplace(455, Combat_ratings_mult_by_ilvl{ 455, 0.993575381, 0.993575381, 0.993575381, 1.173566434 });
-  returning.emplace(456, Combat_ratings_mult_by_ilvl{ 456, 0.98851115, 0.98851115, 0.98851115, 1.169323157 });
-  returning.emplace(457, Combat_ratings_mult_by_ilvl{ 457, 0.983455394, 0.983455394, 0.983455394, 1.165057647 });
-  returning.emplace(458, Combat_ratings_mult_by_ilvl{ 458, 0.978408392, 0.978408392, 0.978408392, 1.16077068 });
-  returning.emplace(459, Combat_ratings_mult_by_ilvl{ 459, 0.973370415, 0.973370415, 0.973370415, 1.156463023 });
-  returning.emplace(460, Combat_ratings_mult_by_ilvl{ 460, 0.968341732, 0.968341732, 0.968341732, 1.152135427 });
-  returning.emplace(461, Combat_ratings_mult_by_ilvl{ 461, 0.963322602, 0.963322602, 0.963322602, 1.147788633 });
-  returning.emplace(462, Combat_ratings_mult_by_ilvl{ 462, 0.958313282, 0.958313282, 0.958313282, 1.143423369 });
-  returning.emplace(463, Combat_ratings_mult_by_ilvl{ 463, 0.95331402, 0.95331402, 0.95331402, 1.139040352 });
-  returning.emplace(464, Combat_ratings_mult_by_ilvl{ 464, 0.948325062, 0.948325062, 0.948325062, 1.134640286 });
-  returning.emplace(465, Combat_ratings_mult_by_ilvl{ 465, 0.943346645, 0.943346645, 0.943346645, 1.130223865 });
-  returning.emplace(466, Combat_ratings_mult_by_ilvl{ 466, 0.938379004, 0.938379004, 0.938379004, 1.12579177 });
-  returning.emplace(467, Combat_ratings_mult_by_ilvl{ 467, 0.933422367, 0.933422367, 0.933422367, 1.121344672 });
-  returning.emplace(468, Combat_ratings_mult_by_ilvl{ 468, 0.928476957, 0.928476957, 0.928476957, 1.11688323 });
-  returning.emplace(469, Combat_ratings_mult_by_ilvl{ 469, 0.923542992, 0.923542992, 0.923542992, 1.112408093 });
-  returning.emplace(470, Combat_ratings_mult_by_ilvl{ 470, 0.918620685, 0.918620685, 0.918620685, 1.1079199 });
-  returning.emplace(471, Combat_ratings_mult_by_ilvl{ 471, 0.913710244, 0.913710244, 0.913710244, 1.103419275 });
-  returning.emplace(472, Combat_ratings_mult_by_ilvl{ 472, 0.908811873, 0.908811873, 0.908811873, 1.098906838 });
-  returning.emplace(473, Combat_ratings_mult_by_ilvl{ 473, 0.903925771, 0.903925771, 0.903925771, 1.094383193 });
-  returning.emplace(474, Combat_ratings_mult_by_ilvl{ 474, 0.89905213, 0.89905213, 0.89905213, 1.089848937 });
-  returning.emplace(475, Combat_ratings_mult_by_ilvl{ 475, 0.89419114, 0.89419114, 0.89419114, 1.085304655 });
-  returning.emplace(476, Combat_ratings_mult_by_ilvl{ 476, 0.889342985, 0.889342985, 0.889342985, 1.080750924 });
-  returning.emplace(477, Combat_ratings_mult_by_ilvl{ 477, 0.884507846, 0.884507846, 0.884507846, 1.076188309 });
-  returning.emplace(478, Combat_ratings_mult_by_ilvl{ 478, 0.879685898, 0.879685898, 0.879685898, 1.071617367 });
-  returning.emplace(479, Combat_ratings_mult_by_ilvl{ 479, 0.874877313, 0.874877313, 0.874877313, 1.067038646 });
-  returning.emplace(480, Combat_ratings_mult_by_ilvl{ 480, 0.870082256, 0.870082256, 0.870082256, 1.062452682 });
-  returning.emplace(481, Combat_ratings_mult_by_ilvl{ 481, 0.865300891, 0.865300891, 0.865300891, 1.057860003 });
-  returning.emplace(482, Combat_ratings_mult_by_ilvl{ 482, 0.860533377, 0.860533377, 0.860533377, 1.053261129 });
-  returning.emplace(483, Combat_ratings_mult_by_ilvl{ 483, 0.855779867, 0.855779867, 0.855779867, 1.04865657 });
-  returning.emplace(484, Combat_ratings_mult_by_ilvl{ 484, 0.851040512, 0.851040512, 0.851040512, 1.044046826 });
-  returning.emplace(485, Combat_ratings_mult_by_ilvl{ 485, 0.846315459, 0.846315459, 0.846315459, 1.039432389 });
-  returning.emplace(486, Combat_ratings_mult_by_ilvl{ 486, 0.841604848, 0.841604848, 0.841604848, 1.034813744 });
-  returning.emplace(487, Combat_ratings_mult_by_ilvl{ 487, 0.83690882, 0.83690882, 0.83690882, 1.030191365 });
-  returning.emplace(488, Combat_ratings_mult_by_ilvl{ 488, 0.832227509, 0.832227509, 0.832227509, 1.025565719 });
-  returning.emplace(489, Combat_ratings_mult_by_ilvl{ 489, 0.827561046, 0.827561046, 0.827561046, 1.020937264 });
-  returning.emplace(490, Combat_ratings_mult_by_ilvl{ 490, 0.822909557, 0.822909557, 0.822909557, 1.016306449 });
-  returning.emplace(491, Combat_ratings_mult_by_ilvl{ 491, 0.818273167, 0.818273167, 0.818273167, 1.011673717 });
-  returning.emplace(492, Combat_ratings_mult_by_ilvl{ 492, 0.813651996, 0.813651996, 0.813651996, 1.007039502 });
-  returning.emplace(493, Combat_ratings_mult_by_ilvl{ 493, 0.809046159, 0.809046159, 0.809046159, 1.002404229 });
-  returning.emplace(494, Combat_ratings_mult_by_ilvl{ 494, 0.804455771, 0.804455771, 0.804455771, 0.997768317 });
-  returning.emplace(495, Combat_ratings_mult_by_ilvl{ 495, 0.799880941, 0.799880941, 0.799880941, 0.993132176 });
-  returning.emplace(496, Combat_ratings_mult_by_ilvl{ 496, 0.795321774, 0.795321774, 0.795321774, 0.98849621 });
-  returning.emplace(497, Combat_ratings_mult_by_ilvl{ 497, 0.790778374, 0.790778374, 0.790778374, 0.983860813 });
-  returning.emplace(498, Combat_ratings_mult_by_ilvl{ 498, 0.786250841, 0.786250841, 0.786250841, 0.979226374 });
-  returning.emplace(499, Combat_ratings_mult_by_ilvl{ 499, 0.781739271, 0.781739271, 0.781739271, 0.974593274 });
-  returning.emplace(500, Combat_ratings_mult_by_ilvl{ 500, 0.777243758, 0.777243758, 0.777243758, 0.969961887 });
-  returning.emplace(501, Combat_ratings_mult_by_ilvl{ 501, 0.772764391, 0.772764391, 0.772764391, 0.965332579 });
-  returning.emplace(502, Combat_ratings_mult_by_ilvl{ 502, 0.768301258, 0.768301258, 0.768301258, 0.96070571 });
-  returning.emplace(503, Combat_ratings_mult_by_ilvl{ 503, 0.763854443, 0.763854443, 0.763854443, 0.956081634 });
-  returning.emplace(504, Combat_ratings_mult_by_ilvl{ 504, 0.759424027, 0.759424027, 0.759424027, 0.951460695 });
-  returning.emplace(505, Combat_ratings_mult_by_ilvl{ 505, 0.755010088, 0.755010088, 0.755010088, 0.946843235 });
-  returning.emplace(506, Combat_ratings_mult_by_ilvl{ 506, 0.750612703, 0.750612703, 0.750612703, 0.942229585 });
-  returning.emplace(507, Combat_ratings_mult_by_ilvl{ 507, 0.746231943, 0.746231943, 0.746231943, 0.937620072 });
-  returning.emplace(508, Combat_ratings_mult_by_ilvl{ 508, 0.741867878, 0.741867878, 0.741867878, 0.933015017 });
-  returning.emplace(509, Combat_ratings_mult_by_ilvl{ 509, 0.737520575, 0.737520575, 0.737520575, 0.928414732 });
-  returning.emplace(510, Combat_ratings_mult_by_ilvl{ 510, 0.7331901, 0.7331901, 0.7331901, 0.923819527 });
-  returning.emplace(511, Combat_ratings_mult_by_ilvl{ 511, 0.728876513, 0.728876513, 0.728876513, 0.919229701 });
-  returning.emplace(512, Combat_ratings_mult_by_ilvl{ 512, 0.724579875, 0.724579875, 0.724579875, 0.914645551 });
-  returning.emplace(513, Combat_ratings_mult_by_ilvl{ 513, 0.720300241, 0.720300241, 0.720300241, 0.910067366 });
-  returning.emplace(514, Combat_ratings_mult_by_ilvl{ 514, 0.716037665, 0.716037665, 0.716037665, 0.905495429 });
-  returning.emplace(515, Combat_ratings_mult_by_ilvl{ 515, 0.7117922, 0.7117922, 0.7117922, 0.90093002 });
-  returning.emplace(516, Combat_ratings_mult_by_ilvl{ 516, 0.707563895, 0.707563895, 0.707563895, 0.896371409 });
-  returning.emplace(517, Combat_ratings_mult_by_ilvl{ 517, 0.703352796, 0.703352796, 0.703352796, 0.891819863 });
-  returning.emplace(518, Combat_ratings_mult_by_ilvl{ 518, 0.699158948, 0.699158948, 0.699158948, 0.887275644 });
-  returning.emplace(519, Combat_ratings_mult_by_ilvl{ 519, 0.694982394, 0.694982394, 0.694982394, 0.882739006 });
-  returning.emplace(520, Combat_ratings_mult_by_ilvl{ 520, 0.690823173, 0.690823173, 0.690823173, 0.878210201 });
-  returning.emplace(521, Combat_ratings_mult_by_ilvl{ 521, 0.686681322, 0.686681322, 0.686681322, 0.873689473 });
-  returning.emplace(522, Combat_ratings_mult_by_ilvl{ 522, 0.682556879, 0.682556879, 0.682556879, 0.869177062 });
-  returning.emplace(523, Combat_ratings_mult_by_ilvl{ 523, 0.678449875, 0.678449875, 0.678449875, 0.864673202 });
-  returning.emplace(524, Combat_ratings_mult_by_ilvl{ 524, 0.674360342, 0.674360342, 0.674360342, 0.860178123 });
-  returning.emplace(525, Combat_ratings_mult_by_ilvl{ 525, 0.67028831, 0.67028831, 0.67028831, 0.855692049 });
-  returning.emplace(526, Combat_ratings_mult_by_ilvl{ 526, 0.666233805, 0.666233805, 0.666233805, 0.8512152 });
-  returning.emplace(527, Combat_ratings_mult_by_ilvl{ 527, 0.662196852, 0.662196852, 0.662196852, 0.846747791 });
-  returning.emplace(528, Combat_ratings_mult_by_ilvl{ 528, 0.658177476, 0.658177476, 0.658177476, 0.842290032 });
-  returning.emplace(529, Combat_ratings_mult_by_ilvl{ 529, 0.654175696, 0.654175696, 0.654175696, 0.837842127 });
-  returning.emplace(530, Combat_ratings_mult_by_ilvl{ 530, 0.650191533, 0.650191533, 0.650191533, 0.833404278 });
-  returning.emplace(531, Combat_ratings_mult_by_ilvl{ 531, 0.646225003, 0.646225003, 0.646225003, 0.828976681 });
-  returning.emplace(532, Combat_ratings_mult_by_ilvl{ 532, 0.642276123, 0.642276123, 0.642276123, 0.824559527 });
-  returning.emplace(533, Combat_ratings_mult_by_ilvl{ 533, 0.638344906, 0.638344906, 0.638344906, 0.820153003 });
-  returning.emplace(534, Combat_ratings_mult_by_ilvl{ 534, 0.634431364, 0.634431364, 0.634431364, 0.815757292 });
-  returning.emplace(535, Combat_ratings_mult_by_ilvl{ 535, 0.630535508, 0.630535508, 0.630535508, 0.811372573 });
-  returning.emplace(536, Combat_ratings_mult_by_ilvl{ 536, 0.626657345, 0.626657345, 0.626657345, 0.806999019 });
-  returning.emplace(537, Combat_ratings_mult_by_ilvl{ 537, 0.622796884, 0.622796884, 0.622796884, 0.802636801 });
-  returning.emplace(538, Combat_ratings_mult_by_ilvl{ 538, 0.618954128, 0.618954128, 0.618954128, 0.798286085 });
-  returning.emplace(539, Combat_ratings_mult_by_ilvl{ 539, 0.615129082, 0.615129082, 0.615129082, 0.793947032 });
-  returning.emplace(540, Combat_ratings_mult_by_ilvl{ 540, 0.611321748, 0.611321748, 0.611321748, 0.7896198 });
-  returning.emplace(541, Combat_ratings_mult_by_ilvl{ 541, 0.607532127, 0.607532127, 0.607532127, 0.785304544 });
-  returning.emplace(542, Combat_ratings_mult_by_ilvl{ 542, 0.603760216, 0.603760216, 0.603760216, 0.781001413 });
-  returning.emplace(543, Combat_ratings_mult_by_ilvl{ 543, 0.600006014, 0.600006014, 0.600006014, 0.776710554 });
-  returning.emplace(544, Combat_ratings_mult_by_ilvl{ 544, 0.596269517, 0.596269517, 0.596269517, 0.772432108 });
-  returning.emplace(545, Combat_ratings_mult_by_ilvl{ 545, 0.592550719, 0.592550719, 0.592550719, 0.768166216 });
-  returning.emplace(546, Combat_ratings_mult_by_ilvl{ 546, 0.588849613, 0.588849613, 0.588849613, 0.763913012 });
-  returning.emplace(547, Combat_ratings_mult_by_ilvl{ 547, 0.585166191, 0.585166191, 0.585166191, 0.759672627 });
-  returning.emplace(548, Combat_ratings_mult_by_ilvl{ 548, 0.581500443, 0.581500443, 0.581500443, 0.75544519 });
-  returning.emplace(549, Combat_ratings_mult_by_ilvl{ 549, 0.577852358, 0.577852358, 0.577852358, 0.751230825 });
-  returning.emplace(550, Combat_ratings_mult_by_ilvl{ 550, 0.574221924, 0.574221924, 0.574221924, 0.747029653 });
-  returning.emplace(551, Combat_ratings_mult_by_ilvl{ 551, 0.570609128, 0.570609128, 0.570609128, 0.742841793 });
-  returning.emplace(552, Combat_ratings_mult_by_ilvl{ 552, 0.567013953, 0.567013953, 0.567013953, 0.738667358 });
-  returning.emplace(553, Combat_ratings_mult_by_ilvl{ 553, 0.563436385, 0.563436385, 0.563436385, 0.73450646 });
-  returning.emplace(554, Combat_ratings_mult_by_ilvl{ 554, 0.559876406, 0.559876406, 0.559876406, 0.730359207 });
-  returning.emplace(555, Combat_ratings_mult_by_ilvl{ 555, 0.556333997, 0.556333997, 0.556333997, 0.726225703 });
-  returning.emplace(556, Combat_ratings_mult_by_ilvl{ 556, 0.552809139, 0.552809139, 0.552809139, 0.72210605 });
-  returning.emplace(557, Combat_ratings_mult_by_ilvl{ 557, 0.549301811, 0.549301811, 0.549301811, 0.718000347 });
-  returning.emplace(558, Combat_ratings_mult_by_ilvl{ 558, 0.54581199, 0.54581199, 0.54581199, 0.713908689 });
-  returning.emplace(559, Combat_ratings_mult_by_ilvl{ 559, 0.542339654, 0.542339654, 0.542339654, 0.70983117 });
-  returning.emplace(560, Combat_ratings_mult_by_ilvl{ 560, 0.538884779, 0.538884779, 0.538884779, 0.705767878 });
-  returning.emplace(561, Combat_ratings_mult_by_ilvl{ 561, 0.535447339, 0.535447339, 0.535447339, 0.7017189 });
-  returning.emplace(562, Combat_ratings_mult_by_ilvl{ 562, 0.532027309, 0.532027309, 0.532027309, 0.697684321 });
-  returning.emplace(563, Combat_ratings_mult_by_ilvl{ 563, 0.52862466, 0.52862466, 0.52862466, 0.693664222 });
-  returning.emplace(564, Combat_ratings_mult_by_ilvl{ 564, 0.525239365, 0.525239365, 0.525239365, 0.689658681 });
-  returning.emplace(565, Combat_ratings_mult_by_ilvl{ 565, 0.521871394, 0.521871394, 0.521871394, 0.685667773 });
-  returning.emplace(566, Combat_ratings_mult_by_ilvl{ 566, 0.518520717, 0.518520717, 0.518520717, 0.681691573 });
-  returning.emplace(567, Combat_ratings_mult_by_ilvl{ 567, 0.515187304, 0.515187304, 0.515187304, 0.677730149 });
-  returning.emplace(568, Combat_ratings_mult_by_ilvl{ 568, 0.511871122, 0.511871122, 0.511871122, 0.673783572 });
-  returning.emplace(569, Combat_ratings_mult_by_ilvl{ 569, 0.508572138, 0.508572138, 0.508572138, 0.669851904 });
-  returning.emplace(570, Combat_ratings_mult_by_ilvl{ 570, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(571, Combat_ratings_mult_by_ilvl{ 571, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(572, Combat_ratings_mult_by_ilvl{ 572, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(573, Combat_ratings_mult_by_ilvl{ 573, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(574, Combat_ratings_mult_by_ilvl{ 574, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(575, Combat_ratings_mult_by_ilvl{ 575, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(576, Combat_ratings_mult_by_ilvl{ 576, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(577, Combat_ratings_mult_by_ilvl{ 577, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(578, Combat_ratings_mult_by_ilvl{ 578, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(579, Combat_ratings_mult_by_ilvl{ 579, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(580, Combat_ratings_mult_by_ilvl{ 580, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(581, Combat_ratings_mult_by_ilvl{ 581, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(582, Combat_ratings_mult_by_ilvl{ 582, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(583, Combat_ratings_mult_by_ilvl{ 583, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(584, Combat_ratings_mult_by_ilvl{ 584, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(585, Combat_ratings_mult_by_ilvl{ 585, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(586, Combat_ratings_mult_by_ilvl{ 586, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(587, Combat_ratings_mult_by_ilvl{ 587, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(588, Combat_ratings_mult_by_ilvl{ 588, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(589, Combat_ratings_mult_by_ilvl{ 589, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(590, Combat_ratings_mult_by_ilvl{ 590, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(591, Combat_ratings_mult_by_ilvl{ 591, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(592, Combat_ratings_mult_by_ilvl{ 592, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(593, Combat_ratings_mult_by_ilvl{ 593, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(594, Combat_ratings_mult_by_ilvl{ 594, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(595, Combat_ratings_mult_by_ilvl{ 595, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(596, Combat_ratings_mult_by_ilvl{ 596, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(597, Combat_ratings_mult_by_ilvl{ 597, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(598, Combat_ratings_mult_by_ilvl{ 598, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(599, Combat_ratings_mult_by_ilvl{ 599, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(600, Combat_ratings_mult_by_ilvl{ 600, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(601, Combat_ratings_mult_by_ilvl{ 601, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(602, Combat_ratings_mult_by_ilvl{ 602, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(603, Combat_ratings_mult_by_ilvl{ 603, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(604, Combat_ratings_mult_by_ilvl{ 604, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(605, Combat_ratings_mult_by_ilvl{ 605, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(606, Combat_ratings_mult_by_ilvl{ 606, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(607, Combat_ratings_mult_by_ilvl{ 607, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(608, Combat_ratings_mult_by_ilvl{ 608, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(609, Combat_ratings_mult_by_ilvl{ 609, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(610, Combat_ratings_mult_by_ilvl{ 610, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(611, Combat_ratings_mult_by_ilvl{ 611, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(612, Combat_ratings_mult_by_ilvl{ 612, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(613, Combat_ratings_mult_by_ilvl{ 613, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(614, Combat_ratings_mult_by_ilvl{ 614, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(615, Combat_ratings_mult_by_ilvl{ 615, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(616, Combat_ratings_mult_by_ilvl{ 616, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(617, Combat_ratings_mult_by_ilvl{ 617, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(618, Combat_ratings_mult_by_ilvl{ 618, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(619, Combat_ratings_mult_by_ilvl{ 619, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(620, Combat_ratings_mult_by_ilvl{ 620, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(621, Combat_ratings_mult_by_ilvl{ 621, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(622, Combat_ratings_mult_by_ilvl{ 622, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(623, Combat_ratings_mult_by_ilvl{ 623, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(624, Combat_ratings_mult_by_ilvl{ 624, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(625, Combat_ratings_mult_by_ilvl{ 625, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(626, Combat_ratings_mult_by_ilvl{ 626, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(627, Combat_ratings_mult_by_ilvl{ 627, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(628, Combat_ratings_mult_by_ilvl{ 628, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(629, Combat_ratings_mult_by_ilvl{ 629, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(630, Combat_ratings_mult_by_ilvl{ 630, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(631, Combat_ratings_mult_by_ilvl{ 631, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(632, Combat_ratings_mult_by_ilvl{ 632, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(633, Combat_ratings_mult_by_ilvl{ 633, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(634, Combat_ratings_mult_by_ilvl{ 634, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(635, Combat_ratings_mult_by_ilvl{ 635, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(636, Combat_ratings_mult_by_ilvl{ 636, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(637, Combat_ratings_mult_by_ilvl{ 637, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(638, Combat_ratings_mult_by_ilvl{ 638, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(639, Combat_ratings_mult_by_ilvl{ 639, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(640, Combat_ratings_mult_by_ilvl{ 640, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(641, Combat_ratings_mult_by_ilvl{ 641, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(642, Combat_ratings_mult_by_ilvl{ 642, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(643, Combat_ratings_mult_by_ilvl{ 643, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(644, Combat_ratings_mult_by_ilvl{ 644, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(645, Combat_ratings_mult_by_ilvl{ 645, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(646, Combat_ratings_mult_by_ilvl{ 646, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(647, Combat_ratings_mult_by_ilvl{ 647, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(648, Combat_ratings_mult_by_ilvl{ 648, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(649, Combat_ratings_mult_by_ilvl{ 649, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(650, Combat_ratings_mult_by_ilvl{ 650, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(651, Combat_ratings_mult_by_ilvl{ 651, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(652, Combat_ratings_mult_by_ilvl{ 652, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(653, Combat_ratings_mult_by_ilvl{ 653, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(654, Combat_ratings_mult_by_ilvl{ 654, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(655, Combat_ratings_mult_by_ilvl{ 655, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(656, Combat_ratings_mult_by_ilvl{ 656, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(657, Combat_ratings_mult_by_ilvl{ 657, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(658, Combat_ratings_mult_by_ilvl{ 658, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(659, Combat_ratings_mult_by_ilvl{ 659, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(660, Combat_ratings_mult_by_ilvl{ 660, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(661, Combat_ratings_mult_by_ilvl{ 661, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(662, Combat_ratings_mult_by_ilvl{ 662, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(663, Combat_ratings_mult_by_ilvl{ 663, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(664, Combat_ratings_mult_by_ilvl{ 664, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(665, Combat_ratings_mult_by_ilvl{ 665, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(666, Combat_ratings_mult_by_ilvl{ 666, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(667, Combat_ratings_mult_by_ilvl{ 667, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(668, Combat_ratings_mult_by_ilvl{ 668, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(669, Combat_ratings_mult_by_ilvl{ 669, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(670, Combat_ratings_mult_by_ilvl{ 670, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(671, Combat_ratings_mult_by_ilvl{ 671, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(672, Combat_ratings_mult_by_ilvl{ 672, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(673, Combat_ratings_mult_by_ilvl{ 673, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(674, Combat_ratings_mult_by_ilvl{ 674, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(675, Combat_ratings_mult_by_ilvl{ 675, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(676, Combat_ratings_mult_by_ilvl{ 676, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(677, Combat_ratings_mult_by_ilvl{ 677, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(678, Combat_ratings_mult_by_ilvl{ 678, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(679, Combat_ratings_mult_by_ilvl{ 679, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(680, Combat_ratings_mult_by_ilvl{ 680, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(681, Combat_ratings_mult_by_ilvl{ 681, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(682, Combat_ratings_mult_by_ilvl{ 682, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(683, Combat_ratings_mult_by_ilvl{ 683, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(684, Combat_ratings_mult_by_ilvl{ 684, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(685, Combat_ratings_mult_by_ilvl{ 685, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(686, Combat_ratings_mult_by_ilvl{ 686, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(687, Combat_ratings_mult_by_ilvl{ 687, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(688, Combat_ratings_mult_by_ilvl{ 688, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(689, Combat_ratings_mult_by_ilvl{ 689, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(690, Combat_ratings_mult_by_ilvl{ 690, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(691, Combat_ratings_mult_by_ilvl{ 691, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(692, Combat_ratings_mult_by_ilvl{ 692, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(693, Combat_ratings_mult_by_ilvl{ 693, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(694, Combat_ratings_mult_by_ilvl{ 694, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(695, Combat_ratings_mult_by_ilvl{ 695, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(696, Combat_ratings_mult_by_ilvl{ 696, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(697, Combat_ratings_mult_by_ilvl{ 697, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(698, Combat_ratings_mult_by_ilvl{ 698, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(699, Combat_ratings_mult_by_ilvl{ 699, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(700, Combat_ratings_mult_by_ilvl{ 700, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(701, Combat_ratings_mult_by_ilvl{ 701, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(702, Combat_ratings_mult_by_ilvl{ 702, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(703, Combat_ratings_mult_by_ilvl{ 703, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(704, Combat_ratings_mult_by_ilvl{ 704, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(705, Combat_ratings_mult_by_ilvl{ 705, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(706, Combat_ratings_mult_by_ilvl{ 706, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(707, Combat_ratings_mult_by_ilvl{ 707, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(708, Combat_ratings_mult_by_ilvl{ 708, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(709, Combat_ratings_mult_by_ilvl{ 709, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(710, Combat_ratings_mult_by_ilvl{ 710, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(711, Combat_ratings_mult_by_ilvl{ 711, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(712, Combat_ratings_mult_by_ilvl{ 712, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(713, Combat_ratings_mult_by_ilvl{ 713, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(714, Combat_ratings_mult_by_ilvl{ 714, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(715, Combat_ratings_mult_by_ilvl{ 715, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(716, Combat_ratings_mult_by_ilvl{ 716, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(717, Combat_ratings_mult_by_ilvl{ 717, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(718, Combat_ratings_mult_by_ilvl{ 718, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(719, Combat_ratings_mult_by_ilvl{ 719, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(720, Combat_ratings_mult_by_ilvl{ 720, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(721, Combat_ratings_mult_by_ilvl{ 721, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(722, Combat_ratings_mult_by_ilvl{ 722, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(723, Combat_ratings_mult_by_ilvl{ 723, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(724, Combat_ratings_mult_by_ilvl{ 724, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(725, Combat_ratings_mult_by_ilvl{ 725, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(726, Combat_ratings_mult_by_ilvl{ 726, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(727, Combat_ratings_mult_by_ilvl{ 727, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(728, Combat_ratings_mult_by_ilvl{ 728, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(729, Combat_ratings_mult_by_ilvl{ 729, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(730, Combat_ratings_mult_by_ilvl{ 730, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(731, Combat_ratings_mult_by_ilvl{ 731, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(732, Combat_ratings_mult_by_ilvl{ 732, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(733, Combat_ratings_mult_by_ilvl{ 733, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(734, Combat_ratings_mult_by_ilvl{ 734, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(735, Combat_ratings_mult_by_ilvl{ 735, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(736, Combat_ratings_mult_by_ilvl{ 736, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(737, Combat_ratings_mult_by_ilvl{ 737, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(738, Combat_ratings_mult_by_ilvl{ 738, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(739, Combat_ratings_mult_by_ilvl{ 739, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(740, Combat_ratings_mult_by_ilvl{ 740, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(741, Combat_ratings_mult_by_ilvl{ 741, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(742, Combat_ratings_mult_by_ilvl{ 742, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(743, Combat_ratings_mult_by_ilvl{ 743, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(744, Combat_ratings_mult_by_ilvl{ 744, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(745, Combat_ratings_mult_by_ilvl{ 745, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(746, Combat_ratings_mult_by_ilvl{ 746, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(747, Combat_ratings_mult_by_ilvl{ 747, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(748, Combat_ratings_mult_by_ilvl{ 748, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(749, Combat_ratings_mult_by_ilvl{ 749, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(750, Combat_ratings_mult_by_ilvl{ 750, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(751, Combat_ratings_mult_by_ilvl{ 751, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(752, Combat_ratings_mult_by_ilvl{ 752, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(753, Combat_ratings_mult_by_ilvl{ 753, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(754, Combat_ratings_mult_by_ilvl{ 754, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(755, Combat_ratings_mult_by_ilvl{ 755, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(756, Combat_ratings_mult_by_ilvl{ 756, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(757, Combat_ratings_mult_by_ilvl{ 757, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(758, Combat_ratings_mult_by_ilvl{ 758, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(759, Combat_ratings_mult_by_ilvl{ 759, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(760, Combat_ratings_mult_by_ilvl{ 760, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(761, Combat_ratings_mult_by_ilvl{ 761, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(762, Combat_ratings_mult_by_ilvl{ 762, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(763, Combat_ratings_mult_by_ilvl{ 763, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(764, Combat_ratings_mult_by_ilvl{ 764, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(765, Combat_ratings_mult_by_ilvl{ 765, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(766, Combat_ratings_mult_by_ilvl{ 766, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(767, Combat_ratings_mult_by_ilvl{ 767, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(768, Combat_ratings_mult_by_ilvl{ 768, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(769, Combat_ratings_mult_by_ilvl{ 769, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(770, Combat_ratings_mult_by_ilvl{ 770, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(771, Combat_ratings_mult_by_ilvl{ 771, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(772, Combat_ratings_mult_by_ilvl{ 772, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(773, Combat_ratings_mult_by_ilvl{ 773, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(774, Combat_ratings_mult_by_ilvl{ 774, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(775, Combat_ratings_mult_by_ilvl{ 775, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(776, Combat_ratings_mult_by_ilvl{ 776, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(777, Combat_ratings_mult_by_ilvl{ 777, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(778, Combat_ratings_mult_by_ilvl{ 778, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(779, Combat_ratings_mult_by_ilvl{ 779, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(780, Combat_ratings_mult_by_ilvl{ 780, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(781, Combat_ratings_mult_by_ilvl{ 781, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(782, Combat_ratings_mult_by_ilvl{ 782, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(783, Combat_ratings_mult_by_ilvl{ 783, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(784, Combat_ratings_mult_by_ilvl{ 784, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(785, Combat_ratings_mult_by_ilvl{ 785, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(786, Combat_ratings_mult_by_ilvl{ 786, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(787, Combat_ratings_mult_by_ilvl{ 787, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(788, Combat_ratings_mult_by_ilvl{ 788, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(789, Combat_ratings_mult_by_ilvl{ 789, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(790, Combat_ratings_mult_by_ilvl{ 790, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(791, Combat_ratings_mult_by_ilvl{ 791, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(792, Combat_ratings_mult_by_ilvl{ 792, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(793, Combat_ratings_mult_by_ilvl{ 793, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(794, Combat_ratings_mult_by_ilvl{ 794, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(795, Combat_ratings_mult_by_ilvl{ 795, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(796, Combat_ratings_mult_by_ilvl{ 796, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(797, Combat_ratings_mult_by_ilvl{ 797, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(798, Combat_ratings_mult_by_ilvl{ 798, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(799, Combat_ratings_mult_by_ilvl{ 799, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(800, Combat_ratings_mult_by_ilvl{ 800, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(801, Combat_ratings_mult_by_ilvl{ 801, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(802, Combat_ratings_mult_by_ilvl{ 802, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(803, Combat_ratings_mult_by_ilvl{ 803, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(804, Combat_ratings_mult_by_ilvl{ 804, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(805, Combat_ratings_mult_by_ilvl{ 805, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(806, Combat_ratings_mult_by_ilvl{ 806, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(807, Combat_ratings_mult_by_ilvl{ 807, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(808, Combat_ratings_mult_by_ilvl{ 808, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(809, Combat_ratings_mult_by_ilvl{ 809, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(810, Combat_ratings_mult_by_ilvl{ 810, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(811, Combat_ratings_mult_by_ilvl{ 811, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(812, Combat_ratings_mult_by_ilvl{ 812, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(813, Combat_ratings_mult_by_ilvl{ 813, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(814, Combat_ratings_mult_by_ilvl{ 814, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(815, Combat_ratings_mult_by_ilvl{ 815, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(816, Combat_ratings_mult_by_ilvl{ 816, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(817, Combat_ratings_mult_by_ilvl{ 817, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(818, Combat_ratings_mult_by_ilvl{ 818, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(819, Combat_ratings_mult_by_ilvl{ 819, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(820, Combat_ratings_mult_by_ilvl{ 820, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(821, Combat_ratings_mult_by_ilvl{ 821, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(822, Combat_ratings_mult_by_ilvl{ 822, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(823, Combat_ratings_mult_by_ilvl{ 823, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(824, Combat_ratings_mult_by_ilvl{ 824, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(825, Combat_ratings_mult_by_ilvl{ 825, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(826, Combat_ratings_mult_by_ilvl{ 826, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(827, Combat_ratings_mult_by_ilvl{ 827, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(828, Combat_ratings_mult_by_ilvl{ 828, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(829, Combat_ratings_mult_by_ilvl{ 829, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(830, Combat_ratings_mult_by_ilvl{ 830, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(831, Combat_ratings_mult_by_ilvl{ 831, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(832, Combat_ratings_mult_by_ilvl{ 832, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(833, Combat_ratings_mult_by_ilvl{ 833, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(834, Combat_ratings_mult_by_ilvl{ 834, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(835, Combat_ratings_mult_by_ilvl{ 835, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(836, Combat_ratings_mult_by_ilvl{ 836, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(837, Combat_ratings_mult_by_ilvl{ 837, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(838, Combat_ratings_mult_by_ilvl{ 838, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(839, Combat_ratings_mult_by_ilvl{ 839, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(840, Combat_ratings_mult_by_ilvl{ 840, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(841, Combat_ratings_mult_by_ilvl{ 841, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(842, Combat_ratings_mult_by_ilvl{ 842, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(843, Combat_ratings_mult_by_ilvl{ 843, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(844, Combat_ratings_mult_by_ilvl{ 844, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(845, Combat_ratings_mult_by_ilvl{ 845, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(846, Combat_ratings_mult_by_ilvl{ 846, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(847, Combat_ratings_mult_by_ilvl{ 847, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(848, Combat_ratings_mult_by_ilvl{ 848, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(849, Combat_ratings_mult_by_ilvl{ 849, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(850, Combat_ratings_mult_by_ilvl{ 850, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(851, Combat_ratings_mult_by_ilvl{ 851, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(852, Combat_ratings_mult_by_ilvl{ 852, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(853, Combat_ratings_mult_by_ilvl{ 853, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(854, Combat_ratings_mult_by_ilvl{ 854, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(855, Combat_ratings_mult_by_ilvl{ 855, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(856, Combat_ratings_mult_by_ilvl{ 856, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(857, Combat_ratings_mult_by_ilvl{ 857, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(858, Combat_ratings_mult_by_ilvl{ 858, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(859, Combat_ratings_mult_by_ilvl{ 859, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(860, Combat_ratings_mult_by_ilvl{ 860, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(861, Combat_ratings_mult_by_ilvl{ 861, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(862, Combat_ratings_mult_by_ilvl{ 862, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(863, Combat_ratings_mult_by_ilvl{ 863, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(864, Combat_ratings_mult_by_ilvl{ 864, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(865, Combat_ratings_mult_by_ilvl{ 865, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(866, Combat_ratings_mult_by_ilvl{ 866, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(867, Combat_ratings_mult_by_ilvl{ 867, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(868, Combat_ratings_mult_by_ilvl{ 868, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(869, Combat_ratings_mult_by_ilvl{ 869, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(870, Combat_ratings_mult_by_ilvl{ 870, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(871, Combat_ratings_mult_by_ilvl{ 871, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(872, Combat_ratings_mult_by_ilvl{ 872, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(873, Combat_ratings_mult_by_ilvl{ 873, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(874, Combat_ratings_mult_by_ilvl{ 874, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(875, Combat_ratings_mult_by_ilvl{ 875, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(876, Combat_ratings_mult_by_ilvl{ 876, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(877, Combat_ratings_mult_by_ilvl{ 877, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(878, Combat_ratings_mult_by_ilvl{ 878, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(879, Combat_ratings_mult_by_ilvl{ 879, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(880, Combat_ratings_mult_by_ilvl{ 880, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(881, Combat_ratings_mult_by_ilvl{ 881, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(882, Combat_ratings_mult_by_ilvl{ 882, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(883, Combat_ratings_mult_by_ilvl{ 883, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(884, Combat_ratings_mult_by_ilvl{ 884, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(885, Combat_ratings_mult_by_ilvl{ 885, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(886, Combat_ratings_mult_by_ilvl{ 886, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(887, Combat_ratings_mult_by_ilvl{ 887, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(888, Combat_ratings_mult_by_ilvl{ 888, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(889, Combat_ratings_mult_by_ilvl{ 889, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(890, Combat_ratings_mult_by_ilvl{ 890, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(891, Combat_ratings_mult_by_ilvl{ 891, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(892, Combat_ratings_mult_by_ilvl{ 892, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(893, Combat_ratings_mult_by_ilvl{ 893, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(894, Combat_ratings_mult_by_ilvl{ 894, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(895, Combat_ratings_mult_by_ilvl{ 895, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(896, Combat_ratings_mult_by_ilvl{ 896, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(897, Combat_ratings_mult_by_ilvl{ 897, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(898, Combat_ratings_mult_by_ilvl{ 898, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(899, Combat_ratings_mult_by_ilvl{ 899, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(900, Combat_ratings_mult_by_ilvl{ 900, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(901, Combat_ratings_mult_by_ilvl{ 901, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(902, Combat_ratings_mult_by_ilvl{ 902, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(903, Combat_ratings_mult_by_ilvl{ 903, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(904, Combat_ratings_mult_by_ilvl{ 904, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(905, Combat_ratings_mult_by_ilvl{ 905, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(906, Combat_ratings_mult_by_ilvl{ 906, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(907, Combat_ratings_mult_by_ilvl{ 907, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(908, Combat_ratings_mult_by_ilvl{ 908, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(909, Combat_ratings_mult_by_ilvl{ 909, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(910, Combat_ratings_mult_by_ilvl{ 910, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(911, Combat_ratings_mult_by_ilvl{ 911, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(912, Combat_ratings_mult_by_ilvl{ 912, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(913, Combat_ratings_mult_by_ilvl{ 913, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(914, Combat_ratings_mult_by_ilvl{ 914, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(915, Combat_ratings_mult_by_ilvl{ 915, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(916, Combat_ratings_mult_by_ilvl{ 916, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(917, Combat_ratings_mult_by_ilvl{ 917, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(918, Combat_ratings_mult_by_ilvl{ 918, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(919, Combat_ratings_mult_by_ilvl{ 919, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(920, Combat_ratings_mult_by_ilvl{ 920, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(921, Combat_ratings_mult_by_ilvl{ 921, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(922, Combat_ratings_mult_by_ilvl{ 922, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(923, Combat_ratings_mult_by_ilvl{ 923, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(924, Combat_ratings_mult_by_ilvl{ 924, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(925, Combat_ratings_mult_by_ilvl{ 925, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(926, Combat_ratings_mult_by_ilvl{ 926, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(927, Combat_ratings_mult_by_ilvl{ 927, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(928, Combat_ratings_mult_by_ilvl{ 928, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(929, Combat_ratings_mult_by_ilvl{ 929, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(930, Combat_ratings_mult_by_ilvl{ 930, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(931, Combat_ratings_mult_by_ilvl{ 931, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(932, Combat_ratings_mult_by_ilvl{ 932, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(933, Combat_ratings_mult_by_ilvl{ 933, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(934, Combat_ratings_mult_by_ilvl{ 934, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(935, Combat_ratings_mult_by_ilvl{ 935, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(936, Combat_ratings_mult_by_ilvl{ 936, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(937, Combat_ratings_mult_by_ilvl{ 937, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(938, Combat_ratings_mult_by_ilvl{ 938, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(939, Combat_ratings_mult_by_ilvl{ 939, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(940, Combat_ratings_mult_by_ilvl{ 940, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(941, Combat_ratings_mult_by_ilvl{ 941, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(942, Combat_ratings_mult_by_ilvl{ 942, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(943, Combat_ratings_mult_by_ilvl{ 943, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(944, Combat_ratings_mult_by_ilvl{ 944, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(945, Combat_ratings_mult_by_ilvl{ 945, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(946, Combat_ratings_mult_by_ilvl{ 946, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(947, Combat_ratings_mult_by_ilvl{ 947, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(948, Combat_ratings_mult_by_ilvl{ 948, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(949, Combat_ratings_mult_by_ilvl{ 949, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(950, Combat_ratings_mult_by_ilvl{ 950, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(951, Combat_ratings_mult_by_ilvl{ 951, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(952, Combat_ratings_mult_by_ilvl{ 952, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(953, Combat_ratings_mult_by_ilvl{ 953, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(954, Combat_ratings_mult_by_ilvl{ 954, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(955, Combat_ratings_mult_by_ilvl{ 955, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(956, Combat_ratings_mult_by_ilvl{ 956, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(957, Combat_ratings_mult_by_ilvl{ 957, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(958, Combat_ratings_mult_by_ilvl{ 958, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(959, Combat_ratings_mult_by_ilvl{ 959, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(960, Combat_ratings_mult_by_ilvl{ 960, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(961, Combat_ratings_mult_by_ilvl{ 961, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(962, Combat_ratings_mult_by_ilvl{ 962, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(963, Combat_ratings_mult_by_ilvl{ 963, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(964, Combat_ratings_mult_by_ilvl{ 964, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(965, Combat_ratings_mult_by_ilvl{ 965, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(966, Combat_ratings_mult_by_ilvl{ 966, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(967, Combat_ratings_mult_by_ilvl{ 967, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(968, Combat_ratings_mult_by_ilvl{ 968, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(969, Combat_ratings_mult_by_ilvl{ 969, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(970, Combat_ratings_mult_by_ilvl{ 970, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(971, Combat_ratings_mult_by_ilvl{ 971, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(972, Combat_ratings_mult_by_ilvl{ 972, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(973, Combat_ratings_mult_by_ilvl{ 973, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(974, Combat_ratings_mult_by_ilvl{ 974, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(975, Combat_ratings_mult_by_ilvl{ 975, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(976, Combat_ratings_mult_by_ilvl{ 976, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(977, Combat_ratings_mult_by_ilvl{ 977, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(978, Combat_ratings_mult_by_ilvl{ 978, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(979, Combat_ratings_mult_by_ilvl{ 979, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(980, Combat_ratings_mult_by_ilvl{ 980, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(981, Combat_ratings_mult_by_ilvl{ 981, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(982, Combat_ratings_mult_by_ilvl{ 982, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(983, Combat_ratings_mult_by_ilvl{ 983, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(984, Combat_ratings_mult_by_ilvl{ 984, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(985, Combat_ratings_mult_by_ilvl{ 985, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(986, Combat_ratings_mult_by_ilvl{ 986, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(987, Combat_ratings_mult_by_ilvl{ 987, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(988, Combat_ratings_mult_by_ilvl{ 988, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(989, Combat_ratings_mult_by_ilvl{ 989, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(990, Combat_ratings_mult_by_ilvl{ 990, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(991, Combat_ratings_mult_by_ilvl{ 991, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(992, Combat_ratings_mult_by_ilvl{ 992, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(993, Combat_ratings_mult_by_ilvl{ 993, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(994, Combat_ratings_mult_by_ilvl{ 994, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(995, Combat_ratings_mult_by_ilvl{ 995, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(996, Combat_ratings_mult_by_ilvl{ 996, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(997, Combat_ratings_mult_by_ilvl{ 997, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(998, Combat_ratings_mult_by_ilvl{ 998, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(999, Combat_ratings_mult_by_ilvl{ 999, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1000, Combat_ratings_mult_by_ilvl{ 1000, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1001, Combat_ratings_mult_by_ilvl{ 1001, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1002, Combat_ratings_mult_by_ilvl{ 1002, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1003, Combat_ratings_mult_by_ilvl{ 1003, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1004, Combat_ratings_mult_by_ilvl{ 1004, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1005, Combat_ratings_mult_by_ilvl{ 1005, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1006, Combat_ratings_mult_by_ilvl{ 1006, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1007, Combat_ratings_mult_by_ilvl{ 1007, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1008, Combat_ratings_mult_by_ilvl{ 1008, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1009, Combat_ratings_mult_by_ilvl{ 1009, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1010, Combat_ratings_mult_by_ilvl{ 1010, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1011, Combat_ratings_mult_by_ilvl{ 1011, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1012, Combat_ratings_mult_by_ilvl{ 1012, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1013, Combat_ratings_mult_by_ilvl{ 1013, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1014, Combat_ratings_mult_by_ilvl{ 1014, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1015, Combat_ratings_mult_by_ilvl{ 1015, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1016, Combat_ratings_mult_by_ilvl{ 1016, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1017, Combat_ratings_mult_by_ilvl{ 1017, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1018, Combat_ratings_mult_by_ilvl{ 1018, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1019, Combat_ratings_mult_by_ilvl{ 1019, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1020, Combat_ratings_mult_by_ilvl{ 1020, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1021, Combat_ratings_mult_by_ilvl{ 1021, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1022, Combat_ratings_mult_by_ilvl{ 1022, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1023, Combat_ratings_mult_by_ilvl{ 1023, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1024, Combat_ratings_mult_by_ilvl{ 1024, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1025, Combat_ratings_mult_by_ilvl{ 1025, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1026, Combat_ratings_mult_by_ilvl{ 1026, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1027, Combat_ratings_mult_by_ilvl{ 1027, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1028, Combat_ratings_mult_by_ilvl{ 1028, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1029, Combat_ratings_mult_by_ilvl{ 1029, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1030, Combat_ratings_mult_by_ilvl{ 1030, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1031, Combat_ratings_mult_by_ilvl{ 1031, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1032, Combat_ratings_mult_by_ilvl{ 1032, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1033, Combat_ratings_mult_by_ilvl{ 1033, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1034, Combat_ratings_mult_by_ilvl{ 1034, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1035, Combat_ratings_mult_by_ilvl{ 1035, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1036, Combat_ratings_mult_by_ilvl{ 1036, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1037, Combat_ratings_mult_by_ilvl{ 1037, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1038, Combat_ratings_mult_by_ilvl{ 1038, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1039, Combat_ratings_mult_by_ilvl{ 1039, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1040, Combat_ratings_mult_by_ilvl{ 1040, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1041, Combat_ratings_mult_by_ilvl{ 1041, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1042, Combat_ratings_mult_by_ilvl{ 1042, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1043, Combat_ratings_mult_by_ilvl{ 1043, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1044, Combat_ratings_mult_by_ilvl{ 1044, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1045, Combat_ratings_mult_by_ilvl{ 1045, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1046, Combat_ratings_mult_by_ilvl{ 1046, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1047, Combat_ratings_mult_by_ilvl{ 1047, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1048, Combat_ratings_mult_by_ilvl{ 1048, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1049, Combat_ratings_mult_by_ilvl{ 1049, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1050, Combat_ratings_mult_by_ilvl{ 1050, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1051, Combat_ratings_mult_by_ilvl{ 1051, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1052, Combat_ratings_mult_by_ilvl{ 1052, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1053, Combat_ratings_mult_by_ilvl{ 1053, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1054, Combat_ratings_mult_by_ilvl{ 1054, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1055, Combat_ratings_mult_by_ilvl{ 1055, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1056, Combat_ratings_mult_by_ilvl{ 1056, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1057, Combat_ratings_mult_by_ilvl{ 1057, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1058, Combat_ratings_mult_by_ilvl{ 1058, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1059, Combat_ratings_mult_by_ilvl{ 1059, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1060, Combat_ratings_mult_by_ilvl{ 1060, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1061, Combat_ratings_mult_by_ilvl{ 1061, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1062, Combat_ratings_mult_by_ilvl{ 1062, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1063, Combat_ratings_mult_by_ilvl{ 1063, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1064, Combat_ratings_mult_by_ilvl{ 1064, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1065, Combat_ratings_mult_by_ilvl{ 1065, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1066, Combat_ratings_mult_by_ilvl{ 1066, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1067, Combat_ratings_mult_by_ilvl{ 1067, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1068, Combat_ratings_mult_by_ilvl{ 1068, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1069, Combat_ratings_mult_by_ilvl{ 1069, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1070, Combat_ratings_mult_by_ilvl{ 1070, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1071, Combat_ratings_mult_by_ilvl{ 1071, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1072, Combat_ratings_mult_by_ilvl{ 1072, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1073, Combat_ratings_mult_by_ilvl{ 1073, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1074, Combat_ratings_mult_by_ilvl{ 1074, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1075, Combat_ratings_mult_by_ilvl{ 1075, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1076, Combat_ratings_mult_by_ilvl{ 1076, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1077, Combat_ratings_mult_by_ilvl{ 1077, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1078, Combat_ratings_mult_by_ilvl{ 1078, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1079, Combat_ratings_mult_by_ilvl{ 1079, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1080, Combat_ratings_mult_by_ilvl{ 1080, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1081, Combat_ratings_mult_by_ilvl{ 1081, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1082, Combat_ratings_mult_by_ilvl{ 1082, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1083, Combat_ratings_mult_by_ilvl{ 1083, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1084, Combat_ratings_mult_by_ilvl{ 1084, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1085, Combat_ratings_mult_by_ilvl{ 1085, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1086, Combat_ratings_mult_by_ilvl{ 1086, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1087, Combat_ratings_mult_by_ilvl{ 1087, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1088, Combat_ratings_mult_by_ilvl{ 1088, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1089, Combat_ratings_mult_by_ilvl{ 1089, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1090, Combat_ratings_mult_by_ilvl{ 1090, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1091, Combat_ratings_mult_by_ilvl{ 1091, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1092, Combat_ratings_mult_by_ilvl{ 1092, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1093, Combat_ratings_mult_by_ilvl{ 1093, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1094, Combat_ratings_mult_by_ilvl{ 1094, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1095, Combat_ratings_mult_by_ilvl{ 1095, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1096, Combat_ratings_mult_by_ilvl{ 1096, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1097, Combat_ratings_mult_by_ilvl{ 1097, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1098, Combat_ratings_mult_by_ilvl{ 1098, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1099, Combat_ratings_mult_by_ilvl{ 1099, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1100, Combat_ratings_mult_by_ilvl{ 1100, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1101, Combat_ratings_mult_by_ilvl{ 1101, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1102, Combat_ratings_mult_by_ilvl{ 1102, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1103, Combat_ratings_mult_by_ilvl{ 1103, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1104, Combat_ratings_mult_by_ilvl{ 1104, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1105, Combat_ratings_mult_by_ilvl{ 1105, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1106, Combat_ratings_mult_by_ilvl{ 1106, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1107, Combat_ratings_mult_by_ilvl{ 1107, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1108, Combat_ratings_mult_by_ilvl{ 1108, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1109, Combat_ratings_mult_by_ilvl{ 1109, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1110, Combat_ratings_mult_by_ilvl{ 1110, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1111, Combat_ratings_mult_by_ilvl{ 1111, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1112, Combat_ratings_mult_by_ilvl{ 1112, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1113, Combat_ratings_mult_by_ilvl{ 1113, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1114, Combat_ratings_mult_by_ilvl{ 1114, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1115, Combat_ratings_mult_by_ilvl{ 1115, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1116, Combat_ratings_mult_by_ilvl{ 1116, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1117, Combat_ratings_mult_by_ilvl{ 1117, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1118, Combat_ratings_mult_by_ilvl{ 1118, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1119, Combat_ratings_mult_by_ilvl{ 1119, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1120, Combat_ratings_mult_by_ilvl{ 1120, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1121, Combat_ratings_mult_by_ilvl{ 1121, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1122, Combat_ratings_mult_by_ilvl{ 1122, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1123, Combat_ratings_mult_by_ilvl{ 1123, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1124, Combat_ratings_mult_by_ilvl{ 1124, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1125, Combat_ratings_mult_by_ilvl{ 1125, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1126, Combat_ratings_mult_by_ilvl{ 1126, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1127, Combat_ratings_mult_by_ilvl{ 1127, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1128, Combat_ratings_mult_by_ilvl{ 1128, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1129, Combat_ratings_mult_by_ilvl{ 1129, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1130, Combat_ratings_mult_by_ilvl{ 1130, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1131, Combat_ratings_mult_by_ilvl{ 1131, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1132, Combat_ratings_mult_by_ilvl{ 1132, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1133, Combat_ratings_mult_by_ilvl{ 1133, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1134, Combat_ratings_mult_by_ilvl{ 1134, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1135, Combat_ratings_mult_by_ilvl{ 1135, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1136, Combat_ratings_mult_by_ilvl{ 1136, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1137, Combat_ratings_mult_by_ilvl{ 1137, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1138, Combat_ratings_mult_by_ilvl{ 1138, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1139, Combat_ratings_mult_by_ilvl{ 1139, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1140, Combat_ratings_mult_by_ilvl{ 1140, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1141, Combat_ratings_mult_by_ilvl{ 1141, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1142, Combat_ratings_mult_by_ilvl{ 1142, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1143, Combat_ratings_mult_by_ilvl{ 1143, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1144, Combat_ratings_mult_by_ilvl{ 1144, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1145, Combat_ratings_mult_by_ilvl{ 1145, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1146, Combat_ratings_mult_by_ilvl{ 1146, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1147, Combat_ratings_mult_by_ilvl{ 1147, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1148, Combat_ratings_mult_by_ilvl{ 1148, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1149, Combat_ratings_mult_by_ilvl{ 1149, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1150, Combat_ratings_mult_by_ilvl{ 1150, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1151, Combat_ratings_mult_by_ilvl{ 1151, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1152, Combat_ratings_mult_by_ilvl{ 1152, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1153, Combat_ratings_mult_by_ilvl{ 1153, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1154, Combat_ratings_mult_by_ilvl{ 1154, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1155, Combat_ratings_mult_by_ilvl{ 1155, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1156, Combat_ratings_mult_by_ilvl{ 1156, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1157, Combat_ratings_mult_by_ilvl{ 1157, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1158, Combat_ratings_mult_by_ilvl{ 1158, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1159, Combat_ratings_mult_by_ilvl{ 1159, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1160, Combat_ratings_mult_by_ilvl{ 1160, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1161, Combat_ratings_mult_by_ilvl{ 1161, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1162, Combat_ratings_mult_by_ilvl{ 1162, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1163, Combat_ratings_mult_by_ilvl{ 1163, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1164, Combat_ratings_mult_by_ilvl{ 1164, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1165, Combat_ratings_mult_by_ilvl{ 1165, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1166, Combat_ratings_mult_by_ilvl{ 1166, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1167, Combat_ratings_mult_by_ilvl{ 1167, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1168, Combat_ratings_mult_by_ilvl{ 1168, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1169, Combat_ratings_mult_by_ilvl{ 1169, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1170, Combat_ratings_mult_by_ilvl{ 1170, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1171, Combat_ratings_mult_by_ilvl{ 1171, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1172, Combat_ratings_mult_by_ilvl{ 1172, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1173, Combat_ratings_mult_by_ilvl{ 1173, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1174, Combat_ratings_mult_by_ilvl{ 1174, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1175, Combat_ratings_mult_by_ilvl{ 1175, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1176, Combat_ratings_mult_by_ilvl{ 1176, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1177, Combat_ratings_mult_by_ilvl{ 1177, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1178, Combat_ratings_mult_by_ilvl{ 1178, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1179, Combat_ratings_mult_by_ilvl{ 1179, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1180, Combat_ratings_mult_by_ilvl{ 1180, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1181, Combat_ratings_mult_by_ilvl{ 1181, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1182, Combat_ratings_mult_by_ilvl{ 1182, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1183, Combat_ratings_mult_by_ilvl{ 1183, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1184, Combat_ratings_mult_by_ilvl{ 1184, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1185, Combat_ratings_mult_by_ilvl{ 1185, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1186, Combat_ratings_mult_by_ilvl{ 1186, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1187, Combat_ratings_mult_by_ilvl{ 1187, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1188, Combat_ratings_mult_by_ilvl{ 1188, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1189, Combat_ratings_mult_by_ilvl{ 1189, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1190, Combat_ratings_mult_by_ilvl{ 1190, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1191, Combat_ratings_mult_by_ilvl{ 1191, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1192, Combat_ratings_mult_by_ilvl{ 1192, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1193, Combat_ratings_mult_by_ilvl{ 1193, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1194, Combat_ratings_mult_by_ilvl{ 1194, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1195, Combat_ratings_mult_by_ilvl{ 1195, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1196, Combat_ratings_mult_by_ilvl{ 1196, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1197, Combat_ratings_mult_by_ilvl{ 1197, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1198, Combat_ratings_mult_by_ilvl{ 1198, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1199, Combat_ratings_mult_by_ilvl{ 1199, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1200, Combat_ratings_mult_by_ilvl{ 1200, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1201, Combat_ratings_mult_by_ilvl{ 1201, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1202, Combat_ratings_mult_by_ilvl{ 1202, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1203, Combat_ratings_mult_by_ilvl{ 1203, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1204, Combat_ratings_mult_by_ilvl{ 1204, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1205, Combat_ratings_mult_by_ilvl{ 1205, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1206, Combat_ratings_mult_by_ilvl{ 1206, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1207, Combat_ratings_mult_by_ilvl{ 1207, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1208, Combat_ratings_mult_by_ilvl{ 1208, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1209, Combat_ratings_mult_by_ilvl{ 1209, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1210, Combat_ratings_mult_by_ilvl{ 1210, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1211, Combat_ratings_mult_by_ilvl{ 1211, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1212, Combat_ratings_mult_by_ilvl{ 1212, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1213, Combat_ratings_mult_by_ilvl{ 1213, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1214, Combat_ratings_mult_by_ilvl{ 1214, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1215, Combat_ratings_mult_by_ilvl{ 1215, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1216, Combat_ratings_mult_by_ilvl{ 1216, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1217, Combat_ratings_mult_by_ilvl{ 1217, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1218, Combat_ratings_mult_by_ilvl{ 1218, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1219, Combat_ratings_mult_by_ilvl{ 1219, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1220, Combat_ratings_mult_by_ilvl{ 1220, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1221, Combat_ratings_mult_by_ilvl{ 1221, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1222, Combat_ratings_mult_by_ilvl{ 1222, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1223, Combat_ratings_mult_by_ilvl{ 1223, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1224, Combat_ratings_mult_by_ilvl{ 1224, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1225, Combat_ratings_mult_by_ilvl{ 1225, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1226, Combat_ratings_mult_by_ilvl{ 1226, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1227, Combat_ratings_mult_by_ilvl{ 1227, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1228, Combat_ratings_mult_by_ilvl{ 1228, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1229, Combat_ratings_mult_by_ilvl{ 1229, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1230, Combat_ratings_mult_by_ilvl{ 1230, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1231, Combat_ratings_mult_by_ilvl{ 1231, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1232, Combat_ratings_mult_by_ilvl{ 1232, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1233, Combat_ratings_mult_by_ilvl{ 1233, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1234, Combat_ratings_mult_by_ilvl{ 1234, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1235, Combat_ratings_mult_by_ilvl{ 1235, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1236, Combat_ratings_mult_by_ilvl{ 1236, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1237, Combat_ratings_mult_by_ilvl{ 1237, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1238, Combat_ratings_mult_by_ilvl{ 1238, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1239, Combat_ratings_mult_by_ilvl{ 1239, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1240, Combat_ratings_mult_by_ilvl{ 1240, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1241, Combat_ratings_mult_by_ilvl{ 1241, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1242, Combat_ratings_mult_by_ilvl{ 1242, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1243, Combat_ratings_mult_by_ilvl{ 1243, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1244, Combat_ratings_mult_by_ilvl{ 1244, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1245, Combat_ratings_mult_by_ilvl{ 1245, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1246, Combat_ratings_mult_by_ilvl{ 1246, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1247, Combat_ratings_mult_by_ilvl{ 1247, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1248, Combat_ratings_mult_by_ilvl{ 1248, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1249, Combat_ratings_mult_by_ilvl{ 1249, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1250, Combat_ratings_mult_by_ilvl{ 1250, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1251, Combat_ratings_mult_by_ilvl{ 1251, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1252, Combat_ratings_mult_by_ilvl{ 1252, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1253, Combat_ratings_mult_by_ilvl{ 1253, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1254, Combat_ratings_mult_by_ilvl{ 1254, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1255, Combat_ratings_mult_by_ilvl{ 1255, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1256, Combat_ratings_mult_by_ilvl{ 1256, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1257, Combat_ratings_mult_by_ilvl{ 1257, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1258, Combat_ratings_mult_by_ilvl{ 1258, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1259, Combat_ratings_mult_by_ilvl{ 1259, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1260, Combat_ratings_mult_by_ilvl{ 1260, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1261, Combat_ratings_mult_by_ilvl{ 1261, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1262, Combat_ratings_mult_by_ilvl{ 1262, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1263, Combat_ratings_mult_by_ilvl{ 1263, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1264, Combat_ratings_mult_by_ilvl{ 1264, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1265, Combat_ratings_mult_by_ilvl{ 1265, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1266, Combat_ratings_mult_by_ilvl{ 1266, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1267, Combat_ratings_mult_by_ilvl{ 1267, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1268, Combat_ratings_mult_by_ilvl{ 1268, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1269, Combat_ratings_mult_by_ilvl{ 1269, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1270, Combat_ratings_mult_by_ilvl{ 1270, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1271, Combat_ratings_mult_by_ilvl{ 1271, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1272, Combat_ratings_mult_by_ilvl{ 1272, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1273, Combat_ratings_mult_by_ilvl{ 1273, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1274, Combat_ratings_mult_by_ilvl{ 1274, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1275, Combat_ratings_mult_by_ilvl{ 1275, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1276, Combat_ratings_mult_by_ilvl{ 1276, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1277, Combat_ratings_mult_by_ilvl{ 1277, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1278, Combat_ratings_mult_by_ilvl{ 1278, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1279, Combat_ratings_mult_by_ilvl{ 1279, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1280, Combat_ratings_mult_by_ilvl{ 1280, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1281, Combat_ratings_mult_by_ilvl{ 1281, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1282, Combat_ratings_mult_by_ilvl{ 1282, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1283, Combat_ratings_mult_by_ilvl{ 1283, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1284, Combat_ratings_mult_by_ilvl{ 1284, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1285, Combat_ratings_mult_by_ilvl{ 1285, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1286, Combat_ratings_mult_by_ilvl{ 1286, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1287, Combat_ratings_mult_by_ilvl{ 1287, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1288, Combat_ratings_mult_by_ilvl{ 1288, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1289, Combat_ratings_mult_by_ilvl{ 1289, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1290, Combat_ratings_mult_by_ilvl{ 1290, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1291, Combat_ratings_mult_by_ilvl{ 1291, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1292, Combat_ratings_mult_by_ilvl{ 1292, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1293, Combat_ratings_mult_by_ilvl{ 1293, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1294, Combat_ratings_mult_by_ilvl{ 1294, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1295, Combat_ratings_mult_by_ilvl{ 1295, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1296, Combat_ratings_mult_by_ilvl{ 1296, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1297, Combat_ratings_mult_by_ilvl{ 1297, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1298, Combat_ratings_mult_by_ilvl{ 1298, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1299, Combat_ratings_mult_by_ilvl{ 1299, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  returning.emplace(1300, Combat_ratings_mult_by_ilvl{ 1300, 0.505290318, 0.505290318, 0.505290318, 0.665935211 });
-  return returning;
-}();
+namespace {
+  //indexed by ilvl - 1, gaps have ilvl 0
+  constexpr std::array<dbc::Combat_ratings_mult_by_ilvl, 1300> COMBAT_RATINGS_MULT_BY_ILVL{
+    dbc::Combat_ratings_mult_by_ilvl{ 1, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 2, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 3, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 4, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 5, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 6, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 7, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 8, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 9, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 10, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 11, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 12, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 13, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 14, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 15, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 16, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 17, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 18, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 19, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 20, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 21, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 22, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 23, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 24, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 25, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 26, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 27, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 28, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 29, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 30, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 31, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 32, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 33, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 34, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 35, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 36, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 37, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 38, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 39, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 40, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 41, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 42, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 43, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 44, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 45, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 46, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 47, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 48, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 49, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 50, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 51, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 52, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 53, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 54, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 55, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 56, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 57, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 58, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 59, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 60, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 61, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 62, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 63, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 64, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 65, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 66, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 67, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 68, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 69, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 70, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 71, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 72, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 73, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 74, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 75, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 76, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 77, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 78, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 79, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 80, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 81, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 82, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 83, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 84, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 85, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 86, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 87, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 88, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 89, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 90, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 91, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 92, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 93, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 94, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 95, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 96, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 97, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 98, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 99, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 100, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 101, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 102, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 103, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 104, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 105, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 106, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 107, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 108, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 109, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 110, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 111, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 112, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 113, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 114, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 115, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 116, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 117, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 118, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 119, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 120, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 121, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 122, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 123, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 124, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 125, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 126, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 127, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 128, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 129, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 130, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 131, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 132, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 133, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 134, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 135, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 136, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 137, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 138, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 139, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 140, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 141, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 142, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 143, 1.5, 1.5, 1.5, 1.5 },
+    dbc::Combat_ratings_mult_by_ilvl{ 144, 1.495998794, 1.495998794, 1.495998794, 1.486076062 },
+    dbc::Combat_ratings_mult_by_ilvl{ 145, 1.492008262, 1.492008262, 1.492008262, 1.472281374 },
+    dbc::Combat_ratings_mult_by_ilvl{ 146, 1.488028374, 1.488028374, 1.488028374, 1.458614737 },
+    dbc::Combat_ratings_mult_by_ilvl{ 147, 1.484059103, 1.484059103, 1.484059103, 1.445074963 },
+    dbc::Combat_ratings_mult_by_ilvl{ 148, 1.480100419, 1.480100419, 1.480100419, 1.431660873 },
+    dbc::Combat_ratings_mult_by_ilvl{ 149, 1.476152295, 1.476152295, 1.476152295, 1.418371301 },
+    dbc::Combat_ratings_mult_by_ilvl{ 150, 1.472214702, 1.472214702, 1.472214702, 1.405205091 },
+    dbc::Combat_ratings_mult_by_ilvl{ 151, 1.468287613, 1.468287613, 1.468287613, 1.392161099 },
+    dbc::Combat_ratings_mult_by_ilvl{ 152, 1.464371, 1.464371, 1.464371, 1.379238188 },
+    dbc::Combat_ratings_mult_by_ilvl{ 153, 1.460464833, 1.460464833, 1.460464833, 1.366435237 },
+    dbc::Combat_ratings_mult_by_ilvl{ 154, 1.456569087, 1.456569087, 1.456569087, 1.35375113 },
+    dbc::Combat_ratings_mult_by_ilvl{ 155, 1.452683732, 1.452683732, 1.452683732, 1.341184765 },
+    dbc::Combat_ratings_mult_by_ilvl{ 156, 1.448808741, 1.448808741, 1.448808741, 1.328735049 },
+    dbc::Combat_ratings_mult_by_ilvl{ 157, 1.444944086, 1.444944086, 1.444944086, 1.316400899 },
+    dbc::Combat_ratings_mult_by_ilvl{ 158, 1.441089741, 1.441089741, 1.441089741, 1.304181242 },
+    dbc::Combat_ratings_mult_by_ilvl{ 159, 1.437245677, 1.437245677, 1.437245677, 1.292075016 },
+    dbc::Combat_ratings_mult_by_ilvl{ 160, 1.433411866, 1.433411866, 1.433411866, 1.280081168 },
+    dbc::Combat_ratings_mult_by_ilvl{ 161, 1.429588283, 1.429588283, 1.429588283, 1.268198653 },
+    dbc::Combat_ratings_mult_by_ilvl{ 162, 1.425774898, 1.425774898, 1.425774898, 1.25642644 },
+    dbc::Combat_ratings_mult_by_ilvl{ 163, 1.421971686, 1.421971686, 1.421971686, 1.244763504 },
+    dbc::Combat_ratings_mult_by_ilvl{ 164, 1.418178619, 1.418178619, 1.418178619, 1.23320883 },
+    dbc::Combat_ratings_mult_by_ilvl{ 165, 1.414395669, 1.414395669, 1.414395669, 1.221761415 },
+    dbc::Combat_ratings_mult_by_ilvl{ 166, 1.410622811, 1.410622811, 1.410622811, 1.210420261 },
+    dbc::Combat_ratings_mult_by_ilvl{ 167, 1.406860016, 1.406860016, 1.406860016, 1.199184383 },
+    dbc::Combat_ratings_mult_by_ilvl{ 168, 1.403107259, 1.403107259, 1.403107259, 1.188052803 },
+    dbc::Combat_ratings_mult_by_ilvl{ 169, 1.399364512, 1.399364512, 1.399364512, 1.177024554 },
+    dbc::Combat_ratings_mult_by_ilvl{ 170, 1.395631748, 1.395631748, 1.395631748, 1.166098675 },
+    dbc::Combat_ratings_mult_by_ilvl{ 171, 1.391908942, 1.391908942, 1.391908942, 1.155274218 },
+    dbc::Combat_ratings_mult_by_ilvl{ 172, 1.388196066, 1.388196066, 1.388196066, 1.14455024 },
+    dbc::Combat_ratings_mult_by_ilvl{ 173, 1.384493094, 1.384493094, 1.384493094, 1.133925809 },
+    dbc::Combat_ratings_mult_by_ilvl{ 174, 1.3808, 1.3808, 1.3808, 1.1234 },
+    dbc::Combat_ratings_mult_by_ilvl{ 175, 1.379858402, 1.379858402, 1.379858402, 1.132286482 },
+    dbc::Combat_ratings_mult_by_ilvl{ 176, 1.378815505, 1.378815505, 1.378815505, 1.14091151 },
+    dbc::Combat_ratings_mult_by_ilvl{ 177, 1.377673271, 1.377673271, 1.377673271, 1.149279169 },
+    dbc::Combat_ratings_mult_by_ilvl{ 178, 1.37643363, 1.37643363, 1.37643363, 1.157393491 },
+    dbc::Combat_ratings_mult_by_ilvl{ 179, 1.375098487, 1.375098487, 1.375098487, 1.165258455 },
+    dbc::Combat_ratings_mult_by_ilvl{ 180, 1.373669722, 1.373669722, 1.373669722, 1.172877989 },
+    dbc::Combat_ratings_mult_by_ilvl{ 181, 1.372149185, 1.372149185, 1.372149185, 1.180255968 },
+    dbc::Combat_ratings_mult_by_ilvl{ 182, 1.370538701, 1.370538701, 1.370538701, 1.187396218 },
+    dbc::Combat_ratings_mult_by_ilvl{ 183, 1.36884007, 1.36884007, 1.36884007, 1.194302513 },
+    dbc::Combat_ratings_mult_by_ilvl{ 184, 1.367055065, 1.367055065, 1.367055065, 1.200978579 },
+    dbc::Combat_ratings_mult_by_ilvl{ 185, 1.365185434, 1.365185434, 1.365185434, 1.207428092 },
+    dbc::Combat_ratings_mult_by_ilvl{ 186, 1.3632329, 1.3632329, 1.3632329, 1.21365468 },
+    dbc::Combat_ratings_mult_by_ilvl{ 187, 1.361199162, 1.361199162, 1.361199162, 1.219661923 },
+    dbc::Combat_ratings_mult_by_ilvl{ 188, 1.359085895, 1.359085895, 1.359085895, 1.225453355 },
+    dbc::Combat_ratings_mult_by_ilvl{ 189, 1.356894747, 1.356894747, 1.356894747, 1.231032461 },
+    dbc::Combat_ratings_mult_by_ilvl{ 190, 1.354627346, 1.354627346, 1.354627346, 1.236402682 },
+    dbc::Combat_ratings_mult_by_ilvl{ 191, 1.352285294, 1.352285294, 1.352285294, 1.241567412 },
+    dbc::Combat_ratings_mult_by_ilvl{ 192, 1.349870172, 1.349870172, 1.349870172, 1.246530001 },
+    dbc::Combat_ratings_mult_by_ilvl{ 193, 1.347383535, 1.347383535, 1.347383535, 1.251293754 },
+    dbc::Combat_ratings_mult_by_ilvl{ 194, 1.344826917, 1.344826917, 1.344826917, 1.255861932 },
+    dbc::Combat_ratings_mult_by_ilvl{ 195, 1.342201832, 1.342201832, 1.342201832, 1.260237754 },
+    dbc::Combat_ratings_mult_by_ilvl{ 196, 1.339509769, 1.339509769, 1.339509769, 1.264424393 },
+    dbc::Combat_ratings_mult_by_ilvl{ 197, 1.336752195, 1.336752195, 1.336752195, 1.268424984 },
+    dbc::Combat_ratings_mult_by_ilvl{ 198, 1.333930558, 1.333930558, 1.333930558, 1.272242616 },
+    dbc::Combat_ratings_mult_by_ilvl{ 199, 1.331046282, 1.331046282, 1.331046282, 1.275880339 },
+    dbc::Combat_ratings_mult_by_ilvl{ 200, 1.328100774, 1.328100774, 1.328100774, 1.279341162 },
+    dbc::Combat_ratings_mult_by_ilvl{ 201, 1.325095415, 1.325095415, 1.325095415, 1.282628053 },
+    dbc::Combat_ratings_mult_by_ilvl{ 202, 1.32203157, 1.32203157, 1.32203157, 1.285743941 },
+    dbc::Combat_ratings_mult_by_ilvl{ 203, 1.318910583, 1.318910583, 1.318910583, 1.288691714 },
+    dbc::Combat_ratings_mult_by_ilvl{ 204, 1.315733776, 1.315733776, 1.315733776, 1.291474224 },
+    dbc::Combat_ratings_mult_by_ilvl{ 205, 1.312502453, 1.312502453, 1.312502453, 1.294094281 },
+    dbc::Combat_ratings_mult_by_ilvl{ 206, 1.309217899, 1.309217899, 1.309217899, 1.29655466 },
+    dbc::Combat_ratings_mult_by_ilvl{ 207, 1.305881379, 1.305881379, 1.305881379, 1.298858097 },
+    dbc::Combat_ratings_mult_by_ilvl{ 208, 1.30249414, 1.30249414, 1.30249414, 1.301007291 },
+    dbc::Combat_ratings_mult_by_ilvl{ 209, 1.299057408, 1.299057408, 1.299057408, 1.303004906 },
+    dbc::Combat_ratings_mult_by_ilvl{ 210, 1.295572395, 1.295572395, 1.295572395, 1.304853568 },
+    dbc::Combat_ratings_mult_by_ilvl{ 211, 1.29204029, 1.29204029, 1.29204029, 1.306555869 },
+    dbc::Combat_ratings_mult_by_ilvl{ 212, 1.288462266, 1.288462266, 1.288462266, 1.308114363 },
+    dbc::Combat_ratings_mult_by_ilvl{ 213, 1.28483948, 1.28483948, 1.28483948, 1.309531571 },
+    dbc::Combat_ratings_mult_by_ilvl{ 214, 1.28117307, 1.28117307, 1.28117307, 1.310809982 },
+    dbc::Combat_ratings_mult_by_ilvl{ 215, 1.277464155, 1.277464155, 1.277464155, 1.311952046 },
+    dbc::Combat_ratings_mult_by_ilvl{ 216, 1.273713841, 1.273713841, 1.273713841, 1.312960183 },
+    dbc::Combat_ratings_mult_by_ilvl{ 217, 1.269923213, 1.269923213, 1.269923213, 1.313836779 },
+    dbc::Combat_ratings_mult_by_ilvl{ 218, 1.266093343, 1.266093343, 1.266093343, 1.314584187 },
+    dbc::Combat_ratings_mult_by_ilvl{ 219, 1.262225283, 1.262225283, 1.262225283, 1.315204728 },
+    dbc::Combat_ratings_mult_by_ilvl{ 220, 1.258320073, 1.258320073, 1.258320073, 1.315700691 },
+    dbc::Combat_ratings_mult_by_ilvl{ 221, 1.254378733, 1.254378733, 1.254378733, 1.316074333 },
+    dbc::Combat_ratings_mult_by_ilvl{ 222, 1.250402269, 1.250402269, 1.250402269, 1.31632788 },
+    dbc::Combat_ratings_mult_by_ilvl{ 223, 1.246391673, 1.246391673, 1.246391673, 1.316463529 },
+    dbc::Combat_ratings_mult_by_ilvl{ 224, 1.242347918, 1.242347918, 1.242347918, 1.316483442 },
+    dbc::Combat_ratings_mult_by_ilvl{ 225, 1.238271966, 1.238271966, 1.238271966, 1.316389757 },
+    dbc::Combat_ratings_mult_by_ilvl{ 226, 1.234164762, 1.234164762, 1.234164762, 1.316184578 },
+    dbc::Combat_ratings_mult_by_ilvl{ 227, 1.230027234, 1.230027234, 1.230027234, 1.315869981 },
+    dbc::Combat_ratings_mult_by_ilvl{ 228, 1.2258603, 1.2258603, 1.2258603, 1.315448014 },
+    dbc::Combat_ratings_mult_by_ilvl{ 229, 1.221664861, 1.221664861, 1.221664861, 1.314920695 },
+    dbc::Combat_ratings_mult_by_ilvl{ 230, 1.217441803, 1.217441803, 1.217441803, 1.314290014 },
+    dbc::Combat_ratings_mult_by_ilvl{ 231, 1.213191999, 1.213191999, 1.213191999, 1.313557934 },
+    dbc::Combat_ratings_mult_by_ilvl{ 232, 1.20891631, 1.20891631, 1.20891631, 1.31272639 },
+    dbc::Combat_ratings_mult_by_ilvl{ 233, 1.204615581, 1.204615581, 1.204615581, 1.31179729 },
+    dbc::Combat_ratings_mult_by_ilvl{ 234, 1.200290643, 1.200290643, 1.200290643, 1.310772515 },
+    dbc::Combat_ratings_mult_by_ilvl{ 235, 1.195942317, 1.195942317, 1.195942317, 1.30965392 },
+    dbc::Combat_ratings_mult_by_ilvl{ 236, 1.191571407, 1.191571407, 1.191571407, 1.308443332 },
+    dbc::Combat_ratings_mult_by_ilvl{ 237, 1.187178707, 1.187178707, 1.187178707, 1.307142554 },
+    dbc::Combat_ratings_mult_by_ilvl{ 238, 1.182764996, 1.182764996, 1.182764996, 1.305753364 },
+    dbc::Combat_ratings_mult_by_ilvl{ 239, 1.178331043, 1.178331043, 1.178331043, 1.304277513 },
+    dbc::Combat_ratings_mult_by_ilvl{ 240, 1.173877602, 1.173877602, 1.173877602, 1.302716728 },
+    dbc::Combat_ratings_mult_by_ilvl{ 241, 1.169405416, 1.169405416, 1.169405416, 1.301072712 },
+    dbc::Combat_ratings_mult_by_ilvl{ 242, 1.164915216, 1.164915216, 1.164915216, 1.299347141 },
+    dbc::Combat_ratings_mult_by_ilvl{ 243, 1.16040772, 1.16040772, 1.16040772, 1.297541672 },
+    dbc::Combat_ratings_mult_by_ilvl{ 244, 1.155883637, 1.155883637, 1.155883637, 1.295657933 },
+    dbc::Combat_ratings_mult_by_ilvl{ 245, 1.15134366, 1.15134366, 1.15134366, 1.293697532 },
+    dbc::Combat_ratings_mult_by_ilvl{ 246, 1.146788475, 1.146788475, 1.146788475, 1.291662053 },
+    dbc::Combat_ratings_mult_by_ilvl{ 247, 1.142218753, 1.142218753, 1.142218753, 1.289553057 },
+    dbc::Combat_ratings_mult_by_ilvl{ 248, 1.137635155, 1.137635155, 1.137635155, 1.287372083 },
+    dbc::Combat_ratings_mult_by_ilvl{ 249, 1.133038334, 1.133038334, 1.133038334, 1.285120648 },
+    dbc::Combat_ratings_mult_by_ilvl{ 250, 1.128428927, 1.128428927, 1.128428927, 1.282800245 },
+    dbc::Combat_ratings_mult_by_ilvl{ 251, 1.123807564, 1.123807564, 1.123807564, 1.280412348 },
+    dbc::Combat_ratings_mult_by_ilvl{ 252, 1.119174863, 1.119174863, 1.119174863, 1.277958408 },
+    dbc::Combat_ratings_mult_by_ilvl{ 253, 1.114531432, 1.114531432, 1.114531432, 1.275439856 },
+    dbc::Combat_ratings_mult_by_ilvl{ 254, 1.109877867, 1.109877867, 1.109877867, 1.272858101 },
+    dbc::Combat_ratings_mult_by_ilvl{ 255, 1.105214758, 1.105214758, 1.105214758, 1.270214531 },
+    dbc::Combat_ratings_mult_by_ilvl{ 256, 1.10054268, 1.10054268, 1.10054268, 1.267510517 },
+    dbc::Combat_ratings_mult_by_ilvl{ 257, 1.095862202, 1.095862202, 1.095862202, 1.264747406 },
+    dbc::Combat_ratings_mult_by_ilvl{ 258, 1.09117388, 1.09117388, 1.09117388, 1.261926526 },
+    dbc::Combat_ratings_mult_by_ilvl{ 259, 1.086478264, 1.086478264, 1.086478264, 1.259049188 },
+    dbc::Combat_ratings_mult_by_ilvl{ 260, 1.081775891, 1.081775891, 1.081775891, 1.25611668 },
+    dbc::Combat_ratings_mult_by_ilvl{ 261, 1.077067291, 1.077067291, 1.077067291, 1.253130275 },
+    dbc::Combat_ratings_mult_by_ilvl{ 262, 1.072352983, 1.072352983, 1.072352983, 1.250091222 },
+    dbc::Combat_ratings_mult_by_ilvl{ 263, 1.06763348, 1.06763348, 1.06763348, 1.247000757 },
+    dbc::Combat_ratings_mult_by_ilvl{ 264, 1.062909281, 1.062909281, 1.062909281, 1.243860094 },
+    dbc::Combat_ratings_mult_by_ilvl{ 265, 1.058180881, 1.058180881, 1.058180881, 1.24067043 },
+    dbc::Combat_ratings_mult_by_ilvl{ 266, 1.053448764, 1.053448764, 1.053448764, 1.237432944 },
+    dbc::Combat_ratings_mult_by_ilvl{ 267, 1.048713405, 1.048713405, 1.048713405, 1.234148797 },
+    dbc::Combat_ratings_mult_by_ilvl{ 268, 1.043975271, 1.043975271, 1.043975271, 1.230819133 },
+    dbc::Combat_ratings_mult_by_ilvl{ 269, 1.039234822, 1.039234822, 1.039234822, 1.22744508 },
+    dbc::Combat_ratings_mult_by_ilvl{ 270, 1.034492508, 1.034492508, 1.034492508, 1.224027746 },
+    dbc::Combat_ratings_mult_by_ilvl{ 271, 1.02974877, 1.02974877, 1.02974877, 1.220568225 },
+    dbc::Combat_ratings_mult_by_ilvl{ 272, 1.025004044, 1.025004044, 1.025004044, 1.217067593 },
+    dbc::Combat_ratings_mult_by_ilvl{ 273, 1.020258756, 1.020258756, 1.020258756, 1.21352691 },
+    dbc::Combat_ratings_mult_by_ilvl{ 274, 1.015513323, 1.015513323, 1.015513323, 1.20994722 },
+    dbc::Combat_ratings_mult_by_ilvl{ 275, 1.010768158, 1.010768158, 1.010768158, 1.206329552 },
+    dbc::Combat_ratings_mult_by_ilvl{ 276, 1.006023663, 1.006023663, 1.006023663, 1.202674918 },
+    dbc::Combat_ratings_mult_by_ilvl{ 277, 1.001280234, 1.001280234, 1.001280234, 1.198984313 },
+    dbc::Combat_ratings_mult_by_ilvl{ 278, 0.996538259, 0.996538259, 0.996538259, 1.195258721 },
+    dbc::Combat_ratings_mult_by_ilvl{ 279, 0.991798119, 0.991798119, 0.991798119, 1.191499107 },
+    dbc::Combat_ratings_mult_by_ilvl{ 280, 0.987060189, 0.987060189, 0.987060189, 1.187706423 },
+    dbc::Combat_ratings_mult_by_ilvl{ 281, 0.982324834, 0.982324834, 0.982324834, 1.183881605 },
+    dbc::Combat_ratings_mult_by_ilvl{ 282, 0.977592415, 0.977592415, 0.977592415, 1.180025577 },
+    dbc::Combat_ratings_mult_by_ilvl{ 283, 0.972863284, 0.972863284, 0.972863284, 1.176139245 },
+    dbc::Combat_ratings_mult_by_ilvl{ 284, 0.968137787, 0.968137787, 0.968137787, 1.172223503 },
+    dbc::Combat_ratings_mult_by_ilvl{ 285, 0.963416265, 0.963416265, 0.963416265, 1.168279232 },
+    dbc::Combat_ratings_mult_by_ilvl{ 286, 0.958699048, 0.958699048, 0.958699048, 1.164307297 },
+    dbc::Combat_ratings_mult_by_ilvl{ 287, 0.953986465, 0.953986465, 0.953986465, 1.16030855 },
+    dbc::Combat_ratings_mult_by_ilvl{ 288, 0.949278834, 0.949278834, 0.949278834, 1.156283831 },
+    dbc::Combat_ratings_mult_by_ilvl{ 289, 0.944576469, 0.944576469, 0.944576469, 1.152233965 },
+    dbc::Combat_ratings_mult_by_ilvl{ 290, 0.939879677, 0.939879677, 0.939879677, 1.148159765 },
+    dbc::Combat_ratings_mult_by_ilvl{ 291, 0.935188759, 0.935188759, 0.935188759, 1.144062031 },
+    dbc::Combat_ratings_mult_by_ilvl{ 292, 0.930504011, 0.930504011, 0.930504011, 1.139941549 },
+    dbc::Combat_ratings_mult_by_ilvl{ 293, 0.925825721, 0.925825721, 0.925825721, 1.135799093 },
+    dbc::Combat_ratings_mult_by_ilvl{ 294, 0.921154173, 0.921154173, 0.921154173, 1.131635427 },
+    dbc::Combat_ratings_mult_by_ilvl{ 295, 0.916489643, 0.916489643, 0.916489643, 1.127451299 },
+    dbc::Combat_ratings_mult_by_ilvl{ 296, 0.911832404, 0.911832404, 0.911832404, 1.123247447 },
+    dbc::Combat_ratings_mult_by_ilvl{ 297, 0.907182721, 0.907182721, 0.907182721, 1.119024597 },
+    dbc::Combat_ratings_mult_by_ilvl{ 298, 0.902540855, 0.902540855, 0.902540855, 1.114783463 },
+    dbc::Combat_ratings_mult_by_ilvl{ 299, 0.897907061, 0.897907061, 0.897907061, 1.110524747 },
+    dbc::Combat_ratings_mult_by_ilvl{ 300, 0.893281588, 0.893281588, 0.893281588, 1.10624914 },
+    dbc::Combat_ratings_mult_by_ilvl{ 301, 0.888664681, 0.888664681, 0.888664681, 1.101957322 },
+    dbc::Combat_ratings_mult_by_ilvl{ 302, 0.884056578, 0.884056578, 0.884056578, 1.097649961 },
+    dbc::Combat_ratings_mult_by_ilvl{ 303, 0.879457514, 0.879457514, 0.879457514, 1.093327714 },
+    dbc::Combat_ratings_mult_by_ilvl{ 304, 0.874867716, 0.874867716, 0.874867716, 1.088991229 },
+    dbc::Combat_ratings_mult_by_ilvl{ 305, 0.870287409, 0.870287409, 0.870287409, 1.08464114 },
+    dbc::Combat_ratings_mult_by_ilvl{ 306, 0.865716812, 0.865716812, 0.865716812, 1.080278074 },
+    dbc::Combat_ratings_mult_by_ilvl{ 307, 0.861156137, 0.861156137, 0.861156137, 1.075902645 },
+    dbc::Combat_ratings_mult_by_ilvl{ 308, 0.856605595, 0.856605595, 0.856605595, 1.071515458 },
+    dbc::Combat_ratings_mult_by_ilvl{ 309, 0.85206539, 0.85206539, 0.85206539, 1.067117107 },
+    dbc::Combat_ratings_mult_by_ilvl{ 310, 0.847535721, 0.847535721, 0.847535721, 1.062708177 },
+    dbc::Combat_ratings_mult_by_ilvl{ 311, 0.843016783, 0.843016783, 0.843016783, 1.058289242 },
+    dbc::Combat_ratings_mult_by_ilvl{ 312, 0.858663173, 0.858663173, 0.858663173, 1.06237734 },
+    dbc::Combat_ratings_mult_by_ilvl{ 313, 0.874599961, 0.874599961, 0.874599961, 1.066481229 },
+    dbc::Combat_ratings_mult_by_ilvl{ 314, 0.890832536, 0.890832536, 0.890832536, 1.070600972 },
+    dbc::Combat_ratings_mult_by_ilvl{ 315, 0.907366387, 0.907366387, 0.907366387, 1.074736629 },
+    dbc::Combat_ratings_mult_by_ilvl{ 316, 0.924207106, 0.924207106, 0.924207106, 1.078888262 },
+    dbc::Combat_ratings_mult_by_ilvl{ 317, 0.941360389, 0.941360389, 0.941360389, 1.083055933 },
+    dbc::Combat_ratings_mult_by_ilvl{ 318, 0.958832037, 0.958832037, 0.958832037, 1.087239703 },
+    dbc::Combat_ratings_mult_by_ilvl{ 319, 0.976627959, 0.976627959, 0.976627959, 1.091439634 },
+    dbc::Combat_ratings_mult_by_ilvl{ 320, 0.994754173, 0.994754173, 0.994754173, 1.095655789 },
+    dbc::Combat_ratings_mult_by_ilvl{ 321, 1.013216809, 1.013216809, 1.013216809, 1.099888232 },
+    dbc::Combat_ratings_mult_by_ilvl{ 322, 1.032022112, 1.032022112, 1.032022112, 1.104137023 },
+    dbc::Combat_ratings_mult_by_ilvl{ 323, 1.051176442, 1.051176442, 1.051176442, 1.108402228 },
+    dbc::Combat_ratings_mult_by_ilvl{ 324, 1.070686276, 1.070686276, 1.070686276, 1.112683909 },
+    dbc::Combat_ratings_mult_by_ilvl{ 325, 1.090558212, 1.090558212, 1.090558212, 1.116982129 },
+    dbc::Combat_ratings_mult_by_ilvl{ 326, 1.110798971, 1.110798971, 1.110798971, 1.121296954 },
+    dbc::Combat_ratings_mult_by_ilvl{ 327, 1.131415399, 1.131415399, 1.131415399, 1.125628446 },
+    dbc::Combat_ratings_mult_by_ilvl{ 328, 1.152414468, 1.152414468, 1.152414468, 1.12997667 },
+    dbc::Combat_ratings_mult_by_ilvl{ 329, 1.173803279, 1.173803279, 1.173803279, 1.134341692 },
+    dbc::Combat_ratings_mult_by_ilvl{ 330, 1.195589067, 1.195589067, 1.195589067, 1.138723575 },
+    dbc::Combat_ratings_mult_by_ilvl{ 331, 1.217779199, 1.217779199, 1.217779199, 1.143122385 },
+    dbc::Combat_ratings_mult_by_ilvl{ 332, 1.24038118, 1.24038118, 1.24038118, 1.147538187 },
+    dbc::Combat_ratings_mult_by_ilvl{ 333, 1.263402653, 1.263402653, 1.263402653, 1.151971047 },
+    dbc::Combat_ratings_mult_by_ilvl{ 334, 1.286851405, 1.286851405, 1.286851405, 1.156421031 },
+    dbc::Combat_ratings_mult_by_ilvl{ 335, 1.310735366, 1.310735366, 1.310735366, 1.160888205 },
+    dbc::Combat_ratings_mult_by_ilvl{ 336, 1.335062614, 1.335062614, 1.335062614, 1.165372636 },
+    dbc::Combat_ratings_mult_by_ilvl{ 337, 1.359841374, 1.359841374, 1.359841374, 1.169874389 },
+    dbc::Combat_ratings_mult_by_ilvl{ 338, 1.385080029, 1.385080029, 1.385080029, 1.174393533 },
+    dbc::Combat_ratings_mult_by_ilvl{ 339, 1.410787113, 1.410787113, 1.410787113, 1.178930133 },
+    dbc::Combat_ratings_mult_by_ilvl{ 340, 1.436971321, 1.436971321, 1.436971321, 1.183484259 },
+    dbc::Combat_ratings_mult_by_ilvl{ 341, 1.463641507, 1.463641507, 1.463641507, 1.188055976 },
+    dbc::Combat_ratings_mult_by_ilvl{ 342, 1.490806692, 1.490806692, 1.490806692, 1.192645354 },
+    dbc::Combat_ratings_mult_by_ilvl{ 343, 1.48887512, 1.48887512, 1.48887512, 1.200615658 },
+    dbc::Combat_ratings_mult_by_ilvl{ 344, 1.48685115, 1.48685115, 1.48685115, 1.208335546 },
+    dbc::Combat_ratings_mult_by_ilvl{ 345, 1.484736663, 1.484736663, 1.484736663, 1.215808976 },
+    dbc::Combat_ratings_mult_by_ilvl{ 346, 1.482533511, 1.482533511, 1.482533511, 1.223039857 },
+    dbc::Combat_ratings_mult_by_ilvl{ 347, 1.480243521, 1.480243521, 1.480243521, 1.230032045 },
+    dbc::Combat_ratings_mult_by_ilvl{ 348, 1.477868493, 1.477868493, 1.477868493, 1.236789344 },
+    dbc::Combat_ratings_mult_by_ilvl{ 349, 1.475410201, 1.475410201, 1.475410201, 1.243315511 },
+    dbc::Combat_ratings_mult_by_ilvl{ 350, 1.472870394, 1.472870394, 1.472870394, 1.249614251 },
+    dbc::Combat_ratings_mult_by_ilvl{ 351, 1.470250796, 1.470250796, 1.470250796, 1.255689221 },
+    dbc::Combat_ratings_mult_by_ilvl{ 352, 1.467553104, 1.467553104, 1.467553104, 1.26154403 },
+    dbc::Combat_ratings_mult_by_ilvl{ 353, 1.464778993, 1.464778993, 1.464778993, 1.267182239 },
+    dbc::Combat_ratings_mult_by_ilvl{ 354, 1.461930112, 1.461930112, 1.461930112, 1.272607363 },
+    dbc::Combat_ratings_mult_by_ilvl{ 355, 1.459008087, 1.459008087, 1.459008087, 1.277822868 },
+    dbc::Combat_ratings_mult_by_ilvl{ 356, 1.456014519, 1.456014519, 1.456014519, 1.282832176 },
+    dbc::Combat_ratings_mult_by_ilvl{ 357, 1.452950987, 1.452950987, 1.452950987, 1.287638663 },
+    dbc::Combat_ratings_mult_by_ilvl{ 358, 1.449819046, 1.449819046, 1.449819046, 1.292245661 },
+    dbc::Combat_ratings_mult_by_ilvl{ 359, 1.446620228, 1.446620228, 1.446620228, 1.296656456 },
+    dbc::Combat_ratings_mult_by_ilvl{ 360, 1.443356043, 1.443356043, 1.443356043, 1.300874291 },
+    dbc::Combat_ratings_mult_by_ilvl{ 361, 1.440027979, 1.440027979, 1.440027979, 1.304902366 },
+    dbc::Combat_ratings_mult_by_ilvl{ 362, 1.436637501, 1.436637501, 1.436637501, 1.308743837 },
+    dbc::Combat_ratings_mult_by_ilvl{ 363, 1.433186053, 1.433186053, 1.433186053, 1.31240182 },
+    dbc::Combat_ratings_mult_by_ilvl{ 364, 1.429675058, 1.429675058, 1.429675058, 1.315879388 },
+    dbc::Combat_ratings_mult_by_ilvl{ 365, 1.426105917, 1.426105917, 1.426105917, 1.319179571 },
+    dbc::Combat_ratings_mult_by_ilvl{ 366, 1.422480011, 1.422480011, 1.422480011, 1.322305362 },
+    dbc::Combat_ratings_mult_by_ilvl{ 367, 1.418798699, 1.418798699, 1.418798699, 1.325259712 },
+    dbc::Combat_ratings_mult_by_ilvl{ 368, 1.415063321, 1.415063321, 1.415063321, 1.32804553 },
+    dbc::Combat_ratings_mult_by_ilvl{ 369, 1.411275196, 1.411275196, 1.411275196, 1.33066569 },
+    dbc::Combat_ratings_mult_by_ilvl{ 370, 1.407435625, 1.407435625, 1.407435625, 1.333123025 },
+    dbc::Combat_ratings_mult_by_ilvl{ 371, 1.403545887, 1.403545887, 1.403545887, 1.335420328 },
+    dbc::Combat_ratings_mult_by_ilvl{ 372, 1.399607243, 1.399607243, 1.399607243, 1.337560357 },
+    dbc::Combat_ratings_mult_by_ilvl{ 373, 1.395620934, 1.395620934, 1.395620934, 1.339545832 },
+    dbc::Combat_ratings_mult_by_ilvl{ 374, 1.391588184, 1.391588184, 1.391588184, 1.341379435 },
+    dbc::Combat_ratings_mult_by_ilvl{ 375, 1.387510197, 1.387510197, 1.387510197, 1.343063813 },
+    dbc::Combat_ratings_mult_by_ilvl{ 376, 1.383388159, 1.383388159, 1.383388159, 1.344601575 },
+    dbc::Combat_ratings_mult_by_ilvl{ 377, 1.379223237, 1.379223237, 1.379223237, 1.345995297 },
+    dbc::Combat_ratings_mult_by_ilvl{ 378, 1.375016582, 1.375016582, 1.375016582, 1.347247518 },
+    dbc::Combat_ratings_mult_by_ilvl{ 379, 1.370769325, 1.370769325, 1.370769325, 1.348360741 },
+    dbc::Combat_ratings_mult_by_ilvl{ 380, 1.366482582, 1.366482582, 1.366482582, 1.349337439 },
+    dbc::Combat_ratings_mult_by_ilvl{ 381, 1.362157451, 1.362157451, 1.362157451, 1.350180048 },
+    dbc::Combat_ratings_mult_by_ilvl{ 382, 1.357795012, 1.357795012, 1.357795012, 1.35089097 },
+    dbc::Combat_ratings_mult_by_ilvl{ 383, 1.353396329, 1.353396329, 1.353396329, 1.351472576 },
+    dbc::Combat_ratings_mult_by_ilvl{ 384, 1.348962449, 1.348962449, 1.348962449, 1.351927203 },
+    dbc::Combat_ratings_mult_by_ilvl{ 385, 1.344494405, 1.344494405, 1.344494405, 1.352257156 },
+    dbc::Combat_ratings_mult_by_ilvl{ 386, 1.33999321, 1.33999321, 1.33999321, 1.352464709 },
+    dbc::Combat_ratings_mult_by_ilvl{ 387, 1.335459865, 1.335459865, 1.335459865, 1.352552104 },
+    dbc::Combat_ratings_mult_by_ilvl{ 388, 1.330895352, 1.330895352, 1.330895352, 1.352521552 },
+    dbc::Combat_ratings_mult_by_ilvl{ 389, 1.32630064, 1.32630064, 1.32630064, 1.352375233 },
+    dbc::Combat_ratings_mult_by_ilvl{ 390, 1.321676681, 1.321676681, 1.321676681, 1.352115296 },
+    dbc::Combat_ratings_mult_by_ilvl{ 391, 1.317024413, 1.317024413, 1.317024413, 1.351743862 },
+    dbc::Combat_ratings_mult_by_ilvl{ 392, 1.312344759, 1.312344759, 1.312344759, 1.351263022 },
+    dbc::Combat_ratings_mult_by_ilvl{ 393, 1.307638627, 1.307638627, 1.307638627, 1.350674836 },
+    dbc::Combat_ratings_mult_by_ilvl{ 394, 1.302906911, 1.302906911, 1.302906911, 1.349981337 },
+    dbc::Combat_ratings_mult_by_ilvl{ 395, 1.298150489, 1.298150489, 1.298150489, 1.349184529 },
+    dbc::Combat_ratings_mult_by_ilvl{ 396, 1.293370228, 1.293370228, 1.293370228, 1.348286387 },
+    dbc::Combat_ratings_mult_by_ilvl{ 397, 1.288566978, 1.288566978, 1.288566978, 1.347288861 },
+    dbc::Combat_ratings_mult_by_ilvl{ 398, 1.283741577, 1.283741577, 1.283741577, 1.34619387 },
+    dbc::Combat_ratings_mult_by_ilvl{ 399, 1.278894848, 1.278894848, 1.278894848, 1.345003308 },
+    dbc::Combat_ratings_mult_by_ilvl{ 400, 1.274027604, 1.274027604, 1.274027604, 1.343719043 },
+    dbc::Combat_ratings_mult_by_ilvl{ 401, 1.26914064, 1.26914064, 1.26914064, 1.342342914 },
+    dbc::Combat_ratings_mult_by_ilvl{ 402, 1.264234742, 1.264234742, 1.264234742, 1.340876736 },
+    dbc::Combat_ratings_mult_by_ilvl{ 403, 1.259310681, 1.259310681, 1.259310681, 1.339322297 },
+    dbc::Combat_ratings_mult_by_ilvl{ 404, 1.254369215, 1.254369215, 1.254369215, 1.337681361 },
+    dbc::Combat_ratings_mult_by_ilvl{ 405, 1.249411092, 1.249411092, 1.249411092, 1.335955666 },
+    dbc::Combat_ratings_mult_by_ilvl{ 406, 1.244437045, 1.244437045, 1.244437045, 1.334146925 },
+    dbc::Combat_ratings_mult_by_ilvl{ 407, 1.239447795, 1.239447795, 1.239447795, 1.332256826 },
+    dbc::Combat_ratings_mult_by_ilvl{ 408, 1.234444054, 1.234444054, 1.234444054, 1.330287036 },
+    dbc::Combat_ratings_mult_by_ilvl{ 409, 1.229426518, 1.229426518, 1.229426518, 1.328239193 },
+    dbc::Combat_ratings_mult_by_ilvl{ 410, 1.224395874, 1.224395874, 1.224395874, 1.326114916 },
+    dbc::Combat_ratings_mult_by_ilvl{ 411, 1.219352796, 1.219352796, 1.219352796, 1.323915798 },
+    dbc::Combat_ratings_mult_by_ilvl{ 412, 1.214297949, 1.214297949, 1.214297949, 1.32164341 },
+    dbc::Combat_ratings_mult_by_ilvl{ 413, 1.209231983, 1.209231983, 1.209231983, 1.319299301 },
+    dbc::Combat_ratings_mult_by_ilvl{ 414, 1.20415554, 1.20415554, 1.20415554, 1.316884996 },
+    dbc::Combat_ratings_mult_by_ilvl{ 415, 1.199069251, 1.199069251, 1.199069251, 1.314401998 },
+    dbc::Combat_ratings_mult_by_ilvl{ 416, 1.193973733, 1.193973733, 1.193973733, 1.31185179 },
+    dbc::Combat_ratings_mult_by_ilvl{ 417, 1.188869597, 1.188869597, 1.188869597, 1.309235832 },
+    dbc::Combat_ratings_mult_by_ilvl{ 418, 1.18375744, 1.18375744, 1.18375744, 1.306555562 },
+    dbc::Combat_ratings_mult_by_ilvl{ 419, 1.178637849, 1.178637849, 1.178637849, 1.303812399 },
+    dbc::Combat_ratings_mult_by_ilvl{ 420, 1.173511403, 1.173511403, 1.173511403, 1.301007739 },
+    dbc::Combat_ratings_mult_by_ilvl{ 421, 1.168378669, 1.168378669, 1.168378669, 1.29814296 },
+    dbc::Combat_ratings_mult_by_ilvl{ 422, 1.163240204, 1.163240204, 1.163240204, 1.295219417 },
+    dbc::Combat_ratings_mult_by_ilvl{ 423, 1.158096557, 1.158096557, 1.158096557, 1.292238447 },
+    dbc::Combat_ratings_mult_by_ilvl{ 424, 1.152948265, 1.152948265, 1.152948265, 1.289201367 },
+    dbc::Combat_ratings_mult_by_ilvl{ 425, 1.147795857, 1.147795857, 1.147795857, 1.286109473 },
+    dbc::Combat_ratings_mult_by_ilvl{ 426, 1.142639851, 1.142639851, 1.142639851, 1.282964044 },
+    dbc::Combat_ratings_mult_by_ilvl{ 427, 1.137480759, 1.137480759, 1.137480759, 1.279766339 },
+    dbc::Combat_ratings_mult_by_ilvl{ 428, 1.132319081, 1.132319081, 1.132319081, 1.276517597 },
+    dbc::Combat_ratings_mult_by_ilvl{ 429, 1.127155308, 1.127155308, 1.127155308, 1.273219041 },
+    dbc::Combat_ratings_mult_by_ilvl{ 430, 1.121989923, 1.121989923, 1.121989923, 1.269871874 },
+    dbc::Combat_ratings_mult_by_ilvl{ 431, 1.1168234, 1.1168234, 1.1168234, 1.266477281 },
+    dbc::Combat_ratings_mult_by_ilvl{ 432, 1.111656205, 1.111656205, 1.111656205, 1.263036429 },
+    dbc::Combat_ratings_mult_by_ilvl{ 433, 1.106488794, 1.106488794, 1.106488794, 1.259550469 },
+    dbc::Combat_ratings_mult_by_ilvl{ 434, 1.101321616, 1.101321616, 1.101321616, 1.256020534 },
+    dbc::Combat_ratings_mult_by_ilvl{ 435, 1.096155111, 1.096155111, 1.096155111, 1.252447739 },
+    dbc::Combat_ratings_mult_by_ilvl{ 436, 1.090989712, 1.090989712, 1.090989712, 1.248833182 },
+    dbc::Combat_ratings_mult_by_ilvl{ 437, 1.085825841, 1.085825841, 1.085825841, 1.245177945 },
+    dbc::Combat_ratings_mult_by_ilvl{ 438, 1.080663914, 1.080663914, 1.080663914, 1.241483095 },
+    dbc::Combat_ratings_mult_by_ilvl{ 439, 1.075504341, 1.075504341, 1.075504341, 1.237749679 },
+    dbc::Combat_ratings_mult_by_ilvl{ 440, 1.070347521, 1.070347521, 1.070347521, 1.233978732 },
+    dbc::Combat_ratings_mult_by_ilvl{ 441, 1.065193847, 1.065193847, 1.065193847, 1.230171269 },
+    dbc::Combat_ratings_mult_by_ilvl{ 442, 1.060043703, 1.060043703, 1.060043703, 1.226328294 },
+    dbc::Combat_ratings_mult_by_ilvl{ 443, 1.054897469, 1.054897469, 1.054897469, 1.222450792 },
+    dbc::Combat_ratings_mult_by_ilvl{ 444, 1.049755514, 1.049755514, 1.049755514, 1.218539734 },
+    dbc::Combat_ratings_mult_by_ilvl{ 445, 1.044618201, 1.044618201, 1.044618201, 1.214596077 },
+    dbc::Combat_ratings_mult_by_ilvl{ 446, 1.039485888, 1.039485888, 1.039485888, 1.21062076 },
+    dbc::Combat_ratings_mult_by_ilvl{ 447, 1.034358922, 1.034358922, 1.034358922, 1.206614711 },
+    dbc::Combat_ratings_mult_by_ilvl{ 448, 1.029237646, 1.029237646, 1.029237646, 1.202578841 },
+    dbc::Combat_ratings_mult_by_ilvl{ 449, 1.024122396, 1.024122396, 1.024122396, 1.198514049 },
+    dbc::Combat_ratings_mult_by_ilvl{ 450, 1.0190135, 1.0190135, 1.0190135, 1.194421217 },
+    dbc::Combat_ratings_mult_by_ilvl{ 451, 1.01391128, 1.01391128, 1.01391128, 1.190301216 },
+    dbc::Combat_ratings_mult_by_ilvl{ 452, 1.008816052, 1.008816052, 1.008816052, 1.186154902 },
+    dbc::Combat_ratings_mult_by_ilvl{ 453, 1.003728126, 1.003728126, 1.003728126, 1.181983116 },
+    dbc::Combat_ratings_mult_by_ilvl{ 454, 0.998647803, 0.998647803, 0.998647803, 1.177786688 },
+    dbc::Combat_ratings_mult_by_ilvl{ 455, 0.993575381, 0.993575381, 0.993575381, 1.173566434 },
+    dbc::Combat_ratings_mult_by_ilvl{ 456, 0.98851115, 0.98851115, 0.98851115, 1.169323157 },
+    dbc::Combat_ratings_mult_by_ilvl{ 457, 0.983455394, 0.983455394, 0.983455394, 1.165057647 },
+    dbc::Combat_ratings_mult_by_ilvl{ 458, 0.978408392, 0.978408392, 0.978408392, 1.16077068 },
+    dbc::Combat_ratings_mult_by_ilvl{ 459, 0.973370415, 0.973370415, 0.973370415, 1.156463023 },
+    dbc::Combat_ratings_mult_by_ilvl{ 460, 0.968341732, 0.968341732, 0.968341732, 1.152135427 },
+    dbc::Combat_ratings_mult_by_ilvl{ 461, 0.963322602, 0.963322602, 0.963322602, 1.147788633 },
+    dbc::Combat_ratings_mult_by_ilvl{ 462, 0.958313282, 0.958313282, 0.958313282, 1.143423369 },
+    dbc::Combat_ratings_mult_by_ilvl{ 463, 0.95331402, 0.95331402, 0.95331402, 1.139040352 },
+    dbc::Combat_ratings_mult_by_ilvl{ 464, 0.948325062, 0.948325062, 0.948325062, 1.134640286 },
+    dbc::Combat_ratings_mult_by_ilvl{ 465, 0.943346645, 0.943346645, 0.943346645, 1.130223865 },
+    dbc::Combat_ratings_mult_by_ilvl{ 466, 0.938379004, 0.938379004, 0.938379004, 1.12579177 },
+    dbc::Combat_ratings_mult_by_ilvl{ 467, 0.933422367, 0.933422367, 0.933422367, 1.121344672 },
+    dbc::Combat_ratings_mult_by_ilvl{ 468, 0.928476957, 0.928476957, 0.928476957, 1.11688323 },
+    dbc::Combat_ratings_mult_by_ilvl{ 469, 0.923542992, 0.923542992, 0.923542992, 1.112408093 },
+    dbc::Combat_ratings_mult_by_ilvl{ 470, 0.918620685, 0.918620685, 0.918620685, 1.1079199 },
+    dbc::Combat_ratings_mult_by_ilvl{ 471, 0.913710244, 0.913710244, 0.913710244, 1.103419275 },
+    dbc::Combat_ratings_mult_by_ilvl{ 472, 0.908811873, 0.908811873, 0.908811873, 1.098906838 },
+    dbc::Combat_ratings_mult_by_ilvl{ 473, 0.903925771, 0.903925771, 0.903925771, 1.094383193 },
+    dbc::Combat_ratings_mult_by_ilvl{ 474, 0.89905213, 0.89905213, 0.89905213, 1.089848937 },
+    dbc::Combat_ratings_mult_by_ilvl{ 475, 0.89419114, 0.89419114, 0.89419114, 1.085304655 },
+    dbc::Combat_ratings_mult_by_ilvl{ 476, 0.889342985, 0.889342985, 0.889342985, 1.080750924 },
+    dbc::Combat_ratings_mult_by_ilvl{ 477, 0.884507846, 0.884507846, 0.884507846, 1.076188309 },
+    dbc::Combat_ratings_mult_by_ilvl{ 478, 0.879685898, 0.879685898, 0.879685898, 1.071617367 },
+    dbc::Combat_ratings_mult_by_ilvl{ 479, 0.874877313, 0.874877313, 0.874877313, 1.067038646 },
+    dbc::Combat_ratings_mult_by_ilvl{ 480, 0.870082256, 0.870082256, 0.870082256, 1.062452682 },
+    dbc::Combat_ratings_mult_by_ilvl{ 481, 0.865300891, 0.865300891, 0.865300891, 1.057860003 },
+    dbc::Combat_ratings_mult_by_ilvl{ 482, 0.860533377, 0.860533377, 0.860533377, 1.053261129 },
+    dbc::Combat_ratings_mult_by_ilvl{ 483, 0.855779867, 0.855779867, 0.855779867, 1.04865657 },
+    dbc::Combat_ratings_mult_by_ilvl{ 484, 0.851040512, 0.851040512, 0.851040512, 1.044046826 },
+    dbc::Combat_ratings_mult_by_ilvl{ 485, 0.846315459, 0.846315459, 0.846315459, 1.039432389 },
+    dbc::Combat_ratings_mult_by_ilvl{ 486, 0.841604848, 0.841604848, 0.841604848, 1.034813744 },
+    dbc::Combat_ratings_mult_by_ilvl{ 487, 0.83690882, 0.83690882, 0.83690882, 1.030191365 },
+    dbc::Combat_ratings_mult_by_ilvl{ 488, 0.832227509, 0.832227509, 0.832227509, 1.025565719 },
+    dbc::Combat_ratings_mult_by_ilvl{ 489, 0.827561046, 0.827561046, 0.827561046, 1.020937264 },
+    dbc::Combat_ratings_mult_by_ilvl{ 490, 0.822909557, 0.822909557, 0.822909557, 1.016306449 },
+    dbc::Combat_ratings_mult_by_ilvl{ 491, 0.818273167, 0.818273167, 0.818273167, 1.011673717 },
+    dbc::Combat_ratings_mult_by_ilvl{ 492, 0.813651996, 0.813651996, 0.813651996, 1.007039502 },
+    dbc::Combat_ratings_mult_by_ilvl{ 493, 0.809046159, 0.809046159, 0.809046159, 1.002404229 },
+    dbc::Combat_ratings_mult_by_ilvl{ 494, 0.804455771, 0.804455771, 0.804455771, 0.997768317 },
+    dbc::Combat_ratings_mult_by_ilvl{ 495, 0.799880941, 0.799880941, 0.799880941, 0.993132176 },
+    dbc::Combat_ratings_mult_by_ilvl{ 496, 0.795321774, 0.795321774, 0.795321774, 0.98849621 },
+    dbc::Combat_ratings_mult_by_ilvl{ 497, 0.790778374, 0.790778374, 0.790778374, 0.983860813 },
+    dbc::Combat_ratings_mult_by_ilvl{ 498, 0.786250841, 0.786250841, 0.786250841, 0.979226374 },
+    dbc::Combat_ratings_mult_by_ilvl{ 499, 0.781739271, 0.781739271, 0.781739271, 0.974593274 },
+    dbc::Combat_ratings_mult_by_ilvl{ 500, 0.777243758, 0.777243758, 0.777243758, 0.969961887 },
+    dbc::Combat_ratings_mult_by_ilvl{ 501, 0.772764391, 0.772764391, 0.772764391, 0.965332579 },
+    dbc::Combat_ratings_mult_by_ilvl{ 502, 0.768301258, 0.768301258, 0.768301258, 0.96070571 },
+    dbc::Combat_ratings_mult_by_ilvl{ 503, 0.763854443, 0.763854443, 0.763854443, 0.956081634 },
+    dbc::Combat_ratings_mult_by_ilvl{ 504, 0.759424027, 0.759424027, 0.759424027, 0.951460695 },
+    dbc::Combat_ratings_mult_by_ilvl{ 505, 0.755010088, 0.755010088, 0.755010088, 0.946843235 },
+    dbc::Combat_ratings_mult_by_ilvl{ 506, 0.750612703, 0.750612703, 0.750612703, 0.942229585 },
+    dbc::Combat_ratings_mult_by_ilvl{ 507, 0.746231943, 0.746231943, 0.746231943, 0.937620072 },
+    dbc::Combat_ratings_mult_by_ilvl{ 508, 0.741867878, 0.741867878, 0.741867878, 0.933015017 },
+    dbc::Combat_ratings_mult_by_ilvl{ 509, 0.737520575, 0.737520575, 0.737520575, 0.928414732 },
+    dbc::Combat_ratings_mult_by_ilvl{ 510, 0.7331901, 0.7331901, 0.7331901, 0.923819527 },
+    dbc::Combat_ratings_mult_by_ilvl{ 511, 0.728876513, 0.728876513, 0.728876513, 0.919229701 },
+    dbc::Combat_ratings_mult_by_ilvl{ 512, 0.724579875, 0.724579875, 0.724579875, 0.914645551 },
+    dbc::Combat_ratings_mult_by_ilvl{ 513, 0.720300241, 0.720300241, 0.720300241, 0.910067366 },
+    dbc::Combat_ratings_mult_by_ilvl{ 514, 0.716037665, 0.716037665, 0.716037665, 0.905495429 },
+    dbc::Combat_ratings_mult_by_ilvl{ 515, 0.7117922, 0.7117922, 0.7117922, 0.90093002 },
+    dbc::Combat_ratings_mult_by_ilvl{ 516, 0.707563895, 0.707563895, 0.707563895, 0.896371409 },
+    dbc::Combat_ratings_mult_by_ilvl{ 517, 0.703352796, 0.703352796, 0.703352796, 0.891819863 },
+    dbc::Combat_ratings_mult_by_ilvl{ 518, 0.699158948, 0.699158948, 0.699158948, 0.887275644 },
+    dbc::Combat_ratings_mult_by_ilvl{ 519, 0.694982394, 0.694982394, 0.694982394, 0.882739006 },
+    dbc::Combat_ratings_mult_by_ilvl{ 520, 0.690823173, 0.690823173, 0.690823173, 0.878210201 },
+    dbc::Combat_ratings_mult_by_ilvl{ 521, 0.686681322, 0.686681322, 0.686681322, 0.873689473 },
+    dbc::Combat_ratings_mult_by_ilvl{ 522, 0.682556879, 0.682556879, 0.682556879, 0.869177062 },
+    dbc::Combat_ratings_mult_by_ilvl{ 523, 0.678449875, 0.678449875, 0.678449875, 0.864673202 },
+    dbc::Combat_ratings_mult_by_ilvl{ 524, 0.674360342, 0.674360342, 0.674360342, 0.860178123 },
+    dbc::Combat_ratings_mult_by_ilvl{ 525, 0.67028831, 0.67028831, 0.67028831, 0.855692049 },
+    dbc::Combat_ratings_mult_by_ilvl{ 526, 0.666233805, 0.666233805, 0.666233805, 0.8512152 },
+    dbc::Combat_ratings_mult_by_ilvl{ 527, 0.662196852, 0.662196852, 0.662196852, 0.846747791 },
+    dbc::Combat_ratings_mult_by_ilvl{ 528, 0.658177476, 0.658177476, 0.658177476, 0.842290032 },
+    dbc::Combat_ratings_mult_by_ilvl{ 529, 0.654175696, 0.654175696, 0.654175696, 0.837842127 },
+    dbc::Combat_ratings_mult_by_ilvl{ 530, 0.650191533, 0.650191533, 0.650191533, 0.833404278 },
+    dbc::Combat_ratings_mult_by_ilvl{ 531, 0.646225003, 0.646225003, 0.646225003, 0.828976681 },
+    dbc::Combat_ratings_mult_by_ilvl{ 532, 0.642276123, 0.642276123, 0.642276123, 0.824559527 },
+    dbc::Combat_ratings_mult_by_ilvl{ 533, 0.638344906, 0.638344906, 0.638344906, 0.820153003 },
+    dbc::Combat_ratings_mult_by_ilvl{ 534, 0.634431364, 0.634431364, 0.634431364, 0.815757292 },
+    dbc::Combat_ratings_mult_by_ilvl{ 535, 0.630535508, 0.630535508, 0.630535508, 0.811372573 },
+    dbc::Combat_ratings_mult_by_ilvl{ 536, 0.626657345, 0.626657345, 0.626657345, 0.806999019 },
+    dbc::Combat_ratings_mult_by_ilvl{ 537, 0.622796884, 0.622796884, 0.622796884, 0.802636801 },
+    dbc::Combat_ratings_mult_by_ilvl{ 538, 0.618954128, 0.618954128, 0.618954128, 0.798286085 },
+    dbc::Combat_ratings_mult_by_ilvl{ 539, 0.615129082, 0.615129082, 0.615129082, 0.793947032 },
+    dbc::Combat_ratings_mult_by_ilvl{ 540, 0.611321748, 0.611321748, 0.611321748, 0.7896198 },
+    dbc::Combat_ratings_mult_by_ilvl{ 541, 0.607532127, 0.607532127, 0.607532127, 0.785304544 },
+    dbc::Combat_ratings_mult_by_ilvl{ 542, 0.603760216, 0.603760216, 0.603760216, 0.781001413 },
+    dbc::Combat_ratings_mult_by_ilvl{ 543, 0.600006014, 0.600006014, 0.600006014, 0.776710554 },
+    dbc::Combat_ratings_mult_by_ilvl{ 544, 0.596269517, 0.596269517, 0.596269517, 0.772432108 },
+    dbc::Combat_ratings_mult_by_ilvl{ 545, 0.592550719, 0.592550719, 0.592550719, 0.768166216 },
+    dbc::Combat_ratings_mult_by_ilvl{ 546, 0.588849613, 0.588849613, 0.588849613, 0.763913012 },
+    dbc::Combat_ratings_mult_by_ilvl{ 547, 0.585166191, 0.585166191, 0.585166191, 0.759672627 },
+    dbc::Combat_ratings_mult_by_ilvl{ 548, 0.581500443, 0.581500443, 0.581500443, 0.75544519 },
+    dbc::Combat_ratings_mult_by_ilvl{ 549, 0.577852358, 0.577852358, 0.577852358, 0.751230825 },
+    dbc::Combat_ratings_mult_by_ilvl{ 550, 0.574221924, 0.574221924, 0.574221924, 0.747029653 },
+    dbc::Combat_ratings_mult_by_ilvl{ 551, 0.570609128, 0.570609128, 0.570609128, 0.742841793 },
+    dbc::Combat_ratings_mult_by_ilvl{ 552, 0.567013953, 0.567013953, 0.567013953, 0.738667358 },
+    dbc::Combat_ratings_mult_by_ilvl{ 553, 0.563436385, 0.563436385, 0.563436385, 0.73450646 },
+    dbc::Combat_ratings_mult_by_ilvl{ 554, 0.559876406, 0.559876406, 0.559876406, 0.730359207 },
+    dbc::Combat_ratings_mult_by_ilvl{ 555, 0.556333997, 0.556333997, 0.556333997, 0.726225703 },
+    dbc::Combat_ratings_mult_by_ilvl{ 556, 0.552809139, 0.552809139, 0.552809139, 0.72210605 },
+    dbc::Combat_ratings_mult_by_ilvl{ 557, 0.549301811, 0.549301811, 0.549301811, 0.718000347 },
+    dbc::Combat_ratings_mult_by_ilvl{ 558, 0.54581199, 0.54581199, 0.54581199, 0.713908689 },
+    dbc::Combat_ratings_mult_by_ilvl{ 559, 0.542339654, 0.542339654, 0.542339654, 0.70983117 },
+    dbc::Combat_ratings_mult_by_ilvl{ 560, 0.538884779, 0.538884779, 0.538884779, 0.705767878 },
+    dbc::Combat_ratings_mult_by_ilvl{ 561, 0.535447339, 0.535447339, 0.535447339, 0.7017189 },
+    dbc::Combat_ratings_mult_by_ilvl{ 562, 0.532027309, 0.532027309, 0.532027309, 0.697684321 },
+    dbc::Combat_ratings_mult_by_ilvl{ 563, 0.52862466, 0.52862466, 0.52862466, 0.693664222 },
+    dbc::Combat_ratings_mult_by_ilvl{ 564, 0.525239365, 0.525239365, 0.525239365, 0.689658681 },
+    dbc::Combat_ratings_mult_by_ilvl{ 565, 0.521871394, 0.521871394, 0.521871394, 0.685667773 },
+    dbc::Combat_ratings_mult_by_ilvl{ 566, 0.518520717, 0.518520717, 0.518520717, 0.681691573 },
+    dbc::Combat_ratings_mult_by_ilvl{ 567, 0.515187304, 0.515187304, 0.515187304, 0.677730149 },
+    dbc::Combat_ratings_mult_by_ilvl{ 568, 0.511871122, 0.511871122, 0.511871122, 0.673783572 },
+    dbc::Combat_ratings_mult_by_ilvl{ 569, 0.508572138, 0.508572138, 0.508572138, 0.669851904 },
+    dbc::Combat_ratings_mult_by_ilvl{ 570, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 571, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 572, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 573, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 574, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 575, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 576, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 577, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 578, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 579, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 580, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 581, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 582, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 583, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 584, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 585, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 586, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 587, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 588, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 589, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 590, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 591, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 592, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 593, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 594, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 595, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 596, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 597, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 598, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 599, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 600, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 601, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 602, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 603, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 604, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 605, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 606, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 607, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 608, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 609, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 610, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 611, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 612, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 613, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 614, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 615, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 616, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 617, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 618, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 619, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 620, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 621, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 622, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 623, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 624, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 625, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 626, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 627, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 628, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 629, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 630, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 631, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 632, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 633, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 634, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 635, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 636, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 637, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 638, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 639, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 640, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 641, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 642, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 643, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 644, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 645, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 646, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 647, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 648, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 649, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 650, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 651, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 652, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 653, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 654, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 655, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 656, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 657, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 658, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 659, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 660, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 661, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 662, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 663, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 664, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 665, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 666, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 667, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 668, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 669, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 670, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 671, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 672, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 673, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 674, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 675, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 676, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 677, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 678, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 679, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 680, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 681, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 682, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 683, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 684, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 685, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 686, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 687, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 688, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 689, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 690, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 691, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 692, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 693, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 694, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 695, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 696, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 697, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 698, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 699, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 700, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 701, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 702, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 703, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 704, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 705, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 706, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 707, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 708, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 709, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 710, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 711, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 712, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 713, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 714, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 715, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 716, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 717, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 718, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 719, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 720, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 721, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 722, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 723, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 724, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 725, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 726, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 727, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 728, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 729, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 730, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 731, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 732, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 733, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 734, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 735, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 736, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 737, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 738, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 739, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 740, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 741, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 742, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 743, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 744, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 745, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 746, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 747, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 748, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 749, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 750, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 751, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 752, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 753, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 754, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 755, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 756, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 757, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 758, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 759, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 760, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 761, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 762, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 763, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 764, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 765, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 766, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 767, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 768, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 769, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 770, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 771, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 772, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 773, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 774, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 775, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 776, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 777, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 778, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 779, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 780, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 781, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 782, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 783, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 784, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 785, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 786, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 787, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 788, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 789, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 790, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 791, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 792, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 793, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 794, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 795, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 796, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 797, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 798, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 799, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 800, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 801, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 802, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 803, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 804, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 805, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 806, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 807, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 808, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 809, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 810, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 811, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 812, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 813, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 814, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 815, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 816, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 817, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 818, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 819, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 820, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 821, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 822, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 823, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 824, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 825, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 826, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 827, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 828, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 829, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 830, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 831, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 832, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 833, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 834, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 835, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 836, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 837, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 838, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 839, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 840, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 841, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 842, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 843, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 844, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 845, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 846, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 847, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 848, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 849, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 850, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 851, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 852, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 853, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 854, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 855, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 856, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 857, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 858, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 859, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 860, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 861, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 862, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 863, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 864, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 865, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 866, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 867, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 868, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 869, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 870, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 871, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 872, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 873, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 874, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 875, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 876, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 877, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 878, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 879, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 880, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 881, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 882, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 883, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 884, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 885, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 886, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 887, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 888, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 889, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 890, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 891, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 892, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 893, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 894, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 895, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 896, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 897, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 898, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 899, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 900, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 901, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 902, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 903, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 904, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 905, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 906, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 907, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 908, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 909, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 910, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 911, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 912, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 913, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 914, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 915, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 916, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 917, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 918, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 919, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 920, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 921, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 922, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 923, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 924, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 925, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 926, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 927, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 928, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 929, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 930, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 931, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 932, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 933, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 934, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 935, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 936, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 937, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 938, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 939, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 940, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 941, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 942, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 943, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 944, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 945, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 946, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 947, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 948, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 949, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 950, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 951, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 952, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 953, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 954, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 955, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 956, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 957, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 958, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 959, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 960, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 961, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 962, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 963, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 964, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 965, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 966, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 967, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 968, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 969, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 970, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 971, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 972, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 973, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 974, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 975, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 976, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 977, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 978, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 979, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 980, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 981, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 982, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 983, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 984, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 985, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 986, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 987, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 988, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 989, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 990, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 991, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 992, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 993, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 994, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 995, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 996, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 997, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 998, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 999, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1000, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1001, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1002, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1003, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1004, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1005, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1006, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1007, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1008, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1009, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1010, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1011, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1012, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1013, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1014, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1015, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1016, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1017, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1018, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1019, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1020, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1021, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1022, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1023, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1024, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1025, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1026, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1027, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1028, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1029, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1030, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1031, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1032, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1033, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1034, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1035, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1036, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1037, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1038, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1039, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1040, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1041, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1042, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1043, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1044, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1045, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1046, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1047, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1048, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1049, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1050, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1051, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1052, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1053, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1054, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1055, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1056, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1057, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1058, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1059, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1060, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1061, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1062, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1063, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1064, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1065, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1066, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1067, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1068, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1069, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1070, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1071, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1072, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1073, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1074, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1075, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1076, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1077, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1078, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1079, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1080, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1081, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1082, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1083, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1084, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1085, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1086, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1087, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1088, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1089, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1090, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1091, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1092, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1093, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1094, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1095, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1096, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1097, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1098, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1099, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1100, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1101, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1102, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1103, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1104, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1105, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1106, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1107, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1108, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1109, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1110, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1111, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1112, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1113, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1114, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1115, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1116, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1117, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1118, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1119, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1120, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1121, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1122, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1123, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1124, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1125, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1126, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1127, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1128, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1129, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1130, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1131, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1132, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1133, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1134, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1135, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1136, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1137, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1138, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1139, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1140, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1141, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1142, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1143, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1144, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1145, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1146, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1147, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1148, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1149, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1150, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1151, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1152, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1153, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1154, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1155, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1156, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1157, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1158, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1159, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1160, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1161, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1162, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1163, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1164, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1165, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1166, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1167, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1168, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1169, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1170, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1171, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1172, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1173, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1174, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1175, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1176, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1177, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1178, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1179, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1180, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1181, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1182, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1183, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1184, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1185, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1186, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1187, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1188, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1189, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1190, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1191, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1192, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1193, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1194, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1195, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1196, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1197, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1198, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1199, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1200, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1201, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1202, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1203, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1204, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1205, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1206, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1207, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1208, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1209, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1210, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1211, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1212, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1213, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1214, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1215, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1216, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1217, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1218, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1219, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1220, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1221, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1222, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1223, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1224, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1225, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1226, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1227, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1228, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1229, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1230, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1231, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1232, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1233, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1234, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1235, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1236, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1237, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1238, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1239, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1240, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1241, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1242, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1243, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1244, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1245, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1246, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1247, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1248, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1249, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1250, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1251, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1252, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1253, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1254, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1255, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1256, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1257, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1258, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1259, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1260, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1261, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1262, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1263, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1264, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1265, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1266, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1267, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1268, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1269, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1270, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1271, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1272, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1273, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1274, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1275, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1276, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1277, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1278, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1279, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1280, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1281, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1282, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1283, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1284, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1285, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1286, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1287, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1288, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1289, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1290, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1291, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1292, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1293, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1294, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1295, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1296, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1297, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1298, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1299, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+    dbc::Combat_ratings_mult_by_ilvl{ 1300, 0.505290318, 0.505290318, 0.505290318, 0.665935211 },
+  };
+}
+
+dbc::Combat_ratings_mult_by_ilvl const* dbc::combat_ratings_mult_by_ilvl(std::uint16_t ilvl) noexcept {
+  //ilvl 0 wraps around and fails the bounds check
+  const std::uint32_t index = static_cast<std::uint32_t>(ilvl) - 1;
+  const auto table = pack::table(pack::Section::combat_ratings_mult_by_ilvl, std::span<const dbc::Combat_ratings_mult_by_ilvl>{ COMBAT_RATINGS_MULT_BY_ILVL });
+  if (index >= table.size() || table[index].ilvl != ilvl) {
+    return nullptr;
+  }
+  return &table[index];
+}
 
@@ -0,0 +1,226 @@
+#include <prescience_helper/sim/dbc/pack.hpp>
+#include <prescience_helper/sim/dbc/combat_ratings_mult_by_ilvl.hpp>
+#include <prescience_helper/sim/dbc/rand_prop_points.hpp>
+#include <prescience_helper/sim.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dbc = prescience_helper::sim::dbc;
+namespace pack = prescience_helper::sim::dbc::pack;
+
+//sections are used in place as these, so their layouts have to be the records'
+static_assert(sizeof(dbc::Rand_prop_point) == sizeof(pack::Rand_prop_point_record));
+static_assert(offsetof(dbc::Rand_prop_point, damage_replace_stat) == offsetof(pack::Rand_prop_point_record, damage_replace_stat));
+static_assert(offsetof(dbc::Rand_prop_point, damage_secondary) == offsetof(pack::Rand_prop_point_record, damage_secondary));
+static_assert(offsetof(dbc::Rand_prop_point, budget) == offsetof(pack::Rand_prop_point_record, budget));
+static_assert(sizeof(dbc::Combat_ratings_mult_by_ilvl) == sizeof(pack::Combat_ratings_record));
+static_assert(offsetof(dbc::Combat_ratings_mult_by_ilvl, armor) == offsetof(pack::Combat_ratings_record, armor));
+static_assert(offsetof(dbc::Combat_ratings_mult_by_ilvl, weapon) == offsetof(pack::Combat_ratings_record, weapon));
+static_assert(offsetof(dbc::Combat_ratings_mult_by_ilvl, trinket) == offsetof(pack::Combat_ratings_record, trinket));
+static_assert(offsetof(dbc::Combat_ratings_mult_by_ilvl, jewelry) == offsetof(pack::Combat_ratings_record, jewelry));
+
+namespace {
+  //a read only view of a whole file, unmapped when destroyed
+  struct Mapped_file {
+  public:
+    Mapped_file(std::filesystem::path const& path) {
+#ifdef _WIN32
+      file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file_ == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Couldn't open dbc pack " + path.string());
+      }
+      LARGE_INTEGER size;
+      if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) {
+        CloseHandle(file_);
+        throw std::runtime_error("Couldn't map dbc pack " + path.string());
+      }
+      mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      const void* view = mapping_ == nullptr ? nullptr : MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+      if (view == nullptr) {
+        if (mapping_ != nullptr) {
+          CloseHandle(mapping_);
+        }
+        CloseHandle(file_);
+        throw std::runtime_error("Couldn't map dbc pack " + path.string());
+      }
+      bytes_ = { static_cast<const std::byte*>(view), static_cast<std::size_t>(size.QuadPart) };
+#else
+      const int fd = open(path.c_str(), O_RDONLY);
+      if (fd < 0) {
+        throw std::runtime_error("Couldn't open dbc pack " + path.string());
+      }
+      struct stat info;
+      void* view = MAP_FAILED;
+      if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      //the mapping keeps the file alive
+      close(fd);
+      if (view == MAP_FAILED) {
+        throw std::runtime_error("Couldn't map dbc pack " + path.string());
+      }
+      bytes_ = { static_cast<const std::byte*>(view), static_cast<std::size_t>(info.st_size) };
+#endif
+    }
+    Mapped_file(Mapped_file const&) = delete;
+    Mapped_file& operator=(Mapped_file const&) = delete;
+
+    ~Mapped_file() {
+#ifdef _WIN32
+      UnmapViewOfFile(bytes_.data());
+      CloseHandle(mapping_);
+      CloseHandle(file_);
+#else
+      munmap(const_cast<std::byte*>(bytes_.data()), bytes_.size());
+#endif
+    }
+
+    std::span<const std::byte> bytes() const noexcept {
+      return bytes_;
+    }
+  private:
+    std::span<const std::byte> bytes_;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+  };
+
+  struct Loaded {
+    std::unique_ptr<Mapped_file> file;
+    pack::Header header;
+    std::array<std::optional<pack::Mapped_section>, pack::SECTION_COUNT> sections;
+  };
+
+  std::unique_ptr<Loaded> loaded_pack;
+
+  //the size records of a section we know have to be, 0 for sections we don't know
+  std::uint32_t expected_record_size(pack::Section section) noexcept {
+    switch (section) {
+    case pack::Section::spell_attributes:
+      return sizeof(std::uint32_t);
+    case pack::Section::rand_prop_points:
+      return sizeof(pack::Rand_prop_point_record);
+    case pack::Section::combat_ratings_mult_by_ilvl:
+      return sizeof(pack::Combat_ratings_record);
+    case pack::Section::item_sparse:
+      return sizeof(pack::Item_sparse_record);
+    default:
+      return 0;
+    }
+  }
+
+  [[noreturn]] void invalid(std::filesystem::path const& path, std::string_view why) {
+    throw std::runtime_error("Invalid dbc pack " + path.string() + ": " + std::string{ why });
+  }
+}
+
+void pack::load(std::filesystem::path const& path) {
+  auto loading = std::make_unique<Loaded>();
+  loading->file = std::make_unique<Mapped_file>(path);
+  const auto bytes = loading->file->bytes();
+
+  if (bytes.size() < sizeof(Header)) {
+    invalid(path, "too small");
+  }
+  std::memcpy(&loading->header, bytes.data(), sizeof(Header));
+  if (loading->header.magic != MAGIC) {
+    invalid(path, "not a dbc pack");
+  }
+  if (loading->header.version != VERSION) {
+    invalid(path, "made for a different version of Prescience Helper");
+  }
+  if (loading->header.section_count > (bytes.size() - sizeof(Header)) / sizeof(Section_entry)) {
+    invalid(path, "section table doesn't fit");
+  }
+
+  for (std::uint32_t i = 0; i < loading->header.section_count; ++i) {
+    Section_entry entry;
+    std::memcpy(&entry, bytes.data() + sizeof(Header) + i * sizeof(Section_entry), sizeof(Section_entry));
+
+    const auto expected_size = expected_record_size(entry.id);
+    if (expected_size == 0) {
+      //from a newer tool, nothing here reads it
+      continue;
+    }
+    if (entry.record_size != expected_size) {
+      invalid(path, "a section's records aren't the size we expect");
+    }
+    if (entry.offset % ALIGNMENT != 0
+      || entry.offset > bytes.size()
+      || entry.count > (bytes.size() - entry.offset) / entry.record_size) {
+      invalid(path, "a section doesn't fit");
+    }
+    loading->sections[static_cast<std::size_t>(entry.id)] = Mapped_section{ bytes.data() + entry.offset, entry.count };
+  }
+
+  loaded_pack = std::move(loading);
+}
+
+bool pack::loaded() noexcept {
+  return loaded_pack != nullptr;
+}
+
+pack::Mapped_section const* pack::mapped(Section section) noexcept {
+  if (loaded_pack == nullptr) {
+    return nullptr;
+  }
+  auto const& found = loaded_pack->sections[static_cast<std::size_t>(section)];
+  return found ? &*found : nullptr;
+}
+
+std::optional<dbc::Item_sparse> dbc::find_item_sparse(std::uint64_t id) noexcept {
+  if (const auto found_section = pack::mapped(pack::Section::item_sparse)) {
+    const std::span<const pack::Item_sparse_record> items{
+      reinterpret_cast<const pack::Item_sparse_record*>(found_section->data),
+      static_cast<std::size_t>(found_section->count) };
+    const auto found = std::lower_bound(items.begin(), items.end(), id, [](pack::Item_sparse_record const& item, std::uint64_t id) {
+      return item.id < id;
+      });
+    if (found == items.end() || found->id != id) {
+      return std::nullopt;
+    }
+    auto const& types = found->stat_types;
+    auto const& amounts = found->stat_amounts;
+    return Item_sparse{ found->id,
+      types[0], amounts[0], types[1], amounts[1],
+      types[2], amounts[2], types[3], amounts[3],
+      types[4], amounts[4], types[5], amounts[5],
+      types[6], amounts[6], types[7], amounts[7],
+      types[8], amounts[8], types[9], amounts[9],
+      found->slot };
+  }
+
+  const auto found = ITEM_SPARSE.find(id);
+  if (found == ITEM_SPARSE.end()) {
+    return std::nullopt;
+  }
+  return found->second;
+}
+
+clogparser::events::Combat_log_version::Build_version prescience_helper::sim::simulating_for() noexcept {
+  if (loaded_pack == nullptr) {
+    return valid_for;
+  }
+  auto const& header = loaded_pack->header;
+  if (header.expac == 0 && header.patch == 0 && header.minor == 0) {
+    return valid_for;
+  }
+  return { header.expac, header.patch, header.minor };
+}
@@ -1,1308 +1,1323 @@
 #include <prescience_helper/sim/dbc/rand_prop_points.hpp>
+#include <prescience_helper/sim/dbc/pack.hpp>
+#include <array>
+#include <span>
 namespace dbc = prescience_helper::sim::dbc;
+namespace pack = prescience_helper::sim::dbc::pack;
 
-const std::unordered_map<std::uint32_t, dbc::Rand_prop_point> dbc::RAND_PROP_POINT = []() {
-  std::unordered_map<std::uint32_t, dbc::Rand_prop_point> returning;
-  returning.emplace(1, Rand_prop_point{ 1, 0, 0, { 0, 0, 0, 0, 0 } });
-  returning.emplace(4, Rand_prop_point{ 4, 0.08483823389, 0.08483823389, { 1.4543697834, 1.09077727795, 0.81808298826, 0.7271848917, 0.7271848917 } });
-  returning.emplace(5, Rand_prop_point{ 5, 0.10496228933, 0.10496228933, { 1.73730683327, 1.30298006535, 0.97723507881, 0.86865341663, 0.86865341663 } });
-  returning.emplace(6, Rand_prop_point{ 6, 0.12607884407, 0.12607884407, { 2.01726150513, 1.51294600964, 1.13470947742, 1.00863075256, 1.00863075256 } });
-  returning.emplace(7, Rand_prop_point{ 7, 0.14995892346, 0.14995892346, { 2.32194471359, 1.74145841599, 1.30609381199, 1.1609723568, 1.1609723568 } });
-  returning.emplace(8, Rand_prop_point{ 8, 0.15589654446, 0.15589654446, { 2.41388201714, 1.81041145325, 1.35780858994, 1.20694100857, 1.20694100857 } });
-  returning.emplace(9, Rand_prop_point{ 9, 0.18081028759, 0.18081028759, { 2.71215415001, 2.03411579132, 1.52558672428, 1.356077075, 1.356077075 } });
-  returning.emplace(10, Rand_prop_point{ 10, 0.18512012064, 0.18512012064, { 2.77680182457, 2.08260130882, 1.56195104122, 1.38840091228, 1.38840091228 } });
-  returning.emplace(11, Rand_prop_point{ 11, 0.21277911961, 0.21277911961, { 3.09496903419, 2.32122659683, 1.74092006683, 1.5474845171, 1.5474845171 } });
-  returning.emplace(12, Rand_prop_point{ 12, 0.21756544709, 0.21756544709, { 3.16458845139, 2.37344121933, 1.78008103371, 1.58229422569, 1.58229422569 } });
-  returning.emplace(13, Rand_prop_point{ 13, 0.24557211995, 0.24557211995, { 3.46690058708, 2.60017538071, 1.95013165474, 1.73345029354, 1.73345029354 } });
-  returning.emplace(14, Rand_prop_point{ 14, 0.25080174208, 0.25080174208, { 3.5407307148, 2.6555480957, 1.99166095257, 1.7703653574, 1.7703653574 } });
-  returning.emplace(15, Rand_prop_point{ 15, 0.25614273548, 0.25614273548, { 3.61613297462, 2.71209979057, 2.03407478333, 1.80806648731, 1.80806648731 } });
-  returning.emplace(16, Rand_prop_point{ 16, 0.29836267233, 0.29836267233, { 3.89698195457, 2.92273640633, 2.19205236435, 1.94849097729, 1.94849097729 } });
-  returning.emplace(17, Rand_prop_point{ 17, 0.30143922567, 0.30143922567, { 3.93716549873, 2.95287418365, 2.21465563774, 1.96858274937, 1.96858274937 } });
-  returning.emplace(18, Rand_prop_point{ 18, 0.3075338304, 0.3075338304, { 4.01676845551, 3.01257634163, 2.25943231583, 2.00838422775, 2.00838422775 } });
-  returning.emplace(19, Rand_prop_point{ 19, 0.3105494678, 0.3105494678, { 4.05615615845, 3.04211711884, 2.28158783913, 2.02807807922, 2.02807807922 } });
-  returning.emplace(20, Rand_prop_point{ 20, 0.35903385282, 0.35903385282, { 4.35192584991, 3.26394414902, 2.44795823097, 2.17596292496, 2.17596292496 } });
-  returning.emplace(21, Rand_prop_point{ 21, 0.36594343185, 0.36594343185, { 4.43567800522, 3.3267583847, 2.49506878853, 2.21783900261, 2.21783900261 } });
-  returning.emplace(22, Rand_prop_point{ 22, 0.37298595905, 0.37298595905, { 4.52104187012, 3.39078140259, 2.54308605194, 2.26052093506, 2.26052093506 } });
-  returning.emplace(23, Rand_prop_point{ 23, 0.42831286788, 0.42831286788, { 4.83173179626, 3.62379860878, 2.71784901619, 2.41586589813, 2.41586589813 } });
-  returning.emplace(24, Rand_prop_point{ 24, 0.43617707491, 0.43617707491, { 4.92044639587, 3.69033479691, 2.76775121689, 2.46022319794, 2.46022319794 } });
-  returning.emplace(25, Rand_prop_point{ 25, 0.44418567419, 0.44418567419, { 5.01079034805, 3.75809264183, 2.81856942177, 2.50539517403, 2.50539517403 } });
-  returning.emplace(26, Rand_prop_point{ 26, 0.51129156351, 0.51129156351, { 5.38201665878, 4.03651237488, 3.02738428116, 2.69100832939, 2.69100832939 } });
-  returning.emplace(27, Rand_prop_point{ 27, 0.52026706934, 0.52026706934, { 5.4764957428, 4.1073718071, 3.08052873611, 2.7382478714, 2.7382478714 } });
-  returning.emplace(28, Rand_prop_point{ 28, 0.59575849771, 0.59575849771, { 5.86592960358, 4.39944696426, 3.29958534241, 2.93296480179, 2.93296480179 } });
-  returning.emplace(29, Rand_prop_point{ 29, 0.60577684641, 0.60577684641, { 5.96457195282, 4.4734287262, 3.35507178307, 2.98228597641, 2.98228597641 } });
-  returning.emplace(30, Rand_prop_point{ 30, 0.61210107803, 0.61210107803, { 6.02684164047, 4.52013111115, 3.39009833336, 3.01342082024, 3.01342082024 } });
-  returning.emplace(31, Rand_prop_point{ 31, 0.69843620062, 0.69843620062, { 6.44710302353, 4.83532714844, 3.62649559975, 3.22355151176, 3.22355151176 } });
-  returning.emplace(32, Rand_prop_point{ 32, 0.70869153738, 0.70869153738, { 6.54176807404, 4.90632629395, 3.67974472046, 3.27088403702, 3.27088403702 } });
-  returning.emplace(33, Rand_prop_point{ 33, 0.71909755468, 0.71909755468, { 6.6378235817, 4.97836780548, 3.73377561569, 3.31891179085, 3.31891179085 } });
-  returning.emplace(34, Rand_prop_point{ 34, 0.8131890893, 0.8131890893, { 7.05204629898, 5.28903484344, 3.96677613258, 3.52602314949, 3.52602314949 } });
-  returning.emplace(35, Rand_prop_point{ 35, 0.82466506958, 0.82466506958, { 7.15156745911, 5.36367559433, 4.02275657654, 3.57578372955, 3.57578372955 } });
-  returning.emplace(36, Rand_prop_point{ 36, 0.93178129196, 0.93178129196, { 7.60637807846, 5.70478343964, 4.27858781815, 3.80318903923, 3.80318903923 } });
-  returning.emplace(37, Rand_prop_point{ 37, 0.94443875551, 0.94443875551, { 7.70970439911, 5.78227806091, 4.33670854568, 3.85485219955, 3.85485219955 } });
-  returning.emplace(38, Rand_prop_point{ 38, 0.95726817846, 0.95726817846, { 7.81443405151, 5.86082553864, 4.3956193924, 3.90721702576, 3.90721702576 } });
-  returning.emplace(39, Rand_prop_point{ 39, 1.07747268677, 1.07747268677, { 8.29489803314, 6.22117376328, 4.66588020325, 4.14744901657, 4.14744901657 } });
-  returning.emplace(40, Rand_prop_point{ 40, 1.09216415882, 1.09216415882, { 8.40799999237, 6.3060002327, 4.72950029373, 4.20399999619, 4.20399999619 } });
-  returning.emplace(41, Rand_prop_point{ 41, 1.22517442703, 1.22517442703, { 8.91035938263, 6.68276977539, 5.01207733154, 4.45517969131, 4.45517969131 } });
-  returning.emplace(42, Rand_prop_point{ 42, 1.24217176437, 1.24217176437, { 9.03397655487, 6.77548217773, 5.0816116333, 4.51698827744, 4.51698827744 } });
-  returning.emplace(43, Rand_prop_point{ 43, 1.25940489769, 1.25940489769, { 9.15930843353, 6.86948108673, 5.15211105347, 4.57965421677, 4.57965421677 } });
-  returning.emplace(44, Rand_prop_point{ 44, 1.35445094109, 1.35445094109, { 9.32095241547, 6.99071455002, 5.2430357933, 4.66047620773, 4.66047620773 } });
-  returning.emplace(45, Rand_prop_point{ 45, 1.41621863842, 1.41621863842, { 9.74602127075, 7.30951547623, 5.48213672638, 4.87301063538, 4.87301063538 } });
-  returning.emplace(46, Rand_prop_point{ 46, 1.56253921986, 1.56253921986, { 10.19047355652, 7.64285516739, 5.73214149475, 5.09523677826, 5.09523677826 } });
-  returning.emplace(47, Rand_prop_point{ 47, 1.63473820686, 1.63473820686, { 10.66133594513, 7.99600219727, 5.99700164795, 5.33066797256, 5.33066797256 } });
-  returning.emplace(48, Rand_prop_point{ 48, 1.71027326584, 1.71027326584, { 11.15395545959, 8.36546707153, 6.27410030365, 5.5769777298, 5.5769777298 } });
-  returning.emplace(49, Rand_prop_point{ 49, 1.89253640175, 1.89253640175, { 11.71395874023, 8.78546905518, 6.58910131454, 5.85697937012, 5.85697937012 } });
-  returning.emplace(50, Rand_prop_point{ 50, 1.98038065434, 1.98038065434, { 12.2576751709, 9.19325637817, 6.89494228363, 6.12883758545, 6.12883758545 } });
-  returning.emplace(51, Rand_prop_point{ 51, 2.07230234146, 2.07230234146, { 12.82662963867, 9.619972229, 7.21497917175, 6.41331481934, 6.41331481934 } });
-  returning.emplace(52, Rand_prop_point{ 52, 2.28219652176, 2.28219652176, { 13.42468643188, 10.06851482391, 7.55138587952, 6.71234321594, 6.71234321594 } });
-  returning.emplace(53, Rand_prop_point{ 53, 2.38860654831, 2.38860654831, { 14.05062675476, 10.53797054291, 7.90347766876, 7.02531337738, 7.02531337738 } });
-  returning.emplace(54, Rand_prop_point{ 54, 2.62712144852, 2.62712144852, { 14.70575332642, 11.02931499481, 8.27198600769, 7.35287666321, 7.35287666321 } });
-  returning.emplace(55, Rand_prop_point{ 55, 2.75016546249, 2.75016546249, { 15.39451217651, 11.54588413239, 8.65941238403, 7.69725608826, 7.69725608826 } });
-  returning.emplace(56, Rand_prop_point{ 56, 2.79275107384, 2.79275107384, { 15.63289165497, 11.72466945648, 8.79350185394, 7.81644582748, 7.81644582748 } });
-  returning.emplace(57, Rand_prop_point{ 57, 2.97655582428, 2.97655582428, { 15.87496376038, 11.90622329712, 8.92966747284, 7.93748188019, 7.93748188019 } });
-  returning.emplace(58, Rand_prop_point{ 58, 3.0232527256, 3.0232527256, { 16.12401390076, 12.0930109024, 9.06975841522, 8.06200695038, 8.06200695038 } });
-  returning.emplace(59, Rand_prop_point{ 59, 3.07068228722, 3.07068228722, { 16.37697219849, 12.28272914886, 9.21204662323, 8.18848609924, 8.18848609924 } });
-  returning.emplace(60, Rand_prop_point{ 60, 3.25714612007, 3.25714612007, { 16.57053756714, 12.42790222168, 9.32092666626, 8.28526878357, 8.28526878357 } });
-  returning.emplace(61, Rand_prop_point{ 61, 3.30890774727, 3.30890774727, { 16.83387184143, 12.62540340424, 9.46905231476, 8.41693592072, 8.41693592072 } });
-  returning.emplace(62, Rand_prop_point{ 62, 3.36149191856, 3.36149191856, { 17.10139083862, 12.82604217529, 9.61953163147, 8.55069541931, 8.55069541931 } });
-  returning.emplace(63, Rand_prop_point{ 63, 3.5621752739, 3.5621752739, { 17.30611419678, 12.97958660126, 9.73468971252, 8.65305709839, 8.65305709839 } });
-  returning.emplace(64, Rand_prop_point{ 64, 3.61950874329, 3.61950874329, { 17.58465766907, 13.18849372864, 9.89136981964, 8.79232883453, 8.79232883453 } });
-  returning.emplace(65, Rand_prop_point{ 65, 3.677765131, 3.677765131, { 17.86768531799, 13.40076446533, 10.05057239532, 8.933842659, 8.933842659 } });
-  returning.emplace(66, Rand_prop_point{ 66, 3.89377522469, 3.89377522469, { 18.08429718018, 13.56322288513, 10.17241668701, 9.04214859009, 9.04214859009 } });
-  returning.emplace(67, Rand_prop_point{ 67, 3.95723748207, 3.95723748207, { 18.37904167175, 13.78428173065, 10.33821105957, 9.18952083588, 9.18952083588 } });
-  returning.emplace(68, Rand_prop_point{ 68, 4.02173376083, 4.02173376083, { 18.67859077454, 14.00894260406, 10.50670719147, 9.33929538727, 9.33929538727 } });
-  returning.emplace(69, Rand_prop_point{ 69, 4.25427055359, 4.25427055359, { 18.90786933899, 14.1809015274, 10.63567638397, 9.45393466949, 9.45393466949 } });
-  returning.emplace(70, Rand_prop_point{ 70, 4.32447290421, 4.32447290421, { 19.21987915039, 14.41490936279, 10.81118202209, 9.6099395752, 9.6099395752 } });
-  returning.emplace(71, Rand_prop_point{ 71, 4.39583349228, 4.39583349228, { 19.53703689575, 14.65277862549, 10.98958396912, 9.76851844788, 9.76851844788 } });
-  returning.emplace(72, Rand_prop_point{ 72, 4.53699588776, 4.53699588776, { 19.77981948853, 14.83486461639, 11.12614822388, 9.88990974426, 9.88990974426 } });
-  returning.emplace(73, Rand_prop_point{ 73, 4.61278533936, 4.61278533936, { 20.11023712158, 15.08267688751, 11.31200790405, 10.05511856079, 10.05511856079 } });
-  returning.emplace(74, Rand_prop_point{ 74, 4.68984079361, 4.68984079361, { 20.44617271423, 15.33462905884, 11.50097179413, 10.22308635712, 10.22308635712 } });
-  returning.emplace(75, Rand_prop_point{ 75, 4.83940887451, 4.83940887451, { 20.70335388184, 15.52751541138, 11.64563655853, 10.35167694092, 10.35167694092 } });
-  returning.emplace(76, Rand_prop_point{ 76, 4.92123270035, 4.92123270035, { 21.05340194702, 15.79005146027, 11.84253883362, 10.52670097351, 10.52670097351 } });
-  returning.emplace(77, Rand_prop_point{ 77, 5.00444030762, 5.00444030762, { 21.40936851501, 16.05702781677, 12.04277038574, 10.70468425751, 10.70468425751 } });
-  returning.emplace(78, Rand_prop_point{ 78, 5.16300535202, 5.16300535202, { 21.68191337585, 16.26143455505, 12.19607543945, 10.84095668793, 10.84095668793 } });
-  returning.emplace(79, Rand_prop_point{ 79, 5.25134897232, 5.25134897232, { 22.05290794373, 16.53968048096, 12.40476131439, 11.02645397186, 11.02645397186 } });
-  returning.emplace(80, Rand_prop_point{ 80, 5.34120368958, 5.34120368958, { 22.4302520752, 16.8226890564, 12.6170167923, 11.2151260376, 11.2151260376 } });
-  returning.emplace(81, Rand_prop_point{ 81, 5.5094037056, 5.5094037056, { 22.71919059753, 17.03939247131, 12.77954483032, 11.35959529877, 11.35959529877 } });
-  returning.emplace(82, Rand_prop_point{ 82, 5.60479259491, 5.60479259491, { 23.11254692078, 17.33440971375, 13.00080680847, 11.55627346039, 11.55627346039 } });
-  returning.emplace(83, Rand_prop_point{ 83, 5.70183229446, 5.70183229446, { 23.51271057129, 17.63453292847, 13.22590065002, 11.75635528564, 11.75635528564 } });
-  returning.emplace(84, Rand_prop_point{ 84, 5.88035440445, 5.88035440445, { 23.81915664673, 17.86436843872, 13.39827632904, 11.90957832336, 11.90957832336 } });
-  returning.emplace(85, Rand_prop_point{ 85, 5.98335838318, 5.98335838318, { 24.23638916016, 18.17729187012, 13.63296890259, 12.11819458008, 12.11819458008 } });
-  returning.emplace(86, Rand_prop_point{ 86, 6.08816671371, 6.08816671371, { 24.6609287262, 18.49569702148, 13.87177276611, 12.3304643631, 12.3304643631 } });
-  returning.emplace(87, Rand_prop_point{ 87, 6.27775144577, 6.27775144577, { 24.98607444763, 18.73955726624, 14.05466747284, 12.49303722382, 12.49303722382 } });
-  returning.emplace(88, Rand_prop_point{ 88, 6.36052131653, 6.36052131653, { 25.31550788879, 18.98663139343, 14.23997306824, 12.6577539444, 12.6577539444 } });
-  returning.emplace(89, Rand_prop_point{ 89, 6.47322654724, 6.47322654724, { 25.76408576965, 19.32306289673, 14.49229812622, 12.88204288483, 12.88204288483 } });
-  returning.emplace(90, Rand_prop_point{ 90, 6.67377471924, 6.67377471924, { 26.10767745972, 19.58075714111, 14.68556785584, 13.05383872986, 13.05383872986 } });
-  returning.emplace(91, Rand_prop_point{ 91, 6.76277685165, 6.76277685165, { 26.4558506012, 19.84188842773, 14.8814163208, 13.2279253006, 13.2279253006 } });
-  returning.emplace(92, Rand_prop_point{ 92, 6.8839802742, 6.8839802742, { 26.92999649048, 20.19749832153, 15.14812278748, 13.46499824524, 13.46499824524 } });
-  returning.emplace(93, Rand_prop_point{ 93, 6.97682762146, 6.97682762146, { 27.29321289063, 20.46990966797, 15.35243225098, 13.64660644531, 13.64660644531 } });
-  returning.emplace(94, Rand_prop_point{ 94, 7.19194507599, 7.19194507599, { 27.66132736206, 20.74599647522, 15.55949687958, 13.83066368103, 13.83066368103 } });
-  returning.emplace(95, Rand_prop_point{ 95, 7.32229804993, 7.32229804993, { 28.16268539429, 21.12201309204, 15.84150981903, 14.08134269714, 14.08134269714 } });
-  returning.emplace(96, Rand_prop_point{ 96, 7.42216444016, 7.42216444016, { 28.54678726196, 21.4100894928, 16.05756759644, 14.27339363098, 14.27339363098 } });
-  returning.emplace(97, Rand_prop_point{ 97, 7.64998912811, 7.64998912811, { 28.93612861633, 21.70209693909, 16.27657318115, 14.46806430817, 14.46806430817 } });
-  returning.emplace(98, Rand_prop_point{ 98, 7.75432491302, 7.75432491302, { 29.3307800293, 21.99808502197, 16.49856376648, 14.66539001465, 14.66539001465 } });
-  returning.emplace(99, Rand_prop_point{ 99, 7.89644145966, 7.89644145966, { 29.86833763123, 22.40125274658, 16.80093955994, 14.93416881561, 14.93416881561 } });
-  returning.emplace(100, Rand_prop_point{ 100, 8.13780879974, 8.13780879974, { 30.28021812439, 22.7101650238, 17.03262329102, 15.14010906219, 15.14010906219 } });
-  returning.emplace(101, Rand_prop_point{ 101, 8.25002861023, 8.25002861023, { 30.69778060913, 23.02333641052, 17.26750183105, 15.34889030457, 15.34889030457 } });
-  returning.emplace(102, Rand_prop_point{ 102, 8.4029006958, 8.4029006958, { 31.26660919189, 23.44995689392, 17.5874671936, 15.63330459595, 15.63330459595 } });
-  returning.emplace(103, Rand_prop_point{ 103, 8.52004623413, 8.52004623413, { 31.70249938965, 23.77687454224, 17.832654953, 15.85124969482, 15.85124969482 } });
-  returning.emplace(104, Rand_prop_point{ 104, 8.77945709229, 8.77945709229, { 32.14446640015, 24.10835075378, 18.0812625885, 16.07223320007, 16.07223320007 } });
-  returning.emplace(105, Rand_prop_point{ 105, 8.94391727448, 8.94391727448, { 32.74660873413, 24.55995559692, 18.41996765137, 16.37330436707, 16.37330436707 } });
-  returning.emplace(106, Rand_prop_point{ 106, 9.06995677948, 9.06995677948, { 33.20808029175, 24.90605926514, 18.67954444885, 16.60404014587, 16.60404014587 } });
-  returning.emplace(107, Rand_prop_point{ 107, 9.3451051712, 9.3451051712, { 33.6760559082, 25.25704193115, 18.94278144836, 16.8380279541, 16.8380279541 } });
-  returning.emplace(108, Rand_prop_point{ 108, 9.47679805756, 9.47679805756, { 34.15062332153, 25.61296844482, 19.20972633362, 17.07531166077, 17.07531166077 } });
-  returning.emplace(109, Rand_prop_point{ 109, 9.65623950958, 9.65623950958, { 34.79725646973, 26.09794425964, 19.5734577179, 17.39862823486, 17.39862823486 } });
-  returning.emplace(110, Rand_prop_point{ 110, 9.94818115234, 9.94818115234, { 35.29288482666, 26.46966171265, 19.85224723816, 17.64644241333, 17.64644241333 } });
-  returning.emplace(111, Rand_prop_point{ 111, 10.08987617493, 10.08987617493, { 35.79557037354, 26.8466758728, 20.13500785828, 17.89778518677, 17.89778518677 } });
-  returning.emplace(112, Rand_prop_point{ 112, 10.28296661377, 10.28296661377, { 36.48059082031, 27.36044311523, 20.52033233643, 18.24029541016, 18.24029541016 } });
-  returning.emplace(113, Rand_prop_point{ 113, 10.43098163605, 10.43098163605, { 37.00569915771, 27.75427436829, 20.81570625305, 18.50284957886, 18.50284957886 } });
-  returning.emplace(114, Rand_prop_point{ 114, 10.7453584671, 10.7453584671, { 37.5383682251, 28.15377616882, 21.11533164978, 18.76918411255, 18.76918411255 } });
-  returning.emplace(115, Rand_prop_point{ 115, 10.90002918243, 10.90002918243, { 38.07870483398, 28.55902862549, 21.41927146912, 19.03935241699, 19.03935241699 } });
-  returning.emplace(116, Rand_prop_point{ 116, 11.05857181549, 11.05857181549, { 38.63256454468, 28.97442245483, 21.7308177948, 19.31628227234, 19.31628227234 } });
-  returning.emplace(117, Rand_prop_point{ 117, 11.39089584351, 11.39089584351, { 39.194480896, 29.395860672, 22.04689598084, 19.597240448, 19.597240448 } });
-  returning.emplace(118, Rand_prop_point{ 118, 11.55657863617, 11.55657863617, { 39.76457214355, 29.82342720032, 22.36757087708, 19.88228607178, 19.88228607178 } });
-  returning.emplace(119, Rand_prop_point{ 119, 11.78241062164, 11.78241062164, { 40.54162597656, 30.40621948242, 22.80466461182, 20.27081298828, 20.27081298828 } });
-  returning.emplace(120, Rand_prop_point{ 120, 11.95556354523, 11.95556354523, { 41.13742828369, 30.85307121277, 23.13980293274, 20.56871414185, 20.56871414185 } });
-  returning.emplace(121, Rand_prop_point{ 121, 12.31388568878, 12.31388568878, { 41.74198532104, 31.30648803711, 23.47986602783, 20.87099266052, 20.87099266052 } });
-  returning.emplace(122, Rand_prop_point{ 122, 12.49485015869, 12.49485015869, { 42.35542297363, 31.76656913757, 23.82492637634, 21.17771148682, 21.17771148682 } });
-  returning.emplace(123, Rand_prop_point{ 123, 12.68035888672, 12.68035888672, { 42.98426818848, 32.23820114136, 24.17864990234, 21.49213409424, 21.49213409424 } });
-  returning.emplace(124, Rand_prop_point{ 124, 13.0594701767, 13.0594701767, { 43.62244796753, 32.71683502197, 24.53762626648, 21.81122398376, 21.81122398376 } });
-  returning.emplace(125, Rand_prop_point{ 125, 13.25336170197, 13.25336170197, { 44.27010345459, 33.20257568359, 24.9019317627, 22.13505172729, 22.13505172729 } });
-  returning.emplace(126, Rand_prop_point{ 126, 13.45013237, 13.45013237, { 44.92737197876, 33.69552993774, 25.27164649963, 22.46368598938, 22.46368598938 } });
-  returning.emplace(127, Rand_prop_point{ 127, 13.65185165405, 13.65185165405, { 45.60117340088, 34.20088195801, 25.65065956116, 22.80058670044, 22.80058670044 } });
-  returning.emplace(128, Rand_prop_point{ 128, 14.05909347534, 14.05909347534, { 46.28507995605, 34.71380996704, 26.03535842896, 23.14253997803, 23.14253997803 } });
-  returning.emplace(129, Rand_prop_point{ 129, 14.26994514465, 14.26994514465, { 46.97924423218, 35.23443222046, 26.42582511902, 23.48962211609, 23.48962211609 } });
-  returning.emplace(130, Rand_prop_point{ 130, 14.48610973358, 14.48610973358, { 47.69089508057, 35.76817321777, 26.82612991333, 23.84544754028, 23.84544754028 } });
-  returning.emplace(131, Rand_prop_point{ 131, 14.70554924011, 14.70554924011, { 48.41333007813, 36.30999755859, 27.23249816895, 24.20666503906, 24.20666503906 } });
-  returning.emplace(132, Rand_prop_point{ 132, 15.14332962036, 15.14332962036, { 49.14670562744, 36.86003112793, 27.64502334595, 24.57335281372, 24.57335281372 } });
-  returning.emplace(133, Rand_prop_point{ 133, 15.37272453308, 15.37272453308, { 49.89119338989, 37.41839599609, 28.06379699707, 24.94559669495, 24.94559669495 } });
-  returning.emplace(134, Rand_prop_point{ 134, 15.60790920258, 15.60790920258, { 50.65447235107, 37.99085617065, 28.49314117432, 25.32723617554, 25.32723617554 } });
-  returning.emplace(135, Rand_prop_point{ 135, 16.07169723511, 16.07169723511, { 51.42942810059, 38.57207107544, 28.92905426025, 25.71471405029, 25.71471405029 } });
-  returning.emplace(136, Rand_prop_point{ 136, 16.31757545471, 16.31757545471, { 52.2162437439, 39.16218185425, 29.37163543701, 26.10812187195, 26.10812187195 } });
-  returning.emplace(137, Rand_prop_point{ 137, 16.56721687317, 16.56721687317, { 53.01509094238, 39.76131820679, 29.82098960876, 26.50754547119, 26.50754547119 } });
-  returning.emplace(138, Rand_prop_point{ 138, 16.82316970825, 16.82316970825, { 53.83414459229, 40.37561035156, 30.28170585632, 26.91707229614, 26.91707229614 } });
-  returning.emplace(139, Rand_prop_point{ 139, 17.42473983765, 17.42473983765, { 54.66585159302, 40.99938964844, 30.74954223633, 27.33292579651, 27.33292579651 } });
-  returning.emplace(140, Rand_prop_point{ 140, 17.69394302368, 17.69394302368, { 55.51041030884, 41.6328086853, 31.2246055603, 27.75520515442, 27.75520515442 } });
-  returning.emplace(141, Rand_prop_point{ 141, 17.87660217285, 17.87660217285, { 56.08345413208, 42.06259155273, 31.54694366455, 28.04172706604, 28.04172706604 } });
-  returning.emplace(142, Rand_prop_point{ 142, 18.15547561646, 18.15547561646, { 56.95835494995, 42.71876525879, 32.03907394409, 28.47917747498, 28.47917747498 } });
-  returning.emplace(143, Rand_prop_point{ 143, 18.80024337769, 18.80024337769, { 57.84690093994, 43.3851776123, 32.53888320923, 28.92345046997, 28.92345046997 } });
-  returning.emplace(144, Rand_prop_point{ 144, 19.09352493286, 19.09352493286, { 58.74930953979, 44.06198120117, 33.04648590088, 29.3746547699, 29.3746547699 } });
-  returning.emplace(145, Rand_prop_point{ 145, 19.3942565918, 19.3942565918, { 59.67463684082, 44.75597763062, 33.56698226929, 29.83731842041, 29.83731842041 } });
-  returning.emplace(146, Rand_prop_point{ 146, 19.69972419739, 19.69972419739, { 60.6145324707, 45.46089935303, 34.09567642212, 30.30726623535, 30.30726623535 } });
-  returning.emplace(147, Rand_prop_point{ 147, 20.3948097229, 20.3948097229, { 61.56923675537, 46.17692947388, 34.63269424438, 30.78461837769, 30.78461837769 } });
-  returning.emplace(148, Rand_prop_point{ 148, 20.7160358429, 20.7160358429, { 62.53897857666, 46.90423202515, 35.17817306519, 31.26948928833, 31.26948928833 } });
-  returning.emplace(149, Rand_prop_point{ 149, 21.04543685913, 21.04543685913, { 63.53339385986, 47.65004730225, 35.73753356934, 31.76669692993, 31.76669692993 } });
-  returning.emplace(150, Rand_prop_point{ 150, 21.78347396851, 21.78347396851, { 64.54362487793, 48.40771865845, 36.30578994751, 32.27181243896, 32.27181243896 } });
-  returning.emplace(151, Rand_prop_point{ 151, 22.12984848022, 22.12984848022, { 65.56992340088, 49.17744064331, 36.88307952881, 32.78496170044, 32.78496170044 } });
-  returning.emplace(152, Rand_prop_point{ 152, 22.48172950745, 22.48172950745, { 66.61253356934, 49.959400177, 37.46955108643, 33.30626678467, 33.30626678467 } });
-  returning.emplace(153, Rand_prop_point{ 153, 22.84258651733, 22.84258651733, { 67.68173980713, 50.761302948, 38.07097625732, 33.84086990356, 33.84086990356 } });
-  returning.emplace(154, Rand_prop_point{ 154, 23.63903617859, 23.63903617859, { 68.76810455322, 51.57608032227, 38.6820602417, 34.38405227661, 34.38405227661 } });
-  returning.emplace(155, Rand_prop_point{ 155, 24.01846885681, 24.01846885681, { 69.87191009521, 52.40393066406, 39.30294799805, 34.93595504761, 34.93595504761 } });
-  returning.emplace(156, Rand_prop_point{ 156, 24.27599906921, 24.27599906921, { 70.62108612061, 52.9658164978, 39.72436141968, 35.3105430603, 35.3105430603 } });
-  returning.emplace(157, Rand_prop_point{ 157, 24.66930389404, 24.66930389404, { 71.76524353027, 53.8239364624, 40.36795043945, 35.88262176514, 35.88262176514 } });
-  returning.emplace(158, Rand_prop_point{ 158, 25.52478027344, 25.52478027344, { 72.92794036865, 54.69595718384, 41.02196884155, 36.46397018433, 36.46397018433 } });
-  returning.emplace(159, Rand_prop_point{ 159, 25.93831634521, 25.93831634521, { 74.10947418213, 55.58210754395, 41.68658065796, 37.05473709106, 37.05473709106 } });
-  returning.emplace(160, Rand_prop_point{ 160, 26.21901512146, 26.21901512146, { 74.91146850586, 56.18360519409, 42.13770294189, 37.45573425293, 37.45573425293 } });
-  returning.emplace(161, Rand_prop_point{ 161, 26.64773750305, 26.64773750305, { 76.13639068604, 57.10229492188, 42.82672119141, 38.06819534302, 38.06819534302 } });
-  returning.emplace(162, Rand_prop_point{ 162, 27.5671043396, 27.5671043396, { 77.38134765625, 58.03600692749, 43.52700805664, 38.69067382813, 38.69067382813 } });
-  returning.emplace(163, Rand_prop_point{ 163, 28.01786994934, 28.01786994934, { 78.64665222168, 58.98498916626, 44.23874282837, 39.32332611084, 39.32332611084 } });
-  returning.emplace(164, Rand_prop_point{ 164, 28.32386398315, 28.32386398315, { 79.5055770874, 59.6291847229, 44.72188949585, 39.7527885437, 39.7527885437 } });
-  returning.emplace(165, Rand_prop_point{ 165, 28.79125595093, 28.79125595093, { 80.81755828857, 60.61317062378, 45.45987701416, 40.40877914429, 40.40877914429 } });
-  returning.emplace(166, Rand_prop_point{ 166, 29.77980613709, 29.77980613709, { 82.15119171143, 61.61339187622, 46.21004486084, 41.07559585571, 41.07559585571 } });
-  returning.emplace(167, Rand_prop_point{ 167, 30.27122497559, 30.27122497559, { 83.50682830811, 62.63012313843, 46.97259140015, 41.75341415405, 41.75341415405 } });
-  returning.emplace(168, Rand_prop_point{ 168, 30.6048412323, 30.6048412323, { 84.42714691162, 63.32036209106, 47.49027252197, 42.21357345581, 42.21357345581 } });
-  returning.emplace(169, Rand_prop_point{ 169, 32.18738174438, 32.18738174438, { 85.83301544189, 64.37476348877, 48.28107070923, 42.91650772095, 42.91650772095 } });
-  returning.emplace(170, Rand_prop_point{ 170, 32.75109100342, 32.75109100342, { 87.33623504639, 65.50218200684, 49.12663269043, 43.66811752319, 43.66811752319 } });
-  returning.emplace(171, Rand_prop_point{ 171, 33.35290908813, 33.35290908813, { 88.94109344482, 66.70581817627, 50.02936553955, 44.47054672241, 44.47054672241 } });
-  returning.emplace(172, Rand_prop_point{ 172, 33.80961227417, 33.80961227417, { 90.15896606445, 67.61922454834, 50.7144203186, 45.07948303223, 45.07948303223 } });
-  returning.emplace(173, Rand_prop_point{ 173, 34.301612854, 34.301612854, { 91.47096252441, 68.60322570801, 51.45241928101, 45.73548126221, 45.73548126221 } });
-  returning.emplace(174, Rand_prop_point{ 174, 35.5541305542, 35.5541305542, { 94.81101226807, 71.1082611084, 53.3311958313, 47.40550613403, 47.40550613403 } });
-  returning.emplace(175, Rand_prop_point{ 175, 35.92337417603, 36.28045272827, { 95.69853973389, 71.77390289307, 53.83042907715, 47.84926986694, 47.84926986694 } });
-  returning.emplace(176, Rand_prop_point{ 176, 36.29641723633, 37.01726150513, { 96.59437561035, 72.44578552246, 54.33433532715, 48.29718780518, 48.29718780518 } });
-  returning.emplace(177, Rand_prop_point{ 177, 36.67329406738, 37.76468276978, { 97.49859619141, 73.12394714355, 54.84296035767, 48.7492980957, 48.7492980957 } });
-  returning.emplace(178, Rand_prop_point{ 178, 37.05405044556, 38.52285385132, { 98.411277771, 73.80846405029, 55.35634613037, 49.2056388855, 49.2056388855 } });
-  returning.emplace(179, Rand_prop_point{ 179, 37.43871688843, 39.29190826416, { 99.33251190186, 74.49938201904, 55.87453842163, 49.66625595093, 49.66625595093 } });
-  returning.emplace(180, Rand_prop_point{ 180, 37.82733917236, 40.0719871521, { 100.26235961914, 75.19676971436, 56.39757919312, 50.13117980957, 50.13117980957 } });
-  returning.emplace(181, Rand_prop_point{ 181, 38.21995925903, 40.86322784424, { 101.20092010498, 75.90068817139, 56.92551803589, 50.60046005249, 50.60046005249 } });
-  returning.emplace(182, Rand_prop_point{ 182, 38.61661148071, 41.66577148438, { 102.14826202393, 76.61119842529, 57.45839691162, 51.07413101196, 51.07413101196 } });
-  returning.emplace(183, Rand_prop_point{ 183, 39.01734161377, 42.47975921631, { 103.10446929932, 77.32835388184, 57.99626541138, 51.55223464966, 51.55223464966 } });
-  returning.emplace(184, Rand_prop_point{ 184, 39.42219161987, 43.30533218384, { 104.06963348389, 78.05222320557, 58.53916931152, 52.03481674194, 52.03481674194 } });
-  returning.emplace(185, Rand_prop_point{ 185, 39.83120346069, 44.14264297485, { 105.04383087158, 78.78287506104, 59.08715438843, 52.52191543579, 52.52191543579 } });
-  returning.emplace(186, Rand_prop_point{ 186, 40.2444152832, 44.99183273315, { 106.02715301514, 79.520362854, 59.64027023315, 53.01357269287, 53.01357269287 } });
-  returning.emplace(187, Rand_prop_point{ 187, 40.66187667847, 45.85305404663, { 107.0196685791, 80.26474761963, 60.19856262207, 53.50983428955, 53.50983428955 } });
-  returning.emplace(188, Rand_prop_point{ 188, 41.08362197876, 46.72645568848, { 108.02147674561, 81.01610565186, 60.76208114624, 54.0107383728, 54.0107383728 } });
-  returning.emplace(189, Rand_prop_point{ 189, 41.50970458984, 47.61219024658, { 109.03266906738, 81.77449798584, 61.33087539673, 54.51633453369, 54.51633453369 } });
-  returning.emplace(190, Rand_prop_point{ 190, 41.94016265869, 48.51041412354, { 110.05332183838, 82.53999328613, 61.9049949646, 55.02666091919, 55.02666091919 } });
-  returning.emplace(191, Rand_prop_point{ 191, 42.37504196167, 49.42128372192, { 111.08352661133, 83.31265258789, 62.48448562622, 55.54176712036, 55.54176712036 } });
-  returning.emplace(192, Rand_prop_point{ 192, 42.81438827515, 50.34495544434, { 112.12338256836, 84.09253692627, 63.06940460205, 56.06169128418, 56.06169128418 } });
-  returning.emplace(193, Rand_prop_point{ 193, 43.25824737549, 51.28158950806, { 113.17297363281, 84.87973022461, 63.65979766846, 56.58648681641, 56.58648681641 } });
-  returning.emplace(194, Rand_prop_point{ 194, 43.70666122437, 52.23134613037, { 114.23238372803, 85.67429351807, 64.2557144165, 57.11619186401, 57.11619186401 } });
-  returning.emplace(195, Rand_prop_point{ 195, 44.15968322754, 53.19438934326, { 115.30171966553, 86.4762878418, 64.85721588135, 57.65085983276, 57.65085983276 } });
-  returning.emplace(196, Rand_prop_point{ 196, 44.61735534668, 54.17089080811, { 116.38105773926, 87.28578948975, 65.46434783936, 58.19052886963, 58.19052886963 } });
-  returning.emplace(197, Rand_prop_point{ 197, 45.07972717285, 55.16100692749, { 117.47049713135, 88.10287475586, 66.07715606689, 58.73524856567, 58.73524856567 } });
-  returning.emplace(198, Rand_prop_point{ 198, 45.54684829712, 56.16491699219, { 118.57013702393, 88.92760467529, 66.69570159912, 59.28507232666, 59.28507232666 } });
-  returning.emplace(199, Rand_prop_point{ 199, 46.01876068115, 57.18278884888, { 119.68007659912, 89.76005554199, 67.32004547119, 59.84003829956, 59.84003829956 } });
-  returning.emplace(200, Rand_prop_point{ 200, 46.49551773071, 58.21479415894, { 120.80040740967, 90.6003036499, 67.95022583008, 60.40020370483, 60.40020370483 } });
-  returning.emplace(201, Rand_prop_point{ 201, 46.97716903687, 59.26110839844, { 121.9312210083, 91.44841003418, 68.58631134033, 60.96561050415, 60.96561050415 } });
-  returning.emplace(202, Rand_prop_point{ 202, 47.46376037598, 60.32191085815, { 123.07261657715, 92.30445861816, 69.22834777832, 61.53630828857, 61.53630828857 } });
-  returning.emplace(203, Rand_prop_point{ 203, 47.95534896851, 61.39738464355, { 124.22470092773, 93.1685256958, 69.8763961792, 62.11235046387, 62.11235046387 } });
-  returning.emplace(204, Rand_prop_point{ 204, 48.45198059082, 62.48770141602, { 125.38757324219, 94.04067230225, 70.53050994873, 62.6937828064, 62.6937828064 } });
-  returning.emplace(205, Rand_prop_point{ 205, 48.95370864868, 63.5930557251, { 126.56133270264, 94.92098999023, 71.19074249268, 63.28066253662, 63.28066253662 } });
-  returning.emplace(206, Rand_prop_point{ 206, 49.46058273315, 64.71363067627, { 127.74606323242, 95.80954742432, 71.85716247559, 63.87303161621, 63.87303161621 } });
-  returning.emplace(207, Rand_prop_point{ 207, 49.9726600647, 65.849609375, { 128.94189453125, 96.70642089844, 72.52981567383, 64.47094726563, 64.47094726563 } });
-  returning.emplace(208, Rand_prop_point{ 208, 50.48998641968, 67.00118255615, { 130.14892578125, 97.61168670654, 73.20877075195, 65.07446289063, 65.07446289063 } });
-  returning.emplace(209, Rand_prop_point{ 209, 51.01262283325, 68.16854858398, { 131.36724853516, 98.52543640137, 73.89407348633, 65.68362426758, 65.68362426758 } });
-  returning.emplace(210, Rand_prop_point{ 210, 51.54061508179, 69.35189819336, { 132.59696960449, 99.44773101807, 74.5858001709, 66.29848480225, 66.29848480225 } });
-  returning.emplace(211, Rand_prop_point{ 211, 52.07402420044, 70.55142974854, { 133.83821105957, 100.37866210938, 75.28399658203, 66.91910552979, 66.91910552979 } });
-  returning.emplace(212, Rand_prop_point{ 212, 52.61290359497, 71.76733398438, { 135.09107971191, 101.31831359863, 75.98873138428, 67.54553985596, 67.54553985596 } });
-  returning.emplace(213, Rand_prop_point{ 213, 53.15731048584, 72.99983215332, { 136.35566711426, 102.266746521, 76.7000579834, 68.17783355713, 68.17783355713 } });
-  returning.emplace(214, Rand_prop_point{ 214, 53.70729827881, 74.24910736084, { 137.63209533691, 103.22406768799, 77.41805267334, 68.81604766846, 68.81604766846 } });
-  returning.emplace(215, Rand_prop_point{ 215, 54.26292419434, 75.51538085938, { 138.92047119141, 104.19035339356, 78.14276123047, 69.4602355957, 69.4602355957 } });
-  returning.emplace(216, Rand_prop_point{ 216, 54.82424545288, 76.79885101318, { 140.22090148926, 105.16567230225, 78.87425994873, 70.11045074463, 70.11045074463 } });
-  returning.emplace(217, Rand_prop_point{ 217, 55.3913230896, 78.09973144531, { 141.53350830078, 106.15013122559, 79.61260223389, 70.76675415039, 70.76675415039 } });
-  returning.emplace(218, Rand_prop_point{ 218, 55.96421432495, 79.4182434082, { 142.8583984375, 107.14380645752, 80.35784912109, 71.42919921875, 71.42919921875 } });
-  returning.emplace(219, Rand_prop_point{ 219, 56.5429725647, 80.75459289551, { 144.19570922852, 108.1467666626, 81.11008453369, 72.09785461426, 72.09785461426 } });
-  returning.emplace(220, Rand_prop_point{ 220, 57.12766647339, 82.10900115967, { 145.54551696777, 109.15914154053, 81.86935424805, 72.77275848389, 72.77275848389 } });
-  returning.emplace(221, Rand_prop_point{ 221, 57.71834945679, 83.48169708252, { 146.90797424316, 110.18097686768, 82.63573455811, 73.45398712158, 73.45398712158 } });
-  returning.emplace(222, Rand_prop_point{ 222, 58.31508636475, 84.87288665771, { 148.28317260742, 111.21238708496, 83.40928649902, 74.14158630371, 74.14158630371 } });
-  returning.emplace(223, Rand_prop_point{ 223, 58.91793823242, 86.28281402588, { 149.67126464844, 112.25344085693, 84.19007873535, 74.83563232422, 74.83563232422 } });
-  returning.emplace(224, Rand_prop_point{ 224, 59.52696609497, 87.71170043945, { 151.07232666016, 113.30423736572, 84.97818756104, 75.53616333008, 75.53616333008 } });
-  returning.emplace(225, Rand_prop_point{ 225, 60.14223480225, 89.15977478027, { 152.48652648926, 114.36489105225, 85.77366638184, 76.24326324463, 76.24326324463 } });
-  returning.emplace(226, Rand_prop_point{ 226, 60.7638053894, 90.62728118896, { 153.91394042969, 115.43546295166, 86.57659912109, 76.95697021484, 76.95697021484 } });
-  returning.emplace(227, Rand_prop_point{ 227, 61.3917427063, 92.11444091797, { 155.35473632813, 116.51605224609, 87.38703918457, 77.67736816406, 77.67736816406 } });
-  returning.emplace(228, Rand_prop_point{ 228, 62.02611160278, 93.6215057373, { 156.80900573731, 117.60675811768, 88.20507049561, 78.40450286865, 78.40450286865 } });
-  returning.emplace(229, Rand_prop_point{ 229, 62.66697692871, 95.1487121582, { 158.27690124512, 118.70767974854, 89.03076171875, 79.13845062256, 79.13845062256 } });
-  returning.emplace(230, Rand_prop_point{ 230, 63.31440353394, 96.69631195068, { 159.75852966309, 119.81890106201, 89.86417388916, 79.87926483154, 79.87926483154 } });
-  returning.emplace(231, Rand_prop_point{ 231, 63.96846389771, 98.26454162598, { 161.25402832031, 120.94052886963, 90.70539093018, 80.62701416016, 80.62701416016 } });
-  returning.emplace(232, Rand_prop_point{ 232, 64.62921905518, 99.8536605835, { 162.7635345459, 122.07264709473, 91.55448913574, 81.38176727295, 81.38176727295 } });
-  returning.emplace(233, Rand_prop_point{ 233, 65.2967376709, 101.46392059326, { 164.28717041016, 123.21537017822, 92.41152954102, 82.14358520508, 82.14358520508 } });
-  returning.emplace(234, Rand_prop_point{ 234, 65.97109222412, 103.09558105469, { 165.8250579834, 124.36879730225, 93.27659606934, 82.9125289917, 82.9125289917 } });
-  returning.emplace(235, Rand_prop_point{ 235, 66.65235137939, 104.74889373779, { 167.37734985352, 125.53301239014, 94.14975738525, 83.68867492676, 83.68867492676 } });
-  returning.emplace(236, Rand_prop_point{ 236, 67.34058380127, 106.42413330078, { 168.94416809082, 126.70812225342, 95.03109741211, 84.47208404541, 84.47208404541 } });
-  returning.emplace(237, Rand_prop_point{ 237, 68.0358581543, 108.12153625488, { 170.52565002441, 127.89424133301, 95.92067718506, 85.26282501221, 85.26282501221 } });
-  returning.emplace(238, Rand_prop_point{ 238, 68.73825073242, 109.84142303467, { 172.12194824219, 129.09146118164, 96.81859588623, 86.06097412109, 86.06097412109 } });
-  returning.emplace(239, Rand_prop_point{ 239, 69.4478302002, 111.58400726318, { 173.73318481445, 130.29988098145, 97.72491455078, 86.86659240723, 86.86659240723 } });
-  returning.emplace(240, Rand_prop_point{ 240, 70.16467285156, 113.349609375, { 175.35949707031, 131.51962280273, 98.63971710205, 87.67974853516, 87.67974853516 } });
-  returning.emplace(241, Rand_prop_point{ 241, 70.88885498047, 115.13848114014, { 177.00103759766, 132.75077819824, 99.56308746338, 88.50051879883, 88.50051879883 } });
-  returning.emplace(242, Rand_prop_point{ 242, 71.62043762207, 116.95091247559, { 178.65794372559, 133.99345397949, 100.49508666992, 89.32897186279, 89.32897186279 } });
-  returning.emplace(243, Rand_prop_point{ 243, 72.3595123291, 118.78719329834, { 180.33036804199, 135.2477722168, 101.4358291626, 90.165184021, 90.165184021 } });
-  returning.emplace(244, Rand_prop_point{ 244, 73.10614013672, 120.64759063721, { 182.01843261719, 136.51382446289, 102.38536834717, 91.00921630859, 91.00921630859 } });
-  returning.emplace(245, Rand_prop_point{ 245, 73.86041259766, 122.53241729736, { 183.72232055664, 137.79173278809, 103.34380340576, 91.86116027832, 91.86116027832 } });
-  returning.emplace(246, Rand_prop_point{ 246, 74.62239837646, 124.4419631958, { 185.44213867188, 139.08160400391, 104.31120300293, 92.72106933594, 92.72106933594 } });
-  returning.emplace(247, Rand_prop_point{ 247, 75.39217376709, 126.37651824951, { 187.17807006836, 140.38354492188, 105.28765869141, 93.58903503418, 93.58903503418 } });
-  returning.emplace(248, Rand_prop_point{ 248, 76.16983032227, 128.33639526367, { 188.93023681641, 141.69767761231, 106.27326202393, 94.4651184082, 94.4651184082 } });
-  returning.emplace(249, Rand_prop_point{ 249, 76.95543670654, 130.32188415527, { 190.69882202148, 143.02410888672, 107.26808166504, 95.34941101074, 95.34941101074 } });
-  returning.emplace(250, Rand_prop_point{ 250, 77.74906921387, 132.33329772949, { 192.48394775391, 144.36296081543, 108.27221679688, 96.24197387695, 96.24197387695 } });
-  returning.emplace(251, Rand_prop_point{ 251, 78.55082702637, 134.37094116211, { 194.28579711914, 145.71434020996, 109.28575897217, 97.14289855957, 97.14289855957 } });
-  returning.emplace(252, Rand_prop_point{ 252, 79.36077880859, 136.43515014648, { 196.10450744629, 147.07838439941, 110.30877685547, 98.05225372314, 98.05225372314 } });
-  returning.emplace(253, Rand_prop_point{ 253, 80.17900848389, 138.5262298584, { 197.94023132324, 148.45518493652, 111.3413772583, 98.97011566162, 98.97011566162 } });
-  returning.emplace(254, Rand_prop_point{ 254, 81.00559997559, 140.64450073242, { 199.79315185547, 149.8448638916, 112.3836517334, 99.89657592773, 99.89657592773 } });
-  returning.emplace(255, Rand_prop_point{ 255, 81.84064483643, 142.79028320313, { 201.66342163086, 151.24757385254, 113.43567657471, 100.83171081543, 100.83171081543 } });
-  returning.emplace(256, Rand_prop_point{ 256, 82.68422698975, 144.96392822266, { 203.55119323731, 152.66339111328, 114.49755096436, 101.77559661865, 101.77559661865 } });
-  returning.emplace(257, Rand_prop_point{ 257, 83.53643035889, 147.16575622559, { 205.45663452148, 154.09248352051, 115.56935882568, 102.72831726074, 102.72831726074 } });
-  returning.emplace(258, Rand_prop_point{ 258, 84.39733886719, 149.39608764648, { 207.37991333008, 155.53494262695, 116.65120697022, 103.68995666504, 103.68995666504 } });
-  returning.emplace(259, Rand_prop_point{ 259, 85.26705169678, 151.65528869629, { 209.32119750977, 156.99090576172, 117.74317932129, 104.66059875488, 104.66059875488 } });
-  returning.emplace(260, Rand_prop_point{ 260, 86.145652771, 153.94369506836, { 211.28065490723, 158.46049499512, 118.84538269043, 105.64032745361, 105.64032745361 } });
-  returning.emplace(261, Rand_prop_point{ 261, 87.03322601318, 156.26165771484, { 213.25846862793, 159.94384765625, 119.95789337158, 106.62922668457, 106.62922668457 } });
-  returning.emplace(262, Rand_prop_point{ 262, 87.92986297607, 158.60952758789, { 215.25477600098, 161.44108581543, 121.08081054688, 107.62738800049, 107.62738800049 } });
-  returning.emplace(263, Rand_prop_point{ 263, 88.83567047119, 160.98765563965, { 217.26977539063, 162.95233154297, 122.21424865723, 108.63488769531, 108.63488769531 } });
-  returning.emplace(264, Rand_prop_point{ 264, 89.75072479248, 163.39642333984, { 219.30363464356, 164.47772216797, 123.35829925537, 109.65181732178, 109.65181732178 } });
-  returning.emplace(265, Rand_prop_point{ 265, 90.67513275146, 165.83616638184, { 221.35653686523, 166.01741027832, 124.51304626465, 110.67826843262, 110.67826843262 } });
-  returning.emplace(266, Rand_prop_point{ 266, 91.60897827148, 168.30726623535, { 223.42866516113, 167.57150268555, 125.67861938477, 111.71433258057, 111.71433258057 } });
-  returning.emplace(267, Rand_prop_point{ 267, 92.55236053467, 170.81010437012, { 225.52017211914, 169.14013671875, 126.85510253906, 112.76009368897, 112.76009368897 } });
-  returning.emplace(268, Rand_prop_point{ 268, 93.50537872314, 173.34506225586, { 227.63127136231, 170.72344970703, 128.04258728027, 113.81564331055, 113.81564331055 } });
-  returning.emplace(269, Rand_prop_point{ 269, 94.46812438965, 175.91249084473, { 229.76213073731, 172.32159423828, 129.24119567871, 114.88107299805, 114.88107299805 } });
-  returning.emplace(270, Rand_prop_point{ 270, 95.4407043457, 178.51281738281, { 231.91293334961, 173.9347076416, 130.45101928711, 115.95646667481, 115.95646667481 } });
-  returning.emplace(271, Rand_prop_point{ 271, 96.42321777344, 181.14639282227, { 234.08387756348, 175.56291198731, 131.67218017578, 117.04193878174, 117.04193878174 } });
-  returning.emplace(272, Rand_prop_point{ 272, 97.41575622559, 183.81364440918, { 236.27513122559, 177.20634460449, 132.90476989746, 118.13757324219, 118.13757324219 } });
-  returning.emplace(273, Rand_prop_point{ 273, 98.41843414307, 186.51495361328, { 238.48690795898, 178.86518859863, 134.14888000488, 119.2434463501, 119.2434463501 } });
-  returning.emplace(274, Rand_prop_point{ 274, 99.43134307861, 189.25073242188, { 240.71939086914, 180.53953552246, 135.40464782715, 120.35970306397, 120.35970306397 } });
-  returning.emplace(275, Rand_prop_point{ 275, 100.45459747315, 192.02137756348, { 242.97276306152, 182.22956848145, 136.67218017578, 121.48638153076, 121.48638153076 } });
-  returning.emplace(276, Rand_prop_point{ 276, 101.4882888794, 194.82733154297, { 245.24722290039, 183.93542480469, 137.95156860352, 122.6236114502, 122.6236114502 } });
-  returning.emplace(277, Rand_prop_point{ 277, 102.53253936768, 197.66897583008, { 247.54298400879, 185.65724182129, 139.24293518066, 123.7714920044, 123.7714920044 } });
-  returning.emplace(278, Rand_prop_point{ 278, 103.58744049072, 200.54675292969, { 249.86024475098, 187.39518737793, 140.54638671875, 124.93012237549, 124.93012237549 } });
-  returning.emplace(279, Rand_prop_point{ 279, 104.65310668945, 203.4610748291, { 252.19918823242, 189.14938354492, 141.86204528809, 126.09958648682, 126.09958648682 } });
-  returning.emplace(280, Rand_prop_point{ 280, 105.72965240479, 206.41239929199, { 254.56002807617, 190.92001342773, 143.1900177002, 127.28000640869, 127.28000640869 } });
-  returning.emplace(281, Rand_prop_point{ 281, 106.81717681885, 209.40115356445, { 256.94296264648, 192.70721435547, 144.5304107666, 128.47148132324, 128.47148132324 } });
-  returning.emplace(282, Rand_prop_point{ 282, 107.91578674316, 212.42776489258, { 259.34820556641, 194.51115417481, 145.88336181641, 129.6741027832, 129.6741027832 } });
-  returning.emplace(283, Rand_prop_point{ 283, 109.02562713623, 215.49269104004, { 261.77597045898, 196.33197021484, 147.24897766113, 130.88798522949, 130.88798522949 } });
-  returning.emplace(284, Rand_prop_point{ 284, 110.14678192139, 218.59638977051, { 264.22644042969, 198.16984558106, 148.62738037109, 132.11322021484, 132.11322021484 } });
-  returning.emplace(285, Rand_prop_point{ 285, 111.27937316895, 221.73930358887, { 266.69989013672, 200.02490234375, 150.01867675781, 133.34994506836, 133.34994506836 } });
-  returning.emplace(286, Rand_prop_point{ 286, 112.42350769043, 224.92192077637, { 269.19644165039, 201.89733886719, 151.42300415039, 134.5982208252, 134.5982208252 } });
-  returning.emplace(287, Rand_prop_point{ 287, 113.57932281494, 228.14468383789, { 271.71640014648, 203.78730773926, 152.84048461914, 135.85820007324, 135.85820007324 } });
-  returning.emplace(288, Rand_prop_point{ 288, 114.74691772461, 231.4080657959, { 274.25994873047, 205.69496154785, 154.27122497559, 137.12997436523, 137.12997436523 } });
-  returning.emplace(289, Rand_prop_point{ 289, 115.92642211914, 234.71255493164, { 276.82730102539, 207.62046813965, 155.71534729004, 138.4136505127, 138.4136505127 } });
-  returning.emplace(290, Rand_prop_point{ 290, 117.11795043945, 238.05863952637, { 279.4186706543, 209.56401062012, 157.17300415039, 139.70933532715, 139.70933532715 } });
-  returning.emplace(291, Rand_prop_point{ 291, 118.32163238525, 241.44679260254, { 282.03430175781, 211.52574157715, 158.64430236816, 141.01715087891, 141.01715087891 } });
-  returning.emplace(292, Rand_prop_point{ 292, 119.53759002686, 244.87753295898, { 284.67443847656, 213.50582885742, 160.12937927246, 142.33721923828, 142.33721923828 } });
-  returning.emplace(293, Rand_prop_point{ 293, 120.76593780518, 248.35133361816, { 287.33926391602, 215.50445556641, 161.62834167481, 143.66963195801, 143.66963195801 } });
-  returning.emplace(294, Rand_prop_point{ 294, 122.00681304932, 251.86871337891, { 290.02905273438, 217.52180480957, 163.14134216309, 145.01452636719, 145.01452636719 } });
-  returning.emplace(295, Rand_prop_point{ 295, 123.26033782959, 255.43019104004, { 292.74401855469, 219.55801391602, 164.66851806641, 146.37200927734, 146.37200927734 } });
-  returning.emplace(296, Rand_prop_point{ 296, 124.52662658691, 259.03628540039, { 295.48440551758, 221.61329650879, 166.20997619629, 147.74220275879, 147.74220275879 } });
-  returning.emplace(297, Rand_prop_point{ 297, 125.80583953857, 262.6875, { 298.25042724609, 223.68782043457, 167.76586914063, 149.12521362305, 149.12521362305 } });
-  returning.emplace(298, Rand_prop_point{ 298, 127.09808349609, 266.38436889648, { 301.04235839844, 225.78176879883, 169.33633422852, 150.52117919922, 150.52117919922 } });
-  returning.emplace(299, Rand_prop_point{ 299, 128.40350341797, 270.12741088867, { 303.86041259766, 227.89530944824, 170.92147827148, 151.93020629883, 151.93020629883 } });
-  returning.emplace(300, Rand_prop_point{ 300, 129.72221374512, 273.91720581055, { 306.70486450195, 230.02864074707, 172.521484375, 153.35243225098, 153.35243225098 } });
-  returning.emplace(301, Rand_prop_point{ 301, 131.05436706543, 277.75430297852, { 309.57592773438, 232.18194580078, 174.13645935059, 154.78796386719, 154.78796386719 } });
-  returning.emplace(302, Rand_prop_point{ 302, 132.40008544922, 281.63922119141, { 312.47387695313, 234.35539245606, 175.76655578613, 156.23693847656, 156.23693847656 } });
-  returning.emplace(303, Rand_prop_point{ 303, 133.75952148438, 285.57250976563, { 315.39892578125, 236.54919433594, 177.41189575195, 157.69946289063, 157.69946289063 } });
-  returning.emplace(304, Rand_prop_point{ 304, 135.1328125, 289.55477905273, { 318.35137939453, 238.7635345459, 179.07266235352, 159.17568969727, 159.17568969727 } });
-  returning.emplace(305, Rand_prop_point{ 305, 136.52008056641, 293.58657836914, { 321.33148193359, 240.9986114502, 180.74896240234, 160.6657409668, 160.6657409668 } });
-  returning.emplace(306, Rand_prop_point{ 306, 137.92149353027, 297.66848754883, { 324.33944702148, 243.25459289551, 182.44094848633, 162.16972351074, 162.16972351074 } });
-  returning.emplace(307, Rand_prop_point{ 307, 139.33717346191, 301.80111694336, { 327.37561035156, 245.53170776367, 184.14877319336, 163.68780517578, 163.68780517578 } });
-  returning.emplace(308, Rand_prop_point{ 308, 140.76727294922, 305.98501586914, { 330.4401550293, 247.83012390137, 185.87258911133, 165.22007751465, 165.22007751465 } });
-  returning.emplace(309, Rand_prop_point{ 309, 142.21192932129, 310.22076416016, { 333.53341674805, 250.15007019043, 187.61254882813, 166.76670837402, 166.76670837402 } });
-  returning.emplace(310, Rand_prop_point{ 310, 143.67131042481, 314.50903320313, { 336.65563964844, 252.49172973633, 189.36878967285, 168.32781982422, 168.32781982422 } });
-  returning.emplace(311, Rand_prop_point{ 311, 145.14555358887, 318.85040283203, { 339.80706787109, 254.85530090332, 191.14147949219, 169.90353393555, 169.90353393555 } });
-  returning.emplace(312, Rand_prop_point{ 312, 145.89028930664, 319.14764404297, { 342.9880065918, 257.24099731445, 192.93075561523, 171.4940032959, 171.4940032959 } });
-  returning.emplace(313, Rand_prop_point{ 313, 146.63883972168, 319.44512939453, { 346.19869995117, 259.64904785156, 194.73677062988, 173.09934997559, 173.09934997559 } });
-  returning.emplace(314, Rand_prop_point{ 314, 147.39123535156, 319.74291992188, { 349.43948364258, 262.07962036133, 196.5597076416, 174.71974182129, 174.71974182129 } });
-  returning.emplace(315, Rand_prop_point{ 315, 148.14749145508, 320.04098510742, { 352.71060180664, 264.5329284668, 198.39970397949, 176.35530090332, 176.35530090332 } });
-  returning.emplace(316, Rand_prop_point{ 316, 148.90763854981, 320.33932495117, { 356.01229858398, 267.00924682617, 200.25692749023, 178.00614929199, 178.00614929199 } });
-  returning.emplace(317, Rand_prop_point{ 317, 149.67167663574, 320.63793945313, { 359.34494018555, 269.50869750977, 202.13153076172, 179.67247009277, 179.67247009277 } });
-  returning.emplace(318, Rand_prop_point{ 318, 150.43963623047, 320.93682861328, { 362.70877075195, 272.03158569336, 204.02368164063, 181.35438537598, 181.35438537598 } });
-  returning.emplace(319, Rand_prop_point{ 319, 151.21153259277, 321.23599243164, { 366.10409545898, 274.57806396484, 205.93354797363, 183.05204772949, 183.05204772949 } });
-  returning.emplace(320, Rand_prop_point{ 320, 151.98739624023, 321.5354309082, { 369.53118896484, 277.14840698242, 207.86129760742, 184.76559448242, 184.76559448242 } });
-  returning.emplace(321, Rand_prop_point{ 321, 152.76722717285, 321.83517456055, { 372.99038696289, 279.74279785156, 209.80708312988, 186.49519348145, 186.49519348145 } });
-  returning.emplace(322, Rand_prop_point{ 322, 153.55107116699, 322.13519287109, { 376.48193359375, 282.36145019531, 211.77108764648, 188.24096679688, 188.24096679688 } });
-  returning.emplace(323, Rand_prop_point{ 323, 154.33894348145, 322.43545532227, { 380.00619506836, 285.00463867188, 213.75347900391, 190.00309753418, 190.00309753418 } });
-  returning.emplace(324, Rand_prop_point{ 324, 155.13084411621, 322.73602294922, { 383.56344604492, 287.6725769043, 215.75442504883, 191.78172302246, 191.78172302246 } });
-  returning.emplace(325, Rand_prop_point{ 325, 155.92681884766, 323.03689575195, { 387.15396118164, 290.36547851563, 217.77410888672, 193.57698059082, 193.57698059082 } });
-  returning.emplace(326, Rand_prop_point{ 326, 156.72686767578, 323.33801269531, { 390.77813720703, 293.08358764648, 219.81269836426, 195.38906860352, 195.38906860352 } });
-  returning.emplace(327, Rand_prop_point{ 327, 157.53103637695, 323.63943481445, { 394.43618774414, 295.8271484375, 221.87036132813, 197.21809387207, 197.21809387207 } });
-  returning.emplace(328, Rand_prop_point{ 328, 158.33932495117, 323.94110107422, { 398.12850952148, 298.5964050293, 223.94729614258, 199.06425476074, 199.06425476074 } });
-  returning.emplace(329, Rand_prop_point{ 329, 159.15174865723, 324.24307250977, { 401.85540771484, 301.39154052734, 226.0436706543, 200.92770385742, 200.92770385742 } });
-  returning.emplace(330, Rand_prop_point{ 330, 159.96835327148, 324.54534912109, { 405.6171875, 304.212890625, 228.15966796875, 202.80859375, 202.80859375 } });
-  returning.emplace(331, Rand_prop_point{ 331, 160.78913879395, 324.84786987305, { 409.41415405273, 307.06060791016, 230.29547119141, 204.70707702637, 204.70707702637 } });
-  returning.emplace(332, Rand_prop_point{ 332, 161.61415100098, 325.15069580078, { 413.24667358398, 309.93502807617, 232.45126342773, 206.62333679199, 206.62333679199 } });
-  returning.emplace(333, Rand_prop_point{ 333, 162.44337463379, 325.45379638672, { 417.11508178711, 312.83633422852, 234.62724304199, 208.55754089356, 208.55754089356 } });
-  returning.emplace(334, Rand_prop_point{ 334, 163.27687072754, 325.75717163086, { 421.01971435547, 315.76477050781, 236.82359313965, 210.50985717773, 210.50985717773 } });
-  returning.emplace(335, Rand_prop_point{ 335, 164.11463928223, 326.0608215332, { 424.96087646484, 318.72067260742, 239.04049682617, 212.48043823242, 212.48043823242 } });
-  returning.emplace(336, Rand_prop_point{ 336, 164.95671081543, 326.36477661133, { 428.93893432617, 321.70419311523, 241.27815246582, 214.46946716309, 214.46946716309 } });
-  returning.emplace(337, Rand_prop_point{ 337, 165.80308532715, 326.66900634766, { 432.95422363281, 324.71566772461, 243.53675842285, 216.47711181641, 216.47711181641 } });
-  returning.emplace(338, Rand_prop_point{ 338, 166.65382385254, 326.97354125977, { 437.0071105957, 327.75534057617, 245.81651306152, 218.50355529785, 218.50355529785 } });
-  returning.emplace(339, Rand_prop_point{ 339, 167.50891113281, 327.2783203125, { 441.09796142578, 330.82345581055, 248.11759948731, 220.54898071289, 220.54898071289 } });
-  returning.emplace(340, Rand_prop_point{ 340, 168.36839294434, 327.58340454102, { 445.22708129883, 333.92031860352, 250.44023132324, 222.61354064941, 222.61354064941 } });
-  returning.emplace(341, Rand_prop_point{ 341, 169.2322845459, 327.88876342773, { 449.39483642578, 337.04614257813, 252.78460693359, 224.69741821289, 224.69741821289 } });
-  returning.emplace(342, Rand_prop_point{ 342, 170.10061645508, 328.19442749023, { 453.60162353516, 340.20123291016, 255.15092468262, 226.80081176758, 226.80081176758 } });
-  returning.emplace(343, Rand_prop_point{ 343, 171.85430908203, 329.11309814453, { 457.84780883789, 343.38586425781, 257.53939819336, 228.92390441895, 228.92390441895 } });
-  returning.emplace(344, Rand_prop_point{ 344, 173.62594604492, 330.03433227539, { 462.13372802734, 346.60028076172, 259.95022583008, 231.06686401367, 231.06686401367 } });
-  returning.emplace(345, Rand_prop_point{ 345, 175.41567993164, 330.95812988281, { 466.45974731445, 349.84481811523, 262.38360595703, 233.22987365723, 233.22987365723 } });
-  returning.emplace(346, Rand_prop_point{ 346, 177.22370910645, 331.88455200195, { 470.82629394531, 353.11972045898, 264.83978271484, 235.41314697266, 235.41314697266 } });
-  returning.emplace(347, Rand_prop_point{ 347, 179.05021667481, 332.81353759766, { 475.23370361328, 356.42526245117, 267.31893920898, 237.61685180664, 237.61685180664 } });
-  returning.emplace(348, Rand_prop_point{ 348, 180.89540100098, 333.74514770508, { 479.6823425293, 359.76177978516, 269.82131958008, 239.84117126465, 239.84117126465 } });
-  returning.emplace(349, Rand_prop_point{ 349, 182.75942993164, 334.67935180664, { 484.17266845703, 363.12948608398, 272.34713745117, 242.08633422852, 242.08633422852 } });
-  returning.emplace(350, Rand_prop_point{ 350, 184.64250183106, 335.61614990234, { 488.70501708984, 366.52874755859, 274.89657592773, 244.35250854492, 244.35250854492 } });
-  returning.emplace(351, Rand_prop_point{ 351, 186.54483032227, 336.55560302734, { 493.27978515625, 369.95983886719, 277.46987915039, 246.63989257813, 246.63989257813 } });
-  returning.emplace(352, Rand_prop_point{ 352, 188.46658325195, 337.49765014648, { 497.89736938477, 373.42303466797, 280.06726074219, 248.94868469238, 248.94868469238 } });
-  returning.emplace(353, Rand_prop_point{ 353, 190.40795898438, 338.4423828125, { 502.55819702148, 376.91864013672, 282.68899536133, 251.27909851074, 251.27909851074 } });
-  returning.emplace(354, Rand_prop_point{ 354, 192.36918640137, 339.38970947266, { 507.26263427734, 380.4469909668, 285.3352355957, 253.63131713867, 253.63131713867 } });
-  returning.emplace(355, Rand_prop_point{ 355, 194.35043334961, 340.33972167969, { 512.01110839844, 384.00836181641, 288.00625610352, 256.00555419922, 256.00555419922 } });
-  returning.emplace(356, Rand_prop_point{ 356, 196.35191345215, 341.29238891602, { 516.80407714844, 387.60305786133, 290.70230102539, 258.40203857422, 258.40203857422 } });
-  returning.emplace(357, Rand_prop_point{ 357, 198.37384033203, 342.24771118164, { 521.64190673828, 391.23141479492, 293.4235534668, 260.82095336914, 260.82095336914 } });
-  returning.emplace(358, Rand_prop_point{ 358, 200.41642761231, 343.20571899414, { 526.52496337891, 394.89373779297, 296.17028808594, 263.26248168945, 263.26248168945 } });
-  returning.emplace(359, Rand_prop_point{ 359, 202.47985839844, 344.16641235352, { 531.45379638672, 398.59033203125, 298.94274902344, 265.72689819336, 265.72689819336 } });
-  returning.emplace(360, Rand_prop_point{ 360, 204.56436157227, 345.12976074219, { 536.4287109375, 402.32153320313, 301.74114990234, 268.21435546875, 268.21435546875 } });
-  returning.emplace(361, Rand_prop_point{ 361, 206.67015075684, 346.09585571289, { 541.45025634766, 406.08767700195, 304.56576538086, 270.72512817383, 270.72512817383 } });
-  returning.emplace(362, Rand_prop_point{ 362, 208.79742431641, 347.06460571289, { 546.51873779297, 409.88906860352, 307.41680908203, 273.25936889648, 273.25936889648 } });
-  returning.emplace(363, Rand_prop_point{ 363, 210.9464263916, 348.03610229492, { 551.63470458984, 413.72604370117, 310.29452514648, 275.81735229492, 275.81735229492 } });
-  returning.emplace(364, Rand_prop_point{ 364, 213.11737060547, 349.01031494141, { 556.79858398438, 417.59893798828, 313.19918823242, 278.39929199219, 278.39929199219 } });
-  returning.emplace(365, Rand_prop_point{ 365, 215.31047058106, 349.98724365234, { 562.0107421875, 421.50805664063, 316.13104248047, 281.00537109375, 281.00537109375 } });
-  returning.emplace(366, Rand_prop_point{ 366, 217.5259552002, 350.96691894531, { 567.27172851563, 425.45379638672, 319.09036254883, 283.63586425781, 283.63586425781 } });
-  returning.emplace(367, Rand_prop_point{ 367, 219.76405334473, 351.94931030273, { 572.58197021484, 429.43649291992, 322.07736206055, 286.29098510742, 286.29098510742 } });
-  returning.emplace(368, Rand_prop_point{ 368, 222.0249786377, 352.93447875977, { 577.94189453125, 433.45645141602, 325.09234619141, 288.97094726563, 288.97094726563 } });
-  returning.emplace(369, Rand_prop_point{ 369, 224.30899047852, 353.92239379883, { 583.35205078125, 437.51403808594, 328.13552856445, 291.67602539063, 291.67602539063 } });
-  returning.emplace(370, Rand_prop_point{ 370, 226.61630249023, 354.9130859375, { 588.81280517578, 441.60958862305, 331.20721435547, 294.40640258789, 294.40640258789 } });
-  returning.emplace(371, Rand_prop_point{ 371, 228.94714355469, 355.9065246582, { 594.32470703125, 445.74349975586, 334.30764770508, 297.16235351563, 297.16235351563 } });
-  returning.emplace(372, Rand_prop_point{ 372, 231.30178833008, 356.90277099609, { 599.88818359375, 449.91610717773, 337.43710327148, 299.94409179688, 299.94409179688 } });
-  returning.emplace(373, Rand_prop_point{ 373, 233.68043518066, 357.90179443359, { 605.50372314453, 454.12777709961, 340.59582519531, 302.75186157227, 302.75186157227 } });
-  returning.emplace(374, Rand_prop_point{ 374, 236.08335876465, 358.9035949707, { 611.17181396484, 458.37887573242, 343.78414916992, 305.58590698242, 305.58590698242 } });
-  returning.emplace(375, Rand_prop_point{ 375, 238.51078796387, 359.90823364258, { 616.89300537109, 462.66976928711, 347.00231933594, 308.44650268555, 308.44650268555 } });
-  returning.emplace(376, Rand_prop_point{ 376, 240.96296691895, 360.91567993164, { 622.66778564453, 467.00082397461, 350.25061035156, 311.33389282227, 311.33389282227 } });
-  returning.emplace(377, Rand_prop_point{ 377, 243.44017028809, 361.92593383789, { 628.49658203125, 471.37240600586, 353.52932739258, 314.24829101563, 314.24829101563 } });
-  returning.emplace(378, Rand_prop_point{ 378, 245.94262695313, 362.93899536133, { 634.37994384766, 475.78494262695, 356.83871459961, 317.18997192383, 317.18997192383 } });
-  returning.emplace(379, Rand_prop_point{ 379, 248.47061157227, 363.95492553711, { 640.318359375, 480.23876953125, 360.17907714844, 320.1591796875, 320.1591796875 } });
-  returning.emplace(380, Rand_prop_point{ 380, 251.02436828613, 364.97369384766, { 646.31237792969, 484.73428344727, 363.55072021484, 323.15618896484, 323.15618896484 } });
-  returning.emplace(381, Rand_prop_point{ 381, 253.60415649414, 365.99530029297, { 652.36248779297, 489.27188110352, 366.95391845703, 326.18124389648, 326.18124389648 } });
-  returning.emplace(382, Rand_prop_point{ 382, 256.21026611328, 367.01977539063, { 658.46929931641, 493.85195922852, 370.38897705078, 329.2346496582, 329.2346496582 } });
-  returning.emplace(383, Rand_prop_point{ 383, 258.84292602539, 368.04711914063, { 664.63323974609, 498.47491455078, 373.8561706543, 332.31661987305, 332.31661987305 } });
-  returning.emplace(384, Rand_prop_point{ 384, 261.50244140625, 369.07733154297, { 670.85485839844, 503.14114379883, 377.35586547852, 335.42742919922, 335.42742919922 } });
-  returning.emplace(385, Rand_prop_point{ 385, 264.18902587891, 370.11044311523, { 677.13470458984, 507.85104370117, 380.88827514648, 338.56735229492, 338.56735229492 } });
-  returning.emplace(386, Rand_prop_point{ 386, 266.9030456543, 371.14645385742, { 683.47338867188, 512.60504150391, 384.45376586914, 341.73669433594, 341.73669433594 } });
-  returning.emplace(387, Rand_prop_point{ 387, 269.64468383789, 376.92825317383, { 689.87139892578, 517.40356445313, 388.05264282227, 344.93569946289, 344.93569946289 } });
-  returning.emplace(388, Rand_prop_point{ 388, 272.41427612305, 383.10852050781, { 696.32928466797, 522.24694824219, 391.68521118164, 348.16464233398, 348.16464233398 } });
-  returning.emplace(389, Rand_prop_point{ 389, 275.21209716797, 389.37149047852, { 702.84759521484, 527.13568115234, 395.35177612305, 351.42379760742, 351.42379760742 } });
-  returning.emplace(390, Rand_prop_point{ 390, 278.03845214844, 395.71810913086, { 709.42700195313, 532.07025146484, 399.05267333984, 354.71350097656, 354.71350097656 } });
-  returning.emplace(391, Rand_prop_point{ 391, 280.89358520508, 402.14944458008, { 716.06793212891, 537.05096435547, 402.78820800781, 358.03396606445, 358.03396606445 } });
-  returning.emplace(392, Rand_prop_point{ 392, 283.77780151367, 408.66653442383, { 722.77105712891, 542.07830810547, 406.55871582031, 361.38552856445, 361.38552856445 } });
-  returning.emplace(393, Rand_prop_point{ 393, 286.69140625, 415.27035522461, { 729.53692626953, 547.15264892578, 410.36450195313, 364.76846313477, 364.76846313477 } });
-  returning.emplace(394, Rand_prop_point{ 394, 289.63467407227, 421.96203613281, { 736.36608886719, 552.27459716797, 414.20593261719, 368.18304443359, 368.18304443359 } });
-  returning.emplace(395, Rand_prop_point{ 395, 292.60794067383, 428.74261474609, { 743.25921630859, 557.44439697266, 418.08331298828, 371.6296081543, 371.6296081543 } });
-  returning.emplace(396, Rand_prop_point{ 396, 295.61151123047, 435.61312866211, { 750.21685791016, 562.66265869141, 421.99700927734, 375.10842895508, 375.10842895508 } });
-  returning.emplace(397, Rand_prop_point{ 397, 298.64562988281, 442.57473754883, { 757.23968505859, 567.92974853516, 425.94732666016, 378.6198425293, 378.6198425293 } });
-  returning.emplace(398, Rand_prop_point{ 398, 301.71069335938, 449.62847900391, { 764.32818603516, 573.24615478516, 429.93460083008, 382.16409301758, 382.16409301758 } });
-  returning.emplace(399, Rand_prop_point{ 399, 304.80694580078, 456.77551269531, { 771.48309326172, 578.6123046875, 433.95922851563, 385.74154663086, 385.74154663086 } });
-  returning.emplace(400, Rand_prop_point{ 400, 307.93472290039, 464.01696777344, { 778.70495605469, 584.02868652344, 438.02151489258, 389.35247802734, 389.35247802734 } });
-  returning.emplace(401, Rand_prop_point{ 401, 311.09436035156, 471.35394287109, { 785.99438476563, 589.49578857422, 442.12185668945, 392.99719238281, 392.99719238281 } });
-  returning.emplace(402, Rand_prop_point{ 402, 314.28619384766, 478.78762817383, { 793.35211181641, 595.01403808594, 446.26055908203, 396.6760559082, 396.6760559082 } });
-  returning.emplace(403, Rand_prop_point{ 403, 317.51049804688, 486.31918334961, { 800.77868652344, 600.583984375, 450.43798828125, 400.38934326172, 400.38934326172 } });
-  returning.emplace(404, Rand_prop_point{ 404, 320.76760864258, 493.94979858398, { 808.27478027344, 606.2060546875, 454.65454101563, 404.13739013672, 404.13739013672 } });
-  returning.emplace(405, Rand_prop_point{ 405, 324.0578918457, 501.6806640625, { 815.84100341797, 611.88073730469, 458.91058349609, 407.92050170898, 407.92050170898 } });
-  returning.emplace(406, Rand_prop_point{ 406, 327.38168334961, 509.5129699707, { 823.47808837891, 617.60858154297, 463.20645141602, 411.73904418945, 411.73904418945 } });
-  returning.emplace(407, Rand_prop_point{ 407, 330.73928833008, 517.44793701172, { 831.18670654297, 623.39001464844, 467.54251098633, 415.59335327148, 415.59335327148 } });
-  returning.emplace(408, Rand_prop_point{ 408, 334.13107299805, 525.48681640625, { 838.96746826172, 629.2255859375, 471.91918945313, 419.48373413086, 419.48373413086 } });
-  returning.emplace(409, Rand_prop_point{ 409, 337.55737304688, 533.63092041016, { 846.82104492188, 635.11578369141, 476.33682250977, 423.41052246094, 423.41052246094 } });
-  returning.emplace(410, Rand_prop_point{ 410, 341.0185546875, 541.88140869141, { 854.74810791016, 641.06109619141, 480.79580688477, 427.37405395508, 427.37405395508 } });
-  returning.emplace(411, Rand_prop_point{ 411, 344.51495361328, 550.23956298828, { 862.74938964844, 647.06207275391, 485.29653930664, 431.37469482422, 431.37469482422 } });
-  returning.emplace(412, Rand_prop_point{ 412, 348.04690551758, 558.70672607422, { 870.82562255859, 653.11920166016, 489.83941650391, 435.4128112793, 435.4128112793 } });
-  returning.emplace(413, Rand_prop_point{ 413, 351.61480712891, 567.28424072266, { 878.97741699219, 659.23309326172, 494.4248046875, 439.48870849609, 439.48870849609 } });
-  returning.emplace(414, Rand_prop_point{ 414, 355.2190246582, 575.97338867188, { 887.20550537109, 665.40417480469, 499.05310058594, 443.60275268555, 443.60275268555 } });
-  returning.emplace(415, Rand_prop_point{ 415, 358.85989379883, 584.77545166016, { 895.51068115234, 671.63299560547, 503.72476196289, 447.75534057617, 447.75534057617 } });
-  returning.emplace(416, Rand_prop_point{ 416, 362.53778076172, 593.69183349609, { 903.8935546875, 677.92016601563, 508.44012451172, 451.94677734375, 451.94677734375 } });
-  returning.emplace(417, Rand_prop_point{ 417, 366.25311279297, 602.72393798828, { 912.35491943359, 684.26617431641, 513.19964599609, 456.1774597168, 456.1774597168 } });
-  returning.emplace(418, Rand_prop_point{ 418, 370.00622558594, 611.87310791016, { 920.89544677734, 690.67156982422, 518.00372314453, 460.44772338867, 460.44772338867 } });
-  returning.emplace(419, Rand_prop_point{ 419, 373.79751586914, 621.14074707031, { 929.51599121094, 697.13696289063, 522.85272216797, 464.75799560547, 464.75799560547 } });
-  returning.emplace(420, Rand_prop_point{ 420, 377.62734985352, 630.5283203125, { 938.21716308594, 703.66290283203, 527.74713134766, 469.10858154297, 469.10858154297 } });
-  returning.emplace(421, Rand_prop_point{ 421, 381.49612426758, 640.03717041016, { 946.99981689453, 710.24987792969, 532.68737792969, 473.49990844727, 473.49990844727 } });
-  returning.emplace(422, Rand_prop_point{ 422, 385.40423583984, 649.66882324219, { 955.86468505859, 716.89849853516, 537.67388916016, 477.9323425293, 477.9323425293 } });
-  returning.emplace(423, Rand_prop_point{ 423, 389.35211181641, 659.42468261719, { 964.81256103516, 723.60943603516, 542.70709228516, 482.40628051758, 482.40628051758 } });
-  returning.emplace(424, Rand_prop_point{ 424, 393.3401184082, 669.30627441406, { 973.84417724609, 730.38311767578, 547.78735351563, 486.92208862305, 486.92208862305 } });
-  returning.emplace(425, Rand_prop_point{ 425, 397.36865234375, 679.31506347656, { 982.96032714844, 737.22027587891, 552.91516113281, 491.48016357422, 491.48016357422 } });
-  returning.emplace(426, Rand_prop_point{ 426, 401.43817138672, 689.45263671875, { 992.16180419922, 744.12139892578, 558.09100341797, 496.08090209961, 496.08090209961 } });
-  returning.emplace(427, Rand_prop_point{ 427, 405.54904174805, 699.72045898438, { 1001.4495239258, 751.08709716797, 563.31530761719, 500.72473144531, 500.72473144531 } });
-  returning.emplace(428, Rand_prop_point{ 428, 409.70169067383, 710.12005615234, { 1010.8239746094, 758.11804199219, 568.58850097656, 505.41201782227, 505.41201782227 } });
-  returning.emplace(429, Rand_prop_point{ 429, 413.89654541016, 720.65313720703, { 1020.2863769531, 765.21478271484, 573.91107177734, 510.14318847656, 510.14318847656 } });
-  returning.emplace(430, Rand_prop_point{ 430, 418.1340637207, 731.32110595703, { 1029.8372802734, 772.3779296875, 579.28344726563, 514.91864013672, 514.91864013672 } });
-  returning.emplace(431, Rand_prop_point{ 431, 422.41461181641, 742.12567138672, { 1039.4775390625, 779.60821533203, 584.70611572266, 519.73876953125, 519.73876953125 } });
-  returning.emplace(432, Rand_prop_point{ 432, 426.73867797852, 753.06842041016, { 1049.2081298828, 786.90612792969, 590.17956542969, 524.60406494141, 524.60406494141 } });
-  returning.emplace(433, Rand_prop_point{ 433, 431.10668945313, 764.15106201172, { 1059.0297851562, 794.27233886719, 595.70422363281, 529.51489257813, 529.51489257813 } });
-  returning.emplace(434, Rand_prop_point{ 434, 435.51907348633, 775.37518310547, { 1068.943359375, 801.70751953125, 601.28063964844, 534.4716796875, 534.4716796875 } });
-  returning.emplace(435, Rand_prop_point{ 435, 439.9762878418, 786.74243164063, { 1078.9497070312, 809.21234130859, 606.90924072266, 539.47485351563, 539.47485351563 } });
-  returning.emplace(436, Rand_prop_point{ 436, 444.47882080078, 798.25457763672, { 1089.0498046875, 816.78735351563, 612.59051513672, 544.52490234375, 544.52490234375 } });
-  returning.emplace(437, Rand_prop_point{ 437, 449.02703857422, 809.91333007813, { 1099.2443847656, 824.43328857422, 618.32495117188, 549.62219238281, 549.62219238281 } });
-  returning.emplace(438, Rand_prop_point{ 438, 453.62149047852, 821.72039794922, { 1109.5344238281, 832.15081787109, 624.11309814453, 554.76721191406, 554.76721191406 } });
-  returning.emplace(439, Rand_prop_point{ 439, 458.26263427734, 833.67755126953, { 1119.9207763672, 839.94061279297, 629.95544433594, 559.96038818359, 559.96038818359 } });
-  returning.emplace(440, Rand_prop_point{ 440, 462.9508972168, 845.78656005859, { 1130.4044189453, 847.80328369141, 635.85247802734, 565.20220947266, 565.20220947266 } });
-  returning.emplace(441, Rand_prop_point{ 441, 467.68676757813, 858.04925537109, { 1140.9860839844, 855.73956298828, 641.8046875, 570.49304199219, 570.49304199219 } });
-  returning.emplace(442, Rand_prop_point{ 442, 472.47073364258, 870.46734619141, { 1151.6668701172, 863.75018310547, 647.81262207031, 575.83343505859, 575.83343505859 } });
-  returning.emplace(443, Rand_prop_point{ 443, 477.30328369141, 883.04278564453, { 1162.4476318359, 871.83575439453, 653.87677001953, 581.22381591797, 581.22381591797 } });
-  returning.emplace(444, Rand_prop_point{ 444, 482.18493652344, 895.77740478516, { 1173.3293457031, 879.99700927734, 659.99774169922, 586.66467285156, 586.66467285156 } });
-  returning.emplace(445, Rand_prop_point{ 445, 487.11611938477, 908.67303466797, { 1184.3128662109, 888.23461914063, 666.17596435547, 592.15643310547, 592.15643310547 } });
-  returning.emplace(446, Rand_prop_point{ 446, 492.0973815918, 921.73156738281, { 1195.3991699219, 896.54943847656, 672.41204833984, 597.69958496094, 597.69958496094 } });
-  returning.emplace(447, Rand_prop_point{ 447, 497.12924194336, 934.95501708984, { 1206.5893554688, 904.94201660156, 678.70654296875, 603.29467773438, 603.29467773438 } });
-  returning.emplace(448, Rand_prop_point{ 448, 502.21215820313, 948.34521484375, { 1217.8842773438, 913.41320800781, 685.05987548828, 608.94213867188, 608.94213867188 } });
-  returning.emplace(449, Rand_prop_point{ 449, 507.3466796875, 961.90417480469, { 1229.2849121094, 921.96362304688, 691.47271728516, 614.64245605469, 614.64245605469 } });
-  returning.emplace(450, Rand_prop_point{ 450, 512.53332519531, 975.63391113281, { 1240.7922363281, 930.59417724609, 697.94561767578, 620.39611816406, 620.39611816406 } });
-  returning.emplace(451, Rand_prop_point{ 451, 517.77264404297, 989.53643798828, { 1252.4072265625, 939.30548095703, 704.47906494141, 626.20361328125, 626.20361328125 } });
-  returning.emplace(452, Rand_prop_point{ 452, 523.06512451172, 1003.6137084961, { 1264.1311035156, 948.09832763672, 711.07373046875, 632.06555175781, 632.06555175781 } });
-  returning.emplace(453, Rand_prop_point{ 453, 528.41131591797, 1017.8677978516, { 1275.9645996094, 956.97344970703, 717.73010253906, 637.98229980469, 637.98229980469 } });
-  returning.emplace(454, Rand_prop_point{ 454, 533.81170654297, 1032.3009033203, { 1287.9089355469, 965.93170166016, 724.44879150391, 643.95446777344, 643.95446777344 } });
-  returning.emplace(455, Rand_prop_point{ 455, 539.26696777344, 1046.9149169922, { 1299.9650878906, 974.97375488281, 731.23034667969, 649.98254394531, 649.98254394531 } });
-  returning.emplace(456, Rand_prop_point{ 456, 544.77758789063, 1061.7121582031, { 1312.1340332031, 984.10052490234, 738.07537841797, 656.06701660156, 656.06701660156 } });
-  returning.emplace(457, Rand_prop_point{ 457, 550.34411621094, 1076.6945800781, { 1324.4168701172, 993.31268310547, 744.98449707031, 662.20843505859, 662.20843505859 } });
-  returning.emplace(458, Rand_prop_point{ 458, 555.96710205078, 1091.8646240234, { 1336.8148193359, 1002.6110839844, 751.95831298828, 668.40740966797, 668.40740966797 } });
-  returning.emplace(459, Rand_prop_point{ 459, 561.64715576172, 1107.2242431641, { 1349.3287353516, 1011.9965209961, 758.99737548828, 674.66436767578, 674.66436767578 } });
-  returning.emplace(460, Rand_prop_point{ 460, 567.38482666016, 1122.7757568359, { 1361.9598388672, 1021.4697875977, 766.10235595703, 680.97991943359, 680.97991943359 } });
-  returning.emplace(461, Rand_prop_point{ 461, 573.1806640625, 1138.5213623047, { 1374.7091064453, 1031.0318603516, 773.27386474609, 687.35455322266, 687.35455322266 } });
-  returning.emplace(462, Rand_prop_point{ 462, 579.03533935547, 1154.4635009766, { 1387.5777587891, 1040.6833496094, 780.51251220703, 693.78887939453, 693.78887939453 } });
-  returning.emplace(463, Rand_prop_point{ 463, 584.94940185547, 1170.6042480469, { 1400.5668945312, 1050.4251708984, 787.81884765625, 700.28344726563, 700.28344726563 } });
-  returning.emplace(464, Rand_prop_point{ 464, 590.92340087891, 1186.9460449219, { 1413.6776123047, 1060.2581787109, 795.19366455078, 706.83880615234, 706.83880615234 } });
-  returning.emplace(465, Rand_prop_point{ 465, 596.9580078125, 1203.4910888672, { 1426.9110107422, 1070.1832275391, 802.63745117188, 713.45550537109, 713.45550537109 } });
-  returning.emplace(466, Rand_prop_point{ 466, 603.05383300781, 1220.2420654297, { 1440.2683105469, 1080.2012939453, 810.15093994141, 720.13415527344, 720.13415527344 } });
-  returning.emplace(467, Rand_prop_point{ 467, 609.21148681641, 1237.2010498047, { 1453.7507324219, 1090.3129882812, 817.73480224609, 726.87536621094, 726.87536621094 } });
-  returning.emplace(468, Rand_prop_point{ 468, 615.43151855469, 1254.3707275391, { 1467.3592529297, 1100.51953125, 825.38958740234, 733.67962646484, 733.67962646484 } });
-  returning.emplace(469, Rand_prop_point{ 469, 621.71466064453, 1271.7534179688, { 1481.0952148438, 1110.8214111328, 833.11608886719, 740.54760742188, 740.54760742188 } });
-  returning.emplace(470, Rand_prop_point{ 470, 628.0615234375, 1289.3515625, { 1494.9598388672, 1121.2198486328, 840.91485595703, 747.47991943359, 747.47991943359 } });
-  returning.emplace(471, Rand_prop_point{ 471, 634.47271728516, 1307.1677246094, { 1508.9541015625, 1131.7155761719, 848.78668212891, 754.47705078125, 754.47705078125 } });
-  returning.emplace(472, Rand_prop_point{ 472, 640.94885253906, 1325.2045898438, { 1523.0794677734, 1142.3095703125, 856.73217773438, 761.53973388672, 761.53973388672 } });
-  returning.emplace(473, Rand_prop_point{ 473, 647.49072265625, 1343.4644775391, { 1537.3370361328, 1153.0028076172, 864.75207519531, 768.66851806641, 768.66851806641 } });
-  returning.emplace(474, Rand_prop_point{ 474, 654.09881591797, 1361.9501953125, { 1551.7280273438, 1163.7960205078, 872.84698486328, 775.86401367188, 775.86401367188 } });
-  returning.emplace(475, Rand_prop_point{ 475, 660.77398681641, 1380.6641845703, { 1566.2537841797, 1174.6903076172, 881.01776123047, 783.12689208984, 783.12689208984 } });
-  returning.emplace(476, Rand_prop_point{ 476, 667.51672363281, 1399.6092529297, { 1580.9155273438, 1185.6866455078, 889.26495361328, 790.45776367188, 790.45776367188 } });
-  returning.emplace(477, Rand_prop_point{ 477, 674.32781982422, 1418.7879638672, { 1595.7144775391, 1196.7857666016, 897.58935546875, 797.85723876953, 797.85723876953 } });
-  returning.emplace(478, Rand_prop_point{ 478, 681.2080078125, 1438.203125, { 1610.6519775391, 1207.9888916016, 905.99169921875, 805.32598876953, 805.32598876953 } });
-  returning.emplace(479, Rand_prop_point{ 479, 688.15783691406, 1457.8575439453, { 1625.7292480469, 1219.296875, 914.47271728516, 812.86462402344, 812.86462402344 } });
-  returning.emplace(480, Rand_prop_point{ 480, 695.17810058594, 1477.7537841797, { 1640.9477539062, 1230.7108154297, 923.03308105469, 820.47387695313, 820.47387695313 } });
-  returning.emplace(481, Rand_prop_point{ 481, 702.26953125, 1497.8947753906, { 1656.30859375, 1242.2314453125, 931.67358398438, 828.154296875, 828.154296875 } });
-  returning.emplace(482, Rand_prop_point{ 482, 709.43273925781, 1518.2834472656, { 1671.8133544922, 1253.8599853516, 940.39501953125, 835.90667724609, 835.90667724609 } });
-  returning.emplace(483, Rand_prop_point{ 483, 716.66857910156, 1538.9224853516, { 1687.4631347656, 1265.5974121094, 949.19805908203, 843.73156738281, 843.73156738281 } });
-  returning.emplace(484, Rand_prop_point{ 484, 723.97772216797, 1559.8149414062, { 1703.2595214844, 1277.4447021484, 958.08349609375, 851.62976074219, 851.62976074219 } });
-  returning.emplace(485, Rand_prop_point{ 485, 731.36090087891, 1580.9636230469, { 1719.2037353516, 1289.4028320312, 967.05212402344, 859.60186767578, 859.60186767578 } });
-  returning.emplace(486, Rand_prop_point{ 486, 738.81884765625, 1602.3715820312, { 1735.2972412109, 1301.4729003906, 976.10467529297, 867.64862060547, 867.64862060547 } });
-  returning.emplace(487, Rand_prop_point{ 487, 746.35235595703, 1624.0418701172, { 1751.5413818359, 1313.6560058594, 985.24200439453, 875.77069091797, 875.77069091797 } });
-  returning.emplace(488, Rand_prop_point{ 488, 753.96215820313, 1645.9774169922, { 1767.9375, 1325.953125, 994.46490478516, 883.96875, 883.96875 } });
-  returning.emplace(489, Rand_prop_point{ 489, 761.64898681641, 1668.1812744141, { 1784.4871826172, 1338.3654785156, 1003.7739868164, 892.24359130859, 892.24359130859 } });
-  returning.emplace(490, Rand_prop_point{ 490, 769.41369628906, 1690.6567382812, { 1801.1917724609, 1350.8939208984, 1013.1704101562, 900.59588623047, 900.59588623047 } });
-  returning.emplace(491, Rand_prop_point{ 491, 777.25708007813, 1713.4067382812, { 1818.052734375, 1363.5395507812, 1022.6547241211, 909.0263671875, 909.0263671875 } });
-  returning.emplace(492, Rand_prop_point{ 492, 785.17980957031, 1736.4344482422, { 1835.0715332031, 1376.3037109375, 1032.2277832031, 917.53576660156, 917.53576660156 } });
-  returning.emplace(493, Rand_prop_point{ 493, 793.18280029297, 1759.7431640625, { 1852.2497558594, 1389.1872558594, 1041.8905029297, 926.12487792969, 926.12487792969 } });
-  returning.emplace(494, Rand_prop_point{ 494, 801.26678466797, 1783.3361816406, { 1869.5886230469, 1402.1915283203, 1051.6435546875, 934.79431152344, 934.79431152344 } });
-  returning.emplace(495, Rand_prop_point{ 495, 809.43267822266, 1807.2166748047, { 1887.08984375, 1415.3173828125, 1061.4880371094, 943.544921875, 943.544921875 } });
-  returning.emplace(496, Rand_prop_point{ 496, 817.68115234375, 1831.3879394531, { 1904.7548828125, 1428.5661621094, 1071.4246826172, 952.37744140625, 952.37744140625 } });
-  returning.emplace(497, Rand_prop_point{ 497, 826.01318359375, 1855.8533935547, { 1922.5853271484, 1441.9389648438, 1081.4542236328, 961.29266357422, 961.29266357422 } });
-  returning.emplace(498, Rand_prop_point{ 498, 834.42956542969, 1880.6164550781, { 1940.5826416016, 1455.4370117188, 1091.5777587891, 970.29132080078, 970.29132080078 } });
-  returning.emplace(499, Rand_prop_point{ 499, 842.93109130859, 1905.6804199219, { 1958.7484130859, 1469.0614013672, 1101.7960205078, 979.37420654297, 979.37420654297 } });
-  returning.emplace(500, Rand_prop_point{ 500, 851.51867675781, 1931.0489501953, { 1977.0843505859, 1482.8132324219, 1112.1099853516, 988.54217529297, 988.54217529297 } });
-  returning.emplace(501, Rand_prop_point{ 501, 860.19323730469, 1956.7253417969, { 1995.591796875, 1496.6938476562, 1122.5203857422, 997.7958984375, 997.7958984375 } });
-  returning.emplace(502, Rand_prop_point{ 502, 868.95550537109, 1982.7132568359, { 2014.2725830078, 1510.7044677734, 1133.0283203125, 1007.1362915039, 1007.1362915039 } });
-  returning.emplace(503, Rand_prop_point{ 503, 877.80645751953, 2009.0162353516, { 2033.1281738281, 1524.8461914062, 1143.6346435547, 1016.5640869141, 1016.5640869141 } });
-  returning.emplace(504, Rand_prop_point{ 504, 886.74700927734, 2035.6379394531, { 2052.1604003906, 1539.1202392578, 1154.3402099609, 1026.0802001953, 1026.0802001953 } });
-  returning.emplace(505, Rand_prop_point{ 505, 895.77801513672, 2062.58203125, { 2071.3706054688, 1553.5279541016, 1165.1459960938, 1035.6853027344, 1035.6853027344 } });
-  returning.emplace(506, Rand_prop_point{ 506, 904.90032958984, 2089.8520507812, { 2090.7607421875, 1568.0705566406, 1176.0528564453, 1045.3803710938, 1045.3803710938 } });
-  returning.emplace(507, Rand_prop_point{ 507, 914.11499023438, 2117.4521484375, { 2110.3322753906, 1582.7492675781, 1187.0618896484, 1055.1661376953, 1055.1661376953 } });
-  returning.emplace(508, Rand_prop_point{ 508, 923.42291259766, 2145.3857421875, { 2130.0871582031, 1597.5654296875, 1198.1740722656, 1065.0435791016, 1065.0435791016 } });
-  returning.emplace(509, Rand_prop_point{ 509, 932.82495117188, 2173.6567382812, { 2150.0268554688, 1612.5201416016, 1209.3901367188, 1075.0134277344, 1075.0134277344 } });
-  returning.emplace(510, Rand_prop_point{ 510, 942.32208251953, 2202.2687988281, { 2170.1533203125, 1627.6149902344, 1220.7113037109, 1085.0766601562, 1085.0766601562 } });
-  returning.emplace(511, Rand_prop_point{ 511, 951.91528320313, 2231.2263183594, { 2190.4682617188, 1642.8510742188, 1232.1383056641, 1095.2341308594, 1095.2341308594 } });
-  returning.emplace(512, Rand_prop_point{ 512, 961.60552978516, 2260.5329589844, { 2210.9731445312, 1658.2298583984, 1243.6723632812, 1105.4865722656, 1105.4865722656 } });
-  returning.emplace(513, Rand_prop_point{ 513, 971.39379882813, 2290.1928710938, { 2231.6701660156, 1673.7525634766, 1255.314453125, 1115.8350830078, 1115.8350830078 } });
-  returning.emplace(514, Rand_prop_point{ 514, 981.28100585938, 2320.2097167969, { 2252.5607910156, 1689.4205322266, 1267.0654296875, 1126.2803955078, 1126.2803955078 } });
-  returning.emplace(515, Rand_prop_point{ 515, 991.26824951172, 2350.5881347656, { 2273.6469726562, 1705.2352294922, 1278.9263916016, 1136.8234863281, 1136.8234863281 } });
-  returning.emplace(516, Rand_prop_point{ 516, 1001.3563842773, 2381.3317871094, { 2294.9306640625, 1721.1979980469, 1290.8984375, 1147.4653320312, 1147.4653320312 } });
-  returning.emplace(517, Rand_prop_point{ 517, 1011.5466918945, 2412.4450683594, { 2316.4135742188, 1737.3100585938, 1302.9825439453, 1158.2067871094, 1158.2067871094 } });
-  returning.emplace(518, Rand_prop_point{ 518, 1021.8400268555, 2443.9321289062, { 2338.0974121094, 1753.5731201172, 1315.1798095703, 1169.0487060547, 1169.0487060547 } });
-  returning.emplace(519, Rand_prop_point{ 519, 1032.2373046875, 2475.7976074219, { 2359.984375, 1769.98828125, 1327.4912109375, 1179.9921875, 1179.9921875 } });
-  returning.emplace(520, Rand_prop_point{ 520, 1042.7397460938, 2508.0451660156, { 2382.076171875, 1786.5571289062, 1339.9178466797, 1191.0380859375, 1191.0380859375 } });
-  returning.emplace(521, Rand_prop_point{ 521, 1053.3483886719, 2540.6796875, { 2404.3747558594, 1803.2811279297, 1352.4608154297, 1202.1873779297, 1202.1873779297 } });
-  returning.emplace(522, Rand_prop_point{ 522, 1064.0642089844, 2573.7053222656, { 2426.8820800781, 1820.1616210938, 1365.1212158203, 1213.4410400391, 1213.4410400391 } });
-  returning.emplace(523, Rand_prop_point{ 523, 1074.8884277344, 2607.1267089844, { 2449.6003417969, 1837.2001953125, 1377.9001464844, 1224.8001708984, 1224.8001708984 } });
-  returning.emplace(524, Rand_prop_point{ 524, 1085.8220214844, 2640.9482421875, { 2472.5310058594, 1854.3981933594, 1390.7987060547, 1236.2655029297, 1236.2655029297 } });
-  returning.emplace(525, Rand_prop_point{ 525, 1096.8660888672, 2675.1745605469, { 2495.6762695312, 1871.7572021484, 1403.8179931641, 1247.8381347656, 1247.8381347656 } });
-  returning.emplace(526, Rand_prop_point{ 526, 1108.0218505859, 2709.8100585938, { 2519.0383300781, 1889.2788085938, 1416.9591064453, 1259.5191650391, 1259.5191650391 } });
-  returning.emplace(527, Rand_prop_point{ 527, 1119.2902832031, 2744.8598632812, { 2542.619140625, 1906.9643554688, 1430.2232666016, 1271.3095703125, 1271.3095703125 } });
-  returning.emplace(528, Rand_prop_point{ 528, 1130.6726074219, 2780.328125, { 2566.4206542969, 1924.8154296875, 1443.6115722656, 1283.2103271484, 1283.2103271484 } });
-  returning.emplace(529, Rand_prop_point{ 529, 1142.169921875, 2816.2202148438, { 2590.4448242188, 1942.8336181641, 1457.1252441406, 1295.2224121094, 1295.2224121094 } });
-  returning.emplace(530, Rand_prop_point{ 530, 1153.7834472656, 2852.5402832031, { 2614.6940917969, 1961.0205078125, 1470.7653808594, 1307.3470458984, 1307.3470458984 } });
-  returning.emplace(531, Rand_prop_point{ 531, 1165.5142822266, 2889.2939453125, { 2639.1701660156, 1979.3776855469, 1484.533203125, 1319.5850830078, 1319.5850830078 } });
-  returning.emplace(532, Rand_prop_point{ 532, 1177.3637695312, 2926.4853515625, { 2663.8754882812, 1997.9066162109, 1498.4299316406, 1331.9377441406, 1331.9377441406 } });
-  returning.emplace(533, Rand_prop_point{ 533, 1189.3327636719, 2964.1201171875, { 2688.8120117188, 2016.6090087891, 1512.4567871094, 1344.4060058594, 1344.4060058594 } });
-  returning.emplace(534, Rand_prop_point{ 534, 1201.4228515625, 3002.203125, { 2713.9819335938, 2035.4864501953, 1526.6148681641, 1356.9909667969, 1356.9909667969 } });
-  returning.emplace(535, Rand_prop_point{ 535, 1213.6350097656, 3040.7392578125, { 2739.3876953125, 2054.5407714844, 1540.9055175781, 1369.6938476562, 1369.6938476562 } });
-  returning.emplace(536, Rand_prop_point{ 536, 1225.9704589844, 3079.7336425781, { 2765.0310058594, 2073.7731933594, 1555.3299560547, 1382.5155029297, 1382.5155029297 } });
-  returning.emplace(537, Rand_prop_point{ 537, 1238.4305419922, 3119.1918945312, { 2790.9145507812, 2093.1857910156, 1569.8894042969, 1395.4572753906, 1395.4572753906 } });
-  returning.emplace(538, Rand_prop_point{ 538, 1251.0164794922, 3159.1186523438, { 2817.0402832031, 2112.7802734375, 1584.5852050781, 1408.5201416016, 1408.5201416016 } });
-  returning.emplace(539, Rand_prop_point{ 539, 1263.7296142578, 3199.5200195312, { 2843.4106445312, 2132.5578613281, 1599.4184570312, 1421.7053222656, 1421.7053222656 } });
-  returning.emplace(540, Rand_prop_point{ 540, 1276.5710449219, 3240.4006347656, { 2870.0278320312, 2152.5207519531, 1614.390625, 1435.0139160156, 1435.0139160156 } });
-  returning.emplace(541, Rand_prop_point{ 541, 1289.5421142578, 3281.7663574219, { 2896.8940429688, 2172.6706542969, 1629.5029296875, 1448.4470214844, 1448.4470214844 } });
-  returning.emplace(542, Rand_prop_point{ 542, 1302.6442871094, 3323.6225585938, { 2924.0119628906, 2193.0090332031, 1644.7567138672, 1462.0059814453, 1462.0059814453 } });
-  returning.emplace(543, Rand_prop_point{ 543, 1315.8786621094, 3365.9748535156, { 2951.3835449219, 2213.5378417969, 1660.1533203125, 1475.6917724609, 1475.6917724609 } });
-  returning.emplace(544, Rand_prop_point{ 544, 1329.2467041016, 3408.8288574219, { 2979.0114746094, 2234.2587890625, 1675.6939697266, 1489.5057373047, 1489.5057373047 } });
-  returning.emplace(545, Rand_prop_point{ 545, 1342.7497558594, 3452.1901855469, { 3006.8981933594, 2255.1735839844, 1691.3802490234, 1503.4490966797, 1503.4490966797 } });
-  returning.emplace(546, Rand_prop_point{ 546, 1356.3890380859, 3496.064453125, { 3035.0456542969, 2276.2841796875, 1707.2132568359, 1517.5228271484, 1517.5228271484 } });
-  returning.emplace(547, Rand_prop_point{ 547, 1370.166015625, 3540.4577636719, { 3063.4567871094, 2297.5925292969, 1723.1944580078, 1531.7283935547, 1531.7283935547 } });
-  returning.emplace(548, Rand_prop_point{ 548, 1384.0821533203, 3585.3759765625, { 3092.1337890625, 2319.1003417969, 1739.3253173828, 1546.0668945312, 1546.0668945312 } });
-  returning.emplace(549, Rand_prop_point{ 549, 1398.138671875, 3630.8247070312, { 3121.0793457031, 2340.8095703125, 1755.6070556641, 1560.5396728516, 1560.5396728516 } });
-  returning.emplace(550, Rand_prop_point{ 550, 1412.3371582031, 3676.8103027344, { 3150.2956542969, 2362.7219238281, 1772.0413818359, 1575.1478271484, 1575.1478271484 } });
-  returning.emplace(551, Rand_prop_point{ 551, 1426.6789550781, 3723.3386230469, { 3179.7856445312, 2384.8393554688, 1788.6293945312, 1589.8928222656, 1589.8928222656 } });
-  returning.emplace(552, Rand_prop_point{ 552, 1441.1654052734, 3770.4157714844, { 3209.5517578125, 2407.1638183594, 1805.3728027344, 1604.7758789062, 1604.7758789062 } });
-  returning.emplace(553, Rand_prop_point{ 553, 1455.7980957031, 3818.0480957031, { 3239.5964355469, 2429.697265625, 1822.2729492188, 1619.7982177734, 1619.7982177734 } });
-  returning.emplace(554, Rand_prop_point{ 554, 1470.5784912109, 3866.2419433594, { 3269.9221191406, 2452.4416503906, 1839.3311767578, 1634.9610595703, 1634.9610595703 } });
-  returning.emplace(555, Rand_prop_point{ 555, 1485.5080566406, 3915.0031738281, { 3300.5319824219, 2475.3989257812, 1856.5491943359, 1650.2659912109, 1650.2659912109 } });
-  returning.emplace(556, Rand_prop_point{ 556, 1500.5881347656, 3964.3388671875, { 3331.4282226562, 2498.5712890625, 1873.9283447266, 1665.7141113281, 1665.7141113281 } });
-  returning.emplace(557, Rand_prop_point{ 557, 1515.8204345703, 4014.2548828125, { 3362.6137695312, 2521.9602050781, 1891.4702148438, 1681.3068847656, 1681.3068847656 } });
-  returning.emplace(558, Rand_prop_point{ 558, 1531.2064208984, 4064.7583007812, { 3394.0913085938, 2545.568359375, 1909.1762695312, 1697.0456542969, 1697.0456542969 } });
-  returning.emplace(559, Rand_prop_point{ 559, 1546.7476806641, 4115.8549804688, { 3425.86328125, 2569.3974609375, 1927.0480957031, 1712.931640625, 1712.931640625 } });
-  returning.emplace(560, Rand_prop_point{ 560, 1562.4456787109, 4167.552734375, { 3457.9328613281, 2593.4497070312, 1945.0872802734, 1728.9664306641, 1728.9664306641 } });
-  returning.emplace(561, Rand_prop_point{ 561, 1578.3021240234, 4219.857421875, { 3490.3024902344, 2617.7270507812, 1963.2951660156, 1745.1512451172, 1745.1512451172 } });
-  returning.emplace(562, Rand_prop_point{ 562, 1594.3184814453, 4272.7763671875, { 3522.9753417969, 2642.2314453125, 1981.6735839844, 1761.4876708984, 1761.4876708984 } });
-  returning.emplace(563, Rand_prop_point{ 563, 1610.4963378906, 4326.3159179688, { 3555.9538574219, 2666.9653320312, 2000.2241210938, 1777.9769287109, 1777.9769287109 } });
-  returning.emplace(564, Rand_prop_point{ 564, 1626.8374023438, 4380.4833984375, { 3589.2412109375, 2691.9309082031, 2018.9482421875, 1794.6206054688, 1794.6206054688 } });
-  returning.emplace(565, Rand_prop_point{ 565, 1643.3432617188, 4435.2861328125, { 3622.8400878906, 2717.1301269531, 2037.8475341797, 1811.4200439453, 1811.4200439453 } });
-  returning.emplace(566, Rand_prop_point{ 566, 1660.0155029297, 4490.7309570312, { 3656.7536621094, 2742.5651855469, 2056.923828125, 1828.3768310547, 1828.3768310547 } });
-  returning.emplace(567, Rand_prop_point{ 567, 1676.8560791016, 4546.8251953125, { 3690.984375, 2768.23828125, 2076.1787109375, 1845.4921875, 1845.4921875 } });
-  returning.emplace(568, Rand_prop_point{ 568, 1693.8663330078, 4603.576171875, { 3725.5356445312, 2794.1518554688, 2095.6137695312, 1862.7678222656, 1862.7678222656 } });
-  returning.emplace(569, Rand_prop_point{ 569, 1711.0480957031, 4660.9912109375, { 3760.4106445312, 2820.3078613281, 2115.2309570312, 1880.2052001953, 1880.2052001953 } });
-  returning.emplace(570, Rand_prop_point{ 570, 1728.4031982422, 4719.0776367188, { 3795.6118164062, 2846.7087402344, 2135.0314941406, 1897.8059082031, 1897.8059082031 } });
-  returning.emplace(571, Rand_prop_point{ 571, 1736.4741210938, 1436.6784667969, { 3831.142578125, 2873.3569335938, 2155.017578125, 1915.5712890625, 1915.5712890625 } });
-  returning.emplace(572, Rand_prop_point{ 572, 1744.5827636719, 1450.1271972656, { 3867.005859375, 2900.2543945312, 2175.1906738281, 1933.5029296875, 1933.5029296875 } });
-  returning.emplace(573, Rand_prop_point{ 573, 1752.7292480469, 1463.7017822266, { 3903.2048339844, 2927.4035644531, 2195.552734375, 1951.6024169922, 1951.6024169922 } });
-  returning.emplace(574, Rand_prop_point{ 574, 1760.9138183594, 1477.4035644531, { 3939.7429199219, 2954.8071289062, 2216.1052246094, 1969.8714599609, 1969.8714599609 } });
-  returning.emplace(575, Rand_prop_point{ 575, 1769.1365966797, 1491.2335205078, { 3976.6228027344, 2982.4670410156, 2236.8503417969, 1988.3114013672, 1988.3114013672 } });
-  returning.emplace(576, Rand_prop_point{ 576, 1777.3977050781, 1505.1929931641, { 4013.8479003906, 3010.3859863281, 2257.7895507812, 2006.9239501953, 2006.9239501953 } });
-  returning.emplace(577, Rand_prop_point{ 577, 1785.6975097656, 1519.2830810547, { 4051.4216308594, 3038.5661621094, 2278.9245605469, 2025.7108154297, 2025.7108154297 } });
-  returning.emplace(578, Rand_prop_point{ 578, 1794.0360107422, 1533.5051269531, { 4089.3469238281, 3067.0102539062, 2300.2575683594, 2044.6734619141, 2044.6734619141 } });
-  returning.emplace(579, Rand_prop_point{ 579, 1802.4134521484, 1547.8602294922, { 4127.6274414062, 3095.7204589844, 2321.7905273438, 2063.8137207031, 2063.8137207031 } });
-  returning.emplace(580, Rand_prop_point{ 580, 1810.8299560547, 1562.3498535156, { 4166.2661132812, 3124.6997070312, 2343.5246582031, 2083.1330566406, 2083.1330566406 } });
-  returning.emplace(581, Rand_prop_point{ 581, 1819.2858886719, 1576.9749755859, { 4205.2666015625, 3153.9499511719, 2365.4624023438, 2102.6333007812, 2102.6333007812 } });
-  returning.emplace(582, Rand_prop_point{ 582, 1827.7811279297, 1591.7370605469, { 4244.6323242188, 3183.4741210938, 2387.60546875, 2122.3161621094, 2122.3161621094 } });
-  returning.emplace(583, Rand_prop_point{ 583, 1836.3161621094, 1606.6373291016, { 4284.3662109375, 3213.2746582031, 2409.9560546875, 2142.1831054688, 2142.1831054688 } });
-  returning.emplace(584, Rand_prop_point{ 584, 1844.8909912109, 1621.6770019531, { 4324.4721679688, 3243.3540039062, 2432.515625, 2162.2360839844, 2162.2360839844 } });
-  returning.emplace(585, Rand_prop_point{ 585, 1853.5059814453, 1636.8575439453, { 4364.9536132812, 3273.7150878906, 2455.2863769531, 2182.4768066406, 2182.4768066406 } });
-  returning.emplace(586, Rand_prop_point{ 586, 1862.1610107422, 1652.1801757812, { 4405.8139648438, 3304.3603515625, 2478.2702636719, 2202.9069824219, 2202.9069824219 } });
-  returning.emplace(587, Rand_prop_point{ 587, 1870.8565673828, 1667.6462402344, { 4447.056640625, 3335.2924804688, 2501.4694824219, 2223.5283203125, 2223.5283203125 } });
-  returning.emplace(588, Rand_prop_point{ 588, 1879.5927734375, 1683.2570800781, { 4488.685546875, 3366.5141601562, 2524.8857421875, 2244.3427734375, 2244.3427734375 } });
-  returning.emplace(589, Rand_prop_point{ 589, 1888.3697509766, 1699.0140380859, { 4530.7041015625, 3398.0280761719, 2548.5212402344, 2265.3520507812, 2265.3520507812 } });
-  returning.emplace(590, Rand_prop_point{ 590, 1897.1876220703, 1714.9185791016, { 4573.1162109375, 3429.8371582031, 2572.3779296875, 2286.5581054688, 2286.5581054688 } });
-  returning.emplace(591, Rand_prop_point{ 591, 1906.0467529297, 1730.9719238281, { 4615.9252929688, 3461.9438476562, 2596.4580078125, 2307.9626464844, 2307.9626464844 } });
-  returning.emplace(592, Rand_prop_point{ 592, 1914.947265625, 1747.1755371094, { 4659.134765625, 3494.3510742188, 2620.7634277344, 2329.5673828125, 2329.5673828125 } });
-  returning.emplace(593, Rand_prop_point{ 593, 1923.8892822266, 1763.5308837891, { 4702.7490234375, 3527.0617675781, 2645.2963867188, 2351.3745117188, 2351.3745117188 } });
-  returning.emplace(594, Rand_prop_point{ 594, 1932.873046875, 1780.0393066406, { 4746.771484375, 3560.0786132812, 2670.0590820312, 2373.3857421875, 2373.3857421875 } });
-  returning.emplace(595, Rand_prop_point{ 595, 1941.8988037109, 1796.7022705078, { 4791.2060546875, 3593.4045410156, 2695.0534667969, 2395.6030273438, 2395.6030273438 } });
-  returning.emplace(596, Rand_prop_point{ 596, 1950.9666748047, 1813.5212402344, { 4836.056640625, 3627.0424804688, 2720.2817382812, 2418.0283203125, 2418.0283203125 } });
-  returning.emplace(597, Rand_prop_point{ 597, 1960.0769042969, 1830.4975585938, { 4881.3271484375, 3660.9951171875, 2745.7463378906, 2440.6635742188, 2440.6635742188 } });
-  returning.emplace(598, Rand_prop_point{ 598, 1969.2297363281, 1847.6329345703, { 4927.0209960938, 3695.2658691406, 2771.44921875, 2463.5104980469, 2463.5104980469 } });
-  returning.emplace(599, Rand_prop_point{ 599, 1978.4251708984, 1864.9285888672, { 4973.1430664062, 3729.8571777344, 2797.3928222656, 2486.5715332031, 2486.5715332031 } });
-  returning.emplace(600, Rand_prop_point{ 600, 1987.6636962891, 1882.3862304688, { 5019.6967773438, 3764.7724609375, 2823.5793457031, 2509.8483886719, 2509.8483886719 } });
-  returning.emplace(601, Rand_prop_point{ 601, 1996.9453125, 1900.0072021484, { 5066.6860351562, 3800.0144042969, 2850.0107421875, 2533.3430175781, 2533.3430175781 } });
-  returning.emplace(602, Rand_prop_point{ 602, 2006.2702636719, 1917.7932128906, { 5114.115234375, 3835.5864257812, 2876.6896972656, 2557.0576171875, 2557.0576171875 } });
-  returning.emplace(603, Rand_prop_point{ 603, 2015.638671875, 1935.7457275391, { 5161.98828125, 3871.4914550781, 2903.6184082031, 2580.994140625, 2580.994140625 } });
-  returning.emplace(604, Rand_prop_point{ 604, 2025.0509033203, 1953.8662109375, { 5210.3100585938, 3907.732421875, 2930.7993164062, 2605.1550292969, 2605.1550292969 } });
-  returning.emplace(605, Rand_prop_point{ 605, 2034.5070800781, 1972.1563720703, { 5259.0834960938, 3944.3127441406, 2958.2346191406, 2629.5417480469, 2629.5417480469 } });
-  returning.emplace(606, Rand_prop_point{ 606, 2044.0074462891, 1990.6176757812, { 5308.3139648438, 3981.2353515625, 2985.9265136719, 2654.1569824219, 2654.1569824219 } });
-  returning.emplace(607, Rand_prop_point{ 607, 2053.5522460938, 2009.251953125, { 5358.0048828125, 4018.50390625, 3013.8779296875, 2679.0024414062, 2679.0024414062 } });
-  returning.emplace(608, Rand_prop_point{ 608, 2063.1413574219, 2028.060546875, { 5408.1616210938, 4056.12109375, 3042.0908203125, 2704.0808105469, 2704.0808105469 } });
-  returning.emplace(609, Rand_prop_point{ 609, 2072.775390625, 2047.0451660156, { 5458.787109375, 4094.0903320312, 3070.5678710938, 2729.3935546875, 2729.3935546875 } });
-  returning.emplace(610, Rand_prop_point{ 610, 2082.4545898438, 2066.2075195312, { 5509.8872070312, 4132.4150390625, 3099.3115234375, 2754.9436035156, 2754.9436035156 } });
-  returning.emplace(611, Rand_prop_point{ 611, 2092.1787109375, 2085.5493164062, { 5561.46484375, 4171.0986328125, 3128.3239746094, 2780.732421875, 2780.732421875 } });
-  returning.emplace(612, Rand_prop_point{ 612, 2105.072265625, 2105.072265625, { 5613.5258789062, 4210.14453125, 3157.6083984375, 2806.7629394531, 2806.7629394531 } });
-  returning.emplace(613, Rand_prop_point{ 613, 2124.7778320312, 2124.7778320312, { 5666.07421875, 4249.5556640625, 3187.1667480469, 2833.037109375, 2833.037109375 } });
-  returning.emplace(614, Rand_prop_point{ 614, 2144.66796875, 2144.66796875, { 5719.1142578125, 4289.3359375, 3217.0017089844, 2859.5571289062, 2859.5571289062 } });
-  returning.emplace(615, Rand_prop_point{ 615, 2164.744140625, 2164.744140625, { 5772.6508789062, 4329.48828125, 3247.1162109375, 2886.3254394531, 2886.3254394531 } });
-  returning.emplace(616, Rand_prop_point{ 616, 2185.0083007812, 2185.0083007812, { 5826.6889648438, 4370.0166015625, 3277.5124511719, 2913.3444824219, 2913.3444824219 } });
-  returning.emplace(617, Rand_prop_point{ 617, 2205.4621582031, 2205.4621582031, { 5881.232421875, 4410.9243164062, 3308.193359375, 2940.6162109375, 2940.6162109375 } });
-  returning.emplace(618, Rand_prop_point{ 618, 2226.107421875, 2226.107421875, { 5936.2866210938, 4452.21484375, 3339.1613769531, 2968.1433105469, 2968.1433105469 } });
-  returning.emplace(619, Rand_prop_point{ 619, 2246.9460449219, 2246.9460449219, { 5991.8564453125, 4493.8920898438, 3370.4191894531, 2995.9282226562, 2995.9282226562 } });
-  returning.emplace(620, Rand_prop_point{ 620, 2267.9797363281, 2267.9797363281, { 6047.9462890625, 4535.9594726562, 3401.9697265625, 3023.9731445312, 3023.9731445312 } });
-  returning.emplace(621, Rand_prop_point{ 621, 2289.2104492188, 2289.2104492188, { 6104.5610351562, 4578.4208984375, 3433.8156738281, 3052.2805175781, 3052.2805175781 } });
-  returning.emplace(622, Rand_prop_point{ 622, 2310.6396484375, 2310.6396484375, { 6161.7060546875, 4621.279296875, 3465.9594726562, 3080.8530273438, 3080.8530273438 } });
-  returning.emplace(623, Rand_prop_point{ 623, 2332.26953125, 2332.26953125, { 6219.3857421875, 4664.5390625, 3498.404296875, 3109.6928710938, 3109.6928710938 } });
-  returning.emplace(624, Rand_prop_point{ 624, 2354.1020507812, 2354.1020507812, { 6277.60546875, 4708.2041015625, 3531.1530761719, 3138.802734375, 3138.802734375 } });
-  returning.emplace(625, Rand_prop_point{ 625, 2376.138671875, 2376.138671875, { 6336.3701171875, 4752.27734375, 3564.2082519531, 3168.1850585938, 3168.1850585938 } });
-  returning.emplace(626, Rand_prop_point{ 626, 2398.3818359375, 2398.3818359375, { 6395.6845703125, 4796.763671875, 3597.5727539062, 3197.8422851562, 3197.8422851562 } });
-  returning.emplace(627, Rand_prop_point{ 627, 2420.8330078125, 2420.8330078125, { 6455.5546875, 4841.666015625, 3631.2495117188, 3227.77734375, 3227.77734375 } });
-  returning.emplace(628, Rand_prop_point{ 628, 2443.4943847656, 2443.4943847656, { 6515.9853515625, 4886.9887695312, 3665.2416992188, 3257.9926757812, 3257.9926757812 } });
-  returning.emplace(629, Rand_prop_point{ 629, 2466.3681640625, 2466.3681640625, { 6576.9814453125, 4932.736328125, 3699.5520019531, 3288.4907226562, 3288.4907226562 } });
-  returning.emplace(630, Rand_prop_point{ 630, 2489.4558105469, 2489.4558105469, { 6638.548828125, 4978.9116210938, 3734.18359375, 3319.2744140625, 3319.2744140625 } });
-  returning.emplace(631, Rand_prop_point{ 631, 2512.7595214844, 2512.7595214844, { 6700.6923828125, 5025.5190429688, 3769.1394042969, 3350.3461914062, 3350.3461914062 } });
-  returning.emplace(632, Rand_prop_point{ 632, 2536.2814941406, 2536.2814941406, { 6763.4174804688, 5072.5629882812, 3804.4223632812, 3381.7087402344, 3381.7087402344 } });
-  returning.emplace(633, Rand_prop_point{ 633, 2560.0236816406, 2560.0236816406, { 6826.7299804688, 5120.0473632812, 3840.0354003906, 3413.3649902344, 3413.3649902344 } });
-  returning.emplace(634, Rand_prop_point{ 634, 2583.9880371094, 2583.9880371094, { 6890.634765625, 5167.9760742188, 3875.9821777344, 3445.3173828125, 3445.3173828125 } });
-  returning.emplace(635, Rand_prop_point{ 635, 2608.1767578125, 2608.1767578125, { 6955.1381835938, 5216.353515625, 3912.2651367188, 3477.5690917969, 3477.5690917969 } });
-  returning.emplace(636, Rand_prop_point{ 636, 2632.5920410156, 2632.5920410156, { 7020.2451171875, 5265.1840820312, 3948.8879394531, 3510.1225585938, 3510.1225585938 } });
-  returning.emplace(637, Rand_prop_point{ 637, 2657.2355957031, 2657.2355957031, { 7085.9619140625, 5314.4711914062, 3985.853515625, 3542.9809570312, 3542.9809570312 } });
-  returning.emplace(638, Rand_prop_point{ 638, 2682.1101074219, 2682.1101074219, { 7152.2934570312, 5364.2202148438, 4023.1650390625, 3576.1467285156, 3576.1467285156 } });
-  returning.emplace(639, Rand_prop_point{ 639, 2707.2172851562, 2707.2172851562, { 7219.24609375, 5414.4345703125, 4060.8259277344, 3609.623046875, 3609.623046875 } });
-  returning.emplace(640, Rand_prop_point{ 640, 2732.5595703125, 2732.5595703125, { 7286.8256835938, 5465.119140625, 4098.8393554688, 3643.4128417969, 3643.4128417969 } });
-  returning.emplace(641, Rand_prop_point{ 641, 2758.1391601562, 2758.1391601562, { 7355.0375976562, 5516.2783203125, 4137.2084960938, 3677.5187988281, 3677.5187988281 } });
-  returning.emplace(642, Rand_prop_point{ 642, 2783.9580078125, 2783.9580078125, { 7423.8881835938, 5567.916015625, 4175.9370117188, 3711.9440917969, 3711.9440917969 } });
-  returning.emplace(643, Rand_prop_point{ 643, 2810.0185546875, 2810.0185546875, { 7493.3833007812, 5620.037109375, 4215.0278320312, 3746.6916503906, 3746.6916503906 } });
-  returning.emplace(644, Rand_prop_point{ 644, 2836.3232421875, 2836.3232421875, { 7563.5288085938, 5672.646484375, 4254.4848632812, 3781.7644042969, 3781.7644042969 } });
-  returning.emplace(645, Rand_prop_point{ 645, 2862.8740234375, 2862.8740234375, { 7634.3310546875, 5725.748046875, 4294.3110351562, 3817.1655273438, 3817.1655273438 } });
-  returning.emplace(646, Rand_prop_point{ 646, 2889.6735839844, 2889.6735839844, { 7705.7958984375, 5779.3471679688, 4334.5102539062, 3852.8979492188, 3852.8979492188 } });
-  returning.emplace(647, Rand_prop_point{ 647, 2916.7236328125, 2916.7236328125, { 7777.9301757812, 5833.447265625, 4375.0854492188, 3888.9650878906, 3888.9650878906 } });
-  returning.emplace(648, Rand_prop_point{ 648, 2944.0270996094, 2944.0270996094, { 7850.7392578125, 5888.0541992188, 4416.041015625, 3925.3696289062, 3925.3696289062 } });
-  returning.emplace(649, Rand_prop_point{ 649, 2971.5861816406, 2971.5861816406, { 7924.2299804688, 5943.1723632812, 4457.3793945312, 3962.1149902344, 3962.1149902344 } });
-  returning.emplace(650, Rand_prop_point{ 650, 2999.4033203125, 2999.4033203125, { 7998.4086914062, 5998.806640625, 4499.1049804688, 3999.2043457031, 3999.2043457031 } });
-  returning.emplace(651, Rand_prop_point{ 651, 3027.4807128906, 3027.4807128906, { 8073.2817382812, 6054.9614257812, 4541.2211914062, 4036.6408691406, 4036.6408691406 } });
-  returning.emplace(652, Rand_prop_point{ 652, 3055.8210449219, 3055.8210449219, { 8148.8559570312, 6111.6420898438, 4583.7314453125, 4074.4279785156, 4074.4279785156 } });
-  returning.emplace(653, Rand_prop_point{ 653, 3084.4265136719, 3084.4265136719, { 8225.1376953125, 6168.8530273438, 4626.6396484375, 4112.5688476562, 4112.5688476562 } });
-  returning.emplace(654, Rand_prop_point{ 654, 3113.2998046875, 3113.2998046875, { 8302.1328125, 6226.599609375, 4669.9497070312, 4151.06640625, 4151.06640625 } });
-  returning.emplace(655, Rand_prop_point{ 655, 3142.4436035156, 3142.4436035156, { 8379.849609375, 6284.8872070312, 4713.6650390625, 4189.9248046875, 4189.9248046875 } });
-  returning.emplace(656, Rand_prop_point{ 656, 3171.8598632812, 3171.8598632812, { 8458.29296875, 6343.7197265625, 4757.7900390625, 4229.146484375, 4229.146484375 } });
-  returning.emplace(657, Rand_prop_point{ 657, 3201.5517578125, 3201.5517578125, { 8537.4716796875, 6403.103515625, 4802.3276367188, 4268.7358398438, 4268.7358398438 } });
-  returning.emplace(658, Rand_prop_point{ 658, 3231.521484375, 3231.521484375, { 8617.390625, 6463.04296875, 4847.2822265625, 4308.6953125, 4308.6953125 } });
-  returning.emplace(659, Rand_prop_point{ 659, 3261.7717285156, 3261.7717285156, { 8698.0576171875, 6523.5434570312, 4892.6577148438, 4349.0288085938, 4349.0288085938 } });
-  returning.emplace(660, Rand_prop_point{ 660, 3292.3051757812, 3292.3051757812, { 8779.48046875, 6584.6103515625, 4938.4580078125, 4389.740234375, 4389.740234375 } });
-  returning.emplace(661, Rand_prop_point{ 661, 3323.1245117188, 3323.1245117188, { 8861.6650390625, 6646.2490234375, 4984.6870117188, 4430.8325195312, 4430.8325195312 } });
-  returning.emplace(662, Rand_prop_point{ 662, 3354.232421875, 3354.232421875, { 8944.619140625, 6708.46484375, 5031.3486328125, 4472.3095703125, 4472.3095703125 } });
-  returning.emplace(663, Rand_prop_point{ 663, 3385.6313476562, 3385.6313476562, { 9028.3505859375, 6771.2626953125, 5078.4467773438, 4514.1752929688, 4514.1752929688 } });
-  returning.emplace(664, Rand_prop_point{ 664, 3417.32421875, 3417.32421875, { 9112.8642578125, 6834.6484375, 5125.986328125, 4556.4321289062, 4556.4321289062 } });
-  returning.emplace(665, Rand_prop_point{ 665, 3449.3137207031, 3449.3137207031, { 9198.169921875, 6898.6274414062, 5173.970703125, 4599.0849609375, 4599.0849609375 } });
-  returning.emplace(666, Rand_prop_point{ 666, 3481.6027832031, 3481.6027832031, { 9284.2744140625, 6963.2055664062, 5222.404296875, 4642.1372070312, 4642.1372070312 } });
-  returning.emplace(667, Rand_prop_point{ 667, 3514.1940917969, 3514.1940917969, { 9371.1845703125, 7028.3881835938, 5271.291015625, 4685.5922851562, 4685.5922851562 } });
-  returning.emplace(668, Rand_prop_point{ 668, 3547.0905761719, 3547.0905761719, { 9458.908203125, 7094.1811523438, 5320.6357421875, 4729.4541015625, 4729.4541015625 } });
-  returning.emplace(669, Rand_prop_point{ 669, 3580.294921875, 3580.294921875, { 9547.453125, 7160.58984375, 5370.4423828125, 4773.7265625, 4773.7265625 } });
-  returning.emplace(670, Rand_prop_point{ 670, 3613.8100585938, 3613.8100585938, { 9636.8271484375, 7227.6201171875, 5420.71484375, 4818.4135742188, 4818.4135742188 } });
-  returning.emplace(671, Rand_prop_point{ 671, 3647.6389160156, 3647.6389160156, { 9727.037109375, 7295.2778320312, 5471.4584960938, 4863.5185546875, 4863.5185546875 } });
-  returning.emplace(672, Rand_prop_point{ 672, 3681.7844238281, 3681.7844238281, { 9818.091796875, 7363.5688476562, 5522.6767578125, 4909.0458984375, 4909.0458984375 } });
-  returning.emplace(673, Rand_prop_point{ 673, 3716.2497558594, 3716.2497558594, { 9909.9990234375, 7432.4995117188, 5574.3745117188, 4954.9995117188, 4954.9995117188 } });
-  returning.emplace(674, Rand_prop_point{ 674, 3751.0375976562, 3751.0375976562, { 10002.766601562, 7502.0751953125, 5626.5561523438, 5001.3833007812, 5001.3833007812 } });
-  returning.emplace(675, Rand_prop_point{ 675, 3786.1511230469, 3786.1511230469, { 10096.40234375, 7572.3022460938, 5679.2265625, 5048.201171875, 5048.201171875 } });
-  returning.emplace(676, Rand_prop_point{ 676, 3821.5932617188, 3821.5932617188, { 10190.915039062, 7643.1865234375, 5732.3896484375, 5095.4575195312, 5095.4575195312 } });
-  returning.emplace(677, Rand_prop_point{ 677, 3857.3671875, 3857.3671875, { 10286.313476562, 7714.734375, 5786.05078125, 5143.15625, 5143.15625 } });
-  returning.emplace(678, Rand_prop_point{ 678, 3893.4760742188, 3893.4760742188, { 10382.602539062, 7786.9521484375, 5840.2138671875, 5191.3012695312, 5191.3012695312 } });
-  returning.emplace(679, Rand_prop_point{ 679, 3929.9228515625, 3929.9228515625, { 10479.793945312, 7859.845703125, 5894.8842773438, 5239.8969726562, 5239.8969726562 } });
-  returning.emplace(680, Rand_prop_point{ 680, 3966.7109375, 3966.7109375, { 10577.896484375, 7933.421875, 5950.06640625, 5288.9477539062, 5288.9477539062 } });
-  returning.emplace(681, Rand_prop_point{ 681, 4003.8432617188, 4003.8432617188, { 10676.915039062, 8007.6865234375, 6005.7651367188, 5338.4575195312, 5338.4575195312 } });
-  returning.emplace(682, Rand_prop_point{ 682, 4041.3232421875, 4041.3232421875, { 10776.862304688, 8082.646484375, 6061.9848632812, 5388.4311523438, 5388.4311523438 } });
-  returning.emplace(683, Rand_prop_point{ 683, 4079.1540527344, 4079.1540527344, { 10877.744140625, 8158.3081054688, 6118.7309570312, 5438.8720703125, 5438.8720703125 } });
-  returning.emplace(684, Rand_prop_point{ 684, 4117.3388671875, 4117.3388671875, { 10979.571289062, 8234.677734375, 6176.0087890625, 5489.7856445312, 5489.7856445312 } });
-  returning.emplace(685, Rand_prop_point{ 685, 4155.8813476562, 4155.8813476562, { 11082.350585938, 8311.7626953125, 6233.822265625, 5541.1752929688, 5541.1752929688 } });
-  returning.emplace(686, Rand_prop_point{ 686, 4194.7846679688, 4194.7846679688, { 11186.092773438, 8389.5693359375, 6292.1772460938, 5593.0463867188, 5593.0463867188 } });
-  returning.emplace(687, Rand_prop_point{ 687, 4234.0522460938, 4234.0522460938, { 11290.805664062, 8468.1044921875, 6351.078125, 5645.4028320312, 5645.4028320312 } });
-  returning.emplace(688, Rand_prop_point{ 688, 4273.6870117188, 4273.6870117188, { 11396.499023438, 8547.3740234375, 6410.5307617188, 5698.2495117188, 5698.2495117188 } });
-  returning.emplace(689, Rand_prop_point{ 689, 4313.693359375, 4313.693359375, { 11503.181640625, 8627.38671875, 6470.5395507812, 5751.5908203125, 5751.5908203125 } });
-  returning.emplace(690, Rand_prop_point{ 690, 4354.0737304688, 4354.0737304688, { 11610.86328125, 8708.1474609375, 6531.1103515625, 5805.431640625, 5805.431640625 } });
-  returning.emplace(691, Rand_prop_point{ 691, 4394.83203125, 4394.83203125, { 11719.552734375, 8789.6640625, 6592.248046875, 5859.7763671875, 5859.7763671875 } });
-  returning.emplace(692, Rand_prop_point{ 692, 4435.9721679688, 4435.9721679688, { 11829.258789062, 8871.9443359375, 6653.9584960938, 5914.6293945312, 5914.6293945312 } });
-  returning.emplace(693, Rand_prop_point{ 693, 4477.4975585938, 4477.4975585938, { 11939.993164062, 8954.9951171875, 6716.24609375, 5969.9965820312, 5969.9965820312 } });
-  returning.emplace(694, Rand_prop_point{ 694, 4519.4111328125, 4519.4111328125, { 12051.763671875, 9038.822265625, 6779.1166992188, 6025.8818359375, 6025.8818359375 } });
-  returning.emplace(695, Rand_prop_point{ 695, 4561.7172851562, 4561.7172851562, { 12164.580078125, 9123.4345703125, 6842.576171875, 6082.2900390625, 6082.2900390625 } });
-  returning.emplace(696, Rand_prop_point{ 696, 4604.419921875, 4604.419921875, { 12278.453125, 9208.83984375, 6906.6293945312, 6139.2265625, 6139.2265625 } });
-  returning.emplace(697, Rand_prop_point{ 697, 4647.5219726562, 4647.5219726562, { 12393.391601562, 9295.0439453125, 6971.2827148438, 6196.6958007812, 6196.6958007812 } });
-  returning.emplace(698, Rand_prop_point{ 698, 4691.02734375, 4691.02734375, { 12509.40625, 9382.0546875, 7036.541015625, 6254.703125, 6254.703125 } });
-  returning.emplace(699, Rand_prop_point{ 699, 4734.9399414062, 4734.9399414062, { 12626.506835938, 9469.8798828125, 7102.41015625, 6313.2534179688, 6313.2534179688 } });
-  returning.emplace(700, Rand_prop_point{ 700, 4779.263671875, 4779.263671875, { 12744.703125, 9558.52734375, 7168.8955078125, 6372.3515625, 6372.3515625 } });
-  returning.emplace(701, Rand_prop_point{ 701, 4824.0024414062, 4824.0024414062, { 12864.006835938, 9648.0048828125, 7236.00390625, 6432.0034179688, 6432.0034179688 } });
-  returning.emplace(702, Rand_prop_point{ 702, 4869.16015625, 4869.16015625, { 12984.426757812, 9738.3203125, 7303.7397460938, 6492.2133789062, 6492.2133789062 } });
-  returning.emplace(703, Rand_prop_point{ 703, 4914.740234375, 4914.740234375, { 13105.973632812, 9829.48046875, 7372.1103515625, 6552.9868164062, 6552.9868164062 } });
-  returning.emplace(704, Rand_prop_point{ 704, 4960.7470703125, 4960.7470703125, { 13228.659179688, 9921.494140625, 7441.1206054688, 6614.3295898438, 6614.3295898438 } });
-  returning.emplace(705, Rand_prop_point{ 705, 5007.1845703125, 5007.1845703125, { 13352.4921875, 10014.369140625, 7510.7768554688, 6676.24609375, 6676.24609375 } });
-  returning.emplace(706, Rand_prop_point{ 706, 5054.0571289062, 5054.0571289062, { 13477.485351562, 10108.114257812, 7581.0854492188, 6738.7426757812, 6738.7426757812 } });
-  returning.emplace(707, Rand_prop_point{ 707, 5101.3681640625, 5101.3681640625, { 13603.6484375, 10202.736328125, 7652.0522460938, 6801.82421875, 6801.82421875 } });
-  returning.emplace(708, Rand_prop_point{ 708, 5149.1220703125, 5149.1220703125, { 13730.9921875, 10298.244140625, 7723.6831054688, 6865.49609375, 6865.49609375 } });
-  returning.emplace(709, Rand_prop_point{ 709, 5197.3227539062, 5197.3227539062, { 13859.528320312, 10394.646484375, 7795.984375, 6929.7641601562, 6929.7641601562 } });
-  returning.emplace(710, Rand_prop_point{ 710, 5245.9750976562, 5245.9750976562, { 13989.266601562, 10491.950195312, 7868.962890625, 6994.6333007812, 6994.6333007812 } });
-  returning.emplace(711, Rand_prop_point{ 711, 5295.0825195312, 5295.0825195312, { 14120.220703125, 10590.165039062, 7942.6240234375, 7060.1103515625, 7060.1103515625 } });
-  returning.emplace(712, Rand_prop_point{ 712, 5344.6499023438, 5344.6499023438, { 14252.400390625, 10689.299804688, 8016.9750976562, 7126.2001953125, 7126.2001953125 } });
-  returning.emplace(713, Rand_prop_point{ 713, 5394.6811523438, 5394.6811523438, { 14385.81640625, 10789.362304688, 8092.0219726562, 7192.908203125, 7192.908203125 } });
-  returning.emplace(714, Rand_prop_point{ 714, 5445.1811523438, 5445.1811523438, { 14520.482421875, 10890.362304688, 8167.771484375, 7260.2412109375, 7260.2412109375 } });
-  returning.emplace(715, Rand_prop_point{ 715, 5496.1533203125, 5496.1533203125, { 14656.409179688, 10992.306640625, 8244.23046875, 7328.2045898438, 7328.2045898438 } });
-  returning.emplace(716, Rand_prop_point{ 716, 5547.6030273438, 5547.6030273438, { 14793.607421875, 11095.206054688, 8321.404296875, 7396.8037109375, 7396.8037109375 } });
-  returning.emplace(717, Rand_prop_point{ 717, 5599.5341796875, 5599.5341796875, { 14932.090820312, 11199.068359375, 8399.30078125, 7466.0454101562, 7466.0454101562 } });
-  returning.emplace(718, Rand_prop_point{ 718, 5651.951171875, 5651.951171875, { 15071.870117188, 11303.90234375, 8477.9267578125, 7535.9350585938, 7535.9350585938 } });
-  returning.emplace(719, Rand_prop_point{ 719, 5704.859375, 5704.859375, { 15212.958007812, 11409.71875, 8557.2890625, 7606.4790039062, 7606.4790039062 } });
-  returning.emplace(720, Rand_prop_point{ 720, 5758.2622070312, 5758.2622070312, { 15355.366210938, 11516.524414062, 8637.3935546875, 7677.6831054688, 7677.6831054688 } });
-  returning.emplace(721, Rand_prop_point{ 721, 5812.1655273438, 5812.1655273438, { 15499.108398438, 11624.331054688, 8718.248046875, 7749.5541992188, 7749.5541992188 } });
-  returning.emplace(722, Rand_prop_point{ 722, 5866.5732421875, 5866.5732421875, { 15644.1953125, 11733.146484375, 8799.8603515625, 7822.09765625, 7822.09765625 } });
-  returning.emplace(723, Rand_prop_point{ 723, 5921.490234375, 5921.490234375, { 15790.640625, 11842.98046875, 8882.2353515625, 7895.3203125, 7895.3203125 } });
-  returning.emplace(724, Rand_prop_point{ 724, 5976.9213867188, 5976.9213867188, { 15938.45703125, 11953.842773438, 8965.3818359375, 7969.228515625, 7969.228515625 } });
-  returning.emplace(725, Rand_prop_point{ 725, 6032.8715820312, 6032.8715820312, { 16087.657226562, 12065.743164062, 9049.306640625, 8043.8286132812, 8043.8286132812 } });
-  returning.emplace(726, Rand_prop_point{ 726, 6089.3452148438, 6089.3452148438, { 16238.25390625, 12178.690429688, 9134.017578125, 8119.126953125, 8119.126953125 } });
-  returning.emplace(727, Rand_prop_point{ 727, 6146.34765625, 6146.34765625, { 16390.259765625, 12292.6953125, 9219.521484375, 8195.1298828125, 8195.1298828125 } });
-  returning.emplace(728, Rand_prop_point{ 728, 6203.8833007812, 6203.8833007812, { 16543.689453125, 12407.766601562, 9305.8251953125, 8271.8447265625, 8271.8447265625 } });
-  returning.emplace(729, Rand_prop_point{ 729, 6261.9580078125, 6261.9580078125, { 16698.5546875, 12523.916015625, 9392.9375, 8349.27734375, 8349.27734375 } });
-  returning.emplace(730, Rand_prop_point{ 730, 6320.576171875, 6320.576171875, { 16854.87109375, 12641.15234375, 9480.8642578125, 8427.435546875, 8427.435546875 } });
-  returning.emplace(731, Rand_prop_point{ 731, 6379.7431640625, 6379.7431640625, { 17012.6484375, 12759.486328125, 9569.615234375, 8506.32421875, 8506.32421875 } });
-  returning.emplace(732, Rand_prop_point{ 732, 6439.4638671875, 6439.4638671875, { 17171.904296875, 12878.927734375, 9659.1962890625, 8585.9521484375, 8585.9521484375 } });
-  returning.emplace(733, Rand_prop_point{ 733, 6499.744140625, 6499.744140625, { 17332.650390625, 12999.48828125, 9749.6162109375, 8666.3251953125, 8666.3251953125 } });
-  returning.emplace(734, Rand_prop_point{ 734, 6560.587890625, 6560.587890625, { 17494.90234375, 13121.17578125, 9840.8818359375, 8747.451171875, 8747.451171875 } });
-  returning.emplace(735, Rand_prop_point{ 735, 6622.001953125, 6622.001953125, { 17658.671875, 13244.00390625, 9933.0029296875, 8829.3359375, 8829.3359375 } });
-  returning.emplace(736, Rand_prop_point{ 736, 6683.990234375, 6683.990234375, { 17823.974609375, 13367.98046875, 10025.985351562, 8911.9873046875, 8911.9873046875 } });
-  returning.emplace(737, Rand_prop_point{ 737, 6746.5590820312, 6746.5590820312, { 17990.82421875, 13493.118164062, 10119.838867188, 8995.412109375, 8995.412109375 } });
-  returning.emplace(738, Rand_prop_point{ 738, 6809.7138671875, 6809.7138671875, { 18159.236328125, 13619.427734375, 10214.5703125, 9079.6181640625, 9079.6181640625 } });
-  returning.emplace(739, Rand_prop_point{ 739, 6873.4594726562, 6873.4594726562, { 18329.2265625, 13746.918945312, 10310.189453125, 9164.61328125, 9164.61328125 } });
-  returning.emplace(740, Rand_prop_point{ 740, 6937.8022460938, 6937.8022460938, { 18500.8046875, 13875.603515625, 10406.703125, 9250.40234375, 9250.40234375 } });
-  returning.emplace(741, Rand_prop_point{ 741, 7002.7470703125, 7002.7470703125, { 18673.9921875, 14005.494140625, 10504.120117188, 9336.99609375, 9336.99609375 } });
-  returning.emplace(742, Rand_prop_point{ 742, 7068.2998046875, 7068.2998046875, { 18848.798828125, 14136.599609375, 10602.44921875, 9424.3994140625, 9424.3994140625 } });
-  returning.emplace(743, Rand_prop_point{ 743, 7134.4658203125, 7134.4658203125, { 19025.2421875, 14268.931640625, 10701.69921875, 9512.62109375, 9512.62109375 } });
-  returning.emplace(744, Rand_prop_point{ 744, 7201.251953125, 7201.251953125, { 19203.337890625, 14402.50390625, 10801.877929688, 9601.6689453125, 9601.6689453125 } });
-  returning.emplace(745, Rand_prop_point{ 745, 7268.6625976562, 7268.6625976562, { 19383.1015625, 14537.325195312, 10902.994140625, 9691.55078125, 9691.55078125 } });
-  returning.emplace(746, Rand_prop_point{ 746, 7336.7045898438, 7336.7045898438, { 19564.546875, 14673.409179688, 11005.057617188, 9782.2734375, 9782.2734375 } });
-  returning.emplace(747, Rand_prop_point{ 747, 7405.3837890625, 7405.3837890625, { 19747.689453125, 14810.767578125, 11108.075195312, 9873.8447265625, 9873.8447265625 } });
-  returning.emplace(748, Rand_prop_point{ 748, 7474.7055664062, 7474.7055664062, { 19932.548828125, 14949.411132812, 11212.05859375, 9966.2744140625, 9966.2744140625 } });
-  returning.emplace(749, Rand_prop_point{ 749, 7544.6762695312, 7544.6762695312, { 20119.13671875, 15089.352539062, 11317.014648438, 10059.568359375, 10059.568359375 } });
-  returning.emplace(750, Rand_prop_point{ 750, 7615.3022460938, 7615.3022460938, { 20307.47265625, 15230.603515625, 11422.953125, 10153.736328125, 10153.736328125 } });
-  returning.emplace(751, Rand_prop_point{ 751, 7686.5888671875, 7686.5888671875, { 20497.5703125, 15373.177734375, 11529.883789062, 10248.78515625, 10248.78515625 } });
-  returning.emplace(752, Rand_prop_point{ 752, 7758.54296875, 7758.54296875, { 20689.44921875, 15517.0859375, 11637.814453125, 10344.724609375, 10344.724609375 } });
-  returning.emplace(753, Rand_prop_point{ 753, 7831.1708984375, 7831.1708984375, { 20883.123046875, 15662.341796875, 11746.756835938, 10441.561523438, 10441.561523438 } });
-  returning.emplace(754, Rand_prop_point{ 754, 7904.478515625, 7904.478515625, { 21078.609375, 15808.95703125, 11856.717773438, 10539.3046875, 10539.3046875 } });
-  returning.emplace(755, Rand_prop_point{ 755, 7978.4721679688, 7978.4721679688, { 21275.92578125, 15956.944335938, 11967.708984375, 10637.962890625, 10637.962890625 } });
-  returning.emplace(756, Rand_prop_point{ 756, 8053.1586914062, 8053.1586914062, { 21475.08984375, 16106.317382812, 12079.73828125, 10737.544921875, 10737.544921875 } });
-  returning.emplace(757, Rand_prop_point{ 757, 8128.5444335938, 8128.5444335938, { 21676.119140625, 16257.088867188, 12192.817382812, 10838.059570312, 10838.059570312 } });
-  returning.emplace(758, Rand_prop_point{ 758, 8204.6357421875, 8204.6357421875, { 21879.029296875, 16409.271484375, 12306.954101562, 10939.514648438, 10939.514648438 } });
-  returning.emplace(759, Rand_prop_point{ 759, 8281.439453125, 8281.439453125, { 22083.83984375, 16562.87890625, 12422.159179688, 11041.919921875, 11041.919921875 } });
-  returning.emplace(760, Rand_prop_point{ 760, 8358.9619140625, 8358.9619140625, { 22290.56640625, 16717.923828125, 12538.443359375, 11145.283203125, 11145.283203125 } });
-  returning.emplace(761, Rand_prop_point{ 761, 8437.2109375, 8437.2109375, { 22499.228515625, 16874.421875, 12655.815429688, 11249.614257812, 11249.614257812 } });
-  returning.emplace(762, Rand_prop_point{ 762, 8516.19140625, 8516.19140625, { 22709.84375, 17032.3828125, 12774.287109375, 11354.921875, 11354.921875 } });
-  returning.emplace(763, Rand_prop_point{ 763, 8595.9111328125, 8595.9111328125, { 22922.4296875, 17191.822265625, 12893.8671875, 11461.21484375, 11461.21484375 } });
-  returning.emplace(764, Rand_prop_point{ 764, 8676.3779296875, 8676.3779296875, { 23137.0078125, 17352.755859375, 13014.56640625, 11568.50390625, 11568.50390625 } });
-  returning.emplace(765, Rand_prop_point{ 765, 8757.59765625, 8757.59765625, { 23353.59375, 17515.1953125, 13136.396484375, 11676.796875, 11676.796875 } });
-  returning.emplace(766, Rand_prop_point{ 766, 8839.5771484375, 8839.5771484375, { 23572.20703125, 17679.154296875, 13259.366210938, 11786.103515625, 11786.103515625 } });
-  returning.emplace(767, Rand_prop_point{ 767, 8922.32421875, 8922.32421875, { 23792.865234375, 17844.6484375, 13383.487304688, 11896.432617188, 11896.432617188 } });
-  returning.emplace(768, Rand_prop_point{ 768, 9005.8466796875, 9005.8466796875, { 24015.58984375, 18011.693359375, 13508.76953125, 12007.794921875, 12007.794921875 } });
-  returning.emplace(769, Rand_prop_point{ 769, 9090.150390625, 9090.150390625, { 24240.400390625, 18180.30078125, 13635.225585938, 12120.200195312, 12120.200195312 } });
-  returning.emplace(770, Rand_prop_point{ 770, 9175.2431640625, 9175.2431640625, { 24467.314453125, 18350.486328125, 13762.865234375, 12233.657226562, 12233.657226562 } });
-  returning.emplace(771, Rand_prop_point{ 771, 9261.1328125, 9261.1328125, { 24696.353515625, 18522.265625, 13891.69921875, 12348.176757812, 12348.176757812 } });
-  returning.emplace(772, Rand_prop_point{ 772, 9347.826171875, 9347.826171875, { 24927.537109375, 18695.65234375, 14021.739257812, 12463.768554688, 12463.768554688 } });
-  returning.emplace(773, Rand_prop_point{ 773, 9435.3310546875, 9435.3310546875, { 25160.8828125, 18870.662109375, 14152.997070312, 12580.44140625, 12580.44140625 } });
-  returning.emplace(774, Rand_prop_point{ 774, 9523.6552734375, 9523.6552734375, { 25396.4140625, 19047.310546875, 14285.483398438, 12698.20703125, 12698.20703125 } });
-  returning.emplace(775, Rand_prop_point{ 775, 9612.806640625, 9612.806640625, { 25634.150390625, 19225.61328125, 14419.209960938, 12817.075195312, 12817.075195312 } });
-  returning.emplace(776, Rand_prop_point{ 776, 9702.7919921875, 9702.7919921875, { 25874.111328125, 19405.583984375, 14554.188476562, 12937.055664062, 12937.055664062 } });
-  returning.emplace(777, Rand_prop_point{ 777, 9793.6201171875, 9793.6201171875, { 26116.3203125, 19587.240234375, 14690.4296875, 13058.16015625, 13058.16015625 } });
-  returning.emplace(778, Rand_prop_point{ 778, 9885.2978515625, 9885.2978515625, { 26360.794921875, 19770.595703125, 14827.947265625, 13180.397460938, 13180.397460938 } });
-  returning.emplace(779, Rand_prop_point{ 779, 9977.833984375, 9977.833984375, { 26607.55859375, 19955.66796875, 14966.751953125, 13303.779296875, 13303.779296875 } });
-  returning.emplace(780, Rand_prop_point{ 780, 10071.237304688, 10071.237304688, { 26856.6328125, 20142.474609375, 15106.85546875, 13428.31640625, 13428.31640625 } });
-  returning.emplace(781, Rand_prop_point{ 781, 10165.513671875, 10165.513671875, { 27108.037109375, 20331.02734375, 15248.271484375, 13554.018554688, 13554.018554688 } });
-  returning.emplace(782, Rand_prop_point{ 782, 10260.672851562, 10260.672851562, { 27361.794921875, 20521.345703125, 15391.009765625, 13680.897460938, 13680.897460938 } });
-  returning.emplace(783, Rand_prop_point{ 783, 10356.723632812, 10356.723632812, { 27617.9296875, 20713.447265625, 15535.084960938, 13808.96484375, 13808.96484375 } });
-  returning.emplace(784, Rand_prop_point{ 784, 10453.672851562, 10453.672851562, { 27876.4609375, 20907.345703125, 15680.509765625, 13938.23046875, 13938.23046875 } });
-  returning.emplace(785, Rand_prop_point{ 785, 10551.529296875, 10551.529296875, { 28137.412109375, 21103.05859375, 15827.294921875, 14068.706054688, 14068.706054688 } });
-  returning.emplace(786, Rand_prop_point{ 786, 10650.302734375, 10650.302734375, { 28400.806640625, 21300.60546875, 15975.454101562, 14200.403320312, 14200.403320312 } });
-  returning.emplace(787, Rand_prop_point{ 787, 10750, 10750, { 28666.66796875, 21500, 16125, 14333.333984375, 14333.333984375 } });
-  returning.emplace(788, Rand_prop_point{ 788, 10850.630859375, 10850.630859375, { 28935.015625, 21701.26171875, 16275.946289062, 14467.5078125, 14467.5078125 } });
-  returning.emplace(789, Rand_prop_point{ 789, 10952.204101562, 10952.204101562, { 29205.876953125, 21904.408203125, 16428.306640625, 14602.938476562, 14602.938476562 } });
-  returning.emplace(790, Rand_prop_point{ 790, 11054.727539062, 11054.727539062, { 29479.2734375, 22109.455078125, 16582.091796875, 14739.63671875, 14739.63671875 } });
-  returning.emplace(791, Rand_prop_point{ 791, 11158.2109375, 11158.2109375, { 29755.228515625, 22316.421875, 16737.31640625, 14877.614257812, 14877.614257812 } });
-  returning.emplace(792, Rand_prop_point{ 792, 11262.663085938, 11262.663085938, { 30033.767578125, 22525.326171875, 16893.994140625, 15016.883789062, 15016.883789062 } });
-  returning.emplace(793, Rand_prop_point{ 793, 11368.092773438, 11368.092773438, { 30314.9140625, 22736.185546875, 17052.138671875, 15157.45703125, 15157.45703125 } });
-  returning.emplace(794, Rand_prop_point{ 794, 11474.509765625, 11474.509765625, { 30598.69140625, 22949.01953125, 17211.763671875, 15299.345703125, 15299.345703125 } });
-  returning.emplace(795, Rand_prop_point{ 795, 11581.922851562, 11581.922851562, { 30885.126953125, 23163.845703125, 17372.8828125, 15442.563476562, 15442.563476562 } });
-  returning.emplace(796, Rand_prop_point{ 796, 11690.340820312, 11690.340820312, { 31174.2421875, 23380.681640625, 17535.51171875, 15587.12109375, 15587.12109375 } });
-  returning.emplace(797, Rand_prop_point{ 797, 11799.774414062, 11799.774414062, { 31466.064453125, 23599.548828125, 17699.662109375, 15733.032226562, 15733.032226562 } });
-  returning.emplace(798, Rand_prop_point{ 798, 11910.232421875, 11910.232421875, { 31760.619140625, 23820.46484375, 17865.34765625, 15880.309570312, 15880.309570312 } });
-  returning.emplace(799, Rand_prop_point{ 799, 12021.723632812, 12021.723632812, { 32057.9296875, 24043.447265625, 18032.5859375, 16028.96484375, 16028.96484375 } });
-  returning.emplace(800, Rand_prop_point{ 800, 12134.258789062, 12134.258789062, { 32358.025390625, 24268.517578125, 18201.388671875, 16179.012695312, 16179.012695312 } });
-  returning.emplace(801, Rand_prop_point{ 801, 12247.84765625, 12247.84765625, { 32660.927734375, 24495.6953125, 18371.771484375, 16330.463867188, 16330.463867188 } });
-  returning.emplace(802, Rand_prop_point{ 802, 12362.5, 12362.5, { 32966.66796875, 24725, 18543.75, 16483.333984375, 16483.333984375 } });
-  returning.emplace(803, Rand_prop_point{ 803, 12478.225585938, 12478.225585938, { 33275.26953125, 24956.451171875, 18717.337890625, 16637.634765625, 16637.634765625 } });
-  returning.emplace(804, Rand_prop_point{ 804, 12595.034179688, 12595.034179688, { 33586.7578125, 25190.068359375, 18892.55078125, 16793.37890625, 16793.37890625 } });
-  returning.emplace(805, Rand_prop_point{ 805, 12712.936523438, 12712.936523438, { 33901.1640625, 25425.873046875, 19069.404296875, 16950.58203125, 16950.58203125 } });
-  returning.emplace(806, Rand_prop_point{ 806, 12831.942382812, 12831.942382812, { 34218.51171875, 25663.884765625, 19247.9140625, 17109.255859375, 17109.255859375 } });
-  returning.emplace(807, Rand_prop_point{ 807, 12952.063476562, 12952.063476562, { 34538.83203125, 25904.125, 19428.09375, 17269.416015625, 17269.416015625 } });
-  returning.emplace(808, Rand_prop_point{ 808, 13073.306640625, 13073.306640625, { 34862.15234375, 26146.61328125, 19609.9609375, 17431.076171875, 17431.076171875 } });
-  returning.emplace(809, Rand_prop_point{ 809, 13195.685546875, 13195.685546875, { 35188.49609375, 26391.37109375, 19793.529296875, 17594.248046875, 17594.248046875 } });
-  returning.emplace(810, Rand_prop_point{ 810, 13319.2109375, 13319.2109375, { 35517.89453125, 26638.421875, 19978.81640625, 17758.947265625, 17758.947265625 } });
-  returning.emplace(811, Rand_prop_point{ 811, 13443.892578125, 13443.892578125, { 35850.37890625, 26887.78515625, 20165.837890625, 17925.189453125, 17925.189453125 } });
-  returning.emplace(812, Rand_prop_point{ 812, 13569.740234375, 13569.740234375, { 36185.97265625, 27139.48046875, 20354.611328125, 18092.986328125, 18092.986328125 } });
-  returning.emplace(813, Rand_prop_point{ 813, 13696.766601562, 13696.766601562, { 36524.7109375, 27393.533203125, 20545.150390625, 18262.35546875, 18262.35546875 } });
-  returning.emplace(814, Rand_prop_point{ 814, 13824.982421875, 13824.982421875, { 36866.62109375, 27649.96484375, 20737.47265625, 18433.310546875, 18433.310546875 } });
-  returning.emplace(815, Rand_prop_point{ 815, 13954.3984375, 13954.3984375, { 37211.7265625, 27908.796875, 20931.59765625, 18605.86328125, 18605.86328125 } });
-  returning.emplace(816, Rand_prop_point{ 816, 14085.025390625, 14085.025390625, { 37560.06640625, 28170.05078125, 21127.537109375, 18780.033203125, 18780.033203125 } });
-  returning.emplace(817, Rand_prop_point{ 817, 14216.875, 14216.875, { 37911.66796875, 28433.75, 21325.3125, 18955.833984375, 18955.833984375 } });
-  returning.emplace(818, Rand_prop_point{ 818, 14349.959960938, 14349.959960938, { 38266.55859375, 28699.919921875, 21524.939453125, 19133.279296875, 19133.279296875 } });
-  returning.emplace(819, Rand_prop_point{ 819, 14484.290039062, 14484.290039062, { 38624.7734375, 28968.580078125, 21726.43359375, 19312.38671875, 19312.38671875 } });
-  returning.emplace(820, Rand_prop_point{ 820, 14619.876953125, 14619.876953125, { 38986.33984375, 29239.75390625, 21929.81640625, 19493.169921875, 19493.169921875 } });
-  returning.emplace(821, Rand_prop_point{ 821, 14756.733398438, 14756.733398438, { 39351.2890625, 29513.466796875, 22135.1015625, 19675.64453125, 19675.64453125 } });
-  returning.emplace(822, Rand_prop_point{ 822, 14894.872070312, 14894.872070312, { 39719.65625, 29789.744140625, 22342.306640625, 19859.828125, 19859.828125 } });
-  returning.emplace(823, Rand_prop_point{ 823, 15034.302734375, 15034.302734375, { 40091.47265625, 30068.60546875, 22551.453125, 20045.736328125, 20045.736328125 } });
-  returning.emplace(824, Rand_prop_point{ 824, 15175.0390625, 15175.0390625, { 40466.76953125, 30350.078125, 22762.55859375, 20233.384765625, 20233.384765625 } });
-  returning.emplace(825, Rand_prop_point{ 825, 15317.092773438, 15317.092773438, { 40845.578125, 30634.185546875, 22975.638671875, 20422.7890625, 20422.7890625 } });
-  returning.emplace(826, Rand_prop_point{ 826, 15460.475585938, 15460.475585938, { 41227.9375, 30920.951171875, 23190.71484375, 20613.96875, 20613.96875 } });
-  returning.emplace(827, Rand_prop_point{ 827, 15605.201171875, 15605.201171875, { 41613.87109375, 31210.40234375, 23407.802734375, 20806.935546875, 20806.935546875 } });
-  returning.emplace(828, Rand_prop_point{ 828, 15751.282226562, 15751.282226562, { 42003.41796875, 31502.564453125, 23626.921875, 21001.708984375, 21001.708984375 } });
-  returning.emplace(829, Rand_prop_point{ 829, 15898.728515625, 15898.728515625, { 42396.61328125, 31797.458984375, 23848.09375, 21198.306640625, 21198.306640625 } });
-  returning.emplace(830, Rand_prop_point{ 830, 16047.557617188, 16047.557617188, { 42793.48828125, 32095.115234375, 24071.3359375, 21396.744140625, 21396.744140625 } });
-  returning.emplace(831, Rand_prop_point{ 831, 16197.779296875, 16197.779296875, { 43194.078125, 32395.55859375, 24296.66796875, 21597.0390625, 21597.0390625 } });
-  returning.emplace(832, Rand_prop_point{ 832, 16349.40625, 16349.40625, { 43598.41796875, 32698.8125, 24524.109375, 21799.208984375, 21799.208984375 } });
-  returning.emplace(833, Rand_prop_point{ 833, 16502.453125, 16502.453125, { 44006.54296875, 33004.90625, 24753.6796875, 22003.271484375, 22003.271484375 } });
-  returning.emplace(834, Rand_prop_point{ 834, 16656.93359375, 16656.93359375, { 44418.48828125, 33313.8671875, 24985.400390625, 22209.244140625, 22209.244140625 } });
-  returning.emplace(835, Rand_prop_point{ 835, 16812.859375, 16812.859375, { 44834.2890625, 33625.71875, 25219.287109375, 22417.14453125, 22417.14453125 } });
-  returning.emplace(836, Rand_prop_point{ 836, 16970.244140625, 16970.244140625, { 45253.984375, 33940.48828125, 25455.365234375, 22626.9921875, 22626.9921875 } });
-  returning.emplace(837, Rand_prop_point{ 837, 17129.1015625, 17129.1015625, { 45677.60546875, 34258.203125, 25693.654296875, 22838.802734375, 22838.802734375 } });
-  returning.emplace(838, Rand_prop_point{ 838, 17289.447265625, 17289.447265625, { 46105.1953125, 34578.89453125, 25934.171875, 23052.59765625, 23052.59765625 } });
-  returning.emplace(839, Rand_prop_point{ 839, 17451.294921875, 17451.294921875, { 46536.78515625, 34902.58984375, 26176.94140625, 23268.392578125, 23268.392578125 } });
-  returning.emplace(840, Rand_prop_point{ 840, 17614.65625, 17614.65625, { 46972.41796875, 35229.3125, 26421.984375, 23486.208984375, 23486.208984375 } });
-  returning.emplace(841, Rand_prop_point{ 841, 17779.546875, 17779.546875, { 47412.125, 35559.09375, 26669.3203125, 23706.0625, 23706.0625 } });
-  returning.emplace(842, Rand_prop_point{ 842, 17945.982421875, 17945.982421875, { 47855.953125, 35891.96484375, 26918.97265625, 23927.9765625, 23927.9765625 } });
-  returning.emplace(843, Rand_prop_point{ 843, 18113.974609375, 18113.974609375, { 48303.9296875, 36227.94921875, 27170.9609375, 24151.96484375, 24151.96484375 } });
-  returning.emplace(844, Rand_prop_point{ 844, 18283.5390625, 18283.5390625, { 48756.10546875, 36567.078125, 27425.30859375, 24378.052734375, 24378.052734375 } });
-  returning.emplace(845, Rand_prop_point{ 845, 18454.69140625, 18454.69140625, { 49212.51171875, 36909.3828125, 27682.037109375, 24606.255859375, 24606.255859375 } });
-  returning.emplace(846, Rand_prop_point{ 846, 18627.4453125, 18627.4453125, { 49673.1875, 37254.890625, 27941.169921875, 24836.59375, 24836.59375 } });
-  returning.emplace(847, Rand_prop_point{ 847, 18801.818359375, 18801.818359375, { 50138.1796875, 37603.63671875, 28202.7265625, 25069.08984375, 25069.08984375 } });
-  returning.emplace(848, Rand_prop_point{ 848, 18977.822265625, 18977.822265625, { 50607.5234375, 37955.64453125, 28466.732421875, 25303.76171875, 25303.76171875 } });
-  returning.emplace(849, Rand_prop_point{ 849, 19155.47265625, 19155.47265625, { 51081.26171875, 38310.9453125, 28733.208984375, 25540.630859375, 25540.630859375 } });
-  returning.emplace(850, Rand_prop_point{ 850, 19334.787109375, 19334.787109375, { 51559.43359375, 38669.57421875, 29002.181640625, 25779.716796875, 25779.716796875 } });
-  returning.emplace(851, Rand_prop_point{ 851, 19515.78125, 19515.78125, { 52042.08203125, 39031.5625, 29273.669921875, 26021.041015625, 26021.041015625 } });
-  returning.emplace(852, Rand_prop_point{ 852, 19698.46875, 19698.46875, { 52529.24609375, 39396.9375, 29547.701171875, 26264.623046875, 26264.623046875 } });
-  returning.emplace(853, Rand_prop_point{ 853, 19882.865234375, 19882.865234375, { 53020.97265625, 39765.73046875, 29824.298828125, 26510.486328125, 26510.486328125 } });
-  returning.emplace(854, Rand_prop_point{ 854, 20068.98828125, 20068.98828125, { 53517.3046875, 40137.9765625, 30103.484375, 26758.65234375, 26758.65234375 } });
-  returning.emplace(855, Rand_prop_point{ 855, 20256.85546875, 20256.85546875, { 54018.28125, 40513.7109375, 30385.283203125, 27009.140625, 27009.140625 } });
-  returning.emplace(856, Rand_prop_point{ 856, 20446.478515625, 20446.478515625, { 54523.9453125, 40892.95703125, 30669.71875, 27261.97265625, 27261.97265625 } });
-  returning.emplace(857, Rand_prop_point{ 857, 20637.87890625, 20637.87890625, { 55034.34375, 41275.7578125, 30956.818359375, 27517.171875, 27517.171875 } });
-  returning.emplace(858, Rand_prop_point{ 858, 20831.0703125, 20831.0703125, { 55549.51953125, 41662.140625, 31246.60546875, 27774.759765625, 27774.759765625 } });
-  returning.emplace(859, Rand_prop_point{ 859, 21026.0703125, 21026.0703125, { 56069.51953125, 42052.140625, 31539.10546875, 28034.759765625, 28034.759765625 } });
-  returning.emplace(860, Rand_prop_point{ 860, 21222.89453125, 21222.89453125, { 56594.38671875, 42445.7890625, 31834.34375, 28297.193359375, 28297.193359375 } });
-  returning.emplace(861, Rand_prop_point{ 861, 21421.5625, 21421.5625, { 57124.16796875, 42843.125, 32132.34375, 28562.083984375, 28562.083984375 } });
-  returning.emplace(862, Rand_prop_point{ 862, 21622.08984375, 21622.08984375, { 57658.90625, 43244.1796875, 32433.134765625, 28829.453125, 28829.453125 } });
-  returning.emplace(863, Rand_prop_point{ 863, 21824.494140625, 21824.494140625, { 58198.65234375, 43648.98828125, 32736.7421875, 29099.326171875, 29099.326171875 } });
-  returning.emplace(864, Rand_prop_point{ 864, 22028.794921875, 22028.794921875, { 58743.44921875, 44057.58984375, 33043.19140625, 29371.724609375, 29371.724609375 } });
-  returning.emplace(865, Rand_prop_point{ 865, 22235.005859375, 22235.005859375, { 59293.34765625, 44470.01171875, 33352.5078125, 29646.673828125, 29646.673828125 } });
-  returning.emplace(866, Rand_prop_point{ 866, 22443.1484375, 22443.1484375, { 59848.39453125, 44886.296875, 33664.72265625, 29924.197265625, 29924.197265625 } });
-  returning.emplace(867, Rand_prop_point{ 867, 22653.23828125, 22653.23828125, { 60408.63671875, 45306.4765625, 33979.85546875, 30204.318359375, 30204.318359375 } });
-  returning.emplace(868, Rand_prop_point{ 868, 22865.294921875, 22865.294921875, { 60974.12109375, 45730.58984375, 34297.94140625, 30487.060546875, 30487.060546875 } });
-  returning.emplace(869, Rand_prop_point{ 869, 23079.337890625, 23079.337890625, { 61544.8984375, 46158.67578125, 34619.0078125, 30772.44921875, 30772.44921875 } });
-  returning.emplace(870, Rand_prop_point{ 870, 23295.3828125, 23295.3828125, { 62121.0234375, 46590.765625, 34943.07421875, 31060.51171875, 31060.51171875 } });
-  returning.emplace(871, Rand_prop_point{ 871, 23513.451171875, 23513.451171875, { 62702.53515625, 47026.90234375, 35270.17578125, 31351.267578125, 31351.267578125 } });
-  returning.emplace(872, Rand_prop_point{ 872, 23733.560546875, 23733.560546875, { 63289.49609375, 47467.12109375, 35600.33984375, 31644.748046875, 31644.748046875 } });
-  returning.emplace(873, Rand_prop_point{ 873, 23955.73046875, 23955.73046875, { 63881.94921875, 47911.4609375, 35933.59765625, 31940.974609375, 31940.974609375 } });
-  returning.emplace(874, Rand_prop_point{ 874, 24179.98046875, 24179.98046875, { 64479.94921875, 48359.9609375, 36269.97265625, 32239.974609375, 32239.974609375 } });
-  returning.emplace(875, Rand_prop_point{ 875, 24406.330078125, 24406.330078125, { 65083.546875, 48812.66015625, 36609.49609375, 32541.7734375, 32541.7734375 } });
-  returning.emplace(876, Rand_prop_point{ 876, 24634.796875, 24634.796875, { 65692.7890625, 49269.59375, 36952.1953125, 32846.39453125, 32846.39453125 } });
-  returning.emplace(877, Rand_prop_point{ 877, 24865.404296875, 24865.404296875, { 66307.7421875, 49730.80859375, 37298.10546875, 33153.87109375, 33153.87109375 } });
-  returning.emplace(878, Rand_prop_point{ 878, 25098.16796875, 25098.16796875, { 66928.453125, 50196.3359375, 37647.25390625, 33464.2265625, 33464.2265625 } });
-  returning.emplace(879, Rand_prop_point{ 879, 25333.11328125, 25333.11328125, { 67554.96875, 50666.2265625, 37999.66796875, 33777.484375, 33777.484375 } });
-  returning.emplace(880, Rand_prop_point{ 880, 25570.255859375, 25570.255859375, { 68187.3515625, 51140.51171875, 38355.3828125, 34093.67578125, 34093.67578125 } });
-  returning.emplace(881, Rand_prop_point{ 881, 25809.619140625, 25809.619140625, { 68825.65625, 51619.23828125, 38714.4296875, 34412.828125, 34412.828125 } });
-  returning.emplace(882, Rand_prop_point{ 882, 26051.224609375, 26051.224609375, { 69469.9296875, 52102.44921875, 39076.8359375, 34734.96484375, 34734.96484375 } });
-  returning.emplace(883, Rand_prop_point{ 883, 26295.08984375, 26295.08984375, { 70120.2421875, 52590.1796875, 39442.6328125, 35060.12109375, 35060.12109375 } });
-  returning.emplace(884, Rand_prop_point{ 884, 26541.23828125, 26541.23828125, { 70776.6328125, 53082.4765625, 39811.85546875, 35388.31640625, 35388.31640625 } });
-  returning.emplace(885, Rand_prop_point{ 885, 26789.69140625, 26789.69140625, { 71439.171875, 53579.3828125, 40184.53515625, 35719.5859375, 35719.5859375 } });
-  returning.emplace(886, Rand_prop_point{ 886, 27040.46875, 27040.46875, { 72107.9140625, 54080.9375, 40560.703125, 36053.95703125, 36053.95703125 } });
-  returning.emplace(887, Rand_prop_point{ 887, 27293.595703125, 27293.595703125, { 72782.921875, 54587.19140625, 40940.390625, 36391.4609375, 36391.4609375 } });
-  returning.emplace(888, Rand_prop_point{ 888, 27549.08984375, 27549.08984375, { 73464.2421875, 55098.1796875, 41323.63671875, 36732.12109375, 36732.12109375 } });
-  returning.emplace(889, Rand_prop_point{ 889, 27806.978515625, 27806.978515625, { 74151.9375, 55613.95703125, 41710.46484375, 37075.96875, 37075.96875 } });
-  returning.emplace(890, Rand_prop_point{ 890, 28067.279296875, 28067.279296875, { 74846.078125, 56134.55859375, 42100.91796875, 37423.0390625, 37423.0390625 } });
-  returning.emplace(891, Rand_prop_point{ 891, 28330.017578125, 28330.017578125, { 75546.7109375, 56660.03515625, 42495.0234375, 37773.35546875, 37773.35546875 } });
-  returning.emplace(892, Rand_prop_point{ 892, 28595.21484375, 28595.21484375, { 76253.90625, 57190.4296875, 42892.8203125, 38126.953125, 38126.953125 } });
-  returning.emplace(893, Rand_prop_point{ 893, 28862.89453125, 28862.89453125, { 76967.71875, 57725.7890625, 43294.33984375, 38483.859375, 38483.859375 } });
-  returning.emplace(894, Rand_prop_point{ 894, 29133.080078125, 29133.080078125, { 77688.2109375, 58266.16015625, 43699.62109375, 38844.10546875, 38844.10546875 } });
-  returning.emplace(895, Rand_prop_point{ 895, 29405.794921875, 29405.794921875, { 78415.453125, 58811.58984375, 44108.69140625, 39207.7265625, 39207.7265625 } });
-  returning.emplace(896, Rand_prop_point{ 896, 29681.0625, 29681.0625, { 79149.5, 59362.125, 44521.59375, 39574.75, 39574.75 } });
-  returning.emplace(897, Rand_prop_point{ 897, 29958.908203125, 29958.908203125, { 79890.421875, 59917.81640625, 44938.359375, 39945.2109375, 39945.2109375 } });
-  returning.emplace(898, Rand_prop_point{ 898, 30239.353515625, 30239.353515625, { 80638.2734375, 60478.70703125, 45359.02734375, 40319.13671875, 40319.13671875 } });
-  returning.emplace(899, Rand_prop_point{ 899, 30522.423828125, 30522.423828125, { 81393.1328125, 61044.84765625, 45783.63671875, 40696.56640625, 40696.56640625 } });
-  returning.emplace(900, Rand_prop_point{ 900, 30808.14453125, 30808.14453125, { 82155.0546875, 61616.2890625, 46212.21484375, 41077.52734375, 41077.52734375 } });
-  returning.emplace(901, Rand_prop_point{ 901, 31096.5390625, 31096.5390625, { 82924.1015625, 62193.078125, 46644.80859375, 41462.05078125, 41462.05078125 } });
-  returning.emplace(902, Rand_prop_point{ 902, 31387.634765625, 31387.634765625, { 83700.359375, 62775.26953125, 47081.453125, 41850.1796875, 41850.1796875 } });
-  returning.emplace(903, Rand_prop_point{ 903, 31681.453125, 31681.453125, { 84483.875, 63362.90625, 47522.1796875, 42241.9375, 42241.9375 } });
-  returning.emplace(904, Rand_prop_point{ 904, 31978.0234375, 31978.0234375, { 85274.734375, 63956.046875, 47967.03515625, 42637.3671875, 42637.3671875 } });
-  returning.emplace(905, Rand_prop_point{ 905, 32277.37109375, 32277.37109375, { 86072.9921875, 64554.7421875, 48416.0546875, 43036.49609375, 43036.49609375 } });
-  returning.emplace(906, Rand_prop_point{ 906, 32579.51953125, 32579.51953125, { 86878.71875, 65159.0390625, 48869.27734375, 43439.359375, 43439.359375 } });
-  returning.emplace(907, Rand_prop_point{ 907, 32884.49609375, 32884.49609375, { 87691.9921875, 65768.9921875, 49326.74609375, 43845.99609375, 43845.99609375 } });
-  returning.emplace(908, Rand_prop_point{ 908, 33192.328125, 33192.328125, { 88512.875, 66384.65625, 49788.4921875, 44256.4375, 44256.4375 } });
-  returning.emplace(909, Rand_prop_point{ 909, 33503.04296875, 33503.04296875, { 89341.4453125, 67006.0859375, 50254.5625, 44670.72265625, 44670.72265625 } });
-  returning.emplace(910, Rand_prop_point{ 910, 33816.6640625, 33816.6640625, { 90177.7734375, 67633.328125, 50724.99609375, 45088.88671875, 45088.88671875 } });
-  returning.emplace(911, Rand_prop_point{ 911, 34133.22265625, 34133.22265625, { 91021.921875, 68266.4453125, 51199.83203125, 45510.9609375, 45510.9609375 } });
-  returning.emplace(912, Rand_prop_point{ 912, 34452.7421875, 34452.7421875, { 91873.984375, 68905.484375, 51679.11328125, 45936.9921875, 45936.9921875 } });
-  returning.emplace(913, Rand_prop_point{ 913, 34775.25390625, 34775.25390625, { 92734.015625, 69550.5078125, 52162.8828125, 46367.0078125, 46367.0078125 } });
-  returning.emplace(914, Rand_prop_point{ 914, 35100.78515625, 35100.78515625, { 93602.1015625, 70201.5703125, 52651.1796875, 46801.05078125, 46801.05078125 } });
-  returning.emplace(915, Rand_prop_point{ 915, 35429.3671875, 35429.3671875, { 94478.3125, 70858.734375, 53144.046875, 47239.15625, 47239.15625 } });
-  returning.emplace(916, Rand_prop_point{ 916, 35761.01953125, 35761.01953125, { 95362.71875, 71522.0390625, 53641.53125, 47681.359375, 47681.359375 } });
-  returning.emplace(917, Rand_prop_point{ 917, 36095.78125, 36095.78125, { 96255.4140625, 72191.5625, 54143.66796875, 48127.70703125, 48127.70703125 } });
-  returning.emplace(918, Rand_prop_point{ 918, 36433.671875, 36433.671875, { 97156.4609375, 72867.34375, 54650.5078125, 48578.23046875, 48578.23046875 } });
-  returning.emplace(919, Rand_prop_point{ 919, 36774.7265625, 36774.7265625, { 98065.9375, 73549.453125, 55162.09375, 49032.96875, 49032.96875 } });
-  returning.emplace(920, Rand_prop_point{ 920, 37118.9765625, 37118.9765625, { 98983.9375, 74237.953125, 55678.46484375, 49491.96875, 49491.96875 } });
-  returning.emplace(921, Rand_prop_point{ 921, 37466.44921875, 37466.44921875, { 99910.5234375, 74932.8984375, 56199.671875, 49955.26171875, 49955.26171875 } });
-  returning.emplace(922, Rand_prop_point{ 922, 37817.171875, 37817.171875, { 100845.7890625, 75634.34375, 56725.7578125, 50422.89453125, 50422.89453125 } });
-  returning.emplace(923, Rand_prop_point{ 923, 38171.17578125, 38171.17578125, { 101789.796875, 76342.3515625, 57256.765625, 50894.90234375, 50894.90234375 } });
-  returning.emplace(924, Rand_prop_point{ 924, 38528.5, 38528.5, { 102742.65625, 77057, 57792.74609375, 51371.33203125, 51371.33203125 } });
-  returning.emplace(925, Rand_prop_point{ 925, 38889.1640625, 38889.1640625, { 103704.4375, 77778.328125, 58333.74609375, 51852.21875, 51852.21875 } });
-  returning.emplace(926, Rand_prop_point{ 926, 39253.20703125, 39253.20703125, { 104675.2109375, 78506.4140625, 58879.80859375, 52337.60546875, 52337.60546875 } });
-  returning.emplace(927, Rand_prop_point{ 927, 39620.65625, 39620.65625, { 105655.078125, 79241.3125, 59430.98046875, 52827.5390625, 52827.5390625 } });
-  returning.emplace(928, Rand_prop_point{ 928, 39991.54296875, 39991.54296875, { 106644.1171875, 79983.0859375, 59987.31640625, 53322.05859375, 53322.05859375 } });
-  returning.emplace(929, Rand_prop_point{ 929, 40365.90625, 40365.90625, { 107642.40625, 80731.8125, 60548.859375, 53821.20703125, 53821.20703125 } });
-  returning.emplace(930, Rand_prop_point{ 930, 40743.76953125, 40743.76953125, { 108650.046875, 81487.5390625, 61115.65625, 54325.02734375, 54325.02734375 } });
-  returning.emplace(931, Rand_prop_point{ 931, 41125.171875, 41125.171875, { 109667.1328125, 82250.34375, 61687.76171875, 54833.5625, 54833.5625 } });
-  returning.emplace(932, Rand_prop_point{ 932, 41510.14453125, 41510.14453125, { 110693.7265625, 83020.2890625, 62265.21875, 55346.86328125, 55346.86328125 } });
-  returning.emplace(933, Rand_prop_point{ 933, 41898.72265625, 41898.72265625, { 111729.9296875, 83797.4453125, 62848.0859375, 55864.96484375, 55864.96484375 } });
-  returning.emplace(934, Rand_prop_point{ 934, 42290.9375, 42290.9375, { 112775.84375, 84581.875, 63436.40625, 56387.91796875, 56387.91796875 } });
-  returning.emplace(935, Rand_prop_point{ 935, 42686.82421875, 42686.82421875, { 113831.53125, 85373.6484375, 64030.234375, 56915.765625, 56915.765625 } });
-  returning.emplace(936, Rand_prop_point{ 936, 43086.4140625, 43086.4140625, { 114897.1015625, 86172.828125, 64629.62109375, 57448.55078125, 57448.55078125 } });
-  returning.emplace(937, Rand_prop_point{ 937, 43489.74609375, 43489.74609375, { 115972.65625, 86979.4921875, 65234.62109375, 57986.328125, 57986.328125 } });
-  returning.emplace(938, Rand_prop_point{ 938, 43896.85546875, 43896.85546875, { 117058.28125, 87793.7109375, 65845.28125, 58529.140625, 58529.140625 } });
-  returning.emplace(939, Rand_prop_point{ 939, 44307.7734375, 44307.7734375, { 118154.0625, 88615.546875, 66461.65625, 59077.03125, 59077.03125 } });
-  returning.emplace(940, Rand_prop_point{ 940, 44722.5390625, 44722.5390625, { 119260.1015625, 89445.078125, 67083.8046875, 59630.05078125, 59630.05078125 } });
-  returning.emplace(941, Rand_prop_point{ 941, 45141.1875, 45141.1875, { 120376.5, 90282.375, 67711.78125, 60188.25, 60188.25 } });
-  returning.emplace(942, Rand_prop_point{ 942, 45563.75390625, 45563.75390625, { 121503.34375, 91127.5078125, 68345.6328125, 60751.671875, 60751.671875 } });
-  returning.emplace(943, Rand_prop_point{ 943, 45990.27734375, 45990.27734375, { 122640.7265625, 91980.5546875, 68985.4140625, 61320.3671875, 61320.3671875 } });
-  returning.emplace(944, Rand_prop_point{ 944, 46420.7890625, 46420.7890625, { 123788.7734375, 92841.578125, 69631.1875, 61894.38671875, 61894.38671875 } });
-  returning.emplace(945, Rand_prop_point{ 945, 46855.3359375, 46855.3359375, { 124947.5625, 93710.671875, 70283.0078125, 62473.78125, 62473.78125 } });
-  returning.emplace(946, Rand_prop_point{ 946, 47293.94921875, 47293.94921875, { 126117.203125, 94587.8984375, 70940.921875, 63058.59765625, 63058.59765625 } });
-  returning.emplace(947, Rand_prop_point{ 947, 47736.66796875, 47736.66796875, { 127297.78125, 95473.3359375, 71605, 63648.890625, 63648.890625 } });
-  returning.emplace(948, Rand_prop_point{ 948, 48183.53125, 48183.53125, { 128489.40625, 96367.0625, 72275.296875, 64244.70703125, 64244.70703125 } });
-  returning.emplace(949, Rand_prop_point{ 949, 48634.578125, 48634.578125, { 129692.2109375, 97269.15625, 72951.8671875, 64846.10546875, 64846.10546875 } });
-  returning.emplace(950, Rand_prop_point{ 950, 49089.84765625, 49089.84765625, { 130906.2578125, 98179.6953125, 73634.765625, 65453.12890625, 65453.12890625 } });
-  returning.emplace(951, Rand_prop_point{ 951, 49549.375, 49549.375, { 132131.671875, 99098.75, 74324.0625, 66065.8359375, 66065.8359375 } });
-  returning.emplace(952, Rand_prop_point{ 952, 50013.20703125, 50013.20703125, { 133368.5625, 100026.40625, 75019.8125, 66684.28125, 66684.28125 } });
-  returning.emplace(953, Rand_prop_point{ 953, 50481.3828125, 50481.3828125, { 134617.015625, 100962.7734375, 75722.0703125, 67308.5078125, 67308.5078125 } });
-  returning.emplace(954, Rand_prop_point{ 954, 50953.9375, 50953.9375, { 135877.171875, 101907.8828125, 76430.90625, 67938.5859375, 67938.5859375 } });
-  returning.emplace(955, Rand_prop_point{ 955, 51430.91796875, 51430.91796875, { 137149.125, 102861.84375, 77146.375, 68574.5625, 68574.5625 } });
-  returning.emplace(956, Rand_prop_point{ 956, 51912.36328125, 51912.36328125, { 138432.96875, 103824.7265625, 77868.546875, 69216.484375, 69216.484375 } });
-  returning.emplace(957, Rand_prop_point{ 957, 52398.31640625, 52398.31640625, { 139728.84375, 104796.6328125, 78597.4765625, 69864.421875, 69864.421875 } });
-  returning.emplace(958, Rand_prop_point{ 958, 52888.81640625, 52888.81640625, { 141036.84375, 105777.6328125, 79333.2265625, 70518.421875, 70518.421875 } });
-  returning.emplace(959, Rand_prop_point{ 959, 53383.91015625, 53383.91015625, { 142357.09375, 106767.8203125, 80075.8671875, 71178.546875, 71178.546875 } });
-  returning.emplace(960, Rand_prop_point{ 960, 53883.63671875, 53883.63671875, { 143689.703125, 107767.2734375, 80825.453125, 71844.8515625, 71844.8515625 } });
-  returning.emplace(961, Rand_prop_point{ 961, 54388.04296875, 54388.04296875, { 145034.78125, 108776.09375, 81582.0625, 72517.390625, 72517.390625 } });
-  returning.emplace(962, Rand_prop_point{ 962, 54897.16796875, 54897.16796875, { 146392.453125, 109794.34375, 82345.75, 73196.2265625, 73196.2265625 } });
-  returning.emplace(963, Rand_prop_point{ 963, 55411.0625, 55411.0625, { 147762.828125, 110822.1328125, 83116.59375, 73881.4140625, 73881.4140625 } });
-  returning.emplace(964, Rand_prop_point{ 964, 55929.765625, 55929.765625, { 149146.03125, 111859.53125, 83894.6484375, 74573.015625, 74573.015625 } });
-  returning.emplace(965, Rand_prop_point{ 965, 56453.32421875, 56453.32421875, { 150542.1875, 112906.6484375, 84679.984375, 75271.09375, 75271.09375 } });
-  returning.emplace(966, Rand_prop_point{ 966, 56981.78125, 56981.78125, { 151951.421875, 113963.5625, 85472.671875, 75975.7109375, 75975.7109375 } });
-  returning.emplace(967, Rand_prop_point{ 967, 57515.19140625, 57515.19140625, { 153373.84375, 115030.3828125, 86272.78125, 76686.921875, 76686.921875 } });
-  returning.emplace(968, Rand_prop_point{ 968, 58053.58984375, 58053.58984375, { 154809.578125, 116107.1796875, 87080.3828125, 77404.7890625, 77404.7890625 } });
-  returning.emplace(969, Rand_prop_point{ 969, 58597.03125, 58597.03125, { 156258.75, 117194.0625, 87895.546875, 78129.375, 78129.375 } });
-  returning.emplace(970, Rand_prop_point{ 970, 59145.55859375, 59145.55859375, { 157721.484375, 118291.1171875, 88718.3359375, 78860.7421875, 78860.7421875 } });
-  returning.emplace(971, Rand_prop_point{ 971, 59699.21875, 59699.21875, { 159197.921875, 119398.4375, 89548.828125, 79598.9609375, 79598.9609375 } });
-  returning.emplace(972, Rand_prop_point{ 972, 60258.0625, 60258.0625, { 160688.171875, 120516.1328125, 90387.09375, 80344.0859375, 80344.0859375 } });
-  returning.emplace(973, Rand_prop_point{ 973, 60822.140625, 60822.140625, { 162192.375, 121644.28125, 91233.2109375, 81096.1875, 81096.1875 } });
-  returning.emplace(974, Rand_prop_point{ 974, 61391.49609375, 61391.49609375, { 163710.65625, 122782.9921875, 92087.2421875, 81855.328125, 81855.328125 } });
-  returning.emplace(975, Rand_prop_point{ 975, 61966.18359375, 61966.18359375, { 165243.15625, 123932.3671875, 92949.2734375, 82621.578125, 82621.578125 } });
-  returning.emplace(976, Rand_prop_point{ 976, 62546.24609375, 62546.24609375, { 166790, 125092.4921875, 93819.375, 83395, 83395 } });
-  returning.emplace(977, Rand_prop_point{ 977, 63131.7421875, 63131.7421875, { 168351.3125, 126263.4765625, 94697.6171875, 84175.65625, 84175.65625 } });
-  returning.emplace(978, Rand_prop_point{ 978, 63722.71875, 63722.71875, { 169927.25, 127445.4375, 95584.078125, 84963.625, 84963.625 } });
-  returning.emplace(979, Rand_prop_point{ 979, 64319.23046875, 64319.23046875, { 171517.9375, 128638.4609375, 96478.84375, 85758.96875, 85758.96875 } });
-  returning.emplace(980, Rand_prop_point{ 980, 64921.3203125, 64921.3203125, { 173123.53125, 129842.640625, 97381.984375, 86561.765625, 86561.765625 } });
-  returning.emplace(981, Rand_prop_point{ 981, 65529.05078125, 65529.05078125, { 174744.140625, 131058.1015625, 98293.578125, 87372.0703125, 87372.0703125 } });
-  returning.emplace(982, Rand_prop_point{ 982, 66142.46875, 66142.46875, { 176379.921875, 132284.9375, 99213.703125, 88189.9609375, 88189.9609375 } });
-  returning.emplace(983, Rand_prop_point{ 983, 66761.625, 66761.625, { 178031.015625, 133523.25, 100142.453125, 89015.5078125, 89015.5078125 } });
-  returning.emplace(984, Rand_prop_point{ 984, 67386.5859375, 67386.5859375, { 179697.5625, 134773.171875, 101079.8828125, 89848.78125, 89848.78125 } });
-  returning.emplace(985, Rand_prop_point{ 985, 68017.390625, 68017.390625, { 181379.703125, 136034.78125, 102026.09375, 90689.8515625, 90689.8515625 } });
-  returning.emplace(986, Rand_prop_point{ 986, 68654.1015625, 68654.1015625, { 183077.609375, 137308.203125, 102981.15625, 91538.8046875, 91538.8046875 } });
-  returning.emplace(987, Rand_prop_point{ 987, 69296.7734375, 69296.7734375, { 184791.390625, 138593.546875, 103945.15625, 92395.6953125, 92395.6953125 } });
-  returning.emplace(988, Rand_prop_point{ 988, 69945.4609375, 69945.4609375, { 186521.234375, 139890.921875, 104918.1875, 93260.6171875, 93260.6171875 } });
-  returning.emplace(989, Rand_prop_point{ 989, 70600.21875, 70600.21875, { 188267.25, 141200.4375, 105900.328125, 94133.625, 94133.625 } });
-  returning.emplace(990, Rand_prop_point{ 990, 71261.109375, 71261.109375, { 190029.625, 142522.21875, 106891.65625, 95014.8125, 95014.8125 } });
-  returning.emplace(991, Rand_prop_point{ 991, 71928.1875, 71928.1875, { 191808.5, 143856.375, 107892.28125, 95904.25, 95904.25 } });
-  returning.emplace(992, Rand_prop_point{ 992, 72601.5078125, 72601.5078125, { 193604.015625, 145203.015625, 108902.2578125, 96802.0078125, 96802.0078125 } });
-  returning.emplace(993, Rand_prop_point{ 993, 73281.125, 73281.125, { 195416.34375, 146562.25, 109921.703125, 97708.171875, 97708.171875 } });
-  returning.emplace(994, Rand_prop_point{ 994, 73967.1171875, 73967.1171875, { 197245.640625, 147934.234375, 110950.671875, 98622.8203125, 98622.8203125 } });
-  returning.emplace(995, Rand_prop_point{ 995, 74659.5234375, 74659.5234375, { 199092.046875, 149319.046875, 111989.28125, 99546.0234375, 99546.0234375 } });
-  returning.emplace(996, Rand_prop_point{ 996, 75358.40625, 75358.40625, { 200955.75, 150716.8125, 113037.609375, 100477.8828125, 100477.8828125 } });
-  returning.emplace(997, Rand_prop_point{ 997, 76063.8359375, 76063.8359375, { 202836.90625, 152127.671875, 114095.7578125, 101418.453125, 101418.453125 } });
-  returning.emplace(998, Rand_prop_point{ 998, 76775.875, 76775.875, { 204735.65625, 153551.75, 115163.8125, 102367.828125, 102367.828125 } });
-  returning.emplace(999, Rand_prop_point{ 999, 77494.5703125, 77494.5703125, { 206652.1875, 154989.140625, 116241.859375, 103326.09375, 103326.09375 } });
-  returning.emplace(1000, Rand_prop_point{ 1000, 78220, 78220, { 208586.671875, 156440, 117330, 104293.34375, 104293.34375 } });
-  returning.emplace(1001, Rand_prop_point{ 1001, 78952.21875, 78952.21875, { 210539.25, 157904.4375, 118428.328125, 105269.6328125, 105269.6328125 } });
-  returning.emplace(1002, Rand_prop_point{ 1002, 79691.2890625, 79691.2890625, { 212510.109375, 159382.578125, 119536.9375, 106255.046875, 106255.046875 } });
-  returning.emplace(1003, Rand_prop_point{ 1003, 80437.28125, 80437.28125, { 214499.40625, 160874.5625, 120655.921875, 107249.703125, 107249.703125 } });
-  returning.emplace(1004, Rand_prop_point{ 1004, 81190.25, 81190.25, { 216507.34375, 162380.5, 121785.3828125, 108253.671875, 108253.671875 } });
-  returning.emplace(1005, Rand_prop_point{ 1005, 81950.2734375, 81950.2734375, { 218534.0625, 163900.546875, 122925.40625, 109267.03125, 109267.03125 } });
-  returning.emplace(1006, Rand_prop_point{ 1006, 82717.4140625, 82717.4140625, { 220579.765625, 165434.828125, 124076.1171875, 110289.8828125, 110289.8828125 } });
-  returning.emplace(1007, Rand_prop_point{ 1007, 83491.734375, 83491.734375, { 222644.609375, 166983.46875, 125237.59375, 111322.296875, 111322.296875 } });
-  returning.emplace(1008, Rand_prop_point{ 1008, 84273.296875, 84273.296875, { 224728.796875, 168546.59375, 126409.953125, 112364.3984375, 112364.3984375 } });
-  returning.emplace(1009, Rand_prop_point{ 1009, 85062.1796875, 85062.1796875, { 226832.484375, 170124.359375, 127593.2734375, 113416.2421875, 113416.2421875 } });
-  returning.emplace(1010, Rand_prop_point{ 1010, 85858.4453125, 85858.4453125, { 228955.859375, 171716.890625, 128787.671875, 114477.9296875, 114477.9296875 } });
-  returning.emplace(1011, Rand_prop_point{ 1011, 86662.171875, 86662.171875, { 231099.125, 173324.34375, 129993.2578125, 115549.5625, 115549.5625 } });
-  returning.emplace(1012, Rand_prop_point{ 1012, 87473.4140625, 87473.4140625, { 233262.4375, 174946.828125, 131210.125, 116631.21875, 116631.21875 } });
-  returning.emplace(1013, Rand_prop_point{ 1013, 88292.25, 88292.25, { 235446.015625, 176584.5, 132438.375, 117723.0078125, 117723.0078125 } });
-  returning.emplace(1014, Rand_prop_point{ 1014, 89118.7578125, 89118.7578125, { 237650.015625, 178237.515625, 133678.140625, 118825.0078125, 118825.0078125 } });
-  returning.emplace(1015, Rand_prop_point{ 1015, 89953, 89953, { 239874.65625, 179906, 134929.5, 119937.328125, 119937.328125 } });
-  returning.emplace(1016, Rand_prop_point{ 1016, 90795.046875, 90795.046875, { 242120.125, 181590.09375, 136192.578125, 121060.0625, 121060.0625 } });
-  returning.emplace(1017, Rand_prop_point{ 1017, 91644.984375, 91644.984375, { 244386.625, 183289.96875, 137467.46875, 122193.3125, 122193.3125 } });
-  returning.emplace(1018, Rand_prop_point{ 1018, 92502.875, 92502.875, { 246674.328125, 185005.75, 138754.3125, 123337.15625, 123337.15625 } });
-  returning.emplace(1019, Rand_prop_point{ 1019, 93368.7890625, 93368.7890625, { 248983.4375, 186737.578125, 140053.1875, 124491.71875, 124491.71875 } });
-  returning.emplace(1020, Rand_prop_point{ 1020, 94242.8203125, 94242.8203125, { 251314.171875, 188485.640625, 141364.21875, 125657.09375, 125657.09375 } });
-  returning.emplace(1021, Rand_prop_point{ 1021, 95125.0234375, 95125.0234375, { 253666.734375, 190250.046875, 142687.53125, 126833.3671875, 126833.3671875 } });
-  returning.emplace(1022, Rand_prop_point{ 1022, 96015.4921875, 96015.4921875, { 256041.3125, 192030.984375, 144023.234375, 128020.65625, 128020.65625 } });
-  returning.emplace(1023, Rand_prop_point{ 1023, 96914.2890625, 96914.2890625, { 258438.109375, 193828.578125, 145371.4375, 129219.046875, 129219.046875 } });
-  returning.emplace(1024, Rand_prop_point{ 1024, 97821.5078125, 97821.5078125, { 260857.359375, 195643.015625, 146732.265625, 130428.6796875, 130428.6796875 } });
-  returning.emplace(1025, Rand_prop_point{ 1025, 98737.21875, 98737.21875, { 263299.25, 197474.4375, 148105.828125, 131649.625, 131649.625 } });
-  returning.emplace(1026, Rand_prop_point{ 1026, 99661.4921875, 99661.4921875, { 265764, 199322.984375, 149492.234375, 132882, 132882 } });
-  returning.emplace(1027, Rand_prop_point{ 1027, 100594.4296875, 100594.4296875, { 268251.8125, 201188.859375, 150891.640625, 134125.90625, 134125.90625 } });
-  returning.emplace(1028, Rand_prop_point{ 1028, 101536.09375, 101536.09375, { 270762.90625, 203072.1875, 152304.140625, 135381.453125, 135381.453125 } });
-  returning.emplace(1029, Rand_prop_point{ 1029, 102486.5703125, 102486.5703125, { 273297.53125, 204973.140625, 153729.859375, 136648.765625, 136648.765625 } });
-  returning.emplace(1030, Rand_prop_point{ 1030, 103445.953125, 103445.953125, { 275855.875, 206891.890625, 155168.921875, 137927.9375, 137927.9375 } });
-  returning.emplace(1031, Rand_prop_point{ 1031, 104414.296875, 104414.296875, { 278438.15625, 208828.609375, 156621.453125, 139219.078125, 139219.078125 } });
-  returning.emplace(1032, Rand_prop_point{ 1032, 105391.7265625, 105391.7265625, { 281044.625, 210783.453125, 158087.59375, 140522.3125, 140522.3125 } });
-  returning.emplace(1033, Rand_prop_point{ 1033, 106378.296875, 106378.296875, { 283675.46875, 212756.609375, 159567.453125, 141837.734375, 141837.734375 } });
-  returning.emplace(1034, Rand_prop_point{ 1034, 107374.109375, 107374.109375, { 286330.96875, 214748.21875, 161061.171875, 143165.484375, 143165.484375 } });
-  returning.emplace(1035, Rand_prop_point{ 1035, 108379.2421875, 108379.2421875, { 289011.3125, 216758.484375, 162568.859375, 144505.65625, 144505.65625 } });
-  returning.emplace(1036, Rand_prop_point{ 1036, 109393.78125, 109393.78125, { 291716.75, 218787.5625, 164090.671875, 145858.375, 145858.375 } });
-  returning.emplace(1037, Rand_prop_point{ 1037, 110417.8125, 110417.8125, { 294447.5, 220835.625, 165626.71875, 147223.75, 147223.75 } });
-  returning.emplace(1038, Rand_prop_point{ 1038, 111451.4375, 111451.4375, { 297203.84375, 222902.875, 167177.15625, 148601.921875, 148601.921875 } });
-  returning.emplace(1039, Rand_prop_point{ 1039, 112494.7265625, 112494.7265625, { 299985.96875, 224989.46875, 168742.09375, 149992.984375, 149992.984375 } });
-  returning.emplace(1040, Rand_prop_point{ 1040, 113547.796875, 113547.796875, { 302794.125, 227095.59375, 170321.703125, 151397.0625, 151397.0625 } });
-  returning.emplace(1041, Rand_prop_point{ 1041, 114610.71875, 114610.71875, { 305628.59375, 229221.4375, 171916.078125, 152814.296875, 152814.296875 } });
-  returning.emplace(1042, Rand_prop_point{ 1042, 115683.59375, 115683.59375, { 308489.5625, 231367.1875, 173525.390625, 154244.78125, 154244.78125 } });
-  returning.emplace(1043, Rand_prop_point{ 1043, 116766.5078125, 116766.5078125, { 311377.34375, 233533.015625, 175149.765625, 155688.671875, 155688.671875 } });
-  returning.emplace(1044, Rand_prop_point{ 1044, 117859.546875, 117859.546875, { 314292.15625, 235719.109375, 176789.328125, 157146.078125, 157146.078125 } });
-  returning.emplace(1045, Rand_prop_point{ 1045, 118962.84375, 118962.84375, { 317234.25, 237925.6875, 178444.265625, 158617.125, 158617.125 } });
-  returning.emplace(1046, Rand_prop_point{ 1046, 120076.453125, 120076.453125, { 320203.875, 240152.90625, 180114.671875, 160101.9375, 160101.9375 } });
-  returning.emplace(1047, Rand_prop_point{ 1047, 121200.4921875, 121200.4921875, { 323201.3125, 242400.984375, 181800.734375, 161600.65625, 161600.65625 } });
-  returning.emplace(1048, Rand_prop_point{ 1048, 122335.046875, 122335.046875, { 326226.78125, 244670.09375, 183502.578125, 163113.390625, 163113.390625 } });
-  returning.emplace(1049, Rand_prop_point{ 1049, 123480.2265625, 123480.2265625, { 329280.59375, 246960.453125, 185220.34375, 164640.296875, 164640.296875 } });
-  returning.emplace(1050, Rand_prop_point{ 1050, 124636.1328125, 124636.1328125, { 332363, 249272.25, 186954.1875, 166181.5, 166181.5 } });
-  returning.emplace(1051, Rand_prop_point{ 1051, 125802.84375, 125802.84375, { 335474.25, 251605.6875, 188704.265625, 167737.125, 167737.125 } });
-  returning.emplace(1052, Rand_prop_point{ 1052, 126980.4765625, 126980.4765625, { 338614.625, 253960.96875, 190470.734375, 169307.3125, 169307.3125 } });
-  returning.emplace(1053, Rand_prop_point{ 1053, 128169.1484375, 128169.1484375, { 341784.40625, 256338.296875, 192253.734375, 170892.203125, 170892.203125 } });
-  returning.emplace(1054, Rand_prop_point{ 1054, 129368.953125, 129368.953125, { 344983.84375, 258737.890625, 194053.421875, 172491.921875, 172491.921875 } });
-  returning.emplace(1055, Rand_prop_point{ 1055, 130579.96875, 130579.96875, { 348213.25, 261159.9375, 195869.953125, 174106.625, 174106.625 } });
-  returning.emplace(1056, Rand_prop_point{ 1056, 131802.328125, 131802.328125, { 351472.875, 263604.65625, 197703.484375, 175736.4375, 175736.4375 } });
-  returning.emplace(1057, Rand_prop_point{ 1057, 133036.125, 133036.125, { 354763, 266072.25, 199554.1875, 177381.5, 177381.5 } });
-  returning.emplace(1058, Rand_prop_point{ 1058, 134281.484375, 134281.484375, { 358083.9375, 268562.96875, 201422.21875, 179041.96875, 179041.96875 } });
-  returning.emplace(1059, Rand_prop_point{ 1059, 135538.484375, 135538.484375, { 361435.96875, 271076.96875, 203307.734375, 180717.984375, 180717.984375 } });
-  returning.emplace(1060, Rand_prop_point{ 1060, 136807.265625, 136807.265625, { 364819.375, 273614.53125, 205210.90625, 182409.6875, 182409.6875 } });
-  returning.emplace(1061, Rand_prop_point{ 1061, 138087.921875, 138087.921875, { 368234.46875, 276175.84375, 207131.875, 184117.234375, 184117.234375 } });
-  returning.emplace(1062, Rand_prop_point{ 1062, 139380.5625, 139380.5625, { 371681.5, 278761.125, 209070.84375, 185840.75, 185840.75 } });
-  returning.emplace(1063, Rand_prop_point{ 1063, 140685.3125, 140685.3125, { 375160.8125, 281370.625, 211027.953125, 187580.40625, 187580.40625 } });
-  returning.emplace(1064, Rand_prop_point{ 1064, 142002.265625, 142002.265625, { 378672.6875, 284004.53125, 213003.390625, 189336.34375, 189336.34375 } });
-  returning.emplace(1065, Rand_prop_point{ 1065, 143331.546875, 143331.546875, { 382217.4375, 286663.09375, 214997.3125, 191108.71875, 191108.71875 } });
-  returning.emplace(1066, Rand_prop_point{ 1066, 144673.265625, 144673.265625, { 385795.40625, 289346.53125, 217009.90625, 192897.703125, 192897.703125 } });
-  returning.emplace(1067, Rand_prop_point{ 1067, 146027.5625, 146027.5625, { 389406.8125, 292055.125, 219041.34375, 194703.40625, 194703.40625 } });
-  returning.emplace(1068, Rand_prop_point{ 1068, 147394.53125, 147394.53125, { 393052.0625, 294789.0625, 221091.78125, 196526.03125, 196526.03125 } });
-  returning.emplace(1069, Rand_prop_point{ 1069, 148774.28125, 148774.28125, { 396731.4375, 297548.5625, 223161.421875, 198365.71875, 198365.71875 } });
-  returning.emplace(1070, Rand_prop_point{ 1070, 150166.96875, 150166.96875, { 400445.21875, 300333.9375, 225250.4375, 200222.609375, 200222.609375 } });
-  returning.emplace(1071, Rand_prop_point{ 1071, 151572.671875, 151572.671875, { 404193.8125, 303145.34375, 227359.015625, 202096.90625, 202096.90625 } });
-  returning.emplace(1072, Rand_prop_point{ 1072, 152991.546875, 152991.546875, { 407977.46875, 305983.09375, 229487.328125, 203988.734375, 203988.734375 } });
-  returning.emplace(1073, Rand_prop_point{ 1073, 154423.703125, 154423.703125, { 411796.53125, 308847.40625, 231635.5625, 205898.265625, 205898.265625 } });
-  returning.emplace(1074, Rand_prop_point{ 1074, 155869.265625, 155869.265625, { 415651.375, 311738.53125, 233803.890625, 207825.6875, 207825.6875 } });
-  returning.emplace(1075, Rand_prop_point{ 1075, 157328.359375, 157328.359375, { 419542.28125, 314656.71875, 235992.53125, 209771.140625, 209771.140625 } });
-  returning.emplace(1076, Rand_prop_point{ 1076, 158801.109375, 158801.109375, { 423469.625, 317602.21875, 238201.65625, 211734.8125, 211734.8125 } });
-  returning.emplace(1077, Rand_prop_point{ 1077, 160287.640625, 160287.640625, { 427433.71875, 320575.28125, 240431.46875, 213716.859375, 213716.859375 } });
-  returning.emplace(1078, Rand_prop_point{ 1078, 161788.09375, 161788.09375, { 431434.9375, 323576.1875, 242682.15625, 215717.46875, 215717.46875 } });
-  returning.emplace(1079, Rand_prop_point{ 1079, 163302.59375, 163302.59375, { 435473.59375, 326605.1875, 244953.90625, 217736.796875, 217736.796875 } });
-  returning.emplace(1080, Rand_prop_point{ 1080, 164831.28125, 164831.28125, { 439550.0625, 329662.5625, 247246.921875, 219775.03125, 219775.03125 } });
-  returning.emplace(1081, Rand_prop_point{ 1081, 166374.265625, 166374.265625, { 443664.6875, 332748.53125, 249561.390625, 221832.34375, 221832.34375 } });
-  returning.emplace(1082, Rand_prop_point{ 1082, 167931.6875, 167931.6875, { 447817.84375, 335863.375, 251897.546875, 223908.921875, 223908.921875 } });
-  returning.emplace(1083, Rand_prop_point{ 1083, 169503.703125, 169503.703125, { 452009.875, 339007.40625, 254255.546875, 226004.9375, 226004.9375 } });
-  returning.emplace(1084, Rand_prop_point{ 1084, 171090.421875, 171090.421875, { 456241.15625, 342180.84375, 256635.640625, 228120.578125, 228120.578125 } });
-  returning.emplace(1085, Rand_prop_point{ 1085, 172692, 172692, { 460512.03125, 345384, 259038.015625, 230256.015625, 230256.015625 } });
-  returning.emplace(1086, Rand_prop_point{ 1086, 174308.578125, 174308.578125, { 464822.875, 348617.15625, 261462.859375, 232411.4375, 232411.4375 } });
-  returning.emplace(1087, Rand_prop_point{ 1087, 175940.28125, 175940.28125, { 469174.09375, 351880.5625, 263910.40625, 234587.046875, 234587.046875 } });
-  returning.emplace(1088, Rand_prop_point{ 1088, 177587.265625, 177587.265625, { 473566.03125, 355174.53125, 266380.875, 236783.015625, 236783.015625 } });
-  returning.emplace(1089, Rand_prop_point{ 1089, 179249.65625, 179249.65625, { 477999.0625, 358499.3125, 268874.46875, 238999.53125, 238999.53125 } });
-  returning.emplace(1090, Rand_prop_point{ 1090, 180927.609375, 180927.609375, { 482473.625, 361855.21875, 271391.40625, 241236.8125, 241236.8125 } });
-  returning.emplace(1091, Rand_prop_point{ 1091, 182621.28125, 182621.28125, { 486990.0625, 365242.5625, 273931.90625, 243495.03125, 243495.03125 } });
-  returning.emplace(1092, Rand_prop_point{ 1092, 184330.796875, 184330.796875, { 491548.78125, 368661.59375, 276496.1875, 245774.390625, 245774.390625 } });
-  returning.emplace(1093, Rand_prop_point{ 1093, 186056.3125, 186056.3125, { 496150.1875, 372112.625, 279084.46875, 248075.09375, 248075.09375 } });
-  returning.emplace(1094, Rand_prop_point{ 1094, 187797.984375, 187797.984375, { 500794.625, 375595.96875, 281697, 250397.3125, 250397.3125 } });
-  returning.emplace(1095, Rand_prop_point{ 1095, 189555.96875, 189555.96875, { 505482.59375, 379111.9375, 284333.9375, 252741.296875, 252741.296875 } });
-  returning.emplace(1096, Rand_prop_point{ 1096, 191330.40625, 191330.40625, { 510214.40625, 382660.8125, 286995.59375, 255107.203125, 255107.203125 } });
-  returning.emplace(1097, Rand_prop_point{ 1097, 193121.453125, 193121.453125, { 514990.53125, 386242.90625, 289682.15625, 257495.265625, 257495.265625 } });
-  returning.emplace(1098, Rand_prop_point{ 1098, 194929.265625, 194929.265625, { 519811.34375, 389858.53125, 292393.875, 259905.671875, 259905.671875 } });
-  returning.emplace(1099, Rand_prop_point{ 1099, 196753.984375, 196753.984375, { 524677.3125, 393507.96875, 295131, 262338.65625, 262338.65625 } });
-  returning.emplace(1100, Rand_prop_point{ 1100, 198595.8125, 198595.8125, { 529588.8125, 397191.625, 297893.71875, 264794.40625, 264794.40625 } });
-  returning.emplace(1101, Rand_prop_point{ 1101, 200454.859375, 200454.859375, { 534546.3125, 400909.71875, 300682.28125, 267273.15625, 267273.15625 } });
-  returning.emplace(1102, Rand_prop_point{ 1102, 202331.328125, 202331.328125, { 539550.1875, 404662.65625, 303496.96875, 269775.09375, 269775.09375 } });
-  returning.emplace(1103, Rand_prop_point{ 1103, 204225.34375, 204225.34375, { 544600.9375, 408450.6875, 306338.03125, 272300.46875, 272300.46875 } });
-  returning.emplace(1104, Rand_prop_point{ 1104, 206137.109375, 206137.109375, { 549698.9375, 412274.21875, 309205.65625, 274849.46875, 274849.46875 } });
-  returning.emplace(1105, Rand_prop_point{ 1105, 208066.75, 208066.75, { 554844.6875, 416133.5, 312100.125, 277422.34375, 277422.34375 } });
-  returning.emplace(1106, Rand_prop_point{ 1106, 210014.46875, 210014.46875, { 560038.5625, 420028.9375, 315021.6875, 280019.28125, 280019.28125 } });
-  returning.emplace(1107, Rand_prop_point{ 1107, 211980.40625, 211980.40625, { 565281.125, 423960.8125, 317970.625, 282640.5625, 282640.5625 } });
-  returning.emplace(1108, Rand_prop_point{ 1108, 213964.765625, 213964.765625, { 570572.6875, 427929.53125, 320947.15625, 285286.34375, 285286.34375 } });
-  returning.emplace(1109, Rand_prop_point{ 1109, 215967.6875, 215967.6875, { 575913.8125, 431935.375, 323951.53125, 287956.90625, 287956.90625 } });
-  returning.emplace(1110, Rand_prop_point{ 1110, 217989.359375, 217989.359375, { 581304.9375, 435978.71875, 326984.03125, 290652.46875, 290652.46875 } });
-  returning.emplace(1111, Rand_prop_point{ 1111, 220029.96875, 220029.96875, { 586746.5625, 440059.9375, 330044.9375, 293373.28125, 293373.28125 } });
-  returning.emplace(1112, Rand_prop_point{ 1112, 222089.671875, 222089.671875, { 592239.125, 444179.34375, 333134.5, 296119.5625, 296119.5625 } });
-  returning.emplace(1113, Rand_prop_point{ 1113, 224168.640625, 224168.640625, { 597783.0625, 448337.28125, 336252.96875, 298891.53125, 298891.53125 } });
-  returning.emplace(1114, Rand_prop_point{ 1114, 226267.09375, 226267.09375, { 603378.9375, 452534.1875, 339400.625, 301689.46875, 301689.46875 } });
-  returning.emplace(1115, Rand_prop_point{ 1115, 228385.171875, 228385.171875, { 609027.125, 456770.34375, 342577.78125, 304513.5625, 304513.5625 } });
-  returning.emplace(1116, Rand_prop_point{ 1116, 230523.09375, 230523.09375, { 614728.25, 461046.1875, 345784.625, 307364.125, 307364.125 } });
-  returning.emplace(1117, Rand_prop_point{ 1117, 232681.015625, 232681.015625, { 620482.75, 465362.03125, 349021.53125, 310241.375, 310241.375 } });
-  returning.emplace(1118, Rand_prop_point{ 1118, 234859.15625, 234859.15625, { 626291.0625, 469718.3125, 352288.71875, 313145.53125, 313145.53125 } });
-  returning.emplace(1119, Rand_prop_point{ 1119, 237057.671875, 237057.671875, { 632153.75, 474115.34375, 355586.5, 316076.875, 316076.875 } });
-  returning.emplace(1120, Rand_prop_point{ 1120, 239276.765625, 239276.765625, { 638071.375, 478553.53125, 358915.15625, 319035.6875, 319035.6875 } });
-  returning.emplace(1121, Rand_prop_point{ 1121, 241516.640625, 241516.640625, { 644044.375, 483033.28125, 362274.96875, 322022.1875, 322022.1875 } });
-  returning.emplace(1122, Rand_prop_point{ 1122, 243777.46875, 243777.46875, { 650073.25, 487554.9375, 365666.21875, 325036.625, 325036.625 } });
-  returning.emplace(1123, Rand_prop_point{ 1123, 246059.484375, 246059.484375, { 656158.625, 492118.96875, 369089.21875, 328079.3125, 328079.3125 } });
-  returning.emplace(1124, Rand_prop_point{ 1124, 248362.84375, 248362.84375, { 662300.9375, 496725.6875, 372544.25, 331150.46875, 331150.46875 } });
-  returning.emplace(1125, Rand_prop_point{ 1125, 250687.765625, 250687.765625, { 668500.6875, 501375.53125, 376031.65625, 334250.34375, 334250.34375 } });
-  returning.emplace(1126, Rand_prop_point{ 1126, 253034.453125, 253034.453125, { 674758.5625, 506068.90625, 379551.6875, 337379.28125, 337379.28125 } });
-  returning.emplace(1127, Rand_prop_point{ 1127, 255403.109375, 255403.109375, { 681075, 510806.21875, 383104.65625, 340537.5, 340537.5 } });
-  returning.emplace(1128, Rand_prop_point{ 1128, 257793.9375, 257793.9375, { 687450.5, 515587.875, 386690.90625, 343725.25, 343725.25 } });
-  returning.emplace(1129, Rand_prop_point{ 1129, 260207.15625, 260207.15625, { 693885.75, 520414.3125, 390310.71875, 346942.875, 346942.875 } });
-  returning.emplace(1130, Rand_prop_point{ 1130, 262642.96875, 262642.96875, { 700381.1875, 525285.9375, 393964.4375, 350190.59375, 350190.59375 } });
-  returning.emplace(1131, Rand_prop_point{ 1131, 265101.5625, 265101.5625, { 706937.5, 530203.125, 397652.34375, 353468.75, 353468.75 } });
-  returning.emplace(1132, Rand_prop_point{ 1132, 267583.1875, 267583.1875, { 713555.125, 535166.375, 401374.75, 356777.5625, 356777.5625 } });
-  returning.emplace(1133, Rand_prop_point{ 1133, 270088.03125, 270088.03125, { 720234.75, 540176.0625, 405132.03125, 360117.375, 360117.375 } });
-  returning.emplace(1134, Rand_prop_point{ 1134, 272616.3125, 272616.3125, { 726976.875, 545232.625, 408924.46875, 363488.4375, 363488.4375 } });
-  returning.emplace(1135, Rand_prop_point{ 1135, 275168.28125, 275168.28125, { 733782.0625, 550336.5625, 412752.40625, 366891.03125, 366891.03125 } });
-  returning.emplace(1136, Rand_prop_point{ 1136, 277744.125, 277744.125, { 740651, 555488.25, 416616.1875, 370325.5, 370325.5 } });
-  returning.emplace(1137, Rand_prop_point{ 1137, 280344.09375, 280344.09375, { 747584.25, 560688.1875, 420516.15625, 373792.125, 373792.125 } });
-  returning.emplace(1138, Rand_prop_point{ 1138, 282968.40625, 282968.40625, { 754582.375, 565936.8125, 424452.59375, 377291.1875, 377291.1875 } });
-  returning.emplace(1139, Rand_prop_point{ 1139, 285617.28125, 285617.28125, { 761646.0625, 571234.5625, 428425.90625, 380823.03125, 380823.03125 } });
-  returning.emplace(1140, Rand_prop_point{ 1140, 288290.9375, 288290.9375, { 768775.8125, 576581.875, 432436.40625, 384387.90625, 384387.90625 } });
-  returning.emplace(1141, Rand_prop_point{ 1141, 290989.625, 290989.625, { 775972.3125, 581979.25, 436484.4375, 387986.15625, 387986.15625 } });
-  returning.emplace(1142, Rand_prop_point{ 1142, 293713.59375, 293713.59375, { 783236.1875, 587427.1875, 440570.375, 391618.09375, 391618.09375 } });
-  returning.emplace(1143, Rand_prop_point{ 1143, 296463.03125, 296463.03125, { 790568.125, 592926.0625, 444694.5625, 395284.0625, 395284.0625 } });
-  returning.emplace(1144, Rand_prop_point{ 1144, 299238.21875, 299238.21875, { 797968.625, 598476.4375, 448857.34375, 398984.3125, 398984.3125 } });
-  returning.emplace(1145, Rand_prop_point{ 1145, 302039.40625, 302039.40625, { 805438.375, 604078.8125, 453059.09375, 402719.1875, 402719.1875 } });
-  returning.emplace(1146, Rand_prop_point{ 1146, 304866.78125, 304866.78125, { 812978.125, 609733.5625, 457300.1875, 406489.0625, 406489.0625 } });
-  returning.emplace(1147, Rand_prop_point{ 1147, 307720.65625, 307720.65625, { 820588.375, 615441.3125, 461580.96875, 410294.1875, 410294.1875 } });
-  returning.emplace(1148, Rand_prop_point{ 1148, 310601.21875, 310601.21875, { 828269.9375, 621202.4375, 465901.84375, 414134.96875, 414134.96875 } });
-  returning.emplace(1149, Rand_prop_point{ 1149, 313508.75, 313508.75, { 836023.375, 627017.5, 470263.15625, 418011.6875, 418011.6875 } });
-  returning.emplace(1150, Rand_prop_point{ 1150, 316443.53125, 316443.53125, { 843849.375, 632887.0625, 474665.28125, 421924.6875, 421924.6875 } });
-  returning.emplace(1151, Rand_prop_point{ 1151, 319405.75, 319405.75, { 851748.6875, 638811.5, 479108.625, 425874.34375, 425874.34375 } });
-  returning.emplace(1152, Rand_prop_point{ 1152, 322395.71875, 322395.71875, { 859721.875, 644791.4375, 483593.5625, 429860.9375, 429860.9375 } });
-  returning.emplace(1153, Rand_prop_point{ 1153, 325413.65625, 325413.65625, { 867769.75, 650827.3125, 488120.5, 433884.875, 433884.875 } });
-  returning.emplace(1154, Rand_prop_point{ 1154, 328459.84375, 328459.84375, { 875892.9375, 656919.6875, 492689.78125, 437946.46875, 437946.46875 } });
-  returning.emplace(1155, Rand_prop_point{ 1155, 331534.5625, 331534.5625, { 884092.1875, 663069.125, 497301.84375, 442046.09375, 442046.09375 } });
-  returning.emplace(1156, Rand_prop_point{ 1156, 334638.0625, 334638.0625, { 892368.1875, 669276.125, 501957.09375, 446184.09375, 446184.09375 } });
-  returning.emplace(1157, Rand_prop_point{ 1157, 337770.625, 337770.625, { 900721.625, 675541.25, 506655.9375, 450360.8125, 450360.8125 } });
-  returning.emplace(1158, Rand_prop_point{ 1158, 340932.5, 340932.5, { 909153.3125, 681865, 511398.75, 454576.65625, 454576.65625 } });
-  returning.emplace(1159, Rand_prop_point{ 1159, 344123.96875, 344123.96875, { 917663.875, 688247.9375, 516185.9375, 458831.9375, 458831.9375 } });
-  returning.emplace(1160, Rand_prop_point{ 1160, 347345.3125, 347345.3125, { 926254.125, 694690.625, 521017.96875, 463127.0625, 463127.0625 } });
-  returning.emplace(1161, Rand_prop_point{ 1161, 350596.8125, 350596.8125, { 934924.8125, 701193.625, 525895.1875, 467462.40625, 467462.40625 } });
-  returning.emplace(1162, Rand_prop_point{ 1162, 353878.75, 353878.75, { 943676.6875, 707757.5, 530818.125, 471838.34375, 471838.34375 } });
-  returning.emplace(1163, Rand_prop_point{ 1163, 357191.40625, 357191.40625, { 952510.4375, 714382.8125, 535787.125, 476255.21875, 476255.21875 } });
-  returning.emplace(1164, Rand_prop_point{ 1164, 360535.09375, 360535.09375, { 961426.875, 721070.1875, 540802.625, 480713.4375, 480713.4375 } });
-  returning.emplace(1165, Rand_prop_point{ 1165, 363910.0625, 363910.0625, { 970426.8125, 727820.125, 545865.0625, 485213.40625, 485213.40625 } });
-  returning.emplace(1166, Rand_prop_point{ 1166, 367316.625, 367316.625, { 979511, 734633.25, 550974.9375, 489755.5, 489755.5 } });
-  returning.emplace(1167, Rand_prop_point{ 1167, 370755.0625, 370755.0625, { 988680.1875, 741510.125, 556132.625, 494340.09375, 494340.09375 } });
-  returning.emplace(1168, Rand_prop_point{ 1168, 374225.71875, 374225.71875, { 997935.25, 748451.4375, 561338.5625, 498967.625, 498967.625 } });
-  returning.emplace(1169, Rand_prop_point{ 1169, 377728.84375, 377728.84375, { 1007276.875, 755457.6875, 566593.25, 503638.4375, 503638.4375 } });
-  returning.emplace(1170, Rand_prop_point{ 1170, 381264.75, 381264.75, { 1016706, 762529.5, 571897.125, 508353, 508353 } });
-  returning.emplace(1171, Rand_prop_point{ 1171, 384833.78125, 384833.78125, { 1026223.375, 769667.5625, 577250.6875, 513111.71875, 513111.71875 } });
-  returning.emplace(1172, Rand_prop_point{ 1172, 388436.21875, 388436.21875, { 1035829.875, 776872.4375, 582654.3125, 517914.9375, 517914.9375 } });
-  returning.emplace(1173, Rand_prop_point{ 1173, 392072.375, 392072.375, { 1045526.3125, 784144.75, 588108.5625, 522763.15625, 522763.15625 } });
-  returning.emplace(1174, Rand_prop_point{ 1174, 395742.5625, 395742.5625, { 1055313.5, 791485.125, 593613.8125, 527656.75, 527656.75 } });
-  returning.emplace(1175, Rand_prop_point{ 1175, 399447.09375, 399447.09375, { 1065192.25, 798894.1875, 599170.6875, 532596.125, 532596.125 } });
-  returning.emplace(1176, Rand_prop_point{ 1176, 403186.34375, 403186.34375, { 1075163.5, 806372.6875, 604779.5, 537581.75, 537581.75 } });
-  returning.emplace(1177, Rand_prop_point{ 1177, 406960.5625, 406960.5625, { 1085228.125, 813921.125, 610440.8125, 542614.0625, 542614.0625 } });
-  returning.emplace(1178, Rand_prop_point{ 1178, 410770.125, 410770.125, { 1095387, 821540.25, 616155.1875, 547693.5, 547693.5 } });
-  returning.emplace(1179, Rand_prop_point{ 1179, 414615.34375, 414615.34375, { 1105640.875, 829230.6875, 621923, 552820.4375, 552820.4375 } });
-  returning.emplace(1180, Rand_prop_point{ 1180, 418496.5625, 418496.5625, { 1115990.875, 836993.125, 627744.8125, 557995.4375, 557995.4375 } });
-  returning.emplace(1181, Rand_prop_point{ 1181, 422414.09375, 422414.09375, { 1126437.625, 844828.1875, 633621.1875, 563218.8125, 563218.8125 } });
-  returning.emplace(1182, Rand_prop_point{ 1182, 426368.3125, 426368.3125, { 1136982.25, 852736.625, 639552.5, 568491.125, 568491.125 } });
-  returning.emplace(1183, Rand_prop_point{ 1183, 430359.5625, 430359.5625, { 1147625.5, 860719.125, 645539.375, 573812.75, 573812.75 } });
-  returning.emplace(1184, Rand_prop_point{ 1184, 434388.15625, 434388.15625, { 1158368.375, 868776.3125, 651582.25, 579184.1875, 579184.1875 } });
-  returning.emplace(1185, Rand_prop_point{ 1185, 438454.46875, 438454.46875, { 1169211.875, 876908.9375, 657681.6875, 584605.9375, 584605.9375 } });
-  returning.emplace(1186, Rand_prop_point{ 1186, 442558.84375, 442558.84375, { 1180156.875, 885117.6875, 663838.25, 590078.4375, 590078.4375 } });
-  returning.emplace(1187, Rand_prop_point{ 1187, 446701.65625, 446701.65625, { 1191204.375, 893403.3125, 670052.4375, 595602.1875, 595602.1875 } });
-  returning.emplace(1188, Rand_prop_point{ 1188, 450883.21875, 450883.21875, { 1202355.25, 901766.4375, 676324.8125, 601177.625, 601177.625 } });
-  returning.emplace(1189, Rand_prop_point{ 1189, 455103.9375, 455103.9375, { 1213610.5, 910207.875, 682655.9375, 606805.25, 606805.25 } });
-  returning.emplace(1190, Rand_prop_point{ 1190, 459364.15625, 459364.15625, { 1224971.125, 918728.3125, 689046.25, 612485.5625, 612485.5625 } });
-  returning.emplace(1191, Rand_prop_point{ 1191, 463664.28125, 463664.28125, { 1236438.125, 927328.5625, 695496.4375, 618219.0625, 618219.0625 } });
-  returning.emplace(1192, Rand_prop_point{ 1192, 468004.65625, 468004.65625, { 1248012.375, 936009.3125, 702006.9375, 624006.1875, 624006.1875 } });
-  returning.emplace(1193, Rand_prop_point{ 1193, 472385.625, 472385.625, { 1259695, 944771.25, 708578.4375, 629847.5, 629847.5 } });
-  returning.emplace(1194, Rand_prop_point{ 1194, 476807.65625, 476807.65625, { 1271487, 953615.3125, 715211.4375, 635743.5, 635743.5 } });
-  returning.emplace(1195, Rand_prop_point{ 1195, 481271.03125, 481271.03125, { 1283389.5, 962542.0625, 721906.5625, 641694.75, 641694.75 } });
-  returning.emplace(1196, Rand_prop_point{ 1196, 485776.21875, 485776.21875, { 1295403.25, 971552.4375, 728664.3125, 647701.625, 647701.625 } });
-  returning.emplace(1197, Rand_prop_point{ 1197, 490323.5625, 490323.5625, { 1307529.5, 980647.125, 735485.375, 653764.75, 653764.75 } });
-  returning.emplace(1198, Rand_prop_point{ 1198, 494913.5, 494913.5, { 1319769.375, 989827, 742370.25, 659884.6875, 659884.6875 } });
-  returning.emplace(1199, Rand_prop_point{ 1199, 499546.375, 499546.375, { 1332123.75, 999092.75, 749319.5625, 666061.875, 666061.875 } });
-  returning.emplace(1200, Rand_prop_point{ 1200, 504222.65625, 504222.65625, { 1344593.75, 1008445.3125, 756333.9375, 672296.875, 672296.875 } });
-  returning.emplace(1201, Rand_prop_point{ 1201, 508942.6875, 508942.6875, { 1357180.5, 1017885.375, 763414, 678590.25, 678590.25 } });
-  returning.emplace(1202, Rand_prop_point{ 1202, 513706.875, 513706.875, { 1369885, 1027413.8125, 770560.3125, 684942.5, 684942.5 } });
-  returning.emplace(1203, Rand_prop_point{ 1203, 518515.6875, 518515.6875, { 1382708.5, 1037031.375, 777773.5625, 691354.25, 691354.25 } });
-  returning.emplace(1204, Rand_prop_point{ 1204, 523369.53125, 523369.53125, { 1395652.125, 1046739.125, 785054.3125, 697826.0625, 697826.0625 } });
-  returning.emplace(1205, Rand_prop_point{ 1205, 528268.8125, 528268.8125, { 1408716.75, 1056537.625, 792403.1875, 704358.375, 704358.375 } });
-  returning.emplace(1206, Rand_prop_point{ 1206, 533213.9375, 533213.9375, { 1421903.75, 1066427.875, 799820.875, 710951.875, 710951.875 } });
-  returning.emplace(1207, Rand_prop_point{ 1207, 538205.3125, 538205.3125, { 1435214.25, 1076410.625, 807308, 717607.125, 717607.125 } });
-  returning.emplace(1208, Rand_prop_point{ 1208, 543243.5, 543243.5, { 1448649.25, 1086487, 814865.25, 724324.625, 724324.625 } });
-  returning.emplace(1209, Rand_prop_point{ 1209, 548328.8125, 548328.8125, { 1462210.125, 1096657.625, 822493.1875, 731105.0625, 731105.0625 } });
-  returning.emplace(1210, Rand_prop_point{ 1210, 553461.6875, 553461.6875, { 1475897.875, 1106923.375, 830192.5625, 737948.9375, 737948.9375 } });
-  returning.emplace(1211, Rand_prop_point{ 1211, 558642.6875, 558642.6875, { 1489713.75, 1117285.375, 837964, 744856.875, 744856.875 } });
-  returning.emplace(1212, Rand_prop_point{ 1212, 563872.125, 563872.125, { 1503659, 1127744.25, 845808.1875, 751829.5, 751829.5 } });
-  returning.emplace(1213, Rand_prop_point{ 1213, 569150.5, 569150.5, { 1517734.75, 1138301, 853725.8125, 758867.375, 758867.375 } });
-  returning.emplace(1214, Rand_prop_point{ 1214, 574478.375, 574478.375, { 1531942.25, 1148956.75, 861717.5, 765971.125, 765971.125 } });
-  returning.emplace(1215, Rand_prop_point{ 1215, 579856.0625, 579856.0625, { 1546282.75, 1159712.125, 869784.0625, 773141.375, 773141.375 } });
-  returning.emplace(1216, Rand_prop_point{ 1216, 585284.0625, 585284.0625, { 1560757.5, 1170568.125, 877926.125, 780378.75, 780378.75 } });
-  returning.emplace(1217, Rand_prop_point{ 1217, 590762.9375, 590762.9375, { 1575367.75, 1181525.875, 886144.375, 787683.875, 787683.875 } });
-  returning.emplace(1218, Rand_prop_point{ 1218, 596293.0625, 596293.0625, { 1590114.875, 1192586.125, 894439.5625, 795057.4375, 795057.4375 } });
-  returning.emplace(1219, Rand_prop_point{ 1219, 601874.9375, 601874.9375, { 1604999.875, 1203749.875, 902812.4375, 802499.9375, 802499.9375 } });
-  returning.emplace(1220, Rand_prop_point{ 1220, 607509.125, 607509.125, { 1620024.25, 1215018.25, 911263.6875, 810012.125, 810012.125 } });
-  returning.emplace(1221, Rand_prop_point{ 1221, 613196, 613196, { 1635189.375, 1226392, 919794, 817594.6875, 817594.6875 } });
-  returning.emplace(1222, Rand_prop_point{ 1222, 618936.125, 618936.125, { 1650496.375, 1237872.25, 928404.1875, 825248.1875, 825248.1875 } });
-  returning.emplace(1223, Rand_prop_point{ 1223, 624730, 624730, { 1665946.625, 1249460, 937095, 832973.3125, 832973.3125 } });
-  returning.emplace(1224, Rand_prop_point{ 1224, 630578.125, 630578.125, { 1681541.625, 1261156.25, 945867.1875, 840770.8125, 840770.8125 } });
-  returning.emplace(1225, Rand_prop_point{ 1225, 636480.9375, 636480.9375, { 1697282.5, 1272961.875, 954721.4375, 848641.25, 848641.25 } });
-  returning.emplace(1226, Rand_prop_point{ 1226, 642439.0625, 642439.0625, { 1713170.875, 1284878.125, 963658.5625, 856585.4375, 856585.4375 } });
-  returning.emplace(1227, Rand_prop_point{ 1227, 648452.9375, 648452.9375, { 1729207.875, 1296905.875, 972679.375, 864603.9375, 864603.9375 } });
-  returning.emplace(1228, Rand_prop_point{ 1228, 654523.125, 654523.125, { 1745395, 1309046.25, 981784.625, 872697.5, 872697.5 } });
-  returning.emplace(1229, Rand_prop_point{ 1229, 660650.125, 660650.125, { 1761733.625, 1321300.25, 990975.125, 880866.8125, 880866.8125 } });
-  returning.emplace(1230, Rand_prop_point{ 1230, 666834.4375, 666834.4375, { 1778225.25, 1333668.875, 1000251.6875, 889112.625, 889112.625 } });
-  returning.emplace(1231, Rand_prop_point{ 1231, 673076.6875, 673076.6875, { 1794871.125, 1346153.375, 1009615, 897435.5625, 897435.5625 } });
-  returning.emplace(1232, Rand_prop_point{ 1232, 679377.375, 679377.375, { 1811673, 1358754.75, 1019066.125, 905836.5, 905836.5 } });
-  returning.emplace(1233, Rand_prop_point{ 1233, 685737, 685737, { 1828632, 1371474, 1028605.5, 914316, 914316 } });
-  returning.emplace(1234, Rand_prop_point{ 1234, 692156.1875, 692156.1875, { 1845749.875, 1384312.375, 1038234.3125, 922874.9375, 922874.9375 } });
-  returning.emplace(1235, Rand_prop_point{ 1235, 698635.5, 698635.5, { 1863028, 1397271, 1047953.3125, 931514, 931514 } });
-  returning.emplace(1236, Rand_prop_point{ 1236, 705175.4375, 705175.4375, { 1880467.75, 1410350.875, 1057763.125, 940233.875, 940233.875 } });
-  returning.emplace(1237, Rand_prop_point{ 1237, 711776.5625, 711776.5625, { 1898070.875, 1423553.125, 1067664.875, 949035.4375, 949035.4375 } });
-  returning.emplace(1238, Rand_prop_point{ 1238, 718439.5, 718439.5, { 1915838.75, 1436879, 1077659.25, 957919.375, 957919.375 } });
-  returning.emplace(1239, Rand_prop_point{ 1239, 725164.8125, 725164.8125, { 1933772.875, 1450329.625, 1087747.25, 966886.4375, 966886.4375 } });
-  returning.emplace(1240, Rand_prop_point{ 1240, 731953.125, 731953.125, { 1951874.875, 1463906.25, 1097929.625, 975937.4375, 975937.4375 } });
-  returning.emplace(1241, Rand_prop_point{ 1241, 738804.9375, 738804.9375, { 1970146.375, 1477609.875, 1108207.375, 985073.1875, 985073.1875 } });
-  returning.emplace(1242, Rand_prop_point{ 1242, 745720.875, 745720.875, { 1988589, 1491441.75, 1118581.25, 994294.5, 994294.5 } });
-  returning.emplace(1243, Rand_prop_point{ 1243, 752701.5625, 752701.5625, { 2007204.125, 1505403.125, 1129052.375, 1003602.125, 1003602.125 } });
-  returning.emplace(1244, Rand_prop_point{ 1244, 759747.625, 759747.625, { 2025993.625, 1519495.25, 1139621.375, 1012996.8125, 1012996.8125 } });
-  returning.emplace(1245, Rand_prop_point{ 1245, 766859.625, 766859.625, { 2044959, 1533719.25, 1150289.375, 1022479.5, 1022479.5 } });
-  returning.emplace(1246, Rand_prop_point{ 1246, 774038.1875, 774038.1875, { 2064101.875, 1548076.375, 1161057.25, 1032050.875, 1032050.875 } });
-  returning.emplace(1247, Rand_prop_point{ 1247, 781283.9375, 781283.9375, { 2083423.875, 1562567.875, 1171926, 1041711.875, 1041711.875 } });
-  returning.emplace(1248, Rand_prop_point{ 1248, 788597.5625, 788597.5625, { 2102926.75, 1577195.125, 1182896.375, 1051463.375, 1051463.375 } });
-  returning.emplace(1249, Rand_prop_point{ 1249, 795979.625, 795979.625, { 2122612.25, 1591959.25, 1193969.5, 1061306.125, 1061306.125 } });
-  returning.emplace(1250, Rand_prop_point{ 1250, 803430.8125, 803430.8125, { 2142482.25, 1606861.625, 1205146.25, 1071241.125, 1071241.125 } });
-  returning.emplace(1251, Rand_prop_point{ 1251, 810951.75, 810951.75, { 2162538, 1621903.5, 1216427.625, 1081269, 1081269 } });
-  returning.emplace(1252, Rand_prop_point{ 1252, 818543.0625, 818543.0625, { 2182781.5, 1637086.125, 1227814.625, 1091390.75, 1091390.75 } });
-  returning.emplace(1253, Rand_prop_point{ 1253, 826205.4375, 826205.4375, { 2203214.5, 1652410.875, 1239308.125, 1101607.25, 1101607.25 } });
-  returning.emplace(1254, Rand_prop_point{ 1254, 833939.5625, 833939.5625, { 2223838.75, 1667879.125, 1250909.375, 1111919.375, 1111919.375 } });
-  returning.emplace(1255, Rand_prop_point{ 1255, 841746.0625, 841746.0625, { 2244656.25, 1683492.125, 1262619.125, 1122328.125, 1122328.125 } });
-  returning.emplace(1256, Rand_prop_point{ 1256, 849625.625, 849625.625, { 2265668.5, 1699251.25, 1274438.5, 1132834.25, 1132834.25 } });
-  returning.emplace(1257, Rand_prop_point{ 1257, 857579, 857579, { 2286877.25, 1715158, 1286368.5, 1143438.625, 1143438.625 } });
-  returning.emplace(1258, Rand_prop_point{ 1258, 865606.8125, 865606.8125, { 2308284.75, 1731213.625, 1298410.25, 1154142.375, 1154142.375 } });
-  returning.emplace(1259, Rand_prop_point{ 1259, 873709.75, 873709.75, { 2329892.75, 1747419.5, 1310564.625, 1164946.375, 1164946.375 } });
-  returning.emplace(1260, Rand_prop_point{ 1260, 881888.5625, 881888.5625, { 2351702.75, 1763777.125, 1322832.875, 1175851.375, 1175851.375 } });
-  returning.emplace(1261, Rand_prop_point{ 1261, 890143.9375, 890143.9375, { 2373717, 1780287.875, 1335215.875, 1186858.5, 1186858.5 } });
-  returning.emplace(1262, Rand_prop_point{ 1262, 898476.5625, 898476.5625, { 2395937.5, 1796953.125, 1347714.875, 1197968.75, 1197968.75 } });
-  returning.emplace(1263, Rand_prop_point{ 1263, 906887.1875, 906887.1875, { 2418366, 1813774.375, 1360330.75, 1209183, 1209183 } });
-  returning.emplace(1264, Rand_prop_point{ 1264, 915376.5625, 915376.5625, { 2441004.25, 1830753.125, 1373064.875, 1220502.125, 1220502.125 } });
-  returning.emplace(1265, Rand_prop_point{ 1265, 923945.4375, 923945.4375, { 2463854.5, 1847890.875, 1385918.125, 1231927.25, 1231927.25 } });
-  returning.emplace(1266, Rand_prop_point{ 1266, 932594.5, 932594.5, { 2486918.5, 1865189, 1398891.75, 1243459.25, 1243459.25 } });
-  returning.emplace(1267, Rand_prop_point{ 1267, 941324.5, 941324.5, { 2510198.75, 1882649, 1411986.75, 1255099.375, 1255099.375 } });
-  returning.emplace(1268, Rand_prop_point{ 1268, 950136.25, 950136.25, { 2533696.75, 1900272.5, 1425204.375, 1266848.375, 1266848.375 } });
-  returning.emplace(1269, Rand_prop_point{ 1269, 959030.5, 959030.5, { 2557414.5, 1918061, 1438545.75, 1278707.25, 1278707.25 } });
-  returning.emplace(1270, Rand_prop_point{ 1270, 968008, 968008, { 2581354.5, 1936016, 1452012, 1290677.25, 1290677.25 } });
-  returning.emplace(1271, Rand_prop_point{ 1271, 977069.5, 977069.5, { 2605518.75, 1954139, 1465604.25, 1302759.375, 1302759.375 } });
-  returning.emplace(1272, Rand_prop_point{ 1272, 986215.875, 986215.875, { 2629909, 1972431.75, 1479323.75, 1314954.5, 1314954.5 } });
-  returning.emplace(1273, Rand_prop_point{ 1273, 995447.8125, 995447.8125, { 2654527.5, 1990895.625, 1493171.75, 1327263.75, 1327263.75 } });
-  returning.emplace(1274, Rand_prop_point{ 1274, 1004766.1875, 1004766.1875, { 2679376.5, 2009532.375, 1507149.375, 1339688.25, 1339688.25 } });
-  returning.emplace(1275, Rand_prop_point{ 1275, 1014171.8125, 1014171.8125, { 2704458.25, 2028343.625, 1521257.75, 1352229.125, 1352229.125 } });
-  returning.emplace(1276, Rand_prop_point{ 1276, 1023665.5, 1023665.5, { 2729774.75, 2047331, 1535498.25, 1364887.375, 1364887.375 } });
-  returning.emplace(1277, Rand_prop_point{ 1277, 1033248.125, 1033248.125, { 2755328, 2066496.125, 1549872.125, 1377664, 1377664 } });
-  returning.emplace(1278, Rand_prop_point{ 1278, 1042920.3125, 1042920.3125, { 2781120.75, 2085840.625, 1564380.375, 1390560.375, 1390560.375 } });
-  returning.emplace(1279, Rand_prop_point{ 1279, 1052683.125, 1052683.125, { 2807154.75, 2105366.25, 1579024.625, 1403577.375, 1403577.375 } });
-  returning.emplace(1280, Rand_prop_point{ 1280, 1062537.25, 1062537.25, { 2833432.75, 2125074.5, 1593805.875, 1416716.375, 1416716.375 } });
-  returning.emplace(1281, Rand_prop_point{ 1281, 1072483.625, 1072483.625, { 2859956.5, 2144967.25, 1608725.5, 1429978.25, 1429978.25 } });
-  returning.emplace(1282, Rand_prop_point{ 1282, 1082523.125, 1082523.125, { 2886728.5, 2165046.25, 1623784.75, 1443364.25, 1443364.25 } });
-  returning.emplace(1283, Rand_prop_point{ 1283, 1092656.625, 1092656.625, { 2913751.25, 2185313.25, 1638985, 1456875.625, 1456875.625 } });
-  returning.emplace(1284, Rand_prop_point{ 1284, 1102885, 1102885, { 2941026.75, 2205770, 1654327.625, 1470513.375, 1470513.375 } });
-  returning.emplace(1285, Rand_prop_point{ 1285, 1113209.125, 1113209.125, { 2968557.75, 2226418.25, 1669813.75, 1484278.875, 1484278.875 } });
-  returning.emplace(1286, Rand_prop_point{ 1286, 1123629.875, 1123629.875, { 2996346.5, 2247259.75, 1685444.875, 1498173.25, 1498173.25 } });
-  returning.emplace(1287, Rand_prop_point{ 1287, 1134148.25, 1134148.25, { 3024395.25, 2268296.5, 1701222.375, 1512197.625, 1512197.625 } });
-  returning.emplace(1288, Rand_prop_point{ 1288, 1144765, 1144765, { 3052706.75, 2289530, 1717147.5, 1526353.375, 1526353.375 } });
-  returning.emplace(1289, Rand_prop_point{ 1289, 1155481.125, 1155481.125, { 3081283, 2310962.25, 1733221.75, 1540641.5, 1540641.5 } });
-  returning.emplace(1290, Rand_prop_point{ 1290, 1166297.625, 1166297.625, { 3110127, 2332595.25, 1749446.375, 1555063.5, 1555063.5 } });
-  returning.emplace(1291, Rand_prop_point{ 1291, 1177215.375, 1177215.375, { 3139241, 2354430.75, 1765823, 1569620.5, 1569620.5 } });
-  returning.emplace(1292, Rand_prop_point{ 1292, 1188235.25, 1188235.25, { 3168627.25, 2376470.5, 1782352.875, 1584313.625, 1584313.625 } });
-  returning.emplace(1293, Rand_prop_point{ 1293, 1199358.375, 1199358.375, { 3198288.75, 2398716.75, 1799037.5, 1599144.375, 1599144.375 } });
-  returning.emplace(1294, Rand_prop_point{ 1294, 1210585.5, 1210585.5, { 3228228, 2421171, 1815878.25, 1614114, 1614114 } });
-  returning.emplace(1295, Rand_prop_point{ 1295, 1221917.875, 1221917.875, { 3258447.5, 2443835.75, 1832876.75, 1629223.75, 1629223.75 } });
-  returning.emplace(1296, Rand_prop_point{ 1296, 1233356.25, 1233356.25, { 3288950, 2466712.5, 1850034.25, 1644475, 1644475 } });
-  returning.emplace(1297, Rand_prop_point{ 1297, 1244901.625, 1244901.625, { 3319737.75, 2489803.25, 1867352.5, 1659868.875, 1659868.875 } });
-  returning.emplace(1298, Rand_prop_point{ 1298, 1256555.25, 1256555.25, { 3350813.75, 2513110.5, 1884832.75, 1675406.875, 1675406.875 } });
-  returning.emplace(1299, Rand_prop_point{ 1299, 1268317.75, 1268317.75, { 3382180.75, 2536635.5, 1902476.75, 1691090.375, 1691090.375 } });
-  returning.emplace(1300, Rand_prop_point{ 1300, 1280190.5, 1280190.5, { 3413841.5, 2560381, 1920285.75, 1706920.75, 1706920.75 } });
-  returning.emplace(2, Rand_prop_point{ 2, 0, 0, { 0, 0, 0, 0, 0 } });
-  returning.emplace(3, Rand_prop_point{ 3, 0, 0, { 0, 0, 0, 0, 0 } });
-  return returning;
-}();
+namespace {
+  //indexed by ilvl - 1, gaps have ilvl 0
+  constexpr std::array<dbc::Rand_prop_point, 1300> RAND_PROP_POINT{
+    dbc::Rand_prop_point{ 1, 0, 0, { 0, 0, 0, 0, 0 } },
+    dbc::Rand_prop_point{ 2, 0, 0, { 0, 0, 0, 0, 0 } },
+    dbc::Rand_prop_point{ 3, 0, 0, { 0, 0, 0, 0, 0 } },
+    dbc::Rand_prop_point{ 4, 0.08483823389, 0.08483823389, { 1.4543697834, 1.09077727795, 0.81808298826, 0.7271848917, 0.7271848917 } },
+    dbc::Rand_prop_point{ 5, 0.10496228933, 0.10496228933, { 1.73730683327, 1.30298006535, 0.97723507881, 0.86865341663, 0.86865341663 } },
+    dbc::Rand_prop_point{ 6, 0.12607884407, 0.12607884407, { 2.01726150513, 1.51294600964, 1.13470947742, 1.00863075256, 1.00863075256 } },
+    dbc::Rand_prop_point{ 7, 0.14995892346, 0.14995892346, { 2.32194471359, 1.74145841599, 1.30609381199, 1.1609723568, 1.1609723568 } },
+    dbc::Rand_prop_point{ 8, 0.15589654446, 0.15589654446, { 2.41388201714, 1.81041145325, 1.35780858994, 1.20694100857, 1.20694100857 } },
+    dbc::Rand_prop_point{ 9, 0.18081028759, 0.18081028759, { 2.71215415001, 2.03411579132, 1.52558672428, 1.356077075, 1.356077075 } },
+    dbc::Rand_prop_point{ 10, 0.18512012064, 0.18512012064, { 2.77680182457, 2.08260130882, 1.56195104122, 1.38840091228, 1.38840091228 } },
+    dbc::Rand_prop_point{ 11, 0.21277911961, 0.21277911961, { 3.09496903419, 2.32122659683, 1.74092006683, 1.5474845171, 1.5474845171 } },
+    dbc::Rand_prop_point{ 12, 0.21756544709, 0.21756544709, { 3.16458845139, 2.37344121933, 1.78008103371, 1.58229422569, 1.58229422569 } },
+    dbc::Rand_prop_point{ 13, 0.24557211995, 0.24557211995, { 3.46690058708, 2.60017538071, 1.95013165474, 1.73345029354, 1.73345029354 } },
+    dbc::Rand_prop_point{ 14, 0.25080174208, 0.25080174208, { 3.5407307148, 2.6555480957, 1.99166095257, 1.7703653574, 1.7703653574 } },
+    dbc::Rand_prop_point{ 15, 0.25614273548, 0.25614273548, { 3.61613297462, 2.71209979057, 2.03407478333, 1.80806648731, 1.80806648731 } },
+    dbc::Rand_prop_point{ 16, 0.29836267233, 0.29836267233, { 3.89698195457, 2.92273640633, 2.19205236435, 1.94849097729, 1.94849097729 } },
+    dbc::Rand_prop_point{ 17, 0.30143922567, 0.30143922567, { 3.93716549873, 2.95287418365, 2.21465563774, 1.96858274937, 1.96858274937 } },
+    dbc::Rand_prop_point{ 18, 0.3075338304, 0.3075338304, { 4.01676845551, 3.01257634163, 2.25943231583, 2.00838422775, 2.00838422775 } },
+    dbc::Rand_prop_point{ 19, 0.3105494678, 0.3105494678, { 4.05615615845, 3.04211711884, 2.28158783913, 2.02807807922, 2.02807807922 } },
+    dbc::Rand_prop_point{ 20, 0.35903385282, 0.35903385282, { 4.35192584991, 3.26394414902, 2.44795823097, 2.17596292496, 2.17596292496 } },
+    dbc::Rand_prop_point{ 21, 0.36594343185, 0.36594343185, { 4.43567800522, 3.3267583847, 2.49506878853, 2.21783900261, 2.21783900261 } },
+    dbc::Rand_prop_point{ 22, 0.37298595905, 0.37298595905, { 4.52104187012, 3.39078140259, 2.54308605194, 2.26052093506, 2.26052093506 } },
+    dbc::Rand_prop_point{ 23, 0.42831286788, 0.42831286788, { 4.83173179626, 3.62379860878, 2.71784901619, 2.41586589813, 2.41586589813 } },
+    dbc::Rand_prop_point{ 24, 0.43617707491, 0.43617707491, { 4.92044639587, 3.69033479691, 2.76775121689, 2.46022319794, 2.46022319794 } },
+    dbc::Rand_prop_point{ 25, 0.44418567419, 0.44418567419, { 5.01079034805, 3.75809264183, 2.81856942177, 2.50539517403, 2.50539517403 } },
+    dbc::Rand_prop_point{ 26, 0.51129156351, 0.51129156351, { 5.38201665878, 4.03651237488, 3.02738428116, 2.69100832939, 2.69100832939 } },
+    dbc::Rand_prop_point{ 27, 0.52026706934, 0.52026706934, { 5.4764957428, 4.1073718071, 3.08052873611, 2.7382478714, 2.7382478714 } },
+    dbc::Rand_prop_point{ 28, 0.59575849771, 0.59575849771, { 5.86592960358, 4.39944696426, 3.29958534241, 2.93296480179, 2.93296480179 } },
+    dbc::Rand_prop_point{ 29, 0.60577684641, 0.60577684641, { 5.96457195282, 4.4734287262, 3.35507178307, 2.98228597641, 2.98228597641 } },
+    dbc::Rand_prop_point{ 30, 0.61210107803, 0.61210107803, { 6.02684164047, 4.52013111115, 3.39009833336, 3.01342082024, 3.01342082024 } },
+    dbc::Rand_prop_point{ 31, 0.69843620062, 0.69843620062, { 6.44710302353, 4.83532714844, 3.62649559975, 3.22355151176, 3.22355151176 } },
+    dbc::Rand_prop_point{ 32, 0.70869153738, 0.70869153738, { 6.54176807404, 4.90632629395, 3.67974472046, 3.27088403702, 3.27088403702 } },
+    dbc::Rand_prop_point{ 33, 0.71909755468, 0.71909755468, { 6.6378235817, 4.97836780548, 3.73377561569, 3.31891179085, 3.31891179085 } },
+    dbc::Rand_prop_point{ 34, 0.8131890893, 0.8131890893, { 7.05204629898, 5.28903484344, 3.96677613258, 3.52602314949, 3.52602314949 } },
+    dbc::Rand_prop_point{ 35, 0.82466506958, 0.82466506958, { 7.15156745911, 5.36367559433, 4.02275657654, 3.57578372955, 3.57578372955 } },
+    dbc::Rand_prop_point{ 36, 0.93178129196, 0.93178129196, { 7.60637807846, 5.70478343964, 4.27858781815, 3.80318903923, 3.80318903923 } },
+    dbc::Rand_prop_point{ 37, 0.94443875551, 0.94443875551, { 7.70970439911, 5.78227806091, 4.33670854568, 3.85485219955, 3.85485219955 } },
+    dbc::Rand_prop_point{ 38, 0.95726817846, 0.95726817846, { 7.81443405151, 5.86082553864, 4.3956193924, 3.90721702576, 3.90721702576 } },
+    dbc::Rand_prop_point{ 39, 1.07747268677, 1.07747268677, { 8.29489803314, 6.22117376328, 4.66588020325, 4.14744901657, 4.14744901657 } },
+    dbc::Rand_prop_point{ 40, 1.09216415882, 1.09216415882, { 8.40799999237, 6.3060002327, 4.72950029373, 4.20399999619, 4.20399999619 } },
+    dbc::Rand_prop_point{ 41, 1.22517442703, 1.22517442703, { 8.91035938263, 6.68276977539, 5.01207733154, 4.45517969131, 4.45517969131 } },
+    dbc::Rand_prop_point{ 42, 1.24217176437, 1.24217176437, { 9.03397655487, 6.77548217773, 5.0816116333, 4.51698827744, 4.51698827744 } },
+    dbc::Rand_prop_point{ 43, 1.25940489769, 1.25940489769, { 9.15930843353, 6.86948108673, 5.15211105347, 4.57965421677, 4.57965421677 } },
+    dbc::Rand_prop_point{ 44, 1.35445094109, 1.35445094109, { 9.32095241547, 6.99071455002, 5.2430357933, 4.66047620773, 4.66047620773 } },
+    dbc::Rand_prop_point{ 45, 1.41621863842, 1.41621863842, { 9.74602127075, 7.30951547623, 5.48213672638, 4.87301063538, 4.87301063538 } },
+    dbc::Rand_prop_point{ 46, 1.56253921986, 1.56253921986, { 10.19047355652, 7.64285516739, 5.73214149475, 5.09523677826, 5.09523677826 } },
+    dbc::Rand_prop_point{ 47, 1.63473820686, 1.63473820686, { 10.66133594513, 7.99600219727, 5.99700164795, 5.33066797256, 5.33066797256 } },
+    dbc::Rand_prop_point{ 48, 1.71027326584, 1.71027326584, { 11.15395545959, 8.36546707153, 6.27410030365, 5.5769777298, 5.5769777298 } },
+    dbc::Rand_prop_point{ 49, 1.89253640175, 1.89253640175, { 11.71395874023, 8.78546905518, 6.58910131454, 5.85697937012, 5.85697937012 } },
+    dbc::Rand_prop_point{ 50, 1.98038065434, 1.98038065434, { 12.2576751709, 9.19325637817, 6.89494228363, 6.12883758545, 6.12883758545 } },
+    dbc::Rand_prop_point{ 51, 2.07230234146, 2.07230234146, { 12.82662963867, 9.619972229, 7.21497917175, 6.41331481934, 6.41331481934 } },
+    dbc::Rand_prop_point{ 52, 2.28219652176, 2.28219652176, { 13.42468643188, 10.06851482391, 7.55138587952, 6.71234321594, 6.71234321594 } },
+    dbc::Rand_prop_point{ 53, 2.38860654831, 2.38860654831, { 14.05062675476, 10.53797054291, 7.90347766876, 7.02531337738, 7.02531337738 } },
+    dbc::Rand_prop_point{ 54, 2.62712144852, 2.62712144852, { 14.70575332642, 11.02931499481, 8.27198600769, 7.35287666321, 7.35287666321 } },
+    dbc::Rand_prop_point{ 55, 2.75016546249, 2.75016546249, { 15.39451217651, 11.54588413239, 8.65941238403, 7.69725608826, 7.69725608826 } },
+    dbc::Rand_prop_point{ 56, 2.79275107384, 2.79275107384, { 15.63289165497, 11.72466945648, 8.79350185394, 7.81644582748, 7.81644582748 } },
+    dbc::Rand_prop_point{ 57, 2.97655582428, 2.97655582428, { 15.87496376038, 11.90622329712, 8.92966747284, 7.93748188019, 7.93748188019 } },
+    dbc::Rand_prop_point{ 58, 3.0232527256, 3.0232527256, { 16.12401390076, 12.0930109024, 9.06975841522, 8.06200695038, 8.06200695038 } },
+    dbc::Rand_prop_point{ 59, 3.07068228722, 3.07068228722, { 16.37697219849, 12.28272914886, 9.21204662323, 8.18848609924, 8.18848609924 } },
+    dbc::Rand_prop_point{ 60, 3.25714612007, 3.25714612007, { 16.57053756714, 12.42790222168, 9.32092666626, 8.28526878357, 8.28526878357 } },
+    dbc::Rand_prop_point{ 61, 3.30890774727, 3.30890774727, { 16.83387184143, 12.62540340424, 9.46905231476, 8.41693592072, 8.41693592072 } },
+    dbc::Rand_prop_point{ 62, 3.36149191856, 3.36149191856, { 17.10139083862, 12.82604217529, 9.61953163147, 8.55069541931, 8.55069541931 } },
+    dbc::Rand_prop_point{ 63, 3.5621752739, 3.5621752739, { 17.30611419678, 12.97958660126, 9.73468971252, 8.65305709839, 8.65305709839 } },
+    dbc::Rand_prop_point{ 64, 3.61950874329, 3.61950874329, { 17.58465766907, 13.18849372864, 9.89136981964, 8.79232883453, 8.79232883453 } },
+    dbc::Rand_prop_point{ 65, 3.677765131, 3.677765131, { 17.86768531799, 13.40076446533, 10.05057239532, 8.933842659, 8.933842659 } },
+    dbc::Rand_prop_point{ 66, 3.89377522469, 3.89377522469, { 18.08429718018, 13.56322288513, 10.17241668701, 9.04214859009, 9.04214859009 } },
+    dbc::Rand_prop_point{ 67, 3.95723748207, 3.95723748207, { 18.37904167175, 13.78428173065, 10.33821105957, 9.18952083588, 9.18952083588 } },
+    dbc::Rand_prop_point{ 68, 4.02173376083, 4.02173376083, { 18.67859077454, 14.00894260406, 10.50670719147, 9.33929538727, 9.33929538727 } },
+    dbc::Rand_prop_point{ 69, 4.25427055359, 4.25427055359, { 18.90786933899, 14.1809015274, 10.63567638397, 9.45393466949, 9.45393466949 } },
+    dbc::Rand_prop_point{ 70, 4.32447290421, 4.32447290421, { 19.21987915039, 14.41490936279, 10.81118202209, 9.6099395752, 9.6099395752 } },
+    dbc::Rand_prop_point{ 71, 4.39583349228, 4.39583349228, { 19.53703689575, 14.65277862549, 10.98958396912, 9.76851844788, 9.76851844788 } },
+    dbc::Rand_prop_point{ 72, 4.53699588776, 4.53699588776, { 19.77981948853, 14.83486461639, 11.12614822388, 9.88990974426, 9.88990974426 } },
+    dbc::Rand_prop_point{ 73, 4.61278533936, 4.61278533936, { 20.11023712158, 15.08267688751, 11.31200790405, 10.05511856079, 10.05511856079 } },
+    dbc::Rand_prop_point{ 74, 4.68984079361, 4.68984079361, { 20.44617271423, 15.33462905884, 11.50097179413, 10.22308635712, 10.22308635712 } },
+    dbc::Rand_prop_point{ 75, 4.83940887451, 4.83940887451, { 20.70335388184, 15.52751541138, 11.64563655853, 10.35167694092, 10.35167694092 } },
+    dbc::Rand_prop_point{ 76, 4.92123270035, 4.92123270035, { 21.05340194702, 15.79005146027, 11.84253883362, 10.52670097351, 10.52670097351 } },
+    dbc::Rand_prop_point{ 77, 5.00444030762, 5.00444030762, { 21.40936851501, 16.05702781677, 12.04277038574, 10.70468425751, 10.70468425751 } },
+    dbc::Rand_prop_point{ 78, 5.16300535202, 5.16300535202, { 21.68191337585, 16.26143455505, 12.19607543945, 10.84095668793, 10.84095668793 } },
+    dbc::Rand_prop_point{ 79, 5.25134897232, 5.25134897232, { 22.05290794373, 16.53968048096, 12.40476131439, 11.02645397186, 11.02645397186 } },
+    dbc::Rand_prop_point{ 80, 5.34120368958, 5.34120368958, { 22.4302520752, 16.8226890564, 12.6170167923, 11.2151260376, 11.2151260376 } },
+    dbc::Rand_prop_point{ 81, 5.5094037056, 5.5094037056, { 22.71919059753, 17.03939247131, 12.77954483032, 11.35959529877, 11.35959529877 } },
+    dbc::Rand_prop_point{ 82, 5.60479259491, 5.60479259491, { 23.11254692078, 17.33440971375, 13.00080680847, 11.55627346039, 11.55627346039 } },
+    dbc::Rand_prop_point{ 83, 5.70183229446, 5.70183229446, { 23.51271057129, 17.63453292847, 13.22590065002, 11.75635528564, 11.75635528564 } },
+    dbc::Rand_prop_point{ 84, 5.88035440445, 5.88035440445, { 23.81915664673, 17.86436843872, 13.39827632904, 11.90957832336, 11.90957832336 } },
+    dbc::Rand_prop_point{ 85, 5.98335838318, 5.98335838318, { 24.23638916016, 18.17729187012, 13.63296890259, 12.11819458008, 12.11819458008 } },
+    dbc::Rand_prop_point{ 86, 6.08816671371, 6.08816671371, { 24.6609287262, 18.49569702148, 13.87177276611, 12.3304643631, 12.3304643631 } },
+    dbc::Rand_prop_point{ 87, 6.27775144577, 6.27775144577, { 24.98607444763, 18.73955726624, 14.05466747284, 12.49303722382, 12.49303722382 } },
+    dbc::Rand_prop_point{ 88, 6.36052131653, 6.36052131653, { 25.31550788879, 18.98663139343, 14.23997306824, 12.6577539444, 12.6577539444 } },
+    dbc::Rand_prop_point{ 89, 6.47322654724, 6.47322654724, { 25.76408576965, 19.32306289673, 14.49229812622, 12.88204288483, 12.88204288483 } },
+    dbc::Rand_prop_point{ 90, 6.67377471924, 6.67377471924, { 26.10767745972, 19.58075714111, 14.68556785584, 13.05383872986, 13.05383872986 } },
+    dbc::Rand_prop_point{ 91, 6.76277685165, 6.76277685165, { 26.4558506012, 19.84188842773, 14.8814163208, 13.2279253006, 13.2279253006 } },
+    dbc::Rand_prop_point{ 92, 6.8839802742, 6.8839802742, { 26.92999649048, 20.19749832153, 15.14812278748, 13.46499824524, 13.46499824524 } },
+    dbc::Rand_prop_point{ 93, 6.97682762146, 6.97682762146, { 27.29321289063, 20.46990966797, 15.35243225098, 13.64660644531, 13.64660644531 } },
+    dbc::Rand_prop_point{ 94, 7.19194507599, 7.19194507599, { 27.66132736206, 20.74599647522, 15.55949687958, 13.83066368103, 13.83066368103 } },
+    dbc::Rand_prop_point{ 95, 7.32229804993, 7.32229804993, { 28.16268539429, 21.12201309204, 15.84150981903, 14.08134269714, 14.08134269714 } },
+    dbc::Rand_prop_point{ 96, 7.42216444016, 7.42216444016, { 28.54678726196, 21.4100894928, 16.05756759644, 14.27339363098, 14.27339363098 } },
+    dbc::Rand_prop_point{ 97, 7.64998912811, 7.64998912811, { 28.93612861633, 21.70209693909, 16.27657318115, 14.46806430817, 14.46806430817 } },
+    dbc::Rand_prop_point{ 98, 7.75432491302, 7.75432491302, { 29.3307800293, 21.99808502197, 16.49856376648, 14.66539001465, 14.66539001465 } },
+    dbc::Rand_prop_point{ 99, 7.89644145966, 7.89644145966, { 29.86833763123, 22.40125274658, 16.80093955994, 14.93416881561, 14.93416881561 } },
+    dbc::Rand_prop_point{ 100, 8.13780879974, 8.13780879974, { 30.28021812439, 22.7101650238, 17.03262329102, 15.14010906219, 15.14010906219 } },
+    dbc::Rand_prop_point{ 101, 8.25002861023, 8.25002861023, { 30.69778060913, 23.02333641052, 17.26750183105, 15.34889030457, 15.34889030457 } },
+    dbc::Rand_prop_point{ 102, 8.4029006958, 8.4029006958, { 31.26660919189, 23.44995689392, 17.5874671936, 15.63330459595, 15.63330459595 } },
+    dbc::Rand_prop_point{ 103, 8.52004623413, 8.52004623413, { 31.70249938965, 23.77687454224, 17.832654953, 15.85124969482, 15.85124969482 } },
+    dbc::Rand_prop_point{ 104, 8.77945709229, 8.77945709229, { 32.14446640015, 24.10835075378, 18.0812625885, 16.07223320007, 16.07223320007 } },
+    dbc::Rand_prop_point{ 105, 8.94391727448, 8.94391727448, { 32.74660873413, 24.55995559692, 18.41996765137, 16.37330436707, 16.37330436707 } },
+    dbc::Rand_prop_point{ 106, 9.06995677948, 9.06995677948, { 33.20808029175, 24.90605926514, 18.67954444885, 16.60404014587, 16.60404014587 } },
+    dbc::Rand_prop_point{ 107, 9.3451051712, 9.3451051712, { 33.6760559082, 25.25704193115, 18.94278144836, 16.8380279541, 16.8380279541 } },
+    dbc::Rand_prop_point{ 108, 9.47679805756, 9.47679805756, { 34.15062332153, 25.61296844482, 19.20972633362, 17.07531166077, 17.07531166077 } },
+    dbc::Rand_prop_point{ 109, 9.65623950958, 9.65623950958, { 34.79725646973, 26.09794425964, 19.5734577179, 17.39862823486, 17.39862823486 } },
+    dbc::Rand_prop_point{ 110, 9.94818115234, 9.94818115234, { 35.29288482666, 26.46966171265, 19.85224723816, 17.64644241333, 17.64644241333 } },
+    dbc::Rand_prop_point{ 111, 10.08987617493, 10.08987617493, { 35.79557037354, 26.8466758728, 20.13500785828, 17.89778518677, 17.89778518677 } },
+    dbc::Rand_prop_point{ 112, 10.28296661377, 10.28296661377, { 36.48059082031, 27.36044311523, 20.52033233643, 18.24029541016, 18.24029541016 } },
+    dbc::Rand_prop_point{ 113, 10.43098163605, 10.43098163605, { 37.00569915771, 27.75427436829, 20.81570625305, 18.50284957886, 18.50284957886 } },
+    dbc::Rand_prop_point{ 114, 10.7453584671, 10.7453584671, { 37.5383682251, 28.15377616882, 21.11533164978, 18.76918411255, 18.76918411255 } },
+    dbc::Rand_prop_point{ 115, 10.90002918243, 10.90002918243, { 38.07870483398, 28.55902862549, 21.41927146912, 19.03935241699, 19.03935241699 } },
+    dbc::Rand_prop_point{ 116, 11.05857181549, 11.05857181549, { 38.63256454468, 28.97442245483, 21.7308177948, 19.31628227234, 19.31628227234 } },
+    dbc::Rand_prop_point{ 117, 11.39089584351, 11.39089584351, { 39.194480896, 29.395860672, 22.04689598084, 19.597240448, 19.597240448 } },
+    dbc::Rand_prop_point{ 118, 11.55657863617, 11.55657863617, { 39.76457214355, 29.82342720032, 22.36757087708, 19.88228607178, 19.88228607178 } },
+    dbc::Rand_prop_point{ 119, 11.78241062164, 11.78241062164, { 40.54162597656, 30.40621948242, 22.80466461182, 20.27081298828, 20.27081298828 } },
+    dbc::Rand_prop_point{ 120, 11.95556354523, 11.95556354523, { 41.13742828369, 30.85307121277, 23.13980293274, 20.56871414185, 20.56871414185 } },
+    dbc::Rand_prop_point{ 121, 12.31388568878, 12.31388568878, { 41.74198532104, 31.30648803711, 23.47986602783, 20.87099266052, 20.87099266052 } },
+    dbc::Rand_prop_point{ 122, 12.49485015869, 12.49485015869, { 42.35542297363, 31.76656913757, 23.82492637634, 21.17771148682, 21.17771148682 } },
+    dbc::Rand_prop_point{ 123, 12.68035888672, 12.68035888672, { 42.98426818848, 32.23820114136, 24.17864990234, 21.49213409424, 21.49213409424 } },
+    dbc::Rand_prop_point{ 124, 13.0594701767, 13.0594701767, { 43.62244796753, 32.71683502197, 24.53762626648, 21.81122398376, 21.81122398376 } },
+    dbc::Rand_prop_point{ 125, 13.25336170197, 13.25336170197, { 44.27010345459, 33.20257568359, 24.9019317627, 22.13505172729, 22.13505172729 } },
+    dbc::Rand_prop_point{ 126, 13.45013237, 13.45013237, { 44.92737197876, 33.69552993774, 25.27164649963, 22.46368598938, 22.46368598938 } },
+    dbc::Rand_prop_point{ 127, 13.65185165405, 13.65185165405, { 45.60117340088, 34.20088195801, 25.65065956116, 22.80058670044, 22.80058670044 } },
+    dbc::Rand_prop_point{ 128, 14.05909347534, 14.05909347534, { 46.28507995605, 34.71380996704, 26.03535842896, 23.14253997803, 23.14253997803 } },
+    dbc::Rand_prop_point{ 129, 14.26994514465, 14.26994514465, { 46.97924423218, 35.23443222046, 26.42582511902, 23.48962211609, 23.48962211609 } },
+    dbc::Rand_prop_point{ 130, 14.48610973358, 14.48610973358, { 47.69089508057, 35.76817321777, 26.82612991333, 23.84544754028, 23.84544754028 } },
+    dbc::Rand_prop_point{ 131, 14.70554924011, 14.70554924011, { 48.41333007813, 36.30999755859, 27.23249816895, 24.20666503906, 24.20666503906 } },
+    dbc::Rand_prop_point{ 132, 15.14332962036, 15.14332962036, { 49.14670562744, 36.86003112793, 27.64502334595, 24.57335281372, 24.57335281372 } },
+    dbc::Rand_prop_point{ 133, 15.37272453308, 15.37272453308, { 49.89119338989, 37.41839599609, 28.06379699707, 24.94559669495, 24.94559669495 } },
+    dbc::Rand_prop_point{ 134, 15.60790920258, 15.60790920258, { 50.65447235107, 37.99085617065, 28.49314117432, 25.32723617554, 25.32723617554 } },
+    dbc::Rand_prop_point{ 135, 16.07169723511, 16.07169723511, { 51.42942810059, 38.57207107544, 28.92905426025, 25.71471405029, 25.71471405029 } },
+    dbc::Rand_prop_point{ 136, 16.31757545471, 16.31757545471, { 52.2162437439, 39.16218185425, 29.37163543701, 26.10812187195, 26.10812187195 } },
+    dbc::Rand_prop_point{ 137, 16.56721687317, 16.56721687317, { 53.01509094238, 39.76131820679, 29.82098960876, 26.50754547119, 26.50754547119 } },
+    dbc::Rand_prop_point{ 138, 16.82316970825, 16.82316970825, { 53.83414459229, 40.37561035156, 30.28170585632, 26.91707229614, 26.91707229614 } },
+    dbc::Rand_prop_point{ 139, 17.42473983765, 17.42473983765, { 54.66585159302, 40.99938964844, 30.74954223633, 27.33292579651, 27.33292579651 } },
+    dbc::Rand_prop_point{ 140, 17.69394302368, 17.69394302368, { 55.51041030884, 41.6328086853, 31.2246055603, 27.75520515442, 27.75520515442 } },
+    dbc::Rand_prop_point{ 141, 17.87660217285, 17.87660217285, { 56.08345413208, 42.06259155273, 31.54694366455, 28.04172706604, 28.04172706604 } },
+    dbc::Rand_prop_point{ 142, 18.15547561646, 18.15547561646, { 56.95835494995, 42.71876525879, 32.03907394409, 28.47917747498, 28.47917747498 } },
+    dbc::Rand_prop_point{ 143, 18.80024337769, 18.80024337769, { 57.84690093994, 43.3851776123, 32.53888320923, 28.92345046997, 28.92345046997 } },
+    dbc::Rand_prop_point{ 144, 19.09352493286, 19.09352493286, { 58.74930953979, 44.06198120117, 33.04648590088, 29.3746547699, 29.3746547699 } },
+    dbc::Rand_prop_point{ 145, 19.3942565918, 19.3942565918, { 59.67463684082, 44.75597763062, 33.56698226929, 29.83731842041, 29.83731842041 } },
+    dbc::Rand_prop_point{ 146, 19.69972419739, 19.69972419739, { 60.6145324707, 45.46089935303, 34.09567642212, 30.30726623535, 30.30726623535 } },
+    dbc::Rand_prop_point{ 147, 20.3948097229, 20.3948097229, { 61.56923675537, 46.17692947388, 34.63269424438, 30.78461837769, 30.78461837769 } },
+    dbc::Rand_prop_point{ 148, 20.7160358429, 20.7160358429, { 62.53897857666, 46.90423202515, 35.17817306519, 31.26948928833, 31.26948928833 } },
+    dbc::Rand_prop_point{ 149, 21.04543685913, 21.04543685913, { 63.53339385986, 47.65004730225, 35.73753356934, 31.76669692993, 31.76669692993 } },
+    dbc::Rand_prop_point{ 150, 21.78347396851, 21.78347396851, { 64.54362487793, 48.40771865845, 36.30578994751, 32.27181243896, 32.27181243896 } },
+    dbc::Rand_prop_point{ 151, 22.12984848022, 22.12984848022, { 65.56992340088, 49.17744064331, 36.88307952881, 32.78496170044, 32.78496170044 } },
+    dbc::Rand_prop_point{ 152, 22.48172950745, 22.48172950745, { 66.61253356934, 49.959400177, 37.46955108643, 33.30626678467, 33.30626678467 } },
+    dbc::Rand_prop_point{ 153, 22.84258651733, 22.84258651733, { 67.68173980713, 50.761302948, 38.07097625732, 33.84086990356, 33.84086990356 } },
+    dbc::Rand_prop_point{ 154, 23.63903617859, 23.63903617859, { 68.76810455322, 51.57608032227, 38.6820602417, 34.38405227661, 34.38405227661 } },
+    dbc::Rand_prop_point{ 155, 24.01846885681, 24.01846885681, { 69.87191009521, 52.40393066406, 39.30294799805, 34.93595504761, 34.93595504761 } },
+    dbc::Rand_prop_point{ 156, 24.27599906921, 24.27599906921, { 70.62108612061, 52.9658164978, 39.72436141968, 35.3105430603, 35.3105430603 } },
+    dbc::Rand_prop_point{ 157, 24.66930389404, 24.66930389404, { 71.76524353027, 53.8239364624, 40.36795043945, 35.88262176514, 35.88262176514 } },
+    dbc::Rand_prop_point{ 158, 25.52478027344, 25.52478027344, { 72.92794036865, 54.69595718384, 41.02196884155, 36.46397018433, 36.46397018433 } },
+    dbc::Rand_prop_point{ 159, 25.93831634521, 25.93831634521, { 74.10947418213, 55.58210754395, 41.68658065796, 37.05473709106, 37.05473709106 } },
+    dbc::Rand_prop_point{ 160, 26.21901512146, 26.21901512146, { 74.91146850586, 56.18360519409, 42.13770294189, 37.45573425293, 37.45573425293 } },
+    dbc::Rand_prop_point{ 161, 26.64773750305, 26.64773750305, { 76.13639068604, 57.10229492188, 42.82672119141, 38.06819534302, 38.06819534302 } },
+    dbc::Rand_prop_point{ 162, 27.5671043396, 27.5671043396, { 77.38134765625, 58.03600692749, 43.52700805664, 38.69067382813, 38.69067382813 } },
+    dbc::Rand_prop_point{ 163, 28.01786994934, 28.01786994934, { 78.64665222168, 58.98498916626, 44.23874282837, 39.32332611084, 39.32332611084 } },
+    dbc::Rand_prop_point{ 164, 28.32386398315, 28.32386398315, { 79.5055770874, 59.6291847229, 44.72188949585, 39.7527885437, 39.7527885437 } },
+    dbc::Rand_prop_point{ 165, 28.79125595093, 28.79125595093, { 80.81755828857, 60.61317062378, 45.45987701416, 40.40877914429, 40.40877914429 } },
+    dbc::Rand_prop_point{ 166, 29.77980613709, 29.77980613709, { 82.15119171143, 61.61339187622, 46.21004486084, 41.07559585571, 41.07559585571 } },
+    dbc::Rand_prop_point{ 167, 30.27122497559, 30.27122497559, { 83.50682830811, 62.63012313843, 46.97259140015, 41.75341415405, 41.75341415405 } },
+    dbc::Rand_prop_point{ 168, 30.6048412323, 30.6048412323, { 84.42714691162, 63.32036209106, 47.49027252197, 42.21357345581, 42.21357345581 } },
+    dbc::Rand_prop_point{ 169, 32.18738174438, 32.18738174438, { 85.83301544189, 64.37476348877, 48.28107070923, 42.91650772095, 42.91650772095 } },
+    dbc::Rand_prop_point{ 170, 32.75109100342, 32.75109100342, { 87.33623504639, 65.50218200684, 49.12663269043, 43.66811752319, 43.66811752319 } },
+    dbc::Rand_prop_point{ 171, 33.35290908813, 33.35290908813, { 88.94109344482, 66.70581817627, 50.02936553955, 44.47054672241, 44.47054672241 } },
+    dbc::Rand_prop_point{ 172, 33.80961227417, 33.80961227417, { 90.15896606445, 67.61922454834, 50.7144203186, 45.07948303223, 45.07948303223 } },
+    dbc::Rand_prop_point{ 173, 34.301612854, 34.301612854, { 91.47096252441, 68.60322570801, 51.45241928101, 45.73548126221, 45.73548126221 } },
+    dbc::Rand_prop_point{ 174, 35.5541305542, 35.5541305542, { 94.81101226807, 71.1082611084, 53.3311958313, 47.40550613403, 47.40550613403 } },
+    dbc::Rand_prop_point{ 175, 35.92337417603, 36.28045272827, { 95.69853973389, 71.77390289307, 53.83042907715, 47.84926986694, 47.84926986694 } },
+    dbc::Rand_prop_point{ 176, 36.29641723633, 37.01726150513, { 96.59437561035, 72.44578552246, 54.33433532715, 48.29718780518, 48.29718780518 } },
+    dbc::Rand_prop_point{ 177, 36.67329406738, 37.76468276978, { 97.49859619141, 73.12394714355, 54.84296035767, 48.7492980957, 48.7492980957 } },
+    dbc::Rand_prop_point{ 178, 37.05405044556, 38.52285385132, { 98.411277771, 73.80846405029, 55.35634613037, 49.2056388855, 49.2056388855 } },
+    dbc::Rand_prop_point{ 179, 37.43871688843, 39.29190826416, { 99.33251190186, 74.49938201904, 55.87453842163, 49.66625595093, 49.66625595093 } },
+    dbc::Rand_prop_point{ 180, 37.82733917236, 40.0719871521, { 100.26235961914, 75.19676971436, 56.39757919312, 50.13117980957, 50.13117980957 } },
+    dbc::Rand_prop_point{ 181, 38.21995925903, 40.86322784424, { 101.20092010498, 75.90068817139, 56.92551803589, 50.60046005249, 50.60046005249 } },
+    dbc::Rand_prop_point{ 182, 38.61661148071, 41.66577148438, { 102.14826202393, 76.61119842529, 57.45839691162, 51.07413101196, 51.07413101196 } },
+    dbc::Rand_prop_point{ 183, 39.01734161377, 42.47975921631, { 103.10446929932, 77.32835388184, 57.99626541138, 51.55223464966, 51.55223464966 } },
+    dbc::Rand_prop_point{ 184, 39.42219161987, 43.30533218384, { 104.06963348389, 78.05222320557, 58.53916931152, 52.03481674194, 52.03481674194 } },
+    dbc::Rand_prop_point{ 185, 39.83120346069, 44.14264297485, { 105.04383087158, 78.78287506104, 59.08715438843, 52.52191543579, 52.52191543579 } },
+    dbc::Rand_prop_point{ 186, 40.2444152832, 44.99183273315, { 106.02715301514, 79.520362854, 59.64027023315, 53.01357269287, 53.01357269287 } },
+    dbc::Rand_prop_point{ 187, 40.66187667847, 45.85305404663, { 107.0196685791, 80.26474761963, 60.19856262207, 53.50983428955, 53.50983428955 } },
+    dbc::Rand_prop_point{ 188, 41.08362197876, 46.72645568848, { 108.02147674561, 81.01610565186, 60.76208114624, 54.0107383728, 54.0107383728 } },
+    dbc::Rand_prop_point{ 189, 41.50970458984, 47.61219024658, { 109.03266906738, 81.77449798584, 61.33087539673, 54.51633453369, 54.51633453369 } },
+    dbc::Rand_prop_point{ 190, 41.94016265869, 48.51041412354, { 110.05332183838, 82.53999328613, 61.9049949646, 55.02666091919, 55.02666091919 } },
+    dbc::Rand_prop_point{ 191, 42.37504196167, 49.42128372192, { 111.08352661133, 83.31265258789, 62.48448562622, 55.54176712036, 55.54176712036 } },
+    dbc::Rand_prop_point{ 192, 42.81438827515, 50.34495544434, { 112.12338256836, 84.09253692627, 63.06940460205, 56.06169128418, 56.06169128418 } },
+    dbc::Rand_prop_point{ 193, 43.25824737549, 51.28158950806, { 113.17297363281, 84.87973022461, 63.65979766846, 56.58648681641, 56.58648681641 } },
+    dbc::Rand_prop_point{ 194, 43.70666122437, 52.23134613037, { 114.23238372803, 85.67429351807, 64.2557144165, 57.11619186401, 57.11619186401 } },
+    dbc::Rand_prop_point{ 195, 44.15968322754, 53.19438934326, { 115.30171966553, 86.4762878418, 64.85721588135, 57.65085983276, 57.65085983276 } },
+    dbc::Rand_prop_point{ 196, 44.61735534668, 54.17089080811, { 116.38105773926, 87.28578948975, 65.46434783936, 58.19052886963, 58.19052886963 } },
+    dbc::Rand_prop_point{ 197, 45.07972717285, 55.16100692749, { 117.47049713135, 88.10287475586, 66.07715606689, 58.73524856567, 58.73524856567 } },
+    dbc::Rand_prop_point{ 198, 45.54684829712, 56.16491699219, { 118.57013702393, 88.92760467529, 66.69570159912, 59.28507232666, 59.28507232666 } },
+    dbc::Rand_prop_point{ 199, 46.01876068115, 57.18278884888, { 119.68007659912, 89.76005554199, 67.32004547119, 59.84003829956, 59.84003829956 } },
+    dbc::Rand_prop_point{ 200, 46.49551773071, 58.21479415894, { 120.80040740967, 90.6003036499, 67.95022583008, 60.40020370483, 60.40020370483 } },
+    dbc::Rand_prop_point{ 201, 46.97716903687, 59.26110839844, { 121.9312210083, 91.44841003418, 68.58631134033, 60.96561050415, 60.96561050415 } },
+    dbc::Rand_prop_point{ 202, 47.46376037598, 60.32191085815, { 123.07261657715, 92.30445861816, 69.22834777832, 61.53630828857, 61.53630828857 } },
+    dbc::Rand_prop_point{ 203, 47.95534896851, 61.39738464355, { 124.22470092773, 93.1685256958, 69.8763961792, 62.11235046387, 62.11235046387 } },
+    dbc::Rand_prop_point{ 204, 48.45198059082, 62.48770141602, { 125.38757324219, 94.04067230225, 70.53050994873, 62.6937828064, 62.6937828064 } },
+    dbc::Rand_prop_point{ 205, 48.95370864868, 63.5930557251, { 126.56133270264, 94.92098999023, 71.19074249268, 63.28066253662, 63.28066253662 } },
+    dbc::Rand_prop_point{ 206, 49.46058273315, 64.71363067627, { 127.74606323242, 95.80954742432, 71.85716247559, 63.87303161621, 63.87303161621 } },
+    dbc::Rand_prop_point{ 207, 49.9726600647, 65.849609375, { 128.94189453125, 96.70642089844, 72.52981567383, 64.47094726563, 64.47094726563 } },
+    dbc::Rand_prop_point{ 208, 50.48998641968, 67.00118255615, { 130.14892578125, 97.61168670654, 73.20877075195, 65.07446289063, 65.07446289063 } },
+    dbc::Rand_prop_point{ 209, 51.01262283325, 68.16854858398, { 131.36724853516, 98.52543640137, 73.89407348633, 65.68362426758, 65.68362426758 } },
+    dbc::Rand_prop_point{ 210, 51.54061508179, 69.35189819336, { 132.59696960449, 99.44773101807, 74.5858001709, 66.29848480225, 66.29848480225 } },
+    dbc::Rand_prop_point{ 211, 52.07402420044, 70.55142974854, { 133.83821105957, 100.37866210938, 75.28399658203, 66.91910552979, 66.91910552979 } },
+    dbc::Rand_prop_point{ 212, 52.61290359497, 71.76733398438, { 135.09107971191, 101.31831359863, 75.98873138428, 67.54553985596, 67.54553985596 } },
+    dbc::Rand_prop_point{ 213, 53.15731048584, 72.99983215332, { 136.35566711426, 102.266746521, 76.7000579834, 68.17783355713, 68.17783355713 } },
+    dbc::Rand_prop_point{ 214, 53.70729827881, 74.24910736084, { 137.63209533691, 103.22406768799, 77.41805267334, 68.81604766846, 68.81604766846 } },
+    dbc::Rand_prop_point{ 215, 54.26292419434, 75.51538085938, { 138.92047119141, 104.19035339356, 78.14276123047, 69.4602355957, 69.4602355957 } },
+    dbc::Rand_prop_point{ 216, 54.82424545288, 76.79885101318, { 140.22090148926, 105.16567230225, 78.87425994873, 70.11045074463, 70.11045074463 } },
+    dbc::Rand_prop_point{ 217, 55.3913230896, 78.09973144531, { 141.53350830078, 106.15013122559, 79.61260223389, 70.76675415039, 70.76675415039 } },
+    dbc::Rand_prop_point{ 218, 55.96421432495, 79.4182434082, { 142.8583984375, 107.14380645752, 80.35784912109, 71.42919921875, 71.42919921875 } },
+    dbc::Rand_prop_point{ 219, 56.5429725647, 80.75459289551, { 144.19570922852, 108.1467666626, 81.11008453369, 72.09785461426, 72.09785461426 } },
+    dbc::Rand_prop_point{ 220, 57.12766647339, 82.10900115967, { 145.54551696777, 109.15914154053, 81.86935424805, 72.77275848389, 72.77275848389 } },
+    dbc::Rand_prop_point{ 221, 57.71834945679, 83.48169708252, { 146.90797424316, 110.18097686768, 82.63573455811, 73.45398712158, 73.45398712158 } },
+    dbc::Rand_prop_point{ 222, 58.31508636475, 84.87288665771, { 148.28317260742, 111.21238708496, 83.40928649902, 74.14158630371, 74.14158630371 } },
+    dbc::Rand_prop_point{ 223, 58.91793823242, 86.28281402588, { 149.67126464844, 112.25344085693, 84.19007873535, 74.83563232422, 74.83563232422 } },
+    dbc::Rand_prop_point{ 224, 59.52696609497, 87.71170043945, { 151.07232666016, 113.30423736572, 84.97818756104, 75.53616333008, 75.53616333008 } },
+    dbc::Rand_prop_point{ 225, 60.14223480225, 89.15977478027, { 152.48652648926, 114.36489105225, 85.77366638184, 76.24326324463, 76.24326324463 } },
+    dbc::Rand_prop_point{ 226, 60.7638053894, 90.62728118896, { 153.91394042969, 115.43546295166, 86.57659912109, 76.95697021484, 76.95697021484 } },
+    dbc::Rand_prop_point{ 227, 61.3917427063, 92.11444091797, { 155.35473632813, 116.51605224609, 87.38703918457, 77.67736816406, 77.67736816406 } },
+    dbc::Rand_prop_point{ 228, 62.02611160278, 93.6215057373, { 156.80900573731, 117.60675811768, 88.20507049561, 78.40450286865, 78.40450286865 } },
+    dbc::Rand_prop_point{ 229, 62.66697692871, 95.1487121582, { 158.27690124512, 118.70767974854, 89.03076171875, 79.13845062256, 79.13845062256 } },
+    dbc::Rand_prop_point{ 230, 63.31440353394, 96.69631195068, { 159.75852966309, 119.81890106201, 89.86417388916, 79.87926483154, 79.87926483154 } },
+    dbc::Rand_prop_point{ 231, 63.96846389771, 98.26454162598, { 161.25402832031, 120.94052886963, 90.70539093018, 80.62701416016, 80.62701416016 } },
+    dbc::Rand_prop_point{ 232, 64.62921905518, 99.8536605835, { 162.7635345459, 122.07264709473, 91.55448913574, 81.38176727295, 81.38176727295 } },
+    dbc::Rand_prop_point{ 233, 65.2967376709, 101.46392059326, { 164.28717041016, 123.21537017822, 92.41152954102, 82.14358520508, 82.14358520508 } },
+    dbc::Rand_prop_point{ 234, 65.97109222412, 103.09558105469, { 165.8250579834, 124.36879730225, 93.27659606934, 82.9125289917, 82.9125289917 } },
+    dbc::Rand_prop_point{ 235, 66.65235137939, 104.74889373779, { 167.37734985352, 125.53301239014, 94.14975738525, 83.68867492676, 83.68867492676 } },
+    dbc::Rand_prop_point{ 236, 67.34058380127, 106.42413330078, { 168.94416809082, 126.70812225342, 95.03109741211, 84.47208404541, 84.47208404541 } },
+    dbc::Rand_prop_point{ 237, 68.0358581543, 108.12153625488, { 170.52565002441, 127.89424133301, 95.92067718506, 85.26282501221, 85.26282501221 } },
+    dbc::Rand_prop_point{ 238, 68.73825073242, 109.84142303467, { 172.12194824219, 129.09146118164, 96.81859588623, 86.06097412109, 86.06097412109 } },
+    dbc::Rand_prop_point{ 239, 69.4478302002, 111.58400726318, { 173.73318481445, 130.29988098145, 97.72491455078, 86.86659240723, 86.86659240723 } },
+    dbc::Rand_prop_point{ 240, 70.16467285156, 113.349609375, { 175.35949707031, 131.51962280273, 98.63971710205, 87.67974853516, 87.67974853516 } },
+    dbc::Rand_prop_point{ 241, 70.88885498047, 115.13848114014, { 177.00103759766, 132.75077819824, 99.56308746338, 88.50051879883, 88.50051879883 } },
+    dbc::Rand_prop_point{ 242, 71.62043762207, 116.95091247559, { 178.65794372559, 133.99345397949, 100.49508666992, 89.32897186279, 89.32897186279 } },
+    dbc::Rand_prop_point{ 243, 72.3595123291, 118.78719329834, { 180.33036804199, 135.2477722168, 101.4358291626, 90.165184021, 90.165184021 } },
+    dbc::Rand_prop_point{ 244, 73.10614013672, 120.64759063721, { 182.01843261719, 136.51382446289, 102.38536834717, 91.00921630859, 91.00921630859 } },
+    dbc::Rand_prop_point{ 245, 73.86041259766, 122.53241729736, { 183.72232055664, 137.79173278809, 103.34380340576, 91.86116027832, 91.86116027832 } },
+    dbc::Rand_prop_point{ 246, 74.62239837646, 124.4419631958, { 185.44213867188, 139.08160400391, 104.31120300293, 92.72106933594, 92.72106933594 } },
+    dbc::Rand_prop_point{ 247, 75.39217376709, 126.37651824951, { 187.17807006836, 140.38354492188, 105.28765869141, 93.58903503418, 93.58903503418 } },
+    dbc::Rand_prop_point{ 248, 76.16983032227, 128.33639526367, { 188.93023681641, 141.69767761231, 106.27326202393, 94.4651184082, 94.4651184082 } },
+    dbc::Rand_prop_point{ 249, 76.95543670654, 130.32188415527, { 190.69882202148, 143.02410888672, 107.26808166504, 95.34941101074, 95.34941101074 } },
+    dbc::Rand_prop_point{ 250, 77.74906921387, 132.33329772949, { 192.48394775391, 144.36296081543, 108.27221679688, 96.24197387695, 96.24197387695 } },
+    dbc::Rand_prop_point{ 251, 78.55082702637, 134.37094116211, { 194.28579711914, 145.71434020996, 109.28575897217, 97.14289855957, 97.14289855957 } },
+    dbc::Rand_prop_point{ 252, 79.36077880859, 136.43515014648, { 196.10450744629, 147.07838439941, 110.30877685547, 98.05225372314, 98.05225372314 } },
+    dbc::Rand_prop_point{ 253, 80.17900848389, 138.5262298584, { 197.94023132324, 148.45518493652, 111.3413772583, 98.97011566162, 98.97011566162 } },
+    dbc::Rand_prop_point{ 254, 81.00559997559, 140.64450073242, { 199.79315185547, 149.8448638916, 112.3836517334, 99.89657592773, 99.89657592773 } },
+    dbc::Rand_prop_point{ 255, 81.84064483643, 142.79028320313, { 201.66342163086, 151.24757385254, 113.43567657471, 100.83171081543, 100.83171081543 } },
+    dbc::Rand_prop_point{ 256, 82.68422698975, 144.96392822266, { 203.55119323731, 152.66339111328, 114.49755096436, 101.77559661865, 101.77559661865 } },
+    dbc::Rand_prop_point{ 257, 83.53643035889, 147.16575622559, { 205.45663452148, 154.09248352051, 115.56935882568, 102.72831726074, 102.72831726074 } },
+    dbc::Rand_prop_point{ 258, 84.39733886719, 149.39608764648, { 207.37991333008, 155.53494262695, 116.65120697022, 103.68995666504, 103.68995666504 } },
+    dbc::Rand_prop_point{ 259, 85.26705169678, 151.65528869629, { 209.32119750977, 156.99090576172, 117.74317932129, 104.66059875488, 104.66059875488 } },
+    dbc::Rand_prop_point{ 260, 86.145652771, 153.94369506836, { 211.28065490723, 158.46049499512, 118.84538269043, 105.64032745361, 105.64032745361 } },
+    dbc::Rand_prop_point{ 261, 87.03322601318, 156.26165771484, { 213.25846862793, 159.94384765625, 119.95789337158, 106.62922668457, 106.62922668457 } },
+    dbc::Rand_prop_point{ 262, 87.92986297607, 158.60952758789, { 215.25477600098, 161.44108581543, 121.08081054688, 107.62738800049, 107.62738800049 } },
+    dbc::Rand_prop_point{ 263, 88.83567047119, 160.98765563965, { 217.26977539063, 162.95233154297, 122.21424865723, 108.63488769531, 108.63488769531 } },
+    dbc::Rand_prop_point{ 264, 89.75072479248, 163.39642333984, { 219.30363464356, 164.47772216797, 123.35829925537, 109.65181732178, 109.65181732178 } },
+    dbc::Rand_prop_point{ 265, 90.67513275146, 165.83616638184, { 221.35653686523, 166.01741027832, 124.51304626465, 110.67826843262, 110.67826843262 } },
+    dbc::Rand_prop_point{ 266, 91.60897827148, 168.30726623535, { 223.42866516113, 167.57150268555, 125.67861938477, 111.71433258057, 111.71433258057 } },
+    dbc::Rand_prop_point{ 267, 92.55236053467, 170.81010437012, { 225.52017211914, 169.14013671875, 126.85510253906, 112.76009368897, 112.76009368897 } },
+    dbc::Rand_prop_point{ 268, 93.50537872314, 173.34506225586, { 227.63127136231, 170.72344970703, 128.04258728027, 113.81564331055, 113.81564331055 } },
+    dbc::Rand_prop_point{ 269, 94.46812438965, 175.91249084473, { 229.76213073731, 172.32159423828, 129.24119567871, 114.88107299805, 114.88107299805 } },
+    dbc::Rand_prop_point{ 270, 95.4407043457, 178.51281738281, { 231.91293334961, 173.9347076416, 130.45101928711, 115.95646667481, 115.95646667481 } },
+    dbc::Rand_prop_point{ 271, 96.42321777344, 181.14639282227, { 234.08387756348, 175.56291198731, 131.67218017578, 117.04193878174, 117.04193878174 } },
+    dbc::Rand_prop_point{ 272, 97.41575622559, 183.81364440918, { 236.27513122559, 177.20634460449, 132.90476989746, 118.13757324219, 118.13757324219 } },
+    dbc::Rand_prop_point{ 273, 98.41843414307, 186.51495361328, { 238.48690795898, 178.86518859863, 134.14888000488, 119.2434463501, 119.2434463501 } },
+    dbc::Rand_prop_point{ 274, 99.43134307861, 189.25073242188, { 240.71939086914, 180.53953552246, 135.40464782715, 120.35970306397, 120.35970306397 } },
+    dbc::Rand_prop_point{ 275, 100.45459747315, 192.02137756348, { 242.97276306152, 182.22956848145, 136.67218017578, 121.48638153076, 121.48638153076 } },
+    dbc::Rand_prop_point{ 276, 101.4882888794, 194.82733154297, { 245.24722290039, 183.93542480469, 137.95156860352, 122.6236114502, 122.6236114502 } },
+    dbc::Rand_prop_point{ 277, 102.53253936768, 197.66897583008, { 247.54298400879, 185.65724182129, 139.24293518066, 123.7714920044, 123.7714920044 } },
+    dbc::Rand_prop_point{ 278, 103.58744049072, 200.54675292969, { 249.86024475098, 187.39518737793, 140.54638671875, 124.93012237549, 124.93012237549 } },
+    dbc::Rand_prop_point{ 279, 104.65310668945, 203.4610748291, { 252.19918823242, 189.14938354492, 141.86204528809, 126.09958648682, 126.09958648682 } },
+    dbc::Rand_prop_point{ 280, 105.72965240479, 206.41239929199, { 254.56002807617, 190.92001342773, 143.1900177002, 127.28000640869, 127.28000640869 } },
+    dbc::Rand_prop_point{ 281, 106.81717681885, 209.40115356445, { 256.94296264648, 192.70721435547, 144.5304107666, 128.47148132324, 128.47148132324 } },
+    dbc::Rand_prop_point{ 282, 107.91578674316, 212.42776489258, { 259.34820556641, 194.51115417481, 145.88336181641, 129.6741027832, 129.6741027832 } },
+    dbc::Rand_prop_point{ 283, 109.02562713623, 215.49269104004, { 261.77597045898, 196.33197021484, 147.24897766113, 130.88798522949, 130.88798522949 } },
+    dbc::Rand_prop_point{ 284, 110.14678192139, 218.59638977051, { 264.22644042969, 198.16984558106, 148.62738037109, 132.11322021484, 132.11322021484 } },
+    dbc::Rand_prop_point{ 285, 111.27937316895, 221.73930358887, { 266.69989013672, 200.02490234375, 150.01867675781, 133.34994506836, 133.34994506836 } },
+    dbc::Rand_prop_point{ 286, 112.42350769043, 224.92192077637, { 269.19644165039, 201.89733886719, 151.42300415039, 134.5982208252, 134.5982208252 } },
+    dbc::Rand_prop_point{ 287, 113.57932281494, 228.14468383789, { 271.71640014648, 203.78730773926, 152.84048461914, 135.85820007324, 135.85820007324 } },
+    dbc::Rand_prop_point{ 288, 114.74691772461, 231.4080657959, { 274.25994873047, 205.69496154785, 154.27122497559, 137.12997436523, 137.12997436523 } },
+    dbc::Rand_prop_point{ 289, 115.92642211914, 234.71255493164, { 276.82730102539, 207.62046813965, 155.71534729004, 138.4136505127, 138.4136505127 } },
+    dbc::Rand_prop_point{ 290, 117.11795043945, 238.05863952637, { 279.4186706543, 209.56401062012, 157.17300415039, 139.70933532715, 139.70933532715 } },
+    dbc::Rand_prop_point{ 291, 118.32163238525, 241.44679260254, { 282.03430175781, 211.52574157715, 158.64430236816, 141.01715087891, 141.01715087891 } },
+    dbc::Rand_prop_point{ 292, 119.53759002686, 244.87753295898, { 284.67443847656, 213.50582885742, 160.12937927246, 142.33721923828, 142.33721923828 } },
+    dbc::Rand_prop_point{ 293, 120.76593780518, 248.35133361816, { 287.33926391602, 215.50445556641, 161.62834167481, 143.66963195801, 143.66963195801 } },
+    dbc::Rand_prop_point{ 294, 122.00681304932, 251.86871337891, { 290.02905273438, 217.52180480957, 163.14134216309, 145.01452636719, 145.01452636719 } },
+    dbc::Rand_prop_point{ 295, 123.26033782959, 255.43019104004, { 292.74401855469, 219.55801391602, 164.66851806641, 146.37200927734, 146.37200927734 } },
+    dbc::Rand_prop_point{ 296, 124.52662658691, 259.03628540039, { 295.48440551758, 221.61329650879, 166.20997619629, 147.74220275879, 147.74220275879 } },
+    dbc::Rand_prop_point{ 297, 125.80583953857, 262.6875, { 298.25042724609, 223.68782043457, 167.76586914063, 149.12521362305, 149.12521362305 } },
+    dbc::Rand_prop_point{ 298, 127.09808349609, 266.38436889648, { 301.04235839844, 225.78176879883, 169.33633422852, 150.52117919922, 150.52117919922 } },
+    dbc::Rand_prop_point{ 299, 128.40350341797, 270.12741088867, { 303.86041259766, 227.89530944824, 170.92147827148, 151.93020629883, 151.93020629883 } },
+    dbc::Rand_prop_point{ 300, 129.72221374512, 273.91720581055, { 306.70486450195, 230.02864074707, 172.521484375, 153.35243225098, 153.35243225098 } },
+    dbc::Rand_prop_point{ 301, 131.05436706543, 277.75430297852, { 309.57592773438, 232.18194580078, 174.13645935059, 154.78796386719, 154.78796386719 } },
+    dbc::Rand_prop_point{ 302, 132.40008544922, 281.63922119141, { 312.47387695313, 234.35539245606, 175.76655578613, 156.23693847656, 156.23693847656 } },
+    dbc::Rand_prop_point{ 303, 133.75952148438, 285.57250976563, { 315.39892578125, 236.54919433594, 177.41189575195, 157.69946289063, 157.69946289063 } },
+    dbc::Rand_prop_point{ 304, 135.1328125, 289.55477905273, { 318.35137939453, 238.7635345459, 179.07266235352, 159.17568969727, 159.17568969727 } },
+    dbc::Rand_prop_point{ 305, 136.52008056641, 293.58657836914, { 321.33148193359, 240.9986114502, 180.74896240234, 160.6657409668, 160.6657409668 } },
+    dbc::Rand_prop_point{ 306, 137.92149353027, 297.66848754883, { 324.33944702148, 243.25459289551, 182.44094848633, 162.16972351074, 162.16972351074 } },
+    dbc::Rand_prop_point{ 307, 139.33717346191, 301.80111694336, { 327.37561035156, 245.53170776367, 184.14877319336, 163.68780517578, 163.68780517578 } },
+    dbc::Rand_prop_point{ 308, 140.76727294922, 305.98501586914, { 330.4401550293, 247.83012390137, 185.87258911133, 165.22007751465, 165.22007751465 } },
+    dbc::Rand_prop_point{ 309, 142.21192932129, 310.22076416016, { 333.53341674805, 250.15007019043, 187.61254882813, 166.76670837402, 166.76670837402 } },
+    dbc::Rand_prop_point{ 310, 143.67131042481, 314.50903320313, { 336.65563964844, 252.49172973633, 189.36878967285, 168.32781982422, 168.32781982422 } },
+    dbc::Rand_prop_point{ 311, 145.14555358887, 318.85040283203, { 339.80706787109, 254.85530090332, 191.14147949219, 169.90353393555, 169.90353393555 } },
+    dbc::Rand_prop_point{ 312, 145.89028930664, 319.14764404297, { 342.9880065918, 257.24099731445, 192.93075561523, 171.4940032959, 171.4940032959 } },
+    dbc::Rand_prop_point{ 313, 146.63883972168, 319.44512939453, { 346.19869995117, 259.64904785156, 194.73677062988, 173.09934997559, 173.09934997559 } },
+    dbc::Rand_prop_point{ 314, 147.39123535156, 319.74291992188, { 349.43948364258, 262.07962036133, 196.5597076416, 174.71974182129, 174.71974182129 } },
+    dbc::Rand_prop_point{ 315, 148.14749145508, 320.04098510742, { 352.71060180664, 264.5329284668, 198.39970397949, 176.35530090332, 176.35530090332 } },
+    dbc::Rand_prop_point{ 316, 148.90763854981, 320.33932495117, { 356.01229858398, 267.00924682617, 200.25692749023, 178.00614929199, 178.00614929199 } },
+    dbc::Rand_prop_point{ 317, 149.67167663574, 320.63793945313, { 359.34494018555, 269.50869750977, 202.13153076172, 179.67247009277, 179.67247009277 } },
+    dbc::Rand_prop_point{ 318, 150.43963623047, 320.93682861328, { 362.70877075195, 272.03158569336, 204.02368164063, 181.35438537598, 181.35438537598 } },
+    dbc::Rand_prop_point{ 319, 151.21153259277, 321.23599243164, { 366.10409545898, 274.57806396484, 205.93354797363, 183.05204772949, 183.05204772949 } },
+    dbc::Rand_prop_point{ 320, 151.98739624023, 321.5354309082, { 369.53118896484, 277.14840698242, 207.86129760742, 184.76559448242, 184.76559448242 } },
+    dbc::Rand_prop_point{ 321, 152.76722717285, 321.83517456055, { 372.99038696289, 279.74279785156, 209.80708312988, 186.49519348145, 186.49519348145 } },
+    dbc::Rand_prop_point{ 322, 153.55107116699, 322.13519287109, { 376.48193359375, 282.36145019531, 211.77108764648, 188.24096679688, 188.24096679688 } },
+    dbc::Rand_prop_point{ 323, 154.33894348145, 322.43545532227, { 380.00619506836, 285.00463867188, 213.75347900391, 190.00309753418, 190.00309753418 } },
+    dbc::Rand_prop_point{ 324, 155.13084411621, 322.73602294922, { 383.56344604492, 287.6725769043, 215.75442504883, 191.78172302246, 191.78172302246 } },
+    dbc::Rand_prop_point{ 325, 155.92681884766, 323.03689575195, { 387.15396118164, 290.36547851563, 217.77410888672, 193.57698059082, 193.57698059082 } },
+    dbc::Rand_prop_point{ 326, 156.72686767578, 323.33801269531, { 390.77813720703, 293.08358764648, 219.81269836426, 195.38906860352, 195.38906860352 } },
+    dbc::Rand_prop_point{ 327, 157.53103637695, 323.63943481445, { 394.43618774414, 295.8271484375, 221.87036132813, 197.21809387207, 197.21809387207 } },
+    dbc::Rand_prop_point{ 328, 158.33932495117, 323.94110107422, { 398.12850952148, 298.5964050293, 223.94729614258, 199.06425476074, 199.06425476074 } },
+    dbc::Rand_prop_point{ 329, 159.15174865723, 324.24307250977, { 401.85540771484, 301.39154052734, 226.0436706543, 200.92770385742, 200.92770385742 } },
+    dbc::Rand_prop_point{ 330, 159.96835327148, 324.54534912109, { 405.6171875, 304.212890625, 228.15966796875, 202.80859375, 202.80859375 } },
+    dbc::Rand_prop_point{ 331, 160.78913879395, 324.84786987305, { 409.41415405273, 307.06060791016, 230.29547119141, 204.70707702637, 204.70707702637 } },
+    dbc::Rand_prop_point{ 332, 161.61415100098, 325.15069580078, { 413.24667358398, 309.93502807617, 232.45126342773, 206.62333679199, 206.62333679199 } },
+    dbc::Rand_prop_point{ 333, 162.44337463379, 325.45379638672, { 417.11508178711, 312.83633422852, 234.62724304199, 208.55754089356, 208.55754089356 } },
+    dbc::Rand_prop_point{ 334, 163.27687072754, 325.75717163086, { 421.01971435547, 315.76477050781, 236.82359313965, 210.50985717773, 210.50985717773 } },
+    dbc::Rand_prop_point{ 335, 164.11463928223, 326.0608215332, { 424.96087646484, 318.72067260742, 239.04049682617, 212.48043823242, 212.48043823242 } },
+    dbc::Rand_prop_point{ 336, 164.95671081543, 326.36477661133, { 428.93893432617, 321.70419311523, 241.27815246582, 214.46946716309, 214.46946716309 } },
+    dbc::Rand_prop_point{ 337, 165.80308532715, 326.66900634766, { 432.95422363281, 324.71566772461, 243.53675842285, 216.47711181641, 216.47711181641 } },
+    dbc::Rand_prop_point{ 338, 166.65382385254, 326.97354125977, { 437.0071105957, 327.75534057617, 245.81651306152, 218.50355529785, 218.50355529785 } },
+    dbc::Rand_prop_point{ 339, 167.50891113281, 327.2783203125, { 441.09796142578, 330.82345581055, 248.11759948731, 220.54898071289, 220.54898071289 } },
+    dbc::Rand_prop_point{ 340, 168.36839294434, 327.58340454102, { 445.22708129883, 333.92031860352, 250.44023132324, 222.61354064941, 222.61354064941 } },
+    dbc::Rand_prop_point{ 341, 169.2322845459, 327.88876342773, { 449.39483642578, 337.04614257813, 252.78460693359, 224.69741821289, 224.69741821289 } },
+    dbc::Rand_prop_point{ 342, 170.10061645508, 328.19442749023, { 453.60162353516, 340.20123291016, 255.15092468262, 226.80081176758, 226.80081176758 } },
+    dbc::Rand_prop_point{ 343, 171.85430908203, 329.11309814453, { 457.84780883789, 343.38586425781, 257.53939819336, 228.92390441895, 228.92390441895 } },
+    dbc::Rand_prop_point{ 344, 173.62594604492, 330.03433227539, { 462.13372802734, 346.60028076172, 259.95022583008, 231.06686401367, 231.06686401367 } },
+    dbc::Rand_prop_point{ 345, 175.41567993164, 330.95812988281, { 466.45974731445, 349.84481811523, 262.38360595703, 233.22987365723, 233.22987365723 } },
+    dbc::Rand_prop_point{ 346, 177.22370910645, 331.88455200195, { 470.82629394531, 353.11972045898, 264.83978271484, 235.41314697266, 235.41314697266 } },
+    dbc::Rand_prop_point{ 347, 179.05021667481, 332.81353759766, { 475.23370361328, 356.42526245117, 267.31893920898, 237.61685180664, 237.61685180664 } },
+    dbc::Rand_prop_point{ 348, 180.89540100098, 333.74514770508, { 479.6823425293, 359.76177978516, 269.82131958008, 239.84117126465, 239.84117126465 } },
+    dbc::Rand_prop_point{ 349, 182.75942993164, 334.67935180664, { 484.17266845703, 363.12948608398, 272.34713745117, 242.08633422852, 242.08633422852 } },
+    dbc::Rand_prop_point{ 350, 184.64250183106, 335.61614990234, { 488.70501708984, 366.52874755859, 274.89657592773, 244.35250854492, 244.35250854492 } },
+    dbc::Rand_prop_point{ 351, 186.54483032227, 336.55560302734, { 493.27978515625, 369.95983886719, 277.46987915039, 246.63989257813, 246.63989257813 } },
+    dbc::Rand_prop_point{ 352, 188.46658325195, 337.49765014648, { 497.89736938477, 373.42303466797, 280.06726074219, 248.94868469238, 248.94868469238 } },
+    dbc::Rand_prop_point{ 353, 190.40795898438, 338.4423828125, { 502.55819702148, 376.91864013672, 282.68899536133, 251.27909851074, 251.27909851074 } },
+    dbc::Rand_prop_point{ 354, 192.36918640137, 339.38970947266, { 507.26263427734, 380.4469909668, 285.3352355957, 253.63131713867, 253.63131713867 } },
+    dbc::Rand_prop_point{ 355, 194.35043334961, 340.33972167969, { 512.01110839844, 384.00836181641, 288.00625610352, 256.00555419922, 256.00555419922 } },
+    dbc::Rand_prop_point{ 356, 196.35191345215, 341.29238891602, { 516.80407714844, 387.60305786133, 290.70230102539, 258.40203857422, 258.40203857422 } },
+    dbc::Rand_prop_point{ 357, 198.37384033203, 342.24771118164, { 521.64190673828, 391.23141479492, 293.4235534668, 260.82095336914, 260.82095336914 } },
+    dbc::Rand_prop_point{ 358, 200.41642761231, 343.20571899414, { 526.52496337891, 394.89373779297, 296.17028808594, 263.26248168945, 263.26248168945 } },
+    dbc::Rand_prop_point{ 359, 202.47985839844, 344.16641235352, { 531.45379638672, 398.59033203125, 298.94274902344, 265.72689819336, 265.72689819336 } },
+    dbc::Rand_prop_point{ 360, 204.56436157227, 345.12976074219, { 536.4287109375, 402.32153320313, 301.74114990234, 268.21435546875, 268.21435546875 } },
+    dbc::Rand_prop_point{ 361, 206.67015075684, 346.09585571289, { 541.45025634766, 406.08767700195, 304.56576538086, 270.72512817383, 270.72512817383 } },
+    dbc::Rand_prop_point{ 362, 208.79742431641, 347.06460571289, { 546.51873779297, 409.88906860352, 307.41680908203, 273.25936889648, 273.25936889648 } },
+    dbc::Rand_prop_point{ 363, 210.9464263916, 348.03610229492, { 551.63470458984, 413.72604370117, 310.29452514648, 275.81735229492, 275.81735229492 } },
+    dbc::Rand_prop_point{ 364, 213.11737060547, 349.01031494141, { 556.79858398438, 417.59893798828, 313.19918823242, 278.39929199219, 278.39929199219 } },
+    dbc::Rand_prop_point{ 365, 215.31047058106, 349.98724365234, { 562.0107421875, 421.50805664063, 316.13104248047, 281.00537109375, 281.00537109375 } },
+    dbc::Rand_prop_point{ 366, 217.5259552002, 350.96691894531, { 567.27172851563, 425.45379638672, 319.09036254883, 283.63586425781, 283.63586425781 } },
+    dbc::Rand_prop_point{ 367, 219.76405334473, 351.94931030273, { 572.58197021484, 429.43649291992, 322.07736206055, 286.29098510742, 286.29098510742 } },
+    dbc::Rand_prop_point{ 368, 222.0249786377, 352.93447875977, { 577.94189453125, 433.45645141602, 325.09234619141, 288.97094726563, 288.97094726563 } },
+    dbc::Rand_prop_point{ 369, 224.30899047852, 353.92239379883, { 583.35205078125, 437.51403808594, 328.13552856445, 291.67602539063, 291.67602539063 } },
+    dbc::Rand_prop_point{ 370, 226.61630249023, 354.9130859375, { 588.81280517578, 441.60958862305, 331.20721435547, 294.40640258789, 294.40640258789 } },
+    dbc::Rand_prop_point{ 371, 228.94714355469, 355.9065246582, { 594.32470703125, 445.74349975586, 334.30764770508, 297.16235351563, 297.16235351563 } },
+    dbc::Rand_prop_point{ 372, 231.30178833008, 356.90277099609, { 599.88818359375, 449.91610717773, 337.43710327148, 299.94409179688, 299.94409179688 } },
+    dbc::Rand_prop_point{ 373, 233.68043518066, 357.90179443359, { 605.50372314453, 454.12777709961, 340.59582519531, 302.75186157227, 302.75186157227 } },
+    dbc::Rand_prop_point{ 374, 236.08335876465, 358.9035949707, { 611.17181396484, 458.37887573242, 343.78414916992, 305.58590698242, 305.58590698242 } },
+    dbc::Rand_prop_point{ 375, 238.51078796387, 359.90823364258, { 616.89300537109, 462.66976928711, 347.00231933594, 308.44650268555, 308.44650268555 } },
+    dbc::Rand_prop_point{ 376, 240.96296691895, 360.91567993164, { 622.66778564453, 467.00082397461, 350.25061035156, 311.33389282227, 311.33389282227 } },
+    dbc::Rand_prop_point{ 377, 243.44017028809, 361.92593383789, { 628.49658203125, 471.37240600586, 353.52932739258, 314.24829101563, 314.24829101563 } },
+    dbc::Rand_prop_point{ 378, 245.94262695313, 362.93899536133, { 634.37994384766, 475.78494262695, 356.83871459961, 317.18997192383, 317.18997192383 } },
+    dbc::Rand_prop_point{ 379, 248.47061157227, 363.95492553711, { 640.318359375, 480.23876953125, 360.17907714844, 320.1591796875, 320.1591796875 } },
+    dbc::Rand_prop_point{ 380, 251.02436828613, 364.97369384766, { 646.31237792969, 484.73428344727, 363.55072021484, 323.15618896484, 323.15618896484 } },
+    dbc::Rand_prop_point{ 381, 253.60415649414, 365.99530029297, { 652.36248779297, 489.27188110352, 366.95391845703, 326.18124389648, 326.18124389648 } },
+    dbc::Rand_prop_point{ 382, 256.21026611328, 367.01977539063, { 658.46929931641, 493.85195922852, 370.38897705078, 329.2346496582, 329.2346496582 } },
+    dbc::Rand_prop_point{ 383, 258.84292602539, 368.04711914063, { 664.63323974609, 498.47491455078, 373.8561706543, 332.31661987305, 332.31661987305 } },
+    dbc::Rand_prop_point{ 384, 261.50244140625, 369.07733154297, { 670.85485839844, 503.14114379883, 377.35586547852, 335.42742919922, 335.42742919922 } },
+    dbc::Rand_prop_point{ 385, 264.18902587891, 370.11044311523, { 677.13470458984, 507.85104370117, 380.88827514648, 338.56735229492, 338.56735229492 } },
+    dbc::Rand_prop_point{ 386, 266.9030456543, 371.14645385742, { 683.47338867188, 512.60504150391, 384.45376586914, 341.73669433594, 341.73669433594 } },
+    dbc::Rand_prop_point{ 387, 269.64468383789, 376.92825317383, { 689.87139892578, 517.40356445313, 388.05264282227, 344.93569946289, 344.93569946289 } },
+    dbc::Rand_prop_point{ 388, 272.41427612305, 383.10852050781, { 696.32928466797, 522.24694824219, 391.68521118164, 348.16464233398, 348.16464233398 } },
+    dbc::Rand_prop_point{ 389, 275.21209716797, 389.37149047852, { 702.84759521484, 527.13568115234, 395.35177612305, 351.42379760742, 351.42379760742 } },
+    dbc::Rand_prop_point{ 390, 278.03845214844, 395.71810913086, { 709.42700195313, 532.07025146484, 399.05267333984, 354.71350097656, 354.71350097656 } },
+    dbc::Rand_prop_point{ 391, 280.89358520508, 402.14944458008, { 716.06793212891, 537.05096435547, 402.78820800781, 358.03396606445, 358.03396606445 } },
+    dbc::Rand_prop_point{ 392, 283.77780151367, 408.66653442383, { 722.77105712891, 542.07830810547, 406.55871582031, 361.38552856445, 361.38552856445 } },
+    dbc::Rand_prop_point{ 393, 286.69140625, 415.27035522461, { 729.53692626953, 547.15264892578, 410.36450195313, 364.76846313477, 364.76846313477 } },
+    dbc::Rand_prop_point{ 394, 289.63467407227, 421.96203613281, { 736.36608886719, 552.27459716797, 414.20593261719, 368.18304443359, 368.18304443359 } },
+    dbc::Rand_prop_point{ 395, 292.60794067383, 428.74261474609, { 743.25921630859, 557.44439697266, 418.08331298828, 371.6296081543, 371.6296081543 } },
+    dbc::Rand_prop_point{ 396, 295.61151123047, 435.61312866211, { 750.21685791016, 562.66265869141, 421.99700927734, 375.10842895508, 375.10842895508 } },
+    dbc::Rand_prop_point{ 397, 298.64562988281, 442.57473754883, { 757.23968505859, 567.92974853516, 425.94732666016, 378.6198425293, 378.6198425293 } },
+    dbc::Rand_prop_point{ 398, 301.71069335938, 449.62847900391, { 764.32818603516, 573.24615478516, 429.93460083008, 382.16409301758, 382.16409301758 } },
+    dbc::Rand_prop_point{ 399, 304.80694580078, 456.77551269531, { 771.48309326172, 578.6123046875, 433.95922851563, 385.74154663086, 385.74154663086 } },
+    dbc::Rand_prop_point{ 400, 307.93472290039, 464.01696777344, { 778.70495605469, 584.02868652344, 438.02151489258, 389.35247802734, 389.35247802734 } },
+    dbc::Rand_prop_point{ 401, 311.09436035156, 471.35394287109, { 785.99438476563, 589.49578857422, 442.12185668945, 392.99719238281, 392.99719238281 } },
+    dbc::Rand_prop_point{ 402, 314.28619384766, 478.78762817383, { 793.35211181641, 595.01403808594, 446.26055908203, 396.6760559082, 396.6760559082 } },
+    dbc::Rand_prop_point{ 403, 317.51049804688, 486.31918334961, { 800.77868652344, 600.583984375, 450.43798828125, 400.38934326172, 400.38934326172 } },
+    dbc::Rand_prop_point{ 404, 320.76760864258, 493.94979858398, { 808.27478027344, 606.2060546875, 454.65454101563, 404.13739013672, 404.13739013672 } },
+    dbc::Rand_prop_point{ 405, 324.0578918457, 501.6806640625, { 815.84100341797, 611.88073730469, 458.91058349609, 407.92050170898, 407.92050170898 } },
+    dbc::Rand_prop_point{ 406, 327.38168334961, 509.5129699707, { 823.47808837891, 617.60858154297, 463.20645141602, 411.73904418945, 411.73904418945 } },
+    dbc::Rand_prop_point{ 407, 330.73928833008, 517.44793701172, { 831.18670654297, 623.39001464844, 467.54251098633, 415.59335327148, 415.59335327148 } },
+    dbc::Rand_prop_point{ 408, 334.13107299805, 525.48681640625, { 838.96746826172, 629.2255859375, 471.91918945313, 419.48373413086, 419.48373413086 } },
+    dbc::Rand_prop_point{ 409, 337.55737304688, 533.63092041016, { 846.82104492188, 635.11578369141, 476.33682250977, 423.41052246094, 423.41052246094 } },
+    dbc::Rand_prop_point{ 410, 341.0185546875, 541.88140869141, { 854.74810791016, 641.06109619141, 480.79580688477, 427.37405395508, 427.37405395508 } },
+    dbc::Rand_prop_point{ 411, 344.51495361328, 550.23956298828, { 862.74938964844, 647.06207275391, 485.29653930664, 431.37469482422, 431.37469482422 } },
+    dbc::Rand_prop_point{ 412, 348.04690551758, 558.70672607422, { 870.82562255859, 653.11920166016, 489.83941650391, 435.4128112793, 435.4128112793 } },
+    dbc::Rand_prop_point{ 413, 351.61480712891, 567.28424072266, { 878.97741699219, 659.23309326172, 494.4248046875, 439.48870849609, 439.48870849609 } },
+    dbc::Rand_prop_point{ 414, 355.2190246582, 575.97338867188, { 887.20550537109, 665.40417480469, 499.05310058594, 443.60275268555, 443.60275268555 } },
+    dbc::Rand_prop_point{ 415, 358.85989379883, 584.77545166016, { 895.51068115234, 671.63299560547, 503.72476196289, 447.75534057617, 447.75534057617 } },
+    dbc::Rand_prop_point{ 416, 362.53778076172, 593.69183349609, { 903.8935546875, 677.92016601563, 508.44012451172, 451.94677734375, 451.94677734375 } },
+    dbc::Rand_prop_point{ 417, 366.25311279297, 602.72393798828, { 912.35491943359, 684.26617431641, 513.19964599609, 456.1774597168, 456.1774597168 } },
+    dbc::Rand_prop_point{ 418, 370.00622558594, 611.87310791016, { 920.89544677734, 690.67156982422, 518.00372314453, 460.44772338867, 460.44772338867 } },
+    dbc::Rand_prop_point{ 419, 373.79751586914, 621.14074707031, { 929.51599121094, 697.13696289063, 522.85272216797, 464.75799560547, 464.75799560547 } },
+    dbc::Rand_prop_point{ 420, 377.62734985352, 630.5283203125, { 938.21716308594, 703.66290283203, 527.74713134766, 469.10858154297, 469.10858154297 } },
+    dbc::Rand_prop_point{ 421, 381.49612426758, 640.03717041016, { 946.99981689453, 710.24987792969, 532.68737792969, 473.49990844727, 473.49990844727 } },
+    dbc::Rand_prop_point{ 422, 385.40423583984, 649.66882324219, { 955.86468505859, 716.89849853516, 537.67388916016, 477.9323425293, 477.9323425293 } },
+    dbc::Rand_prop_point{ 423, 389.35211181641, 659.42468261719, { 964.81256103516, 723.60943603516, 542.70709228516, 482.40628051758, 482.40628051758 } },
+    dbc::Rand_prop_point{ 424, 393.3401184082, 669.30627441406, { 973.84417724609, 730.38311767578, 547.78735351563, 486.92208862305, 486.92208862305 } },
+    dbc::Rand_prop_point{ 425, 397.36865234375, 679.31506347656, { 982.96032714844, 737.22027587891, 552.91516113281, 491.48016357422, 491.48016357422 } },
+    dbc::Rand_prop_point{ 426, 401.43817138672, 689.45263671875, { 992.16180419922, 744.12139892578, 558.09100341797, 496.08090209961, 496.08090209961 } },
+    dbc::Rand_prop_point{ 427, 405.54904174805, 699.72045898438, { 1001.4495239258, 751.08709716797, 563.31530761719, 500.72473144531, 500.72473144531 } },
+    dbc::Rand_prop_point{ 428, 409.70169067383, 710.12005615234, { 1010.8239746094, 758.11804199219, 568.58850097656, 505.41201782227, 505.41201782227 } },
+    dbc::Rand_prop_point{ 429, 413.89654541016, 720.65313720703, { 1020.2863769531, 765.21478271484, 573.91107177734, 510.14318847656, 510.14318847656 } },
+    dbc::Rand_prop_point{ 430, 418.1340637207, 731.32110595703, { 1029.8372802734, 772.3779296875, 579.28344726563, 514.91864013672, 514.91864013672 } },
+    dbc::Rand_prop_point{ 431, 422.41461181641, 742.12567138672, { 1039.4775390625, 779.60821533203, 584.70611572266, 519.73876953125, 519.73876953125 } },
+    dbc::Rand_prop_point{ 432, 426.73867797852, 753.06842041016, { 1049.2081298828, 786.90612792969, 590.17956542969, 524.60406494141, 524.60406494141 } },
+    dbc::Rand_prop_point{ 433, 431.10668945313, 764.15106201172, { 1059.0297851562, 794.27233886719, 595.70422363281, 529.51489257813, 529.51489257813 } },
+    dbc::Rand_prop_point{ 434, 435.51907348633, 775.37518310547, { 1068.943359375, 801.70751953125, 601.28063964844, 534.4716796875, 534.4716796875 } },
+    dbc::Rand_prop_point{ 435, 439.9762878418, 786.74243164063, { 1078.9497070312, 809.21234130859, 606.90924072266, 539.47485351563, 539.47485351563 } },
+    dbc::Rand_prop_point{ 436, 444.47882080078, 798.25457763672, { 1089.0498046875, 816.78735351563, 612.59051513672, 544.52490234375, 544.52490234375 } },
+    dbc::Rand_prop_point{ 437, 449.02703857422, 809.91333007813, { 1099.2443847656, 824.43328857422, 618.32495117188, 549.62219238281, 549.62219238281 } },
+    dbc::Rand_prop_point{ 438, 453.62149047852, 821.72039794922, { 1109.5344238281, 832.15081787109, 624.11309814453, 554.76721191406, 554.76721191406 } },
+    dbc::Rand_prop_point{ 439, 458.26263427734, 833.67755126953, { 1119.9207763672, 839.94061279297, 629.95544433594, 559.96038818359, 559.96038818359 } },
+    dbc::Rand_prop_point{ 440, 462.9508972168, 845.78656005859, { 1130.4044189453, 847.80328369141, 635.85247802734, 565.20220947266, 565.20220947266 } },
+    dbc::Rand_prop_point{ 441, 467.68676757813, 858.04925537109, { 1140.9860839844, 855.73956298828, 641.8046875, 570.49304199219, 570.49304199219 } },
+    dbc::Rand_prop_point{ 442, 472.47073364258, 870.46734619141, { 1151.6668701172, 863.75018310547, 647.81262207031, 575.83343505859, 575.83343505859 } },
+    dbc::Rand_prop_point{ 443, 477.30328369141, 883.04278564453, { 1162.4476318359, 871.83575439453, 653.87677001953, 581.22381591797, 581.22381591797 } },
+    dbc::Rand_prop_point{ 444, 482.18493652344, 895.77740478516, { 1173.3293457031, 879.99700927734, 659.99774169922, 586.66467285156, 586.66467285156 } },
+    dbc::Rand_prop_point{ 445, 487.11611938477, 908.67303466797, { 1184.3128662109, 888.23461914063, 666.17596435547, 592.15643310547, 592.15643310547 } },
+    dbc::Rand_prop_point{ 446, 492.0973815918, 921.73156738281, { 1195.3991699219, 896.54943847656, 672.41204833984, 597.69958496094, 597.69958496094 } },
+    dbc::Rand_prop_point{ 447, 497.12924194336, 934.95501708984, { 1206.5893554688, 904.94201660156, 678.70654296875, 603.29467773438, 603.29467773438 } },
+    dbc::Rand_prop_point{ 448, 502.21215820313, 948.34521484375, { 1217.8842773438, 913.41320800781, 685.05987548828, 608.94213867188, 608.94213867188 } },
+    dbc::Rand_prop_point{ 449, 507.3466796875, 961.90417480469, { 1229.2849121094, 921.96362304688, 691.47271728516, 614.64245605469, 614.64245605469 } },
+    dbc::Rand_prop_point{ 450, 512.53332519531, 975.63391113281, { 1240.7922363281, 930.59417724609, 697.94561767578, 620.39611816406, 620.39611816406 } },
+    dbc::Rand_prop_point{ 451, 517.77264404297, 989.53643798828, { 1252.4072265625, 939.30548095703, 704.47906494141, 626.20361328125, 626.20361328125 } },
+    dbc::Rand_prop_point{ 452, 523.06512451172, 1003.6137084961, { 1264.1311035156, 948.09832763672, 711.07373046875, 632.06555175781, 632.06555175781 } },
+    dbc::Rand_prop_point{ 453, 528.41131591797, 1017.8677978516, { 1275.9645996094, 956.97344970703, 717.73010253906, 637.98229980469, 637.98229980469 } },
+    dbc::Rand_prop_point{ 454, 533.81170654297, 1032.3009033203, { 1287.9089355469, 965.93170166016, 724.44879150391, 643.95446777344, 643.95446777344 } },
+    dbc::Rand_prop_point{ 455, 539.26696777344, 1046.9149169922, { 1299.9650878906, 974.97375488281, 731.23034667969, 649.98254394531, 649.98254394531 } },
+    dbc::Rand_prop_point{ 456, 544.77758789063, 1061.7121582031, { 1312.1340332031, 984.10052490234, 738.07537841797, 656.06701660156, 656.06701660156 } },
+    dbc::Rand_prop_point{ 457, 550.34411621094, 1076.6945800781, { 1324.4168701172, 993.31268310547, 744.98449707031, 662.20843505859, 662.20843505859 } },
+    dbc::Rand_prop_point{ 458, 555.96710205078, 1091.8646240234, { 1336.8148193359, 1002.6110839844, 751.95831298828, 668.40740966797, 668.40740966797 } },
+    dbc::Rand_prop_point{ 459, 561.64715576172, 1107.2242431641, { 1349.3287353516, 1011.9965209961, 758.99737548828, 674.66436767578, 674.66436767578 } },
+    dbc::Rand_prop_point{ 460, 567.38482666016, 1122.7757568359, { 1361.9598388672, 1021.4697875977, 766.10235595703, 680.97991943359, 680.97991943359 } },
+    dbc::Rand_prop_point{ 461, 573.1806640625, 1138.5213623047, { 1374.7091064453, 1031.0318603516, 773.27386474609, 687.35455322266, 687.35455322266 } },
+    dbc::Rand_prop_point{ 462, 579.03533935547, 1154.4635009766, { 1387.5777587891, 1040.6833496094, 780.51251220703, 693.78887939453, 693.78887939453 } },
+    dbc::Rand_prop_point{ 463, 584.94940185547, 1170.6042480469, { 1400.5668945312, 1050.4251708984, 787.81884765625, 700.28344726563, 700.28344726563 } },
+    dbc::Rand_prop_point{ 464, 590.92340087891, 1186.9460449219, { 1413.6776123047, 1060.2581787109, 795.19366455078, 706.83880615234, 706.83880615234 } },
+    dbc::Rand_prop_point{ 465, 596.9580078125, 1203.4910888672, { 1426.9110107422, 1070.1832275391, 802.63745117188, 713.45550537109, 713.45550537109 } },
+    dbc::Rand_prop_point{ 466, 603.05383300781, 1220.2420654297, { 1440.2683105469, 1080.2012939453, 810.15093994141, 720.13415527344, 720.13415527344 } },
+    dbc::Rand_prop_point{ 467, 609.21148681641, 1237.2010498047, { 1453.7507324219, 1090.3129882812, 817.73480224609, 726.87536621094, 726.87536621094 } },
+    dbc::Rand_prop_point{ 468, 615.43151855469, 1254.3707275391, { 1467.3592529297, 1100.51953125, 825.38958740234, 733.67962646484, 733.67962646484 } },
+    dbc::Rand_prop_point{ 469, 621.71466064453, 1271.7534179688, { 1481.0952148438, 1110.8214111328, 833.11608886719, 740.54760742188, 740.54760742188 } },
+    dbc::Rand_prop_point{ 470, 628.0615234375, 1289.3515625, { 1494.9598388672, 1121.2198486328, 840.91485595703, 747.47991943359, 747.47991943359 } },
+    dbc::Rand_prop_point{ 471, 634.47271728516, 1307.1677246094, { 1508.9541015625, 1131.7155761719, 848.78668212891, 754.47705078125, 754.47705078125 } },
+    dbc::Rand_prop_point{ 472, 640.94885253906, 1325.2045898438, { 1523.0794677734, 1142.3095703125, 856.73217773438, 761.53973388672, 761.53973388672 } },
+    dbc::Rand_prop_point{ 473, 647.49072265625, 1343.4644775391, { 1537.3370361328, 1153.0028076172, 864.75207519531, 768.66851806641, 768.66851806641 } },
+    dbc::Rand_prop_point{ 474, 654.09881591797, 1361.9501953125, { 1551.7280273438, 1163.7960205078, 872.84698486328, 775.86401367188, 775.86401367188 } },
+    dbc::Rand_prop_point{ 475, 660.77398681641, 1380.6641845703, { 1566.2537841797, 1174.6903076172, 881.01776123047, 783.12689208984, 783.12689208984 } },
+    dbc::Rand_prop_point{ 476, 667.51672363281, 1399.6092529297, { 1580.9155273438, 1185.6866455078, 889.26495361328, 790.45776367188, 790.45776367188 } },
+    dbc::Rand_prop_point{ 477, 674.32781982422, 1418.7879638672, { 1595.7144775391, 1196.7857666016, 897.58935546875, 797.85723876953, 797.85723876953 } },
+    dbc::Rand_prop_point{ 478, 681.2080078125, 1438.203125, { 1610.6519775391, 1207.9888916016, 905.99169921875, 805.32598876953, 805.32598876953 } },
+    dbc::Rand_prop_point{ 479, 688.15783691406, 1457.8575439453, { 1625.7292480469, 1219.296875, 914.47271728516, 812.86462402344, 812.86462402344 } },
+    dbc::Rand_prop_point{ 480, 695.17810058594, 1477.7537841797, { 1640.9477539062, 1230.7108154297, 923.03308105469, 820.47387695313, 820.47387695313 } },
+    dbc::Rand_prop_point{ 481, 702.26953125, 1497.8947753906, { 1656.30859375, 1242.2314453125, 931.67358398438, 828.154296875, 828.154296875 } },
+    dbc::Rand_prop_point{ 482, 709.43273925781, 1518.2834472656, { 1671.8133544922, 1253.8599853516, 940.39501953125, 835.90667724609, 835.90667724609 } },
+    dbc::Rand_prop_point{ 483, 716.66857910156, 1538.9224853516, { 1687.4631347656, 1265.5974121094, 949.19805908203, 843.73156738281, 843.73156738281 } },
+    dbc::Rand_prop_point{ 484, 723.97772216797, 1559.8149414062, { 1703.2595214844, 1277.4447021484, 958.08349609375, 851.62976074219, 851.62976074219 } },
+    dbc::Rand_prop_point{ 485, 731.36090087891, 1580.9636230469, { 1719.2037353516, 1289.4028320312, 967.05212402344, 859.60186767578, 859.60186767578 } },
+    dbc::Rand_prop_point{ 486, 738.81884765625, 1602.3715820312, { 1735.2972412109, 1301.4729003906, 976.10467529297, 867.64862060547, 867.64862060547 } },
+    dbc::Rand_prop_point{ 487, 746.35235595703, 1624.0418701172, { 1751.5413818359, 1313.6560058594, 985.24200439453, 875.77069091797, 875.77069091797 } },
+    dbc::Rand_prop_point{ 488, 753.96215820313, 1645.9774169922, { 1767.9375, 1325.953125, 994.46490478516, 883.96875, 883.96875 } },
+    dbc::Rand_prop_point{ 489, 761.64898681641, 1668.1812744141, { 1784.4871826172, 1338.3654785156, 1003.7739868164, 892.24359130859, 892.24359130859 } },
+    dbc::Rand_prop_point{ 490, 769.41369628906, 1690.6567382812, { 1801.1917724609, 1350.8939208984, 1013.1704101562, 900.59588623047, 900.59588623047 } },
+    dbc::Rand_prop_point{ 491, 777.25708007813, 1713.4067382812, { 1818.052734375, 1363.5395507812, 1022.6547241211, 909.0263671875, 909.0263671875 } },
+    dbc::Rand_prop_point{ 492, 785.17980957031, 1736.4344482422, { 1835.0715332031, 1376.3037109375, 1032.2277832031, 917.53576660156, 917.53576660156 } },
+    dbc::Rand_prop_point{ 493, 793.18280029297, 1759.7431640625, { 1852.2497558594, 1389.1872558594, 1041.8905029297, 926.12487792969, 926.12487792969 } },
+    dbc::Rand_prop_point{ 494, 801.26678466797, 1783.3361816406, { 1869.5886230469, 1402.1915283203, 1051.6435546875, 934.79431152344, 934.79431152344 } },
+    dbc::Rand_prop_point{ 495, 809.43267822266, 1807.2166748047, { 1887.08984375, 1415.3173828125, 1061.4880371094, 943.544921875, 943.544921875 } },
+    dbc::Rand_prop_point{ 496, 817.68115234375, 1831.3879394531, { 1904.7548828125, 1428.5661621094, 1071.4246826172, 952.37744140625, 952.37744140625 } },
+    dbc::Rand_prop_point{ 497, 826.01318359375, 1855.8533935547, { 1922.5853271484, 1441.9389648438, 1081.4542236328, 961.29266357422, 961.29266357422 } },
+    dbc::Rand_prop_point{ 498, 834.42956542969, 1880.6164550781, { 1940.5826416016, 1455.4370117188, 1091.5777587891, 970.29132080078, 970.29132080078 } },
+    dbc::Rand_prop_point{ 499, 842.93109130859, 1905.6804199219, { 1958.7484130859, 1469.0614013672, 1101.7960205078, 979.37420654297, 979.37420654297 } },
+    dbc::Rand_prop_point{ 500, 851.51867675781, 1931.0489501953, { 1977.0843505859, 1482.8132324219, 1112.1099853516, 988.54217529297, 988.54217529297 } },
+    dbc::Rand_prop_point{ 501, 860.19323730469, 1956.7253417969, { 1995.591796875, 1496.6938476562, 1122.5203857422, 997.7958984375, 997.7958984375 } },
+    dbc::Rand_prop_point{ 502, 868.95550537109, 1982.7132568359, { 2014.2725830078, 1510.7044677734, 1133.0283203125, 1007.1362915039, 1007.1362915039 } },
+    dbc::Rand_prop_point{ 503, 877.80645751953, 2009.0162353516, { 2033.1281738281, 1524.8461914062, 1143.6346435547, 1016.5640869141, 1016.5640869141 } },
+    dbc::Rand_prop_point{ 504, 886.74700927734, 2035.6379394531, { 2052.1604003906, 1539.1202392578, 1154.3402099609, 1026.0802001953, 1026.0802001953 } },
+    dbc::Rand_prop_point{ 505, 895.77801513672, 2062.58203125, { 2071.3706054688, 1553.5279541016, 1165.1459960938, 1035.6853027344, 1035.6853027344 } },
+    dbc::Rand_prop_point{ 506, 904.90032958984, 2089.8520507812, { 2090.7607421875, 1568.0705566406, 1176.0528564453, 1045.3803710938, 1045.3803710938 } },
+    dbc::Rand_prop_point{ 507, 914.11499023438, 2117.4521484375, { 2110.3322753906, 1582.7492675781, 1187.0618896484, 1055.1661376953, 1055.1661376953 } },
+    dbc::Rand_prop_point{ 508, 923.42291259766, 2145.3857421875, { 2130.0871582031, 1597.5654296875, 1198.1740722656, 1065.0435791016, 1065.0435791016 } },
+    dbc::Rand_prop_point{ 509, 932.82495117188, 2173.6567382812, { 2150.0268554688, 1612.5201416016, 1209.3901367188, 1075.0134277344, 1075.0134277344 } },
+    dbc::Rand_prop_point{ 510, 942.32208251953, 2202.2687988281, { 2170.1533203125, 1627.6149902344, 1220.7113037109, 1085.0766601562, 1085.0766601562 } },
+    dbc::Rand_prop_point{ 511, 951.91528320313, 2231.2263183594, { 2190.4682617188, 1642.8510742188, 1232.1383056641, 1095.2341308594, 1095.2341308594 } },
+    dbc::Rand_prop_point{ 512, 961.60552978516, 2260.5329589844, { 2210.9731445312, 1658.2298583984, 1243.6723632812, 1105.4865722656, 1105.4865722656 } },
+    dbc::Rand_prop_point{ 513, 971.39379882813, 2290.1928710938, { 2231.6701660156, 1673.7525634766, 1255.314453125, 1115.8350830078, 1115.8350830078 } },
+    dbc::Rand_prop_point{ 514, 981.28100585938, 2320.2097167969, { 2252.5607910156, 1689.4205322266, 1267.0654296875, 1126.2803955078, 1126.2803955078 } },
+    dbc::Rand_prop_point{ 515, 991.26824951172, 2350.5881347656, { 2273.6469726562, 1705.2352294922, 1278.9263916016, 1136.8234863281, 1136.8234863281 } },
+    dbc::Rand_prop_point{ 516, 1001.3563842773, 2381.3317871094, { 2294.9306640625, 1721.1979980469, 1290.8984375, 1147.4653320312, 1147.4653320312 } },
+    dbc::Rand_prop_point{ 517, 1011.5466918945, 2412.4450683594, { 2316.4135742188, 1737.3100585938, 1302.9825439453, 1158.2067871094, 1158.2067871094 } },
+    dbc::Rand_prop_point{ 518, 1021.8400268555, 2443.9321289062, { 2338.0974121094, 1753.5731201172, 1315.1798095703, 1169.0487060547, 1169.0487060547 } },
+    dbc::Rand_prop_point{ 519, 1032.2373046875, 2475.7976074219, { 2359.984375, 1769.98828125, 1327.4912109375, 1179.9921875, 1179.9921875 } },
+    dbc::Rand_prop_point{ 520, 1042.7397460938, 2508.0451660156, { 2382.076171875, 1786.5571289062, 1339.9178466797, 1191.0380859375, 1191.0380859375 } },
+    dbc::Rand_prop_point{ 521, 1053.3483886719, 2540.6796875, { 2404.3747558594, 1803.2811279297, 1352.4608154297, 1202.1873779297, 1202.1873779297 } },
+    dbc::Rand_prop_point{ 522, 1064.0642089844, 2573.7053222656, { 2426.8820800781, 1820.1616210938, 1365.1212158203, 1213.4410400391, 1213.4410400391 } },
+    dbc::Rand_prop_point{ 523, 1074.8884277344, 2607.1267089844, { 2449.6003417969, 1837.2001953125, 1377.9001464844, 1224.8001708984, 1224.8001708984 } },
+    dbc::Rand_prop_point{ 524, 1085.8220214844, 2640.9482421875, { 2472.5310058594, 1854.3981933594, 1390.7987060547, 1236.2655029297, 1236.2655029297 } },
+    dbc::Rand_prop_point{ 525, 1096.8660888672, 2675.1745605469, { 2495.6762695312, 1871.7572021484, 1403.8179931641, 1247.8381347656, 1247.8381347656 } },
+    dbc::Rand_prop_point{ 526, 1108.0218505859, 2709.8100585938, { 2519.0383300781, 1889.2788085938, 1416.9591064453, 1259.5191650391, 1259.5191650391 } },
+    dbc::Rand_prop_point{ 527, 1119.2902832031, 2744.8598632812, { 2542.619140625, 1906.9643554688, 1430.2232666016, 1271.3095703125, 1271.3095703125 } },
+    dbc::Rand_prop_point{ 528, 1130.6726074219, 2780.328125, { 2566.4206542969, 1924.8154296875, 1443.6115722656, 1283.2103271484, 1283.2103271484 } },
+    dbc::Rand_prop_point{ 529, 1142.169921875, 2816.2202148438, { 2590.4448242188, 1942.8336181641, 1457.1252441406, 1295.2224121094, 1295.2224121094 } },
+    dbc::Rand_prop_point{ 530, 1153.7834472656, 2852.5402832031, { 2614.6940917969, 1961.0205078125, 1470.7653808594, 1307.3470458984, 1307.3470458984 } },
+    dbc::Rand_prop_point{ 531, 1165.5142822266, 2889.2939453125, { 2639.1701660156, 1979.3776855469, 1484.533203125, 1319.5850830078, 1319.5850830078 } },
+    dbc::Rand_prop_point{ 532, 1177.3637695312, 2926.4853515625, { 2663.8754882812, 1997.9066162109, 1498.4299316406, 1331.9377441406, 1331.9377441406 } },
+    dbc::Rand_prop_point{ 533, 1189.3327636719, 2964.1201171875, { 2688.8120117188, 2016.6090087891, 1512.4567871094, 1344.4060058594, 1344.4060058594 } },
+    dbc::Rand_prop_point{ 534, 1201.4228515625, 3002.203125, { 2713.9819335938, 2035.4864501953, 1526.6148681641, 1356.9909667969, 1356.9909667969 } },
+    dbc::Rand_prop_point{ 535, 1213.6350097656, 3040.7392578125, { 2739.3876953125, 2054.5407714844, 1540.9055175781, 1369.6938476562, 1369.6938476562 } },
+    dbc::Rand_prop_point{ 536, 1225.9704589844, 3079.7336425781, { 2765.0310058594, 2073.7731933594, 1555.3299560547, 1382.5155029297, 1382.5155029297 } },
+    dbc::Rand_prop_point{ 537, 1238.4305419922, 3119.1918945312, { 2790.9145507812, 2093.1857910156, 1569.8894042969, 1395.4572753906, 1395.4572753906 } },
+    dbc::Rand_prop_point{ 538, 1251.0164794922, 3159.1186523438, { 2817.0402832031, 2112.7802734375, 1584.5852050781, 1408.5201416016, 1408.5201416016 } },
+    dbc::Rand_prop_point{ 539, 1263.7296142578, 3199.5200195312, { 2843.4106445312, 2132.5578613281, 1599.4184570312, 1421.7053222656, 1421.7053222656 } },
+    dbc::Rand_prop_point{ 540, 1276.5710449219, 3240.4006347656, { 2870.0278320312, 2152.5207519531, 1614.390625, 1435.0139160156, 1435.0139160156 } },
+    dbc::Rand_prop_point{ 541, 1289.5421142578, 3281.7663574219, { 2896.8940429688, 2172.6706542969, 1629.5029296875, 1448.4470214844, 1448.4470214844 } },
+    dbc::Rand_prop_point{ 542, 1302.6442871094, 3323.6225585938, { 2924.0119628906, 2193.0090332031, 1644.7567138672, 1462.0059814453, 1462.0059814453 } },
+    dbc::Rand_prop_point{ 543, 1315.8786621094, 3365.9748535156, { 2951.3835449219, 2213.5378417969, 1660.1533203125, 1475.6917724609, 1475.6917724609 } },
+    dbc::Rand_prop_point{ 544, 1329.2467041016, 3408.8288574219, { 2979.0114746094, 2234.2587890625, 1675.6939697266, 1489.5057373047, 1489.5057373047 } },
+    dbc::Rand_prop_point{ 545, 1342.7497558594, 3452.1901855469, { 3006.8981933594, 2255.1735839844, 1691.3802490234, 1503.4490966797, 1503.4490966797 } },
+    dbc::Rand_prop_point{ 546, 1356.3890380859, 3496.064453125, { 3035.0456542969, 2276.2841796875, 1707.2132568359, 1517.5228271484, 1517.5228271484 } },
+    dbc::Rand_prop_point{ 547, 1370.166015625, 3540.4577636719, { 3063.4567871094, 2297.5925292969, 1723.1944580078, 1531.7283935547, 1531.7283935547 } },
+    dbc::Rand_prop_point{ 548, 1384.0821533203, 3585.3759765625, { 3092.1337890625, 2319.1003417969, 1739.3253173828, 1546.0668945312, 1546.0668945312 } },
+    dbc::Rand_prop_point{ 549, 1398.138671875, 3630.8247070312, { 3121.0793457031, 2340.8095703125, 1755.6070556641, 1560.5396728516, 1560.5396728516 } },
+    dbc::Rand_prop_point{ 550, 1412.3371582031, 3676.8103027344, { 3150.2956542969, 2362.7219238281, 1772.0413818359, 1575.1478271484, 1575.1478271484 } },
+    dbc::Rand_prop_point{ 551, 1426.6789550781, 3723.3386230469, { 3179.7856445312, 2384.8393554688, 1788.6293945312, 1589.8928222656, 1589.8928222656 } },
+    dbc::Rand_prop_point{ 552, 1441.1654052734, 3770.4157714844, { 3209.5517578125, 2407.1638183594, 1805.3728027344, 1604.7758789062, 1604.7758789062 } },
+    dbc::Rand_prop_point{ 553, 1455.7980957031, 3818.0480957031, { 3239.5964355469, 2429.697265625, 1822.2729492188, 1619.7982177734, 1619.7982177734 } },
+    dbc::Rand_prop_point{ 554, 1470.5784912109, 3866.2419433594, { 3269.9221191406, 2452.4416503906, 1839.3311767578, 1634.9610595703, 1634.9610595703 } },
+    dbc::Rand_prop_point{ 555, 1485.5080566406, 3915.0031738281, { 3300.5319824219, 2475.3989257812, 1856.5491943359, 1650.2659912109, 1650.2659912109 } },
+    dbc::Rand_prop_point{ 556, 1500.5881347656, 3964.3388671875, { 3331.4282226562, 2498.5712890625, 1873.9283447266, 1665.7141113281, 1665.7141113281 } },
+    dbc::Rand_prop_point{ 557, 1515.8204345703, 4014.2548828125, { 3362.6137695312, 2521.9602050781, 1891.4702148438, 1681.3068847656, 1681.3068847656 } },
+    dbc::Rand_prop_point{ 558, 1531.2064208984, 4064.7583007812, { 3394.0913085938, 2545.568359375, 1909.1762695312, 1697.0456542969, 1697.0456542969 } },
+    dbc::Rand_prop_point{ 559, 1546.7476806641, 4115.8549804688, { 3425.86328125, 2569.3974609375, 1927.0480957031, 1712.931640625, 1712.931640625 } },
+    dbc::Rand_prop_point{ 560, 1562.4456787109, 4167.552734375, { 3457.9328613281, 2593.4497070312, 1945.0872802734, 1728.9664306641, 1728.9664306641 } },
+    dbc::Rand_prop_point{ 561, 1578.3021240234, 4219.857421875, { 3490.3024902344, 2617.7270507812, 1963.2951660156, 1745.1512451172, 1745.1512451172 } },
+    dbc::Rand_prop_point{ 562, 1594.3184814453, 4272.7763671875, { 3522.9753417969, 2642.2314453125, 1981.6735839844, 1761.4876708984, 1761.4876708984 } },
+    dbc::Rand_prop_point{ 563, 1610.4963378906, 4326.3159179688, { 3555.9538574219, 2666.9653320312, 2000.2241210938, 1777.9769287109, 1777.9769287109 } },
+    dbc::Rand_prop_point{ 564, 1626.8374023438, 4380.4833984375, { 3589.2412109375, 2691.9309082031, 2018.9482421875, 1794.6206054688, 1794.6206054688 } },
+    dbc::Rand_prop_point{ 565, 1643.3432617188, 4435.2861328125, { 3622.8400878906, 2717.1301269531, 2037.8475341797, 1811.4200439453, 1811.4200439453 } },
+    dbc::Rand_prop_point{ 566, 1660.0155029297, 4490.7309570312, { 3656.7536621094, 2742.5651855469, 2056.923828125, 1828.3768310547, 1828.3768310547 } },
+    dbc::Rand_prop_point{ 567, 1676.8560791016, 4546.8251953125, { 3690.984375, 2768.23828125, 2076.1787109375, 1845.4921875, 1845.4921875 } },
+    dbc::Rand_prop_point{ 568, 1693.8663330078, 4603.576171875, { 3725.5356445312, 2794.1518554688, 2095.6137695312, 1862.7678222656, 1862.7678222656 } },
+    dbc::Rand_prop_point{ 569, 1711.0480957031, 4660.9912109375, { 3760.4106445312, 2820.3078613281, 2115.2309570312, 1880.2052001953, 1880.2052001953 } },
+    dbc::Rand_prop_point{ 570, 1728.4031982422, 4719.0776367188, { 3795.6118164062, 2846.7087402344, 2135.0314941406, 1897.8059082031, 1897.8059082031 } },
+    dbc::Rand_prop_point{ 571, 1736.4741210938, 1436.6784667969, { 3831.142578125, 2873.3569335938, 2155.017578125, 1915.5712890625, 1915.5712890625 } },
+    dbc::Rand_prop_point{ 572, 1744.5827636719, 1450.1271972656, { 3867.005859375, 2900.2543945312, 2175.1906738281, 1933.5029296875, 1933.5029296875 } },
+    dbc::Rand_prop_point{ 573, 1752.7292480469, 1463.7017822266, { 3903.2048339844, 2927.4035644531, 2195.552734375, 1951.6024169922, 1951.6024169922 } },
+    dbc::Rand_prop_point{ 574, 1760.9138183594, 1477.4035644531, { 3939.7429199219, 2954.8071289062, 2216.1052246094, 1969.8714599609, 1969.8714599609 } },
+    dbc::Rand_prop_point{ 575, 1769.1365966797, 1491.2335205078, { 3976.6228027344, 2982.4670410156, 2236.8503417969, 1988.3114013672, 1988.3114013672 } },
+    dbc::Rand_prop_point{ 576, 1777.3977050781, 1505.1929931641, { 4013.8479003906, 3010.3859863281, 2257.7895507812, 2006.9239501953, 2006.9239501953 } },
+    dbc::Rand_prop_point{ 577, 1785.6975097656, 1519.2830810547, { 4051.4216308594, 3038.5661621094, 2278.9245605469, 2025.7108154297, 2025.7108154297 } },
+    dbc::Rand_prop_point{ 578, 1794.0360107422, 1533.5051269531, { 4089.3469238281, 3067.0102539062, 2300.2575683594, 2044.6734619141, 2044.6734619141 } },
+    dbc::Rand_prop_point{ 579, 1802.4134521484, 1547.8602294922, { 4127.6274414062, 3095.7204589844, 2321.7905273438, 2063.8137207031, 2063.8137207031 } },
+    dbc::Rand_prop_point{ 580, 1810.8299560547, 1562.3498535156, { 4166.2661132812, 3124.6997070312, 2343.5246582031, 2083.1330566406, 2083.1330566406 } },
+    dbc::Rand_prop_point{ 581, 1819.2858886719, 1576.9749755859, { 4205.2666015625, 3153.9499511719, 2365.4624023438, 2102.6333007812, 2102.6333007812 } },
+    dbc::Rand_prop_point{ 582, 1827.7811279297, 1591.7370605469, { 4244.6323242188, 3183.4741210938, 2387.60546875, 2122.3161621094, 2122.3161621094 } },
+    dbc::Rand_prop_point{ 583, 1836.3161621094, 1606.6373291016, { 4284.3662109375, 3213.2746582031, 2409.9560546875, 2142.1831054688, 2142.1831054688 } },
+    dbc::Rand_prop_point{ 584, 1844.8909912109, 1621.6770019531, { 4324.4721679688, 3243.3540039062, 2432.515625, 2162.2360839844, 2162.2360839844 } },
+    dbc::Rand_prop_point{ 585, 1853.5059814453, 1636.8575439453, { 4364.9536132812, 3273.7150878906, 2455.2863769531, 2182.4768066406, 2182.4768066406 } },
+    dbc::Rand_prop_point{ 586, 1862.1610107422, 1652.1801757812, { 4405.8139648438, 3304.3603515625, 2478.2702636719, 2202.9069824219, 2202.9069824219 } },
+    dbc::Rand_prop_point{ 587, 1870.8565673828, 1667.6462402344, { 4447.056640625, 3335.2924804688, 2501.4694824219, 2223.5283203125, 2223.5283203125 } },
+    dbc::Rand_prop_point{ 588, 1879.5927734375, 1683.2570800781, { 4488.685546875, 3366.5141601562, 2524.8857421875, 2244.3427734375, 2244.3427734375 } },
+    dbc::Rand_prop_point{ 589, 1888.3697509766, 1699.0140380859, { 4530.7041015625, 3398.0280761719, 2548.5212402344, 2265.3520507812, 2265.3520507812 } },
+    dbc::Rand_prop_point{ 590, 1897.1876220703, 1714.9185791016, { 4573.1162109375, 3429.8371582031, 2572.3779296875, 2286.5581054688, 2286.5581054688 } },
+    dbc::Rand_prop_point{ 591, 1906.0467529297, 1730.9719238281, { 4615.9252929688, 3461.9438476562, 2596.4580078125, 2307.9626464844, 2307.9626464844 } },
+    dbc::Rand_prop_point{ 592, 1914.947265625, 1747.1755371094, { 4659.134765625, 3494.3510742188, 2620.7634277344, 2329.5673828125, 2329.5673828125 } },
+    dbc::Rand_prop_point{ 593, 1923.8892822266, 1763.5308837891, { 4702.7490234375, 3527.0617675781, 2645.2963867188, 2351.3745117188, 2351.3745117188 } },
+    dbc::Rand_prop_point{ 594, 1932.873046875, 1780.0393066406, { 4746.771484375, 3560.0786132812, 2670.0590820312, 2373.3857421875, 2373.3857421875 } },
+    dbc::Rand_prop_point{ 595, 1941.8988037109, 1796.7022705078, { 4791.2060546875, 3593.4045410156, 2695.0534667969, 2395.6030273438, 2395.6030273438 } },
+    dbc::Rand_prop_point{ 596, 1950.9666748047, 1813.5212402344, { 4836.056640625, 3627.0424804688, 2720.2817382812, 2418.0283203125, 2418.0283203125 } },
+    dbc::Rand_prop_point{ 597, 1960.0769042969, 1830.4975585938, { 4881.3271484375, 3660.9951171875, 2745.7463378906, 2440.6635742188, 2440.6635742188 } },
+    dbc::Rand_prop_point{ 598, 1969.2297363281, 1847.6329345703, { 4927.0209960938, 3695.2658691406, 2771.44921875, 2463.5104980469, 2463.5104980469 } },
+    dbc::Rand_prop_point{ 599, 1978.4251708984, 1864.9285888672, { 4973.1430664062, 3729.8571777344, 2797.3928222656, 2486.5715332031, 2486.5715332031 } },
+    dbc::Rand_prop_point{ 600, 1987.6636962891, 1882.3862304688, { 5019.6967773438, 3764.7724609375, 2823.5793457031, 2509.8483886719, 2509.8483886719 } },
+    dbc::Rand_prop_point{ 601, 1996.9453125, 1900.0072021484, { 5066.6860351562, 3800.0144042969, 2850.0107421875, 2533.3430175781, 2533.3430175781 } },
+    dbc::Rand_prop_point{ 602, 2006.2702636719, 1917.7932128906, { 5114.115234375, 3835.5864257812, 2876.6896972656, 2557.0576171875, 2557.0576171875 } },
+    dbc::Rand_prop_point{ 603, 2015.638671875, 1935.7457275391, { 5161.98828125, 3871.4914550781, 2903.6184082031, 2580.994140625, 2580.994140625 } },
+    dbc::Rand_prop_point{ 604, 2025.0509033203, 1953.8662109375, { 5210.3100585938, 3907.732421875, 2930.7993164062, 2605.1550292969, 2605.1550292969 } },
+    dbc::Rand_prop_point{ 605, 2034.5070800781, 1972.1563720703, { 5259.0834960938, 3944.3127441406, 2958.2346191406, 2629.5417480469, 2629.5417480469 } },
+    dbc::Rand_prop_point{ 606, 2044.0074462891, 1990.6176757812, { 5308.3139648438, 3981.2353515625, 2985.9265136719, 2654.1569824219, 2654.1569824219 } },
+    dbc::Rand_prop_point{ 607, 2053.5522460938, 2009.251953125, { 5358.0048828125, 4018.50390625, 3013.8779296875, 2679.0024414062, 2679.0024414062 } },
+    dbc::Rand_prop_point{ 608, 2063.1413574219, 2028.060546875, { 5408.1616210938, 4056.12109375, 3042.0908203125, 2704.0808105469, 2704.0808105469 } },
+    dbc::Rand_prop_point{ 609, 2072.775390625, 2047.0451660156, { 5458.787109375, 4094.0903320312, 3070.5678710938, 2729.3935546875, 2729.3935546875 } },
+    dbc::Rand_prop_point{ 610, 2082.4545898438, 2066.2075195312, { 5509.8872070312, 4132.4150390625, 3099.3115234375, 2754.9436035156, 2754.9436035156 } },
+    dbc::Rand_prop_point{ 611, 2092.1787109375, 2085.5493164062, { 5561.46484375, 4171.0986328125, 3128.3239746094, 2780.732421875, 2780.732421875 } },
+    dbc::Rand_prop_point{ 612, 2105.072265625, 2105.072265625, { 5613.5258789062, 4210.14453125, 3157.6083984375, 2806.7629394531, 2806.7629394531 } },
+    dbc::Rand_prop_point{ 613, 2124.7778320312, 2124.7778320312, { 5666.07421875, 4249.5556640625, 3187.1667480469, 2833.037109375, 2833.037109375 } },
+    dbc::Rand_prop_point{ 614, 2144.66796875, 2144.66796875, { 5719.1142578125, 4289.3359375, 3217.0017089844, 2859.5571289062, 2859.5571289062 } },
+    dbc::Rand_prop_point{ 615, 2164.744140625, 2164.744140625, { 5772.6508789062, 4329.48828125, 3247.1162109375, 2886.3254394531, 2886.3254394531 } },
+    dbc::Rand_prop_point{ 616, 2185.0083007812, 2185.0083007812, { 5826.6889648438, 4370.0166015625, 3277.5124511719, 2913.3444824219, 2913.3444824219 } },
+    dbc::Rand_prop_point{ 617, 2205.4621582031, 2205.4621582031, { 5881.232421875, 4410.9243164062, 3308.193359375, 2940.6162109375, 2940.6162109375 } },
+    dbc::Rand_prop_point{ 618, 2226.107421875, 2226.107421875, { 5936.2866210938, 4452.21484375, 3339.1613769531, 2968.1433105469, 2968.1433105469 } },
+    dbc::Rand_prop_point{ 619, 2246.9460449219, 2246.9460449219, { 5991.8564453125, 4493.8920898438, 3370.4191894531, 2995.9282226562, 2995.9282226562 } },
+    dbc::Rand_prop_point{ 620, 2267.9797363281, 2267.9797363281, { 6047.9462890625, 4535.9594726562, 3401.9697265625, 3023.9731445312, 3023.9731445312 } },
+    dbc::Rand_prop_point{ 621, 2289.2104492188, 2289.2104492188, { 6104.5610351562, 4578.4208984375, 3433.8156738281, 3052.2805175781, 3052.2805175781 } },
+    dbc::Rand_prop_point{ 622, 2310.6396484375, 2310.6396484375, { 6161.7060546875, 4621.279296875, 3465.9594726562, 3080.8530273438, 3080.8530273438 } },
+    dbc::Rand_prop_point{ 623, 2332.26953125, 2332.26953125, { 6219.3857421875, 4664.5390625, 3498.404296875, 3109.6928710938, 3109.6928710938 } },
+    dbc::Rand_prop_point{ 624, 2354.1020507812, 2354.1020507812, { 6277.60546875, 4708.2041015625, 3531.1530761719, 3138.802734375, 3138.802734375 } },
+    dbc::Rand_prop_point{ 625, 2376.138671875, 2376.138671875, { 6336.3701171875, 4752.27734375, 3564.2082519531, 3168.1850585938, 3168.1850585938 } },
+    dbc::Rand_prop_point{ 626, 2398.3818359375, 2398.3818359375, { 6395.6845703125, 4796.763671875, 3597.5727539062, 3197.8422851562, 3197.8422851562 } },
+    dbc::Rand_prop_point{ 627, 2420.8330078125, 2420.8330078125, { 6455.5546875, 4841.666015625, 3631.2495117188, 3227.77734375, 3227.77734375 } },
+    dbc::Rand_prop_point{ 628, 2443.4943847656, 2443.4943847656, { 6515.9853515625, 4886.9887695312, 3665.2416992188, 3257.9926757812, 3257.9926757812 } },
+    dbc::Rand_prop_point{ 629, 2466.3681640625, 2466.3681640625, { 6576.9814453125, 4932.736328125, 3699.5520019531, 3288.4907226562, 3288.4907226562 } },
+    dbc::Rand_prop_point{ 630, 2489.4558105469, 2489.4558105469, { 6638.548828125, 4978.9116210938, 3734.18359375, 3319.2744140625, 3319.2744140625 } },
+    dbc::Rand_prop_point{ 631, 2512.7595214844, 2512.7595214844, { 6700.6923828125, 5025.5190429688, 3769.1394042969, 3350.3461914062, 3350.3461914062 } },
+    dbc::Rand_prop_point{ 632, 2536.2814941406, 2536.2814941406, { 6763.4174804688, 5072.5629882812, 3804.4223632812, 3381.7087402344, 3381.7087402344 } },
+    dbc::Rand_prop_point{ 633, 2560.0236816406, 2560.0236816406, { 6826.7299804688, 5120.0473632812, 3840.0354003906, 3413.3649902344, 3413.3649902344 } },
+    dbc::Rand_prop_point{ 634, 2583.9880371094, 2583.9880371094, { 6890.634765625, 5167.9760742188, 3875.9821777344, 3445.3173828125, 3445.3173828125 } },
+    dbc::Rand_prop_point{ 635, 2608.1767578125, 2608.1767578125, { 6955.1381835938, 5216.353515625, 3912.2651367188, 3477.5690917969, 3477.5690917969 } },
+    dbc::Rand_prop_point{ 636, 2632.5920410156, 2632.5920410156, { 7020.2451171875, 5265.1840820312, 3948.8879394531, 3510.1225585938, 3510.1225585938 } },
+    dbc::Rand_prop_point{ 637, 2657.2355957031, 2657.2355957031, { 7085.9619140625, 5314.4711914062, 3985.853515625, 3542.9809570312, 3542.9809570312 } },
+    dbc::Rand_prop_point{ 638, 2682.1101074219, 2682.1101074219, { 7152.2934570312, 5364.2202148438, 4023.1650390625, 3576.1467285156, 3576.1467285156 } },
+    dbc::Rand_prop_point{ 639, 2707.2172851562, 2707.2172851562, { 7219.24609375, 5414.4345703125, 4060.8259277344, 3609.623046875, 3609.623046875 } },
+    dbc::Rand_prop_point{ 640, 2732.5595703125, 2732.5595703125, { 7286.8256835938, 5465.119140625, 4098.8393554688, 3643.4128417969, 3643.4128417969 } },
+    dbc::Rand_prop_point{ 641, 2758.1391601562, 2758.1391601562, { 7355.0375976562, 5516.2783203125, 4137.2084960938, 3677.5187988281, 3677.5187988281 } },
+    dbc::Rand_prop_point{ 642, 2783.9580078125, 2783.9580078125, { 7423.8881835938, 5567.916015625, 4175.9370117188, 3711.9440917969, 3711.9440917969 } },
+    dbc::Rand_prop_point{ 643, 2810.0185546875, 2810.0185546875, { 7493.3833007812, 5620.037109375, 4215.0278320312, 3746.6916503906, 3746.6916503906 } },
+    dbc::Rand_prop_point{ 644, 2836.3232421875, 2836.3232421875, { 7563.5288085938, 5672.646484375, 4254.4848632812, 3781.7644042969, 3781.7644042969 } },
+    dbc::Rand_prop_point{ 645, 2862.8740234375, 2862.8740234375, { 7634.3310546875, 5725.748046875, 4294.3110351562, 3817.1655273438, 3817.1655273438 } },
+    dbc::Rand_prop_point{ 646, 2889.6735839844, 2889.6735839844, { 7705.7958984375, 5779.3471679688, 4334.5102539062, 3852.8979492188, 3852.8979492188 } },
+    dbc::Rand_prop_point{ 647, 2916.7236328125, 2916.7236328125, { 7777.9301757812, 5833.447265625, 4375.0854492188, 3888.9650878906, 3888.9650878906 } },
+    dbc::Rand_prop_point{ 648, 2944.0270996094, 2944.0270996094, { 7850.7392578125, 5888.0541992188, 4416.041015625, 3925.3696289062, 3925.3696289062 } },
+    dbc::Rand_prop_point{ 649, 2971.5861816406, 2971.5861816406, { 7924.2299804688, 5943.1723632812, 4457.3793945312, 3962.1149902344, 3962.1149902344 } },
+    dbc::Rand_prop_point{ 650, 2999.4033203125, 2999.4033203125, { 7998.4086914062, 5998.806640625, 4499.1049804688, 3999.2043457031, 3999.2043457031 } },
+    dbc::Rand_prop_point{ 651, 3027.4807128906, 3027.4807128906, { 8073.2817382812, 6054.9614257812, 4541.2211914062, 4036.6408691406, 4036.6408691406 } },
+    dbc::Rand_prop_point{ 652, 3055.8210449219, 3055.8210449219, { 8148.8559570312, 6111.6420898438, 4583.7314453125, 4074.4279785156, 4074.4279785156 } },
+    dbc::Rand_prop_point{ 653, 3084.4265136719, 3084.4265136719, { 8225.1376953125, 6168.8530273438, 4626.6396484375, 4112.5688476562, 4112.5688476562 } },
+    dbc::Rand_prop_point{ 654, 3113.2998046875, 3113.2998046875, { 8302.1328125, 6226.599609375, 4669.9497070312, 4151.06640625, 4151.06640625 } },
+    dbc::Rand_prop_point{ 655, 3142.4436035156, 3142.4436035156, { 8379.849609375, 6284.8872070312, 4713.6650390625, 4189.9248046875, 4189.9248046875 } },
+    dbc::Rand_prop_point{ 656, 3171.8598632812, 3171.8598632812, { 8458.29296875, 6343.7197265625, 4757.7900390625, 4229.146484375, 4229.146484375 } },
+    dbc::Rand_prop_point{ 657, 3201.5517578125, 3201.5517578125, { 8537.4716796875, 6403.103515625, 4802.3276367188, 4268.7358398438, 4268.7358398438 } },
+    dbc::Rand_prop_point{ 658, 3231.521484375, 3231.521484375, { 8617.390625, 6463.04296875, 4847.2822265625, 4308.6953125, 4308.6953125 } },
+    dbc::Rand_prop_point{ 659, 3261.7717285156, 3261.7717285156, { 8698.0576171875, 6523.5434570312, 4892.6577148438, 4349.0288085938, 4349.0288085938 } },
+    dbc::Rand_prop_point{ 660, 3292.3051757812, 3292.3051757812, { 8779.48046875, 6584.6103515625, 4938.4580078125, 4389.740234375, 4389.740234375 } },
+    dbc::Rand_prop_point{ 661, 3323.1245117188, 3323.1245117188, { 8861.6650390625, 6646.2490234375, 4984.6870117188, 4430.8325195312, 4430.8325195312 } },
+    dbc::Rand_prop_point{ 662, 3354.232421875, 3354.232421875, { 8944.619140625, 6708.46484375, 5031.3486328125, 4472.3095703125, 4472.3095703125 } },
+    dbc::Rand_prop_point{ 663, 3385.6313476562, 3385.6313476562, { 9028.3505859375, 6771.2626953125, 5078.4467773438, 4514.1752929688, 4514.1752929688 } },
+    dbc::Rand_prop_point{ 664, 3417.32421875, 3417.32421875, { 9112.8642578125, 6834.6484375, 5125.986328125, 4556.4321289062, 4556.4321289062 } },
+    dbc::Rand_prop_point{ 665, 3449.3137207031, 3449.3137207031, { 9198.169921875, 6898.6274414062, 5173.970703125, 4599.0849609375, 4599.0849609375 } },
+    dbc::Rand_prop_point{ 666, 3481.6027832031, 3481.6027832031, { 9284.2744140625, 6963.2055664062, 5222.404296875, 4642.1372070312, 4642.1372070312 } },
+    dbc::Rand_prop_point{ 667, 3514.1940917969, 3514.1940917969, { 9371.1845703125, 7028.3881835938, 5271.291015625, 4685.5922851562, 4685.5922851562 } },
+    dbc::Rand_prop_point{ 668, 3547.0905761719, 3547.0905761719, { 9458.908203125, 7094.1811523438, 5320.6357421875, 4729.4541015625, 4729.4541015625 } },
+    dbc::Rand_prop_point{ 669, 3580.294921875, 3580.294921875, { 9547.453125, 7160.58984375, 5370.4423828125, 4773.7265625, 4773.7265625 } },
+    dbc::Rand_prop_point{ 670, 3613.8100585938, 3613.8100585938, { 9636.8271484375, 7227.6201171875, 5420.71484375, 4818.4135742188, 4818.4135742188 } },
+    dbc::Rand_prop_point{ 671, 3647.6389160156, 3647.6389160156, { 9727.037109375, 7295.2778320312, 5471.4584960938, 4863.5185546875, 4863.5185546875 } },
+    dbc::Rand_prop_point{ 672, 3681.7844238281, 3681.7844238281, { 9818.091796875, 7363.5688476562, 5522.6767578125, 4909.0458984375, 4909.0458984375 } },
+    dbc::Rand_prop_point{ 673, 3716.2497558594, 3716.2497558594, { 9909.9990234375, 7432.4995117188, 5574.3745117188, 4954.9995117188, 4954.9995117188 } },
+    dbc::Rand_prop_point{ 674, 3751.0375976562, 3751.0375976562, { 10002.766601562, 7502.0751953125, 5626.5561523438, 5001.3833007812, 5001.3833007812 } },
+    dbc::Rand_prop_point{ 675, 3786.1511230469, 3786.1511230469, { 10096.40234375, 7572.3022460938, 5679.2265625, 5048.201171875, 5048.201171875 } },
+    dbc::Rand_prop_point{ 676, 3821.5932617188, 3821.5932617188, { 10190.915039062, 7643.1865234375, 5732.3896484375, 5095.4575195312, 5095.4575195312 } },
+    dbc::Rand_prop_point{ 677, 3857.3671875, 3857.3671875, { 10286.313476562, 7714.734375, 5786.05078125, 5143.15625, 5143.15625 } },
+    dbc::Rand_prop_point{ 678, 3893.4760742188, 3893.4760742188, { 10382.602539062, 7786.9521484375, 5840.2138671875, 5191.3012695312, 5191.3012695312 } },
+    dbc::Rand_prop_point{ 679, 3929.9228515625, 3929.9228515625, { 10479.793945312, 7859.845703125, 5894.8842773438, 5239.8969726562, 5239.8969726562 } },
+    dbc::Rand_prop_point{ 680, 3966.7109375, 3966.7109375, { 10577.896484375, 7933.421875, 5950.06640625, 5288.9477539062, 5288.9477539062 } },
+    dbc::Rand_prop_point{ 681, 4003.8432617188, 4003.8432617188, { 10676.915039062, 8007.6865234375, 6005.7651367188, 5338.4575195312, 5338.4575195312 } },
+    dbc::Rand_prop_point{ 682, 4041.3232421875, 4041.3232421875, { 10776.862304688, 8082.646484375, 6061.9848632812, 5388.4311523438, 5388.4311523438 } },
+    dbc::Rand_prop_point{ 683, 4079.1540527344, 4079.1540527344, { 10877.744140625, 8158.3081054688, 6118.7309570312, 5438.8720703125, 5438.8720703125 } },
+    dbc::Rand_prop_point{ 684, 4117.3388671875, 4117.3388671875, { 10979.571289062, 8234.677734375, 6176.0087890625, 5489.7856445312, 5489.7856445312 } },
+    dbc::Rand_prop_point{ 685, 4155.8813476562, 4155.8813476562, { 11082.350585938, 8311.7626953125, 6233.822265625, 5541.1752929688, 5541.1752929688 } },
+    dbc::Rand_prop_point{ 686, 4194.7846679688, 4194.7846679688, { 11186.092773438, 8389.5693359375, 6292.1772460938, 5593.0463867188, 5593.0463867188 } },
+    dbc::Rand_prop_point{ 687, 4234.0522460938, 4234.0522460938, { 11290.805664062, 8468.1044921875, 6351.078125, 5645.4028320312, 5645.4028320312 } },
+    dbc::Rand_prop_point{ 688, 4273.6870117188, 4273.6870117188, { 11396.499023438, 8547.3740234375, 6410.5307617188, 5698.2495117188, 5698.2495117188 } },
+    dbc::Rand_prop_point{ 689, 4313.693359375, 4313.693359375, { 11503.181640625, 8627.38671875, 6470.5395507812, 5751.5908203125, 5751.5908203125 } },
+    dbc::Rand_prop_point{ 690, 4354.0737304688, 4354.0737304688, { 11610.86328125, 8708.1474609375, 6531.1103515625, 5805.431640625, 5805.431640625 } },
+    dbc::Rand_prop_point{ 691, 4394.83203125, 4394.83203125, { 11719.552734375, 8789.6640625, 6592.248046875, 5859.7763671875, 5859.7763671875 } },
+    dbc::Rand_prop_point{ 692, 4435.9721679688, 4435.9721679688, { 11829.258789062, 8871.9443359375, 6653.9584960938, 5914.6293945312, 5914.6293945312 } },
+    dbc::Rand_prop_point{ 693, 4477.4975585938, 4477.4975585938, { 11939.993164062, 8954.9951171875, 6716.24609375, 5969.9965820312, 5969.9965820312 } },
+    dbc::Rand_prop_point{ 694, 4519.4111328125, 4519.4111328125, { 12051.763671875, 9038.822265625, 6779.1166992188, 6025.8818359375, 6025.8818359375 } },
+    dbc::Rand_prop_point{ 695, 4561.7172851562, 4561.7172851562, { 12164.580078125, 9123.4345703125, 6842.576171875, 6082.2900390625, 6082.2900390625 } },
+    dbc::Rand_prop_point{ 696, 4604.419921875, 4604.419921875, { 12278.453125, 9208.83984375, 6906.6293945312, 6139.2265625, 6139.2265625 } },
+    dbc::Rand_prop_point{ 697, 4647.5219726562, 4647.5219726562, { 12393.391601562, 9295.0439453125, 6971.2827148438, 6196.6958007812, 6196.6958007812 } },
+    dbc::Rand_prop_point{ 698, 4691.02734375, 4691.02734375, { 12509.40625, 9382.0546875, 7036.541015625, 6254.703125, 6254.703125 } },
+    dbc::Rand_prop_point{ 699, 4734.9399414062, 4734.9399414062, { 12626.506835938, 9469.8798828125, 7102.41015625, 6313.2534179688, 6313.2534179688 } },
+    dbc::Rand_prop_point{ 700, 4779.263671875, 4779.263671875, { 12744.703125, 9558.52734375, 7168.8955078125, 6372.3515625, 6372.3515625 } },
+    dbc::Rand_prop_point{ 701, 4824.0024414062, 4824.0024414062, { 12864.006835938, 9648.0048828125, 7236.00390625, 6432.0034179688, 6432.0034179688 } },
+    dbc::Rand_prop_point{ 702, 4869.16015625, 4869.16015625, { 12984.426757812, 9738.3203125, 7303.7397460938, 6492.2133789062, 6492.2133789062 } },
+    dbc::Rand_prop_point{ 703, 4914.740234375, 4914.740234375, { 13105.973632812, 9829.48046875, 7372.1103515625, 6552.9868164062, 6552.9868164062 } },
+    dbc::Rand_prop_point{ 704, 4960.7470703125, 4960.7470703125, { 13228.659179688, 9921.494140625, 7441.1206054688, 6614.3295898438, 6614.3295898438 } },
+    dbc::Rand_prop_point{ 705, 5007.1845703125, 5007.1845703125, { 13352.4921875, 10014.369140625, 7510.7768554688, 6676.24609375, 6676.24609375 } },
+    dbc::Rand_prop_point{ 706, 5054.0571289062, 5054.0571289062, { 13477.485351562, 10108.114257812, 7581.0854492188, 6738.7426757812, 6738.7426757812 } },
+    dbc::Rand_prop_point{ 707, 5101.3681640625, 5101.3681640625, { 13603.6484375, 10202.736328125, 7652.0522460938, 6801.82421875, 6801.82421875 } },
+    dbc::Rand_prop_point{ 708, 5149.1220703125, 5149.1220703125, { 13730.9921875, 10298.244140625, 7723.6831054688, 6865.49609375, 6865.49609375 } },
+    dbc::Rand_prop_point{ 709, 5197.3227539062, 5197.3227539062, { 13859.528320312, 10394.646484375, 7795.984375, 6929.7641601562, 6929.7641601562 } },
+    dbc::Rand_prop_point{ 710, 5245.9750976562, 5245.9750976562, { 13989.266601562, 10491.950195312, 7868.962890625, 6994.6333007812, 6994.6333007812 } },
+    dbc::Rand_prop_point{ 711, 5295.0825195312, 5295.0825195312, { 14120.220703125, 10590.165039062, 7942.6240234375, 7060.1103515625, 7060.1103515625 } },
+    dbc::Rand_prop_point{ 712, 5344.6499023438, 5344.6499023438, { 14252.400390625, 10689.299804688, 8016.9750976562, 7126.2001953125, 7126.2001953125 } },
+    dbc::Rand_prop_point{ 713, 5394.6811523438, 5394.6811523438, { 14385.81640625, 10789.362304688, 8092.0219726562, 7192.908203125, 7192.908203125 } },
+    dbc::Rand_prop_point{ 714, 5445.1811523438, 5445.1811523438, { 14520.482421875, 10890.362304688, 8167.771484375, 7260.2412109375, 7260.2412109375 } },
+    dbc::Rand_prop_point{ 715, 5496.1533203125, 5496.1533203125, { 14656.409179688, 10992.306640625, 8244.23046875, 7328.2045898438, 7328.2045898438 } },
+    dbc::Rand_prop_point{ 716, 5547.6030273438, 5547.6030273438, { 14793.607421875, 11095.206054688, 8321.404296875, 7396.8037109375, 7396.8037109375 } },
+    dbc::Rand_prop_point{ 717, 5599.5341796875, 5599.5341796875, { 14932.090820312, 11199.068359375, 8399.30078125, 7466.0454101562, 7466.0454101562 } },
+    dbc::Rand_prop_point{ 718, 5651.951171875, 5651.951171875, { 15071.870117188, 11303.90234375, 8477.9267578125, 7535.9350585938, 7535.9350585938 } },
+    dbc::Rand_prop_point{ 719, 5704.859375, 5704.859375, { 15212.958007812, 11409.71875, 8557.2890625, 7606.4790039062, 7606.4790039062 } },
+    dbc::Rand_prop_point{ 720, 5758.2622070312, 5758.2622070312, { 15355.366210938, 11516.524414062, 8637.3935546875, 7677.6831054688, 7677.6831054688 } },
+    dbc::Rand_prop_point{ 721, 5812.1655273438, 5812.1655273438, { 15499.108398438, 11624.331054688, 8718.248046875, 7749.5541992188, 7749.5541992188 } },
+    dbc::Rand_prop_point{ 722, 5866.5732421875, 5866.5732421875, { 15644.1953125, 11733.146484375, 8799.8603515625, 7822.09765625, 7822.09765625 } },
+    dbc::Rand_prop_point{ 723, 5921.490234375, 5921.490234375, { 15790.640625, 11842.98046875, 8882.2353515625, 7895.3203125, 7895.3203125 } },
+    dbc::Rand_prop_point{ 724, 5976.9213867188, 5976.9213867188, { 15938.45703125, 11953.842773438, 8965.3818359375, 7969.228515625, 7969.228515625 } },
+    dbc::Rand_prop_point{ 725, 6032.8715820312, 6032.8715820312, { 16087.657226562, 12065.743164062, 9049.306640625, 8043.8286132812, 8043.8286132812 } },
+    dbc::Rand_prop_point{ 726, 6089.3452148438, 6089.3452148438, { 16238.25390625, 12178.690429688, 9134.017578125, 8119.126953125, 8119.126953125 } },
+    dbc::Rand_prop_point{ 727, 6146.34765625, 6146.34765625, { 16390.259765625, 12292.6953125, 9219.521484375, 8195.1298828125, 8195.1298828125 } },
+    dbc::Rand_prop_point{ 728, 6203.8833007812, 6203.8833007812, { 16543.689453125, 12407.766601562, 9305.8251953125, 8271.8447265625, 8271.8447265625 } },
+    dbc::Rand_prop_point{ 729, 6261.9580078125, 6261.9580078125, { 16698.5546875, 12523.916015625, 9392.9375, 8349.27734375, 8349.27734375 } },
+    dbc::Rand_prop_point{ 730, 6320.576171875, 6320.576171875, { 16854.87109375, 12641.15234375, 9480.8642578125, 8427.435546875, 8427.435546875 } },
+    dbc::Rand_prop_point{ 731, 6379.7431640625, 6379.7431640625, { 17012.6484375, 12759.486328125, 9569.615234375, 8506.32421875, 8506.32421875 } },
+    dbc::Rand_prop_point{ 732, 6439.4638671875, 6439.4638671875, { 17171.904296875, 12878.927734375, 9659.1962890625, 8585.9521484375, 8585.9521484375 } },
+    dbc::Rand_prop_point{ 733, 6499.744140625, 6499.744140625, { 17332.650390625, 12999.48828125, 9749.6162109375, 8666.3251953125, 8666.3251953125 } },
+    dbc::Rand_prop_point{ 734, 6560.587890625, 6560.587890625, { 17494.90234375, 13121.17578125, 9840.8818359375, 8747.451171875, 8747.451171875 } },
+    dbc::Rand_prop_point{ 735, 6622.001953125, 6622.001953125, { 17658.671875, 13244.00390625, 9933.0029296875, 8829.3359375, 8829.3359375 } },
+    dbc::Rand_prop_point{ 736, 6683.990234375, 6683.990234375, { 17823.974609375, 13367.98046875, 10025.985351562, 8911.9873046875, 8911.9873046875 } },
+    dbc::Rand_prop_point{ 737, 6746.5590820312, 6746.5590820312, { 17990.82421875, 13493.118164062, 10119.838867188, 8995.412109375, 8995.412109375 } },
+    dbc::Rand_prop_point{ 738, 6809.7138671875, 6809.7138671875, { 18159.236328125, 13619.427734375, 10214.5703125, 9079.6181640625, 9079.6181640625 } },
+    dbc::Rand_prop_point{ 739, 6873.4594726562, 6873.4594726562, { 18329.2265625, 13746.918945312, 10310.189453125, 9164.61328125, 9164.61328125 } },
+    dbc::Rand_prop_point{ 740, 6937.8022460938, 6937.8022460938, { 18500.8046875, 13875.603515625, 10406.703125, 9250.40234375, 9250.40234375 } },
+    dbc::Rand_prop_point{ 741, 7002.7470703125, 7002.7470703125, { 18673.9921875, 14005.494140625, 10504.120117188, 9336.99609375, 9336.99609375 } },
+    dbc::Rand_prop_point{ 742, 7068.2998046875, 7068.2998046875, { 18848.798828125, 14136.599609375, 10602.44921875, 9424.3994140625, 9424.3994140625 } },
+    dbc::Rand_prop_point{ 743, 7134.4658203125, 7134.4658203125, { 19025.2421875, 14268.931640625, 10701.69921875, 9512.62109375, 9512.62109375 } },
+    dbc::Rand_prop_point{ 744, 7201.251953125, 7201.251953125, { 19203.337890625, 14402.50390625, 10801.877929688, 9601.6689453125, 9601.6689453125 } },
+    dbc::Rand_prop_point{ 745, 7268.6625976562, 7268.6625976562, { 19383.1015625, 14537.325195312, 10902.994140625, 9691.55078125, 9691.55078125 } },
+    dbc::Rand_prop_point{ 746, 7336.7045898438, 7336.7045898438, { 19564.546875, 14673.409179688, 11005.057617188, 9782.2734375, 9782.2734375 } },
+    dbc::Rand_prop_point{ 747, 7405.3837890625, 7405.3837890625, { 19747.689453125, 14810.767578125, 11108.075195312, 9873.8447265625, 9873.8447265625 } },
+    dbc::Rand_prop_point{ 748, 7474.7055664062, 7474.7055664062, { 19932.548828125, 14949.411132812, 11212.05859375, 9966.2744140625, 9966.2744140625 } },
+    dbc::Rand_prop_point{ 749, 7544.6762695312, 7544.6762695312, { 20119.13671875, 15089.352539062, 11317.014648438, 10059.568359375, 10059.568359375 } },
+    dbc::Rand_prop_point{ 750, 7615.3022460938, 7615.3022460938, { 20307.47265625, 15230.603515625, 11422.953125, 10153.736328125, 10153.736328125 } },
+    dbc::Rand_prop_point{ 751, 7686.5888671875, 7686.5888671875, { 20497.5703125, 15373.177734375, 11529.883789062, 10248.78515625, 10248.78515625 } },
+    dbc::Rand_prop_point{ 752, 7758.54296875, 7758.54296875, { 20689.44921875, 15517.0859375, 11637.814453125, 10344.724609375, 10344.724609375 } },
+    dbc::Rand_prop_point{ 753, 7831.1708984375, 7831.1708984375, { 20883.123046875, 15662.341796875, 11746.756835938, 10441.561523438, 10441.561523438 } },
+    dbc::Rand_prop_point{ 754, 7904.478515625, 7904.478515625, { 21078.609375, 15808.95703125, 11856.717773438, 10539.3046875, 10539.3046875 } },
+    dbc::Rand_prop_point{ 755, 7978.4721679688, 7978.4721679688, { 21275.92578125, 15956.944335938, 11967.708984375, 10637.962890625, 10637.962890625 } },
+    dbc::Rand_prop_point{ 756, 8053.1586914062, 8053.1586914062, { 21475.08984375, 16106.317382812, 12079.73828125, 10737.544921875, 10737.544921875 } },
+    dbc::Rand_prop_point{ 757, 8128.5444335938, 8128.5444335938, { 21676.119140625, 16257.088867188, 12192.817382812, 10838.059570312, 10838.059570312 } },
+    dbc::Rand_prop_point{ 758, 8204.6357421875, 8204.6357421875, { 21879.029296875, 16409.271484375, 12306.954101562, 10939.514648438, 10939.514648438 } },
+    dbc::Rand_prop_point{ 759, 8281.439453125, 8281.439453125, { 22083.83984375, 16562.87890625, 12422.159179688, 11041.919921875, 11041.919921875 } },
+    dbc::Rand_prop_point{ 760, 8358.9619140625, 8358.9619140625, { 22290.56640625, 16717.923828125, 12538.443359375, 11145.283203125, 11145.283203125 } },
+    dbc::Rand_prop_point{ 761, 8437.2109375, 8437.2109375, { 22499.228515625, 16874.421875, 12655.815429688, 11249.614257812, 11249.614257812 } },
+    dbc::Rand_prop_point{ 762, 8516.19140625, 8516.19140625, { 22709.84375, 17032.3828125, 12774.287109375, 11354.921875, 11354.921875 } },
+    dbc::Rand_prop_point{ 763, 8595.9111328125, 8595.9111328125, { 22922.4296875, 17191.822265625, 12893.8671875, 11461.21484375, 11461.21484375 } },
+    dbc::Rand_prop_point{ 764, 8676.3779296875, 8676.3779296875, { 23137.0078125, 17352.755859375, 13014.56640625, 11568.50390625, 11568.50390625 } },
+    dbc::Rand_prop_point{ 765, 8757.59765625, 8757.59765625, { 23353.59375, 17515.1953125, 13136.396484375, 11676.796875, 11676.796875 } },
+    dbc::Rand_prop_point{ 766, 8839.5771484375, 8839.5771484375, { 23572.20703125, 17679.154296875, 13259.366210938, 11786.103515625, 11786.103515625 } },
+    dbc::Rand_prop_point{ 767, 8922.32421875, 8922.32421875, { 23792.865234375, 17844.6484375, 13383.487304688, 11896.432617188, 11896.432617188 } },
+    dbc::Rand_prop_point{ 768, 9005.8466796875, 9005.8466796875, { 24015.58984375, 18011.693359375, 13508.76953125, 12007.794921875, 12007.794921875 } },
+    dbc::Rand_prop_point{ 769, 9090.150390625, 9090.150390625, { 24240.400390625, 18180.30078125, 13635.225585938, 12120.200195312, 12120.200195312 } },
+    dbc::Rand_prop_point{ 770, 9175.2431640625, 9175.2431640625, { 24467.314453125, 18350.486328125, 13762.865234375, 12233.657226562, 12233.657226562 } },
+    dbc::Rand_prop_point{ 771, 9261.1328125, 9261.1328125, { 24696.353515625, 18522.265625, 13891.69921875, 12348.176757812, 12348.176757812 } },
+    dbc::Rand_prop_point{ 772, 9347.826171875, 9347.826171875, { 24927.537109375, 18695.65234375, 14021.739257812, 12463.768554688, 12463.768554688 } },
+    dbc::Rand_prop_point{ 773, 9435.3310546875, 9435.3310546875, { 25160.8828125, 18870.662109375, 14152.997070312, 12580.44140625, 12580.44140625 } },
+    dbc::Rand_prop_point{ 774, 9523.6552734375, 9523.6552734375, { 25396.4140625, 19047.310546875, 14285.483398438, 12698.20703125, 12698.20703125 } },
+    dbc::Rand_prop_point{ 775, 9612.806640625, 9612.806640625, { 25634.150390625, 19225.61328125, 14419.209960938, 12817.075195312, 12817.075195312 } },
+    dbc::Rand_prop_point{ 776, 9702.7919921875, 9702.7919921875, { 25874.111328125, 19405.583984375, 14554.188476562, 12937.055664062, 12937.055664062 } },
+    dbc::Rand_prop_point{ 777, 9793.6201171875, 9793.6201171875, { 26116.3203125, 19587.240234375, 14690.4296875, 13058.16015625, 13058.16015625 } },
+    dbc::Rand_prop_point{ 778, 9885.2978515625, 9885.2978515625, { 26360.794921875, 19770.595703125, 14827.947265625, 13180.397460938, 13180.397460938 } },
+    dbc::Rand_prop_point{ 779, 9977.833984375, 9977.833984375, { 26607.55859375, 19955.66796875, 14966.751953125, 13303.779296875, 13303.779296875 } },
+    dbc::Rand_prop_point{ 780, 10071.237304688, 10071.237304688, { 26856.6328125, 20142.474609375, 15106.85546875, 13428.31640625, 13428.31640625 } },
+    dbc::Rand_prop_point{ 781, 10165.513671875, 10165.513671875, { 27108.037109375, 20331.02734375, 15248.271484375, 13554.018554688, 13554.018554688 } },
+    dbc::Rand_prop_point{ 782, 10260.672851562, 10260.672851562, { 27361.794921875, 20521.345703125, 15391.009765625, 13680.897460938, 13680.897460938 } },
+    dbc::Rand_prop_point{ 783, 10356.723632812, 10356.723632812, { 27617.9296875, 20713.447265625, 15535.084960938, 13808.96484375, 13808.96484375 } },
+    dbc::Rand_prop_point{ 784, 10453.672851562, 10453.672851562, { 27876.4609375, 20907.345703125, 15680.509765625, 13938.23046875, 13938.23046875 } },
+    dbc::Rand_prop_point{ 785, 10551.529296875, 10551.529296875, { 28137.412109375, 21103.05859375, 15827.294921875, 14068.706054688, 14068.706054688 } },
+    dbc::Rand_prop_point{ 786, 10650.302734375, 10650.302734375, { 28400.806640625, 21300.60546875, 15975.454101562, 14200.403320312, 14200.403320312 } },
+    dbc::Rand_prop_point{ 787, 10750, 10750, { 28666.66796875, 21500, 16125, 14333.333984375, 14333.333984375 } },
+    dbc::Rand_prop_point{ 788, 10850.630859375, 10850.630859375, { 28935.015625, 21701.26171875, 16275.946289062, 14467.5078125, 14467.5078125 } },
+    dbc::Rand_prop_point{ 789, 10952.204101562, 10952.204101562, { 29205.876953125, 21904.408203125, 16428.306640625, 14602.938476562, 14602.938476562 } },
+    dbc::Rand_prop_point{ 790, 11054.727539062, 11054.727539062, { 29479.2734375, 22109.455078125, 16582.091796875, 14739.63671875, 14739.63671875 } },
+    dbc::Rand_prop_point{ 791, 11158.2109375, 11158.2109375, { 29755.228515625, 22316.421875, 16737.31640625, 14877.614257812, 14877.614257812 } },
+    dbc::Rand_prop_point{ 792, 11262.663085938, 11262.663085938, { 30033.767578125, 22525.326171875, 16893.994140625, 15016.883789062, 15016.883789062 } },
+    dbc::Rand_prop_point{ 793, 11368.092773438, 11368.092773438, { 30314.9140625, 22736.185546875, 17052.138671875, 15157.45703125, 15157.45703125 } },
+    dbc::Rand_prop_point{ 794, 11474.509765625, 11474.509765625, { 30598.69140625, 22949.01953125, 17211.763671875, 15299.345703125, 15299.345703125 } },
+    dbc::Rand_prop_point{ 795, 11581.922851562, 11581.922851562, { 30885.126953125, 23163.845703125, 17372.8828125, 15442.563476562, 15442.563476562 } },
+    dbc::Rand_prop_point{ 796, 11690.340820312, 11690.340820312, { 31174.2421875, 23380.681640625, 17535.51171875, 15587.12109375, 15587.12109375 } },
+    dbc::Rand_prop_point{ 797, 11799.774414062, 11799.774414062, { 31466.064453125, 23599.548828125, 17699.662109375, 15733.032226562, 15733.032226562 } },
+    dbc::Rand_prop_point{ 798, 11910.232421875, 11910.232421875, { 31760.619140625, 23820.46484375, 17865.34765625, 15880.309570312, 15880.309570312 } },
+    dbc::Rand_prop_point{ 799, 12021.723632812, 12021.723632812, { 32057.9296875, 24043.447265625, 18032.5859375, 16028.96484375, 16028.96484375 } },
+    dbc::Rand_prop_point{ 800, 12134.258789062, 12134.258789062, { 32358.025390625, 24268.517578125, 18201.388671875, 16179.012695312, 16179.012695312 } },
+    dbc::Rand_prop_point{ 801, 12247.84765625, 12247.84765625, { 32660.927734375, 24495.6953125, 18371.771484375, 16330.463867188, 16330.463867188 } },
+    dbc::Rand_prop_point{ 802, 12362.5, 12362.5, { 32966.66796875, 24725, 18543.75, 16483.333984375, 16483.333984375 } },
+    dbc::Rand_prop_point{ 803, 12478.225585938, 12478.225585938, { 33275.26953125, 24956.451171875, 18717.337890625, 16637.634765625, 16637.634765625 } },
+    dbc::Rand_prop_point{ 804, 12595.034179688, 12595.034179688, { 33586.7578125, 25190.068359375, 18892.55078125, 16793.37890625, 16793.37890625 } },
+    dbc::Rand_prop_point{ 805, 12712.936523438, 12712.936523438, { 33901.1640625, 25425.873046875, 19069.404296875, 16950.58203125, 16950.58203125 } },
+    dbc::Rand_prop_point{ 806, 12831.942382812, 12831.942382812, { 34218.51171875, 25663.884765625, 19247.9140625, 17109.255859375, 17109.255859375 } },
+    dbc::Rand_prop_point{ 807, 12952.063476562, 12952.063476562, { 34538.83203125, 25904.125, 19428.09375, 17269.416015625, 17269.416015625 } },
+    dbc::Rand_prop_point{ 808, 13073.306640625, 13073.306640625, { 34862.15234375, 26146.61328125, 19609.9609375, 17431.076171875, 17431.076171875 } },
+    dbc::Rand_prop_point{ 809, 13195.685546875, 13195.685546875, { 35188.49609375, 26391.37109375, 19793.529296875, 17594.248046875, 17594.248046875 } },
+    dbc::Rand_prop_point{ 810, 13319.2109375, 13319.2109375, { 35517.89453125, 26638.421875, 19978.81640625, 17758.947265625, 17758.947265625 } },
+    dbc::Rand_prop_point{ 811, 13443.892578125, 13443.892578125, { 35850.37890625, 26887.78515625, 20165.837890625, 17925.189453125, 17925.189453125 } },
+    dbc::Rand_prop_point{ 812, 13569.740234375, 13569.740234375, { 36185.97265625, 27139.48046875, 20354.611328125, 18092.986328125, 18092.986328125 } },
+    dbc::Rand_prop_point{ 813, 13696.766601562, 13696.766601562, { 36524.7109375, 27393.533203125, 20545.150390625, 18262.35546875, 18262.35546875 } },
+    dbc::Rand_prop_point{ 814, 13824.982421875, 13824.982421875, { 36866.62109375, 27649.96484375, 20737.47265625, 18433.310546875, 18433.310546875 } },
+    dbc::Rand_prop_point{ 815, 13954.3984375, 13954.3984375, { 37211.7265625, 27908.796875, 20931.59765625, 18605.86328125, 18605.86328125 } },
+    dbc::Rand_prop_point{ 816, 14085.025390625, 14085.025390625, { 37560.06640625, 28170.05078125, 21127.537109375, 18780.033203125, 18780.033203125 } },
+    dbc::Rand_prop_point{ 817, 14216.875, 14216.875, { 37911.66796875, 28433.75, 21325.3125, 18955.833984375, 18955.833984375 } },
+    dbc::Rand_prop_point{ 818, 14349.959960938, 14349.959960938, { 38266.55859375, 28699.919921875, 21524.939453125, 19133.279296875, 19133.279296875 } },
+    dbc::Rand_prop_point{ 819, 14484.290039062, 14484.290039062, { 38624.7734375, 28968.580078125, 21726.43359375, 19312.38671875, 19312.38671875 } },
+    dbc::Rand_prop_point{ 820, 14619.876953125, 14619.876953125, { 38986.33984375, 29239.75390625, 21929.81640625, 19493.169921875, 19493.169921875 } },
+    dbc::Rand_prop_point{ 821, 14756.733398438, 14756.733398438, { 39351.2890625, 29513.466796875, 22135.1015625, 19675.64453125, 19675.64453125 } },
+    dbc::Rand_prop_point{ 822, 14894.872070312, 14894.872070312, { 39719.65625, 29789.744140625, 22342.306640625, 19859.828125, 19859.828125 } },
+    dbc::Rand_prop_point{ 823, 15034.302734375, 15034.302734375, { 40091.47265625, 30068.60546875, 22551.453125, 20045.736328125, 20045.736328125 } },
+    dbc::Rand_prop_point{ 824, 15175.0390625, 15175.0390625, { 40466.76953125, 30350.078125, 22762.55859375, 20233.384765625, 20233.384765625 } },
+    dbc::Rand_prop_point{ 825, 15317.092773438, 15317.092773438, { 40845.578125, 30634.185546875, 22975.638671875, 20422.7890625, 20422.7890625 } },
+    dbc::Rand_prop_point{ 826, 15460.475585938, 15460.475585938, { 41227.9375, 30920.951171875, 23190.71484375, 20613.96875, 20613.96875 } },
+    dbc::Rand_prop_point{ 827, 15605.201171875, 15605.201171875, { 41613.87109375, 31210.40234375, 23407.802734375, 20806.935546875, 20806.935546875 } },
+    dbc::Rand_prop_point{ 828, 15751.282226562, 15751.282226562, { 42003.41796875, 31502.564453125, 23626.921875, 21001.708984375, 21001.708984375 } },
+    dbc::Rand_prop_point{ 829, 15898.728515625, 15898.728515625, { 42396.61328125, 31797.458984375, 23848.09375, 21198.306640625, 21198.306640625 } },
+    dbc::Rand_prop_point{ 830, 16047.557617188, 16047.557617188, { 42793.48828125, 32095.115234375, 24071.3359375, 21396.744140625, 21396.744140625 } },
+    dbc::Rand_prop_point{ 831, 16197.779296875, 16197.779296875, { 43194.078125, 32395.55859375, 24296.66796875, 21597.0390625, 21597.0390625 } },
+    dbc::Rand_prop_point{ 832, 16349.40625, 16349.40625, { 43598.41796875, 32698.8125, 24524.109375, 21799.208984375, 21799.208984375 } },
+    dbc::Rand_prop_point{ 833, 16502.453125, 16502.453125, { 44006.54296875, 33004.90625, 24753.6796875, 22003.271484375, 22003.271484375 } },
+    dbc::Rand_prop_point{ 834, 16656.93359375, 16656.93359375, { 44418.48828125, 33313.8671875, 24985.400390625, 22209.244140625, 22209.244140625 } },
+    dbc::Rand_prop_point{ 835, 16812.859375, 16812.859375, { 44834.2890625, 33625.71875, 25219.287109375, 22417.14453125, 22417.14453125 } },
+    dbc::Rand_prop_point{ 836, 16970.244140625, 16970.244140625, { 45253.984375, 33940.48828125, 25455.365234375, 22626.9921875, 22626.9921875 } },
+    dbc::Rand_prop_point{ 837, 17129.1015625, 17129.1015625, { 45677.60546875, 34258.203125, 25693.654296875, 22838.802734375, 22838.802734375 } },
+    dbc::Rand_prop_point{ 838, 17289.447265625, 17289.447265625, { 46105.1953125, 34578.89453125, 25934.171875, 23052.59765625, 23052.59765625 } },
+    dbc::Rand_prop_point{ 839, 17451.294921875, 17451.294921875, { 46536.78515625, 34902.58984375, 26176.94140625, 23268.392578125, 23268.392578125 } },
+    dbc::Rand_prop_point{ 840, 17614.65625, 17614.65625, { 46972.41796875, 35229.3125, 26421.984375, 23486.208984375, 23486.208984375 } },
+    dbc::Rand_prop_point{ 841, 17779.546875, 17779.546875, { 47412.125, 35559.09375, 26669.3203125, 23706.0625, 23706.0625 } },
+    dbc::Rand_prop_point{ 842, 17945.982421875, 17945.982421875, { 47855.953125, 35891.96484375, 26918.97265625, 23927.9765625, 23927.9765625 } },
+    dbc::Rand_prop_point{ 843, 18113.974609375, 18113.974609375, { 48303.9296875, 36227.94921875, 27170.9609375, 24151.96484375, 24151.96484375 } },
+    dbc::Rand_prop_point{ 844, 18283.5390625, 18283.5390625, { 48756.10546875, 36567.078125, 27425.30859375, 24378.052734375, 24378.052734375 } },
+    dbc::Rand_prop_point{ 845, 18454.69140625, 18454.69140625, { 49212.51171875, 36909.3828125, 27682.037109375, 24606.255859375, 24606.255859375 } },
+    dbc::Rand_prop_point{ 846, 18627.4453125, 18627.4453125, { 49673.1875, 37254.890625, 27941.169921875, 24836.59375, 24836.59375 } },
+    dbc::Rand_prop_point{ 847, 18801.818359375, 18801.818359375, { 50138.1796875, 37603.63671875, 28202.7265625, 25069.08984375, 25069.08984375 } },
+    dbc::Rand_prop_point{ 848, 18977.822265625, 18977.822265625, { 50607.5234375, 37955.64453125, 28466.732421875, 25303.76171875, 25303.76171875 } },
+    dbc::Rand_prop_point{ 849, 19155.47265625, 19155.47265625, { 51081.26171875, 38310.9453125, 28733.208984375, 25540.630859375, 25540.630859375 } },
+    dbc::Rand_prop_point{ 850, 19334.787109375, 19334.787109375, { 51559.43359375, 38669.57421875, 29002.181640625, 25779.716796875, 25779.716796875 } },
+    dbc::Rand_prop_point{ 851, 19515.78125, 19515.78125, { 52042.08203125, 39031.5625, 29273.669921875, 26021.041015625, 26021.041015625 } },
+    dbc::Rand_prop_point{ 852, 19698.46875, 19698.46875, { 52529.24609375, 39396.9375, 29547.701171875, 26264.623046875, 26264.623046875 } },
+    dbc::Rand_prop_point{ 853, 19882.865234375, 19882.865234375, { 53020.97265625, 39765.73046875, 29824.298828125, 26510.486328125, 26510.486328125 } },
+    dbc::Rand_prop_point{ 854, 20068.98828125, 20068.98828125, { 53517.3046875, 40137.9765625, 30103.484375, 26758.65234375, 26758.65234375 } },
+    dbc::Rand_prop_point{ 855, 20256.85546875, 20256.85546875, { 54018.28125, 40513.7109375, 30385.283203125, 27009.140625, 27009.140625 } },
+    dbc::Rand_prop_point{ 856, 20446.478515625, 20446.478515625, { 54523.9453125, 40892.95703125, 30669.71875, 27261.97265625, 27261.97265625 } },
+    dbc::Rand_prop_point{ 857, 20637.87890625, 20637.87890625, { 55034.34375, 41275.7578125, 30956.818359375, 27517.171875, 27517.171875 } },
+    dbc::Rand_prop_point{ 858, 20831.0703125, 20831.0703125, { 55549.51953125, 41662.140625, 31246.60546875, 27774.759765625, 27774.759765625 } },
+    dbc::Rand_prop_point{ 859, 21026.0703125, 21026.0703125, { 56069.51953125, 42052.140625, 31539.10546875, 28034.759765625, 28034.759765625 } },
+    dbc::Rand_prop_point{ 860, 21222.89453125, 21222.89453125, { 56594.38671875, 42445.7890625, 31834.34375, 28297.193359375, 28297.193359375 } },
+    dbc::Rand_prop_point{ 861, 21421.5625, 21421.5625, { 57124.16796875, 42843.125, 32132.34375, 28562.083984375, 28562.083984375 } },
+    dbc::Rand_prop_point{ 862, 21622.08984375, 21622.08984375, { 57658.90625, 43244.1796875, 32433.134765625, 28829.453125, 28829.453125 } },
+    dbc::Rand_prop_point{ 863, 21824.494140625, 21824.494140625, { 58198.65234375, 43648.98828125, 32736.7421875, 29099.326171875, 29099.326171875 } },
+    dbc::Rand_prop_point{ 864, 22028.794921875, 22028.794921875, { 58743.44921875, 44057.58984375, 33043.19140625, 29371.724609375, 29371.724609375 } },
+    dbc::Rand_prop_point{ 865, 22235.005859375, 22235.005859375, { 59293.34765625, 44470.01171875, 33352.5078125, 29646.673828125, 29646.673828125 } },
+    dbc::Rand_prop_point{ 866, 22443.1484375, 22443.1484375, { 59848.39453125, 44886.296875, 33664.72265625, 29924.197265625, 29924.197265625 } },
+    dbc::Rand_prop_point{ 867, 22653.23828125, 22653.23828125, { 60408.63671875, 45306.4765625, 33979.85546875, 30204.318359375, 30204.318359375 } },
+    dbc::Rand_prop_point{ 868, 22865.294921875, 22865.294921875, { 60974.12109375, 45730.58984375, 34297.94140625, 30487.060546875, 30487.060546875 } },
+    dbc::Rand_prop_point{ 869, 23079.337890625, 23079.337890625, { 61544.8984375, 46158.67578125, 34619.0078125, 30772.44921875, 30772.44921875 } },
+    dbc::Rand_prop_point{ 870, 23295.3828125, 23295.3828125, { 62121.0234375, 46590.765625, 34943.07421875, 31060.51171875, 31060.51171875 } },
+    dbc::Rand_prop_point{ 871, 23513.451171875, 23513.451171875, { 62702.53515625, 47026.90234375, 35270.17578125, 31351.267578125, 31351.267578125 } },
+    dbc::Rand_prop_point{ 872, 23733.560546875, 23733.560546875, { 63289.49609375, 47467.12109375, 35600.33984375, 31644.748046875, 31644.748046875 } },
+    dbc::Rand_prop_point{ 873, 23955.73046875, 23955.73046875, { 63881.94921875, 47911.4609375, 35933.59765625, 31940.974609375, 31940.974609375 } },
+    dbc::Rand_prop_point{ 874, 24179.98046875, 24179.98046875, { 64479.94921875, 48359.9609375, 36269.97265625, 32239.974609375, 32239.974609375 } },
+    dbc::Rand_prop_point{ 875, 24406.330078125, 24406.330078125, { 65083.546875, 48812.66015625, 36609.49609375, 32541.7734375, 32541.7734375 } },
+    dbc::Rand_prop_point{ 876, 24634.796875, 24634.796875, { 65692.7890625, 49269.59375, 36952.1953125, 32846.39453125, 32846.39453125 } },
+    dbc::Rand_prop_point{ 877, 24865.404296875, 24865.404296875, { 66307.7421875, 49730.80859375, 37298.10546875, 33153.87109375, 33153.87109375 } },
+    dbc::Rand_prop_point{ 878, 25098.16796875, 25098.16796875, { 66928.453125, 50196.3359375, 37647.25390625, 33464.2265625, 33464.2265625 } },
+    dbc::Rand_prop_point{ 879, 25333.11328125, 25333.11328125, { 67554.96875, 50666.2265625, 37999.66796875, 33777.484375, 33777.484375 } },
+    dbc::Rand_prop_point{ 880, 25570.255859375, 25570.255859375, { 68187.3515625, 51140.51171875, 38355.3828125, 34093.67578125, 34093.67578125 } },
+    dbc::Rand_prop_point{ 881, 25809.619140625, 25809.619140625, { 68825.65625, 51619.23828125, 38714.4296875, 34412.828125, 34412.828125 } },
+    dbc::Rand_prop_point{ 882, 26051.224609375, 26051.224609375, { 69469.9296875, 52102.44921875, 39076.8359375, 34734.96484375, 34734.96484375 } },
+    dbc::Rand_prop_point{ 883, 26295.08984375, 26295.08984375, { 70120.2421875, 52590.1796875, 39442.6328125, 35060.12109375, 35060.12109375 } },
+    dbc::Rand_prop_point{ 884, 26541.23828125, 26541.23828125, { 70776.6328125, 53082.4765625, 39811.85546875, 35388.31640625, 35388.31640625 } },
+    dbc::Rand_prop_point{ 885, 26789.69140625, 26789.69140625, { 71439.171875, 53579.3828125, 40184.53515625, 35719.5859375, 35719.5859375 } },
+    dbc::Rand_prop_point{ 886, 27040.46875, 27040.46875, { 72107.9140625, 54080.9375, 40560.703125, 36053.95703125, 36053.95703125 } },
+    dbc::Rand_prop_point{ 887, 27293.595703125, 27293.595703125, { 72782.921875, 54587.19140625, 40940.390625, 36391.4609375, 36391.4609375 } },
+    dbc::Rand_prop_point{ 888, 27549.08984375, 27549.08984375, { 73464.2421875, 55098.1796875, 41323.63671875, 36732.12109375, 36732.12109375 } },
+    dbc::Rand_prop_point{ 889, 27806.978515625, 27806.978515625, { 74151.9375, 55613.95703125, 41710.46484375, 37075.96875, 37075.96875 } },
+    dbc::Rand_prop_point{ 890, 28067.279296875, 28067.279296875, { 74846.078125, 56134.55859375, 42100.91796875, 37423.0390625, 37423.0390625 } },
+    dbc::Rand_prop_point{ 891, 28330.017578125, 28330.017578125, { 75546.7109375, 56660.03515625, 42495.0234375, 37773.35546875, 37773.35546875 } },
+    dbc::Rand_prop_point{ 892, 28595.21484375, 28595.21484375, { 76253.90625, 57190.4296875, 42892.8203125, 38126.953125, 38126.953125 } },
+    dbc::Rand_prop_point{ 893, 28862.89453125, 28862.89453125, { 76967.71875, 57725.7890625, 43294.33984375, 38483.859375, 38483.859375 } },
+    dbc::Rand_prop_point{ 894, 29133.080078125, 29133.080078125, { 77688.2109375, 58266.16015625, 43699.62109375, 38844.10546875, 38844.10546875 } },
+    dbc::Rand_prop_point{ 895, 29405.794921875, 29405.794921875, { 78415.453125, 58811.58984375, 44108.69140625, 39207.7265625, 39207.7265625 } },
+    dbc::Rand_prop_point{ 896, 29681.0625, 29681.0625, { 79149.5, 59362.125, 44521.59375, 39574.75, 39574.75 } },
+    dbc::Rand_prop_point{ 897, 29958.908203125, 29958.908203125, { 79890.421875, 59917.81640625, 44938.359375, 39945.2109375, 39945.2109375 } },
+    dbc::Rand_prop_point{ 898, 30239.353515625, 30239.353515625, { 80638.2734375, 60478.70703125, 45359.02734375, 40319.13671875, 40319.13671875 } },
+    dbc::Rand_prop_point{ 899, 30522.423828125, 30522.423828125, { 81393.1328125, 61044.84765625, 45783.63671875, 40696.56640625, 40696.56640625 } },
+    dbc::Rand_prop_point{ 900, 30808.14453125, 30808.14453125, { 82155.0546875, 61616.2890625, 46212.21484375, 41077.52734375, 41077.52734375 } },
+    dbc::Rand_prop_point{ 901, 31096.5390625, 31096.5390625, { 82924.1015625, 62193.078125, 46644.80859375, 41462.05078125, 41462.05078125 } },
+    dbc::Rand_prop_point{ 902, 31387.634765625, 31387.634765625, { 83700.359375, 62775.26953125, 47081.453125, 41850.1796875, 41850.1796875 } },
+    dbc::Rand_prop_point{ 903, 31681.453125, 31681.453125, { 84483.875, 63362.90625, 47522.1796875, 42241.9375, 42241.9375 } },
+    dbc::Rand_prop_point{ 904, 31978.0234375, 31978.0234375, { 85274.734375, 63956.046875, 47967.03515625, 42637.3671875, 42637.3671875 } },
+    dbc::Rand_prop_point{ 905, 32277.37109375, 32277.37109375, { 86072.9921875, 64554.7421875, 48416.0546875, 43036.49609375, 43036.49609375 } },
+    dbc::Rand_prop_point{ 906, 32579.51953125, 32579.51953125, { 86878.71875, 65159.0390625, 48869.27734375, 43439.359375, 43439.359375 } },
+    dbc::Rand_prop_point{ 907, 32884.49609375, 32884.49609375, { 87691.9921875, 65768.9921875, 49326.74609375, 43845.99609375, 43845.99609375 } },
+    dbc::Rand_prop_point{ 908, 33192.328125, 33192.328125, { 88512.875, 66384.65625, 49788.4921875, 44256.4375, 44256.4375 } },
+    dbc::Rand_prop_point{ 909, 33503.04296875, 33503.04296875, { 89341.4453125, 67006.0859375, 50254.5625, 44670.72265625, 44670.72265625 } },
+    dbc::Rand_prop_point{ 910, 33816.6640625, 33816.6640625, { 90177.7734375, 67633.328125, 50724.99609375, 45088.88671875, 45088.88671875 } },
+    dbc::Rand_prop_point{ 911, 34133.22265625, 34133.22265625, { 91021.921875, 68266.4453125, 51199.83203125, 45510.9609375, 45510.9609375 } },
+    dbc::Rand_prop_point{ 912, 34452.7421875, 34452.7421875, { 91873.984375, 68905.484375, 51679.11328125, 45936.9921875, 45936.9921875 } },
+    dbc::Rand_prop_point{ 913, 34775.25390625, 34775.25390625, { 92734.015625, 69550.5078125, 52162.8828125, 46367.0078125, 46367.0078125 } },
+    dbc::Rand_prop_point{ 914, 35100.78515625, 35100.78515625, { 93602.1015625, 70201.5703125, 52651.1796875, 46801.05078125, 46801.05078125 } },
+    dbc::Rand_prop_point{ 915, 35429.3671875, 35429.3671875, { 94478.3125, 70858.734375, 53144.046875, 47239.15625, 47239.15625 } },
+    dbc::Rand_prop_point{ 916, 35761.01953125, 35761.01953125, { 95362.71875, 71522.0390625, 53641.53125, 47681.359375, 47681.359375 } },
+    dbc::Rand_prop_point{ 917, 36095.78125, 36095.78125, { 96255.4140625, 72191.5625, 54143.66796875, 48127.70703125, 48127.70703125 } },
+    dbc::Rand_prop_point{ 918, 36433.671875, 36433.671875, { 97156.4609375, 72867.34375, 54650.5078125, 48578.23046875, 48578.23046875 } },
+    dbc::Rand_prop_point{ 919, 36774.7265625, 36774.7265625, { 98065.9375, 73549.453125, 55162.09375, 49032.96875, 49032.96875 } },
+    dbc::Rand_prop_point{ 920, 37118.9765625, 37118.9765625, { 98983.9375, 74237.953125, 55678.46484375, 49491.96875, 49491.96875 } },
+    dbc::Rand_prop_point{ 921, 37466.44921875, 37466.44921875, { 99910.5234375, 74932.8984375, 56199.671875, 49955.26171875, 49955.26171875 } },
+    dbc::Rand_prop_point{ 922, 37817.171875, 37817.171875, { 100845.7890625, 75634.34375, 56725.7578125, 50422.89453125, 50422.89453125 } },
+    dbc::Rand_prop_point{ 923, 38171.17578125, 38171.17578125, { 101789.796875, 76342.3515625, 57256.765625, 50894.90234375, 50894.90234375 } },
+    dbc::Rand_prop_point{ 924, 38528.5, 38528.5, { 102742.65625, 77057, 57792.74609375, 51371.33203125, 51371.33203125 } },
+    dbc::Rand_prop_point{ 925, 38889.1640625, 38889.1640625, { 103704.4375, 77778.328125, 58333.74609375, 51852.21875, 51852.21875 } },
+    dbc::Rand_prop_point{ 926, 39253.20703125, 39253.20703125, { 104675.2109375, 78506.4140625, 58879.80859375, 52337.60546875, 52337.60546875 } },
+    dbc::Rand_prop_point{ 927, 39620.65625, 39620.65625, { 105655.078125, 79241.3125, 59430.98046875, 52827.5390625, 52827.5390625 } },
+    dbc::Rand_prop_point{ 928, 39991.54296875, 39991.54296875, { 106644.1171875, 79983.0859375, 59987.31640625, 53322.05859375, 53322.05859375 } },
+    dbc::Rand_prop_point{ 929, 40365.90625, 40365.90625, { 107642.40625, 80731.8125, 60548.859375, 53821.20703125, 53821.20703125 } },
+    dbc::Rand_prop_point{ 930, 40743.76953125, 40743.76953125, { 108650.046875, 81487.5390625, 61115.65625, 54325.02734375, 54325.02734375 } },
+    dbc::Rand_prop_point{ 931, 41125.171875, 41125.171875, { 109667.1328125, 82250.34375, 61687.76171875, 54833.5625, 54833.5625 } },
+    dbc::Rand_prop_point{ 932, 41510.14453125, 41510.14453125, { 110693.7265625, 83020.2890625, 62265.21875, 55346.86328125, 55346.86328125 } },
+    dbc::Rand_prop_point{ 933, 41898.72265625, 41898.72265625, { 111729.9296875, 83797.4453125, 62848.0859375, 55864.96484375, 55864.96484375 } },
+    dbc::Rand_prop_point{ 934, 42290.9375, 42290.9375, { 112775.84375, 84581.875, 63436.40625, 56387.91796875, 56387.91796875 } },
+    dbc::Rand_prop_point{ 935, 42686.82421875, 42686.82421875, { 113831.53125, 85373.6484375, 64030.234375, 56915.765625, 56915.765625 } },
+    dbc::Rand_prop_point{ 936, 43086.4140625, 43086.4140625, { 114897.1015625, 86172.828125, 64629.62109375, 57448.55078125, 57448.55078125 } },
+    dbc::Rand_prop_point{ 937, 43489.74609375, 43489.74609375, { 115972.65625, 86979.4921875, 65234.62109375, 57986.328125, 57986.328125 } },
+    dbc::Rand_prop_point{ 938, 43896.85546875, 43896.85546875, { 117058.28125, 87793.7109375, 65845.28125, 58529.140625, 58529.140625 } },
+    dbc::Rand_prop_point{ 939, 44307.7734375, 44307.7734375, { 118154.0625, 88615.546875, 66461.65625, 59077.03125, 59077.03125 } },
+    dbc::Rand_prop_point{ 940, 44722.5390625, 44722.5390625, { 119260.1015625, 89445.078125, 67083.8046875, 59630.05078125, 59630.05078125 } },
+    dbc::Rand_prop_point{ 941, 45141.1875, 45141.1875, { 120376.5, 90282.375, 67711.78125, 60188.25, 60188.25 } },
+    dbc::Rand_prop_point{ 942, 45563.75390625, 45563.75390625, { 121503.34375, 91127.5078125, 68345.6328125, 60751.671875, 60751.671875 } },
+    dbc::Rand_prop_point{ 943, 45990.27734375, 45990.27734375, { 122640.7265625, 91980.5546875, 68985.4140625, 61320.3671875, 61320.3671875 } },
+    dbc::Rand_prop_point{ 944, 46420.7890625, 46420.7890625, { 123788.7734375, 92841.578125, 69631.1875, 61894.38671875, 61894.38671875 } },
+    dbc::Rand_prop_point{ 945, 46855.3359375, 46855.3359375, { 124947.5625, 93710.671875, 70283.0078125, 62473.78125, 62473.78125 } },
+    dbc::Rand_prop_point{ 946, 47293.94921875, 47293.94921875, { 126117.203125, 94587.8984375, 70940.921875, 63058.59765625, 63058.59765625 } },
+    dbc::Rand_prop_point{ 947, 47736.66796875, 47736.66796875, { 127297.78125, 95473.3359375, 71605, 63648.890625, 63648.890625 } },
+    dbc::Rand_prop_point{ 948, 48183.53125, 48183.53125, { 128489.40625, 96367.0625, 72275.296875, 64244.70703125, 64244.70703125 } },
+    dbc::Rand_prop_point{ 949, 48634.578125, 48634.578125, { 129692.2109375, 97269.15625, 72951.8671875, 64846.10546875, 64846.10546875 } },
+    dbc::Rand_prop_point{ 950, 49089.84765625, 49089.84765625, { 130906.2578125, 98179.6953125, 73634.765625, 65453.12890625, 65453.12890625 } },
+    dbc::Rand_prop_point{ 951, 49549.375, 49549.375, { 132131.671875, 99098.75, 74324.0625, 66065.8359375, 66065.8359375 } },
+    dbc::Rand_prop_point{ 952, 50013.20703125, 50013.20703125, { 133368.5625, 100026.40625, 75019.8125, 66684.28125, 66684.28125 } },
+    dbc::Rand_prop_point{ 953, 50481.3828125, 50481.3828125, { 134617.015625, 100962.7734375, 75722.0703125, 67308.5078125, 67308.5078125 } },
+    dbc::Rand_prop_point{ 954, 50953.9375, 50953.9375, { 135877.171875, 101907.8828125, 76430.90625, 67938.5859375, 67938.5859375 } },
+    dbc::Rand_prop_point{ 955, 51430.91796875, 51430.91796875, { 137149.125, 102861.84375, 77146.375, 68574.5625, 68574.5625 } },
+    dbc::Rand_prop_point{ 956, 51912.36328125, 51912.36328125, { 138432.96875, 103824.7265625, 77868.546875, 69216.484375, 69216.484375 } },
+    dbc::Rand_prop_point{ 957, 52398.31640625, 52398.31640625, { 139728.84375, 104796.6328125, 78597.4765625, 69864.421875, 69864.421875 } },
+    dbc::Rand_prop_point{ 958, 52888.81640625, 52888.81640625, { 141036.84375, 105777.6328125, 79333.2265625, 70518.421875, 70518.421875 } },
+    dbc::Rand_prop_point{ 959, 53383.91015625, 53383.91015625, { 142357.09375, 106767.8203125, 80075.8671875, 71178.546875, 71178.546875 } },
+    dbc::Rand_prop_point{ 960, 53883.63671875, 53883.63671875, { 143689.703125, 107767.2734375, 80825.453125, 71844.8515625, 71844.8515625 } },
+    dbc::Rand_prop_point{ 961, 54388.04296875, 54388.04296875, { 145034.78125, 108776.09375, 81582.0625, 72517.390625, 72517.390625 } },
+    dbc::Rand_prop_point{ 962, 54897.16796875, 54897.16796875, { 146392.453125, 109794.34375, 82345.75, 73196.2265625, 73196.2265625 } },
+    dbc::Rand_prop_point{ 963, 55411.0625, 55411.0625, { 147762.828125, 110822.1328125, 83116.59375, 73881.4140625, 73881.4140625 } },
+    dbc::Rand_prop_point{ 964, 55929.765625, 55929.765625, { 149146.03125, 111859.53125, 83894.6484375, 74573.015625, 74573.015625 } },
+    dbc::Rand_prop_point{ 965, 56453.32421875, 56453.32421875, { 150542.1875, 112906.6484375, 84679.984375, 75271.09375, 75271.09375 } },
+    dbc::Rand_prop_point{ 966, 56981.78125, 56981.78125, { 151951.421875, 113963.5625, 85472.671875, 75975.7109375, 75975.7109375 } },
+    dbc::Rand_prop_point{ 967, 57515.19140625, 57515.19140625, { 153373.84375, 115030.3828125, 86272.78125, 76686.921875, 76686.921875 } },
+    dbc::Rand_prop_point{ 968, 58053.58984375, 58053.58984375, { 154809.578125, 116107.1796875, 87080.3828125, 77404.7890625, 77404.7890625 } },
+    dbc::Rand_prop_point{ 969, 58597.03125, 58597.03125, { 156258.75, 117194.0625, 87895.546875, 78129.375, 78129.375 } },
+    dbc::Rand_prop_point{ 970, 59145.55859375, 59145.55859375, { 157721.484375, 118291.1171875, 88718.3359375, 78860.7421875, 78860.7421875 } },
+    dbc::Rand_prop_point{ 971, 59699.21875, 59699.21875, { 159197.921875, 119398.4375, 89548.828125, 79598.9609375, 79598.9609375 } },
+    dbc::Rand_prop_point{ 972, 60258.0625, 60258.0625, { 160688.171875, 120516.1328125, 90387.09375, 80344.0859375, 80344.0859375 } },
+    dbc::Rand_prop_point{ 973, 60822.140625, 60822.140625, { 162192.375, 121644.28125, 91233.2109375, 81096.1875, 81096.1875 } },
+    dbc::Rand_prop_point{ 974, 61391.49609375, 61391.49609375, { 163710.65625, 122782.9921875, 92087.2421875, 81855.328125, 81855.328125 } },
+    dbc::Rand_prop_point{ 975, 61966.18359375, 61966.18359375, { 165243.15625, 123932.3671875, 92949.2734375, 82621.578125, 82621.578125 } },
+    dbc::Rand_prop_point{ 976, 62546.24609375, 62546.24609375, { 166790, 125092.4921875, 93819.375, 83395, 83395 } },
+    dbc::Rand_prop_point{ 977, 63131.7421875, 63131.7421875, { 168351.3125, 126263.4765625, 94697.6171875, 84175.65625, 84175.65625 } },
+    dbc::Rand_prop_point{ 978, 63722.71875, 63722.71875, { 169927.25, 127445.4375, 95584.078125, 84963.625, 84963.625 } },
+    dbc::Rand_prop_point{ 979, 64319.23046875, 64319.23046875, { 171517.9375, 128638.4609375, 96478.84375, 85758.96875, 85758.96875 } },
+    dbc::Rand_prop_point{ 980, 64921.3203125, 64921.3203125, { 173123.53125, 129842.640625, 97381.984375, 86561.765625, 86561.765625 } },
+    dbc::Rand_prop_point{ 981, 65529.05078125, 65529.05078125, { 174744.140625, 131058.1015625, 98293.578125, 87372.0703125, 87372.0703125 } },
+    dbc::Rand_prop_point{ 982, 66142.46875, 66142.46875, { 176379.921875, 132284.9375, 99213.703125, 88189.9609375, 88189.9609375 } },
+    dbc::Rand_prop_point{ 983, 66761.625, 66761.625, { 178031.015625, 133523.25, 100142.453125, 89015.5078125, 89015.5078125 } },
+    dbc::Rand_prop_point{ 984, 67386.5859375, 67386.5859375, { 179697.5625, 134773.171875, 101079.8828125, 89848.78125, 89848.78125 } },
+    dbc::Rand_prop_point{ 985, 68017.390625, 68017.390625, { 181379.703125, 136034.78125, 102026.09375, 90689.8515625, 90689.8515625 } },
+    dbc::Rand_prop_point{ 986, 68654.1015625, 68654.1015625, { 183077.609375, 137308.203125, 102981.15625, 91538.8046875, 91538.8046875 } },
+    dbc::Rand_prop_point{ 987, 69296.7734375, 69296.7734375, { 184791.390625, 138593.546875, 103945.15625, 92395.6953125, 92395.6953125 } },
+    dbc::Rand_prop_point{ 988, 69945.4609375, 69945.4609375, { 186521.234375, 139890.921875, 104918.1875, 93260.6171875, 93260.6171875 } },
+    dbc::Rand_prop_point{ 989, 70600.21875, 70600.21875, { 188267.25, 141200.4375, 105900.328125, 94133.625, 94133.625 } },
+    dbc::Rand_prop_point{ 990, 71261.109375, 71261.109375, { 190029.625, 142522.21875, 106891.65625, 95014.8125, 95014.8125 } },
+    dbc::Rand_prop_point{ 991, 71928.1875, 71928.1875, { 191808.5, 143856.375, 107892.28125, 95904.25, 95904.25 } },
+    dbc::Rand_prop_point{ 992, 72601.5078125, 72601.5078125, { 193604.015625, 145203.015625, 108902.2578125, 96802.0078125, 96802.0078125 } },
+    dbc::Rand_prop_point{ 993, 73281.125, 73281.125, { 195416.34375, 146562.25, 109921.703125, 97708.171875, 97708.171875 } },
+    dbc::Rand_prop_point{ 994, 73967.1171875, 73967.1171875, { 197245.640625, 147934.234375, 110950.671875, 98622.8203125, 98622.8203125 } },
+    dbc::Rand_prop_point{ 995, 74659.5234375, 74659.5234375, { 199092.046875, 149319.046875, 111989.28125, 99546.0234375, 99546.0234375 } },
+    dbc::Rand_prop_point{ 996, 75358.40625, 75358.40625, { 200955.75, 150716.8125, 113037.609375, 100477.8828125, 100477.8828125 } },
+    dbc::Rand_prop_point{ 997, 76063.8359375, 76063.8359375, { 202836.90625, 152127.671875, 114095.7578125, 101418.453125, 101418.453125 } },
+    dbc::Rand_prop_point{ 998, 76775.875, 76775.875, { 204735.65625, 153551.75, 115163.8125, 102367.828125, 102367.828125 } },
+    dbc::Rand_prop_point{ 999, 77494.5703125, 77494.5703125, { 206652.1875, 154989.140625, 116241.859375, 103326.09375, 103326.09375 } },
+    dbc::Rand_prop_point{ 1000, 78220, 78220, { 208586.671875, 156440, 117330, 104293.34375, 104293.34375 } },
+    dbc::Rand_prop_point{ 1001, 78952.21875, 78952.21875, { 210539.25, 157904.4375, 118428.328125, 105269.6328125, 105269.6328125 } },
+    dbc::Rand_prop_point{ 1002, 79691.2890625, 79691.2890625, { 212510.109375, 159382.578125, 119536.9375, 106255.046875, 106255.046875 } },
+    dbc::Rand_prop_point{ 1003, 80437.28125, 80437.28125, { 214499.40625, 160874.5625, 120655.921875, 107249.703125, 107249.703125 } },
+    dbc::Rand_prop_point{ 1004, 81190.25, 81190.25, { 216507.34375, 162380.5, 121785.3828125, 108253.671875, 108253.671875 } },
+    dbc::Rand_prop_point{ 1005, 81950.2734375, 81950.2734375, { 218534.0625, 163900.546875, 122925.40625, 109267.03125, 109267.03125 } },
+    dbc::Rand_prop_point{ 1006, 82717.4140625, 82717.4140625, { 220579.765625, 165434.828125, 124076.1171875, 110289.8828125, 110289.8828125 } },
+    dbc::Rand_prop_point{ 1007, 83491.734375, 83491.734375, { 222644.609375, 166983.46875, 125237.59375, 111322.296875, 111322.296875 } },
+    dbc::Rand_prop_point{ 1008, 84273.296875, 84273.296875, { 224728.796875, 168546.59375, 126409.953125, 112364.3984375, 112364.3984375 } },
+    dbc::Rand_prop_point{ 1009, 85062.1796875, 85062.1796875, { 226832.484375, 170124.359375, 127593.2734375, 113416.2421875, 113416.2421875 } },
+    dbc::Rand_prop_point{ 1010, 85858.4453125, 85858.4453125, { 228955.859375, 171716.890625, 128787.671875, 114477.9296875, 114477.9296875 } },
+    dbc::Rand_prop_point{ 1011, 86662.171875, 86662.171875, { 231099.125, 173324.34375, 129993.2578125, 115549.5625, 115549.5625 } },
+    dbc::Rand_prop_point{ 1012, 87473.4140625, 87473.4140625, { 233262.4375, 174946.828125, 131210.125, 116631.21875, 116631.21875 } },
+    dbc::Rand_prop_point{ 1013, 88292.25, 88292.25, { 235446.015625, 176584.5, 132438.375, 117723.0078125, 117723.0078125 } },
+    dbc::Rand_prop_point{ 1014, 89118.7578125, 89118.7578125, { 237650.015625, 178237.515625, 133678.140625, 118825.0078125, 118825.0078125 } },
+    dbc::Rand_prop_point{ 1015, 89953, 89953, { 239874.65625, 179906, 134929.5, 119937.328125, 119937.328125 } },
+    dbc::Rand_prop_point{ 1016, 90795.046875, 90795.046875, { 242120.125, 181590.09375, 136192.578125, 121060.0625, 121060.0625 } },
+    dbc::Rand_prop_point{ 1017, 91644.984375, 91644.984375, { 244386.625, 183289.96875, 137467.46875, 122193.3125, 122193.3125 } },
+    dbc::Rand_prop_point{ 1018, 92502.875, 92502.875, { 246674.328125, 185005.75, 138754.3125, 123337.15625, 123337.15625 } },
+    dbc::Rand_prop_point{ 1019, 93368.7890625, 93368.7890625, { 248983.4375, 186737.578125, 140053.1875, 124491.71875, 124491.71875 } },
+    dbc::Rand_prop_point{ 1020, 94242.8203125, 94242.8203125, { 251314.171875, 188485.640625, 141364.21875, 125657.09375, 125657.09375 } },
+    dbc::Rand_prop_point{ 1021, 95125.0234375, 95125.0234375, { 253666.734375, 190250.046875, 142687.53125, 126833.3671875, 126833.3671875 } },
+    dbc::Rand_prop_point{ 1022, 96015.4921875, 96015.4921875, { 256041.3125, 192030.984375, 144023.234375, 128020.65625, 128020.65625 } },
+    dbc::Rand_prop_point{ 1023, 96914.2890625, 96914.2890625, { 258438.109375, 193828.578125, 145371.4375, 129219.046875, 129219.046875 } },
+    dbc::Rand_prop_point{ 1024, 97821.5078125, 97821.5078125, { 260857.359375, 195643.015625, 146732.265625, 130428.6796875, 130428.6796875 } },
+    dbc::Rand_prop_point{ 1025, 98737.21875, 98737.21875, { 263299.25, 197474.4375, 148105.828125, 131649.625, 131649.625 } },
+    dbc::Rand_prop_point{ 1026, 99661.4921875, 99661.4921875, { 265764, 199322.984375, 149492.234375, 132882, 132882 } },
+    dbc::Rand_prop_point{ 1027, 100594.4296875, 100594.4296875, { 268251.8125, 201188.859375, 150891.640625, 134125.90625, 134125.90625 } },
+    dbc::Rand_prop_point{ 1028, 101536.09375, 101536.09375, { 270762.90625, 203072.1875, 152304.140625, 135381.453125, 135381.453125 } },
+    dbc::Rand_prop_point{ 1029, 102486.5703125, 102486.5703125, { 273297.53125, 204973.140625, 153729.859375, 136648.765625, 136648.765625 } },
+    dbc::Rand_prop_point{ 1030, 103445.953125, 103445.953125, { 275855.875, 206891.890625, 155168.921875, 137927.9375, 137927.9375 } },
+    dbc::Rand_prop_point{ 1031, 104414.296875, 104414.296875, { 278438.15625, 208828.609375, 156621.453125, 139219.078125, 139219.078125 } },
+    dbc::Rand_prop_point{ 1032, 105391.7265625, 105391.7265625, { 281044.625, 210783.453125, 158087.59375, 140522.3125, 140522.3125 } },
+    dbc::Rand_prop_point{ 1033, 106378.296875, 106378.296875, { 283675.46875, 212756.609375, 159567.453125, 141837.734375, 141837.734375 } },
+    dbc::Rand_prop_point{ 1034, 107374.109375, 107374.109375, { 286330.96875, 214748.21875, 161061.171875, 143165.484375, 143165.484375 } },
+    dbc::Rand_prop_point{ 1035, 108379.2421875, 108379.2421875, { 289011.3125, 216758.484375, 162568.859375, 144505.65625, 144505.65625 } },
+    dbc::Rand_prop_point{ 1036, 109393.78125, 109393.78125, { 291716.75, 218787.5625, 164090.671875, 145858.375, 145858.375 } },
+    dbc::Rand_prop_point{ 1037, 110417.8125, 110417.8125, { 294447.5, 220835.625, 165626.71875, 147223.75, 147223.75 } },
+    dbc::Rand_prop_point{ 1038, 111451.4375, 111451.4375, { 297203.84375, 222902.875, 167177.15625, 148601.921875, 148601.921875 } },
+    dbc::Rand_prop_point{ 1039, 112494.7265625, 112494.7265625, { 299985.96875, 224989.46875, 168742.09375, 149992.984375, 149992.984375 } },
+    dbc::Rand_prop_point{ 1040, 113547.796875, 113547.796875, { 302794.125, 227095.59375, 170321.703125, 151397.0625, 151397.0625 } },
+    dbc::Rand_prop_point{ 1041, 114610.71875, 114610.71875, { 305628.59375, 229221.4375, 171916.078125, 152814.296875, 152814.296875 } },
+    dbc::Rand_prop_point{ 1042, 115683.59375, 115683.59375, { 308489.5625, 231367.1875, 173525.390625, 154244.78125, 154244.78125 } },
+    dbc::Rand_prop_point{ 1043, 116766.5078125, 116766.5078125, { 311377.34375, 233533.015625, 175149.765625, 155688.671875, 155688.671875 } },
+    dbc::Rand_prop_point{ 1044, 117859.546875, 117859.546875, { 314292.15625, 235719.109375, 176789.328125, 157146.078125, 157146.078125 } },
+    dbc::Rand_prop_point{ 1045, 118962.84375, 118962.84375, { 317234.25, 237925.6875, 178444.265625, 158617.125, 158617.125 } },
+    dbc::Rand_prop_point{ 1046, 120076.453125, 120076.453125, { 320203.875, 240152.90625, 180114.671875, 160101.9375, 160101.9375 } },
+    dbc::Rand_prop_point{ 1047, 121200.4921875, 121200.4921875, { 323201.3125, 242400.984375, 181800.734375, 161600.65625, 161600.65625 } },
+    dbc::Rand_prop_point{ 1048, 122335.046875, 122335.046875, { 326226.78125, 244670.09375, 183502.578125, 163113.390625, 163113.390625 } },
+    dbc::Rand_prop_point{ 1049, 123480.2265625, 123480.2265625, { 329280.59375, 246960.453125, 185220.34375, 164640.296875, 164640.296875 } },
+    dbc::Rand_prop_point{ 1050, 124636.1328125, 124636.1328125, { 332363, 249272.25, 186954.1875, 166181.5, 166181.5 } },
+    dbc::Rand_prop_point{ 1051, 125802.84375, 125802.84375, { 335474.25, 251605.6875, 188704.265625, 167737.125, 167737.125 } },
+    dbc::Rand_prop_point{ 1052, 126980.4765625, 126980.4765625, { 338614.625, 253960.96875, 190470.734375, 169307.3125, 169307.3125 } },
+    dbc::Rand_prop_point{ 1053, 128169.1484375, 128169.1484375, { 341784.40625, 256338.296875, 192253.734375, 170892.203125, 170892.203125 } },
+    dbc::Rand_prop_point{ 1054, 129368.953125, 129368.953125, { 344983.84375, 258737.890625, 194053.421875, 172491.921875, 172491.921875 } },
+    dbc::Rand_prop_point{ 1055, 130579.96875, 130579.96875, { 348213.25, 261159.9375, 195869.953125, 174106.625, 174106.625 } },
+    dbc::Rand_prop_point{ 1056, 131802.328125, 131802.328125, { 351472.875, 263604.65625, 197703.484375, 175736.4375, 175736.4375 } },
+    dbc::Rand_prop_point{ 1057, 133036.125, 133036.125, { 354763, 266072.25, 199554.1875, 177381.5, 177381.5 } },
+    dbc::Rand_prop_point{ 1058, 134281.484375, 134281.484375, { 358083.9375, 268562.96875, 201422.21875, 179041.96875, 179041.96875 } },
+    dbc::Rand_prop_point{ 1059, 135538.484375, 135538.484375, { 361435.96875, 271076.96875, 203307.734375, 180717.984375, 180717.984375 } },
+    dbc::Rand_prop_point{ 1060, 136807.265625, 136807.265625, { 364819.375, 273614.53125, 205210.90625, 182409.6875, 182409.6875 } },
+    dbc::Rand_prop_point{ 1061, 138087.921875, 138087.921875, { 368234.46875, 276175.84375, 207131.875, 184117.234375, 184117.234375 } },
+    dbc::Rand_prop_point{ 1062, 139380.5625, 139380.5625, { 371681.5, 278761.125, 209070.84375, 185840.75, 185840.75 } },
+    dbc::Rand_prop_point{ 1063, 140685.3125, 140685.3125, { 375160.8125, 281370.625, 211027.953125, 187580.40625, 187580.40625 } },
+    dbc::Rand_prop_point{ 1064, 142002.265625, 142002.265625, { 378672.6875, 284004.53125, 213003.390625, 189336.34375, 189336.34375 } },
+    dbc::Rand_prop_point{ 1065, 143331.546875, 143331.546875, { 382217.4375, 286663.09375, 214997.3125, 191108.71875, 191108.71875 } },
+    dbc::Rand_prop_point{ 1066, 144673.265625, 144673.265625, { 385795.40625, 289346.53125, 217009.90625, 192897.703125, 192897.703125 } },
+    dbc::Rand_prop_point{ 1067, 146027.5625, 146027.5625, { 389406.8125, 292055.125, 219041.34375, 194703.40625, 194703.40625 } },
+    dbc::Rand_prop_point{ 1068, 147394.53125, 147394.53125, { 393052.0625, 294789.0625, 221091.78125, 196526.03125, 196526.03125 } },
+    dbc::Rand_prop_point{ 1069, 148774.28125, 148774.28125, { 396731.4375, 297548.5625, 223161.421875, 198365.71875, 198365.71875 } },
+    dbc::Rand_prop_point{ 1070, 150166.96875, 150166.96875, { 400445.21875, 300333.9375, 225250.4375, 200222.609375, 200222.609375 } },
+    dbc::Rand_prop_point{ 1071, 151572.671875, 151572.671875, { 404193.8125, 303145.34375, 227359.015625, 202096.90625, 202096.90625 } },
+    dbc::Rand_prop_point{ 1072, 152991.546875, 152991.546875, { 407977.46875, 305983.09375, 229487.328125, 203988.734375, 203988.734375 } },
+    dbc::Rand_prop_point{ 1073, 154423.703125, 154423.703125, { 411796.53125, 308847.40625, 231635.5625, 205898.265625, 205898.265625 } },
+    dbc::Rand_prop_point{ 1074, 155869.265625, 155869.265625, { 415651.375, 311738.53125, 233803.890625, 207825.6875, 207825.6875 } },
+    dbc::Rand_prop_point{ 1075, 157328.359375, 157328.359375, { 419542.28125, 314656.71875, 235992.53125, 209771.140625, 209771.140625 } },
+    dbc::Rand_prop_point{ 1076, 158801.109375, 158801.109375, { 423469.625, 317602.21875, 238201.65625, 211734.8125, 211734.8125 } },
+    dbc::Rand_prop_point{ 1077, 160287.640625, 160287.640625, { 427433.71875, 320575.28125, 240431.46875, 213716.859375, 213716.859375 } },
+    dbc::Rand_prop_point{ 1078, 161788.09375, 161788.09375, { 431434.9375, 323576.1875, 242682.15625, 215717.46875, 215717.46875 } },
+    dbc::Rand_prop_point{ 1079, 163302.59375, 163302.59375, { 435473.59375, 326605.1875, 244953.90625, 217736.796875, 217736.796875 } },
+    dbc::Rand_prop_point{ 1080, 164831.28125, 164831.28125, { 439550.0625, 329662.5625, 247246.921875, 219775.03125, 219775.03125 } },
+    dbc::Rand_prop_point{ 1081, 166374.265625, 166374.265625, { 443664.6875, 332748.53125, 249561.390625, 221832.34375, 221832.34375 } },
+    dbc::Rand_prop_point{ 1082, 167931.6875, 167931.6875, { 447817.84375, 335863.375, 251897.546875, 223908.921875, 223908.921875 } },
+    dbc::Rand_prop_point{ 1083, 169503.703125, 169503.703125, { 452009.875, 339007.40625, 254255.546875, 226004.9375, 226004.9375 } },
+    dbc::Rand_prop_point{ 1084, 171090.421875, 171090.421875, { 456241.15625, 342180.84375, 256635.640625, 228120.578125, 228120.578125 } },
+    dbc::Rand_prop_point{ 1085, 172692, 172692, { 460512.03125, 345384, 259038.015625, 230256.015625, 230256.015625 } },
+    dbc::Rand_prop_point{ 1086, 174308.578125, 174308.578125, { 464822.875, 348617.15625, 261462.859375, 232411.4375, 232411.4375 } },
+    dbc::Rand_prop_point{ 1087, 175940.28125, 175940.28125, { 469174.09375, 351880.5625, 263910.40625, 234587.046875, 234587.046875 } },
+    dbc::Rand_prop_point{ 1088, 177587.265625, 177587.265625, { 473566.03125, 355174.53125, 266380.875, 236783.015625, 236783.015625 } },
+    dbc::Rand_prop_point{ 1089, 179249.65625, 179249.65625, { 477999.0625, 358499.3125, 268874.46875, 238999.53125, 238999.53125 } },
+    dbc::Rand_prop_point{ 1090, 180927.609375, 180927.609375, { 482473.625, 361855.21875, 271391.40625, 241236.8125, 241236.8125 } },
+    dbc::Rand_prop_point{ 1091, 182621.28125, 182621.28125, { 486990.0625, 365242.5625, 273931.90625, 243495.03125, 243495.03125 } },
+    dbc::Rand_prop_point{ 1092, 184330.796875, 184330.796875, { 491548.78125, 368661.59375, 276496.1875, 245774.390625, 245774.390625 } },
+    dbc::Rand_prop_point{ 1093, 186056.3125, 186056.3125, { 496150.1875, 372112.625, 279084.46875, 248075.09375, 248075.09375 } },
+    dbc::Rand_prop_point{ 1094, 187797.984375, 187797.984375, { 500794.625, 375595.96875, 281697, 250397.3125, 250397.3125 } },
+    dbc::Rand_prop_point{ 1095, 189555.96875, 189555.96875, { 505482.59375, 379111.9375, 284333.9375, 252741.296875, 252741.296875 } },
+    dbc::Rand_prop_point{ 1096, 191330.40625, 191330.40625, { 510214.40625, 382660.8125, 286995.59375, 255107.203125, 255107.203125 } },
+    dbc::Rand_prop_point{ 1097, 193121.453125, 193121.453125, { 514990.53125, 386242.90625, 289682.15625, 257495.265625, 257495.265625 } },
+    dbc::Rand_prop_point{ 1098, 194929.265625, 194929.265625, { 519811.34375, 389858.53125, 292393.875, 259905.671875, 259905.671875 } },
+    dbc::Rand_prop_point{ 1099, 196753.984375, 196753.984375, { 524677.3125, 393507.96875, 295131, 262338.65625, 262338.65625 } },
+    dbc::Rand_prop_point{ 1100, 198595.8125, 198595.8125, { 529588.8125, 397191.625, 297893.71875, 264794.40625, 264794.40625 } },
+    dbc::Rand_prop_point{ 1101, 200454.859375, 200454.859375, { 534546.3125, 400909.71875, 300682.28125, 267273.15625, 267273.15625 } },
+    dbc::Rand_prop_point{ 1102, 202331.328125, 202331.328125, { 539550.1875, 404662.65625, 303496.96875, 269775.09375, 269775.09375 } },
+    dbc::Rand_prop_point{ 1103, 204225.34375, 204225.34375, { 544600.9375, 408450.6875, 306338.03125, 272300.46875, 272300.46875 } },
+    dbc::Rand_prop_point{ 1104, 206137.109375, 206137.109375, { 549698.9375, 412274.21875, 309205.65625, 274849.46875, 274849.46875 } },
+    dbc::Rand_prop_point{ 1105, 208066.75, 208066.75, { 554844.6875, 416133.5, 312100.125, 277422.34375, 277422.34375 } },
+    dbc::Rand_prop_point{ 1106, 210014.46875, 210014.46875, { 560038.5625, 420028.9375, 315021.6875, 280019.28125, 280019.28125 } },
+    dbc::Rand_prop_point{ 1107, 211980.40625, 211980.40625, { 565281.125, 423960.8125, 317970.625, 282640.5625, 282640.5625 } },
+    dbc::Rand_prop_point{ 1108, 213964.765625, 213964.765625, { 570572.6875, 427929.53125, 320947.15625, 285286.34375, 285286.34375 } },
+    dbc::Rand_prop_point{ 1109, 215967.6875, 215967.6875, { 575913.8125, 431935.375, 323951.53125, 287956.90625, 287956.90625 } },
+    dbc::Rand_prop_point{ 1110, 217989.359375, 217989.359375, { 581304.9375, 435978.71875, 326984.03125, 290652.46875, 290652.46875 } },
+    dbc::Rand_prop_point{ 1111, 220029.96875, 220029.96875, { 586746.5625, 440059.9375, 330044.9375, 293373.28125, 293373.28125 } },
+    dbc::Rand_prop_point{ 1112, 222089.671875, 222089.671875, { 592239.125, 444179.34375, 333134.5, 296119.5625, 296119.5625 } },
+    dbc::Rand_prop_point{ 1113, 224168.640625, 224168.640625, { 597783.0625, 448337.28125, 336252.96875, 298891.53125, 298891.53125 } },
+    dbc::Rand_prop_point{ 1114, 226267.09375, 226267.09375, { 603378.9375, 452534.1875, 339400.625, 301689.46875, 301689.46875 } },
+    dbc::Rand_prop_point{ 1115, 228385.171875, 228385.171875, { 609027.125, 456770.34375, 342577.78125, 304513.5625, 304513.5625 } },
+    dbc::Rand_prop_point{ 1116, 230523.09375, 230523.09375, { 614728.25, 461046.1875, 345784.625, 307364.125, 307364.125 } },
+    dbc::Rand_prop_point{ 1117, 232681.015625, 232681.015625, { 620482.75, 465362.03125, 349021.53125, 310241.375, 310241.375 } },
+    dbc::Rand_prop_point{ 1118, 234859.15625, 234859.15625, { 626291.0625, 469718.3125, 352288.71875, 313145.53125, 313145.53125 } },
+    dbc::Rand_prop_point{ 1119, 237057.671875, 237057.671875, { 632153.75, 474115.34375, 355586.5, 316076.875, 316076.875 } },
+    dbc::Rand_prop_point{ 1120, 239276.765625, 239276.765625, { 638071.375, 478553.53125, 358915.15625, 319035.6875, 319035.6875 } },
+    dbc::Rand_prop_point{ 1121, 241516.640625, 241516.640625, { 644044.375, 483033.28125, 362274.96875, 322022.1875, 322022.1875 } },
+    dbc::Rand_prop_point{ 1122, 243777.46875, 243777.46875, { 650073.25, 487554.9375, 365666.21875, 325036.625, 325036.625 } },
+    dbc::Rand_prop_point{ 1123, 246059.484375, 246059.484375, { 656158.625, 492118.96875, 369089.21875, 328079.3125, 328079.3125 } },
+    dbc::Rand_prop_point{ 1124, 248362.84375, 248362.84375, { 662300.9375, 496725.6875, 372544.25, 331150.46875, 331150.46875 } },
+    dbc::Rand_prop_point{ 1125, 250687.765625, 250687.765625, { 668500.6875, 501375.53125, 376031.65625, 334250.34375, 334250.34375 } },
+    dbc::Rand_prop_point{ 1126, 253034.453125, 253034.453125, { 674758.5625, 506068.90625, 379551.6875, 337379.28125, 337379.28125 } },
+    dbc::Rand_prop_point{ 1127, 255403.109375, 255403.109375, { 681075, 510806.21875, 383104.65625, 340537.5, 340537.5 } },
+    dbc::Rand_prop_point{ 1128, 257793.9375, 257793.9375, { 687450.5, 515587.875, 386690.90625, 343725.25, 343725.25 } },
+    dbc::Rand_prop_point{ 1129, 260207.15625, 260207.15625, { 693885.75, 520414.3125, 390310.71875, 346942.875, 346942.875 } },
+    dbc::Rand_prop_point{ 1130, 262642.96875, 262642.96875, { 700381.1875, 525285.9375, 393964.4375, 350190.59375, 350190.59375 } },
+    dbc::Rand_prop_point{ 1131, 265101.5625, 265101.5625, { 706937.5, 530203.125, 397652.34375, 353468.75, 353468.75 } },
+    dbc::Rand_prop_point{ 1132, 267583.1875, 267583.1875, { 713555.125, 535166.375, 401374.75, 356777.5625, 356777.5625 } },
+    dbc::Rand_prop_point{ 1133, 270088.03125, 270088.03125, { 720234.75, 540176.0625, 405132.03125, 360117.375, 360117.375 } },
+    dbc::Rand_prop_point{ 1134, 272616.3125, 272616.3125, { 726976.875, 545232.625, 408924.46875, 363488.4375, 363488.4375 } },
+    dbc::Rand_prop_point{ 1135, 275168.28125, 275168.28125, { 733782.0625, 550336.5625, 412752.40625, 366891.03125, 366891.03125 } },
+    dbc::Rand_prop_point{ 1136, 277744.125, 277744.125, { 740651, 555488.25, 416616.1875, 370325.5, 370325.5 } },
+    dbc::Rand_prop_point{ 1137, 280344.09375, 280344.09375, { 747584.25, 560688.1875, 420516.15625, 373792.125, 373792.125 } },
+    dbc::Rand_prop_point{ 1138, 282968.40625, 282968.40625, { 754582.375, 565936.8125, 424452.59375, 377291.1875, 377291.1875 } },
+    dbc::Rand_prop_point{ 1139, 285617.28125, 285617.28125, { 761646.0625, 571234.5625, 428425.90625, 380823.03125, 380823.03125 } },
+    dbc::Rand_prop_point{ 1140, 288290.9375, 288290.9375, { 768775.8125, 576581.875, 432436.40625, 384387.90625, 384387.90625 } },
+    dbc::Rand_prop_point{ 1141, 290989.625, 290989.625, { 775972.3125, 581979.25, 436484.4375, 387986.15625, 387986.15625 } },
+    dbc::Rand_prop_point{ 1142, 293713.59375, 293713.59375, { 783236.1875, 587427.1875, 440570.375, 391618.09375, 391618.09375 } },
+    dbc::Rand_prop_point{ 1143, 296463.03125, 296463.03125, { 790568.125, 592926.0625, 444694.5625, 395284.0625, 395284.0625 } },
+    dbc::Rand_prop_point{ 1144, 299238.21875, 299238.21875, { 797968.625, 598476.4375, 448857.34375, 398984.3125, 398984.3125 } },
+    dbc::Rand_prop_point{ 1145, 302039.40625, 302039.40625, { 805438.375, 604078.8125, 453059.09375, 402719.1875, 402719.1875 } },
+    dbc::Rand_prop_point{ 1146, 304866.78125, 304866.78125, { 812978.125, 609733.5625, 457300.1875, 406489.0625, 406489.0625 } },
+    dbc::Rand_prop_point{ 1147, 307720.65625, 307720.65625, { 820588.375, 615441.3125, 461580.96875, 410294.1875, 410294.1875 } },
+    dbc::Rand_prop_point{ 1148, 310601.21875, 310601.21875, { 828269.9375, 621202.4375, 465901.84375, 414134.96875, 414134.96875 } },
+    dbc::Rand_prop_point{ 1149, 313508.75, 313508.75, { 836023.375, 627017.5, 470263.15625, 418011.6875, 418011.6875 } },
+    dbc::Rand_prop_point{ 1150, 316443.53125, 316443.53125, { 843849.375, 632887.0625, 474665.28125, 421924.6875, 421924.6875 } },
+    dbc::Rand_prop_point{ 1151, 319405.75, 319405.75, { 851748.6875, 638811.5, 479108.625, 425874.34375, 425874.34375 } },
+    dbc::Rand_prop_point{ 1152, 322395.71875, 322395.71875, { 859721.875, 644791.4375, 483593.5625, 429860.9375, 429860.9375 } },
+    dbc::Rand_prop_point{ 1153, 325413.65625, 325413.65625, { 867769.75, 650827.3125, 488120.5, 433884.875, 433884.875 } },
+    dbc::Rand_prop_point{ 1154, 328459.84375, 328459.84375, { 875892.9375, 656919.6875, 492689.78125, 437946.46875, 437946.46875 } },
+    dbc::Rand_prop_point{ 1155, 331534.5625, 331534.5625, { 884092.1875, 663069.125, 497301.84375, 442046.09375, 442046.09375 } },
+    dbc::Rand_prop_point{ 1156, 334638.0625, 334638.0625, { 892368.1875, 669276.125, 501957.09375, 446184.09375, 446184.09375 } },
+    dbc::Rand_prop_point{ 1157, 337770.625, 337770.625, { 900721.625, 675541.25, 506655.9375, 450360.8125, 450360.8125 } },
+    dbc::Rand_prop_point{ 1158, 340932.5, 340932.5, { 909153.3125, 681865, 511398.75, 454576.65625, 454576.65625 } },
+    dbc::Rand_prop_point{ 1159, 344123.96875, 344123.96875, { 917663.875, 688247.9375, 516185.9375, 458831.9375, 458831.9375 } },
+    dbc::Rand_prop_point{ 1160, 347345.3125, 347345.3125, { 926254.125, 694690.625, 521017.96875, 463127.0625, 463127.0625 } },
+    dbc::Rand_prop_point{ 1161, 350596.8125, 350596.8125, { 934924.8125, 701193.625, 525895.1875, 467462.40625, 467462.40625 } },
+    dbc::Rand_prop_point{ 1162, 353878.75, 353878.75, { 943676.6875, 707757.5, 530818.125, 471838.34375, 471838.34375 } },
+    dbc::Rand_prop_point{ 1163, 357191.40625, 357191.40625, { 952510.4375, 714382.8125, 535787.125, 476255.21875, 476255.21875 } },
+    dbc::Rand_prop_point{ 1164, 360535.09375, 360535.09375, { 961426.875, 721070.1875, 540802.625, 480713.4375, 480713.4375 } },
+    dbc::Rand_prop_point{ 1165, 363910.0625, 363910.0625, { 970426.8125, 727820.125, 545865.0625, 485213.40625, 485213.40625 } },
+    dbc::Rand_prop_point{ 1166, 367316.625, 367316.625, { 979511, 734633.25, 550974.9375, 489755.5, 489755.5 } },
+    dbc::Rand_prop_point{ 1167, 370755.0625, 370755.0625, { 988680.1875, 741510.125, 556132.625, 494340.09375, 494340.09375 } },
+    dbc::Rand_prop_point{ 1168, 374225.71875, 374225.71875, { 997935.25, 748451.4375, 561338.5625, 498967.625, 498967.625 } },
+    dbc::Rand_prop_point{ 1169, 377728.84375, 377728.84375, { 1007276.875, 755457.6875, 566593.25, 503638.4375, 503638.4375 } },
+    dbc::Rand_prop_point{ 1170, 381264.75, 381264.75, { 1016706, 762529.5, 571897.125, 508353, 508353 } },
+    dbc::Rand_prop_point{ 1171, 384833.78125, 384833.78125, { 1026223.375, 769667.5625, 577250.6875, 513111.71875, 513111.71875 } },
+    dbc::Rand_prop_point{ 1172, 388436.21875, 388436.21875, { 1035829.875, 776872.4375, 582654.3125, 517914.9375, 517914.9375 } },
+    dbc::Rand_prop_point{ 1173, 392072.375, 392072.375, { 1045526.3125, 784144.75, 588108.5625, 522763.15625, 522763.15625 } },
+    dbc::Rand_prop_point{ 1174, 395742.5625, 395742.5625, { 1055313.5, 791485.125, 593613.8125, 527656.75, 527656.75 } },
+    dbc::Rand_prop_point{ 1175, 399447.09375, 399447.09375, { 1065192.25, 798894.1875, 599170.6875, 532596.125, 532596.125 } },
+    dbc::Rand_prop_point{ 1176, 403186.34375, 403186.34375, { 1075163.5, 806372.6875, 604779.5, 537581.75, 537581.75 } },
+    dbc::Rand_prop_point{ 1177, 406960.5625, 406960.5625, { 1085228.125, 813921.125, 610440.8125, 542614.0625, 542614.0625 } },
+    dbc::Rand_prop_point{ 1178, 410770.125, 410770.125, { 1095387, 821540.25, 616155.1875, 547693.5, 547693.5 } },
+    dbc::Rand_prop_point{ 1179, 414615.34375, 414615.34375, { 1105640.875, 829230.6875, 621923, 552820.4375, 552820.4375 } },
+    dbc::Rand_prop_point{ 1180, 418496.5625, 418496.5625, { 1115990.875, 836993.125, 627744.8125, 557995.4375, 557995.4375 } },
+    dbc::Rand_prop_point{ 1181, 422414.09375, 422414.09375, { 1126437.625, 844828.1875, 633621.1875, 563218.8125, 563218.8125 } },
+    dbc::Rand_prop_point{ 1182, 426368.3125, 426368.3125, { 1136982.25, 852736.625, 639552.5, 568491.125, 568491.125 } },
+    dbc::Rand_prop_point{ 1183, 430359.5625, 430359.5625, { 1147625.5, 860719.125, 645539.375, 573812.75, 573812.75 } },
+    dbc::Rand_prop_point{ 1184, 434388.15625, 434388.15625, { 1158368.375, 868776.3125, 651582.25, 579184.1875, 579184.1875 } },
+    dbc::Rand_prop_point{ 1185, 438454.46875, 438454.46875, { 1169211.875, 876908.9375, 657681.6875, 584605.9375, 584605.9375 } },
+    dbc::Rand_prop_point{ 1186, 442558.84375, 442558.84375, { 1180156.875, 885117.6875, 663838.25, 590078.4375, 590078.4375 } },
+    dbc::Rand_prop_point{ 1187, 446701.65625, 446701.65625, { 1191204.375, 893403.3125, 670052.4375, 595602.1875, 595602.1875 } },
+    dbc::Rand_prop_point{ 1188, 450883.21875, 450883.21875, { 1202355.25, 901766.4375, 676324.8125, 601177.625, 601177.625 } },
+    dbc::Rand_prop_point{ 1189, 455103.9375, 455103.9375, { 1213610.5, 910207.875, 682655.9375, 606805.25, 606805.25 } },
+    dbc::Rand_prop_point{ 1190, 459364.15625, 459364.15625, { 1224971.125, 918728.3125, 689046.25, 612485.5625, 612485.5625 } },
+    dbc::Rand_prop_point{ 1191, 463664.28125, 463664.28125, { 1236438.125, 927328.5625, 695496.4375, 618219.0625, 618219.0625 } },
+    dbc::Rand_prop_point{ 1192, 468004.65625, 468004.65625, { 1248012.375, 936009.3125, 702006.9375, 624006.1875, 624006.1875 } },
+    dbc::Rand_prop_point{ 1193, 472385.625, 472385.625, { 1259695, 944771.25, 708578.4375, 629847.5, 629847.5 } },
+    dbc::Rand_prop_point{ 1194, 476807.65625, 476807.65625, { 1271487, 953615.3125, 715211.4375, 635743.5, 635743.5 } },
+    dbc::Rand_prop_point{ 1195, 481271.03125, 481271.03125, { 1283389.5, 962542.0625, 721906.5625, 641694.75, 641694.75 } },
+    dbc::Rand_prop_point{ 1196, 485776.21875, 485776.21875, { 1295403.25, 971552.4375, 728664.3125, 647701.625, 647701.625 } },
+    dbc::Rand_prop_point{ 1197, 490323.5625, 490323.5625, { 1307529.5, 980647.125, 735485.375, 653764.75, 653764.75 } },
+    dbc::Rand_prop_point{ 1198, 494913.5, 494913.5, { 1319769.375, 989827, 742370.25, 659884.6875, 659884.6875 } },
+    dbc::Rand_prop_point{ 1199, 499546.375, 499546.375, { 1332123.75, 999092.75, 749319.5625, 666061.875, 666061.875 } },
+    dbc::Rand_prop_point{ 1200, 504222.65625, 504222.65625, { 1344593.75, 1008445.3125, 756333.9375, 672296.875, 672296.875 } },
+    dbc::Rand_prop_point{ 1201, 508942.6875, 508942.6875, { 1357180.5, 1017885.375, 763414, 678590.25, 678590.25 } },
+    dbc::Rand_prop_point{ 1202, 513706.875, 513706.875, { 1369885, 1027413.8125, 770560.3125, 684942.5, 684942.5 } },
+    dbc::Rand_prop_point{ 1203, 518515.6875, 518515.6875, { 1382708.5, 1037031.375, 777773.5625, 691354.25, 691354.25 } },
+    dbc::Rand_prop_point{ 1204, 523369.53125, 523369.53125, { 1395652.125, 1046739.125, 785054.3125, 697826.0625, 697826.0625 } },
+    dbc::Rand_prop_point{ 1205, 528268.8125, 528268.8125, { 1408716.75, 1056537.625, 792403.1875, 704358.375, 704358.375 } },
+    dbc::Rand_prop_point{ 1206, 533213.9375, 533213.9375, { 1421903.75, 1066427.875, 799820.875, 710951.875, 710951.875 } },
+    dbc::Rand_prop_point{ 1207, 538205.3125, 538205.3125, { 1435214.25, 1076410.625, 807308, 717607.125, 717607.125 } },
+    dbc::Rand_prop_point{ 1208, 543243.5, 543243.5, { 1448649.25, 1086487, 814865.25, 724324.625, 724324.625 } },
+    dbc::Rand_prop_point{ 1209, 548328.8125, 548328.8125, { 1462210.125, 1096657.625, 822493.1875, 731105.0625, 731105.0625 } },
+    dbc::Rand_prop_point{ 1210, 553461.6875, 553461.6875, { 1475897.875, 1106923.375, 830192.5625, 737948.9375, 737948.9375 } },
+    dbc::Rand_prop_point{ 1211, 558642.6875, 558642.6875, { 1489713.75, 1117285.375, 837964, 744856.875, 744856.875 } },
+    dbc::Rand_prop_point{ 1212, 563872.125, 563872.125, { 1503659, 1127744.25, 845808.1875, 751829.5, 751829.5 } },
+    dbc::Rand_prop_point{ 1213, 569150.5, 569150.5, { 1517734.75, 1138301, 853725.8125, 758867.375, 758867.375 } },
+    dbc::Rand_prop_point{ 1214, 574478.375, 574478.375, { 1531942.25, 1148956.75, 861717.5, 765971.125, 765971.125 } },
+    dbc::Rand_prop_point{ 1215, 579856.0625, 579856.0625, { 1546282.75, 1159712.125, 869784.0625, 773141.375, 773141.375 } },
+    dbc::Rand_prop_point{ 1216, 585284.0625, 585284.0625, { 1560757.5, 1170568.125, 877926.125, 780378.75, 780378.75 } },
+    dbc::Rand_prop_point{ 1217, 590762.9375, 590762.9375, { 1575367.75, 1181525.875, 886144.375, 787683.875, 787683.875 } },
+    dbc::Rand_prop_point{ 1218, 596293.0625, 596293.0625, { 1590114.875, 1192586.125, 894439.5625, 795057.4375, 795057.4375 } },
+    dbc::Rand_prop_point{ 1219, 601874.9375, 601874.9375, { 1604999.875, 1203749.875, 902812.4375, 802499.9375, 802499.9375 } },
+    dbc::Rand_prop_point{ 1220, 607509.125, 607509.125, { 1620024.25, 1215018.25, 911263.6875, 810012.125, 810012.125 } },
+    dbc::Rand_prop_point{ 1221, 613196, 613196, { 1635189.375, 1226392, 919794, 817594.6875, 817594.6875 } },
+    dbc::Rand_prop_point{ 1222, 618936.125, 618936.125, { 1650496.375, 1237872.25, 928404.1875, 825248.1875, 825248.1875 } },
+    dbc::Rand_prop_point{ 1223, 624730, 624730, { 1665946.625, 1249460, 937095, 832973.3125, 832973.3125 } },
+    dbc::Rand_prop_point{ 1224, 630578.125, 630578.125, { 1681541.625, 1261156.25, 945867.1875, 840770.8125, 840770.8125 } },
+    dbc::Rand_prop_point{ 1225, 636480.9375, 636480.9375, { 1697282.5, 1272961.875, 954721.4375, 848641.25, 848641.25 } },
+    dbc::Rand_prop_point{ 1226, 642439.0625, 642439.0625, { 1713170.875, 1284878.125, 963658.5625, 856585.4375, 856585.4375 } },
+    dbc::Rand_prop_point{ 1227, 648452.9375, 648452.9375, { 1729207.875, 1296905.875, 972679.375, 864603.9375, 864603.9375 } },
+    dbc::Rand_prop_point{ 1228, 654523.125, 654523.125, { 1745395, 1309046.25, 981784.625, 872697.5, 872697.5 } },
+    dbc::Rand_prop_point{ 1229, 660650.125, 660650.125, { 1761733.625, 1321300.25, 990975.125, 880866.8125, 880866.8125 } },
+    dbc::Rand_prop_point{ 1230, 666834.4375, 666834.4375, { 1778225.25, 1333668.875, 1000251.6875, 889112.625, 889112.625 } },
+    dbc::Rand_prop_point{ 1231, 673076.6875, 673076.6875, { 1794871.125, 1346153.375, 1009615, 897435.5625, 897435.5625 } },
+    dbc::Rand_prop_point{ 1232, 679377.375, 679377.375, { 1811673, 1358754.75, 1019066.125, 905836.5, 905836.5 } },
+    dbc::Rand_prop_point{ 1233, 685737, 685737, { 1828632, 1371474, 1028605.5, 914316, 914316 } },
+    dbc::Rand_prop_point{ 1234, 692156.1875, 692156.1875, { 1845749.875, 1384312.375, 1038234.3125, 922874.9375, 922874.9375 } },
+    dbc::Rand_prop_point{ 1235, 698635.5, 698635.5, { 1863028, 1397271, 1047953.3125, 931514, 931514 } },
+    dbc::Rand_prop_point{ 1236, 705175.4375, 705175.4375, { 1880467.75, 1410350.875, 1057763.125, 940233.875, 940233.875 } },
+    dbc::Rand_prop_point{ 1237, 711776.5625, 711776.5625, { 1898070.875, 1423553.125, 1067664.875, 949035.4375, 949035.4375 } },
+    dbc::Rand_prop_point{ 1238, 718439.5, 718439.5, { 1915838.75, 1436879, 1077659.25, 957919.375, 957919.375 } },
+    dbc::Rand_prop_point{ 1239, 725164.8125, 725164.8125, { 1933772.875, 1450329.625, 1087747.25, 966886.4375, 966886.4375 } },
+    dbc::Rand_prop_point{ 1240, 731953.125, 731953.125, { 1951874.875, 1463906.25, 1097929.625, 975937.4375, 975937.4375 } },
+    dbc::Rand_prop_point{ 1241, 738804.9375, 738804.9375, { 1970146.375, 1477609.875, 1108207.375, 985073.1875, 985073.1875 } },
+    dbc::Rand_prop_point{ 1242, 745720.875, 745720.875, { 1988589, 1491441.75, 1118581.25, 994294.5, 994294.5 } },
+    dbc::Rand_prop_point{ 1243, 752701.5625, 752701.5625, { 2007204.125, 1505403.125, 1129052.375, 1003602.125, 1003602.125 } },
+    dbc::Rand_prop_point{ 1244, 759747.625, 759747.625, { 2025993.625, 1519495.25, 1139621.375, 1012996.8125, 1012996.8125 } },
+    dbc::Rand_prop_point{ 1245, 766859.625, 766859.625, { 2044959, 1533719.25, 1150289.375, 1022479.5, 1022479.5 } },
+    dbc::Rand_prop_point{ 1246, 774038.1875, 774038.1875, { 2064101.875, 1548076.375, 1161057.25, 1032050.875, 1032050.875 } },
+    dbc::Rand_prop_point{ 1247, 781283.9375, 781283.9375, { 2083423.875, 1562567.875, 1171926, 1041711.875, 1041711.875 } },
+    dbc::Rand_prop_point{ 1248, 788597.5625, 788597.5625, { 2102926.75, 1577195.125, 1182896.375, 1051463.375, 1051463.375 } },
+    dbc::Rand_prop_point{ 1249, 795979.625, 795979.625, { 2122612.25, 1591959.25, 1193969.5, 1061306.125, 1061306.125 } },
+    dbc::Rand_prop_point{ 1250, 803430.8125, 803430.8125, { 2142482.25, 1606861.625, 1205146.25, 1071241.125, 1071241.125 } },
+    dbc::Rand_prop_point{ 1251, 810951.75, 810951.75, { 2162538, 1621903.5, 1216427.625, 1081269, 1081269 } },
+    dbc::Rand_prop_point{ 1252, 818543.0625, 818543.0625, { 2182781.5, 1637086.125, 1227814.625, 1091390.75, 1091390.75 } },
+    dbc::Rand_prop_point{ 1253, 826205.4375, 826205.4375, { 2203214.5, 1652410.875, 1239308.125, 1101607.25, 1101607.25 } },
+    dbc::Rand_prop_point{ 1254, 833939.5625, 833939.5625, { 2223838.75, 1667879.125, 1250909.375, 1111919.375, 1111919.375 } },
+    dbc::Rand_prop_point{ 1255, 841746.0625, 841746.0625, { 2244656.25, 1683492.125, 1262619.125, 1122328.125, 1122328.125 } },
+    dbc::Rand_prop_point{ 1256, 849625.625, 849625.625, { 2265668.5, 1699251.25, 1274438.5, 1132834.25, 1132834.25 } },
+    dbc::Rand_prop_point{ 1257, 857579, 857579, { 2286877.25, 1715158, 1286368.5, 1143438.625, 1143438.625 } },
+    dbc::Rand_prop_point{ 1258, 865606.8125, 865606.8125, { 2308284.75, 1731213.625, 1298410.25, 1154142.375, 1154142.375 } },
+    dbc::Rand_prop_point{ 1259, 873709.75, 873709.75, { 2329892.75, 1747419.5, 1310564.625, 1164946.375, 1164946.375 } },
+    dbc::Rand_prop_point{ 1260, 881888.5625, 881888.5625, { 2351702.75, 1763777.125, 1322832.875, 1175851.375, 1175851.375 } },
+    dbc::Rand_prop_point{ 1261, 890143.9375, 890143.9375, { 2373717, 1780287.875, 1335215.875, 1186858.5, 1186858.5 } },
+    dbc::Rand_prop_point{ 1262, 898476.5625, 898476.5625, { 2395937.5, 1796953.125, 1347714.875, 1197968.75, 1197968.75 } },
+    dbc::Rand_prop_point{ 1263, 906887.1875, 906887.1875, { 2418366, 1813774.375, 1360330.75, 1209183, 1209183 } },
+    dbc::Rand_prop_point{ 1264, 915376.5625, 915376.5625, { 2441004.25, 1830753.125, 1373064.875, 1220502.125, 1220502.125 } },
+    dbc::Rand_prop_point{ 1265, 923945.4375, 923945.4375, { 2463854.5, 1847890.875, 1385918.125, 1231927.25, 1231927.25 } },
+    dbc::Rand_prop_point{ 1266, 932594.5, 932594.5, { 2486918.5, 1865189, 1398891.75, 1243459.25, 1243459.25 } },
+    dbc::Rand_prop_point{ 1267, 941324.5, 941324.5, { 2510198.75, 1882649, 1411986.75, 1255099.375, 1255099.375 } },
+    dbc::Rand_prop_point{ 1268, 950136.25, 950136.25, { 2533696.75, 1900272.5, 1425204.375, 1266848.375, 1266848.375 } },
+    dbc::Rand_prop_point{ 1269, 959030.5, 959030.5, { 2557414.5, 1918061, 1438545.75, 1278707.25, 1278707.25 } },
+    dbc::Rand_prop_point{ 1270, 968008, 968008, { 2581354.5, 1936016, 1452012, 1290677.25, 1290677.25 } },
+    dbc::Rand_prop_point{ 1271, 977069.5, 977069.5, { 2605518.75, 1954139, 1465604.25, 1302759.375, 1302759.375 } },
+    dbc::Rand_prop_point{ 1272, 986215.875, 986215.875, { 2629909, 1972431.75, 1479323.75, 1314954.5, 1314954.5 } },
+    dbc::Rand_prop_point{ 1273, 995447.8125, 995447.8125, { 2654527.5, 1990895.625, 1493171.75, 1327263.75, 1327263.75 } },
+    dbc::Rand_prop_point{ 1274, 1004766.1875, 1004766.1875, { 2679376.5, 2009532.375, 1507149.375, 1339688.25, 1339688.25 } },
+    dbc::Rand_prop_point{ 1275, 1014171.8125, 1014171.8125, { 2704458.25, 2028343.625, 1521257.75, 1352229.125, 1352229.125 } },
+    dbc::Rand_prop_point{ 1276, 1023665.5, 1023665.5, { 2729774.75, 2047331, 1535498.25, 1364887.375, 1364887.375 } },
+    dbc::Rand_prop_point{ 1277, 1033248.125, 1033248.125, { 2755328, 2066496.125, 1549872.125, 1377664, 1377664 } },
+    dbc::Rand_prop_point{ 1278, 1042920.3125, 1042920.3125, { 2781120.75, 2085840.625, 1564380.375, 1390560.375, 1390560.375 } },
+    dbc::Rand_prop_point{ 1279, 1052683.125, 1052683.125, { 2807154.75, 2105366.25, 1579024.625, 1403577.375, 1403577.375 } },
+    dbc::Rand_prop_point{ 1280, 1062537.25, 1062537.25, { 2833432.75, 2125074.5, 1593805.875, 1416716.375, 1416716.375 } },
+    dbc::Rand_prop_point{ 1281, 1072483.625, 1072483.625, { 2859956.5, 2144967.25, 1608725.5, 1429978.25, 1429978.25 } },
+    dbc::Rand_prop_point{ 1282, 1082523.125, 1082523.125, { 2886728.5, 2165046.25, 1623784.75, 1443364.25, 1443364.25 } },
+    dbc::Rand_prop_point{ 1283, 1092656.625, 1092656.625, { 2913751.25, 2185313.25, 1638985, 1456875.625, 1456875.625 } },
+    dbc::Rand_prop_point{ 1284, 1102885, 1102885, { 2941026.75, 2205770, 1654327.625, 1470513.375, 1470513.375 } },
+    dbc::Rand_prop_point{ 1285, 1113209.125, 1113209.125, { 2968557.75, 2226418.25, 1669813.75, 1484278.875, 1484278.875 } },
+    dbc::Rand_prop_point{ 1286, 1123629.875, 1123629.875, { 2996346.5, 2247259.75, 1685444.875, 1498173.25, 1498173.25 } },
+    dbc::Rand_prop_point{ 1287, 1134148.25, 1134148.25, { 3024395.25, 2268296.5, 1701222.375, 1512197.625, 1512197.625 } },
+    dbc::Rand_prop_point{ 1288, 1144765, 1144765, { 3052706.75, 2289530, 1717147.5, 1526353.375, 1526353.375 } },
+    dbc::Rand_prop_point{ 1289, 1155481.125, 1155481.125, { 3081283, 2310962.25, 1733221.75, 1540641.5, 1540641.5 } },
+    dbc::Rand_prop_point{ 1290, 1166297.625, 1166297.625, { 3110127, 2332595.25, 1749446.375, 1555063.5, 1555063.5 } },
+    dbc::Rand_prop_point{ 1291, 1177215.375, 1177215.375, { 3139241, 2354430.75, 1765823, 1569620.5, 1569620.5 } },
+    dbc::Rand_prop_point{ 1292, 1188235.25, 1188235.25, { 3168627.25, 2376470.5, 1782352.875, 1584313.625, 1584313.625 } },
+    dbc::Rand_prop_point{ 1293, 1199358.375, 1199358.375, { 3198288.75, 2398716.75, 1799037.5, 1599144.375, 1599144.375 } },
+    dbc::Rand_prop_point{ 1294, 1210585.5, 1210585.5, { 3228228, 2421171, 1815878.25, 1614114, 1614114 } },
+    dbc::Rand_prop_point{ 1295, 1221917.875, 1221917.875, { 3258447.5, 2443835.75, 1832876.75, 1629223.75, 1629223.75 } },
+    dbc::Rand_prop_point{ 1296, 1233356.25, 1233356.25, { 3288950, 2466712.5, 1850034.25, 1644475, 1644475 } },
+    dbc::Rand_prop_point{ 1297, 1244901.625, 1244901.625, { 3319737.75, 2489803.25, 1867352.5, 1659868.875, 1659868.875 } },
+    dbc::Rand_prop_point{ 1298, 1256555.25, 1256555.25, { 3350813.75, 2513110.5, 1884832.75, 1675406.875, 1675406.875 } },
+    dbc::Rand_prop_point{ 1299, 1268317.75, 1268317.75, { 3382180.75, 2536635.5, 1902476.75, 1691090.375, 1691090.375 } },
+    dbc::Rand_prop_point{ 1300, 1280190.5, 1280190.5, { 3413841.5, 2560381, 1920285.75, 1706920.75, 1706920.75 } },
+  };
+}
+
+dbc::Rand_prop_point const* dbc::rand_prop_point(std::uint32_t ilvl) noexcept {
+  //ilvl 0 wraps around and fails the bounds check
+  const std::uint32_t index = ilvl - 1;
+  const auto table = pack::table(pack::Section::rand_prop_points, std::span<const dbc::Rand_prop_point>{ RAND_PROP_POINT });
+  if (index >= table.size() || table[index].ilvl != ilvl) {
+    return nullptr;
+  }
+  return &table[index];
+}
 
@@ -0,0 +1,2156 @@
+#include <prescience_helper/sim/dbc/spell_attributes.hpp>
+#include <prescience_helper/sim/dbc/pack.hpp>
+#include <algorithm>
+#include <array>
+#include <span>
+
+namespace dbc = prescience_helper::sim::dbc;
+namespace pack = prescience_helper::sim::dbc::pack;
+
+namespace {
+  //(spell id << 8) | attributes, so one binary search finds both
+  constexpr std::array<std::uint32_t, 25547> SPELL_ATTRIBUTES{
+    0x00003506, 0x00003B04, 0x00004202, 0x00004702, 0x00004B02, 0x00006302, 0x00006402, 0x00006504, 0x00007402, 0x00007602, 0x00007806, 0x00007A06,
+    0x00007E02, 0x00008202, 0x00008506, 0x00008803, 0x00008B02, 0x0000AC06, 0x00015302, 0x00015C06, 0x00016302, 0x00017202, 0x00017B02, 0x00019802,
+    0x0001DB02, 0x0001F202, 0x00020F02, 0x00021002, 0x00022202, 0x00022C02, 0x00023804, 0x00024906, 0x00024A02, 0x00024D06, 0x00025402, 0x00025B02,
+    0x00025D02, 0x00027903, 0x00028203, 0x0002AE06, 0x0002B002, 0x0002B302, 0x0002B902, 0x0002BA02, 0x0002BF02, 0x0002C602, 0x0002C802, 0x0002E402,
+    0x0002F303, 0x0002F702, 0x00030002, 0x00030406, 0x00030602, 0x00030D02, 0x00030F02, 0x00034D06, 0x00035502, 0x00036702, 0x00037302, 0x00039902,
+    0x0003CE02, 0x0003D402, 0x0003D602, 0x0003FE02, 0x00041402, 0x00041A04, 0x00042802, 0x00042A02, 0x00043702, 0x00044A02, 0x00046202, 0x00046602,
+    0x00048802, 0x00048902, 0x00049A02, 0x00053102, 0x00053202, 0x0005A906, 0x0005AE03, 0x0005B302, 0x0005B602, 0x0005B702, 0x0005B806, 0x0005D602,
+    0x0005E902, 0x0005EB02, 0x00060303, 0x00060702, 0x00069002, 0x0006AA02, 0x0006B306, 0x0006B702, 0x0006BD02, 0x0006D806, 0x0006E602, 0x0006F002,
+    0x0006F802, 0x00070C02, 0x00071E06, 0x00072902, 0x00073A02, 0x00074002, 0x00074402, 0x00079702, 0x00079D03, 0x0007A102, 0x0007AE02, 0x0007D602,
+    0x0007D802, 0x00080202, 0x00080C02, 0x00080D02, 0x00082E02, 0x00083002, 0x00083206, 0x00084806, 0x00085B02, 0x0009B402, 0x000A0502, 0x000A1902,
+    0x000A2E04, 0x000A4D02, 0x000A5102, 0x000A5306, 0x000A5502, 0x000A5902, 0x000A7404, 0x000ACC02, 0x000ADE02, 0x000AFC06, 0x000B0202, 0x000B0702,
+    0x000B0902, 0x000B1402, 0x000B5C02, 0x000B8406, 0x000BA702, 0x000BCA02, 0x000BD102, 0x000BD202, 0x000BEC04, 0x000BED04, 0x000BEE04, 0x000BEF04,
+    0x000C2204, 0x000C2606, 0x000C3104, 0x000C3702, 0x000C3904, 0x000C4704, 0x000C8404, 0x000C8504, 0x000C8604, 0x000C8704, 0x000CA204, 0x000CFA04,
+    0x000D0B04, 0x000D1B02, 0x000D1C04, 0x000D5002, 0x000D5102, 0x000D5302, 0x000DE902, 0x000DEA02, 0x000DEB02, 0x000DED02, 0x000DEE02, 0x000DEF02,
+    0x000E0F02, 0x000E1002, 0x000E1606, 0x000E8202, 0x000E8402, 0x00137B02, 0x00139B02, 0x0013F904, 0x0013FC02, 0x00141702, 0x00143302, 0x00143806,
+    0x00145B02, 0x00145F02, 0x00146102, 0x00146506, 0x00146902, 0x00147E02, 0x00148704, 0x00148F04, 0x00149D02, 0x0014B502, 0x0014B602, 0x0014BC02,
+    0x0014FE06, 0x00150802, 0x00151202, 0x00151904, 0x00151B04, 0x00151D02, 0x00152C02, 0x00152D02, 0x00156C02, 0x00156F02, 0x00162802, 0x00162F04,
+    0x00164102, 0x00166C02, 0x00168002, 0x00168102, 0x00169602, 0x00169802, 0x0016E106, 0x00173206, 0x00183402, 0x00183502, 0x00183902, 0x00183B02,
+    0x00186C04, 0x00186E04, 0x00186F04, 0x00187104, 0x00187601, 0x0018A004, 0x0018A104, 0x0018C706, 0x0018D106, 0x0018D602, 0x0018D802, 0x00192304,
+    0x00194A02, 0x00199002, 0x00199802, 0x0019AC06, 0x0019EC04, 0x001A1102, 0x001A4504, 0x001A7202, 0x001A8402, 0x001A8502, 0x001A8B02, 0x001A9706,
+    0x001B0504, 0x001B1C02, 0x001B2504, 0x001B4F02, 0x001BAA04, 0x001BBD04, 0x001C6406, 0x001CA002, 0x001CD806, 0x001CE101, 0x001DA404, 0x001DF404,
+    0x001E2802, 0x001E7B04, 0x001E8402, 0x001E8606, 0x001EBE02, 0x001F0F04, 0x001F4004, 0x001F4402, 0x001F6A06, 0x001F8E04, 0x001F9C06, 0x001FBA02,
+    0x001FCE04, 0x001FCF02, 0x001FD102, 0x001FD202, 0x001FD304, 0x001FD604, 0x001FF202, 0x001FFB06, 0x001FFC02, 0x001FFE02, 0x00201004, 0x00203204,
+    0x00203604, 0x00206404, 0x00206504, 0x0020CE04, 0x0020F304, 0x00213E01, 0x00216B04, 0x00219604, 0x00219804, 0x0021C604, 0x0021E406, 0x0021E702,
+    0x0021E806, 0x00220A04, 0x00221C04, 0x00226004, 0x0022AB02, 0x0022D902, 0x0022E802, 0x00232A04, 0x00232B04, 0x00232C04, 0x00235D04, 0x00237904,
+    0x0024D904, 0x0024DB04, 0x00250904, 0x00250B04, 0x00251004, 0x00256504, 0x00256704, 0x00257704, 0x00258D04, 0x0025B604, 0x0025C804, 0x00260604,
+    0x00260B04, 0x00262A04, 0x00262B04, 0x00262D04, 0x00263004, 0x00263304, 0x00269204, 0x0026BB04, 0x00272104, 0x00272204, 0x00274B02, 0x00274C02,
+    0x00280D04, 0x00281B04, 0x00285602, 0x00286A04, 0x0028CC02, 0x0028D304, 0x0028D704, 0x0029ED04, 0x0029EE04, 0x002B0D04, 0x002B4A04, 0x002B4C04,
+    0x002B4D04, 0x002B7B04, 0x002C0004, 0x002C3F02, 0x002C6606, 0x002C7F04, 0x002C9802, 0x002C9902, 0x002C9A02, 0x002C9B02, 0x002C9C02, 0x002CA202,
+    0x002CA604, 0x002CD904, 0x002E3004, 0x002E3504, 0x002E3704, 0x002E3F04, 0x002E9104, 0x002EBA04, 0x002EC004, 0x002EC104, 0x002EC204, 0x002EC704,
+    0x002ECA04, 0x002ECF04, 0x002ED104, 0x002ED404, 0x002ED504, 0x002F0A02, 0x002F1302, 0x002F1A04, 0x002F8704, 0x002F8A04, 0x002F9C04, 0x00300606,
+    0x00302302, 0x00304204, 0x0030B204, 0x0030B404, 0x0030B604, 0x0030B704, 0x0030B802, 0x0030C602, 0x0030F504, 0x0030FC04, 0x00310404, 0x00310504,
+    0x00310904, 0x00310B04, 0x00310D04, 0x00314304, 0x00315104, 0x00315204, 0x00316E03, 0x00318204, 0x00318304, 0x0031C104, 0x0031C304, 0x0031C604,
+    0x0031C804, 0x0031CC04, 0x00322E02, 0x00325404, 0x00325B04, 0x00329602, 0x0032AF03, 0x0032B602, 0x00335404, 0x0033CD04, 0x0033E104, 0x00340704,
+    0x00340A04, 0x00344004, 0x00345604, 0x0034A902, 0x00350B04, 0x00352804, 0x0035A104, 0x0035B104, 0x0035B404, 0x0035B602, 0x0035F102, 0x0035F202,
+    0x0035F406, 0x0035F502, 0x00363502, 0x00363604, 0x00364704, 0x00364B04, 0x00364C04, 0x00364D04, 0x0036CE04, 0x0036D204, 0x0036EE02, 0x00372502,
+    0x00375102, 0x00375C02, 0x00376D02, 0x00376E02, 0x00377804, 0x0037D904, 0x0039CD04, 0x003A1704, 0x003A2704, 0x003A3B04, 0x003A4206, 0x003A8702,
+    0x003ABD04, 0x003ABF04, 0x003AC004, 0x003AC304, 0x003AD704, 0x003AF104, 0x003AF304, 0x003AF704, 0x003AF804, 0x003B0D04, 0x003B7C04, 0x003B7E04,
+    0x003B8004, 0x003B8204, 0x003B8404, 0x003B8604, 0x003B8904, 0x003B8A04, 0x003B8B04, 0x003B8C04, 0x003B9104, 0x003B9504, 0x003B9604, 0x003BB602,
+    0x003BBA03, 0x003BC904, 0x003BCA04, 0x003C2F02, 0x003C5B04, 0x003C5D04, 0x003C7004, 0x003C7304, 0x003C7F02, 0x003C8904, 0x003C8A04, 0x003C8B04,
+    0x003C8C04, 0x003C8D04, 0x003C9104, 0x003CAA04, 0x003CAB04, 0x003CAC04, 0x003CB004, 0x003CB104, 0x003CB204, 0x003CBB04, 0x003CBC04, 0x003CBD04,
+    0x003CD204, 0x003CD604, 0x003CD704, 0x003CE304, 0x003CE404, 0x003CF504, 0x003CF704, 0x003CF904, 0x003CFA04, 0x003CFB04, 0x003CFC04, 0x003CFE04,
+    0x003D0004, 0x003D0204, 0x003D0304, 0x003D0404, 0x003D1B04, 0x003D2504, 0x003D2704, 0x003D2B04, 0x003D2D04, 0x003D3004, 0x003D3104, 0x003D3404,
+    0x003D4B04, 0x003D4C04, 0x003D7404, 0x003D7804, 0x003D7F04, 0x003D8004, 0x003DAF04, 0x003DB304, 0x003DB504, 0x003DB604, 0x003DB904, 0x003E6004,
+    0x003E6104, 0x003E6B04, 0x003E8004, 0x003E8604, 0x003EA104, 0x003EA204, 0x003EAE04, 0x003ECF04, 0x003EDE04, 0x003EE304, 0x003EE404, 0x003EE604,
+    0x003F2602, 0x003F2804, 0x003F3A04, 0x003F4402, 0x003F7304, 0x003F7904, 0x003F7A04, 0x003FD404, 0x003FDA04, 0x003FDE04, 0x003FE704, 0x00400604,
+    0x00402304, 0x00407004, 0x00407F06, 0x0040A804, 0x0040AA04, 0x0040B404, 0x0040B504, 0x0040BA04, 0x0040C004, 0x0040C704, 0x0040FB04, 0x00419204,
+    0x00419F04, 0x0041A304, 0x0041A404, 0x0041BB06, 0x0041CC04, 0x0041E002, 0x0041E204, 0x0041E404, 0x0041E602, 0x00421202, 0x00423502, 0x00423902,
+    0x00424E02, 0x00425302, 0x00426504, 0x0042A102, 0x0042BE04, 0x0042BF04, 0x0042C004, 0x0042C104, 0x0042C204, 0x0042C304, 0x0042C404, 0x0042C504,
+    0x0042C604, 0x0042C704, 0x0042C904, 0x0042F404, 0x0042F504, 0x0042F604, 0x0042F904, 0x0042FB04, 0x0042FD04, 0x00430504, 0x00430604, 0x00431204,
+    0x00431304, 0x00432A04, 0x00432B04, 0x00433304, 0x00434C04, 0x00435204, 0x00436506, 0x00437904, 0x00437A04, 0x00437D04, 0x00438704, 0x00438904,
+    0x00438A04, 0x00438E04, 0x0043B602, 0x0043C904, 0x0043D402, 0x0043D604, 0x0043F104, 0x0043F704, 0x00441A04, 0x00441B04, 0x00441F04, 0x00442504,
+    0x00443A04, 0x00445F04, 0x0044C802, 0x0044C902, 0x0044CA02, 0x0044CB02, 0x0044DF04, 0x00451904, 0x00454702, 0x00454B04, 0x00455104, 0x00456703,
+    0x0045D506, 0x0045DB04, 0x00461502, 0x00462A06, 0x0046B304, 0x0046E304, 0x0046F404, 0x0046F504, 0x00475E04, 0x0047AF04, 0x0047B004, 0x0047B104,
+    0x0047B204, 0x0047B304, 0x0047B404, 0x0047B504, 0x0047B604, 0x0047B704, 0x0047B804, 0x0047B904, 0x0047D804, 0x0047DF04, 0x00480004, 0x00480304,
+    0x00484302, 0x00484404, 0x00486C02, 0x00486F04, 0x00488104, 0x00488202, 0x00488404, 0x00488504, 0x00488604, 0x00488704, 0x00488804, 0x00488904,
+    0x00488A04, 0x00488B04, 0x00488C04, 0x00488D04, 0x00488E04, 0x00488F04, 0x00489004, 0x00489204, 0x00489304, 0x00489404, 0x00489504, 0x00489604,
+    0x00489704, 0x00489804, 0x00489904, 0x00489A04, 0x00489B04, 0x00489C04, 0x00489D04, 0x00489E04, 0x00489F04, 0x0048A004, 0x0048A104, 0x0048A204,
+    0x0048A304, 0x0048A404, 0x0048A504, 0x0048A604, 0x0048A704, 0x0048A804, 0x0048A904, 0x0048AA04, 0x0048AB04, 0x0048AC04, 0x0048AD04, 0x0048AE04,
+    0x0048AF04, 0x0048B104, 0x0048B304, 0x0048B404, 0x0048B504, 0x0048B604, 0x0048B704, 0x0048B804, 0x0048B904, 0x0048BA04, 0x0048BB04, 0x0048BC04,
+    0x0048BD04, 0x0048BE04, 0x0048BF04, 0x0048C004, 0x0048C104, 0x0048C204, 0x0048C304, 0x0048C404, 0x0048D904, 0x0048E704, 0x004A0004, 0x004A0E04,
+    0x004A1002, 0x004A2104, 0x004AB904, 0x004ABA04, 0x004ABD04, 0x004AC004, 0x004AFC04, 0x004B2403, 0x004B2504, 0x004B3F02, 0x004B4804, 0x004BBA02,
+    0x004BBB02, 0x004BBF04, 0x004BEA06, 0x004BFA04, 0x004BFC04, 0x004C0404, 0x004C0704, 0x004C1B02, 0x004C2904, 0x004C3102, 0x004C3904, 0x004C7602,
+    0x004C7902, 0x004C7D02, 0x004C8A01, 0x004C8C02, 0x004CA702, 0x004CAB04, 0x004CAC04, 0x004CAE04, 0x004CB504, 0x004CBF02, 0x004CCA02, 0x004CF204,
+    0x004CF504, 0x004D0004, 0x004D1004, 0x004D1104, 0x004D2602, 0x004D3704, 0x004D4404, 0x004D4504, 0x004D4904, 0x004D5604, 0x004D5902, 0x004D6304,
+    0x004D6804, 0x004DA602, 0x004DA702, 0x004DA802, 0x004DAA02, 0x004DAB02, 0x004DAC02, 0x004DAD02, 0x004E2601, 0x004E6202, 0x004EB906, 0x004EEB04,
+    0x004F0404, 0x004F0504, 0x004F1306, 0x004F2F06, 0x004F4604, 0x004F4704, 0x004F4804, 0x004F4904, 0x004F4A04, 0x004F4B04, 0x004FC404, 0x004FEF04,
+    0x004FF902, 0x004FFC05, 0x004FFF04, 0x00500304, 0x00500402, 0x00502F04, 0x00503404, 0x00503704, 0x00503804, 0x00503F04, 0x00505405, 0x00505504,
+    0x00505604, 0x00507A04, 0x00507B04, 0x00508002, 0x00508704, 0x00509304, 0x00509504, 0x00509604, 0x0050B104, 0x0050BB04, 0x0050C604, 0x0050D204,
+    0x0050D404, 0x0050D604, 0x0050D704, 0x0050D804, 0x0050DA04, 0x0050E302, 0x0050E702, 0x0050E804, 0x0050EC04, 0x0050ED04, 0x0050EF02, 0x0050F004,
+    0x00510002, 0x00510504, 0x00512E02, 0x00513304, 0x00513704, 0x00513804, 0x00513904, 0x00513A04, 0x00513D04, 0x00514004, 0x00514104, 0x00514204,
+    0x00514504, 0x00514604, 0x00514704, 0x00514804, 0x00514B04, 0x00514D04, 0x00514F04, 0x00515004, 0x00515304, 0x00515404, 0x00515504, 0x00515604,
+    0x00515704, 0x00515804, 0x00515904, 0x00515A04, 0x00515B04, 0x00515C04, 0x00515D04, 0x00515E04, 0x00515F04, 0x0051BD02, 0x00521004, 0x00522304,
+    0x00522604, 0x00523704, 0x00524304, 0x00524A04, 0x00524B04, 0x00524F04, 0x00525004, 0x00525104, 0x00525504, 0x00526A04, 0x00526B04, 0x00528C04,
+    0x00528D04, 0x00528F04, 0x00529004, 0x00529104, 0x00529204, 0x00529304, 0x0052A304, 0x0052A604, 0x0052B102, 0x0052BA02, 0x00535504, 0x00535D04,
+    0x00537904, 0x00539904, 0x00542D04, 0x00543A02, 0x0054A304, 0x0054A404, 0x0054A504, 0x0054B704, 0x0054F404, 0x0054F504, 0x00552F04, 0x00554804,
+    0x00556C04, 0x00559804, 0x0055D304, 0x00564804, 0x00566904, 0x0056BE04, 0x0056FB04, 0x0056FF04, 0x00570104, 0x00570304, 0x00571204, 0x00572804,
+    0x00574004, 0x00575304, 0x00575504, 0x00578B04, 0x00578E04, 0x00579304, 0x00579604, 0x00579704, 0x00579804, 0x00579904, 0x0057A104, 0x0057BC04,
+    0x0057D203, 0x0057E204, 0x0057F704, 0x00580B04, 0x00581F04, 0x00582004, 0x00582806, 0x00582A06, 0x00582F04, 0x00583604, 0x00584304, 0x00587204,
+    0x00587304, 0x00587504, 0x00588904, 0x00589504, 0x0058A604, 0x0058AB04, 0x0058AF06, 0x0058B504, 0x0058D704, 0x0058DA04, 0x00591C02, 0x00593A01,
+    0x00595E04, 0x00596504, 0x00596704, 0x00596D04, 0x00597B04, 0x00598804, 0x00598C04, 0x00599904, 0x00599A04, 0x00599C04, 0x0059A104, 0x0059BC04,
+    0x0059BF04, 0x0059C004, 0x0059C104, 0x0059C204, 0x0059C304, 0x0059C404, 0x0059C504, 0x0059C604, 0x0059C704, 0x0059C804, 0x0059C904, 0x0059E304,
+    0x0059FE04, 0x0059FF04, 0x005A2104, 0x005A3E04, 0x005A4004, 0x005A4104, 0x005A4204, 0x005A4904, 0x005A4A04, 0x005A4B04, 0x005A7902, 0x005A9304,
+    0x005A9504, 0x005AA604, 0x005AE504, 0x005AEB04, 0x005AEE04, 0x005B0C04, 0x005B0D04, 0x005B2304, 0x005B2904, 0x005B2B04, 0x005B2D04, 0x005B4404,
+    0x005B5304, 0x005B5404, 0x005B5F04, 0x005B6004, 0x005B7304, 0x005B7404, 0x005B7504, 0x005B9F02, 0x005BA504, 0x005BA604, 0x005BD004, 0x005BD804,
+    0x005BDD02, 0x005C1C04, 0x005C8A02, 0x005CAA04, 0x005D3204, 0x005D4906, 0x005D6E04, 0x005D7002, 0x005D7206, 0x005D7B04, 0x005DA204, 0x005DA404,
+    0x005DCB04, 0x005DD404, 0x005DD804, 0x005DF204, 0x005E2304, 0x005E3004, 0x005E3501, 0x005E8004, 0x005ED306, 0x005F0E04, 0x005F1404, 0x005F3604,
+    0x005F4A02, 0x005F6702, 0x005F8202, 0x005F8A04, 0x00601002, 0x00602304, 0x00602404, 0x00602804, 0x00604904, 0x00605C04, 0x00605F04, 0x00606804,
+    0x00606A04, 0x00606B04, 0x00606D04, 0x00606F04, 0x00607004, 0x00607A04, 0x0060BF04, 0x0060F304, 0x0060F404, 0x0060F504, 0x0060F604, 0x0060F704,
+    0x0060FA04, 0x00610304, 0x00610404, 0x00610504, 0x00610604, 0x00610704, 0x00611904, 0x00611A02, 0x00616E04, 0x00617D04, 0x0061BD04, 0x0061C104,
+    0x0061C604, 0x0061C704, 0x0061C904, 0x0061CA04, 0x0061D904, 0x0061DC04, 0x0061DD04, 0x0061DE04, 0x0061DF04, 0x00625204, 0x00626404, 0x0062AE04,
+    0x0062EA04, 0x00632704, 0x00635004, 0x00635104, 0x00639904, 0x0063A006, 0x0063F204, 0x00643304, 0x00643604, 0x00644804, 0x00644F04, 0x00646304,
+    0x00648F04, 0x00649004, 0x00649404, 0x00649504, 0x00649C04, 0x0064AB02, 0x0064B402, 0x0064B501, 0x0064D304, 0x0064D404, 0x0064DB04, 0x00653806,
+    0x00653A02, 0x00658704, 0x00658904, 0x00659604, 0x0065A702, 0x0065C004, 0x0065C404, 0x0065CB04, 0x0065D002, 0x0065D904, 0x0065ED04, 0x0065F204,
+    0x0065F604, 0x0065F704, 0x00661604, 0x00661D04, 0x00665004, 0x00665204, 0x00666304, 0x00667904, 0x0066AA04, 0x0066E304, 0x00675A04, 0x0067B204,
+    0x0067B604, 0x0067BA04, 0x0067BB04, 0x0067BD01, 0x0067BE04, 0x0067CD02, 0x0067E904, 0x0067FE04, 0x0067FF04, 0x00680004, 0x00680104, 0x00681304,
+    0x00681904, 0x00683702, 0x00683E04, 0x00695F01, 0x00696001, 0x006A6B02, 0x006A9506, 0x006A9604, 0x006ACA04, 0x006AF704, 0x006BA204, 0x006BA504,
+    0x006BAF04, 0x006BB806, 0x006BC004, 0x006BDB04, 0x006BDD04, 0x006BE404, 0x006BF104, 0x006BF305, 0x006BFE04, 0x006C9002, 0x006C9302, 0x006C9F04,
+    0x006CA404, 0x006CAC01, 0x006CB302, 0x006CB704, 0x006CF304, 0x006D0F04, 0x006D3D02, 0x006D5404, 0x006D5504, 0x006D9E01, 0x006DB501, 0x006E0704,
+    0x006E6D04, 0x006E6F02, 0x006E7002, 0x006E8504, 0x006EA204, 0x006EB504, 0x006EC604, 0x006EC904, 0x006ED601, 0x006EF704, 0x006F1104, 0x006F2004,
+    0x006F2204, 0x006F2B04, 0x006F3E04, 0x006F3F05, 0x006F6A01, 0x006FB704, 0x00704504, 0x00707C04, 0x00708601, 0x0070D205, 0x0070D304, 0x0070D404,
+    0x0070E404, 0x00714104, 0x0071B204, 0x0071D601, 0x0071D802, 0x0071DC04, 0x0071EE02, 0x00720001, 0x00720101, 0x00720A01, 0x00720B01, 0x00720C01,
+    0x00720D01, 0x00720E01, 0x00720F01, 0x00721101, 0x00722504, 0x00728504, 0x00729D02, 0x0072BB01, 0x0072CA04, 0x0072F104, 0x0072FD01, 0x00732504,
+    0x00732F04, 0x00733804, 0x00734804, 0x00734A04, 0x00735204, 0x00737804, 0x00737B04, 0x00738704, 0x00738B04, 0x00738E04, 0x00739204, 0x0073A904,
+    0x0073B204, 0x0073E204, 0x0073EC04, 0x0073ED04, 0x0073F004, 0x0073F404, 0x00740F04, 0x00741004, 0x00741504, 0x00741A06, 0x00741D02, 0x00744504,
+    0x00744605, 0x00747704, 0x00748E02, 0x00749904, 0x0074A202, 0x0074A804, 0x0074B701, 0x0074BD04, 0x0074BE02, 0x0074C502, 0x0074D004, 0x0074D104,
+    0x0074E204, 0x0074E304, 0x0074E404, 0x0074E504, 0x0074E604, 0x0074E704, 0x0074E804, 0x0074F304, 0x0074FD04, 0x00750104, 0x00750204, 0x00750404,
+    0x00750505, 0x00750604, 0x00750704, 0x00750D01, 0x00751504, 0x00751A05, 0x00755A02, 0x00755B04, 0x00756204, 0x00756704, 0x00758B04, 0x00758C04,
+    0x00758E04, 0x00758F04, 0x00759004, 0x00759C02, 0x00759D04, 0x00759F04, 0x0075BA04, 0x0075C202, 0x0075C702, 0x0075C906, 0x0075E404, 0x00760204,
+    0x00760506, 0x00760A04, 0x00761B04, 0x00763A04, 0x00763B04, 0x00764A04, 0x00764B02, 0x00769204, 0x0076AF04, 0x0076F102, 0x0076F306, 0x0076F702,
+    0x0076FC04, 0x00772E04, 0x00774604, 0x00778705, 0x00778804, 0x00778D04, 0x00778E04, 0x00778F04, 0x00779004, 0x00779104, 0x0077A004, 0x0077A904,
+    0x0077DE04, 0x0077E004, 0x0077E304, 0x0077E901, 0x00788C05, 0x0078A402, 0x0078C504, 0x0078CE04, 0x0078CF04, 0x0078D204, 0x0078DD04, 0x0078DE04,
+    0x0078DF04, 0x0078F704, 0x0078FB04, 0x00790304, 0x00790D04, 0x00798D02, 0x0079E902, 0x0079F702, 0x0079F802, 0x0079FE02, 0x0079FF02, 0x007A1104,
+    0x007A1204, 0x007A1E04, 0x007A1F04, 0x007A2604, 0x007A3104, 0x007A3304, 0x007A4004, 0x007A4604, 0x007A4701, 0x007A6204, 0x007AA904, 0x007AC104,
+    0x007ACC04, 0x007AD504, 0x007AE701, 0x007AF004, 0x007AF104, 0x007AF304, 0x007AF604, 0x007AFE04, 0x007B1C04, 0x007B6502, 0x007B7804, 0x007B8003,
+    0x007B8204, 0x007B8404, 0x007B8604, 0x007B8B04, 0x007BAD06, 0x007BB004, 0x007BB102, 0x007BC702, 0x007BC804, 0x007BDB06, 0x007BE401, 0x007BE504,
+    0x007BEB01, 0x007BFC04, 0x007BFF04, 0x007C0C04, 0x007C0E04, 0x007C0F04, 0x007C1404, 0x007C2804, 0x007C3C04, 0x007C4D02, 0x007C6A02, 0x007C8C02,
+    0x007CAA04, 0x007CBF06, 0x007CD901, 0x007CDA04, 0x007CDC04, 0x007CE105, 0x007CE304, 0x007CF005, 0x007D0E04, 0x007D1A04, 0x007D4F04, 0x007D5D04,
+    0x007D6704, 0x007D6E04, 0x007D6F04, 0x007D8404, 0x007D8504, 0x007DA704, 0x007DA804, 0x007DAF06, 0x007DB006, 0x007DB602, 0x007DBE04, 0x007DC004,
+    0x007DC104, 0x007DCA04, 0x007DE004, 0x007DE902, 0x007DF804, 0x007E0A02, 0x007E0B02, 0x007E0C02, 0x007E0E02, 0x007E0F02, 0x007E1002, 0x007E2E04,
+    0x007E3504, 0x007E4704, 0x007E4804, 0x007E4A04, 0x007E5104, 0x007E6C04, 0x007E6D04, 0x007E7104, 0x007E7204, 0x007E7702, 0x007E7B06, 0x007E8402,
+    0x007E9701, 0x007E9903, 0x007E9E04, 0x007E9F04, 0x007EA604, 0x007EBD04, 0x007EEB04, 0x007EEC04, 0x007F2202, 0x007F2A01, 0x007F5002, 0x007F6402,
+    0x007F6604, 0x007F8506, 0x007F9A04, 0x007FA504, 0x007FB204, 0x007FC304, 0x007FC704, 0x007FDF04, 0x007FE304, 0x007FE504, 0x007FE604, 0x007FEB02,
+    0x007FF002, 0x00800404, 0x00800604, 0x00800A04, 0x00804302, 0x00804E04, 0x00805C04, 0x00808704, 0x00809204, 0x00809504, 0x0080A704, 0x0080B604,
+    0x0080C304, 0x0080C704, 0x0080C904, 0x0080D804, 0x00811704, 0x00811B01, 0x00812504, 0x00813402, 0x00815602, 0x00819704, 0x0081B602, 0x0081D504,
+    0x00827302, 0x00828904, 0x0082AC04, 0x0082B604, 0x0082B704, 0x0082DD04, 0x0082F604, 0x0082F704, 0x0082F804, 0x0082F904, 0x0082FE04, 0x00831104,
+    0x00831204, 0x00835303, 0x00835404, 0x00835704, 0x00836004, 0x00836B04, 0x00837301, 0x00837904, 0x00838104, 0x00838701, 0x00839A02, 0x00839B02,
+    0x0083AB04, 0x0083C002, 0x0083D606, 0x0083DD02, 0x0083EF04, 0x0083F202, 0x0083FA02, 0x00840004, 0x00840104, 0x00840204, 0x00842001, 0x00842904,
+    0x00842C01, 0x00843104, 0x00843604, 0x00844404, 0x00844F04, 0x00846302, 0x00847B01, 0x00847D06, 0x00849702, 0x0084A704, 0x0084AF04, 0x0084B204,
+    0x0084B304, 0x0084B704, 0x0084C504, 0x0084EA02, 0x0084F704, 0x00851804, 0x00852304, 0x00853F04, 0x00855202, 0x00855501, 0x00855F02, 0x00856102,
+    0x00857404, 0x0085B804, 0x0085BA04, 0x0085DC04, 0x0085DD05, 0x0085DE01, 0x0085DF01, 0x0085E001, 0x0085E101, 0x0085E201, 0x0085E301, 0x0085E401,
+    0x0085E501, 0x0085E601, 0x0085E701, 0x0085E801, 0x0085E901, 0x0085EA01, 0x0085EB01, 0x0085EC01, 0x0085ED01, 0x0085EE01, 0x0085EF01, 0x0085F001,
+    0x0085F101, 0x0085F204, 0x00860A01, 0x00860B01, 0x00860C01, 0x00862501, 0x00862804, 0x00862904, 0x00862A04, 0x00862B04, 0x00862C04, 0x00863004,
+    0x00863104, 0x00863204, 0x00863704, 0x00863B04, 0x00867C06, 0x00868102, 0x00868F04, 0x0086D504, 0x0086E004, 0x00873A04, 0x00875104, 0x00875504,
+    0x00875D04, 0x00876405, 0x00877004, 0x00878701, 0x00879B04, 0x0087B904, 0x0087C604, 0x0087DC04, 0x0087E104, 0x0087E704, 0x0087E904, 0x0087ED04,
+    0x0087EE04, 0x0087F204, 0x00880404, 0x00880804, 0x00880C01, 0x00880D04, 0x00882804, 0x00882D02, 0x00885602, 0x00886206, 0x00887504, 0x00887604,
+    0x00887C04, 0x00888004, 0x0088C204, 0x0088C404, 0x0088C604, 0x0088C704, 0x0088DA04, 0x0088E004, 0x0088F304, 0x00890004, 0x00890702, 0x00892204,
+    0x00892404, 0x00893404, 0x00893C04, 0x00894301, 0x00895004, 0x00896A04, 0x00896D05, 0x0089A404, 0x0089AB04, 0x0089B204, 0x0089B704, 0x0089BD04,
+    0x0089BE04, 0x0089C304, 0x0089CC04, 0x0089D304, 0x0089F001, 0x0089F204, 0x0089F404, 0x0089F604, 0x0089F805, 0x008A0604, 0x008A1202, 0x008A1704,
+    0x008A1A01, 0x008A2D04, 0x008A3104, 0x008A4306, 0x008A4904, 0x008A8E04, 0x008A9E04, 0x008AAB04, 0x008ADA02, 0x008ADF02, 0x008B8302, 0x008B8502,
+    0x008B8602, 0x008B9102, 0x008B9704, 0x008BAF04, 0x008BB705, 0x008C0504, 0x008C0D04, 0x008C2104, 0x008C3304, 0x008C3704, 0x008C4904, 0x008C5004,
+    0x008C5504, 0x008C5704, 0x008C6A04, 0x008C7401, 0x008CC002, 0x008CC104, 0x008CC804, 0x008CD905, 0x008D3404, 0x008D3804, 0x008D5004, 0x008D5304,
+    0x008D7502, 0x008D7604, 0x008D8104, 0x008D8304, 0x008D8404, 0x008D8E04, 0x008D9704, 0x008D9904, 0x008D9C04, 0x008D9F04, 0x008DB304, 0x008DB504,
+    0x008DB604, 0x008DB704, 0x008DD701, 0x008E3404, 0x008E3F01, 0x008E4001, 0x008E4101, 0x008E6101, 0x008E7604, 0x008E8904, 0x008E9404, 0x008EB504,
+    0x008EB604, 0x008ECA02, 0x008ED302, 0x008EE401, 0x008EF204, 0x008EFF04, 0x008F0004, 0x008F0104, 0x008F0B04, 0x008F0F04, 0x008F1104, 0x008F1304,
+    0x008F1E04, 0x008F2504, 0x008F2704, 0x008F2E04, 0x008F3601, 0x008F6104, 0x008F6204, 0x008F6604, 0x008F6704, 0x008F6804, 0x008F6904, 0x008F6A04,
+    0x008F6D04, 0x008F7204, 0x008F7B04, 0x008F8004, 0x008F8204, 0x008F8404, 0x008F8504, 0x008F8604, 0x008F8704, 0x008FB204, 0x008FC704, 0x008FD404,
+    0x008FD601, 0x008FDB04, 0x008FE504, 0x008FE904, 0x008FFE04, 0x00900004, 0x00900404, 0x00900C04, 0x00901B04, 0x00901E04, 0x00902904, 0x00902A04,
+    0x00903304, 0x00903804, 0x00903904, 0x00905304, 0x00906A04, 0x00906B04, 0x00906C04, 0x00907404, 0x00907904, 0x00907A04, 0x00907B04, 0x00907D04,
+    0x00907E04, 0x0090C401, 0x0090D604, 0x0090E104, 0x0090EE04, 0x0090F204, 0x0090F504, 0x0090F704, 0x00910304, 0x00910604, 0x00910904, 0x00910C04,
+    0x00910D04, 0x00912504, 0x00912604, 0x00912904, 0x00918204, 0x00918304, 0x00918704, 0x00918A04, 0x00918B04, 0x00918D04, 0x00918E04, 0x00919104,
+    0x00919304, 0x00919704, 0x00919804, 0x00919904, 0x0091A401, 0x0091A904, 0x0091C704, 0x0091D004, 0x0091D104, 0x0091D404, 0x0091F104, 0x0091FB04,
+    0x0091FC04, 0x00920601, 0x00921E01, 0x00921F01, 0x00922501, 0x00922601, 0x00922801, 0x00923301, 0x00923401, 0x00923801, 0x00923A01, 0x00924D01,
+    0x00924E01, 0x00924F01, 0x00925001, 0x00925301, 0x00925501, 0x00925601, 0x00925701, 0x00925901, 0x00925D01, 0x00925F01, 0x00926001, 0x00926201,
+    0x00926401, 0x00927004, 0x00927A01, 0x00927E01, 0x00929B04, 0x0092B501, 0x0092BF01, 0x0092F501, 0x0092FC04, 0x0092FD04, 0x00930604, 0x00932004,
+    0x00932104, 0x00932304, 0x00932404, 0x00932504, 0x00932804, 0x00932B04, 0x00936204, 0x00936604, 0x00938404, 0x00938F01, 0x0093C001, 0x0093CF04,
+    0x0093D104, 0x0093D602, 0x0093DC01, 0x0093E004, 0x0093E604, 0x0093E804, 0x0093E904, 0x00942A04, 0x00943804, 0x00943904, 0x00944E04, 0x00946101,
+    0x00946604, 0x00946D04, 0x00948E04, 0x00949004, 0x00949104, 0x00949B04, 0x0094A404, 0x0094AA04, 0x0094B004, 0x0094C504, 0x0094CE04, 0x0094DD04,
+    0x0094DE04, 0x0094E104, 0x0094F704, 0x0094F804, 0x0094FA04, 0x0094FD04, 0x0094FE04, 0x0094FF04, 0x00950204, 0x00950304, 0x00950604, 0x00952704,
+    0x00953104, 0x00953504, 0x00953C04, 0x00953D04, 0x00955904, 0x00955A04, 0x00955D04, 0x00955E04, 0x00955F04, 0x00956D04, 0x00957304, 0x00957804,
+    0x00959804, 0x0095A505, 0x0095C404, 0x0095D204, 0x0095DF04, 0x0095E004, 0x0095E104, 0x0095E404, 0x0095EA04, 0x0095EE04, 0x0095F004, 0x0095F204,
+    0x0095F704, 0x0095FB01, 0x00960104, 0x00961C01, 0x00962D04, 0x00963B04, 0x00964104, 0x00964404, 0x00964804, 0x00966004, 0x00966204, 0x00966D04,
+    0x00967C04, 0x00968504, 0x00968604, 0x00968704, 0x00968804, 0x00968904, 0x00968B04, 0x0096AE01, 0x0096AF01, 0x0096B604, 0x0096B804, 0x0096B904,
+    0x0096BD04, 0x0096C104, 0x0096E104, 0x0096E404, 0x0096E904, 0x0096EA04, 0x0096EC04, 0x0096F104, 0x0096F404, 0x0096F504, 0x0096FF04, 0x00973804,
+    0x00974304, 0x00974504, 0x00974804, 0x00974D04, 0x00976D04, 0x00977F04, 0x00978D04, 0x00979604, 0x00979704, 0x00979804, 0x00979904, 0x00979B04,
+    0x00979D04, 0x00979E04, 0x0097A301, 0x0097A704, 0x0097A804, 0x0097A904, 0x0097AA04, 0x0097AB04, 0x0097AD04, 0x0097AF04, 0x0097B304, 0x0097B404,
+    0x0097B504, 0x0097B604, 0x0097B704, 0x0097B804, 0x0097BB04, 0x0097BD04, 0x0097C104, 0x0097C404, 0x0097CA04, 0x0097CF04, 0x0097E104, 0x0097E604,
+    0x0097EC04, 0x0097ED04, 0x0097F104, 0x0097F704, 0x0097F804, 0x00980004, 0x00980C04, 0x00981204, 0x00981604, 0x00981704, 0x00981804, 0x00981C04,
+    0x00981D04, 0x00983704, 0x00983D04, 0x00983E04, 0x00984C01, 0x00984D01, 0x00984E01, 0x00985704, 0x00985904, 0x00985E04, 0x00986804, 0x00986E04,
+    0x00986F04, 0x00987104, 0x00987204, 0x00987404, 0x00987904, 0x00987B04, 0x00987C04, 0x00987D04, 0x00987E04, 0x00987F04, 0x00988201, 0x00988904,
+    0x00988E04, 0x00989005, 0x00989204, 0x00989404, 0x00989604, 0x00989704, 0x00989804, 0x00989904, 0x00989A04, 0x0098A704, 0x0098AA04, 0x0098AB04,
+    0x0098B201, 0x0098B501, 0x0098D004, 0x0098D104, 0x0098D804, 0x0098D904, 0x0098DC05, 0x0098DD04, 0x0098E204, 0x0098E304, 0x00990704, 0x00991804,
+    0x00992404, 0x00993501, 0x00995404, 0x00995F04, 0x00996201, 0x00996304, 0x00998104, 0x00998201, 0x00998D04, 0x0099A104, 0x0099A904, 0x0099AC04,
+    0x0099B404, 0x0099B504, 0x0099C504, 0x0099C901, 0x0099CD01, 0x0099D801, 0x0099D904, 0x0099F604, 0x0099FB04, 0x009A0504, 0x009A1904, 0x009A6904,
+    0x009A9C04, 0x009AA304, 0x009AA604, 0x009AA804, 0x009AA904, 0x009ABA02, 0x009ACF04, 0x009AD004, 0x009B8104, 0x009BA201, 0x009BC601, 0x009BD902,
+    0x009C0904, 0x009C2001, 0x009C7E04, 0x009C8004, 0x009C8101, 0x009C8604, 0x009C8E04, 0x009C9204, 0x009C9304, 0x009C9804, 0x009C9904, 0x009C9F04,
+    0x009CA004, 0x009CA704, 0x009CB802, 0x009CBC04, 0x009CF904, 0x009D4905, 0x009D7D04, 0x009D9804, 0x009DC804, 0x009DDD04, 0x009DE404, 0x009DE804,
+    0x009DE904, 0x009DEC04, 0x009DED04, 0x009DEE04, 0x009DF104, 0x009E3004, 0x009E3C04, 0x009E5804, 0x009E6A04, 0x009E7204, 0x009E9004, 0x009E9104,
+    0x009E9305, 0x009E9501, 0x009E9701, 0x009EB701, 0x009EB904, 0x009EE004, 0x009F0E05, 0x009F0F04, 0x009F1104, 0x009F2004, 0x009F6A04, 0x009F7B04,
+    0x009F8401, 0x009F8B04, 0x009FA705, 0x009FA904, 0x009FAC04, 0x009FAD04, 0x009FAE04, 0x009FC205, 0x009FE904, 0x009FEB04, 0x00A01004, 0x00A06704,
+    0x00A06B05, 0x00A06D04, 0x00A07404, 0x00A08504, 0x00A09B04, 0x00A09C04, 0x00A0D104, 0x00A0D404, 0x00A0D904, 0x00A0DC04, 0x00A0DF04, 0x00A0E004,
+    0x00A0E404, 0x00A0EB04, 0x00A0ED04, 0x00A10D04, 0x00A11D04, 0x00A13104, 0x00A13C04, 0x00A14004, 0x00A14204, 0x00A17E01, 0x00A17F01, 0x00A18001,
+    0x00A18801, 0x00A18904, 0x00A18C04, 0x00A18D04, 0x00A19804, 0x00A19A04, 0x00A19E04, 0x00A19F04, 0x00A1A101, 0x00A1A304, 0x00A1A404, 0x00A1A704,
+    0x00A1A804, 0x00A1B304, 0x00A1D102, 0x00A1D201, 0x00A1DE04, 0x00A1E004, 0x00A1E404, 0x00A1E504, 0x00A1FE04, 0x00A1FF04, 0x00A20004, 0x00A20904,
+    0x00A20B04, 0x00A20C04, 0x00A20E04, 0x00A20F01, 0x00A23404, 0x00A26404, 0x00A26A04, 0x00A27C04, 0x00A2A302, 0x00A3E504, 0x00A3E604, 0x00A3E804,
+    0x00A3FE04, 0x00A40004, 0x00A41A02, 0x00A42804, 0x00A49B04, 0x00A4EF06, 0x00A51E05, 0x00A57A04, 0x00A58404, 0x00A58D01, 0x00A58E04, 0x00A59004,
+    0x00A5C101, 0x00A5C904, 0x00A5EB04, 0x00A5EC04, 0x00A60604, 0x00A65304, 0x00A65404, 0x00A68601, 0x00A68701, 0x00A69A02, 0x00A69B02, 0x00A6DF04,
+    0x00A72304, 0x00A74D04, 0x00A77604, 0x00A7CB02, 0x00A7CC02, 0x00A84B04, 0x00A86B01, 0x00A87C04, 0x00A88E04, 0x00A8CF04, 0x00A90102, 0x00A90304,
+    0x00A90404, 0x00A91E04, 0x00A92304, 0x00A93D04, 0x00A94204, 0x00A99504, 0x00A9A204, 0x00A9A304, 0x00A9A404, 0x00A9AB04, 0x00A9AD01, 0x00A9C904,
+    0x00A9F604, 0x00AA1704, 0x00AA2A04, 0x00AA3001, 0x00AA3101, 0x00AA3801, 0x00AA3B04, 0x00AA3E04, 0x00AA3F04, 0x00AA4004, 0x00AA6304, 0x00AA8104,
+    0x00AA9304, 0x00AAED04, 0x00AB1A04, 0x00AB3504, 0x00AB3E01, 0x00AB7F04, 0x00AB9804, 0x00AB9A04, 0x00ABD302, 0x00ABD402, 0x00ABD706, 0x00ABE504,
+    0x00AC0104, 0x00AC3902, 0x00AC5804, 0x00AC8404, 0x00AC9004, 0x00AC9104, 0x00AC9B04, 0x00AC9C04, 0x00AC9E04, 0x00ACA701, 0x00ACEB04, 0x00ACFE04,
+    0x00AD1A04, 0x00AD1E04, 0x00AD1F04, 0x00AD8104, 0x00AD8204, 0x00AD8906, 0x00ADA002, 0x00ADA902, 0x00ADAD06, 0x00ADBD04, 0x00ADD704, 0x00ADD804,
+    0x00ADE604, 0x00ADE704, 0x00ADF804, 0x00ADFA04, 0x00AE0002, 0x00AE3E04, 0x00AE4602, 0x00AE6004, 0x00AEFF04, 0x00AF2B04, 0x00AF2C04, 0x00AF4201,
+    0x00AF9506, 0x00AF9D04, 0x00AFA104, 0x00AFA604, 0x00AFDA04, 0x00AFE704, 0x00AFEA01, 0x00B00904, 0x00B01001, 0x00B03B01, 0x00B04204, 0x00B05902,
+    0x00B07D02, 0x00B07E02, 0x00B0B004, 0x00B0BA02, 0x00B0BB02, 0x00B0D604, 0x00B0E406, 0x00B0F106, 0x00B11104, 0x00B11602, 0x00B11804, 0x00B12101,
+    0x00B12301, 0x00B12401, 0x00B15B01, 0x00B17E03, 0x00B19E03, 0x00B1D402, 0x00B20A04, 0x00B20C04, 0x00B24401, 0x00B26004, 0x00B2B201, 0x00B2B404,
+    0x00B2C804, 0x00B2CA04, 0x00B2D304, 0x00B34C04, 0x00B34E06, 0x00B35104, 0x00B35204, 0x00B39401, 0x00B3D304, 0x00B3DA04, 0x00B3DB04, 0x00B41504,
+    0x00B44604, 0x00B45304, 0x00B46404, 0x00B46D04, 0x00B46F04, 0x00B47204, 0x00B4C704, 0x00B52C04, 0x00B52D04, 0x00B57904, 0x00B59004, 0x00B59104,
+    0x00B5D704, 0x00B5D904, 0x00B5DB04, 0x00B5E404, 0x00B5F001, 0x00B5F802, 0x00B5F902, 0x00B61004, 0x00B63801, 0x00B6AA04, 0x00B6B304, 0x00B74502,
+    0x00B74C02, 0x00B77806, 0x00B78804, 0x00B78B04, 0x00B78C04, 0x00B79904, 0x00B7DF04, 0x00B7E004, 0x00B7E204, 0x00B7E404, 0x00B7E504, 0x00B7E904,
+    0x00B89004, 0x00B89304, 0x00B96C02, 0x00B97402, 0x00B97902, 0x00B97A02, 0x00B97C02, 0x00B99B02, 0x00B9A802, 0x00B9B002, 0x00B9B402, 0x00B9B502,
+    0x00B9D002, 0x00B9E103, 0x00BA0D04, 0x00BA1006, 0x00BA1102, 0x00BA3206, 0x00BA5104, 0x00BA6B04, 0x00BA8602, 0x00BA8704, 0x00BA8902, 0x00BA8B03,
+    0x00BA8D02, 0x00BA8E02, 0x00BA9D04, 0x00BAAC02, 0x00BB9202, 0x00BB9402, 0x00BBE004, 0x00BBEB02, 0x00BBEC02, 0x00BC0404, 0x00BC0C04, 0x00BC1901,
+    0x00BC3304, 0x00BC3506, 0x00BC7604, 0x00BC9A04, 0x00BC9B04, 0x00BCFB05, 0x00BD2704, 0x00BD3602, 0x00BD6402, 0x00BD8502, 0x00BD8602, 0x00BDA404,
+    0x00BDEB04, 0x00BDF502, 0x00BE3A04, 0x00BE3B04, 0x00BE4302, 0x00BE6703, 0x00BE8A02, 0x00BE8F04, 0x00BE9802, 0x00BED604, 0x00BEFF04, 0x00BF7C02,
+    0x00BF8402, 0x00BF8F02, 0x00BFBC04, 0x00BFC003, 0x00BFC204, 0x00BFC304, 0x00BFD604, 0x00BFD704, 0x00BFD904, 0x00BFF702, 0x00C00904, 0x00C02006,
+    0x00C03504, 0x00C03602, 0x00C05904, 0x00C0A504, 0x00C0CA04, 0x00C0CE02, 0x00C0CF02, 0x00C0D002, 0x00C0D102, 0x00C0D202, 0x00C0D302, 0x00C0D604,
+    0x00C0E002, 0x00C10A04, 0x00C12E04, 0x00C14304, 0x00C16804, 0x00C17A02, 0x00C18104, 0x00C18D04, 0x00C1A702, 0x00C1A802, 0x00C1F804, 0x00C22004,
+    0x00C22F04, 0x00C23304, 0x00C23404, 0x00C26001, 0x00C2B201, 0x00C2C704, 0x00C2DB01, 0x00C2DC05, 0x00C2F204, 0x00C32E06, 0x00C34E06, 0x00C3A604,
+    0x00C3AC04, 0x00C3B404, 0x00C3BB04, 0x00C40704, 0x00C41604, 0x00C41B01, 0x00C43804, 0x00C44502, 0x00C45302, 0x00C46104, 0x00C46D02, 0x00C46E02,
+    0x00C47E04, 0x00C49202, 0x00C49E02, 0x00C4DD02, 0x00C4E106, 0x00C50102, 0x00C51704, 0x00C52002, 0x00C55302, 0x00C55904, 0x00C55A04, 0x00C57104,
+    0x00C59204, 0x00C59C04, 0x00C5BE06, 0x00C5DD04, 0x00C60E04, 0x00C61104, 0x00C61302, 0x00C62104, 0x00C63404, 0x00C64004, 0x00C64704, 0x00C65102,
+    0x00C66104, 0x00C66F01, 0x00C67404, 0x00C67B01, 0x00C68E04, 0x00C69004, 0x00C69604, 0x00C69A06, 0x00C69B04, 0x00C6A504, 0x00C6A604, 0x00C72102,
+    0x00C72D01, 0x00C72E01, 0x00C73504, 0x00C74D04, 0x00C76C02, 0x00C78104, 0x00C79F04, 0x00C7A604, 0x00C7B402, 0x00C7B802, 0x00C7C804, 0x00C7D104,
+    0x00C81204, 0x00C81304, 0x00C82B04, 0x00C83201, 0x00C84702, 0x00C85402, 0x00C85704, 0x00C88604, 0x00C88904, 0x00C88B04, 0x00C8A304, 0x00C8C702,
+    0x00C8DE01, 0x00C8E804, 0x00C90402, 0x00C90602, 0x00C91D02, 0x00C92206, 0x00C93102, 0x00C93A02, 0x00C94D02, 0x00C96C02, 0x00C98304, 0x00C98404,
+    0x00C99804, 0x00C99904, 0x00C9A204, 0x00C9B502, 0x00C9EA02, 0x00C9F302, 0x00CA0202, 0x00CA0B06, 0x00CA0D04, 0x00CA2704, 0x00CA3804, 0x00CA4704,
+    0x00CA4904, 0x00CA5504, 0x00CA5E04, 0x00CA6904, 0x00CA6A04, 0x00CA6C04, 0x00CA7604, 0x00CAA704, 0x00CAAE02, 0x00CABA04, 0x00CAC202, 0x00CAFB06,
+    0x00CB1202, 0x00CB4A02, 0x00CB8905, 0x00CB9F02, 0x00CBA003, 0x00CBB204, 0x00CBB602, 0x00CBCE06, 0x00CBF406, 0x00CC2104, 0x00CC2D04, 0x00CC3A04,
+    0x00CC7504, 0x00CC9F04, 0x00CCBB04, 0x00CCD104, 0x00CCD502, 0x00CCDD04, 0x00CD0C04, 0x00CD0D04, 0x00CD1504, 0x00CD1604, 0x00CD2E04, 0x00CD3304,
+    0x00CD3604, 0x00CD3704, 0x00CD5604, 0x00CD7004, 0x00CD8202, 0x00CDBF04, 0x00CDE104, 0x00CDF204, 0x00CE0704, 0x00CE0F02, 0x00CE1204, 0x00CE1604,
+    0x00CE1904, 0x00CE1C04, 0x00CE4704, 0x00CE4C04, 0x00CE5204, 0x00CE6404, 0x00CE8604, 0x00CEBC01, 0x00CEBE04, 0x00CEC304, 0x00CECE01, 0x00CECF04,
+    0x00CED004, 0x00CEED04, 0x00CF2901, 0x00CF3304, 0x00CF3404, 0x00CF3B04, 0x00CF5004, 0x00CF5E04, 0x00CF7904, 0x00CF7F01, 0x00CF9402, 0x00CF9502,
+    0x00CF9602, 0x00CF9C02, 0x00CFA802, 0x00CFAF04, 0x00CFD902, 0x00CFF602, 0x00D00502, 0x00D01602, 0x00D01702, 0x00D04204, 0x00D04604, 0x00D04F04,
+    0x00D05404, 0x00D05504, 0x00D05F02, 0x00D06002, 0x00D06706, 0x00D06903, 0x00D07304, 0x00D07503, 0x00D08002, 0x00D08906, 0x00D08E02, 0x00D09204,
+    0x00D09502, 0x00D09602, 0x00D0B402, 0x00D0C102, 0x00D0E602, 0x00D0E802, 0x00D0EA02, 0x00D0F202, 0x00D0F504, 0x00D0F902, 0x00D0FA04, 0x00D10001,
+    0x00D13B02, 0x00D14802, 0x00D15B06, 0x00D16006, 0x00D17004, 0x00D17104, 0x00D18604, 0x00D19302, 0x00D19403, 0x00D21C04, 0x00D23E02, 0x00D32106,
+    0x00D34504, 0x00D34E04, 0x00D34F04, 0x00D35004, 0x00D35204, 0x00D36104, 0x00D36202, 0x00D36701, 0x00D36A04, 0x00D38502, 0x00D3B304, 0x00D3C304,
+    0x00D3C802, 0x00D3D204, 0x00D3DD04, 0x00D3F504, 0x00D40A04, 0x00D43604, 0x00D43B04, 0x00D43E04, 0x00D45301, 0x00D46B04, 0x00D46C04, 0x00D48004,
+    0x00D49A01, 0x00D49F04, 0x00D4EF04, 0x00D50304, 0x00D50A01, 0x00D53704, 0x00D55904, 0x00D57402, 0x00D58C04, 0x00D59802, 0x00D59C04, 0x00D5E904,
+    0x00D5F104, 0x00D60704, 0x00D63F04, 0x00D65802, 0x00D66904, 0x00D66A04, 0x00D66B04, 0x00D68404, 0x00D68804, 0x00D6B801, 0x00D72602, 0x00D72F04,
+    0x00D73004, 0x00D73206, 0x00D73702, 0x00D74B02, 0x00D7B104, 0x00D7C102, 0x00D7EA04, 0x00D7EC01, 0x00D81704, 0x00D81B04, 0x00D81C04, 0x00D82E02,
+    0x00D8AB04, 0x00D8AE01, 0x00D8DF04, 0x00D93704, 0x00D93904, 0x00D93D04, 0x00D94804, 0x00D95304, 0x00D95604, 0x00D96B04, 0x00D99804, 0x00D99D02,
+    0x00D9D504, 0x00D9FA04, 0x00D9FF05, 0x00DA0304, 0x00DA2A04, 0x00DA2B04, 0x00DA3004, 0x00DAB004, 0x00DAE004, 0x00DAFF04, 0x00DB0004, 0x00DB0104,
+    0x00DB0304, 0x00DB9E02, 0x00DBB402, 0x00DBB602, 0x00DBDD02, 0x00DC0604, 0x00DC3902, 0x00DC3E02, 0x00DC4002, 0x00DC5504, 0x00DC5704, 0x00DC7904,
+    0x00DC7E02, 0x00DCAB04, 0x00DCBA04, 0x00DCCC04, 0x00DD0504, 0x00DD0A04, 0x00DD1702, 0x00DD4106, 0x00DD7D04, 0x00DD9D04, 0x00DDC704, 0x00DDC804,
+    0x00DDEE02, 0x00DDF904, 0x00DE0504, 0x00DE1604, 0x00DE1A04, 0x00DE1C04, 0x00DE1D04, 0x00DE3B04, 0x00DE4C04, 0x00DE4E04, 0x00DE5804, 0x00DE5E04,
+    0x00DE6604, 0x00DE6A04, 0x00DEDB04, 0x00DEE604, 0x00DEF404, 0x00DF0004, 0x00DF0304, 0x00DFF202, 0x00E01905, 0x00E01E04, 0x00E02004, 0x00E02104,
+    0x00E02504, 0x00E07804, 0x00E07904, 0x00E07A04, 0x00E07B04, 0x00E08504, 0x00E09304, 0x00E0D504, 0x00E0DA04, 0x00E0E204, 0x00E0ED04, 0x00E0F104,
+    0x00E0F504, 0x00E0F704, 0x00E10A01, 0x00E11004, 0x00E11104, 0x00E11C04, 0x00E11D04, 0x00E12904, 0x00E12C04, 0x00E13004, 0x00E13404, 0x00E14104,
+    0x00E14404, 0x00E17D04, 0x00E19B06, 0x00E1B404, 0x00E1B704, 0x00E1BE04, 0x00E1C001, 0x00E1C904, 0x00E1D704, 0x00E1E104, 0x00E1F002, 0x00E1F106,
+    0x00E1F206, 0x00E20E02, 0x00E21702, 0x00E22602, 0x00E24E02, 0x00E25604, 0x00E26202, 0x00E27804, 0x00E27B02, 0x00E28006, 0x00E28202, 0x00E28401,
+    0x00E28A02, 0x00E2BC04, 0x00E2E102, 0x00E2E302, 0x00E2EE02, 0x00E2F302, 0x00E2F802, 0x00E31702, 0x00E32E02, 0x00E34402, 0x00E34C02, 0x00E38402,
+    0x00E38702, 0x00E38B02, 0x00E39502, 0x00E3A302, 0x00E3A702, 0x00E3A902, 0x00E43702, 0x00E43A02, 0x00E43B02, 0x00E45704, 0x00E45804, 0x00E45904,
+    0x00E45A04, 0x00E45E04, 0x00E45F04, 0x00E4A304, 0x00E4A404, 0x00E4A604, 0x00E4A704, 0x00E4A804, 0x00E51002, 0x00E51202, 0x00E55302, 0x00E56302,
+    0x00E57B04, 0x00E5B904, 0x00E5C604, 0x00E5CB04, 0x00E5E204, 0x00E5F302, 0x00E5FB02, 0x00E5FC02, 0x00E5FD02, 0x00E5FF03, 0x00E61704, 0x00E63C04,
+    0x00E64C04, 0x00E64D04, 0x00E65A04, 0x00E65B04, 0x00E65C04, 0x00E65D04, 0x00E65F04, 0x00E67904, 0x00E67E04, 0x00E68504, 0x00E68804, 0x00E69004,
+    0x00E69E04, 0x00E6AC02, 0x00E6B102, 0x00E6C904, 0x00E6CA04, 0x00E6E004, 0x00E6E504, 0x00E6F604, 0x00E6F804, 0x00E70504, 0x00E70604, 0x00E70A04,
+    0x00E70C04, 0x00E71004, 0x00E72004, 0x00E72104, 0x00E72E04, 0x00E74A04, 0x00E74B04, 0x00E74C04, 0x00E74F04, 0x00E75104, 0x00E75404, 0x00E75704,
+    0x00E76201, 0x00E76904, 0x00E76D04, 0x00E76E04, 0x00E77004, 0x00E77104, 0x00E77304, 0x00E77504, 0x00E77604, 0x00E77704, 0x00E77904, 0x00E77A04,
+    0x00E77C04, 0x00E78604, 0x00E78904, 0x00E79004, 0x00E7A804, 0x00E7D004, 0x00E7D204, 0x00E7D704, 0x00E7DD04, 0x00E7DE04, 0x00E7DF04, 0x00E7E004,
+    0x00E7E604, 0x00E7E804, 0x00E7EC04, 0x00E7F104, 0x00E7F504, 0x00E7F604, 0x00E7FD04, 0x00E80004, 0x00E83C04, 0x00E84D04, 0x00E85504, 0x00E85D04,
+    0x00E87304, 0x00E87A04, 0x00E87C04, 0x00E87D04, 0x00E87F04, 0x00E88004, 0x00E88A04, 0x00E8B704, 0x00E8D104, 0x00E8DA04, 0x00E8EC02, 0x00E8F104,
+    0x00E8F606, 0x00E91E04, 0x00E92304, 0x00E92404, 0x00E92C04, 0x00E93404, 0x00E93504, 0x00E93704, 0x00E93E04, 0x00E94304, 0x00E94404, 0x00E94504,
+    0x00E95E04, 0x00E96A01, 0x00E97C04, 0x00E99004, 0x00E9B201, 0x00E9BA04, 0x00E9BD01, 0x00E9C404, 0x00E9CD04, 0x00E9D704, 0x00E9E904, 0x00E9F604,
+    0x00EA0901, 0x00EA0A01, 0x00EA3B04, 0x00EA4704, 0x00EA5204, 0x00EA5904, 0x00EA5A04, 0x00EA5B04, 0x00EA6804, 0x00EA6B04, 0x00EA6F04, 0x00EA7104,
+    0x00EAC706, 0x00EB1604, 0x00EB1C02, 0x00EB2D04, 0x00EB4F04, 0x00EB8204, 0x00EC1F04, 0x00EC2504, 0x00EC3E02, 0x00EC5404, 0x00ECA402, 0x00ECE604,
+    0x00ECFB04, 0x00ED8E04, 0x00EDAD04, 0x00EDB304, 0x00EDB602, 0x00EDBB04, 0x00EDFE04, 0x00EE5804, 0x00EE6102, 0x00EE9F04, 0x00EEEB04, 0x00EEF204,
+    0x00EF0904, 0x00EF1F04, 0x00EF6F02, 0x00EF7902, 0x00EF9102, 0x00EF9802, 0x00EFB204, 0x00EFBE04, 0x00EFC004, 0x00EFCF02, 0x00EFDA04, 0x00F01504,
+    0x00F01604, 0x00F01704, 0x00F03304, 0x00F04B04, 0x00F05804, 0x00F06B01, 0x00F07604, 0x00F08404, 0x00F08904, 0x00F09004, 0x00F09504, 0x00F09604,
+    0x00F09704, 0x00F09904, 0x00F09A04, 0x00F09D04, 0x00F09E04, 0x00F0A204, 0x00F0A701, 0x00F0D002, 0x00F0F402, 0x00F0F502, 0x00F0F802, 0x00F11902,
+    0x00F12204, 0x00F13304, 0x00F15102, 0x00F15402, 0x00F19B02, 0x00F1AF04, 0x00F1B704, 0x00F1BA02, 0x00F1C504, 0x00F1D504, 0x00F1E404, 0x00F22902,
+    0x00F22F02, 0x00F25502, 0x00F27702, 0x00F2AC02, 0x00F2B104, 0x00F2B201, 0x00F2B304, 0x00F2B602, 0x00F2B902, 0x00F2CD02, 0x00F2CE02, 0x00F32904,
+    0x00F32A04, 0x00F36102, 0x00F36C04, 0x00F37704, 0x00F37C04, 0x00F37F04, 0x00F38604, 0x00F3A302, 0x00F3B402, 0x00F3C204, 0x00F3D104, 0x00F3D404,
+    0x00F3EB04, 0x00F3ED04, 0x00F40504, 0x00F40601, 0x00F43F01, 0x00F45001, 0x00F47405, 0x00F47704, 0x00F48504, 0x00F48904, 0x00F48C05, 0x00F48D04,
+    0x00F49A02, 0x00F4A201, 0x00F4B804, 0x00F4B904, 0x00F4DA04, 0x00F4FA04, 0x00F52A02, 0x00F54904, 0x00F56204, 0x00F57E01, 0x00F59A01, 0x00F5DA04,
+    0x00F5DB04, 0x00F5FF04, 0x00F60604, 0x00F61A04, 0x00F62F01, 0x00F63101, 0x00F63E04, 0x00F68202, 0x00F6B504, 0x00F70104, 0x00F70F04, 0x00F71B04,
+    0x00F72402, 0x00F72E01, 0x00F75002, 0x00F76A01, 0x00F7EC03, 0x00F7F704, 0x00F7FF02, 0x00F83504, 0x00F83C04, 0x00F84802, 0x00F85004, 0x00F85104,
+    0x00F88302, 0x00F88402, 0x00F88702, 0x00F90D04, 0x00F90E04, 0x00F91F04, 0x00F92304, 0x00F93B05, 0x00F98901, 0x00F98C04, 0x00F99802, 0x00F99B02,
+    0x00F99C02, 0x00F9A804, 0x00F9A904, 0x00F9C702, 0x00FA2904, 0x00FA2C02, 0x00FA3A02, 0x00FA8D04, 0x00FAD504, 0x00FAD704, 0x00FAE901, 0x00FB5601,
+    0x00FB6B04, 0x00FB6D04, 0x00FB7904, 0x00FB7E03, 0x00FB8604, 0x00FBFB01, 0x00FC4C01, 0x00FC4E01, 0x00FC4F01, 0x00FC5704, 0x00FC5F04, 0x00FC8504,
+    0x00FC8F04, 0x00FC9704, 0x00FCAE01, 0x00FCB702, 0x00FCB904, 0x00FCBA04, 0x00FCBB04, 0x00FCC001, 0x00FCC201, 0x00FCD004, 0x00FCD104, 0x00FCDD01,
+    0x00FCE104, 0x00FCF604, 0x00FCF704, 0x00FD2302, 0x00FD4B02, 0x00FD4C02, 0x00FD6604, 0x00FDDF04, 0x00FE2404, 0x00FE3902, 0x00FE6001, 0x00FE6804,
+    0x00FE7B01, 0x00FE9404, 0x00FEB904, 0x00FEEC04, 0x01005804, 0x01010004, 0x01011501, 0x01011901, 0x0101C304, 0x0101FA04, 0x0101FC04, 0x01020101,
+    0x01024504, 0x01024D01, 0x01024F01, 0x01028C06, 0x01029406, 0x01029606, 0x0102BB03, 0x0102E304, 0x0102E504, 0x0102F101, 0x01030C01, 0x01030D01,
+    0x01031001, 0x01033701, 0x0103AF01, 0x0103B904, 0x0103E004, 0x0103E804, 0x0103EA04, 0x0103F204, 0x01041C01, 0x01043B04, 0x0104C501, 0x0104E501,
+    0x0104FD04, 0x01051A02, 0x01051B02, 0x01051C02, 0x01053601, 0x01059604, 0x01059804, 0x01067F01, 0x0106A501, 0x0106D904, 0x0106FD01, 0x01079903,
+    0x0107CB01, 0x01089301, 0x0108D104, 0x0109F501, 0x010A4302, 0x010A4402, 0x010A5101, 0x010A7004, 0x010A7104, 0x010A9604, 0x010AA704, 0x010ABB01,
+    0x010B9201, 0x010B9801, 0x010B9901, 0x010BC504, 0x010BC704, 0x010C3E04, 0x010CEF04, 0x010D0204, 0x010D1404, 0x010D9B04, 0x010DA404, 0x010DB104,
+    0x010DC204, 0x010DC404, 0x010DC601, 0x010DCC04, 0x010DD804, 0x010DEB01, 0x010E1C04, 0x010E4601, 0x010E7101, 0x010E7D01, 0x010E9904, 0x010E9A04,
+    0x010EE602, 0x010EF902, 0x010F0B04, 0x010F1801, 0x010F1A01, 0x010F6A01, 0x010F7204, 0x010F9004, 0x010F9804, 0x010FBF04, 0x010FC204, 0x010FC304,
+    0x010FC504, 0x010FC804, 0x010FC904, 0x010FCD04, 0x010FCE04, 0x010FD101, 0x010FD704, 0x010FF201, 0x01108601, 0x01108A01, 0x01108B04, 0x01108C04,
+    0x01114D04, 0x01114F04, 0x01115004, 0x01119B04, 0x0111BA04, 0x0111C004, 0x01120104, 0x01121D01, 0x01121F01, 0x0112B704, 0x0112C201, 0x0112E601,
+    0x0112EF01, 0x0112F204, 0x0112F804, 0x0112FB04, 0x01130704, 0x01135D01, 0x01137004, 0x01137404, 0x0113DB02, 0x01141501, 0x01145201, 0x01146204,
+    0x01146704, 0x0114D204, 0x0114D801, 0x0114E402, 0x0114EA06, 0x01152201, 0x01154904, 0x0115B004, 0x0115D301, 0x01165204, 0x01165504, 0x01165604,
+    0x01169804, 0x0116AD05, 0x0116C001, 0x0116C104, 0x0116D101, 0x0116DA04, 0x0116E104, 0x0116ED04, 0x0116FC04, 0x01171701, 0x01177A04, 0x01182E01,
+    0x01186204, 0x01186F04, 0x01188404, 0x01188704, 0x0118C701, 0x0118F704, 0x0118F804, 0x0118F904, 0x0118FD04, 0x01190004, 0x01190204, 0x01192504,
+    0x01196601, 0x0119BB04, 0x0119E604, 0x0119E904, 0x011A1004, 0x011A3F04, 0x011A4C04, 0x011A5401, 0x011A8004, 0x011ABC04, 0x011B0601, 0x011BA801,
+    0x011BDD01, 0x011BDE01, 0x011C1804, 0x011C1E02, 0x011CC504, 0x011CC905, 0x011D0004, 0x011D1F04, 0x011D2704, 0x011D7704, 0x011D7A01, 0x011D7F04,
+    0x011DA404, 0x011DFC04, 0x011E2604, 0x011E2704, 0x011E6D02, 0x011F1101, 0x011F2606, 0x011F3704, 0x011F5C04, 0x011FB701, 0x011FC801, 0x011FD502,
+    0x011FFA05, 0x01209004, 0x0120AB06, 0x0120C002, 0x0120C102, 0x0120E601, 0x0120EB04, 0x0120F706, 0x01211102, 0x01211202, 0x01212304, 0x01212404,
+    0x01212504, 0x01213D04, 0x01218904, 0x01218A04, 0x01228604, 0x0122AE04, 0x0122D801, 0x0122D901, 0x01230204, 0x01231D04, 0x01232304, 0x01235C04,
+    0x01237504, 0x01238102, 0x0123DC04, 0x0123E404, 0x0123E604, 0x01240A04, 0x01243604, 0x01243B04, 0x01243E04, 0x01244104, 0x01248804, 0x01249A04,
+    0x01250B04, 0x01250F04, 0x01253604, 0x01253C04, 0x01254104, 0x01259104, 0x0125A004, 0x01263204, 0x01263F04, 0x01264104, 0x01264204, 0x01264404,
+    0x01266204, 0x01267704, 0x01267804, 0x01269404, 0x01269504, 0x01269F04, 0x0126DB04, 0x01274701, 0x0127B604, 0x0127F104, 0x0127FF04, 0x01284B04,
+    0x0128AA04, 0x0128D901, 0x0128E204, 0x0128E704, 0x01291B04, 0x01292304, 0x01292605, 0x01294E04, 0x01296604, 0x01297204, 0x01298004, 0x01298B04,
+    0x01299A04, 0x0129D605, 0x0129D902, 0x0129DA02, 0x0129EC02, 0x0129EF02, 0x0129F002, 0x0129F102, 0x0129F302, 0x0129F402, 0x0129F502, 0x0129F702,
+    0x0129FA02, 0x012A0202, 0x012A0402, 0x012A0602, 0x012A0802, 0x012A0902, 0x012A0A02, 0x012A0B02, 0x012A0C02, 0x012A0D02, 0x012A2804, 0x012A7204,
+    0x012A8E04, 0x012AB904, 0x012ABE04, 0x012ACB01, 0x012ADA04, 0x012ADC04, 0x012ADD04, 0x012ADF01, 0x012AF504, 0x012B1C04, 0x012B2102, 0x012B2804,
+    0x012B2D04, 0x012B4404, 0x012B4502, 0x012B4A04, 0x012B4D04, 0x012B5B01, 0x012B7102, 0x012B7F02, 0x012B8804, 0x012B8A04, 0x012B8F01, 0x012BAD04,
+    0x012BAE04, 0x012BBC04, 0x012BBD04, 0x012BBF04, 0x012BEF04, 0x012C0302, 0x012C0602, 0x012C0802, 0x012C0F04, 0x012C2B04, 0x012C3802, 0x012C3902,
+    0x012C4A01, 0x012C4C04, 0x012C5104, 0x012D0904, 0x012D0D04, 0x012D4A02, 0x012D6804, 0x012D9904, 0x012D9D04, 0x012D9F02, 0x012DA004, 0x012DA302,
+    0x012DA402, 0x012DA702, 0x012DAA02, 0x012E1201, 0x012E2104, 0x012E7104, 0x012E7304, 0x012E8202, 0x012E8302, 0x012E8B02, 0x012EA002, 0x012EA602,
+    0x012EAD02, 0x012EAE02, 0x012EB102, 0x012EB502, 0x012EB702, 0x012EB804, 0x012EBC04, 0x012EC102, 0x012EC902, 0x012ECA02, 0x012ECB02, 0x012EDF02,
+    0x012EE901, 0x012F0204, 0x012F0706, 0x012F2602, 0x012F2802, 0x012F2E01, 0x012F3002, 0x012F5F04, 0x012F7A01, 0x012F7F04, 0x012F8704, 0x012F9604,
+    0x012F9A04, 0x012FA304, 0x012FB501, 0x012FB701, 0x012FBC02, 0x012FBE06, 0x012FC102, 0x012FC202, 0x012FC402, 0x012FED04, 0x01304104, 0x01306104,
+    0x0130DB01, 0x01313F04, 0x01315204, 0x0131FB04, 0x0132AD04, 0x0132B904, 0x0132CE04, 0x01335206, 0x01335302, 0x01336E04, 0x01338304, 0x01339704,
+    0x0133A304, 0x0133B404, 0x0133CF04, 0x0133D204, 0x0133D804, 0x0133F004, 0x0133FA04, 0x01343B04, 0x01344404, 0x01344904, 0x01345901, 0x01346A01,
+    0x0134A002, 0x0134ED04, 0x0134EE04, 0x0134EF04, 0x0134F304, 0x0134F802, 0x01351E02, 0x01352006, 0x01352402, 0x01354604, 0x01356602, 0x0135F904,
+    0x01360A01, 0x01365E04, 0x01366904, 0x0136B304, 0x0136C604, 0x0136CD04, 0x0136D304, 0x0136D902, 0x0136F404, 0x0136FA04, 0x01370702, 0x01374202,
+    0x01379504, 0x0137CE04, 0x0137E604, 0x0137E704, 0x0137EA04, 0x0137EC04, 0x0137EE04, 0x0137F004, 0x0137F104, 0x0137F204, 0x0137F304, 0x0137FC04,
+    0x01380C04, 0x01380E04, 0x01381101, 0x01381204, 0x01382904, 0x01383504, 0x01383C04, 0x01384104, 0x01384204, 0x01384304, 0x01384E01, 0x01385D04,
+    0x0138FF04, 0x01392D04, 0x01394E04, 0x01397002, 0x01399004, 0x0139B906, 0x0139CB04, 0x0139D004, 0x0139D204, 0x0139D804, 0x0139E102, 0x0139E202,
+    0x0139FC04, 0x013A0704, 0x013A4504, 0x013AA204, 0x013B0604, 0x013B0904, 0x013B6E04, 0x013B8C04, 0x013B8D04, 0x013BDF02, 0x013C3004, 0x013C6604,
+    0x013C7504, 0x013C8504, 0x013C8604, 0x013C8E04, 0x013CC902, 0x013CCA02, 0x013CCB02, 0x013CD504, 0x013CF002, 0x013CF502, 0x013D0F04, 0x013D1D04,
+    0x013D3504, 0x013D4804, 0x013D4D02, 0x013D5404, 0x013D6104, 0x013D6504, 0x013D6802, 0x013D6D02, 0x013D6E02, 0x013D7502, 0x013D8002, 0x013D8102,
+    0x013D9106, 0x013D9904, 0x013DB502, 0x013DBC02, 0x013E0A04, 0x013E1504, 0x013E1604, 0x013E1F04, 0x013E2004, 0x013E7104, 0x013E8D02, 0x013E9904,
+    0x013EA804, 0x013EF204, 0x013EF704, 0x013F1F04, 0x013F5502, 0x013F5703, 0x013F7602, 0x013FA701, 0x01404B04, 0x01404C04, 0x0140C704, 0x01410801,
+    0x01414202, 0x01419602, 0x01426504, 0x0142BE04, 0x0142CD05, 0x0142D005, 0x0142D104, 0x0142E601, 0x0142EB01, 0x0142ED04, 0x01430302, 0x01430A04,
+    0x01432602, 0x01432802, 0x01433002, 0x01433804, 0x01434D04, 0x01437C04, 0x01438004, 0x0143E902, 0x0143F704, 0x01443A04, 0x01444D04, 0x01447C04,
+    0x01449601, 0x01452A02, 0x01452B02, 0x01452C02, 0x01452D02, 0x01454004, 0x0145B506, 0x0145B904, 0x0145FF04, 0x01462404, 0x01462A04, 0x01467604,
+    0x01467A04, 0x01468C04, 0x01468D04, 0x01470904, 0x01470D04, 0x01471604, 0x01474F04, 0x01475204, 0x01475304, 0x01475704, 0x01478F04, 0x0147CA04,
+    0x0147CE04, 0x0147D004, 0x01482E04, 0x01483601, 0x01484004, 0x01489D04, 0x0148B604, 0x01495504, 0x0149B204, 0x0149D704, 0x0149DB04, 0x0149E304,
+    0x0149F204, 0x0149F504, 0x014A0A04, 0x014A4104, 0x014A8002, 0x014A8A04, 0x014A9604, 0x014A9A04, 0x014AB304, 0x014AB904, 0x014AC304, 0x014AEA02,
+    0x014AEB01, 0x014AF106, 0x014B1B04, 0x014B1E04, 0x014B4601, 0x014B4701, 0x014B5004, 0x014B5904, 0x014B5D04, 0x014B6104, 0x014B7602, 0x014B8504,
+    0x014B8804, 0x014B8A01, 0x014BB001, 0x014BE302, 0x014C3302, 0x014C5B04, 0x014CE602, 0x014CF004, 0x014D0802, 0x014D2802, 0x014D8806, 0x014DA802,
+    0x014DC501, 0x014DFB02, 0x014E2004, 0x014E3A04, 0x014E3B04, 0x014EA902, 0x014EB704, 0x014EBC06, 0x014ED204, 0x014ED304, 0x014ED401, 0x014EEB02,
+    0x014EEC01, 0x014F0501, 0x014F1A04, 0x014F2001, 0x014F2804, 0x014F2A04, 0x014F2C02, 0x014FBC06, 0x014FCB04, 0x014FCC04, 0x014FCD04, 0x01501806,
+    0x01504C02, 0x01504D02, 0x01505002, 0x01505102, 0x01505302, 0x01505402, 0x01505502, 0x01505602, 0x01505702, 0x01505802, 0x01505C02, 0x01505E02,
+    0x01506102, 0x01506902, 0x0150C302, 0x0150C503, 0x01517806, 0x01520702, 0x01520802, 0x01520902, 0x01520A02, 0x01520B02, 0x01522C01, 0x01526502,
+    0x01526701, 0x01526904, 0x01528302, 0x01529603, 0x0152AD02, 0x0152AF02, 0x0152B006, 0x01530E04, 0x01531004, 0x01532901, 0x0153A502, 0x0153EF02,
+    0x0153F002, 0x01548402, 0x01548502, 0x0154AF04, 0x0154C101, 0x0154C304, 0x0154EC04, 0x01555B04, 0x01556104, 0x0155B805, 0x01560104, 0x01562904,
+    0x01566C04, 0x0156AF04, 0x0156CF01, 0x01571902, 0x01577F02, 0x0157E004, 0x01580B04, 0x01581206, 0x01581406, 0x01586302, 0x01587C04, 0x0158C706,
+    0x01591302, 0x01591502, 0x01591602, 0x01591802, 0x01591902, 0x01591A02, 0x01592504, 0x01596702, 0x01598002, 0x01598401, 0x01598D02, 0x015A2302,
+    0x015A3106, 0x015A4901, 0x015A5404, 0x015A5D01, 0x015A6802, 0x015A7A01, 0x015AAB02, 0x015AAF06, 0x015AC304, 0x015AEE04, 0x015B0B02, 0x015B1402,
+    0x015B2C04, 0x015B3604, 0x015B4604, 0x015B7F04, 0x015BFF01, 0x015C0304, 0x015C3402, 0x015D3902, 0x015D9904, 0x015DA304, 0x015DC204, 0x015DC305,
+    0x015E6E04, 0x015E8002, 0x015E9002, 0x015E9102, 0x015E9702, 0x015E9906, 0x015EA602, 0x015EC002, 0x015ED002, 0x015EE702, 0x015F2E04, 0x015F3104,
+    0x015F3203, 0x015F3504, 0x015FC304, 0x015FC404, 0x015FC504, 0x015FD904, 0x01606704, 0x01608F04, 0x0160A104, 0x0160A304, 0x0160D802, 0x0160E302,
+    0x0160EB02, 0x0160F302, 0x0160F902, 0x01610D04, 0x01611304, 0x01614E04, 0x0161B604, 0x01620104, 0x01624E04, 0x01638D02, 0x01638F02, 0x0163E302,
+    0x01648002, 0x0165AA04, 0x0165DB04, 0x0165E604, 0x0165E704, 0x01661D04, 0x01668006, 0x01668206, 0x01669506, 0x01669806, 0x01669A02, 0x01669F02,
+    0x0166A102, 0x0166BD02, 0x0166BE02, 0x0166CD04, 0x01675D04, 0x01675E04, 0x01676704, 0x01676804, 0x01676B04, 0x01679301, 0x01681604, 0x01686A04,
+    0x0168DC02, 0x0169CD04, 0x0169D304, 0x016A1C04, 0x016A2904, 0x016A3702, 0x016A4302, 0x016A7B02, 0x016A7F02, 0x016A8202, 0x016A8502, 0x016A9602,
+    0x016A9A02, 0x016AA002, 0x016AA102, 0x016AF304, 0x016AF704, 0x016B7404, 0x016B7704, 0x016B7F01, 0x016C5902, 0x016C6202, 0x016C8902, 0x016C8A02,
+    0x016C9304, 0x016CBF02, 0x016CC002, 0x016CDA02, 0x016CF001, 0x016CF602, 0x016CF702, 0x016CF902, 0x016D4104, 0x016DB602, 0x016DDD04, 0x016E0104,
+    0x016E0F04, 0x016E1B04, 0x016E2A04, 0x016E8004, 0x016F0602, 0x016F2102, 0x016F4302, 0x016F4602, 0x01708004, 0x0170A101, 0x01710802, 0x0171C501,
+    0x01730802, 0x0173DF02, 0x01744B02, 0x01744C02, 0x01744D02, 0x01744E02, 0x01745002, 0x0174D004, 0x0174DE04, 0x01750301, 0x01750701, 0x0175DF02,
+    0x0175E206, 0x0175ED06, 0x0175FA06, 0x01760602, 0x01760702, 0x01761401, 0x01764102, 0x01764904, 0x01766B02, 0x0176E204, 0x01770404, 0x01776706,
+    0x01778904, 0x0177BD04, 0x0177C502, 0x0177E702, 0x0177F302, 0x01782602, 0x01784A01, 0x01784B01, 0x01784F01, 0x01785404, 0x01787102, 0x01789F04,
+    0x0178A004, 0x0178A604, 0x0178AA04, 0x0178AB04, 0x0178AE02, 0x0178C604, 0x0178DE01, 0x0178E901, 0x01790404, 0x01798A04, 0x01798B04, 0x0179B204,
+    0x0179C604, 0x0179C804, 0x0179DB05, 0x017A1504, 0x017A5104, 0x017A5B04, 0x017A6704, 0x017A8D04, 0x017AE101, 0x017B8304, 0x017B8904, 0x017B9504,
+    0x017BCA04, 0x017CB602, 0x017CB702, 0x017CD804, 0x017CE704, 0x017CEB04, 0x017CEC04, 0x017D0B02, 0x017D6504, 0x017DB904, 0x017E1D02, 0x017ED702,
+    0x017ED802, 0x017EE102, 0x017EE402, 0x017EE502, 0x017F3404, 0x01803F02, 0x01808802, 0x0180A704, 0x01812605, 0x01819704, 0x0182B104, 0x0182B204,
+    0x0182B304, 0x0182B801, 0x0182BA01, 0x0182C901, 0x01830301, 0x01831401, 0x01832B04, 0x01832E04, 0x01835401, 0x01836501, 0x0183A801, 0x0183D304,
+    0x0183D902, 0x01843004, 0x01844104, 0x01844801, 0x01849401, 0x0184B205, 0x0184F804, 0x01852A04, 0x01853F04, 0x0185AB02, 0x0185E604, 0x01860505,
+    0x01860A04, 0x01861504, 0x01861904, 0x01861C01, 0x01865E04, 0x01868604, 0x0186AC04, 0x0186AF04, 0x0186B004, 0x0186C004, 0x0186C104, 0x0186C304,
+    0x0186C805, 0x0186FE04, 0x0186FF04, 0x01872206, 0x01873604, 0x01875F04, 0x01878504, 0x0187AE04, 0x0187AF01, 0x0187F501, 0x0188A404, 0x01897404,
+    0x0189AC06, 0x0189B006, 0x0189C604, 0x018A7404, 0x018AA903, 0x018ADD01, 0x018AF401, 0x018B2004, 0x018B6501, 0x018B6704, 0x018B8901, 0x018BA304,
+    0x018C0504, 0x018C2404, 0x018C8004, 0x018C8402, 0x018CA902, 0x018CAA02, 0x018CC002, 0x018D0B02, 0x018D3404, 0x018DB104, 0x018DB204, 0x018DF702,
+    0x018DF802, 0x018DF902, 0x018DFA02, 0x018EA104, 0x018EAF04, 0x018F5F01, 0x018F7201, 0x018F7704, 0x018F7904, 0x018F7A04, 0x018F8802, 0x018FC602,
+    0x018FCF02, 0x018FD002, 0x018FD404, 0x018FD604, 0x018FD702, 0x018FD904, 0x018FEF02, 0x01900102, 0x01901002, 0x01901102, 0x01904E04, 0x01905204,
+    0x01908F02, 0x01909302, 0x01909E02, 0x0190A002, 0x0190B604, 0x0190C104, 0x01912502, 0x01918902, 0x01918A02, 0x01923704, 0x01925604, 0x01925801,
+    0x0192F901, 0x01946601, 0x01948204, 0x01949904, 0x01959302, 0x01959402, 0x0195AF04, 0x0195E004, 0x01960C01, 0x01963102, 0x0196C204, 0x0196E302,
+    0x01977C02, 0x01977D02, 0x01977E06, 0x01979B04, 0x01993402, 0x01993702, 0x01994502, 0x01999104, 0x0199B804, 0x0199CA01, 0x0199CD04, 0x0199EA02,
+    0x019A6D01, 0x019AD501, 0x019AD602, 0x019B4904, 0x019B9804, 0x019B9901, 0x019B9A04, 0x019BC804, 0x019BCD02, 0x019BD002, 0x019BD302, 0x019BF504,
+    0x019BFC04, 0x019C0D04, 0x019C3301, 0x019C4A04, 0x019D2204, 0x019D2B02, 0x019D4002, 0x019D4D02, 0x019D5102, 0x019DAA04, 0x019DAC01, 0x019E0C01,
+    0x019E3B01, 0x019ED901, 0x01A0F404, 0x01A10B04, 0x01A12106, 0x01A14D02, 0x01A14E06, 0x01A15002, 0x01A15702, 0x01A15802, 0x01A17704, 0x01A19202,
+    0x01A19302, 0x01A19602, 0x01A19802, 0x01A1C702, 0x01A23302, 0x01A25501, 0x01A26204, 0x01A26704, 0x01A26804, 0x01A2A601, 0x01A2C201, 0x01A30606,
+    0x01A3A302, 0x01A3A402, 0x01A3EC02, 0x01A41901, 0x01A43206, 0x01A43602, 0x01A57F02, 0x01A58002, 0x01A58102, 0x01A58202, 0x01A5E504, 0x01A6A202,
+    0x01A6A406, 0x01A6A702, 0x01A6A902, 0x01A6B002, 0x01A6B102, 0x01A6B202, 0x01A6B402, 0x01A6B802, 0x01A6CE03, 0x01A6EE02, 0x01A6EF02, 0x01A6F102,
+    0x01A6F802, 0x01A6FB02, 0x01A6FC02, 0x01A6FD02, 0x01A6FF02, 0x01A70302, 0x01A70402, 0x01A70502, 0x01A70602, 0x01A74703, 0x01A74E03, 0x01A75202,
+    0x01A76C03, 0x01A77F02, 0x01A78002, 0x01A79E02, 0x01A79F03, 0x01A7D502, 0x01A7D703, 0x01A80E02, 0x01A89504, 0x01A8F301, 0x01A8FA01, 0x01A8FF01,
+    0x01A92702, 0x01A92B02, 0x01A93506, 0x01A97802, 0x01A98E02, 0x01A99102, 0x01A9A802, 0x01A9B202, 0x01AA1704, 0x01AA1804, 0x01AA4B02, 0x01AA4C02,
+    0x01AA5602, 0x01AA8202, 0x01AA9F02, 0x01AAC002, 0x01AACC02, 0x01AAF202, 0x01AAF803, 0x01AAFC04, 0x01AB2404, 0x01AB4C02, 0x01AB4F04, 0x01ABB904,
+    0x01ACAA04, 0x01ACE604, 0x01ACE804, 0x01AD0902, 0x01AE7701, 0x01AE8701, 0x01B03B04, 0x01B04502, 0x01B04602, 0x01B09802, 0x01B09902, 0x01B13D02,
+    0x01B16304, 0x01B16702, 0x01B16F02, 0x01B17002, 0x01B17304, 0x01B17804, 0x01B1A204, 0x01B28806, 0x01B32802, 0x01B40001, 0x01B43304, 0x01B43902,
+    0x01B44502, 0x01B48F02, 0x01B49B02, 0x01B4F302, 0x01B51702, 0x01B51802, 0x01B51902, 0x01B51A02, 0x01B5AA02, 0x01B81402, 0x01B89802, 0x01B89902,
+    0x01B8C102, 0x01B8E202, 0x01B8E302, 0x01B8E402, 0x01B8E502, 0x01B8E602, 0x01B8FE04, 0x01B91902, 0x01B91A02, 0x01B91E02, 0x01B91F02, 0x01B92E02,
+    0x01B93302, 0x01B96604, 0x01B99302, 0x01B9F004, 0x01B9F504, 0x01BAC003, 0x01BB6004, 0x01BBE402, 0x01BBED01, 0x01BBF806, 0x01BC2204, 0x01BC3C02,
+    0x01BC7406, 0x01BCA402, 0x01BCC202, 0x01BCC402, 0x01BCC602, 0x01BCDE02, 0x01BCE202, 0x01BCE702, 0x01BCE802, 0x01BCEB02, 0x01BCEC02, 0x01BCF002,
+    0x01BD0A02, 0x01BD0B02, 0x01BD1602, 0x01BD2F04, 0x01BD5E06, 0x01BD5F02, 0x01BD6202, 0x01BD6E02, 0x01BD7601, 0x01BD8102, 0x01BD8202, 0x01BD8302,
+    0x01BD8402, 0x01BD9A06, 0x01BDA303, 0x01BDA902, 0x01BDAD02, 0x01BDBB02, 0x01BDBC02, 0x01BDC103, 0x01BDEA02, 0x01BDEE02, 0x01BDF004, 0x01BDF502,
+    0x01BE0504, 0x01BE1E02, 0x01BE2602, 0x01BE2802, 0x01BE3F02, 0x01BE4904, 0x01BE4A02, 0x01BE4F02, 0x01BE6A02, 0x01BE7D02, 0x01BE7E02, 0x01BEB302,
+    0x01BEE402, 0x01BEEF02, 0x01BF2A04, 0x01BF7C02, 0x01BFFB04, 0x01C00602, 0x01C00702, 0x01C03206, 0x01C0A004, 0x01C0A406, 0x01C0A704, 0x01C0AB04,
+    0x01C0AE02, 0x01C0B004, 0x01C0B502, 0x01C0B602, 0x01C0B706, 0x01C0B804, 0x01C0C902, 0x01C0CD02, 0x01C0D002, 0x01C0DC02, 0x01C0DF03, 0x01C0E602,
+    0x01C0E706, 0x01C0EB02, 0x01C0FD02, 0x01C0FE02, 0x01C10A06, 0x01C10C02, 0x01C13604, 0x01C14002, 0x01C14A02, 0x01C15A02, 0x01C17102, 0x01C17D02,
+    0x01C18002, 0x01C18602, 0x01C18803, 0x01C19A02, 0x01C1B903, 0x01C1CF02, 0x01C1D302, 0x01C1E502, 0x01C1E802, 0x01C1EA02, 0x01C1EC02, 0x01C1ED06,
+    0x01C1F104, 0x01C1F702, 0x01C1F802, 0x01C1F902, 0x01C1FB02, 0x01C1FC02, 0x01C20302, 0x01C22206, 0x01C22402, 0x01C22806, 0x01C22902, 0x01C22A02,
+    0x01C22B02, 0x01C22D02, 0x01C22E02, 0x01C22F02, 0x01C24402, 0x01C24C02, 0x01C25802, 0x01C25B01, 0x01C25E02, 0x01C25F02, 0x01C26C02, 0x01C26E02,
+    0x01C27102, 0x01C27302, 0x01C29C02, 0x01C29D06, 0x01C2A006, 0x01C2C402, 0x01C2C702, 0x01C2FA03, 0x01C30802, 0x01C35A02, 0x01C3A906, 0x01C3B402,
+    0x01C3DB02, 0x01C41201, 0x01C42206, 0x01C42406, 0x01C42602, 0x01C43702, 0x01C43802, 0x01C43A06, 0x01C44206, 0x01C44502, 0x01C47702, 0x01C47806,
+    0x01C47A02, 0x01C48B02, 0x01C48F02, 0x01C49B02, 0x01C49D02, 0x01C4A204, 0x01C4D802, 0x01C4E302, 0x01C4E602, 0x01C4E702, 0x01C4E802, 0x01C4EA02,
+    0x01C4FA02, 0x01C51502, 0x01C51902, 0x01C51A02, 0x01C51B02, 0x01C52B02, 0x01C52E03, 0x01C53004, 0x01C53401, 0x01C53501, 0x01C53601, 0x01C56C04,
+    0x01C57C02, 0x01C57F02, 0x01C5A202, 0x01C5A802, 0x01C5DD02, 0x01C5E701, 0x01C62B02, 0x01C64D01, 0x01C65001, 0x01C66201, 0x01C66A02, 0x01C6B604,
+    0x01C6C101, 0x01C6D104, 0x01C6D201, 0x01C74601, 0x01C7A502, 0x01C7B501, 0x01C7BE02, 0x01C7C802, 0x01C7E102, 0x01C7E202, 0x01C82002, 0x01C82E01,
+    0x01C82F03, 0x01C84501, 0x01C84901, 0x01C84C02, 0x01C86305, 0x01C86902, 0x01C86C02, 0x01C86F02, 0x01C87102, 0x01C87A06, 0x01C89802, 0x01C8C801,
+    0x01C8C901, 0x01C8CB01, 0x01C8CC01, 0x01C8CF02, 0x01C8D202, 0x01C8D302, 0x01C8E904, 0x01C8F104, 0x01C91502, 0x01C91606, 0x01C92802, 0x01C9E002,
+    0x01C9E902, 0x01CA4103, 0x01CA9601, 0x01CA9D02, 0x01CA9E04, 0x01CAAA06, 0x01CB1602, 0x01CB3102, 0x01CB5406, 0x01CB6E02, 0x01CBAF02, 0x01CBC604,
+    0x01CC0704, 0x01CC1304, 0x01CC4501, 0x01CC8B02, 0x01CC9202, 0x01CC9302, 0x01CCAB04, 0x01CCAF04, 0x01CCC002, 0x01CCC102, 0x01CCC702, 0x01CCCA02,
+    0x01CCF006, 0x01CCF902, 0x01CD0606, 0x01CD1602, 0x01CD9602, 0x01CD9B02, 0x01CDB201, 0x01CDB501, 0x01CDEB04, 0x01CDED02, 0x01CE0B02, 0x01CE1302,
+    0x01CE1906, 0x01CE2202, 0x01CE3302, 0x01CE4102, 0x01CE4902, 0x01CE4D01, 0x01CEB702, 0x01CEBB03, 0x01CEFA02, 0x01CEFD04, 0x01CF0101, 0x01CF0904,
+    0x01CF0C01, 0x01CF4004, 0x01CF4202, 0x01CF6B02, 0x01CF9904, 0x01CFFB03, 0x01CFFF04, 0x01D07902, 0x01D08A02, 0x01D0E402, 0x01D0F602, 0x01D0F802,
+    0x01D10B02, 0x01D10C02, 0x01D10D02, 0x01D11F04, 0x01D12D02, 0x01D12E04, 0x01D25502, 0x01D27702, 0x01D28E04, 0x01D2E404, 0x01D31501, 0x01D31904,
+    0x01D31E02, 0x01D32601, 0x01D33702, 0x01D33B02, 0x01D34401, 0x01D36202, 0x01D36302, 0x01D36E04, 0x01D3C602, 0x01D45A02, 0x01D45B03, 0x01D46002,
+    0x01D46102, 0x01D46302, 0x01D46502, 0x01D46602, 0x01D46702, 0x01D46902, 0x01D46A02, 0x01D46B02, 0x01D49002, 0x01D4A702, 0x01D4AC03, 0x01D4BB01,
+    0x01D4BC02, 0x01D4E201, 0x01D4E501, 0x01D4E602, 0x01D4F502, 0x01D4F602, 0x01D4F702, 0x01D4F802, 0x01D51602, 0x01D55002, 0x01D55102, 0x01D55202,
+    0x01D55404, 0x01D55504, 0x01D59004, 0x01D59602, 0x01D59902, 0x01D59A02, 0x01D59B02, 0x01D59F01, 0x01D5A002, 0x01D5A102, 0x01D5A302, 0x01D62802,
+    0x01D62906, 0x01D6C502, 0x01D70502, 0x01D70C06, 0x01D71304, 0x01D74402, 0x01D76702, 0x01D77402, 0x01D77602, 0x01D77806, 0x01D77B02, 0x01D79902,
+    0x01D7B302, 0x01D7B402, 0x01D7B906, 0x01D7D404, 0x01D86101, 0x01D87A02, 0x01D8CF02, 0x01D91E02, 0x01D92502, 0x01D92802, 0x01D93B02, 0x01D94002,
+    0x01D94102, 0x01D94B02, 0x01D94D04, 0x01D94E04, 0x01D94F05, 0x01D95D05, 0x01D95F02, 0x01D99904, 0x01D9A506, 0x01D9A704, 0x01D9AF04, 0x01D9C302,
+    0x01D9DC02, 0x01DA4302, 0x01DA4606, 0x01DA7F02, 0x01DA8106, 0x01DA8206, 0x01DABF01, 0x01DAC002, 0x01DACF02, 0x01DAD002, 0x01DAD502, 0x01DB8506,
+    0x01DBD902, 0x01DBDA02, 0x01DBF702, 0x01DBF802, 0x01DBF902, 0x01DBFA02, 0x01DBFB02, 0x01DBFC02, 0x01DBFD02, 0x01DBFE02, 0x01DBFF02, 0x01DC0002,
+    0x01DC0102, 0x01DC0202, 0x01DC0302, 0x01DC0402, 0x01DC0502, 0x01DC0602, 0x01DC3C02, 0x01DC4002, 0x01DC5F01, 0x01DCB204, 0x01DCE701, 0x01DD0202,
+    0x01DD0902, 0x01DD1006, 0x01DD5201, 0x01DD9102, 0x01DD9202, 0x01DDA602, 0x01DDA802, 0x01DDA903, 0x01DDB502, 0x01DDBC02, 0x01DDC303, 0x01DE1E01,
+    0x01DE2001, 0x01DE5901, 0x01DE6002, 0x01DE6102, 0x01DE6603, 0x01DE7702, 0x01DE7902, 0x01DE7A02, 0x01DEAE04, 0x01DF9502, 0x01DF9F02, 0x01DFAD04,
+    0x01DFAF04, 0x01DFB202, 0x01DFB402, 0x01DFB602, 0x01DFB702, 0x01DFB902, 0x01DFBB02, 0x01E06304, 0x01E07602, 0x01E07702, 0x01E08A01, 0x01E0A002,
+    0x01E0AA02, 0x01E0AB02, 0x01E0D401, 0x01E11202, 0x01E12302, 0x01E17602, 0x01E17A02, 0x01E17C04, 0x01E1C204, 0x01E1C502, 0x01E20F02, 0x01E21E01,
+    0x01E22504, 0x01E2C206, 0x01E30604, 0x01E32504, 0x01E32B04, 0x01E32D02, 0x01E32E02, 0x01E34302, 0x01E34D02, 0x01E35F01, 0x01E37002, 0x01E38302,
+    0x01E38402, 0x01E38C01, 0x01E39001, 0x01E3B502, 0x01E3B602, 0x01E3B702, 0x01E40002, 0x01E44D02, 0x01E44E02, 0x01E45202, 0x01E45C06, 0x01E45F02,
+    0x01E46702, 0x01E46902, 0x01E47F02, 0x01E4B005, 0x01E4B102, 0x01E4C101, 0x01E4CB04, 0x01E4F202, 0x01E55F02, 0x01E56101, 0x01E57102, 0x01E57202,
+    0x01E57302, 0x01E57803, 0x01E57D02, 0x01E61102, 0x01E63602, 0x01E63806, 0x01E63902, 0x01E63A02, 0x01E64002, 0x01E65602, 0x01E65702, 0x01E65A02,
+    0x01E65B02, 0x01E66404, 0x01E70A02, 0x01E71404, 0x01E79B01, 0x01E7A101, 0x01E7BF01, 0x01E7C401, 0x01E81004, 0x01E83C03, 0x01E83F03, 0x01E87802,
+    0x01E87A02, 0x01E88002, 0x01E88301, 0x01E88502, 0x01E88604, 0x01E89404, 0x01E8DE02, 0x01E8DF02, 0x01E8E002, 0x01E8F602, 0x01E90104, 0x01E95E04,
+    0x01E96301, 0x01E9AB02, 0x01E9AE01, 0x01E9B002, 0x01EB2402, 0x01EB2B02, 0x01EBB002, 0x01EBB202, 0x01EBB605, 0x01EBBB02, 0x01EBEA02, 0x01EBEB02,
+    0x01EBEC02, 0x01EBFF04, 0x01EC0704, 0x01EC0804, 0x01EC1304, 0x01EC1402, 0x01EC5C02, 0x01EC6802, 0x01EC6D04, 0x01EC7101, 0x01EC8402, 0x01EC8E02,
+    0x01ECAB02, 0x01ECB702, 0x01ECB902, 0x01ECBA02, 0x01ECBB04, 0x01ECBD02, 0x01ED0502, 0x01ED0602, 0x01ED0702, 0x01ED0802, 0x01ED3004, 0x01ED3104,
+    0x01ED3302, 0x01ED4B04, 0x01ED6702, 0x01ED7804, 0x01ED9C02, 0x01EDA302, 0x01EE6602, 0x01EE6902, 0x01EE6A02, 0x01EE7202, 0x01EE7A02, 0x01EE7B02,
+    0x01EE7D02, 0x01EEC502, 0x01EEC806, 0x01EECA02, 0x01EEE702, 0x01EF0D02, 0x01EF1202, 0x01EF1604, 0x01EF1902, 0x01EF4D02, 0x01EF6302, 0x01EFAA03,
+    0x01EFAC02, 0x01EFAD02, 0x01EFAF02, 0x01EFB002, 0x01EFDC01, 0x01F08706, 0x01F0A402, 0x01F17002, 0x01F21D02, 0x01F22502, 0x01F22602, 0x01F22702,
+    0x01F22802, 0x01F22D02, 0x01F22E02, 0x01F2B102, 0x01F2E204, 0x01F2F504, 0x01F30D02, 0x01F30E01, 0x01F33502, 0x01F36A02, 0x01F38102, 0x01F3BD02,
+    0x01F3C002, 0x01F3C102, 0x01F3CF02, 0x01F3D902, 0x01F3DB02, 0x01F42004, 0x01F42402, 0x01F42602, 0x01F42702, 0x01F42902, 0x01F42A02, 0x01F44004,
+    0x01F45E04, 0x01F46404, 0x01F46501, 0x01F46704, 0x01F47B04, 0x01F47C01, 0x01F48001, 0x01F48901, 0x01F4C304, 0x01F4D504, 0x01F4E904, 0x01F4F904,
+    0x01F59502, 0x01F5CE04, 0x01F5FC02, 0x01F60501, 0x01F63D01, 0x01F65203, 0x01F65302, 0x01F67704, 0x01F68404, 0x01F68E02, 0x01F69204, 0x01F75F02,
+    0x01F79604, 0x01F7E604, 0x01F7E704, 0x01F7EA04, 0x01F80001, 0x01F80804, 0x01F83A04, 0x01F85804, 0x01F85904, 0x01F8B504, 0x01F8B802, 0x01F94701,
+    0x01F99D04, 0x01F9FB04, 0x01FA1E04, 0x01FA2704, 0x01FB7A02, 0x01FB8204, 0x01FBC502, 0x01FBC602, 0x01FC2104, 0x01FC3102, 0x01FC8701, 0x01FC9902,
+    0x01FC9D04, 0x01FCAD02, 0x01FCB404, 0x01FD0604, 0x01FD5202, 0x01FD5302, 0x01FD5902, 0x01FD6405, 0x01FDBD02, 0x01FE3202, 0x01FE3802, 0x01FE5E02,
+    0x02000102, 0x02004F02, 0x02011303, 0x02013004, 0x02013B01, 0x02015404, 0x0201B702, 0x02023502, 0x02025201, 0x02029F01, 0x0202C802, 0x0202FE04,
+    0x02033602, 0x02033C06, 0x02036F02, 0x02037002, 0x02038B04, 0x02043D06, 0x02043E02, 0x02044802, 0x02044902, 0x02047502, 0x0204C401, 0x0204C501,
+    0x0204C601, 0x0204CE02, 0x0204EB06, 0x02053302, 0x02053402, 0x02053902, 0x02053B02, 0x02053D02, 0x02054904, 0x02056F02, 0x02057002, 0x02057202,
+    0x02057306, 0x02057502, 0x0205E202, 0x0205FB02, 0x0205FC02, 0x02060C02, 0x02060D02, 0x02060E02, 0x02060F02, 0x02061002, 0x02061102, 0x02061202,
+    0x02061302, 0x02063501, 0x02063C04, 0x02064004, 0x02066502, 0x02067401, 0x02067804, 0x02068204, 0x02068F04, 0x02069C02, 0x0206B402, 0x02075602,
+    0x02075702, 0x0207C704, 0x0207CA04, 0x0207D504, 0x0207DA01, 0x02080304, 0x02086F04, 0x02087604, 0x02088101, 0x0208A901, 0x0208CA04, 0x0208CF04,
+    0x0208D404, 0x0208F104, 0x02090101, 0x02090201, 0x02091304, 0x02093001, 0x02095701, 0x02096201, 0x0209DD01, 0x0209F201, 0x0209F301, 0x020A1604,
+    0x020A1704, 0x020AB304, 0x020B7404, 0x020B7B01, 0x020BAA04, 0x020C5001, 0x020C6504, 0x020CFC01, 0x020D4D02, 0x020D9101, 0x020E5504, 0x020EA501,
+    0x020EAA04, 0x020EDE04, 0x020F4102, 0x020F7502, 0x020F8C01, 0x020FBE01, 0x020FE601, 0x020FEA01, 0x020FF101, 0x02104504, 0x02106704, 0x02107504,
+    0x02107602, 0x02107802, 0x02108302, 0x02108D02, 0x0210A904, 0x0210CD02, 0x0210D102, 0x0210D202, 0x02114F04, 0x02119F01, 0x0211A004, 0x0211B102,
+    0x0211BC01, 0x0211BD05, 0x0211BE04, 0x0211F004, 0x02120D04, 0x02121402, 0x02121701, 0x02129704, 0x02137704, 0x0213A204, 0x0213B801, 0x02140101,
+    0x02140601, 0x02142701, 0x02144401, 0x02144501, 0x02148601, 0x02148D04, 0x0214E901, 0x0214EC04, 0x0214F604, 0x0214F704, 0x02150401, 0x02151F01,
+    0x02153F02, 0x02154101, 0x02158101, 0x02159E04, 0x02159F04, 0x0215A701, 0x0215BA02, 0x02167C04, 0x02169501, 0x0216B901, 0x0216BA01, 0x0216BD01,
+    0x02170401, 0x02171904, 0x02172D02, 0x02172E02, 0x02172F02, 0x02173002, 0x02173102, 0x02173202, 0x02173302, 0x02173402, 0x02173502, 0x02173602,
+    0x02173702, 0x02173802, 0x02173902, 0x02173A02, 0x02173B02, 0x02173C02, 0x02173D02, 0x02173E02, 0x02174002, 0x02174102, 0x02174202, 0x02174302,
+    0x02174402, 0x02174502, 0x02174602, 0x02174702, 0x02174802, 0x02174902, 0x02174A02, 0x02174B02, 0x02174C02, 0x02174D02, 0x02174E02, 0x02174F02,
+    0x02175002, 0x02175102, 0x02175202, 0x02175302, 0x02175402, 0x02175602, 0x02175702, 0x02175802, 0x02175902, 0x02175A02, 0x0217CF01, 0x0217D801,
+    0x0217D902, 0x0217DA02, 0x0217DB02, 0x0217E402, 0x0217F502, 0x0217F902, 0x0217FC01, 0x02185401, 0x02186801, 0x02187F04, 0x02189001, 0x02189A01,
+    0x02189B01, 0x02189E01, 0x0218A604, 0x0218A802, 0x0218B004, 0x0218C901, 0x0218E601, 0x0218EC02, 0x02190D01, 0x02192501, 0x02193A01, 0x02196502,
+    0x02196802, 0x02197D04, 0x02199302, 0x0219A702, 0x0219B601, 0x0219C001, 0x0219C401, 0x0219C501, 0x0219EA06, 0x0219ED01, 0x0219F404, 0x021A9C04,
+    0x021AF501, 0x021AF801, 0x021AFB01, 0x021AFC01, 0x021AFD01, 0x021B0E04, 0x021B6002, 0x021B6102, 0x021B6302, 0x021B7802, 0x021B8902, 0x021B8B02,
+    0x021B9202, 0x021B9501, 0x021BD801, 0x021BDB01, 0x021BDC01, 0x021BEA01, 0x021BEC01, 0x021BEF01, 0x021BF201, 0x021BFA01, 0x021BFF01, 0x021C0802,
+    0x021C1E01, 0x021C3701, 0x021C3801, 0x021C4E01, 0x021C8201, 0x021C9501, 0x021CBE02, 0x021CC604, 0x021CE501, 0x021CFC04, 0x021D3801, 0x021D4701,
+    0x021D4E02, 0x021D5402, 0x021D6C04, 0x021D7A01, 0x021DBA04, 0x021DC001, 0x021DC804, 0x021DC901, 0x021DCA04, 0x021DD301, 0x021DF701, 0x021E1E04,
+    0x021E3201, 0x021E4002, 0x021E4302, 0x021EA402, 0x021EFE01, 0x021EFF01, 0x021F0001, 0x021F0101, 0x021F4F01, 0x021F7801, 0x021F7901, 0x021F9F01,
+    0x021FDA02, 0x021FDB02, 0x02201F04, 0x02202D04, 0x02202E04, 0x02203901, 0x02203A01, 0x02206602, 0x02209504, 0x02209704, 0x02209804, 0x02209A04,
+    0x02209B04, 0x0220A101, 0x0220DD01, 0x0221FB04, 0x02221504, 0x02228A04, 0x0222BB04, 0x0222DA01, 0x02232E01, 0x02234701, 0x02234A04, 0x02237502,
+    0x02239104, 0x02239C02, 0x02239E02, 0x02239F02, 0x0223A002, 0x0223B001, 0x0223B201, 0x0223DC01, 0x0223E101, 0x0223F704, 0x02242704, 0x02245802,
+    0x02246002, 0x02246901, 0x02249D04, 0x0224B504, 0x0224D004, 0x0224D201, 0x0224FB04, 0x0224FD04, 0x02251001, 0x02254D01, 0x02255004, 0x02257501,
+    0x0225DA02, 0x0225DB02, 0x0225EE01, 0x0225FB01, 0x0225FE01, 0x02261104, 0x02262101, 0x02262201, 0x02262301, 0x02262401, 0x02262501, 0x02262601,
+    0x02263301, 0x02263E01, 0x02264401, 0x02265601, 0x02265A01, 0x02265D04, 0x02267201, 0x02267301, 0x0226C901, 0x0226CC04, 0x0226EC01, 0x02272601,
+    0x02277E04, 0x0227B304, 0x0227D004, 0x0227EA01, 0x0227F001, 0x02283E04, 0x02285504, 0x02287104, 0x02287501, 0x02289D01, 0x02289F01, 0x02291701,
+    0x02291901, 0x02291B01, 0x02291C01, 0x02292501, 0x02296801, 0x02296901, 0x02298001, 0x02298901, 0x02298E01, 0x0229AF01, 0x0229FA01, 0x022A2401,
+    0x022A5E02, 0x022A6F01, 0x022A8801, 0x022A8A01, 0x022A8F01, 0x022A9001, 0x022AC001, 0x022AD501, 0x022ADB01, 0x022AEC01, 0x022AED01, 0x022B1B01,
+    0x022B2201, 0x022B2301, 0x022B2A01, 0x022B3401, 0x022B6A01, 0x022B6C01, 0x022B7F01, 0x022B8001, 0x022B8304, 0x022B8701, 0x022BC401, 0x022BC501,
+    0x022BD001, 0x022BD101, 0x022BD301, 0x022BFA01, 0x022BFB01, 0x022C0E01, 0x022C1001, 0x022C1101, 0x022C1201, 0x022C1301, 0x022C4301, 0x022C4801,
+    0x022C4901, 0x022C5502, 0x022C6A01, 0x022C6B01, 0x022C7001, 0x022C9201, 0x022C9701, 0x022C9F01, 0x022CA001, 0x022CA101, 0x022CA201, 0x022DE304,
+    0x022E2F02, 0x022E5001, 0x022E5D01, 0x022E5F01, 0x022E9B01, 0x022EBC01, 0x022EBD01, 0x022EBE01, 0x022EBF01, 0x022EC301, 0x022EC401, 0x022EC501,
+    0x022EC601, 0x022F6B01, 0x022F7104, 0x022F8701, 0x022F9302, 0x022FC101, 0x022FDB06, 0x022FDD02, 0x022FDF01, 0x022FE001, 0x022FEE02, 0x02300601,
+    0x02300F02, 0x02301404, 0x02303401, 0x02303501, 0x02305C01, 0x02306301, 0x02306901, 0x0230A401, 0x0230B704, 0x0230CC01, 0x0230CE01, 0x0230CF01,
+    0x0230DB01, 0x0230DC01, 0x02313F01, 0x02314001, 0x02315901, 0x02315A01, 0x02317A01, 0x02319F01, 0x0231A801, 0x0231B701, 0x0231F001, 0x0231F101,
+    0x02323402, 0x02325701, 0x02328701, 0x0232A501, 0x0232A801, 0x0232D101, 0x0232F301, 0x0232F401, 0x0232F601, 0x02335A01, 0x02335C01, 0x0233C701,
+    0x0233CF01, 0x0233E501, 0x0233ED01, 0x0233EF01, 0x0233FF01, 0x02344B01, 0x02345201, 0x02345C01, 0x0234A701, 0x0234C501, 0x02350D01, 0x02353201,
+    0x02353501, 0x02353601, 0x02354301, 0x02354E01, 0x02355C01, 0x02357101, 0x02357201, 0x02357301, 0x02358801, 0x02358D01, 0x02359701, 0x0235A601,
+    0x0235C601, 0x02361901, 0x02363B01, 0x02364504, 0x02364804, 0x02366A04, 0x02367401, 0x0236A001, 0x0236AB02, 0x0236D402, 0x0236D503, 0x0236D603,
+    0x0236F104, 0x02370002, 0x02370103, 0x02370A02, 0x02372F01, 0x02373502, 0x02373D01, 0x02374201, 0x02374801, 0x02375601, 0x02375D01, 0x02377004,
+    0x02377701, 0x02378501, 0x0237C301, 0x0237FB01, 0x0237FE04, 0x0238D601, 0x0238DD02, 0x02390901, 0x02391501, 0x02391801, 0x02393301, 0x02393401,
+    0x02393601, 0x02393A02, 0x02393C02, 0x02395301, 0x02395401, 0x02396602, 0x02399901, 0x023A4901, 0x023AA101, 0x023AB201, 0x023AC802, 0x023ACA02,
+    0x023ACF02, 0x023AD002, 0x023ADE01, 0x023B0101, 0x023B0201, 0x023B3201, 0x023B3401, 0x023B3601, 0x023B3B01, 0x023BAB01, 0x023BBC01, 0x023BD101,
+    0x023BD301, 0x023BD601, 0x023BE401, 0x023BE601, 0x023BFA01, 0x023BFB01, 0x023C1401, 0x023C1B01, 0x023C3104, 0x023C3C01, 0x023C3D01, 0x023C3E01,
+    0x023C3F01, 0x023C6B01, 0x023C6C01, 0x023C9601, 0x023C9801, 0x023C9D01, 0x023C9F04, 0x023CA702, 0x023CAF01, 0x023CB101, 0x023CB401, 0x023CCD01,
+    0x023CDC02, 0x023CE602, 0x023CEE04, 0x023CF701, 0x023D0004, 0x023D0101, 0x023D1B04, 0x023D2F01, 0x023D3302, 0x023D3901, 0x023D4D01, 0x023D7F01,
+    0x023D8201, 0x023D8401, 0x023DBE01, 0x023DBF01, 0x023E0F02, 0x023E1E02, 0x023E2002, 0x023E2301, 0x023E2F01, 0x023E4F01, 0x023E5501, 0x023E5E04,
+    0x023E7404, 0x023E7902, 0x023E7C01, 0x023E8002, 0x023E8202, 0x023E8B01, 0x023E9104, 0x023E9204, 0x023E9E04, 0x023EC001, 0x023ED301, 0x023ED502,
+    0x023EEB01, 0x023F0D01, 0x023F2301, 0x023F2401, 0x023F5001, 0x023F5101, 0x023F5201, 0x023F5301, 0x023F5401, 0x023F5501, 0x023F6B01, 0x023F7501,
+    0x023F8001, 0x023F8701, 0x023F9E02, 0x023FA202, 0x023FA702, 0x023FB701, 0x023FBF01, 0x023FDC02, 0x023FE701, 0x02400902, 0x02400B02, 0x02400C02,
+    0x02400D02, 0x02400E02, 0x02400F02, 0x02401002, 0x02401102, 0x02401302, 0x02402202, 0x02406201, 0x02409004, 0x02409104, 0x02409701, 0x0240A404,
+    0x0240E804, 0x0240F901, 0x0240FD02, 0x02410104, 0x02411402, 0x02412102, 0x02414002, 0x02414702, 0x02414802, 0x02415F01, 0x02416C04, 0x02416E01,
+    0x02417501, 0x02417902, 0x0241A501, 0x0241AA01, 0x0241B304, 0x0241BA02, 0x0241BD02, 0x0241BE02, 0x0241C402, 0x0241D204, 0x0241D302, 0x0241D502,
+    0x0241E702, 0x0241FB02, 0x02420202, 0x02420302, 0x02420602, 0x02422804, 0x02422C02, 0x02422D02, 0x02422E02, 0x02422F02, 0x02423002, 0x02423102,
+    0x02423202, 0x02423302, 0x02423402, 0x02423502, 0x02423606, 0x02423702, 0x02424702, 0x02424802, 0x02426002, 0x02426702, 0x02426A02, 0x02426F02,
+    0x02427002, 0x02428202, 0x02428502, 0x02428902, 0x02428F02, 0x02429002, 0x02429202, 0x02429602, 0x0242A706, 0x0242AF01, 0x0242B901, 0x0242C101,
+    0x0242DB06, 0x02430701, 0x02430A01, 0x02430B01, 0x0243A101, 0x0243CE01, 0x0243F302, 0x02441E01, 0x02442804, 0x02443B01, 0x02443C01, 0x02443D01,
+    0x02443E01, 0x02446001, 0x02446E02, 0x0244EE01, 0x02450604, 0x02451901, 0x02452A01, 0x02457001, 0x02457B03, 0x0245BE01, 0x0245D804, 0x0245EA02,
+    0x0245EC02, 0x0245F701, 0x0245FC02, 0x0245FD02, 0x02460201, 0x02460C01, 0x02461001, 0x02462E01, 0x02462F01, 0x02463001, 0x02463101, 0x02463401,
+    0x02463501, 0x02463A01, 0x02463B01, 0x02467D01, 0x0246AA01, 0x0246B902, 0x0246C404, 0x0246D101, 0x0246D901, 0x02471C04, 0x02472001, 0x02477502,
+    0x0247A504, 0x0248BE01, 0x0248DA04, 0x0248DB04, 0x0248E801, 0x02494F01, 0x02495B01, 0x02496C01, 0x02497201, 0x02497301, 0x0249AE01, 0x0249CA01,
+    0x0249E502, 0x0249EC01, 0x0249F601, 0x0249F701, 0x024A1201, 0x024B1204, 0x024B2201, 0x024B3A01, 0x024B7401, 0x024B7F01, 0x024B8504, 0x024B9504,
+    0x024B9901, 0x024BAE01, 0x024BE804, 0x024C0F04, 0x024C3D04, 0x024C8901, 0x024CB104, 0x024CB501, 0x024CDC01, 0x024D0801, 0x024D0E01, 0x024D1901,
+    0x024D3E02, 0x024D4104, 0x024DD701, 0x024DE501, 0x024DE701, 0x024E2004, 0x024E6F01, 0x024EA901, 0x024EE401, 0x024EF801, 0x024F0401, 0x024F3F01,
+    0x024F9F01, 0x024FCF04, 0x024FD204, 0x024FD601, 0x024FE501, 0x02503201, 0x02504E01, 0x0250DF01, 0x0250E701, 0x02511401, 0x02514101, 0x02515201,
+    0x02516301, 0x02517901, 0x02518A01, 0x0251EA01, 0x0251ED01, 0x02522B02, 0x02522C06, 0x02523602, 0x02524F01, 0x02525606, 0x02525702, 0x02525802,
+    0x02526001, 0x02526B01, 0x02526F02, 0x02529201, 0x02529C02, 0x02529E02, 0x0252B402, 0x0252C502, 0x0252C702, 0x0252CB01, 0x0252D502, 0x0252D602,
+    0x0252D702, 0x0252D802, 0x0252F501, 0x0252F701, 0x02531001, 0x02531701, 0x02532C01, 0x02535801, 0x02536801, 0x02537F01, 0x02539001, 0x02539B01,
+    0x0253B301, 0x02541001, 0x02541B01, 0x02545801, 0x02547001, 0x02547201, 0x02547801, 0x0254AC01, 0x0254AE01, 0x0254BE01, 0x0254E601, 0x02551601,
+    0x02559301, 0x0255C601, 0x02563001, 0x02564801, 0x02567E01, 0x0256A101, 0x0256A904, 0x0256DD04, 0x0256E601, 0x02573001, 0x02573801, 0x02578901,
+    0x02579F01, 0x0257D902, 0x0257DC02, 0x0257FB02, 0x0257FC06, 0x02581001, 0x02581A02, 0x02582806, 0x02585C01, 0x02586D02, 0x02587E01, 0x02588801,
+    0x0258AC01, 0x0258BB01, 0x0258C101, 0x0258C901, 0x0258D001, 0x02591E01, 0x02593401, 0x0259A201, 0x0259BF01, 0x0259E104, 0x025A3001, 0x025A5104,
+    0x025A6201, 0x025A7301, 0x025A7801, 0x025A7901, 0x025ABD01, 0x025ACB01, 0x025AE901, 0x025AFA01, 0x025B1B04, 0x025B1F01, 0x025B5204, 0x025B6401,
+    0x025B6501, 0x025B8C01, 0x025B9401, 0x025BAD01, 0x025C0B01, 0x025C0C01, 0x025C7101, 0x025C9701, 0x025CA901, 0x025CB901, 0x025CD404, 0x025CD601,
+    0x025D0E01, 0x025D1802, 0x025D3A01, 0x025D4701, 0x025D4902, 0x025D4C01, 0x025D5001, 0x025D6D01, 0x025D6F01, 0x025D7501, 0x025D7601, 0x025DB001,
+    0x025DB101, 0x025DC201, 0x025DE501, 0x025E0B02, 0x025E0C02, 0x025E0D02, 0x025E1602, 0x025E1E06, 0x025E2003, 0x025E3301, 0x025E3401, 0x025E5C02,
+    0x025E5E01, 0x025E7701, 0x025E8702, 0x025EB201, 0x025EB601, 0x025EBB01, 0x025EBD01, 0x025EC201, 0x025ED601, 0x025EE501, 0x025EF001, 0x025F1F01,
+    0x025F5C01, 0x025F6B01, 0x025F6C01, 0x025F6D01, 0x025F6E01, 0x025F7001, 0x025F7201, 0x025F7701, 0x025F8A01, 0x025FBA02, 0x025FBC02, 0x025FD301,
+    0x025FE906, 0x025FEB02, 0x02600801, 0x02600901, 0x02601B02, 0x02602901, 0x02604A02, 0x02608102, 0x02608702, 0x02608E01, 0x02609102, 0x0260AA01,
+    0x0260BB02, 0x0260FC01, 0x02611301, 0x02616006, 0x02616402, 0x0261E501, 0x0261F401, 0x0261F602, 0x02621904, 0x02622901, 0x02622B01, 0x02623601,
+    0x02624F01, 0x02626901, 0x02627801, 0x02627F06, 0x02628901, 0x0262A202, 0x0262A301, 0x0262A401, 0x0262A702, 0x0262C401, 0x0262C501, 0x0262D601,
+    0x0262E501, 0x0262F101, 0x0262F401, 0x02630401, 0x02631601, 0x02631D01, 0x02632301, 0x02634001, 0x02635C01, 0x02635E01, 0x02636001, 0x02636F02,
+    0x02638401, 0x02638A01, 0x0263BB01, 0x0263BC01, 0x0263C901, 0x0263F801, 0x0263FC01, 0x02640101, 0x02640201, 0x02640301, 0x02640801, 0x02640A01,
+    0x02640E01, 0x02640F01, 0x02641001, 0x02641801, 0x02644802, 0x02644902, 0x02647201, 0x02647C04, 0x02649701, 0x02649801, 0x02649E01, 0x0264AB02,
+    0x0264AC01, 0x0264BB01, 0x0264D501, 0x0264D701, 0x0264DA01, 0x0264DD01, 0x0264E101, 0x0264E201, 0x0264EE02, 0x0264FC01, 0x02650A01, 0x02651C01,
+    0x02653B02, 0x02653C03, 0x02653D02, 0x02653E02, 0x02655701, 0x02655A01, 0x02656801, 0x02657702, 0x02657802, 0x02657F01, 0x02658001, 0x02658501,
+    0x02658701, 0x0265C206, 0x0265C802, 0x0265CB02, 0x0265E102, 0x02661C01, 0x02662C02, 0x02663F01, 0x02667302, 0x02668702, 0x02669306, 0x0266A406,
+    0x0266A901, 0x0266AA01, 0x0266AD01, 0x0266AF01, 0x0266B102, 0x0266BF02, 0x0266C602, 0x0266C802, 0x0266DF01, 0x0266E302, 0x0266EC01, 0x0266FA01,
+    0x02670202, 0x02670302, 0x02670402, 0x02670502, 0x02670702, 0x02673F03, 0x02674002, 0x02675B01, 0x02676401, 0x02676B01, 0x02677602, 0x02677B04,
+    0x0267CA02, 0x0267CC02, 0x0267D701, 0x0267DB01, 0x02682802, 0x02683102, 0x02683D02, 0x02685A01, 0x02685D01, 0x02686001, 0x02686401, 0x0268A601,
+    0x0268A702, 0x0268AF01, 0x0268B502, 0x0268B601, 0x0268C602, 0x0268C702, 0x0268C802, 0x0268C902, 0x0268CA02, 0x0268CB02, 0x0268CE02, 0x0268CF02,
+    0x0268D002, 0x0268FD01, 0x02691802, 0x02691903, 0x02691A03, 0x02691B03, 0x02691C06, 0x02691D06, 0x02692D06, 0x02693901, 0x02695001, 0x02695E01,
+    0x02696D01, 0x02697401, 0x02697801, 0x02697901, 0x02697A01, 0x02698401, 0x0269B701, 0x0269E902, 0x0269EC02, 0x0269F904, 0x026A0D06, 0x026A1E01,
+    0x026A2E01, 0x026A5301, 0x026AC601, 0x026ADD04, 0x026AFC01, 0x026B0C02, 0x026B0D02, 0x026B0E02, 0x026B2102, 0x026B2502, 0x026B2802, 0x026B4901,
+    0x026B5401, 0x026B8901, 0x026B9101, 0x026B9301, 0x026BA002, 0x026BB801, 0x026BDB01, 0x026C0302, 0x026C4602, 0x026C7B01, 0x026C9C01, 0x026D4401,
+    0x026D6101, 0x026D7801, 0x026D7C01, 0x026D8001, 0x026D8801, 0x026D8A01, 0x026DB801, 0x026DDB02, 0x026DE201, 0x026DED01, 0x026E0102, 0x026E1D01,
+    0x026E1F02, 0x026E3602, 0x026E4F01, 0x026E5F01, 0x026E8401, 0x026E9A04, 0x026EAF02, 0x026EB404, 0x026EB501, 0x026F1F01, 0x026F2001, 0x026F2E02,
+    0x026F2F02, 0x026F7B01, 0x026F7C01, 0x026FC601, 0x026FF502, 0x02702A02, 0x02702C02, 0x0270BB02, 0x0270C002, 0x0270D102, 0x0270D203, 0x0270D402,
+    0x0270EC01, 0x02710702, 0x02710B02, 0x02711202, 0x02711501, 0x02711601, 0x02711D02, 0x02711E02, 0x02711F02, 0x02712002, 0x02712102, 0x02712C02,
+    0x02713003, 0x02713102, 0x02713902, 0x02713A02, 0x02713C02, 0x02713F02, 0x02714102, 0x02714302, 0x02717601, 0x02717C06, 0x02718301, 0x02719B01,
+    0x0271A304, 0x0271B301, 0x0271B401, 0x0271BF01, 0x02722204, 0x02722601, 0x02722701, 0x02722D01, 0x02723501, 0x02725C01, 0x0272A901, 0x0272B401,
+    0x0272C402, 0x0272C702, 0x0272D301, 0x02730701, 0x02731101, 0x02731901, 0x02734401, 0x02739C01, 0x0273B301, 0x0273BE01, 0x0273BF01, 0x02740801,
+    0x0274AE02, 0x0274B502, 0x0274C301, 0x0274CE01, 0x0274E001, 0x02752401, 0x02753101, 0x02754101, 0x02755E01, 0x02757E01, 0x02758101, 0x02759504,
+    0x0275B001, 0x0275DA01, 0x0275DC01, 0x0275DD01, 0x0275DE01, 0x0275DF01, 0x0275E001, 0x0275E101, 0x02760701, 0x02760801, 0x02760901, 0x02764902,
+    0x02764A02, 0x02764B02, 0x02765C02, 0x02768201, 0x02768F01, 0x02769F01, 0x0276EB01, 0x02776301, 0x02776A02, 0x02776D01, 0x0277C404, 0x0277FF04,
+    0x02780004, 0x02780502, 0x02780901, 0x02780F01, 0x02781C01, 0x02782901, 0x02785E01, 0x02786601, 0x02787E01, 0x0278D001, 0x02792501, 0x02793801,
+    0x02793904, 0x02794704, 0x02794804, 0x0279C306, 0x0279D802, 0x0279E501, 0x027A2401, 0x027A2F01, 0x027A3301, 0x027A5D01, 0x027A7904, 0x027A9A01,
+    0x027A9B01, 0x027AB002, 0x027AB702, 0x027AB802, 0x027ABA01, 0x027AC002, 0x027ADC01, 0x027AE202, 0x027AE602, 0x027AE802, 0x027AE902, 0x027AEB02,
+    0x027AED06, 0x027AEF02, 0x027AF206, 0x027B1204, 0x027B3C01, 0x027B4304, 0x027B5401, 0x027B5C01, 0x027B8601, 0x027B8902, 0x027B8A02, 0x027B8B02,
+    0x027B8C02, 0x027B8D02, 0x027B8E02, 0x027BB901, 0x027BEA02, 0x027C7B01, 0x027C8201, 0x027CA001, 0x027CA101, 0x027CC304, 0x027D0102, 0x027D3901,
+    0x027D3A01, 0x027D4401, 0x027D4F04, 0x027D6501, 0x027D6902, 0x027D6A02, 0x027D8102, 0x027D8C02, 0x027DC702, 0x027DC802, 0x027DE601, 0x027DFC01,
+    0x027E1F01, 0x027E2001, 0x027E2501, 0x027E2E01, 0x027E4001, 0x027E5101, 0x027E5E01, 0x027EB102, 0x027ED001, 0x027ED301, 0x027EE606, 0x027F0601,
+    0x027F2101, 0x027F4F01, 0x027F5201, 0x027F5301, 0x027F7601, 0x027F7701, 0x027F8201, 0x027F9D01, 0x027F9E01, 0x027FAB01, 0x027FC801, 0x027FCA02,
+    0x027FCF04, 0x027FD501, 0x027FD605, 0x027FE002, 0x02802C04, 0x02803004, 0x02803C01, 0x02803F01, 0x02804B01, 0x02807A01, 0x0280E704, 0x02811D01,
+    0x02814301, 0x02814B01, 0x02815A01, 0x0281B102, 0x02821201, 0x02824E01, 0x02825404, 0x02827504, 0x02829204, 0x02829401, 0x0282F101, 0x02832201,
+    0x02832401, 0x02832B01, 0x02835A01, 0x02835B01, 0x02835C01, 0x02836D02, 0x02838001, 0x02838201, 0x02838301, 0x0283CC06, 0x0283CD01, 0x0283CF06,
+    0x0283F101, 0x0283F802, 0x0283F903, 0x0283FE02, 0x02847801, 0x02849C02, 0x0284D501, 0x02850701, 0x02851A04, 0x02852F01, 0x02853C01, 0x02854D01,
+    0x02856701, 0x02857C01, 0x02858201, 0x0285B101, 0x0285B201, 0x0285C101, 0x02864D01, 0x02864E01, 0x02865101, 0x02867601, 0x02868001, 0x0286C104,
+    0x0286E701, 0x02873601, 0x02875304, 0x02875504, 0x02875704, 0x02876A04, 0x02876D04, 0x02877504, 0x0287BA01, 0x0287D701, 0x0287F204, 0x0287F304,
+    0x0287FC04, 0x02884902, 0x02884A02, 0x02885001, 0x02887201, 0x02887401, 0x02888101, 0x0288C401, 0x02891801, 0x02891901, 0x02892002, 0x02892501,
+    0x02892602, 0x02893101, 0x02893201, 0x02893301, 0x02893401, 0x02893901, 0x02893A01, 0x02894C01, 0x02894D02, 0x02894E01, 0x02895A04, 0x02896204,
+    0x02899001, 0x02899501, 0x0289A801, 0x0289F001, 0x0289F401, 0x0289F601, 0x0289FC01, 0x028A0001, 0x028A0401, 0x028A1501, 0x028A2902, 0x028A3301,
+    0x028A3801, 0x028A5001, 0x028AA101, 0x028AAF01, 0x028AB701, 0x028ACC04, 0x028AD702, 0x028AED04, 0x028AEE01, 0x028AF602, 0x028B1601, 0x028B2001,
+    0x028B2101, 0x028B2201, 0x028B4A01, 0x028B7001, 0x028B9F04, 0x028BA401, 0x028BD004, 0x028BD301, 0x028BE101, 0x028BEC01, 0x028C0E01, 0x028C4F04,
+    0x028C6101, 0x028C6C01, 0x028C6E01, 0x028C6F01, 0x028C7301, 0x028C7601, 0x028CAE01, 0x028CC106, 0x028CE101, 0x028CE502, 0x028CE702, 0x028CE902,
+    0x028CEF02, 0x028CF003, 0x028CF401, 0x028D4A04, 0x028D5C01, 0x028D6401, 0x028D6601, 0x028D8401, 0x028D9001, 0x028DAE01, 0x028DF501, 0x028E5F01,
+    0x028EEF01, 0x028EF101, 0x028EF901, 0x028F0201, 0x028F3B01, 0x028F8204, 0x028FB601, 0x02903601, 0x02903904, 0x02903A04, 0x0290E701, 0x02910601,
+    0x02910701, 0x02912601, 0x0291BC04, 0x02920D01, 0x02920E01, 0x02920F01, 0x02921001, 0x02924301, 0x02925602, 0x02926801, 0x0292F302, 0x02937302,
+    0x02937601, 0x02937D01, 0x0293AD06, 0x0293AE06, 0x0293AF06, 0x0293B006, 0x0293B106, 0x0293FB04, 0x02942401, 0x02943701, 0x02943A02, 0x02946A01,
+    0x02946B01, 0x02947F01, 0x02957B02, 0x02957C03, 0x02957F01, 0x0295A301, 0x0295A401, 0x0295A501, 0x0295D204, 0x0295D504, 0x02960A02, 0x02961701,
+    0x02961D01, 0x02962E01, 0x02963001, 0x02963101, 0x02966001, 0x02967901, 0x0296AF01, 0x02970D01, 0x02974601, 0x02977201, 0x0297EC01, 0x02981901,
+    0x02983701, 0x02983901, 0x02983A01, 0x02984F01, 0x02986F01, 0x02987B01, 0x02988301, 0x02988601, 0x0298A901, 0x0298C006, 0x0298C104, 0x0298ED01,
+    0x0298F401, 0x02995F01, 0x02997001, 0x02997502, 0x02997602, 0x02997702, 0x02997802, 0x02997902, 0x02997A02, 0x02997B02, 0x02997C02, 0x02998401,
+    0x02998602, 0x02998902, 0x02998B06, 0x0299A301, 0x0299C304, 0x0299D001, 0x029A0F01, 0x029A1004, 0x029A4301, 0x029A5902, 0x029A5A02, 0x029A5B02,
+    0x029A5C02, 0x029A8D04, 0x029A9004, 0x029AA401, 0x029AA502, 0x029AB704, 0x029B0901, 0x029B0C04, 0x029B1A01, 0x029B3C01, 0x029B4C04, 0x029B5201,
+    0x029B5301, 0x029B6304, 0x029BF302, 0x029BF402, 0x029C0302, 0x029C0402, 0x029C0602, 0x029C0906, 0x029C0A06, 0x029C0D02, 0x029C0F02, 0x029C1301,
+    0x029C1604, 0x029C2104, 0x029C3301, 0x029C8202, 0x029C8302, 0x029C8402, 0x029C9002, 0x029C9202, 0x029C9406, 0x029D6201, 0x029DBE06, 0x029DC106,
+    0x029E0404, 0x029E0D01, 0x029E0E01, 0x029E0F01, 0x029E3404, 0x029E7E01, 0x029E8002, 0x029E8301, 0x029E8C01, 0x029F1B02, 0x029F1D04, 0x029F1F04,
+    0x029F4C04, 0x029F5204, 0x029F5F01, 0x029F7302, 0x029FA501, 0x029FC702, 0x029FCE02, 0x02A00601, 0x02A02501, 0x02A02701, 0x02A03201, 0x02A03A01,
+    0x02A07F01, 0x02A11F02, 0x02A12002, 0x02A12102, 0x02A13101, 0x02A13A01, 0x02A15A01, 0x02A18201, 0x02A19401, 0x02A1A801, 0x02A1D102, 0x02A1FA04,
+    0x02A28201, 0x02A28D01, 0x02A28F01, 0x02A2B301, 0x02A2B804, 0x02A30C01, 0x02A30E01, 0x02A31501, 0x02A34B01, 0x02A35301, 0x02A37501, 0x02A38C01,
+    0x02A39301, 0x02A39401, 0x02A3A601, 0x02A3C001, 0x02A3D001, 0x02A3D301, 0x02A3F304, 0x02A3FA01, 0x02A43101, 0x02A44C01, 0x02A45A01, 0x02A45D01,
+    0x02A46001, 0x02A46D01, 0x02A47F02, 0x02A48002, 0x02A48601, 0x02A48701, 0x02A48801, 0x02A48C01, 0x02A49501, 0x02A49B01, 0x02A4A301, 0x02A4A401,
+    0x02A4BC01, 0x02A58D01, 0x02A59D01, 0x02A5B003, 0x02A5B304, 0x02A5DD01, 0x02A5E901, 0x02A5F601, 0x02A60F01, 0x02A61701, 0x02A61801, 0x02A62B01,
+    0x02A64801, 0x02A68201, 0x02A6E201, 0x02A70301, 0x02A70601, 0x02A70702, 0x02A70802, 0x02A70902, 0x02A71301, 0x02A72801, 0x02A74001, 0x02A75001,
+    0x02A75101, 0x02A75401, 0x02A76101, 0x02A76301, 0x02A77301, 0x02A77C01, 0x02A78301, 0x02A78501, 0x02A79001, 0x02A79401, 0x02A7A501, 0x02A7A601,
+    0x02A7B501, 0x02A7C301, 0x02A7C901, 0x02A7CB01, 0x02A7CC01, 0x02A7CE01, 0x02A80401, 0x02A80901, 0x02A81901, 0x02A84701, 0x02A8FD02, 0x02A94501,
+    0x02A9AF01, 0x02AA7001, 0x02AA7B01, 0x02AA8201, 0x02AA8401, 0x02AA9301, 0x02AA9601, 0x02AA9701, 0x02AB0104, 0x02AB0D01, 0x02AB1A01, 0x02AB1F01,
+    0x02AB5002, 0x02AB5701, 0x02AB5C01, 0x02AB6E01, 0x02AB7101, 0x02AB8401, 0x02AB8601, 0x02AB8801, 0x02AB9201, 0x02AB9B04, 0x02ABA004, 0x02ABA104,
+    0x02ABA301, 0x02ABE501, 0x02AC2D01, 0x02AC2E01, 0x02AC4D01, 0x02AC5501, 0x02AC9B04, 0x02ACBE01, 0x02ACC101, 0x02ACCC01, 0x02AD0801, 0x02AD1C04,
+    0x02AD2402, 0x02AD3C01, 0x02AD4301, 0x02AD4E01, 0x02AD5B01, 0x02AD6201, 0x02AD6401, 0x02AD7C01, 0x02AD8101, 0x02AD9201, 0x02ADA301, 0x02ADB801,
+    0x02ADB901, 0x02ADC201, 0x02ADC701, 0x02ADD501, 0x02ADD901, 0x02ADE101, 0x02ADE401, 0x02ADE601, 0x02ADE801, 0x02ADEB01, 0x02ADEC01, 0x02ADED01,
+    0x02ADF501, 0x02AE1A01, 0x02AE1B01, 0x02AE4202, 0x02AE4602, 0x02AE5102, 0x02AE6A01, 0x02AE7301, 0x02AEB101, 0x02AEBE04, 0x02AEDD04, 0x02AEE501,
+    0x02AEE603, 0x02AF2B04, 0x02AF2F01, 0x02AF3C01, 0x02AF3D01, 0x02AF4601, 0x02AF4A01, 0x02AF7002, 0x02AF7502, 0x02AF8401, 0x02AF9B01, 0x02AFA401,
+    0x02AFA804, 0x02AFCC01, 0x02AFD401, 0x02AFD501, 0x02AFE101, 0x02AFF201, 0x02AFF701, 0x02B00E04, 0x02B01201, 0x02B02201, 0x02B05701, 0x02B05801,
+    0x02B07001, 0x02B07102, 0x02B07202, 0x02B07302, 0x02B07402, 0x02B07502, 0x02B07602, 0x02B07702, 0x02B07802, 0x02B07C01, 0x02B08701, 0x02B08A01,
+    0x02B09501, 0x02B0AE01, 0x02B0AF01, 0x02B0B301, 0x02B0B401, 0x02B0B701, 0x02B0C401, 0x02B0C501, 0x02B0C704, 0x02B0D701, 0x02B0DF02, 0x02B0EA01,
+    0x02B0EB01, 0x02B0F601, 0x02B10301, 0x02B10501, 0x02B13D01, 0x02B14601, 0x02B15901, 0x02B15B01, 0x02B17801, 0x02B1BD01, 0x02B1D401, 0x02B1D801,
+    0x02B22C01, 0x02B22F01, 0x02B23601, 0x02B25601, 0x02B26301, 0x02B26901, 0x02B26D01, 0x02B27601, 0x02B2A401, 0x02B2A701, 0x02B2A901, 0x02B2B601,
+    0x02B2CF01, 0x02B2D201, 0x02B2D501, 0x02B2D801, 0x02B2D901, 0x02B2DC01, 0x02B41502, 0x02B41601, 0x02B48904, 0x02B4C102, 0x02B4E101, 0x02B4F601,
+    0x02B4F901, 0x02B50B02, 0x02B52701, 0x02B53701, 0x02B58E01, 0x02B59E04, 0x02B5AA01, 0x02B5DA01, 0x02B5E601, 0x02B60501, 0x02B64101, 0x02B64201,
+    0x02B65901, 0x02B68E01, 0x02B69C01, 0x02B6B901, 0x02B6F001, 0x02B6F201, 0x02B70901, 0x02B73402, 0x02B74201, 0x02B75904, 0x02B75A04, 0x02B76801,
+    0x02B79602, 0x02B7AD01, 0x02B7C002, 0x02B7C102, 0x02B7D101, 0x02B7E902, 0x02B7EC01, 0x02B7FD02, 0x02B81C01, 0x02B83C02, 0x02B8A202, 0x02B8A502,
+    0x02B8A602, 0x02B8A902, 0x02B8BF02, 0x02B8C002, 0x02B8F001, 0x02B8F801, 0x02B90201, 0x02B90901, 0x02B91402, 0x02B91502, 0x02B93601, 0x02B93E01,
+    0x02B95E01, 0x02B95F01, 0x02B96F01, 0x02B99701, 0x02B9A901, 0x02B9AC01, 0x02B9AD01, 0x02B9C101, 0x02B9C301, 0x02B9C601, 0x02B9C701, 0x02B9DC01,
+    0x02B9DE01, 0x02B9F804, 0x02B9FD01, 0x02B9FE01, 0x02BA0001, 0x02BA0201, 0x02BA0401, 0x02BA0601, 0x02BA1B01, 0x02BA1C02, 0x02BA1D02, 0x02BA3B01,
+    0x02BA6004, 0x02BA6204, 0x02BA6F01, 0x02BA7101, 0x02BA7804, 0x02BA7F02, 0x02BA8302, 0x02BAE901, 0x02BAEF02, 0x02BAF002, 0x02BAFC02, 0x02BB1303,
+    0x02BB2002, 0x02BB7106, 0x02BB7A01, 0x02BB9704, 0x02BB9804, 0x02BBB001, 0x02BC0201, 0x02BC1902, 0x02BCD301, 0x02BCD804, 0x02BCD904, 0x02BCF701,
+    0x02BD1801, 0x02BD3301, 0x02BD5A02, 0x02BD6901, 0x02BD6A01, 0x02BD6C04, 0x02BD7A01, 0x02BD8601, 0x02BDB001, 0x02BDE801, 0x02BE1301, 0x02BE9901,
+    0x02BEB901, 0x02BF0A01, 0x02BF1B01, 0x02BF3101, 0x02BF6F01, 0x02BF7E01, 0x02BFC401, 0x02C01601, 0x02C02E01, 0x02C04206, 0x02C04901, 0x02C05801,
+    0x02C09701, 0x02C09F01, 0x02C0A101, 0x02C0B704, 0x02C0E004, 0x02C0E601, 0x02C0E701, 0x02C0FA01, 0x02C13601, 0x02C14001, 0x02C15901, 0x02C15F01,
+    0x02C18402, 0x02C1C201, 0x02C22D04, 0x02C26001, 0x02C26601, 0x02C28501, 0x02C29E01, 0x02C2AD01, 0x02C2B601, 0x02C2BE01, 0x02C36201, 0x02C36E01,
+    0x02C3CD02, 0x02C40C01, 0x02C41C01, 0x02C42101, 0x02C42F01, 0x02C43D01, 0x02C44801, 0x02C48602, 0x02C49501, 0x02C4F401, 0x02C4F501, 0x02C4FA01,
+    0x02C50A01, 0x02C57101, 0x02C59501, 0x02C5E901, 0x02C5F401, 0x02C61204, 0x02C63E01, 0x02C64101, 0x02C66B01, 0x02C68101, 0x02C68801, 0x02C69702,
+    0x02C6C101, 0x02C6FB01, 0x02C72401, 0x02C74201, 0x02C74A01, 0x02C76101, 0x02C78501, 0x02C78F01, 0x02C79B01, 0x02C7AD01, 0x02C7B901, 0x02C7BA01,
+    0x02C7D501, 0x02C7DA02, 0x02C82501, 0x02C8C901, 0x02C8D001, 0x02C8E002, 0x02C8E102, 0x02C90302, 0x02C91801, 0x02C92001, 0x02C94801, 0x02C96B01,
+    0x02C9AC04, 0x02C9F804, 0x02CA1F01, 0x02CA3001, 0x02CA5801, 0x02CADB01, 0x02CB9D04, 0x02CBB202, 0x02CBB501, 0x02CBBA01, 0x02CBC601, 0x02CBD704,
+    0x02CC1901, 0x02CC1D01, 0x02CC3A05, 0x02CC6F01, 0x02CC7702, 0x02CC9701, 0x02CCE301, 0x02CD0E01, 0x02CD1104, 0x02CD2201, 0x02CD2D04, 0x02CD3A01,
+    0x02CD4904, 0x02CD8D01, 0x02CD9801, 0x02CDAC02, 0x02CDAD02, 0x02CDAE02, 0x02CDB601, 0x02CDC301, 0x02CDC802, 0x02CDCC01, 0x02CDCF01, 0x02CDD401,
+    0x02CDD501, 0x02CDD601, 0x02CDD701, 0x02CDD804, 0x02CDE202, 0x02CDE502, 0x02CDE602, 0x02CDF301, 0x02CE0302, 0x02CE0801, 0x02CE3201, 0x02CE3401,
+    0x02CE5D01, 0x02CE6001, 0x02CE6301, 0x02CE6502, 0x02CEBD02, 0x02CEBE02, 0x02CECF01, 0x02CED001, 0x02CED101, 0x02CF0301, 0x02CF0401, 0x02CF3601,
+    0x02CF3D01, 0x02CF7201, 0x02CF7B01, 0x02CF8404, 0x02CFA001, 0x02CFC201, 0x02D02902, 0x02D02A02, 0x02D02C03, 0x02D02F02, 0x02D03F01, 0x02D04C01,
+    0x02D04E01, 0x02D05B01, 0x02D05F01, 0x02D07301, 0x02D08101, 0x02D08201, 0x02D09801, 0x02D09901, 0x02D09D04, 0x02D0D901, 0x02D0E201, 0x02D0EF01,
+    0x02D0FF06, 0x02D11E01, 0x02D14C01, 0x02D14F01, 0x02D15602, 0x02D16401, 0x02D16901, 0x02D17103, 0x02D18306, 0x02D18506, 0x02D19004, 0x02D19104,
+    0x02D1AB02, 0x02D1B702, 0x02D1CA02, 0x02D1CF02, 0x02D1F101, 0x02D20B02, 0x02D21904, 0x02D21A01, 0x02D22A01, 0x02D23401, 0x02D23501, 0x02D24301,
+    0x02D28801, 0x02D29601, 0x02D29E01, 0x02D2E901, 0x02D2EA01, 0x02D2F201, 0x02D2FE02, 0x02D30A01, 0x02D30B06, 0x02D32302, 0x02D32704, 0x02D32801,
+    0x02D34C02, 0x02D35001, 0x02D35201, 0x02D37202, 0x02D37402, 0x02D37801, 0x02D39601, 0x02D39701, 0x02D39A01, 0x02D39C02, 0x02D39D02, 0x02D3D804,
+    0x02D3DA04, 0x02D3DF03, 0x02D3E102, 0x02D3E202, 0x02D3E901, 0x02D40501, 0x02D40E06, 0x02D41802, 0x02D42402, 0x02D42902, 0x02D42B01, 0x02D42F01,
+    0x02D43304, 0x02D43A02, 0x02D43C01, 0x02D44B04, 0x02D44E02, 0x02D45E06, 0x02D4AD01, 0x02D4AF01, 0x02D4B101, 0x02D4B601, 0x02D4C101, 0x02D4CA01,
+    0x02D4CB01, 0x02D4CD01, 0x02D4CE01, 0x02D4CF01, 0x02D4D101, 0x02D4DD06, 0x02D51801, 0x02D51D01, 0x02D51E01, 0x02D53801, 0x02D59801, 0x02D5A306,
+    0x02D5BD02, 0x02D5BF02, 0x02D5C305, 0x02D5CB01, 0x02D5D104, 0x02D5E801, 0x02D5FF06, 0x02D60001, 0x02D62501, 0x02D63402, 0x02D63502, 0x02D63602,
+    0x02D63702, 0x02D63C02, 0x02D67B01, 0x02D6A001, 0x02D6BE01, 0x02D6D602, 0x02D70C01, 0x02D71501, 0x02D74504, 0x02D74B01, 0x02D75702, 0x02D75802,
+    0x02D75902, 0x02D78501, 0x02D78E02, 0x02D79102, 0x02D79202, 0x02D79402, 0x02D79902, 0x02D79E06, 0x02D7AB02, 0x02D7AE02, 0x02D7B102, 0x02D7D002,
+    0x02D7E101, 0x02D7EE01, 0x02D80202, 0x02D80402, 0x02D81306, 0x02D81902, 0x02D81C02, 0x02D82801, 0x02D85402, 0x02D86504, 0x02D86A04, 0x02D88E01,
+    0x02D89E01, 0x02D8D001, 0x02D8F801, 0x02D90101, 0x02D93801, 0x02D93901, 0x02D95002, 0x02D95102, 0x02D95202, 0x02D96002, 0x02D96302, 0x02D96406,
+    0x02D97602, 0x02D97702, 0x02D97806, 0x02D98102, 0x02D98702, 0x02D99201, 0x02D99502, 0x02D99702, 0x02D9A402, 0x02D9B002, 0x02D9B202, 0x02D9BB02,
+    0x02D9C902, 0x02D9EE01, 0x02D9F904, 0x02D9FE02, 0x02DA0A02, 0x02DA1602, 0x02DA2F02, 0x02DA3401, 0x02DA3602, 0x02DA3D02, 0x02DA4002, 0x02DA4102,
+    0x02DA4601, 0x02DA5804, 0x02DA5B04, 0x02DA6001, 0x02DA9D01, 0x02DA9E01, 0x02DAA101, 0x02DAD804, 0x02DAED01, 0x02DB0804, 0x02DB0D02, 0x02DB2E01,
+    0x02DB2F01, 0x02DB5801, 0x02DB6F02, 0x02DB7302, 0x02DB7701, 0x02DB7A02, 0x02DB8002, 0x02DB8902, 0x02DB8C02, 0x02DB9702, 0x02DB9C02, 0x02DBA502,
+    0x02DBA802, 0x02DBAE02, 0x02DBB102, 0x02DBB602, 0x02DBB902, 0x02DBEA02, 0x02DBF902, 0x02DC0206, 0x02DC1402, 0x02DC1C04, 0x02DC3302, 0x02DC3801,
+    0x02DC3C02, 0x02DCAD04, 0x02DCCF01, 0x02DCD001, 0x02DCD101, 0x02DCD201, 0x02DCF001, 0x02DD0202, 0x02DD0302, 0x02DD0A01, 0x02DD0C01, 0x02DD1701,
+    0x02DD1D03, 0x02DD2002, 0x02DD3202, 0x02DD3302, 0x02DD3402, 0x02DD3701, 0x02DD3B02, 0x02DD3C06, 0x02DD4B02, 0x02DD4C02, 0x02DD7D04, 0x02DD8B01,
+    0x02DD8C01, 0x02DDB302, 0x02DDDD01, 0x02DDE206, 0x02DDE602, 0x02DDE802, 0x02DDE902, 0x02DDF202, 0x02DE5701, 0x02DE6602, 0x02DE6904, 0x02DE7001,
+    0x02DE7201, 0x02DE8B01, 0x02DE8E04, 0x02DEB701, 0x02DF0002, 0x02DF1001, 0x02DF1302, 0x02DF1401, 0x02DF1A02, 0x02DF1B02, 0x02DF1C02, 0x02DF2406,
+    0x02DF3301, 0x02DF3402, 0x02DF3606, 0x02DF7302, 0x02DF8202, 0x02DFD102, 0x02DFD202, 0x02DFD402, 0x02DFDB02, 0x02DFE506, 0x02DFEB01, 0x02E01B06,
+    0x02E02201, 0x02E04301, 0x02E04401, 0x02E04E01, 0x02E05204, 0x02E05302, 0x02E05502, 0x02E05901, 0x02E06301, 0x02E06501, 0x02E06801, 0x02E09701,
+    0x02E09B01, 0x02E09E01, 0x02E0B002, 0x02E0C802, 0x02E0CA06, 0x02E0CB01, 0x02E0D802, 0x02E0DB02, 0x02E0DF02, 0x02E0E402, 0x02E0E702, 0x02E0EA02,
+    0x02E0EB02, 0x02E0ED02, 0x02E0F404, 0x02E0FB04, 0x02E10002, 0x02E10601, 0x02E10B02, 0x02E11B01, 0x02E15C04, 0x02E16006, 0x02E16A02, 0x02E16F02,
+    0x02E17C01, 0x02E19501, 0x02E1B001, 0x02E1B401, 0x02E1BF01, 0x02E1CF01, 0x02E1F006, 0x02E1FC04, 0x02E1FF04, 0x02E20704, 0x02E21804, 0x02E24601,
+    0x02E27102, 0x02E27602, 0x02E27804, 0x02E27E01, 0x02E28302, 0x02E28802, 0x02E29802, 0x02E29E02, 0x02E2A402, 0x02E2A802, 0x02E2A902, 0x02E2B602,
+    0x02E2B702, 0x02E2B806, 0x02E2D802, 0x02E2DB02, 0x02E2E202, 0x02E2EB01, 0x02E2EC02, 0x02E2F502, 0x02E2FB02, 0x02E2FC02, 0x02E2FD02, 0x02E30002,
+    0x02E30102, 0x02E30202, 0x02E30402, 0x02E31301, 0x02E32001, 0x02E32501, 0x02E32606, 0x02E32702, 0x02E34102, 0x02E34502, 0x02E35C01, 0x02E40801,
+    0x02E41901, 0x02E44601, 0x02E44B01, 0x02E45B01, 0x02E47801, 0x02E4EF01, 0x02E51806, 0x02E51B06, 0x02E51C04, 0x02E52A01, 0x02E53002, 0x02E53502,
+    0x02E53702, 0x02E53A02, 0x02E53D02, 0x02E54002, 0x02E54802, 0x02E54C02, 0x02E55B02, 0x02E56502, 0x02E56802, 0x02E59902, 0x02E59D02, 0x02E59E02,
+    0x02E5A102, 0x02E5AE02, 0x02E5B004, 0x02E5C301, 0x02E5E302, 0x02E5E402, 0x02E5E602, 0x02E5FD02, 0x02E60801, 0x02E61001, 0x02E61101, 0x02E61201,
+    0x02E61301, 0x02E61401, 0x02E61601, 0x02E64302, 0x02E64802, 0x02E64F01, 0x02E65001, 0x02E65C01, 0x02E65D01, 0x02E66101, 0x02E66902, 0x02E66A02,
+    0x02E66C01, 0x02E66F01, 0x02E67601, 0x02E6E902, 0x02E6EE04, 0x02E6F201, 0x02E6FA01, 0x02E71704, 0x02E73001, 0x02E73102, 0x02E76F02, 0x02E77A04,
+    0x02E77C04, 0x02E78002, 0x02E78501, 0x02E79402, 0x02E79506, 0x02E7BF01, 0x02E7CB02, 0x02E7DB02, 0x02E7E502, 0x02E7E602, 0x02E7EE02, 0x02E7EF02,
+    0x02E7F102, 0x02E7F802, 0x02E7F902, 0x02E7FE02, 0x02E80302, 0x02E80D01, 0x02E81201, 0x02E81802, 0x02E81E02, 0x02E82702, 0x02E82B02, 0x02E82D02,
+    0x02E83202, 0x02E83302, 0x02E83802, 0x02E84102, 0x02E84502, 0x02E86702, 0x02E89601, 0x02E8B202, 0x02E8B802, 0x02E8B902, 0x02E8CD02, 0x02E8D401,
+    0x02E8F802, 0x02E91001, 0x02E91402, 0x02E92702, 0x02E93A02, 0x02E93C06, 0x02E93E02, 0x02E93F02, 0x02E94002, 0x02E94102, 0x02E94202, 0x02E95F04,
+    0x02E96702, 0x02E98402, 0x02E98602, 0x02E99101, 0x02E9B402, 0x02E9C801, 0x02E9C901, 0x02E9CA01, 0x02E9CD02, 0x02E9CF02, 0x02E9D006, 0x02E9D302,
+    0x02EA0806, 0x02EA3A02, 0x02EA3D06, 0x02EA4306, 0x02EA4602, 0x02EA4802, 0x02EA5E04, 0x02EAD002, 0x02EAED04, 0x02EB0902, 0x02EB0C02, 0x02EB1701,
+    0x02EB5B02, 0x02EB6002, 0x02EB6602, 0x02EB6702, 0x02EB6802, 0x02EB6B02, 0x02EB6E02, 0x02EB9802, 0x02EBA502, 0x02EBB502, 0x02EBB602, 0x02EBB702,
+    0x02EBBB02, 0x02EBC302, 0x02EBC402, 0x02EBC902, 0x02EBFD02, 0x02EC0002, 0x02EC0402, 0x02EC0502, 0x02EC0602, 0x02EC0B02, 0x02EC1002, 0x02EC1802,
+    0x02EC4601, 0x02EC4701, 0x02EC4D02, 0x02EC5102, 0x02EC5402, 0x02EC5902, 0x02EC5E02, 0x02EC6002, 0x02EC6302, 0x02EC6702, 0x02EC6802, 0x02EC6902,
+    0x02EC6A02, 0x02EC6E02, 0x02EC9402, 0x02EC9502, 0x02EC9901, 0x02EC9C01, 0x02EC9F02, 0x02ECA202, 0x02ECB801, 0x02ECB901, 0x02ECC506, 0x02ECE502,
+    0x02ECE702, 0x02ECE902, 0x02ECEE06, 0x02ECEF02, 0x02ECF002, 0x02ECF102, 0x02ECF202, 0x02ECF302, 0x02ECF404, 0x02ECF502, 0x02ECFA02, 0x02ECFC02,
+    0x02ECFD02, 0x02ED0202, 0x02ED0302, 0x02ED0402, 0x02ED0E06, 0x02ED0F02, 0x02ED1002, 0x02ED1404, 0x02ED1901, 0x02ED1B01, 0x02ED1E01, 0x02ED2501,
+    0x02ED2701, 0x02ED3501, 0x02ED3601, 0x02ED3704, 0x02ED4701, 0x02ED4801, 0x02ED5D02, 0x02ED6002, 0x02ED7001, 0x02ED7201, 0x02ED8502, 0x02ED9602,
+    0x02EDEC01, 0x02EDF601, 0x02EE2501, 0x02EE2601, 0x02EE3401, 0x02EE3702, 0x02EE3A02, 0x02EE3F02, 0x02EE4202, 0x02EE4D02, 0x02EE4E02, 0x02EE5102,
+    0x02EE5202, 0x02EE5502, 0x02EE5706, 0x02EE5802, 0x02EE5A02, 0x02EE6504, 0x02EE6A02, 0x02EE6D06, 0x02EE7401, 0x02EEB204, 0x02EEB801, 0x02EED701,
+    0x02EEDE02, 0x02EEDF02, 0x02EEE202, 0x02EEE706, 0x02EEEA02, 0x02EEEB02, 0x02EEF602, 0x02EEF702, 0x02EEF902, 0x02EF3602, 0x02EF3B02, 0x02EF3E02,
+    0x02EF4302, 0x02EF4602, 0x02EF4902, 0x02EF5902, 0x02EF5D02, 0x02EF7802, 0x02EF7C02, 0x02EF8002, 0x02EF9901, 0x02EFA602, 0x02EFA802, 0x02EFA902,
+    0x02EFAC02, 0x02EFAE01, 0x02EFAF02, 0x02EFB002, 0x02EFB206, 0x02EFB702, 0x02EFBF02, 0x02EFC202, 0x02EFC502, 0x02EFC902, 0x02EFCC02, 0x02EFD002,
+    0x02F00202, 0x02F01A02, 0x02F01E02, 0x02F01F02, 0x02F02002, 0x02F02402, 0x02F02C01, 0x02F02D02, 0x02F02E02, 0x02F02F02, 0x02F03602, 0x02F03702,
+    0x02F03A02, 0x02F04502, 0x02F05B01, 0x02F06306, 0x02F06F02, 0x02F07002, 0x02F07102, 0x02F07602, 0x02F07B01, 0x02F08B04, 0x02F09102, 0x02F09406,
+    0x02F09502, 0x02F0F702, 0x02F0F802, 0x02F12001, 0x02F12101, 0x02F15502, 0x02F19B02, 0x02F19D02, 0x02F1AB02, 0x02F1B106, 0x02F1BB04, 0x02F1DF04,
+    0x02F1F101, 0x02F21701, 0x02F22101, 0x02F22202, 0x02F22301, 0x02F22702, 0x02F22902, 0x02F22A01, 0x02F22C01, 0x02F23101, 0x02F25402, 0x02F25B02,
+    0x02F26E02, 0x02F27F01, 0x02F28302, 0x02F28502, 0x02F28E01, 0x02F29502, 0x02F29801, 0x02F2A501, 0x02F2AB02, 0x02F2B901, 0x02F2BA01, 0x02F2BD02,
+    0x02F2D201, 0x02F2E102, 0x02F2EA06, 0x02F2EB01, 0x02F2EC01, 0x02F2ED02, 0x02F2F106, 0x02F2F801, 0x02F2FA01, 0x02F32306, 0x02F32402, 0x02F32602,
+    0x02F32802, 0x02F33302, 0x02F33402, 0x02F34C02, 0x02F34D02, 0x02F34E02, 0x02F34F02, 0x02F35701, 0x02F35B02, 0x02F37402, 0x02F39F06, 0x02F3A002,
+    0x02F3AB02, 0x02F3AF06, 0x02F3BC02, 0x02F3BE02, 0x02F3C102, 0x02F3CE02, 0x02F3DC01, 0x02F3FB02, 0x02F3FC02, 0x02F3FD02, 0x02F3FE02, 0x02F40003,
+    0x02F40102, 0x02F40202, 0x02F40302, 0x02F40402, 0x02F40502, 0x02F40A02, 0x02F40D02, 0x02F42201, 0x02F43004, 0x02F43B02, 0x02F44A01, 0x02F45702,
+    0x02F45801, 0x02F46302, 0x02F46802, 0x02F46902, 0x02F46A02, 0x02F46B02, 0x02F46C02, 0x02F46D02, 0x02F46F02, 0x02F4A401, 0x02F4A501, 0x02F4A601,
+    0x02F4B201, 0x02F4B801, 0x02F4CF01, 0x02F4D802, 0x02F4D902, 0x02F4DA02, 0x02F4DB02, 0x02F4DC02, 0x02F4DD02, 0x02F4DE02, 0x02F4DF02, 0x02F4E102,
+    0x02F4E402, 0x02F4E601, 0x02F4F102, 0x02F4F302, 0x02F4F501, 0x02F4F701, 0x02F50D01, 0x02F51902, 0x02F51B01, 0x02F51C02, 0x02F51D02, 0x02F53002,
+    0x02F54A01, 0x02F54D01, 0x02F55202, 0x02F55402, 0x02F55502, 0x02F55702, 0x02F55B01, 0x02F55D01, 0x02F56302, 0x02F56902, 0x02F57301, 0x02F57401,
+    0x02F57F01, 0x02F58701, 0x02F58801, 0x02F58901, 0x02F59401, 0x02F5BE01, 0x02F5BF01, 0x02F5C002, 0x02F5C102, 0x02F5C202, 0x02F5C302, 0x02F5C401,
+    0x02F5C701, 0x02F5D202, 0x02F5D402, 0x02F5D502, 0x02F5D601, 0x02F5D702, 0x02F5DB02, 0x02F5DC01, 0x02F5E002, 0x02F5E202, 0x02F5E602, 0x02F5E802,
+    0x02F5E903, 0x02F5EA02, 0x02F5F301, 0x02F5F401, 0x02F5F501, 0x02F5FB01, 0x02F62101, 0x02F62402, 0x02F62B01, 0x02F63204, 0x02F66301, 0x02F66906,
+    0x02F68302, 0x02F68602, 0x02F68C04, 0x02F69002, 0x02F69501, 0x02F69802, 0x02F6AB01, 0x02F6AF02, 0x02F6B002, 0x02F6B102, 0x02F6B302, 0x02F6B602,
+    0x02F6BA02, 0x02F6BE03, 0x02F6BF02, 0x02F6C702, 0x02F6C902, 0x02F6CB02, 0x02F6E306, 0x02F6E502, 0x02F6E602, 0x02F6E702, 0x02F6EE01, 0x02F6F802,
+    0x02F6F901, 0x02F70202, 0x02F70301, 0x02F70602, 0x02F70706, 0x02F70802, 0x02F70902, 0x02F70A02, 0x02F70B02, 0x02F70C03, 0x02F70E02, 0x02F71402,
+    0x02F71902, 0x02F71B02, 0x02F72301, 0x02F72401, 0x02F72501, 0x02F72B03, 0x02F72C03, 0x02F74B02, 0x02F75002, 0x02F75202, 0x02F75806, 0x02F75D02,
+    0x02F76702, 0x02F76804, 0x02F77D06, 0x02F77E04, 0x02F77F02, 0x02F78006, 0x02F79A04, 0x02F79D02, 0x02F79E02, 0x02F7A102, 0x02F7A206, 0x02F7AC01,
+    0x02F7B702, 0x02F7C001, 0x02F7CB02, 0x02F7CD02, 0x02F7DA02, 0x02F7F304, 0x02F7F404, 0x02F7FB02, 0x02F7FC02, 0x02F80702, 0x02F80D02, 0x02F82202,
+    0x02F82702, 0x02F85D02, 0x02F87101, 0x02F87702, 0x02F8F201, 0x02F8FB01, 0x02F91202, 0x02F91502, 0x02F91C02, 0x02F91F01, 0x02F92202, 0x02F92702,
+    0x02F92A06, 0x02F92B06, 0x02F93E02, 0x02F93F02, 0x02F94506, 0x02F95B02, 0x02F95D02, 0x02F95E02, 0x02F95F02, 0x02F96002, 0x02F96102, 0x02F96202,
+    0x02F96402, 0x02F96502, 0x02F96602, 0x02F96802, 0x02F99001, 0x02F9F401, 0x02FA0002, 0x02FA6A02, 0x02FA6D02, 0x02FA6E06, 0x02FA7401, 0x02FA9602,
+    0x02FAAB02, 0x02FAAC02, 0x02FABF02, 0x02FAC102, 0x02FAC202, 0x02FAC302, 0x02FAC502, 0x02FAD202, 0x02FAD302, 0x02FADA02, 0x02FADB02, 0x02FADC06,
+    0x02FADE02, 0x02FADF02, 0x02FAE202, 0x02FAE402, 0x02FAE602, 0x02FAE902, 0x02FAED01, 0x02FAF002, 0x02FAF302, 0x02FAF502, 0x02FAF603, 0x02FAF902,
+    0x02FAFA02, 0x02FAFB02, 0x02FAFF02, 0x02FB0102, 0x02FB0202, 0x02FB0401, 0x02FB0802, 0x02FB0A02, 0x02FB1102, 0x02FB1702, 0x02FB1802, 0x02FB1A02,
+    0x02FB3402, 0x02FB3502, 0x02FB3D02, 0x02FB3F02, 0x02FB4702, 0x02FB4B02, 0x02FB5802, 0x02FB5A02, 0x02FB5B02, 0x02FB6102, 0x02FB6703, 0x02FB6D02,
+    0x02FB6F02, 0x02FB7002, 0x02FB7102, 0x02FB7602, 0x02FB7702, 0x02FB7802, 0x02FB7902, 0x02FB7A02, 0x02FB7C02, 0x02FB8102, 0x02FB9B02, 0x02FBA002,
+    0x02FBA902, 0x02FBE702, 0x02FBF502, 0x02FC0004, 0x02FC0806, 0x02FC0F02, 0x02FC1002, 0x02FC1502, 0x02FC1602, 0x02FC1903, 0x02FC1B02, 0x02FC1F02,
+    0x02FC2102, 0x02FC2502, 0x02FC2B02, 0x02FC2E02, 0x02FC3502, 0x02FC3702, 0x02FC3B02, 0x02FC3D02, 0x02FC4202, 0x02FC4302, 0x02FC4502, 0x02FC5C02,
+    0x02FC5F02, 0x02FCA606, 0x02FCA803, 0x02FCAC02, 0x02FCAD02, 0x02FCAE02, 0x02FCB902, 0x02FCC102, 0x02FCEF02, 0x02FD0502, 0x02FD2D02, 0x02FD2E01,
+    0x02FD3502, 0x02FD3702, 0x02FD3802, 0x02FD3902, 0x02FD3B02, 0x02FD3D02, 0x02FD8706, 0x02FD9E02, 0x02FD9F02, 0x02FDBA01, 0x02FDBD02, 0x02FDC201,
+    0x02FDC301, 0x02FDD202, 0x02FDD302, 0x02FDD702, 0x02FDDD04, 0x02FDF202, 0x02FE0202, 0x02FE0303, 0x02FE0406, 0x02FE0602, 0x02FE0702, 0x02FE0902,
+    0x02FE3404, 0x02FE3E04, 0x02FE3F04, 0x02FE4101, 0x02FE4602, 0x02FE6404, 0x02FE6504, 0x02FE6704, 0x02FE6C02, 0x02FE6E04, 0x02FE7302, 0x02FE7902,
+    0x02FE7A04, 0x02FE7E02, 0x02FE8202, 0x02FE8302, 0x02FE8A02, 0x02FE8C02, 0x02FE9002, 0x02FE9204, 0x02FE9304, 0x02FE9501, 0x02FE9802, 0x02FE9A02,
+    0x02FE9D04, 0x02FEA002, 0x02FEA102, 0x02FEA202, 0x02FEA302, 0x02FEA402, 0x02FEA502, 0x02FEA702, 0x02FEAD02, 0x02FEAE02, 0x02FEAF02, 0x02FEB002,
+    0x02FEB102, 0x02FEB202, 0x02FEB302, 0x02FEB502, 0x02FEB606, 0x02FEB902, 0x02FEBA02, 0x02FEBB02, 0x02FECC02, 0x02FECD02, 0x02FED002, 0x02FED102,
+    0x02FF0002, 0x02FF0102, 0x02FF0302, 0x02FF0402, 0x02FF0602, 0x02FF0802, 0x02FF0902, 0x02FF0C03, 0x02FF0D02, 0x02FF2902, 0x02FF2A02, 0x02FF3602,
+    0x02FF3802, 0x02FF3C02, 0x02FF3E02, 0x02FF4002, 0x02FF4202, 0x02FF4302, 0x02FF4602, 0x02FF4D02, 0x02FF4E02, 0x02FF5002, 0x02FF5202, 0x02FF5502,
+    0x02FF5702, 0x02FF5802, 0x02FF5F02, 0x02FF6006, 0x02FF6102, 0x02FF6F02, 0x02FF8702, 0x02FF8802, 0x02FF8902, 0x02FF8A02, 0x02FF8C02, 0x02FFA501,
+    0x02FFB006, 0x02FFB102, 0x02FFB202, 0x02FFB402, 0x02FFB902, 0x02FFBB02, 0x02FFBC02, 0x02FFBE02, 0x02FFC103, 0x02FFC202, 0x02FFC302, 0x02FFC402,
+    0x02FFC702, 0x02FFCB02, 0x02FFCF02, 0x02FFDA01, 0x02FFE202, 0x02FFEA02, 0x02FFF902, 0x02FFFA02, 0x02FFFD02, 0x02FFFE02, 0x02FFFF02, 0x03000002,
+    0x03000302, 0x03001902, 0x03001F02, 0x03002402, 0x03003106, 0x03003302, 0x03003B02, 0x03003C02, 0x03003E04, 0x03004202, 0x03004302, 0x03004C02,
+    0x03004D02, 0x03004F02, 0x03006102, 0x03006302, 0x03006602, 0x03006E02, 0x03007002, 0x03007102, 0x03007502, 0x03007702, 0x03007802, 0x03007902,
+    0x03007A02, 0x03007C02, 0x03007D06, 0x03007E02, 0x03008002, 0x03008102, 0x03008402, 0x03008502, 0x03008702, 0x03008802, 0x03008902, 0x03008A02,
+    0x03008B02, 0x03008C06, 0x03009002, 0x03009A02, 0x0300A202, 0x0300A306, 0x0300A502, 0x0300AA02, 0x0300AB02, 0x0300AC02, 0x0300AD02, 0x0300AE02,
+    0x0300C902, 0x0300CA02, 0x0300CB06, 0x0300CC06, 0x0300CD02, 0x0300D002, 0x0300D102, 0x0300D202, 0x0300D306, 0x0300D801, 0x0300E806, 0x0300FC02,
+    0x0300FD02, 0x03010002, 0x03010A02, 0x03011102, 0x03011402, 0x03011A01, 0x03012E02, 0x03012F02, 0x03013002, 0x03013102, 0x03013503, 0x03013802,
+    0x03013A02, 0x03013B02, 0x03013C02, 0x03013E02, 0x03013F02, 0x03014302, 0x03014402, 0x03014502, 0x03014702, 0x03014906, 0x03014A02, 0x03014D02,
+    0x03014E02, 0x03015004, 0x03015102, 0x03015402, 0x03015502, 0x03015E02, 0x03016F01, 0x03017002, 0x03017302, 0x03017402, 0x03017902, 0x03018802,
+    0x03018F02, 0x03019B02, 0x03019C02, 0x03019F02, 0x0301A406, 0x0301A602, 0x0301A702, 0x0301AA02, 0x0301AB06, 0x0301AE02, 0x0301AF02, 0x0301B402,
+    0x0301B502, 0x0301B702, 0x0301BA02, 0x0301BB02, 0x0301C606, 0x0301D002, 0x0301D102, 0x0301D802, 0x0301DB02, 0x0301E302, 0x0301F401, 0x0301F601,
+    0x03020201, 0x03020502, 0x03020A02, 0x03020E01, 0x03021202, 0x03021302, 0x03021402, 0x03021804, 0x03021B02, 0x03021D01, 0x03022202, 0x03022802,
+    0x03022902, 0x03022A02, 0x03022B03, 0x03022E02, 0x03023A02, 0x03024F02, 0x03025503, 0x03025902, 0x03025B02, 0x03025E06, 0x03026C01, 0x03026F02,
+    0x03027102, 0x03027202, 0x03027302, 0x03027502, 0x03027702, 0x03027902, 0x03027B01, 0x03027C02, 0x03028002, 0x03028102, 0x03028802, 0x03029402,
+    0x03029602, 0x03029901, 0x03029D02, 0x03029E02, 0x0302CD01, 0x0302D803, 0x0302DD01, 0x0302DF02, 0x0302E002, 0x0302E204, 0x0302EA02, 0x0302F501,
+    0x0302F902, 0x0302FA06, 0x0302FB02, 0x03030A02, 0x03030C02, 0x03031106, 0x03031302, 0x03031504, 0x03031902, 0x03031E02, 0x03032B02, 0x03033101,
+    0x03033404, 0x03034602, 0x03035802, 0x03035902, 0x03035A02, 0x03035B02, 0x03035D02, 0x03035E02, 0x03036702, 0x03036902, 0x03037002, 0x03037202,
+    0x03037302, 0x03037402, 0x03037802, 0x03037A02, 0x03037B01, 0x03038503, 0x03039502, 0x03039B02, 0x03039D01, 0x03039E06, 0x03039F02, 0x0303A001,
+    0x0303AC02, 0x0303B101, 0x0303B301, 0x0303B902, 0x0303C003, 0x0303E302, 0x0303E402, 0x0303E901, 0x0303EA02, 0x0303EB06, 0x0303EC01, 0x0303F302,
+    0x0303F902, 0x0303FA06, 0x0303FC06, 0x0303FE02, 0x03040002, 0x03040D02, 0x03041501, 0x03043A02, 0x03043C02, 0x03044502, 0x03044C02, 0x03044F02,
+    0x03045102, 0x03045302, 0x03045402, 0x03045902, 0x03045F02, 0x03046102, 0x03047104, 0x03047301, 0x03047401, 0x03048202, 0x03048302, 0x03048602,
+    0x03048702, 0x03048C02, 0x03048F02, 0x03049302, 0x03049502, 0x03049904, 0x0304A702, 0x0304A806, 0x0304AE01, 0x0304B501, 0x0304B702, 0x0304C702,
+    0x0304C802, 0x0304CA06, 0x0304CB06, 0x0304D602, 0x0304E602, 0x0304EF02, 0x0304F202, 0x03050702, 0x03050C02, 0x03050F02, 0x03051402, 0x03051A02,
+    0x03051B02, 0x03051C02, 0x03051D02, 0x03051E02, 0x03051F02, 0x03052202, 0x03052302, 0x03052C01, 0x03054704, 0x03056802, 0x03056B02, 0x03056D02,
+    0x03057701, 0x03057D02, 0x03058402, 0x03058601, 0x03058702, 0x03058B02, 0x03058C01, 0x03058E06, 0x03058F02, 0x03059002, 0x03059106, 0x03059202,
+    0x03059406, 0x03059602, 0x0305AE02, 0x0305AF02, 0x0305B002, 0x0305B102, 0x0305B302, 0x0305B502, 0x0305BA02, 0x0305BC02, 0x0305C801, 0x0305CC02,
+    0x0305CE02, 0x0305D002, 0x0305D102, 0x0305D402, 0x0305D702, 0x0305DF02, 0x0305E402, 0x0305E502, 0x0305E802, 0x0305E902, 0x0305EB02, 0x0305EC02,
+    0x0305F002, 0x0305F501, 0x0305F601, 0x0305F906, 0x03060002, 0x03060102, 0x03060202, 0x03060402, 0x03060502, 0x03060A02, 0x03062201, 0x03062D01,
+    0x03062E01, 0x03064E06, 0x03065402, 0x03065C02, 0x03065E02, 0x03066002, 0x03066702, 0x03066802, 0x03066902, 0x03067902, 0x03067F01, 0x03069402,
+    0x03069502, 0x03069601, 0x03069802, 0x03069B02, 0x03069C02, 0x0306A002, 0x0306A301, 0x0306C102, 0x0306CC01, 0x0306CD02, 0x0306D902, 0x0306DF02,
+    0x0306E002, 0x0306E301, 0x03070901, 0x03071702, 0x03071A01, 0x03072202, 0x03072502, 0x03073502, 0x03073706, 0x03075006, 0x03075306, 0x03075401,
+    0x03075506, 0x03075602, 0x03075702, 0x03075902, 0x03075A02, 0x03075B03, 0x03075C02, 0x03075E02, 0x03076202, 0x03076402, 0x03076501, 0x03076802,
+    0x03076902, 0x03076A02, 0x03078502, 0x03079304, 0x0307A301, 0x0307AB02, 0x0307BD02, 0x0307BE02, 0x0307D602, 0x0307DA04, 0x0307DD02, 0x0307DF04,
+    0x0307E104, 0x0307E204, 0x0307E304, 0x0307E504, 0x0307E804, 0x0307E904, 0x0307EA04, 0x0307EC04, 0x0307ED04, 0x0307FC02, 0x0307FD06, 0x0307FF04,
+    0x03080004, 0x03080104, 0x03080304, 0x03080404, 0x03080604, 0x03080704, 0x03080902, 0x03080B04, 0x03080C04, 0x03080D04, 0x03080E06, 0x03081004,
+    0x03081104, 0x03081404, 0x03081504, 0x03081604, 0x03081704, 0x03081804, 0x03081904, 0x03081A04, 0x03081B04, 0x03081C04, 0x03081D04, 0x03081E04,
+    0x03081F04, 0x03082002, 0x03082104, 0x03082204, 0x03082304, 0x03082504, 0x03082604, 0x03082704, 0x03082804, 0x03082904, 0x03082A04, 0x03082B04,
+    0x03082C04, 0x03082F02, 0x03083002, 0x03083402, 0x03083804, 0x03083B06, 0x03084804, 0x03084902, 0x03084B02, 0x03084C02, 0x03084F02, 0x03085002,
+    0x03086802, 0x03087C02, 0x03088902, 0x03088B02, 0x03088E02, 0x03089202, 0x03089702, 0x03089D06, 0x0308A502, 0x0308AB03, 0x0308B002, 0x0308B502,
+    0x0308B602, 0x0308B702, 0x0308DD02, 0x0308E301, 0x0308F202, 0x0308F701, 0x0308FD02, 0x03090101, 0x03090601, 0x03090B02, 0x03090C02, 0x03090E02,
+    0x03091006, 0x03091102, 0x03091801, 0x03091F02, 0x03096B02, 0x03096E06, 0x03096F02, 0x03097D02, 0x03097E02, 0x03098202, 0x03098502, 0x03098D06,
+    0x03098E06, 0x03098F02, 0x03099701, 0x03099B01, 0x0309A901, 0x0309AD02, 0x0309AE02, 0x0309B002, 0x0309B901, 0x0309BB01, 0x0309BE01, 0x0309C302,
+    0x0309C702, 0x0309C802, 0x0309CA02, 0x0309CC06, 0x0309D002, 0x0309D102, 0x0309D702, 0x0309D802, 0x0309D902, 0x0309DA03, 0x0309DB02, 0x0309E501,
+    0x0309E802, 0x0309E902, 0x0309EC02, 0x0309F002, 0x0309F102, 0x0309F602, 0x0309FB02, 0x030A0001, 0x030A2102, 0x030A2202, 0x030A2302, 0x030A2402,
+    0x030A2504, 0x030A2C02, 0x030A2E02, 0x030A3402, 0x030A3503, 0x030A3D01, 0x030A5902, 0x030A5B02, 0x030A5D02, 0x030A7102, 0x030A7202, 0x030A7A01,
+    0x030A8A01, 0x030A9C02, 0x030A9D02, 0x030AB501, 0x030ABB01, 0x030AC002, 0x030AC402, 0x030AC502, 0x030AC602, 0x030AC702, 0x030AC902, 0x030ACC02,
+    0x030ACD06, 0x030AD102, 0x030AD202, 0x030AD402, 0x030AD802, 0x030ADB02, 0x030ADF02, 0x030AE503, 0x030AE902, 0x030AEF02, 0x030AFE02, 0x030AFF02,
+    0x030B0102, 0x030B0302, 0x030B0402, 0x030B0904, 0x030B0B02, 0x030B1002, 0x030B1102, 0x030B1303, 0x030B1601, 0x030B1802, 0x030B1A03, 0x030B1E02,
+    0x030B2002, 0x030B2F02, 0x030B3002, 0x030B3B02, 0x030B3C02, 0x030B3D02, 0x030B3E03, 0x030B5302, 0x030B5402, 0x030B5806, 0x030B5E02, 0x030B6102,
+    0x030B6302, 0x030B6402, 0x030B6802, 0x030B6A02, 0x030B6C02, 0x030B6D02, 0x030B6F02, 0x030B7202, 0x030B7402, 0x030B7602, 0x030B7702, 0x030B7802,
+    0x030B7902, 0x030B7B06, 0x030B8006, 0x030B8602, 0x030B8902, 0x030B8B02, 0x030B8C02, 0x030B8D02, 0x030B8E02, 0x030B9001, 0x030B9102, 0x030B9202,
+    0x030B9502, 0x030B9702, 0x030B9D06, 0x030BB002, 0x030BB302, 0x030BCE01, 0x030BD802, 0x030BDA02, 0x030BDE02, 0x030BEA06, 0x030BF102, 0x030BF202,
+    0x030BF306, 0x030BF402, 0x030BF702, 0x030BF802, 0x030C0302, 0x030C2702, 0x030C2802, 0x030C2902, 0x030C2B03, 0x030C2F01, 0x030C3902, 0x030C3E01,
+    0x030C3F02, 0x030C4906, 0x030C4A02, 0x030C5D01, 0x030C6A02, 0x030C7706, 0x030C7B02, 0x030C7E02, 0x030C8802, 0x030C8A01, 0x030C9002, 0x030C9501,
+    0x030CA402, 0x030CA503, 0x030CA902, 0x030CAA06, 0x030CAB06, 0x030CAC06, 0x030CAD02, 0x030CAE02, 0x030CAF02, 0x030CBA02, 0x030CC101, 0x030CC302,
+    0x030CC502, 0x030CC602, 0x030CC702, 0x030CC802, 0x030CC902, 0x030CCA02, 0x030CCF02, 0x030CD002, 0x030CD402, 0x030CD602, 0x030D0801, 0x030D1202,
+    0x030D2502, 0x030D3202, 0x030D4A02, 0x030D4E02, 0x030D5902, 0x030D5A01, 0x030D6501, 0x030D6801, 0x030D6A01, 0x030D8702, 0x030D8802, 0x030D8B02,
+    0x030D8C02, 0x030DA502, 0x030DAC02, 0x030DC002, 0x030DE302, 0x030DE606, 0x030DE706, 0x030DEE02, 0x030DF002, 0x030DF102, 0x030DF402, 0x030DF702,
+    0x030DFD02, 0x030E0101, 0x030E0402, 0x030E0702, 0x030E0802, 0x030E0A01, 0x030E0B01, 0x030E1102, 0x030E2601, 0x030E2801, 0x030E3301, 0x030E4101,
+    0x030E4302, 0x030E5002, 0x030E5101, 0x030E5502, 0x030E6202, 0x030E6502, 0x030E6602, 0x030E6702, 0x030E6802, 0x030E6A02, 0x030E6E02, 0x030E7402,
+    0x030E7603, 0x030E7702, 0x030E7B02, 0x030E7C02, 0x030E8602, 0x030E8B01, 0x030E9302, 0x030E9402, 0x030E9D01, 0x030E9E02, 0x030E9F02, 0x030EA001,
+    0x030EB502, 0x030EB802, 0x030EBF02, 0x030EC502, 0x030EC602, 0x030ECB02, 0x030ECF02, 0x030ED002, 0x030ED202, 0x030ED702, 0x030ED902, 0x030EDE02,
+    0x030EDF02, 0x030EE401, 0x030EE502, 0x030EE702, 0x030EEE02, 0x030EF802, 0x030F0202, 0x030F0302, 0x030F0401, 0x030F0B02, 0x030F1A02, 0x030F1B02,
+    0x030F1F02, 0x030F2202, 0x030F2902, 0x030F2A02, 0x030F3502, 0x030F4302, 0x030F4802, 0x030F5701, 0x030F6202, 0x030F6502, 0x030F6606, 0x030F7702,
+    0x030F8A02, 0x030F8B02, 0x030FA201, 0x030FA604, 0x030FC204, 0x030FCC02, 0x030FCD02, 0x030FCE02, 0x030FD002, 0x030FD102, 0x030FD601, 0x030FDD04,
+    0x030FED06, 0x030FF901, 0x03101602, 0x03101D02, 0x03101E02, 0x03102102, 0x03102201, 0x03102301, 0x03103606, 0x03103702, 0x03104A02, 0x03104C02,
+    0x03105501, 0x03106602, 0x03106E02, 0x03106F02, 0x03107202, 0x03107301, 0x03108101, 0x03108201, 0x03108D02, 0x03108E02, 0x03108F02, 0x03109102,
+    0x03109202, 0x03109302, 0x03109502, 0x03109602, 0x03109702, 0x03109802, 0x03109902, 0x03109B02, 0x03109C02, 0x03109D02, 0x03109F02, 0x0310A302,
+    0x0310A602, 0x0310A702, 0x0310A802, 0x0310AA02, 0x0310AB02, 0x0310AC02, 0x0310B004, 0x0310D901, 0x0310E002, 0x0310E302, 0x0310E402, 0x0310EC02,
+    0x0310ED02, 0x0310EE02, 0x0310EF02, 0x0310F002, 0x0310F102, 0x0310F302, 0x0310F702, 0x0310F902, 0x0310FA02, 0x0310FD02, 0x03110201, 0x03111102,
+    0x03111302, 0x03111402, 0x03111A02, 0x03111C01, 0x03111F02, 0x03112302, 0x03112406, 0x03112502, 0x03112802, 0x03113102, 0x03114D01, 0x03117102,
+    0x03117302, 0x03117602, 0x03117903, 0x03117A02, 0x03118302, 0x03118802, 0x03118E04, 0x0311B602, 0x0311BB01, 0x0311C602, 0x0311E001, 0x0311E402,
+    0x0311E602, 0x0311E802, 0x0311EF06, 0x0311F102, 0x03120002, 0x03120E02, 0x03121102, 0x03121402, 0x03121E01, 0x03122002, 0x03122B02, 0x03126602,
+    0x03126F02, 0x03129306, 0x03129406, 0x03129C02, 0x0312A002, 0x0312A502, 0x0312B202, 0x0312C304, 0x0312CE02, 0x0312D002, 0x0312D302, 0x0312D406,
+    0x0312D506, 0x0312D602, 0x0312DB02, 0x0312E702, 0x0312ED02, 0x0312EE02, 0x0312EF02, 0x0312F002, 0x0312F102, 0x0312F202, 0x0312F302, 0x0312F402,
+    0x0312F702, 0x0312F802, 0x0312FB02, 0x0312FC02, 0x0312FD02, 0x0312FE02, 0x0312FF02, 0x03130002, 0x03130102, 0x03133202, 0x03136501, 0x03137502,
+    0x03137702, 0x03137A06, 0x03138402, 0x03138A02, 0x03139B02, 0x03139C02, 0x03139D02, 0x03139F02, 0x0313A102, 0x0313AA04, 0x0313B902, 0x0313C002,
+    0x0313C401, 0x0313C702, 0x0313D604, 0x03141901, 0x03141A06, 0x03141D01, 0x03142402, 0x03142601, 0x03142701, 0x03142902, 0x03143D02, 0x03144A01,
+    0x03146D04, 0x03147602, 0x03148B01, 0x03149504, 0x0314A201, 0x0314A602, 0x0314AC02, 0x0314B502, 0x0314B702, 0x0314D302, 0x0314D402, 0x0314E201,
+    0x0314E501, 0x03150704, 0x03150B02, 0x03150C02, 0x03151402, 0x03152502, 0x03152602, 0x03152C06, 0x03153002, 0x03153B02, 0x03153C02, 0x03153D02,
+    0x03154002, 0x03154C02, 0x03155101, 0x03155602, 0x03155C02, 0x03155D06, 0x03156506, 0x03156A02, 0x03156F02, 0x03157701, 0x03157B02, 0x03157E02,
+    0x03158802, 0x03158E02, 0x03158F03, 0x03159101, 0x03159902, 0x03159A02, 0x03159C02, 0x0315A303, 0x0315A502, 0x0315AB02, 0x0315AD02, 0x0315B202,
+    0x0315B302, 0x0315B402, 0x0315B603, 0x0315B806, 0x0315CC02, 0x0315D002, 0x0315D802, 0x0315E602, 0x0315F002, 0x0315F102, 0x0315F202, 0x0315F801,
+    0x03160406, 0x03160602, 0x03160802, 0x03160902, 0x03160B02, 0x03161901, 0x03161A01, 0x03162002, 0x03162202, 0x03163002, 0x03163102, 0x03163802,
+    0x03163902, 0x03163E02, 0x03164C02, 0x03164E02, 0x03165F02, 0x03166301, 0x03166401, 0x03166701, 0x03166A02, 0x03166B06, 0x03167202, 0x03167402,
+    0x03167702, 0x03167802, 0x03168202, 0x03169002, 0x03169202, 0x03169302, 0x03169406, 0x03169606, 0x0316A901, 0x0316AF02, 0x0316B002, 0x0316B702,
+    0x0316B802, 0x0316B902, 0x0316BA02, 0x0316BC02, 0x0316BE02, 0x0316C102, 0x0316C704, 0x0316CB02, 0x0316CD02, 0x0316CE06, 0x0316D001, 0x0316DC02,
+    0x0316DD02, 0x0316DF02, 0x0316E002, 0x0316E202, 0x0316E402, 0x0316F501, 0x03170106, 0x03170B02, 0x03170D02, 0x03170F02, 0x03171202, 0x03171401,
+    0x03171902, 0x03171A02, 0x03171B02, 0x03171C02, 0x03172202, 0x03172302, 0x03172502, 0x03172602, 0x03172803, 0x03172B02, 0x03173001, 0x03173F02,
+    0x03174002, 0x03174C02, 0x03174D02, 0x03174E02, 0x03175102, 0x03175D02, 0x03176102, 0x03176A02, 0x03176B02, 0x03177301, 0x03177402, 0x03178002,
+    0x03178202, 0x03178302, 0x03178402, 0x03178702, 0x03178902, 0x03178C02, 0x03179403, 0x0317A902, 0x0317AC02, 0x0317AD03, 0x0317B501, 0x0317C002,
+    0x0317D501, 0x0317D602, 0x0317D802, 0x0317EA02, 0x0317EC02, 0x0317F102, 0x0317F302, 0x0317F702, 0x0317FA02, 0x0317FC02, 0x0317FD01, 0x0317FE01,
+    0x0317FF02, 0x03180102, 0x03180202, 0x03180302, 0x03180502, 0x03180E01, 0x03180F06, 0x03181006, 0x03181102, 0x03181202, 0x03181306, 0x03181604,
+    0x03181802, 0x03181E02, 0x03181F02, 0x03182302, 0x03182402, 0x03182502, 0x03182602, 0x03182A02, 0x03182D02, 0x03183501, 0x03183802, 0x03183901,
+    0x03183C02, 0x03184402, 0x03184602, 0x03184702, 0x03184803, 0x03185A02, 0x03186002, 0x03188502, 0x03188A02, 0x03188F04, 0x03189102, 0x03189402,
+    0x03189B02, 0x0318A202, 0x0318A602, 0x0318AA02, 0x0318B001, 0x0318B502, 0x0318B902, 0x0318BC02, 0x0318BD02, 0x0318BE02, 0x0318C301, 0x0318F402,
+    0x0318F906, 0x0318FA02, 0x0318FD01, 0x03190A02, 0x03190B02, 0x03192501, 0x03192C02, 0x03193302, 0x03194802, 0x03195901, 0x03196C02, 0x03197302,
+    0x03197602, 0x03197802, 0x03197902, 0x03197C02, 0x03197D02, 0x03198301, 0x03199001, 0x03199303, 0x03199502, 0x03199E06, 0x0319A306, 0x0319A506,
+    0x0319A603, 0x0319A902, 0x0319BD02, 0x0319BF02, 0x0319C102, 0x0319C302, 0x0319C502, 0x0319C602, 0x0319CD02, 0x0319CE02, 0x0319D301, 0x0319D802,
+    0x0319D902, 0x0319DB02, 0x0319DE02, 0x0319DF02, 0x0319E102, 0x0319E202, 0x0319E302, 0x0319EA02, 0x0319FD02, 0x031A1603, 0x031A3402, 0x031A4902,
+    0x031A4C02, 0x031A7102, 0x031A7601, 0x031A8702, 0x031A8E03, 0x031A8F02, 0x031A9506, 0x031A9702, 0x031ABD02, 0x031ABE02, 0x031ACB02, 0x031ACC02,
+    0x031AEC01, 0x031AF902, 0x031AFA01, 0x031AFB01, 0x031AFC01, 0x031B0402, 0x031B0506, 0x031B0606, 0x031B0701, 0x031B0F01, 0x031B1E02, 0x031B1F02,
+    0x031B2102, 0x031B2202, 0x031B2302, 0x031B2402, 0x031B2502, 0x031B2706, 0x031B2802, 0x031B2B02, 0x031B2E02, 0x031B2F02, 0x031B3002, 0x031B3802,
+    0x031B3902, 0x031B3A02, 0x031B3D02, 0x031B6802, 0x031B7602, 0x031B7802, 0x031B7E01, 0x031B8202, 0x031B8302, 0x031B8402, 0x031B8704, 0x031B9502,
+    0x031B9602, 0x031B9902, 0x031BB803, 0x031BBD02, 0x031BC802, 0x031BCC02, 0x031BE302, 0x031BE402, 0x031BE502, 0x031BE702, 0x031BE802, 0x031BE902,
+    0x031BEA02, 0x031BEB02, 0x031BEC02, 0x031BED02, 0x031C0606, 0x031C0702, 0x031C0C01, 0x031C0F02, 0x031C1203, 0x031C1302, 0x031C1406, 0x031C1F02,
+    0x031C2B02, 0x031C3704, 0x031C3804, 0x031C5004, 0x031C8B02, 0x031C8F02, 0x031C9402, 0x031C9702, 0x031CB102, 0x031CB602, 0x031CB902, 0x031CBA02,
+    0x031CBB01, 0x031CBC02, 0x031CBD02, 0x031CC602, 0x031CC702, 0x031CCC04, 0x031CCD02, 0x031CE401, 0x031CE701, 0x031CEC02, 0x031CED02, 0x031CEF02,
+    0x031CF202, 0x031CF302, 0x031CF506, 0x031CF602, 0x031CF702, 0x031CFF02, 0x031D0C01, 0x031D1502, 0x031D1602, 0x031D1802, 0x031D1E02, 0x031D2202,
+    0x031D2502, 0x031D2D02, 0x031D3102, 0x031D3502, 0x031D3902, 0x031D3A02, 0x031D3D01, 0x031D6B02, 0x031D7302, 0x031D7602, 0x031D7D02, 0x031D8002,
+    0x031D8101, 0x031D8401, 0x031D8502, 0x031D8706, 0x031D8801, 0x031D8901, 0x031D8D01, 0x031D8E01, 0x031D9101, 0x031D9701, 0x031D9E02, 0x031DA506,
+    0x031DA702, 0x031DAC01, 0x031DAD03, 0x031DAE02, 0x031DB502, 0x031DB702, 0x031DB802, 0x031DBB02, 0x031DD202, 0x031DD702, 0x031DD803, 0x031DDE02,
+    0x031DDF02, 0x031DE002, 0x031DE103, 0x031DE702, 0x031DEC02, 0x031DED02, 0x031DF001, 0x031DF902, 0x031DFA01, 0x031E0002, 0x031E0202, 0x031E0601,
+    0x031E0B01, 0x031E0D06, 0x031E1002, 0x031E1402, 0x031E1A03, 0x031E1B02, 0x031E2A02, 0x031E2B02, 0x031E2C02, 0x031E2F02, 0x031E3002, 0x031E3606,
+    0x031E3D02, 0x031E3E06, 0x031E4002, 0x031E4202, 0x031E4502, 0x031E4602, 0x031E4902, 0x031E4A02, 0x031E4D02, 0x031E6102, 0x031E6502, 0x031E6702,
+    0x031E6B06, 0x031E6D02, 0x031E6E02, 0x031E6F02, 0x031E7302, 0x031E7602, 0x031E7806, 0x031E7902, 0x031E7A02, 0x031E7B02, 0x031E7C02, 0x031E7D02,
+    0x031E7F02, 0x031E8002, 0x031E8102, 0x031E8202, 0x031E8302, 0x031E8402, 0x031E8602, 0x031E8702, 0x031E8802, 0x031E8902, 0x031E8A02, 0x031E8B02,
+    0x031E8C02, 0x031E8D02, 0x031E8E02, 0x031E8F02, 0x031E9002, 0x031E9102, 0x031E9202, 0x031E9502, 0x031EAC04, 0x031EB601, 0x031EBB02, 0x031EBD02,
+    0x031EC002, 0x031ECA02, 0x031ECE02, 0x031ED102, 0x031EDB02, 0x031EE002, 0x031EE102, 0x031EE202, 0x031EE402, 0x031EE602, 0x031EE802, 0x031EE902,
+    0x031EEA02, 0x031EEB02, 0x031EEC02, 0x031EED02, 0x031EEE02, 0x031EEF02, 0x031EF002, 0x031EF202, 0x031EF402, 0x031EF502, 0x031EF602, 0x031EF804,
+    0x031F0202, 0x031F0402, 0x031F0602, 0x031F0802, 0x031F0A02, 0x031F0B02, 0x031F0C02, 0x031F0D02, 0x031F0E02, 0x031F1002, 0x031F1102, 0x031F1502,
+    0x031F1802, 0x031F1902, 0x031F1B02, 0x031F1C02, 0x031F2601, 0x031F2702, 0x031F2802, 0x031F2902, 0x031F3402, 0x031F3606, 0x031F4602, 0x031F4B02,
+    0x031F4D02, 0x031F4E02, 0x031F4F02, 0x031F5302, 0x031F5402, 0x031F5502, 0x031F5602, 0x031F5802, 0x031F5902, 0x031F5C02, 0x031F6B01, 0x031F7201,
+    0x031F7E01, 0x031F8001, 0x031F8101, 0x031F8201, 0x031F8301, 0x031F8401, 0x031F8B02, 0x031FC801, 0x031FE901, 0x031FEA02, 0x03201901, 0x03202202,
+    0x03202501, 0x03202701, 0x03202801, 0x03202902, 0x03202B02, 0x03203201, 0x03203601, 0x03204601, 0x03204B02, 0x03205002, 0x03205302, 0x03206202,
+    0x03206301, 0x03206901, 0x03206D02, 0x03207202, 0x03207502, 0x03207701, 0x03207802, 0x03207F02, 0x03208002, 0x03208602, 0x03208902, 0x03208B06,
+    0x03208C02, 0x03209102, 0x03209A01, 0x03209B01, 0x03209F04, 0x0320B302, 0x0320B402, 0x0320C501, 0x0320C601, 0x0320CB02, 0x0320D201, 0x0320DC02,
+    0x0320DD02, 0x0320DE02, 0x0320DF02, 0x0320E002, 0x0320E102, 0x0320E202, 0x0320E302, 0x0320E402, 0x0320E802, 0x0320E902, 0x0320EC02, 0x0320ED02,
+    0x0320EE02, 0x0320EF02, 0x03210001, 0x03210902, 0x03210C01, 0x03210D02, 0x03210E01, 0x03211C02, 0x03215902, 0x03215A02, 0x03215B02, 0x03215C02,
+    0x03216702, 0x03216802, 0x03216C06, 0x03216D06, 0x03217A02, 0x03217B02, 0x03217C02, 0x03217D06, 0x03218002, 0x03218702, 0x03218C06, 0x03219206,
+    0x03219502, 0x03219902, 0x0321A702, 0x0321A803, 0x0321AC02, 0x0321AE01, 0x0321AF06, 0x0321B101, 0x0321B202, 0x0321BE02, 0x0321BF02, 0x0321CC03,
+    0x0321D101, 0x0321D906, 0x0321DC02, 0x0321DD03, 0x0321DF02, 0x0321E002, 0x0321EA02, 0x0321EC02, 0x0321FE06, 0x0321FF02, 0x03220002, 0x03220106,
+    0x03220306, 0x03220802, 0x03222106, 0x03222401, 0x03223402, 0x03223602, 0x03223702, 0x03223902, 0x03224902, 0x03224A06, 0x03225102, 0x03225E02,
+    0x03226102, 0x03226302, 0x03226602, 0x03227301, 0x03228806, 0x03229E02, 0x0322A006, 0x0322A102, 0x0322A602, 0x0322B302, 0x0322B702, 0x0322D306,
+    0x0322D901, 0x0322DA01, 0x0322DC02, 0x0322DD06, 0x0322DF02, 0x0322E902, 0x0322EA02, 0x0322EB02, 0x03231801, 0x03231901, 0x03231C02, 0x03231E02,
+    0x03231F02, 0x03232102, 0x03232202, 0x03232402, 0x03232901, 0x03232C01, 0x03233702, 0x03233802, 0x03233902, 0x03233A02, 0x03233B02, 0x03233C02,
+    0x03233D02, 0x03233E02, 0x03234402, 0x03234C02, 0x03235002, 0x03235702, 0x03236902, 0x03237E02, 0x03238B01, 0x03238C02, 0x03239B02, 0x03239D02,
+    0x03239F02, 0x0323B606, 0x0323C204, 0x0323C602, 0x0323E802, 0x0323EF01, 0x03242301, 0x03242501, 0x03243301, 0x03243701, 0x03243A01, 0x03243E01,
+    0x0324B001, 0x0324B501, 0x0324B601, 0x0324B801, 0x0324C401, 0x0324C904, 0x03251103, 0x03251D01, 0x03259001, 0x0325A201, 0x0325B501, 0x0325EB02,
+    0x0325ED02, 0x0325EE04, 0x0325F101, 0x0325F201, 0x0325F401, 0x0325F501, 0x0325F601, 0x0325F701, 0x0325F806, 0x0325FD02, 0x03261201, 0x03261403,
+    0x03263B02, 0x03265002, 0x03265B06, 0x03265F02, 0x03266002, 0x03266501, 0x03266601, 0x03266C06, 0x03267001, 0x03268201, 0x03268702, 0x03268902,
+    0x03268B02, 0x03268C02, 0x03268D02, 0x03268E02, 0x03269801, 0x0326A501, 0x0326A601, 0x0326A701, 0x0326AF01, 0x0326B001, 0x0326B601, 0x0326B801,
+    0x0326B901, 0x0326BA01, 0x0326BB01, 0x0326BC01, 0x0326EC02, 0x0326F201, 0x0326F304, 0x0326F601, 0x0326F801, 0x0326FB01, 0x0326FD01, 0x03270D01,
+    0x03271701, 0x03272201, 0x03272601, 0x03272901, 0x03272B01, 0x03273202, 0x03273902, 0x03273A03, 0x03273C01, 0x03275701, 0x03275D06, 0x03276301,
+    0x03276401, 0x03276501, 0x03276601, 0x03276701, 0x03276801, 0x03276E01, 0x03276F01, 0x03277401, 0x03279001, 0x0327A001, 0x0327A302, 0x0327A802,
+    0x0327AF01, 0x0327B901, 0x0327CE01, 0x0327CF02, 0x0327EC01, 0x0327F901, 0x03280402, 0x03280D01, 0x03282B02, 0x03283D01, 0x03283E02, 0x03285206,
+    0x03285302, 0x03285702, 0x03285A01, 0x03285C02, 0x03286103, 0x03286801, 0x03286F02, 0x03287002, 0x03287102, 0x03287603, 0x03287702, 0x03287A02,
+    0x03287E02, 0x03288102, 0x03288401, 0x0328A701, 0x0328A801, 0x0328A902, 0x0328AA02, 0x0328AB01, 0x0328AC01, 0x0328AD01, 0x0328AE01, 0x0328AF01,
+    0x0328B001, 0x0328B102, 0x0328B201, 0x0328B301, 0x0328B402, 0x0328B502, 0x0328B701, 0x0328B801, 0x0328B902, 0x0328D102, 0x0328D402, 0x0328D502,
+    0x0328D602, 0x0328DA01, 0x0328DC02, 0x0328E201, 0x0328E902, 0x0328F002, 0x0328F402, 0x0328F602, 0x0328F906, 0x03290002, 0x03290C01, 0x03290E02,
+    0x03291602, 0x03291702, 0x03291801, 0x03292501, 0x03292602, 0x03292802, 0x03292901, 0x03292D02, 0x03292E06, 0x03293902, 0x03293D02, 0x03293F02,
+    0x03294202, 0x03294302, 0x03295402, 0x03295D02, 0x03296002, 0x03296302, 0x03296602, 0x03296B01, 0x03296D01, 0x03297E06, 0x03299702, 0x03299802,
+    0x0329A002, 0x0329A306, 0x0329A502, 0x0329A802, 0x0329B502, 0x0329B906, 0x0329BD02, 0x0329C001, 0x0329C902, 0x0329CF06, 0x0329D102, 0x0329D402,
+    0x0329D502, 0x0329D702, 0x0329D802, 0x0329D902, 0x0329DC06, 0x0329DD02, 0x0329DF01, 0x0329E001, 0x0329EF02, 0x0329F202, 0x0329F302, 0x0329F402,
+    0x0329F502, 0x0329F702, 0x0329F802, 0x0329FA02, 0x0329FB02, 0x0329FC02, 0x0329FD02, 0x0329FE02, 0x032A0002, 0x032A0202, 0x032A0402, 0x032A0F02,
+    0x032A1702, 0x032A1902, 0x032A1A02, 0x032A2702, 0x032A2802, 0x032A2902, 0x032A2F06, 0x032A7A01, 0x032A7D01, 0x032A7E01, 0x032A8002, 0x032A8702,
+    0x032A8A02, 0x032AAC02, 0x032ABC02, 0x032ABD02, 0x032ABE02, 0x032AC102, 0x032AD801, 0x032AF402, 0x032B0F01, 0x032B1102, 0x032B1802, 0x032B3102,
+    0x032B3202, 0x032B4202, 0x032B4402, 0x032B4502, 0x032B4A03, 0x032B4D02, 0x032B4E01, 0x032B5102, 0x032B5802, 0x032B5D02, 0x032B7802, 0x032B7902,
+    0x032B7B02, 0x032B8002, 0x032B9002, 0x032B9404, 0x032B9B02, 0x032BA102, 0x032BA202, 0x032BBB01, 0x032BBC01, 0x032BC202, 0x032BC302, 0x032BC402,
+    0x032BD701, 0x032BDB02, 0x032BE601, 0x032BED01, 0x032BF301, 0x032C4A06, 0x032C4B02, 0x032C4C06, 0x032C5801, 0x032C6E02, 0x032C7301, 0x032C8E02,
+    0x032C8F03, 0x032CA702, 0x032CB101, 0x032CC102, 0x032CD602, 0x032D0D02, 0x032D1601, 0x032D1A02, 0x032D1E01, 0x032D2001, 0x032D2D02, 0x032D2F02,
+    0x032D4302, 0x032D4D02, 0x032D5A01, 0x032D6301, 0x032D7B01, 0x032D7C01, 0x032D7D02, 0x032D7E01, 0x032D8001, 0x032D8301, 0x032D8401, 0x032D8501,
+    0x032D8601, 0x032D8701, 0x032D8801, 0x032D8901, 0x032D8A01, 0x032D8B01, 0x032D8C01, 0x032D9602, 0x032D9E01, 0x032D9F01, 0x032DA501, 0x032DAF01,
+    0x032DB001, 0x032DB101, 0x032DB201, 0x032DB601, 0x032DBE01, 0x032DC901, 0x032DCC01, 0x032DD302, 0x032DDD01, 0x032DE301, 0x032DEA01, 0x032DEB01,
+    0x032E0101, 0x032E0201, 0x032E0301, 0x032E1301, 0x032E2002, 0x032E2F01, 0x032E3901, 0x032E3A01, 0x032E4101, 0x032E4201, 0x032E4901, 0x032E4A01,
+    0x032E4F01, 0x032E6401, 0x032E6501, 0x032E7501, 0x032E7601, 0x032E7701, 0x032EA402, 0x032EB901, 0x032EC302, 0x032ED602, 0x032EDB01, 0x032EDC01,
+    0x032EDD02, 0x032EDF02, 0x032EE002, 0x032EE102, 0x032EE202, 0x032EE302, 0x032EE402, 0x032EE502, 0x032EE602, 0x032EEA06, 0x032EF402, 0x032EF801,
+    0x032EF901, 0x032EFD01, 0x032F0506, 0x032F0A01, 0x032F0C02, 0x032F2102, 0x032F2202, 0x032F2B02, 0x032F4502, 0x032F4602, 0x032F4701, 0x032F4801,
+    0x032F4A02, 0x032F5E04, 0x032F6001, 0x032F6901, 0x032F6B01, 0x032F6E01, 0x032F6F01, 0x032F7201, 0x032F7401, 0x032F7A02, 0x032F8202, 0x032F8302,
+    0x032F8402, 0x032F8902, 0x032F9301, 0x032F9401, 0x032F9603, 0x032F9902, 0x032F9A02, 0x032F9B02, 0x032F9C02, 0x032FAA01, 0x032FAC01, 0x032FAD02,
+    0x032FC801, 0x032FEB01, 0x032FF301, 0x032FF801, 0x03300302, 0x03300801, 0x03300D01, 0x03301601, 0x03301C01, 0x03301F01, 0x03302402, 0x03302501,
+    0x03302D04, 0x03302F04, 0x03304302, 0x03304402, 0x03304F01, 0x03305001, 0x03305101, 0x03305501, 0x03305E02, 0x03306502, 0x03308703, 0x03308A01,
+    0x03308B02, 0x03309B01, 0x03309C01, 0x03309D01, 0x03309E01, 0x0330AD02, 0x0330B201, 0x0330B301, 0x0330B501, 0x0330B601, 0x0330B701, 0x0330BE01,
+    0x0330E202, 0x0330E801, 0x0330E902, 0x0330F701, 0x0330F801, 0x03310D01, 0x03310E01, 0x03311502, 0x03312C03, 0x03313206, 0x03314002, 0x03314102,
+    0x03314202, 0x03314402, 0x03314702, 0x03314802, 0x03314902, 0x03314A02, 0x03314D02, 0x03316202, 0x03316402, 0x03316A02, 0x03316D02, 0x03317101,
+    0x03317201, 0x03318102, 0x03318502, 0x03318704, 0x03319901, 0x03319A01, 0x0331AF01, 0x0331B001, 0x0331B306, 0x0331B402, 0x0331BD02, 0x0331BF01,
+    0x0331E002, 0x0331E902, 0x0331EA02, 0x0331EC02, 0x0331ED02, 0x0331F501, 0x0331F601, 0x03320902, 0x03321202, 0x03321302, 0x03321901, 0x03322001,
+    0x03323003, 0x03323302, 0x03323602, 0x03324002, 0x03324202, 0x03324606, 0x03324802, 0x03324902, 0x03324B02, 0x03324C02, 0x03325402, 0x03325502,
+    0x03325602, 0x03327002, 0x03327502, 0x03327601, 0x03327802, 0x03327A01, 0x03328302, 0x03328402, 0x03328502, 0x03328C02, 0x03328E01, 0x03328F01,
+    0x03329102, 0x03329202, 0x03329702, 0x03329E02, 0x03329F02, 0x0332A103, 0x0332A502, 0x0332A602, 0x0332A902, 0x0332AB02, 0x0332AF02, 0x0332B002,
+    0x0332B401, 0x0332B501, 0x0332F302, 0x03331001, 0x03331702, 0x03331802, 0x03331A02, 0x03331D02, 0x03331E02, 0x03332102, 0x03332406, 0x03332A02,
+    0x03332C02, 0x03332E01, 0x03332F01, 0x03333901, 0x03334202, 0x03334302, 0x03334402, 0x03334506, 0x03334801, 0x03334A01, 0x03334C02, 0x03335202,
+    0x03335502, 0x03335601, 0x03335701, 0x03335802, 0x03335A02, 0x03335F01, 0x03336001, 0x03336101, 0x03336201, 0x03336301, 0x03336601, 0x03336A01,
+    0x03336B01, 0x03336C01, 0x03336D01, 0x03336E01, 0x03336F01, 0x03337001, 0x03337101, 0x03337502, 0x03337602, 0x03337702, 0x03337802, 0x03337903,
+    0x03337A02, 0x03337C02, 0x03337D02, 0x03337E02, 0x03338002, 0x03338102, 0x0333AB02, 0x0333AC02, 0x0333AD02, 0x0333B202, 0x0333B302, 0x0333BB04,
+    0x0333BE04, 0x0333CB01, 0x0333CC01, 0x0333CE01, 0x0333D601, 0x0333DD07, 0x0333EB01, 0x0333EC01, 0x0333F804, 0x0333F904, 0x03340101, 0x03340201,
+    0x03340401, 0x03340D03, 0x03343C02, 0x03343D02, 0x03344602, 0x03344B01, 0x03344D02, 0x03345002, 0x03345302, 0x03345601, 0x03345901, 0x03346801,
+    0x03346901, 0x03346A01, 0x03346D02, 0x03346E02, 0x03346F02, 0x03347002, 0x03347102, 0x03347602, 0x03347902, 0x03347A03, 0x03347F02, 0x03348001,
+    0x03348102, 0x03348202, 0x03348502, 0x03349102, 0x0334A102, 0x0334A306, 0x0334A602, 0x0334B101, 0x0334B401, 0x0334BC02, 0x0334BE02, 0x0334BF01,
+    0x0334CE02, 0x0334D002, 0x0334D602, 0x0334DD03, 0x0334E002, 0x0334E102, 0x0334E202, 0x0334E302, 0x0334E402, 0x0334E802, 0x0334E906, 0x0334EA02,
+    0x0334EB06, 0x0334F706, 0x03350602, 0x03351001, 0x03351101, 0x03351402, 0x03351502, 0x03351602, 0x03351702, 0x03351B01, 0x03351C01, 0x03353101,
+    0x03353401, 0x03355002, 0x03355301, 0x03357302, 0x03357602, 0x03357F02, 0x03358B01, 0x03358E02, 0x03359302, 0x03359402, 0x03359701, 0x03359D02,
+    0x03359E02, 0x0335A101, 0x0335A502, 0x0335A702, 0x0335BC01, 0x0335CA02, 0x0335D702, 0x0335DA01, 0x0335DB01, 0x0335DC01, 0x0335DF01, 0x0335E001,
+    0x0335E201, 0x0335E701, 0x0335E801, 0x0335F001, 0x0335FA01, 0x03360801, 0x03360A01, 0x03360C01, 0x03361301, 0x03362601, 0x03362D04, 0x03362E04,
+    0x03362F04, 0x03364801, 0x03366402, 0x03366801, 0x03366C02, 0x03367201, 0x03367D02, 0x03368101, 0x03368401, 0x03368A02, 0x03368B02, 0x03368F02,
+    0x03369302, 0x03369702, 0x03369801, 0x03369E02, 0x0336A102, 0x0336BD02, 0x0336C301, 0x0336C501, 0x0336C702, 0x0336CD02, 0x0336CE02, 0x0336D202,
+    0x0336D302, 0x0336D902, 0x0336DA02, 0x0336DB02, 0x0336DC02, 0x0336DF02, 0x0336E102, 0x0336E202, 0x0336E302, 0x0336E402, 0x0336E702, 0x0336E802,
+    0x0336EA02, 0x0336EE02, 0x0336F402, 0x0336FE02, 0x0336FF06, 0x03370C01, 0x03370E02, 0x03371102, 0x03371202, 0x03371302, 0x03371401, 0x03371501,
+    0x03371601, 0x03371802, 0x03371A06, 0x03371C02, 0x03372202, 0x03372306, 0x03372502, 0x03372602, 0x03372702, 0x03372A02, 0x03372C02, 0x03373202,
+    0x03373E01, 0x03373F02, 0x03374002, 0x03374102, 0x03374202, 0x03374502, 0x03374702, 0x03374902, 0x03374C06, 0x03374D02, 0x03374F02, 0x03375302,
+    0x03375702, 0x03375802, 0x03375A02, 0x03375E02, 0x03376102, 0x03376402, 0x03376902, 0x03376D02, 0x03377202, 0x03377302, 0x03377402, 0x03377701,
+    0x03378106, 0x03379103, 0x03379601, 0x03379E04, 0x03379F02, 0x0337A201, 0x0337A502, 0x0337AB02, 0x0337AE01, 0x0337B501, 0x0337B601, 0x0337B902,
+    0x0337BD01, 0x0337E401, 0x0337EF02, 0x0337F904, 0x03381C02, 0x03382302, 0x03382402, 0x03383202, 0x03383701, 0x03383A02, 0x03383C02, 0x03383D02,
+    0x03384202, 0x03384404, 0x03384702, 0x03386C06, 0x03386D02, 0x03387002, 0x03387602, 0x03388402, 0x03388602, 0x03389006, 0x03389606, 0x03389B02,
+    0x0338A102, 0x0338A202, 0x0338A402, 0x0338AD02, 0x0338AF02, 0x0338B201, 0x0338B302, 0x0338B602, 0x0338BB02, 0x0338C202, 0x0338C802, 0x0338C902,
+    0x0338CA02, 0x0338CB02, 0x0338CC02, 0x0338D602, 0x0338F002, 0x0338FB01, 0x03390901, 0x03390A02, 0x03391202, 0x03391302, 0x03397404, 0x03397B01,
+    0x03397C01, 0x03397D02, 0x03397E02, 0x03399701, 0x03399801, 0x03399B01, 0x03399C01, 0x03399E01, 0x03399F01, 0x0339A001, 0x0339A101, 0x0339A301,
+    0x0339A501, 0x0339AA01, 0x0339AD01, 0x0339AE01, 0x0339BC01, 0x0339C802, 0x0339CE04, 0x0339D404, 0x0339DE02, 0x0339E202, 0x0339FC01, 0x033A2102,
+    0x033A2602, 0x033A2702, 0x033A2901, 0x033A3502, 0x033A3602, 0x033A3E01, 0x033A4202, 0x033A4902, 0x033A4A02, 0x033A5906, 0x033A5B02, 0x033A7A04,
+    0x033A7D04, 0x033A7F02, 0x033A8501, 0x033A8802, 0x033A8B01, 0x033A8D01, 0x033A9401, 0x033A9601, 0x033A9801, 0x033A9901, 0x033A9C01, 0x033AA401,
+    0x033AA501, 0x033AA601, 0x033AA901, 0x033AAB01, 0x033AAD01, 0x033AB201, 0x033AC301, 0x033AC401, 0x033ACB01, 0x033ACE02, 0x033AD801, 0x033AE102,
+    0x033AE401, 0x033AE601, 0x033AE901, 0x033AEB01, 0x033AF101, 0x033AF601, 0x033B0203, 0x033B0302, 0x033B0503, 0x033B0802, 0x033B0F06, 0x033B1102,
+    0x033B1804, 0x033B2101, 0x033B2401, 0x033B2601, 0x033B3D01, 0x033B5102, 0x033B5202, 0x033B5406, 0x033B5506, 0x033B5D02, 0x033B6506, 0x033B7101,
+    0x033B7401, 0x033B7502, 0x033B7602, 0x033B7702, 0x033B7A01, 0x033BA906, 0x033BB101, 0x033BB502, 0x033BBA02, 0x033BBB02, 0x033BBC02, 0x033BBD01,
+    0x033BBF02, 0x033BC102, 0x033BC202, 0x033BC501, 0x033BC602, 0x033BC702, 0x033BC802, 0x033BC902, 0x033BCA02, 0x033BCB02, 0x033BCC02, 0x033BCE02,
+    0x033BD001, 0x033BEA04, 0x033BEB02, 0x033C1002, 0x033C3001, 0x033C3B02, 0x033C4302, 0x033C4402, 0x033C4802, 0x033C5002, 0x033C5302, 0x033C5401,
+    0x033C5701, 0x033C5802, 0x033C5901, 0x033C5B02, 0x033C7001, 0x033C7102, 0x033C7402, 0x033C8701, 0x033C8906, 0x033C8A02, 0x033CB602, 0x033CBB02,
+    0x033CC404, 0x033CCA01, 0x033CD602, 0x033CD702, 0x033CE603, 0x033CEA01, 0x033CEC02, 0x033CF202, 0x033CF902, 0x033CFF02, 0x033D0003, 0x033D0102,
+    0x033D0E01, 0x033D0F01, 0x033D1901, 0x033D2B02, 0x033D2D02, 0x033D3A02, 0x033D3B02, 0x033D3C02, 0x033D4302, 0x033D4A02, 0x033D4D01, 0x033D6703,
+    0x033D6B02, 0x033D6C06, 0x033D6D02, 0x033D6F06, 0x033D7002, 0x033D7106, 0x033D7206, 0x033D7302, 0x033D7702, 0x033D7801, 0x033D7901, 0x033D7A01,
+    0x033D7B01, 0x033D7C01, 0x033D7D01, 0x033D7E01, 0x033D7F01, 0x033D8102, 0x033D8202, 0x033D8302, 0x033D8502, 0x033D8602, 0x033D8702, 0x033D8D02,
+    0x033D9302, 0x033D9D02, 0x033D9E02, 0x033D9F02, 0x033DA002, 0x033DA102, 0x033DA202, 0x033DA302, 0x033DA402, 0x033DA502, 0x033DA702, 0x033DAC02,
+    0x033DAD02, 0x033DB702, 0x033DB802, 0x033DBA02, 0x033DBB02, 0x033DBC02, 0x033DC706, 0x033DCF02, 0x033DD406, 0x033DD501, 0x033DE002, 0x033DE302,
+    0x033DE402, 0x033DE902, 0x033DEB02, 0x033DEC02, 0x033DEE02, 0x033DEF02, 0x033DF102, 0x033DF402, 0x033DF502, 0x033DF602, 0x033DF802, 0x033E0401,
+    0x033E2802, 0x033E2A02, 0x033E2B02, 0x033E2C02, 0x033E2D02, 0x033E2E02, 0x033E2F02, 0x033E3002, 0x033E3103, 0x033E3301, 0x033E3C02, 0x033E4404,
+    0x033E4802, 0x033E6801, 0x033E6B01, 0x033E7001, 0x033E7101, 0x033E7201, 0x033E7301, 0x033E7501, 0x033E8202, 0x033E8302, 0x033E8402, 0x033E8502,
+    0x033E8601, 0x033E8701, 0x033E8A02, 0x033E8B02, 0x033E8C03, 0x033E8F02, 0x033E9402, 0x033E9702, 0x033E9902, 0x033E9A02, 0x033E9B02, 0x033E9C02,
+    0x033E9D02, 0x033E9E02, 0x033EA102, 0x033EA202, 0x033EA302, 0x033EA701, 0x033EA801, 0x033EA901, 0x033EAD02, 0x033EAE02, 0x033EB202, 0x033EB402,
+    0x033EBC02, 0x033EBE02, 0x033EC702, 0x033EC806, 0x033EC901, 0x033EE002, 0x033EFE01, 0x033F0001, 0x033F0201, 0x033F0306, 0x033F0702, 0x033F1102,
+    0x033F1402, 0x033F1B02, 0x033F1C02, 0x033F1D02, 0x033F2802, 0x033F3802, 0x033F3B01, 0x033F3F02, 0x033F4002, 0x033F4102, 0x033F5002, 0x033F5102,
+    0x033F5202, 0x033F5302, 0x033F5502, 0x033F5601, 0x033F5701, 0x033F5901, 0x033F5B02, 0x033F5D02, 0x033F7301, 0x033F8702, 0x033F9106, 0x033F9401,
+    0x033F9E02, 0x033FA302, 0x033FB902, 0x033FBD01, 0x033FD101, 0x033FD302, 0x033FD401, 0x033FE101, 0x033FF404, 0x033FFC02, 0x03400101, 0x03400B02,
+    0x03401202, 0x03401303, 0x03401902, 0x03402402, 0x03402502, 0x03402602, 0x03403702, 0x03403902, 0x03403A02, 0x03403B02, 0x03403F02, 0x03404001,
+    0x03404602, 0x03404702, 0x03404B01, 0x03404C01, 0x03404D01, 0x03404E01, 0x03404F01, 0x03405001, 0x03405101, 0x03405201, 0x03405C06, 0x03405D01,
+    0x03407C02, 0x03408102, 0x03408401, 0x03408901, 0x03408D02, 0x03409002, 0x03409F04, 0x0340A802, 0x0340A902, 0x0340AE01, 0x0340B902, 0x0340BC02,
+    0x0340BF02, 0x0340D002, 0x0340E402, 0x0340ED04, 0x0340F902, 0x0340FB06, 0x0340FF01, 0x03411C01, 0x03411E01, 0x03412101, 0x03412E01, 0x03414401,
+    0x03414E01, 0x03415001, 0x03415C02, 0x03415D02, 0x03416201, 0x03416301, 0x03418A02, 0x03418D02, 0x03418F04, 0x03419201, 0x03419602, 0x03419D02,
+    0x0341A202, 0x0341B101, 0x0341B306, 0x0341B603, 0x0341BB02, 0x0341BC02, 0x0341BD02, 0x0341BE02, 0x0341C801, 0x0341C901, 0x0341D102, 0x0341DA02,
+    0x0341E802, 0x0341EC01, 0x0341EF01, 0x0341F302, 0x0341F501, 0x0341F602, 0x0341F702, 0x0341FA02, 0x03420001, 0x03420601, 0x03420701, 0x03420A01,
+    0x03420D01, 0x03420F01, 0x03421001, 0x03421301, 0x03422202, 0x03422402, 0x03422602, 0x03422902, 0x03422A02, 0x03422C02, 0x03422D02, 0x03422F02,
+    0x03423002, 0x03423202, 0x03423302, 0x03423502, 0x03423D01, 0x03423E01, 0x03424202, 0x03424302, 0x03424402, 0x03424502, 0x03424602, 0x03426A02,
+    0x03427301, 0x03427601, 0x03427801, 0x03427E02, 0x03428202, 0x03428802, 0x03428A02, 0x03428C02, 0x03428D02, 0x03429602, 0x03429A02, 0x0342A002,
+    0x0342AE06, 0x0342B002, 0x0342B202, 0x0342B806, 0x0342BA03, 0x0342BB06, 0x0342BF01, 0x0342C102, 0x0342C202, 0x0342CC02, 0x0342CD06, 0x0342D001,
+    0x0342D201, 0x0342D301, 0x0342DE02, 0x03430101, 0x03430402, 0x03430B06, 0x03431501, 0x03431F06, 0x03432102, 0x03432306, 0x03432506, 0x03432F01,
+    0x03433101, 0x03433802, 0x03434206, 0x03434506, 0x03434702, 0x03434B02, 0x03435206, 0x03435306, 0x03435406, 0x03435702, 0x03435E01, 0x03436102,
+    0x03436202, 0x03436F02, 0x03437302, 0x03437A02, 0x03437B01, 0x03437C03, 0x03439302, 0x03439402, 0x03439902, 0x0343A601, 0x0343A701, 0x0343A801,
+    0x0343A901, 0x0343B001, 0x0343CC01, 0x0343DF01, 0x0343E102, 0x0343E202, 0x0343EB02, 0x03440B02, 0x03443801, 0x03444102, 0x03444302, 0x03446101,
+    0x03446301, 0x03446401, 0x03446C02, 0x03446D02, 0x03446E02, 0x03446F02, 0x03447202, 0x03447401, 0x0344A501, 0x0344A901, 0x0344BA02, 0x0344BD02,
+    0x0344BE02, 0x0344CE02, 0x03450202, 0x03450C02, 0x03451001, 0x03451F03, 0x03452201, 0x03452401, 0x03453002, 0x03453502, 0x03453606, 0x03454F02,
+    0x03456002, 0x03456402, 0x03456502, 0x03456602, 0x03456802, 0x03458B02, 0x03459102, 0x03459C02, 0x0345A201, 0x0345CE02, 0x0345D302, 0x0345DB01,
+    0x0345E502, 0x0345E602, 0x0345EC02, 0x0345F202, 0x0345F402, 0x0345F702, 0x03463302, 0x03463506, 0x03463701, 0x03464F01, 0x03465D02, 0x03466202,
+    0x03466502, 0x03467102, 0x03468802, 0x0346A404, 0x0346AF01, 0x0346B101, 0x0346B601, 0x0346D002, 0x0346D402, 0x0346D706, 0x0346D802, 0x0346F802,
+    0x0346F904, 0x03470B02, 0x03470C02, 0x03471C02, 0x03471F02, 0x03472002, 0x03472A02, 0x03473602, 0x03476D01, 0x03477702, 0x03477802, 0x03477A02,
+    0x03477B02, 0x03477D02, 0x03477E02, 0x03477F02, 0x03478002, 0x03478102, 0x03478202, 0x03478302, 0x03478402, 0x03478502, 0x03478602, 0x03478702,
+    0x03478802, 0x03478902, 0x03478A02, 0x03478B02, 0x03478C02, 0x03478D02, 0x03478E02, 0x03478F02, 0x03479002, 0x03479102, 0x03479202, 0x03479302,
+    0x03479402, 0x03479502, 0x03479602, 0x03479702, 0x03479802, 0x03479902, 0x03479A02, 0x03479B02, 0x0347B802, 0x0347BF02, 0x0347C501, 0x0347C601,
+    0x0347C701, 0x0347C801, 0x0347CF02, 0x0347D302, 0x0347D402, 0x0347D602, 0x0347EF01, 0x03481502, 0x03483602, 0x03484302, 0x03484702, 0x03486701,
+    0x03487D02, 0x03488F02, 0x0348AC02, 0x0348B702, 0x0348D101, 0x0348D602, 0x0348D902, 0x0348DB01, 0x0348E902, 0x0348EC02, 0x0348EF06, 0x0348F801,
+    0x03490301, 0x03490A01, 0x03491802, 0x03491A02, 0x03492C01, 0x03492D01, 0x03494001, 0x03494101, 0x03494B01, 0x03494C01, 0x03495502, 0x03497102,
+    0x03497602, 0x03497A01, 0x0349A101, 0x0349A401, 0x0349A501, 0x0349A702, 0x0349B101, 0x0349B201, 0x0349B401, 0x0349B702, 0x0349C101, 0x0349E101,
+    0x0349E301, 0x0349E501, 0x0349E701, 0x0349E801, 0x0349F102, 0x0349F202, 0x034A0101, 0x034A1002, 0x034A1202, 0x034A1302, 0x034A1802, 0x034A3A01,
+    0x034A3B01, 0x034A3C01, 0x034A3D01, 0x034A3E01, 0x034A3F01, 0x034A4001, 0x034A4101, 0x034A6402, 0x034A6D06, 0x034A7C01, 0x034A7D01, 0x034A8F01,
+    0x034A9B01, 0x034AAA01, 0x034AAD02, 0x034AD802, 0x034AD902, 0x034ADB02, 0x034ADD02, 0x034ADE02, 0x034ADF06, 0x034AE002, 0x034AE202, 0x034AE302,
+    0x034AE902, 0x034AF302, 0x034AF402, 0x034AF702, 0x034AFA06, 0x034B0F01, 0x034B1604, 0x034B1701, 0x034B4401, 0x034B4F01, 0x034B5601, 0x034B5901,
+    0x034B7901, 0x034B8401, 0x034B8502, 0x034B8602, 0x034B9601, 0x034B9701, 0x034B9802, 0x034B9A02, 0x034BA106, 0x034BAE02, 0x034BB501, 0x034BB601,
+    0x034BBD01, 0x034BBF04, 0x034BC802, 0x034BD002, 0x034BD302, 0x034BDB01, 0x034BE101, 0x034BE901, 0x034BF101, 0x034BF301, 0x034BF401, 0x034BF501,
+    0x034BFD01, 0x034BFF01, 0x034C0A02, 0x034C1101, 0x034C1301, 0x034C1401, 0x034C1F04, 0x034C3A02, 0x034C3D02, 0x034C4702, 0x034C4804, 0x034C5104,
+    0x034C5301, 0x034C5401, 0x034C6A02, 0x034C6D01, 0x034C7B02, 0x034C9402, 0x034C9F01, 0x034CA201, 0x034CA602, 0x034CBB02, 0x034CBC01, 0x034CBF02,
+    0x034CCB01, 0x034CD002, 0x034CD102, 0x034CD202, 0x034CD501, 0x034CD601, 0x034CD701, 0x034CE101, 0x034CE601, 0x034CEE01, 0x034CF001, 0x034CF101,
+    0x034CF601, 0x034CFB01, 0x034CFD01, 0x034CFE02, 0x034D0702, 0x034D0802, 0x034D0B02, 0x034D3301, 0x034D5701, 0x034D6001, 0x034D6301, 0x034D6802,
+    0x034D7C06, 0x034D8B02, 0x034D8F02, 0x034D9C01, 0x034DB201, 0x034DB501, 0x034DC501, 0x034DC702, 0x034DC903, 0x034DCF03, 0x034E6901, 0x034E6D01,
+    0x034E7001, 0x034E7702, 0x034E7A02, 0x034E8402, 0x034E8A02, 0x034E9102, 0x034E9202, 0x034E9402, 0x034E9601, 0x034EA101, 0x034EAC01, 0x034EAD01,
+    0x034EB601, 0x034EBA02, 0x034EC902, 0x034EF601, 0x034F1502, 0x034F1702, 0x034F1902, 0x034F1C02, 0x034F1D02, 0x034F2402, 0x034F2502, 0x034F3302,
+    0x034F4A01, 0x034F5102, 0x034F5302, 0x034F8E02, 0x034F9701, 0x034FB101, 0x034FB401, 0x034FBC06, 0x034FD301, 0x034FE206, 0x034FE402, 0x034FEE03,
+    0x034FFE01, 0x03500404, 0x03501801, 0x03502C01, 0x03503001, 0x03507002, 0x03507706, 0x0350F401, 0x03513D01, 0x03513E01, 0x03513F01, 0x03514001,
+    0x03514101, 0x03514A01, 0x03514B01, 0x03514C01, 0x03514E01, 0x03514F01, 0x0351BE01, 0x0351CD01, 0x0351D101, 0x0351D401, 0x0351F401, 0x03520F02,
+    0x03525E02, 0x03528E04, 0x0352AA01, 0x0352BB01, 0x0352BC01, 0x0352DF01, 0x0352E002, 0x0352E501, 0x0352E802, 0x0352F803, 0x03531701, 0x03532302,
+    0x03533301, 0x03533C04, 0x03534501, 0x03535502, 0x03536302, 0x03536702, 0x03537B03, 0x03538C02, 0x03539102, 0x03539D04, 0x0353F204, 0x0353F402,
+    0x0353F904, 0x03543403, 0x03544202, 0x03548B01, 0x03548D05, 0x0354A802, 0x0354D106, 0x0354E801, 0x0354E904, 0x0354F105, 0x03552604, 0x03552D02,
+    0x0355B201, 0x0355BE02, 0x0355BF02, 0x0355C102, 0x0355C502, 0x0355C602, 0x0355C702, 0x0355CB02, 0x0355CC02, 0x0355EF02, 0x0355F002, 0x0355F402,
+    0x0355F601, 0x0355F702, 0x0355F906, 0x03560A01, 0x03560B06, 0x03560E02, 0x03563506, 0x03563602, 0x03563D02, 0x03564001, 0x03565902, 0x03565A02,
+    0x03565B02, 0x0356AF02, 0x0356B501, 0x0356BC01, 0x0356C602, 0x0356CA02, 0x0356D202, 0x0356D303, 0x0356D402, 0x0356E202, 0x0356E304, 0x0356EB01,
+    0x0356F201, 0x0356FD02, 0x0356FE01, 0x03570902, 0x03571702, 0x03571E02, 0x03572802, 0x03573302, 0x03574401, 0x03574B02, 0x03575A01, 0x03575B01,
+    0x03575C01, 0x03575D01, 0x03575E01, 0x03575F01, 0x03576102, 0x03576201, 0x03576302, 0x03576401, 0x03576501, 0x03576601, 0x03576702, 0x03576801,
+    0x03576901, 0x03576C02, 0x03576D02, 0x03576F02, 0x03577702, 0x03577E02, 0x03578602, 0x0357B802, 0x0357BC01, 0x0357D304, 0x0357D402, 0x0357D502,
+    0x0357D602, 0x0357E302, 0x0357ED02, 0x03580001, 0x03580A04, 0x03580B01, 0x03582C01, 0x03582F02, 0x03583002, 0x03583B02, 0x03583D02, 0x03583F02,
+    0x03584204, 0x03584D02, 0x03584E02, 0x03584F02, 0x03585002, 0x03585102, 0x03585202, 0x03585302, 0x03585602, 0x03585702, 0x03585801, 0x03588706,
+    0x03588802, 0x03589A02, 0x0358AD01, 0x0358EC04, 0x0358F002, 0x0358F102, 0x0358F402, 0x03590102, 0x03590202, 0x03590301, 0x03590406, 0x03590502,
+    0x03590602, 0x03590702, 0x03590802, 0x03590902, 0x03590A02, 0x03590B02, 0x03590C02, 0x03590D02, 0x03590E02, 0x03590F02, 0x03591702, 0x03592102,
+    0x03592604, 0x03592807, 0x03592D02, 0x03593602, 0x03594402, 0x03594C02, 0x03595704, 0x03595C02, 0x03596901, 0x03597502, 0x03597602, 0x03597702,
+    0x03597802, 0x03597902, 0x03597A02, 0x03597D01, 0x03598204, 0x03598601, 0x03599701, 0x03599804, 0x03599B01, 0x03599C04, 0x0359A402, 0x0359A502,
+    0x0359A602, 0x0359AA02, 0x0359B402, 0x0359B502, 0x0359B602, 0x0359BC01, 0x0359C502, 0x0359C802, 0x0359CA02, 0x0359DD01, 0x0359EE02, 0x0359F002,
+    0x0359F401, 0x0359F902, 0x035A0A01, 0x035A1301, 0x035A1402, 0x035A1502, 0x035A1602, 0x035A1D02, 0x035A1E02, 0x035A1F02, 0x035A2C02, 0x035A2D02,
+    0x035A2E02, 0x035A3C02, 0x035A3F02, 0x035A4002, 0x035A4102, 0x035A4202, 0x035A4302, 0x035A4601, 0x035A4801, 0x035A4C02, 0x035A5103, 0x035A5B02,
+    0x035A5C02, 0x035A5D02, 0x035A5E03, 0x035A6002, 0x035A6202, 0x035A7002, 0x035A7702, 0x035A8302, 0x035A8402, 0x035A8A02, 0x035A8C02, 0x035AA102,
+    0x035AA302, 0x035AA401, 0x035AA602, 0x035AAA02, 0x035AAB02, 0x035AAC02, 0x035AAD02, 0x035AB401, 0x035AB702, 0x035AB802, 0x035AD901, 0x035ADF02,
+    0x035B0B01, 0x035B7104, 0x035B7A01, 0x035B8C01, 0x035B9202, 0x035B9A02, 0x035BA903, 0x035BB302, 0x035BC601, 0x035BC701, 0x035BC901, 0x035BCC01,
+    0x035BCE02, 0x035BCF01, 0x035BD001, 0x035BD103, 0x035BD404, 0x035BE004, 0x035BE501, 0x035BE802, 0x035BEA04, 0x035BEF02, 0x035BFD01, 0x035BFE02,
+    0x035C0604, 0x035C1302, 0x035C1601, 0x035C1701, 0x035C1A01, 0x035C1C01, 0x035C1D01, 0x035C3302, 0x035C3D02, 0x035C4102, 0x035C4202, 0x035C4402,
+    0x035C4602, 0x035C4702, 0x035C4904, 0x035C4E04, 0x035C4F02, 0x035C5002, 0x035C5102, 0x035C5302, 0x035C5402, 0x035C5502, 0x035C5F02, 0x035C6001,
+    0x035C6502, 0x035C6701, 0x035C7702, 0x035C7802, 0x035C7B04, 0x035C7C02, 0x035C7D04, 0x035C9004, 0x035C9404, 0x035CC001, 0x035CC401, 0x035CC502,
+    0x035CC602, 0x035CCE01, 0x035CD304, 0x035D1B01, 0x035D1C02, 0x035D3E01, 0x035D4E04, 0x035D5401, 0x035D5504, 0x035D5D02, 0x035D7F02, 0x035D8C01,
+    0x035D8E01, 0x035D9C01, 0x035DB501, 0x035DDD02, 0x035DFF04, 0x035E0104, 0x035E0304, 0x035E7D01, 0x035E7E01, 0x035E8001, 0x035E8101, 0x035E8201,
+    0x035E8401, 0x035E8501, 0x035E8601, 0x035E8801, 0x035E8901, 0x035E8A01, 0x035E8B01, 0x035E8C01, 0x035E8D01, 0x035E8F01, 0x035E9102, 0x035E9201,
+    0x035E9301, 0x035E9401, 0x035E9501, 0x035E9601, 0x035E9701, 0x035E9801, 0x035E9901, 0x035E9A01, 0x035E9B01, 0x035E9C01, 0x035E9D01, 0x035E9E01,
+    0x035E9F02, 0x035EA001, 0x035EA101, 0x035EA201, 0x035EA501, 0x035EA601, 0x035EA902, 0x035EB001, 0x035EB204, 0x035EB904, 0x035EBA01, 0x035EBB01,
+    0x035EBF01, 0x035EC001, 0x035EC201, 0x035EC301, 0x035ECB01, 0x035ECD04, 0x035EDA02, 0x035EDD06, 0x035EE104, 0x035EE502, 0x035EF104, 0x035EF401,
+    0x035EFE04, 0x035F0404, 0x035F1004, 0x035F1104, 0x035F1401, 0x035F1501, 0x035F1601, 0x035F3E02, 0x035F6501, 0x035F6C01, 0x035F8101, 0x035F8A01,
+    0x035F9001, 0x035F9101, 0x035F9201, 0x035F9501, 0x035FA101, 0x035FB401, 0x035FB501, 0x035FB601, 0x035FB701, 0x035FB801, 0x035FC101, 0x035FC501,
+    0x035FCB01, 0x035FDE01, 0x035FE101, 0x035FEC01, 0x035FF201, 0x035FF301, 0x035FF401, 0x035FF501, 0x035FF701, 0x035FFC02, 0x03600501, 0x03601901,
+    0x03601A01, 0x03601B01, 0x03602201, 0x03602301, 0x03602401, 0x03602F01, 0x03603502, 0x03607704, 0x03608A02, 0x0360A101, 0x0360A702, 0x0360B701,
+    0x0360BB01, 0x0360C001, 0x0360CD01, 0x0360CF01, 0x0360DA01, 0x0360DB04, 0x0360DC02, 0x0360DD04, 0x0360ED01, 0x03611502, 0x03614804, 0x03614A02,
+    0x03615702, 0x03616002, 0x03617A02, 0x03618001, 0x0361B001, 0x0361B201, 0x0361B602, 0x0361BE02, 0x0361CC01, 0x0361D201, 0x0361DC02, 0x0361DD02,
+    0x0361ED02, 0x0361EE02, 0x03620302, 0x03620702, 0x03620902, 0x03620F02, 0x03621001, 0x03621302, 0x03621401, 0x03621501, 0x03624B02, 0x03624D02,
+    0x03624F02, 0x03626D01, 0x03628E01, 0x03629102, 0x03629402, 0x03629702, 0x03629A01, 0x03629B01, 0x03629C01, 0x03629D01, 0x03629E01, 0x03629F01,
+    0x0362A002, 0x0362A602, 0x0362AE01, 0x0362AF01, 0x0362B701, 0x0362B801, 0x0362BA02, 0x0362BB02, 0x0362BD02, 0x0362BE02, 0x0362BF02, 0x0362C001,
+    0x0362C101, 0x0362C401, 0x0362C501, 0x0362C601, 0x0362C701, 0x0362D801, 0x03632B01, 0x03633502, 0x03633602, 0x03634202, 0x03634806, 0x03634A06,
+    0x03634D02, 0x03634F06, 0x03636501, 0x03636E02, 0x03636F01, 0x03637C04, 0x03638704, 0x03638A04, 0x03639B01, 0x03639F01, 0x0363AA04, 0x0363B801,
+    0x0363BA01, 0x0363BD01, 0x0363DC02, 0x0363ED01, 0x0363F101, 0x0363F404, 0x03640701, 0x03640D04, 0x03641301, 0x03643701, 0x03643801, 0x03645304,
+    0x03645601, 0x03645E01, 0x03646901, 0x03647304, 0x03649701, 0x0364A202, 0x0364A402, 0x0364B902, 0x0364BD01, 0x0364D101, 0x0364D601, 0x0364E101,
+    0x03652001, 0x03652201, 0x03652A01, 0x03659A01, 0x0365B402, 0x0365B602, 0x0365B802, 0x0365CB01, 0x0365EF02, 0x0365F302, 0x03662801, 0x03663201,
+    0x03663702, 0x03663A01, 0x03665201, 0x03665301, 0x03665501, 0x03666A04, 0x03666D01, 0x03669901, 0x0366A104, 0x0366B104, 0x0366B601, 0x0366BC01,
+    0x0366D601, 0x0366D704, 0x03672D01, 0x03673802, 0x03673F02, 0x03675206, 0x03676101, 0x03676301, 0x03678304, 0x03678A02, 0x03679A04, 0x0367A301,
+    0x0367A401, 0x0367AB01, 0x0367B801, 0x0367BE01, 0x0367F101, 0x03680501, 0x03684A02, 0x03685402, 0x03686104, 0x03686A01, 0x03687E01, 0x03688204,
+    0x0368B301, 0x0368B601, 0x0368C301, 0x0368F201, 0x03692101, 0x03693301, 0x03696B01, 0x03696F01, 0x03697201, 0x03697D01, 0x0369A902, 0x0369AA02,
+    0x0369B401, 0x0369BA01, 0x0369C301, 0x0369C401, 0x0369D301, 0x0369E001, 0x0369E601, 0x0369E901, 0x0369EA01, 0x0369F304, 0x0369F404, 0x0369F501,
+    0x036A1904, 0x036A3C02, 0x036A4902, 0x036A4B02, 0x036A5506, 0x036A7901, 0x036A7D04, 0x036A8101, 0x036A8501, 0x036A8601, 0x036A8701, 0x036A8801,
+    0x036A8901, 0x036A8A01, 0x036A8B01, 0x036A8D01, 0x036A9001, 0x036A9101, 0x036A9201, 0x036A9301, 0x036AA201, 0x036AA301, 0x036AA501, 0x036AA601,
+    0x036AAF04, 0x036AB902, 0x036AD004, 0x036AD301, 0x036AD601, 0x036ADE01, 0x036B1804, 0x036B1904, 0x036B3801, 0x036B3901, 0x036B4F01, 0x036B6101,
+    0x036B6702, 0x036B6902, 0x036B7B02, 0x036B7D02, 0x036B7E02, 0x036B7F02, 0x036BAB04, 0x036BEF06, 0x036C0504, 0x036C0A06, 0x036C0D01, 0x036C1C01,
+    0x036C4402, 0x036C7501, 0x036C7604, 0x036C7904, 0x036C8802, 0x036C8F02, 0x036CB302, 0x036CD202, 0x036CD302, 0x036CD402, 0x036CD601, 0x036CE701,
+    0x036CFD02, 0x036D0601, 0x036D0A01, 0x036D0C01, 0x036D1201, 0x036D2702, 0x036D2D02, 0x036D2E01, 0x036D2F01, 0x036D3101, 0x036D3D02, 0x036D3E02,
+    0x036D3F02, 0x036D4002, 0x036D4102, 0x036D4202, 0x036D7001, 0x036D7D06, 0x036D7E01, 0x036DAD02, 0x036DCC04, 0x036DD902, 0x036DEF01, 0x036DFB01,
+    0x036DFC02, 0x036DFD01, 0x036E3501, 0x036E4101, 0x036E4902, 0x036E4D02, 0x036E5602, 0x036E5F02, 0x036E6301, 0x036E6502, 0x036E6702, 0x036E6902,
+    0x036E6D01, 0x036E6E01, 0x036E6F01, 0x036E7001, 0x036E7101, 0x036E7401, 0x036E7901, 0x036E7B01, 0x036E7D01, 0x036E7E01, 0x036EA603, 0x036EA801,
+    0x036EA901, 0x036EAA01, 0x036EAB01, 0x036EC802, 0x036ECD01, 0x036ED201, 0x036EE101, 0x036EE901, 0x036EFB01, 0x036F0E01, 0x036F1001, 0x036F1601,
+    0x036F1901, 0x036F2301, 0x036F2602, 0x036F3802, 0x036F3C02, 0x036F4402, 0x036F5701, 0x036F5F06, 0x036F6002, 0x036FB501, 0x036FDE01, 0x036FF601,
+    0x03701C02, 0x03701F02, 0x03704601, 0x03705201, 0x03705C01, 0x03706E01, 0x03708304, 0x03708502, 0x03708701, 0x03709304, 0x0370A604, 0x0370A704,
+    0x0370A804, 0x0370CA01, 0x0370DF01, 0x0370E201, 0x03712401, 0x03712F01, 0x03713404, 0x03713501, 0x03713602, 0x03715301, 0x03715701, 0x03715801,
+    0x0371B801, 0x03720302, 0x03720401, 0x03721001, 0x03721301, 0x03722902, 0x03723601, 0x03724001, 0x03727F06, 0x03728106, 0x03729201, 0x03729D01,
+    0x0372A101, 0x0372A201, 0x0372D201, 0x0372DF02, 0x0372FC02, 0x03730E01, 0x03732B01, 0x03733806, 0x03738101, 0x03738402, 0x03739D01, 0x0373B301,
+    0x0373BE01, 0x0373BF01, 0x0373C001, 0x0373D202, 0x0373D302, 0x0373D702, 0x0373D802, 0x0373E901, 0x03743702, 0x03743C02, 0x03744202, 0x03744806,
+    0x03744906, 0x03744B02, 0x03744C02, 0x03745301, 0x03745401, 0x03746804, 0x03749402, 0x0374B501, 0x0374B701, 0x0374B801, 0x0374BA01, 0x0374CE01,
+    0x0374CF04, 0x0374D001, 0x03757B01, 0x0375C202, 0x0375C302, 0x0375C502, 0x0375D402, 0x0375D901, 0x0375F402, 0x0375FB01, 0x03761D01, 0x03763802,
+    0x03763A04, 0x03764504, 0x03767F02, 0x03768403, 0x0376D901, 0x0376DA03, 0x03770101, 0x03771E02, 0x03772006, 0x03774F02, 0x03775802, 0x03775903,
+    0x03776602, 0x03776901, 0x03776C02, 0x03778501, 0x03778A01, 0x03778B01, 0x03779401, 0x03779F02, 0x0377A402, 0x0377B703, 0x0377B901, 0x0377DB06,
+    0x0377EF01, 0x0377F204, 0x0377FA02, 0x03781002, 0x03781102, 0x03781701, 0x03782B01, 0x03783604, 0x03783A01, 0x03785B01, 0x03789101, 0x03789301,
+    0x03789902, 0x03789A02, 0x0378AE01, 0x0378BE06, 0x0378C401, 0x0378C801, 0x0378D604, 0x0378F704, 0x03790702, 0x03791001, 0x03793302, 0x03794801,
+    0x03795402, 0x03795F02, 0x03796106, 0x03796302, 0x03796402, 0x03796502, 0x03796602, 0x03796702, 0x03796802, 0x03796902, 0x03796A02, 0x03796B02,
+    0x03796C02, 0x0379A002, 0x0379A302, 0x0379C401, 0x0379C501, 0x0379D701, 0x0379DE01, 0x0379E001, 0x0379E301, 0x0379EE01, 0x0379F501, 0x0379F901,
+    0x037A0301, 0x037A0702, 0x037A0E04, 0x037A2402, 0x037A2504, 0x037A5B01, 0x037A5F01, 0x037AA701, 0x037ABE01, 0x037AD002, 0x037AD102, 0x037AD202,
+    0x037B3E01, 0x037B3F01, 0x037B5101, 0x037B6402, 0x037B7101, 0x037B8702, 0x037BA402, 0x037BA802, 0x037BAA02, 0x037BBF02, 0x037BDB01, 0x037BDD01,
+    0x037BE206, 0x037BED01, 0x037C0102, 0x037C0206, 0x037C0302, 0x037C0806, 0x037C0906, 0x037C1101, 0x037C1301, 0x037C1A02, 0x037C1B02, 0x037C2901,
+    0x037C2A01, 0x037C2C04, 0x037C2D01, 0x037C4F02, 0x037C7902, 0x037C7D02, 0x037C7E06, 0x037C8001, 0x037C9B02, 0x037C9C02, 0x037C9D01, 0x037CB403,
+    0x037CB502, 0x037CB602, 0x037CB702, 0x037CB802, 0x037CB902, 0x037CBC02, 0x037CBE02, 0x037CCC02, 0x037CD202, 0x037CD302, 0x037CF402, 0x037CF506,
+    0x037CF606, 0x037CF704, 0x037CF806, 0x037CF902, 0x037D0201, 0x037D0401, 0x037D1104, 0x037D1F02, 0x037D2506, 0x037D2906, 0x037D3F02, 0x037D4006,
+    0x037D4102, 0x037D4B01, 0x037D4E01, 0x037D5C04, 0x037D8201, 0x037D9601, 0x037DA001, 0x037DA101, 0x037DAC01, 0x037DBA01, 0x037DC001, 0x037DCB01,
+    0x037DD301, 0x037DEC01, 0x037E0306, 0x037E0501, 0x037E0A01, 0x037E1401, 0x037E1702, 0x037E1C01, 0x037E2301, 0x037E2401, 0x037E2A02, 0x037E3301,
+    0x037E3802, 0x037E4401, 0x037E5102, 0x037E5202, 0x037E5302, 0x037E5402, 0x037E5802, 0x037E6701, 0x037E6D02, 0x037E6E02, 0x037E7501, 0x037E7C01,
+    0x037E9301, 0x037ED601, 0x037EE101, 0x037F0F01, 0x037F1B02, 0x037F2002, 0x037F2C01, 0x037F6502, 0x037F7001, 0x037F8201, 0x037F8701, 0x037FCD01,
+    0x037FCE01, 0x037FD502, 0x03801401, 0x03801A01, 0x03804601, 0x03805101, 0x03806001, 0x03806201, 0x03806801, 0x03807301, 0x03809201, 0x03809801,
+    0x03809D02, 0x0380B001, 0x0380CB01, 0x0380CC01, 0x0380CD01, 0x0380CE01, 0x0380CF01, 0x0380D001, 0x03813201, 0x03816A01, 0x03816B01, 0x03816C01,
+    0x03816D01, 0x03817D01, 0x03817E01, 0x03817F01, 0x03818001, 0x03818101, 0x03818201, 0x03818301, 0x03818401, 0x0381B601, 0x0381DC02, 0x0381E402,
+    0x0381E502, 0x0381FA01, 0x0381FC01, 0x03820501, 0x03821E01, 0x03822601, 0x03822F01, 0x03823701, 0x03823D01, 0x03823F01, 0x03824901, 0x03824C01,
+    0x03825001, 0x03825303, 0x03825802, 0x03825C03, 0x03825D01, 0x03827702, 0x03828F07, 0x03829204, 0x03829307, 0x03829601, 0x0382C701, 0x0382D201,
+    0x0382D401, 0x0382DC01, 0x0382DD01, 0x0382DE01, 0x0382E301, 0x03830402, 0x03831601, 0x03833501, 0x03833A02, 0x03834601, 0x03834D01, 0x03836E01,
+    0x03836F02, 0x03837702, 0x03837F03, 0x03838503, 0x0383B101, 0x0383B901, 0x0383BE01, 0x0383C001, 0x0383C602, 0x0383C901, 0x0383CA01, 0x0383CC01,
+    0x0383D501, 0x0383E101, 0x0383F901, 0x03840201, 0x03840501, 0x03840701, 0x03840901, 0x03840E01, 0x03841701, 0x03841F01, 0x03842901, 0x03842E01,
+    0x03844D03, 0x03845801, 0x03851001, 0x0385ED01, 0x0385EF01, 0x0385F001, 0x0385F101, 0x0385F401, 0x0385F501, 0x0385F601, 0x0385FB01, 0x0385FC01,
+    0x0385FE01, 0x03862501, 0x03865C04, 0x03865E04, 0x03866001, 0x03866301, 0x0386BC02, 0x03871601, 0x03873701, 0x03875901, 0x03877501, 0x03879301,
+    0x03879504, 0x0387A101, 0x0387BD01, 0x0387C102, 0x0387E301, 0x0387F304, 0x0387FB01, 0x03881701, 0x03882F01, 0x03883001, 0x03883101, 0x03883201,
+    0x03883301, 0x03883401, 0x03883501, 0x03883601, 0x03883701, 0x03883801, 0x03883901, 0x03883A01, 0x03883B01, 0x03883C01, 0x03883D01, 0x03883E01,
+    0x03884104, 0x03884B01, 0x03884C01, 0x03888B01, 0x03889301, 0x0388BB01, 0x0388BC01, 0x0388CF02, 0x0388EE02, 0x03891701, 0x03891E06, 0x03893401,
+    0x03894A01, 0x03895801, 0x03895A01, 0x03895E01, 0x03899404, 0x03899802, 0x0389A202, 0x0389A302, 0x0389A501, 0x0389AB01, 0x0389C201, 0x0389D702,
+    0x0389DB01, 0x0389DE01, 0x0389F001, 0x038A0C01, 0x038A0E01, 0x038A1701, 0x038A1801, 0x038A1901, 0x038A1A01, 0x038A3C02, 0x038A3D02, 0x038A6301,
+    0x038A6501, 0x038A6601, 0x038A6702, 0x038A6803, 0x038A6A01, 0x038A6D02, 0x038A6E02, 0x038A6F02, 0x038A7102, 0x038A7602, 0x038A7702, 0x038A7806,
+    0x038A8201, 0x038AE104, 0x038AED01, 0x038B0401, 0x038B0501, 0x038B2001, 0x038B2204, 0x038B3302, 0x038B3402, 0x038B3502, 0x038B5101, 0x038B6C01,
+    0x038B7B05, 0x038B8C04, 0x038B8D01, 0x038B8E01, 0x038BA002, 0x038BC701, 0x038BC901, 0x038BD801, 0x038C0301, 0x038C0801, 0x038C5A02, 0x038C6202,
+    0x038C6502, 0x038C6F02, 0x038CA601, 0x038CAE01, 0x038CB101, 0x038CB601, 0x038CB802, 0x038CC602, 0x038CC901, 0x038CD301, 0x038CDE06, 0x038CE001,
+    0x038CE104, 0x038CE701, 0x038CFA02, 0x038D0502, 0x038D0601, 0x038D0701, 0x038D0801, 0x038D0901, 0x038D1C01, 0x038D3006, 0x038D4202, 0x038D4302,
+    0x038D4402, 0x038D4501, 0x038D4601, 0x038D4801, 0x038D6101, 0x038D6201, 0x038D6301, 0x038D6401, 0x038D6501, 0x038D6601, 0x038D6C01, 0x038DA801,
+    0x038DAC02, 0x038DAD02, 0x038DAF02, 0x038DBD02, 0x038DD101, 0x038DD401, 0x038E0901, 0x038E0A01, 0x038E0E01, 0x038E1102, 0x038E1202, 0x038E1302,
+    0x038E3D01, 0x038E3E02, 0x038E5201, 0x038E6302, 0x038E6601, 0x038E8A01, 0x038EB301, 0x038EB601, 0x038EB901, 0x038EC704, 0x038ECA04, 0x038ECD01,
+    0x038ED901, 0x038F3A01, 0x038F3B02, 0x038F3D02, 0x038F4101, 0x038F4201, 0x038F4301, 0x038F4401, 0x038F5C01, 0x038F7102, 0x038FB302, 0x038FB502,
+    0x038FC006, 0x038FC102, 0x038FD903, 0x038FDA01, 0x03900401, 0x03900501, 0x03900601, 0x03900701, 0x03900A01, 0x03900D01, 0x03900F02, 0x03901202,
+    0x03901602, 0x03901802, 0x03901902, 0x03901A02, 0x03901B02, 0x03901E02, 0x03902501, 0x03903901, 0x03904901, 0x03906001, 0x03906D02, 0x03906E02,
+    0x03906F01, 0x03907C01, 0x03907D01, 0x03908001, 0x03909401, 0x0390C902, 0x0390CA02, 0x0390CF01, 0x03910102, 0x03910202, 0x03910301, 0x03911602,
+    0x03911802, 0x03911A02, 0x03911B02, 0x03911C02, 0x03913A02, 0x03914501, 0x03914601, 0x03915C01, 0x03916101, 0x03916201, 0x03916C01, 0x03917A01,
+    0x03918A02, 0x03918B02, 0x03918C01, 0x03918D01, 0x03919F01, 0x0391A101, 0x0391A201, 0x0391AC01, 0x0391AD01, 0x0391E701, 0x0391E801, 0x0391E901,
+    0x0391F301, 0x03920801, 0x03920A01, 0x03921201, 0x03921C01, 0x03921D01, 0x03924E01, 0x03925A01, 0x03926402, 0x03926A01, 0x03928401, 0x03928501,
+    0x03928601, 0x03928801, 0x03928D01, 0x0392A902, 0x0392B101, 0x0392C401, 0x0392CA01, 0x0392D101, 0x03930402, 0x03932602, 0x03933501, 0x03933B02,
+    0x03935003, 0x03938201, 0x03938E01, 0x0393A201, 0x0393AB01, 0x0393BC01, 0x0393C901, 0x0393CF01, 0x0393D001, 0x0393E101, 0x0393E201, 0x0393E301,
+    0x0393E401, 0x0393E501, 0x0393E601, 0x0393E701, 0x0393EA01, 0x0393EB01, 0x0393F401, 0x0393F501, 0x0393F601, 0x0393F701, 0x0393F802, 0x0393FA02,
+    0x0393FB02, 0x0393FD02, 0x0393FE02, 0x03940002, 0x03945506, 0x03945606, 0x03945706, 0x03945806, 0x03945901, 0x03945C02, 0x03946901, 0x03946D01,
+    0x03946F02, 0x03947202, 0x03947D01, 0x03948C01, 0x03949601, 0x0394B301, 0x0394B804, 0x0394BF01, 0x0394C401, 0x0394C502, 0x0394C701, 0x0394C802,
+    0x0394CB01, 0x0394D001, 0x0394D401, 0x0394D501, 0x0394FA02, 0x0394FB01, 0x03951A02, 0x03952D02, 0x03953701, 0x03957D02, 0x03958D02, 0x0395C201,
+    0x0395D101, 0x0395D201, 0x0395D301, 0x0395D401, 0x0395E501, 0x0395E601, 0x0395E701, 0x0395E801, 0x0395EC01, 0x0395F001, 0x0395F601, 0x0395F701,
+    0x0395F801, 0x0395F901, 0x0395FC02, 0x03962001, 0x03962106, 0x03963601, 0x03963901, 0x03963A01, 0x03963B01, 0x03964001, 0x03965301, 0x03965501,
+    0x03965601, 0x03965701, 0x03965B01, 0x03965C01, 0x03966601, 0x03966801, 0x03966D01, 0x03967501, 0x03967D01, 0x03968201, 0x03968901, 0x03968A01,
+    0x03968B01, 0x03968C01, 0x03968D01, 0x0396B001, 0x0396B401, 0x0396CE01, 0x0396E101, 0x0396E306, 0x0396E601, 0x0396EC01, 0x0396F501, 0x0396FE01,
+    0x0396FF01, 0x03970101, 0x03970402, 0x03970501, 0x03970602, 0x03971201, 0x03971506, 0x03971602, 0x03971A01, 0x03971B01, 0x03971C01, 0x03971D01,
+    0x03971F01, 0x03972201, 0x03972302, 0x03973102, 0x03973206, 0x03976502, 0x03979301, 0x0397A401, 0x0397A502, 0x0397B101, 0x0397BA02, 0x0397C001,
+    0x0397C101, 0x0397C702, 0x0397CD01, 0x0397D901, 0x0397DA01, 0x03980306, 0x03980E01, 0x03981201, 0x03981A01, 0x03981B01, 0x03981C01, 0x03981D01,
+    0x03981F01, 0x03982001, 0x03983B01, 0x03984302, 0x03984901, 0x03984A01, 0x03985C02, 0x03986102, 0x03986602, 0x03986702, 0x03986802, 0x03986902,
+    0x03986A02, 0x03987001, 0x03987101, 0x03987201, 0x03987301, 0x03987401, 0x03987501, 0x03987902, 0x03987A02, 0x03987B01, 0x03987C01, 0x03988F01,
+    0x03989401, 0x03989601, 0x03989701, 0x03989801, 0x0398A101, 0x0398A701, 0x0398BD04, 0x0398BF02, 0x0398C501, 0x0398C601, 0x0398D901, 0x0398E601,
+    0x0398FB01, 0x0398FC01, 0x03990102, 0x03990502, 0x03991004, 0x03992602, 0x03993B01, 0x03994604, 0x03995006, 0x03995901, 0x03995B01, 0x03996504,
+    0x03997502, 0x03997902, 0x03997A02, 0x03997E02, 0x03997F03, 0x03998003, 0x03998103, 0x03998902, 0x03998E04, 0x03999D01, 0x0399A402, 0x0399A502,
+    0x0399BB02, 0x0399BC06, 0x0399D801, 0x0399EB01, 0x0399EC02, 0x0399EE01, 0x0399F302, 0x0399F402, 0x0399F502, 0x0399F702, 0x0399F802, 0x0399F902,
+    0x0399FA06, 0x0399FB02, 0x039A1601, 0x039A1701, 0x039A1801, 0x039A1901, 0x039A1A02, 0x039A2201, 0x039A2402, 0x039A2901, 0x039A2C04, 0x039A2D02,
+    0x039A3001, 0x039A3101, 0x039A3301, 0x039A3401, 0x039A3501, 0x039A3701, 0x039A3801, 0x039A3901, 0x039A3A01, 0x039A3B01, 0x039A3C01, 0x039A3D01,
+    0x039A3E01, 0x039A3F01, 0x039A4001, 0x039A4101, 0x039A4201, 0x039A4301, 0x039A4401, 0x039A4501, 0x039A4601, 0x039A4701, 0x039A4801, 0x039A4901,
+    0x039A4A02, 0x039A6001, 0x039A6101, 0x039A6701, 0x039A6901, 0x039A7002, 0x039A7302, 0x039A7402, 0x039A7902, 0x039A7C02, 0x039A7D02, 0x039A8101,
+    0x039A8404, 0x039A8504, 0x039A8702, 0x039A8F02, 0x039A9402, 0x039A9503, 0x039A9802, 0x039A9902, 0x039A9A02, 0x039A9B02, 0x039A9C02, 0x039A9D02,
+    0x039AA602, 0x039ABF06, 0x039AC102, 0x039AC702, 0x039ACC02, 0x039ACD03, 0x039AD101, 0x039ADA01, 0x039AE401, 0x039AEA01, 0x039AEC01, 0x039AEE01,
+    0x039AEF01, 0x039AF102, 0x039AF201, 0x039AF403, 0x039AFA06, 0x039AFB01, 0x039B1402, 0x039B2002, 0x039B2102, 0x039B2401, 0x039B2B01, 0x039B2C01,
+    0x039B3201, 0x039B3301, 0x039B3601, 0x039B4102, 0x039B4401, 0x039B5602, 0x039B5702, 0x039B5E01, 0x039B6102, 0x039B6202, 0x039B8301, 0x039B8401,
+    0x039B8601, 0x039B8701, 0x039B9201, 0x039B9302, 0x039B9401, 0x039B9502, 0x039B9602, 0x039B9702, 0x039B9802, 0x039BA201, 0x039BAB01, 0x039BAF01,
+    0x039BB001, 0x039BB101, 0x039BB201, 0x039BC001, 0x039BCE01, 0x039BD302, 0x039BD502, 0x039BD602, 0x039BE401, 0x039BE701, 0x039BF501, 0x039BF601,
+    0x039BFD01, 0x039C0301, 0x039C0B01, 0x039C1901, 0x039C2301, 0x039C2401, 0x039C2501, 0x039C3001, 0x039C3A01, 0x039C3B01, 0x039C3C01, 0x039C4001,
+    0x039C4701, 0x039C4E01, 0x039C5402, 0x039C6302, 0x039C6502, 0x039C6A01, 0x039C6B01, 0x039C7902, 0x039C7F02, 0x039C9B02, 0x039CA301, 0x039CAC02,
+    0x039CBE01, 0x039CCA02, 0x039CCC02, 0x039CD701, 0x039CD801, 0x039CDA02, 0x039CE302, 0x039CE401, 0x039CE702, 0x039CE802, 0x039CE906, 0x039CF101,
+    0x039CF301, 0x039CF501, 0x039D0002, 0x039D0102, 0x039D9A01, 0x039DA901, 0x039DAB01, 0x039DAC01, 0x039DB104, 0x039DB701, 0x039E6D01, 0x039E7801,
+    0x039E7B01, 0x039E7C01, 0x039E7D01, 0x039E7E01, 0x039E8301, 0x039E8501, 0x039E8701, 0x039E8901, 0x039E9C01, 0x039E9D01, 0x039EA801, 0x039EA901,
+    0x039ECD03, 0x039EFD01, 0x039F0C01, 0x039F0D01, 0x039F1001, 0x039F1601, 0x039F1701, 0x039F1A02, 0x039F2701, 0x039F3B02, 0x039F3D02, 0x039F3F01,
+    0x039FF302, 0x039FF401, 0x039FF501, 0x039FFA01, 0x03A00F01, 0x03A01401, 0x03A03202, 0x03A04101, 0x03A05401, 0x03A07006, 0x03A07301, 0x03A07E01,
+    0x03A07F01, 0x03A08101, 0x03A08201, 0x03A08301, 0x03A08401, 0x03A08501, 0x03A09301, 0x03A09501, 0x03A09601, 0x03A0A001, 0x03A0A501, 0x03A0B002,
+    0x03A12A01, 0x03A12B02, 0x03A12C02, 0x03A12D02, 0x03A13201, 0x03A13301, 0x03A13501, 0x03A13601, 0x03A13801, 0x03A14301, 0x03A19801, 0x03A1AD02,
+    0x03A1B101, 0x03A1B602, 0x03A1C101, 0x03A1C501, 0x03A21802, 0x03A2A601, 0x03A2A801, 0x03A2A901, 0x03A2DC01, 0x03A34A01, 0x03A36A01, 0x03A38501,
+    0x03A38D01, 0x03A39401, 0x03A39701, 0x03A39801, 0x03A3AF01, 0x03A3B301, 0x03A3DF02, 0x03A3E501, 0x03A3FC01, 0x03A40A01, 0x03A40B01, 0x03A40F01,
+    0x03A42401, 0x03A42501, 0x03A44001, 0x03A45504, 0x03A45E02, 0x03A45F02, 0x03A46301, 0x03A58901, 0x03A58A01, 0x03A58F01, 0x03A59204, 0x03A59801,
+    0x03A59E01, 0x03A59F01, 0x03A5AF01, 0x03A5B101, 0x03A5B301, 0x03A5B401, 0x03A5B501, 0x03A5B601, 0x03A5B801, 0x03A5BA01, 0x03A5BB01, 0x03A5BC01,
+    0x03A5BD01, 0x03A5D201, 0x03A5D601, 0x03A5D801, 0x03A5D901, 0x03A5DB01, 0x03A5E201, 0x03A5E301, 0x03A5ED01, 0x03A5F001, 0x03A60202, 0x03A60302,
+    0x03A63401, 0x03A64801, 0x03A64C01, 0x03A66B02, 0x03A66C01, 0x03A6B101, 0x03A6B701, 0x03A6BA02, 0x03A6BB02, 0x03A6BD02, 0x03A6BE02, 0x03A6BF02,
+    0x03A6C002, 0x03A6C802, 0x03A6C902, 0x03A6CA02, 0x03A6CB02, 0x03A6DE01, 0x03A6E401, 0x03A6E501, 0x03A6ED02, 0x03A6F301, 0x03A6F401, 0x03A6FB01,
+    0x03A6FE01, 0x03A70201, 0x03A70F01, 0x03A72001, 0x03A72A01, 0x03A73101, 0x03A73B01, 0x03A75401, 0x03A75801, 0x03A77A01, 0x03A79B01, 0x03A81701,
+    0x03A83501, 0x03A84201, 0x03A84301, 0x03A84401, 0x03A84501, 0x03A84601, 0x03A84701, 0x03A84804, 0x03A87701, 0x03A87804, 0x03A87B01, 0x03A87E01,
+    0x03A88101, 0x03A88601, 0x03A88C01, 0x03A89101, 0x03A8A001, 0x03A8B901, 0x03A8BA01, 0x03A8C401, 0x03A8CB01, 0x03A8DF01, 0x03A8E001, 0x03A8E101,
+    0x03A8E201, 0x03A8E401, 0x03A8E501, 0x03A8E604, 0x03A8E801, 0x03A8E901, 0x03A8EA01, 0x03A8EB01, 0x03A8ED01, 0x03A8EE01, 0x03A8F101, 0x03A8F201,
+    0x03A8F501, 0x03A8F601, 0x03A8F801, 0x03A8F901, 0x03A8FA01, 0x03A8FB01, 0x03A8FC01, 0x03A8FD01, 0x03A8FE01, 0x03A90001, 0x03A90101, 0x03A91101,
+    0x03A91201, 0x03A91601, 0x03A91701, 0x03A93401, 0x03A93D01, 0x03A93E01, 0x03A94001, 0x03A94101, 0x03A94301, 0x03A94401, 0x03A94B01, 0x03A98501,
+    0x03A9B601, 0x03A9C301, 0x03A9DC01, 0x03A9DD01, 0x03A9E001, 0x03A9E801, 0x03AA0501, 0x03AA0B01, 0x03AA0C01, 0x03AA0D01, 0x03AA0F01, 0x03AA1301,
+    0x03AA1401, 0x03AA2A01, 0x03AA2C01, 0x03AA4001, 0x03AA5101, 0x03AA5501, 0x03AA6A01, 0x03AA6C01, 0x03AA7101, 0x03AA7201, 0x03AA7301, 0x03AA7901,
+    0x03AA8204, 0x03AA8601, 0x03AA8702, 0x03AA8A02, 0x03AA8C02, 0x03AA8F02, 0x03AA9701, 0x03AA9906, 0x03AA9A01, 0x03AA9B01, 0x03AAA101, 0x03AAA301,
+    0x03AAA401, 0x03AAA701, 0x03AAC001, 0x03AAC101, 0x03AADE04, 0x03AAF001, 0x03AAFF01, 0x03AB0301, 0x03AB0401, 0x03AB0E01, 0x03AB1701, 0x03AB1801,
+    0x03AB4001, 0x03AB5F01, 0x03AB6901, 0x03AB6B01, 0x03AB8E02, 0x03AB9002, 0x03AB9401, 0x03ABA801, 0x03ABAC01, 0x03ABAD01, 0x03ABAF01, 0x03ABCB01,
+    0x03ABCD01, 0x03ABD501, 0x03ABDC01, 0x03ABE501, 0x03ABE701, 0x03ABE801, 0x03ABE901, 0x03ABEA01, 0x03ABEB01, 0x03ABEC01, 0x03AC3104, 0x03AC4201,
+    0x03AC4702, 0x03AC4A01, 0x03AC4B01, 0x03AC5201, 0x03AC5301, 0x03AC5801, 0x03AC6101, 0x03AC6304, 0x03AC6A01, 0x03AC6C01, 0x03AC7401, 0x03AC7501,
+    0x03ACA501, 0x03ACA701, 0x03ACA801, 0x03ACA901, 0x03ACAA01, 0x03ACAB01, 0x03ACAC01, 0x03ACAD01, 0x03ACAE01, 0x03ACAF01, 0x03ACB001, 0x03ACB101,
+    0x03ACB401, 0x03ACBA01, 0x03ACC101, 0x03ACC301, 0x03ACC601, 0x03ACC901, 0x03ACEE01, 0x03AD1502, 0x03AD1602, 0x03AD2601, 0x03AD2B01, 0x03AD4001,
+    0x03AD4A01, 0x03AD6A01, 0x03AD7201, 0x03AD7B01, 0x03AD8501, 0x03AD8701, 0x03AD8801, 0x03AD8D01, 0x03AD8E01, 0x03AD9B01, 0x03AD9C01, 0x03AD9D01,
+    0x03AD9E01, 0x03ADAF01, 0x03ADB101, 0x03ADB201, 0x03ADB301, 0x03ADB701, 0x03ADB801, 0x03ADBD01, 0x03ADBE01, 0x03ADD501, 0x03ADE601, 0x03ADE701,
+    0x03ADF502, 0x03AE1101, 0x03AE1401, 0x03AE1901, 0x03AE1A02, 0x03AE2A01, 0x03AE2C01, 0x03AE3101, 0x03AE3601, 0x03AE3701, 0x03AE6E01, 0x03AE7201,
+    0x03AE8004, 0x03AEA601, 0x03AED101, 0x03AED601, 0x03AEDA01, 0x03AEDD01, 0x03AEE201, 0x03AEE801, 0x03AEEA01, 0x03AEEB01, 0x03AEEC01, 0x03AF0401,
+    0x03AF1301, 0x03AF1401, 0x03AF2101, 0x03AF2A01, 0x03AF2B01, 0x03AF3005, 0x03AF3401, 0x03AF3601, 0x03AF3702, 0x03AF5B01, 0x03AF6101, 0x03AF6701,
+    0x03AF7101, 0x03AF7F04, 0x03AF8601, 0x03AF9101, 0x03AFA601, 0x03AFB901, 0x03AFC401, 0x03AFE501, 0x03AFFF01, 0x03B00D01, 0x03B02501, 0x03B02C01,
+    0x03B02D01, 0x03B03901, 0x03B03E01, 0x03B04E01, 0x03B04F01, 0x03B06501, 0x03B06E04, 0x03B09A01, 0x03B09B01, 0x03B09E01, 0x03B0A701, 0x03B0B902,
+    0x03B0C301, 0x03B0C804, 0x03B0DF01, 0x03B11101, 0x03B11401, 0x03B11501, 0x03B11801, 0x03B13C02, 0x03B15F01, 0x03B16001, 0x03B16101, 0x03B17001,
+    0x03B17A01, 0x03B18804, 0x03B19602, 0x03B19802, 0x03B1AF01, 0x03B1B001, 0x03B1B204, 0x03B1EB02, 0x03B1EF01, 0x03B1F402, 0x03B20101, 0x03B22804,
+    0x03B28C04, 0x03B2BD02, 0x03B2D604, 0x03B32201, 0x03B32C01, 0x03B34002, 0x03B35B01, 0x03B36A01, 0x03B37301, 0x03B37402, 0x03B39402, 0x03B3E704,
+    0x03B3EA01, 0x03B3EC04, 0x03B40004, 0x03B40801, 0x03B40C01, 0x03B41802, 0x03B41B04, 0x03B42F06, 0x03B45401, 0x03B46C01, 0x03B46E04, 0x03B47D01,
+    0x03B48E01, 0x03B49004, 0x03B49204, 0x03B4A304, 0x03B4E301, 0x03B4FF04, 0x03B50D04, 0x03B52702, 0x03B53B01, 0x03B54304, 0x03B54501, 0x03B55B01,
+    0x03B56502, 0x03B56602, 0x03B56A06, 0x03B57E02, 0x03B58104, 0x03B59101, 0x03B59301, 0x03B5AE01, 0x03B5B104, 0x03B5B206, 0x03B5D804, 0x03B5FA01,
+    0x03B5FB01, 0x03B61201, 0x03B61601, 0x03B61C04, 0x03B62204, 0x03B62501, 0x03B64301, 0x03B64C01, 0x03B65E01, 0x03B66204, 0x03B66B01, 0x03B67001,
+    0x03B67106, 0x03B67401, 0x03B68102, 0x03B68202, 0x03B68902, 0x03B68A02, 0x03B68C02, 0x03B69B01, 0x03B6CC01, 0x03B6CF01, 0x03B6D001, 0x03B6EB02,
+    0x03B70F02, 0x03B71301, 0x03B71901, 0x03B71A01, 0x03B71F02, 0x03B72001, 0x03B72401, 0x03B72501, 0x03B73201, 0x03B73E01, 0x03B74201, 0x03B74701,
+    0x03B75601, 0x03B76801, 0x03B76D01, 0x03B77502, 0x03B78901, 0x03B79601, 0x03B79701, 0x03B79801, 0x03B7A701, 0x03B7A901, 0x03B7AA01, 0x03B7B301,
+    0x03B7DD02, 0x03B7F102, 0x03B80702, 0x03B84C01, 0x03B86A01, 0x03B86C01, 0x03B86D01, 0x03B86E01, 0x03B86F01, 0x03B87504, 0x03B8DB01, 0x03B8F901,
+    0x03B90001, 0x03B90501, 0x03B90901, 0x03B90C01, 0x03B91D01, 0x03B92501, 0x03B93101, 0x03B93501, 0x03B97401, 0x03B97E01, 0x03B98101, 0x03B98D01,
+    0x03B98F01, 0x03B99401, 0x03B99501, 0x03B99602, 0x03B9A901, 0x03B9AB01, 0x03B9B401, 0x03B9B501, 0x03B9BC02, 0x03B9CC01, 0x03B9CD01, 0x03B9D501,
+    0x03B9DC02, 0x03B9EF02, 0x03B9F001, 0x03BA5502, 0x03BA6F02, 0x03BA7002, 0x03BA7102, 0x03BAB502, 0x03BAB602, 0x03BAB702, 0x03BABE01, 0x03BAE101,
+    0x03BB4202, 0x03BB6601, 0x03BB6C01, 0x03BB6D01, 0x03BB6E01, 0x03BB8501, 0x03BB9E02, 0x03BBA202, 0x03BBB704, 0x03BBB901, 0x03BBBE02, 0x03BBCE01,
+    0x03BC0C01, 0x03BC3106, 0x03BC4D02, 0x03BC5A01, 0x03BC6802, 0x03BC7101, 0x03BC7501, 0x03BC7901, 0x03BC8001, 0x03BCAA01, 0x03BCAE01, 0x03BCB501,
+    0x03BCD801, 0x03BCDF02, 0x03BCE901, 0x03BD0202, 0x03BD1001, 0x03BD1601, 0x03BD1901, 0x03BD1A01, 0x03BD4E03, 0x03BD4F03, 0x03BD5002, 0x03BD5103,
+    0x03BD5202, 0x03BD5301, 0x03BD5403, 0x03BD5803, 0x03BD5F01, 0x03BD6B01, 0x03BD6C01, 0x03BD7A01, 0x03BD7E01, 0x03BD8904, 0x03BD8F01, 0x03BD9201,
+    0x03BD9301, 0x03BD9D01, 0x03BDC704, 0x03BDD004, 0x03BDDB01, 0x03BDF801, 0x03BDFA01, 0x03BE0501, 0x03BE1E01, 0x03BE2B04, 0x03BE4404, 0x03BE4504,
+    0x03BE5202, 0x03BE5E02, 0x03BE6102, 0x03BE7C01, 0x03BE8C06, 0x03BE8D02, 0x03BEAB02, 0x03BEAC02, 0x03BEBE02, 0x03BEC802, 0x03BECB02, 0x03BECC02,
+    0x03BECD02, 0x03BEEF01, 0x03BEFF04, 0x03BF0601, 0x03BF0D01, 0x03BF0E04, 0x03BF1502, 0x03BF6B01, 0x03BF6C01, 0x03BF7C01, 0x03BF8201, 0x03BF8702,
+    0x03BF8802, 0x03BF8901, 0x03BF8B01, 0x03BFB702, 0x03BFB902, 0x03BFBB02, 0x03BFE302, 0x03C00901, 0x03C01502, 0x03C01603, 0x03C01A03, 0x03C02701,
+    0x03C06501, 0x03C07101, 0x03C07901, 0x03C08801, 0x03C08901, 0x03C09C01, 0x03C0A101, 0x03C0B501, 0x03C0E101, 0x03C0E802, 0x03C0EB01, 0x03C10A01,
+    0x03C10B01, 0x03C11702, 0x03C13902, 0x03C15102, 0x03C16602, 0x03C18802, 0x03C19301, 0x03C19401, 0x03C1B701, 0x03C1E501, 0x03C20601, 0x03C20701,
+    0x03C21A01, 0x03C21B01, 0x03C21C01, 0x03C22201, 0x03C22A01, 0x03C22E01, 0x03C23A01, 0x03C23C02, 0x03C24902, 0x03C25104, 0x03C25E01, 0x03C28801,
+    0x03C28F01, 0x03C29701, 0x03C29801, 0x03C2B601, 0x03C2B701, 0x03C2BB01, 0x03C31D01, 0x03C31E02, 0x03C33F01, 0x03C34001, 0x03C36B01, 0x03C36C01,
+    0x03C36D01, 0x03C38001, 0x03C39101, 0x03C39201, 0x03C3A001, 0x03C3B201, 0x03C3DC01, 0x03C3EB01, 0x03C3F101, 0x03C3F204, 0x03C41602, 0x03C41702,
+    0x03C43801, 0x03C44302, 0x03C44402, 0x03C44502, 0x03C44602, 0x03C45303, 0x03C46501, 0x03C46701, 0x03C47201, 0x03C48401, 0x03C48B04, 0x03C48F01,
+    0x03C49201, 0x03C49D01, 0x03C4BF02, 0x03C4C502, 0x03C4C702, 0x03C4D502, 0x03C4D602, 0x03C4E001, 0x03C51102, 0x03C51B02, 0x03C55102, 0x03C55D01,
+    0x03C55F01, 0x03C56501, 0x03C57C01, 0x03C5D502, 0x03C5D602, 0x03C5DD01, 0x03C61901, 0x03C61A01, 0x03C61B01, 0x03C61C01, 0x03C61E01, 0x03C62201,
+    0x03C64C01, 0x03C65C01, 0x03C65E01, 0x03C68801, 0x03C69E02, 0x03C69F06, 0x03C6A002, 0x03C6A702, 0x03C6A802, 0x03C6A902, 0x03C6AA02, 0x03C6BB02,
+    0x03C6D701, 0x03C6E602, 0x03C6F601, 0x03C6F702, 0x03C70D01, 0x03C71502, 0x03C72302, 0x03C76301, 0x03C76501, 0x03C77C02, 0x03C77D02, 0x03C77E04,
+    0x03C7F401, 0x03C84B01, 0x03C84C01, 0x03C88202, 0x03C88401, 0x03C8D303, 0x03C8D501, 0x03C8D601, 0x03C8D701, 0x03C8F601, 0x03C8FF01, 0x03C90002,
+    0x03C91601, 0x03C94F01, 0x03C96701, 0x03C98302, 0x03C99B03, 0x03C99D01, 0x03C9B601, 0x03C9B701, 0x03C9B801, 0x03C9C201, 0x03C9D802, 0x03C9F802,
+    0x03CA0001, 0x03CA1A04, 0x03CA1B04, 0x03CA1C04, 0x03CA2A01, 0x03CA2F04, 0x03CA4D04, 0x03CA5801, 0x03CA6301, 0x03CA7B02, 0x03CA9D01, 0x03CAA404,
+    0x03CAA704, 0x03CAA804, 0x03CAAA02, 0x03CAAC02, 0x03CAB701, 0x03CAB801, 0x03CAC602, 0x03CAC702, 0x03CAD101, 0x03CAEA01, 0x03CAF001, 0x03CAF101,
+    0x03CAF901, 0x03CAFE01, 0x03CB0101, 0x03CB0201, 0x03CB0302, 0x03CB0402, 0x03CB2D02, 0x03CB2E02, 0x03CB3102, 0x03CB3701, 0x03CB3801, 0x03CB4602,
+    0x03CB4802, 0x03CB5205, 0x03CB5901, 0x03CB5B01, 0x03CB7102, 0x03CB7601, 0x03CB7701, 0x03CB9D01, 0x03CBA401, 0x03CBB101, 0x03CBB201, 0x03CBB301,
+    0x03CBB401, 0x03CBB701, 0x03CBBA02, 0x03CBC502, 0x03CBC603, 0x03CBC702, 0x03CBC802, 0x03CBCB02, 0x03CBDA04, 0x03CBDB01, 0x03CBED02, 0x03CBEE02,
+    0x03CC1702, 0x03CC1802, 0x03CC1A01, 0x03CC3702, 0x03CC7E01, 0x03CCED01, 0x03CCF501, 0x03CD1A01, 0x03CD4E02, 0x03CD9801, 0x03CD9C01, 0x03CDAD01,
+    0x03CDBC04, 0x03CDD701, 0x03CE1D01, 0x03CEBF01, 0x03CEC301, 0x03CEC501, 0x03CF4C01, 0x03D01401, 0x03D01A01, 0x03D02301, 0x03D02702, 0x03D02A02,
+    0x03D02B02, 0x03D05A01, 0x03D08001, 0x03D08501, 0x03D08F01, 0x03D09701, 0x03D09901, 0x03D09E01, 0x03D09F01, 0x03D0A001, 0x03D0AE01, 0x03D0B401,
+    0x03D0B502, 0x03D0CC01, 0x03D0D901, 0x03D0DA01, 0x03D0F501, 0x03D10902, 0x03D10C02, 0x03D11502, 0x03D11902, 0x03D11B01, 0x03D14802, 0x03D15001,
+    0x03D15D02, 0x03D15E02, 0x03D15F02, 0x03D17001, 0x03D17E02, 0x03D18001, 0x03D18501, 0x03D18601, 0x03D18C01, 0x03D18D01, 0x03D19101, 0x03D19701,
+    0x03D1A601, 0x03D1BE01, 0x03D1D102, 0x03D1D202, 0x03D1D302, 0x03D1D602, 0x03D1DA02, 0x03D1DB02, 0x03D21802, 0x03D21B02, 0x03D23702, 0x03D23802,
+    0x03D23A01, 0x03D24802, 0x03D24902, 0x03D25401, 0x03D25901, 0x03D25C01, 0x03D26E01, 0x03D26F01, 0x03D27901, 0x03D2A201, 0x03D2B601, 0x03D2B801,
+    0x03D2D901, 0x03D35101, 0x03D35301, 0x03D35702, 0x03D35902, 0x03D36301, 0x03D3B304, 0x03D3C401, 0x03D3C501, 0x03D3DC02, 0x03D3F601, 0x03D3F801,
+    0x03D42E01, 0x03D45701, 0x03D45801, 0x03D45901, 0x03D45A01, 0x03D45D01, 0x03D45E01, 0x03D45F01, 0x03D46001, 0x03D46101, 0x03D46201, 0x03D46301,
+    0x03D46401, 0x03D46501, 0x03D46601, 0x03D46701, 0x03D46801, 0x03D46A01, 0x03D46B01, 0x03D46C01, 0x03D46D01, 0x03D46E01, 0x03D46F01, 0x03D47001,
+    0x03D47101, 0x03D47B01, 0x03D47C01, 0x03D47D01, 0x03D47E01, 0x03D48001, 0x03D48201, 0x03D48301, 0x03D48401, 0x03D48501, 0x03D48601, 0x03D48701,
+    0x03D48801, 0x03D48901, 0x03D49801, 0x03D4C501, 0x03D4FA01, 0x03D50C01, 0x03D50D01, 0x03D51401, 0x03D51B01, 0x03D55B01, 0x03D59101, 0x03D5BD01,
+    0x03D5C501, 0x03D5D201, 0x03D60C02, 0x03D60E02, 0x03D61B02, 0x03D61E02, 0x03D61F02, 0x03D62001, 0x03D62101, 0x03D62201, 0x03D62301, 0x03D62401,
+    0x03D62501, 0x03D62601, 0x03D62701, 0x03D62801, 0x03D62901, 0x03D62A01, 0x03D62B01, 0x03D62C01, 0x03D62D01, 0x03D62E01, 0x03D62F01, 0x03D63001,
+    0x03D63101, 0x03D66E02, 0x03D68302, 0x03D68701, 0x03D68802, 0x03D69B01, 0x03D6AB01, 0x03D6AC01, 0x03D6B301, 0x03D6B401, 0x03D6FD01, 0x03D72201,
+    0x03D72F01, 0x03D73501, 0x03D73601, 0x03D73D01, 0x03D75601, 0x03D75701, 0x03D75C01, 0x03D77801, 0x03D77C01, 0x03D77D01, 0x03D7F101, 0x03D7FD01,
+    0x03D80701, 0x03D80901, 0x03D80A01, 0x03D80B01, 0x03D80C01, 0x03D80D01, 0x03D80E01, 0x03D80F01, 0x03D81202, 0x03D86901, 0x03D88D01, 0x03D89001,
+    0x03D89201, 0x03D89801, 0x03D8A702, 0x03D8B301, 0x03D8B401, 0x03D8BD01, 0x03D8D701, 0x03D8DA01, 0x03D8EA01, 0x03D8EF01, 0x03D8FE01, 0x03D90E01,
+    0x03D91901, 0x03D93802, 0x03D95901, 0x03D96701, 0x03D96801, 0x03D96901, 0x03D96A01, 0x03D96D01, 0x03D98A01, 0x03D99301, 0x03D9CC01, 0x03D9F401,
+    0x03DA3801, 0x03DA4801, 0x03DA5D01, 0x03DA5F01, 0x03DA6601, 0x03DA6A01, 0x03DA8C01, 0x03DACC02, 0x03DACF05, 0x03DAE901, 0x03DB4B04, 0x03DB4E01,
+    0x03DB5A01, 0x03DBB601, 0x03DBF201, 0x03DBF802, 0x03DBFD01, 0x03DBFE01, 0x03DBFF01, 0x03DC0101, 0x03DC0401, 0x03DC2D01, 0x03DC5801, 0x03DC5901,
+    0x03DC5C01, 0x03DC5F01, 0x03DD2A01, 0x03DD3801, 0x03DD5E01, 0x03DD6C01, 0x03DD6D01, 0x03DD7401, 0x03DD9202, 0x03DDB701, 0x03DE4F02, 0x03DE5102,
+    0x03DE5F01, 0x03DE6201, 0x03DE6C02, 0x03DE7201, 0x03DE7C01, 0x03DE8301, 0x03DE9401, 0x03DE9604, 0x03DE9D06, 0x03DE9E04, 0x03DEA001, 0x03DEA101,
+    0x03DEA604, 0x03DEEB01, 0x03DEEE01, 0x03DF3D01, 0x03DF4A01, 0x03DF8304, 0x03DFB202, 0x03DFBC01, 0x03DFC101, 0x03DFCC02, 0x03DFCD01, 0x03DFCF01,
+    0x03DFD601, 0x03DFD701, 0x03DFFC01, 0x03E02501, 0x03E04501, 0x03E06E01, 0x03E0AD01, 0x03E0B401, 0x03E0B501, 0x03E0D101, 0x03E0DE01, 0x03E0E501,
+    0x03E0E602, 0x03E0E701, 0x03E0F901, 0x03E0FF01, 0x03E10001, 0x03E10201, 0x03E10A01, 0x03E11002, 0x03E11102, 0x03E11202, 0x03E11602, 0x03E11802,
+    0x03E11902, 0x03E11A02, 0x03E11C02, 0x03E11D02, 0x03E11F01, 0x03E12B01, 0x03E13D01, 0x03E14201, 0x03E14301, 0x03E14501, 0x03E18C04, 0x03E19801,
+    0x03E19901, 0x03E1C901, 0x03E1CA02, 0x03E1CB02, 0x03E1CC02, 0x03E1CD02, 0x03E1CE02, 0x03E1CF02, 0x03E1D002, 0x03E1D102, 0x03E1D202, 0x03E1D302,
+    0x03E1D402, 0x03E1D502, 0x03E1D602, 0x03E1D702, 0x03E1D802, 0x03E1D902, 0x03E1F701, 0x03E20102, 0x03E20202, 0x03E20302, 0x03E20402, 0x03E20502,
+    0x03E20602, 0x03E20702, 0x03E20802, 0x03E20902, 0x03E20A02, 0x03E20B02, 0x03E20C02, 0x03E21201, 0x03E22103, 0x03E22A03, 0x03E24801, 0x03E29601,
+    0x03E2C901, 0x03E2CA01, 0x03E2CD01, 0x03E36801, 0x03E38201, 0x03E39F01, 0x03E3E401, 0x03E3EA01, 0x03E42401, 0x03E42802, 0x03E42902, 0x03E42A02,
+    0x03E42D02, 0x03E42F01, 0x03E44302, 0x03E44601, 0x03E45104, 0x03E46702, 0x03E48A01, 0x03E4D901, 0x03E4DF01, 0x03E4E101, 0x03E4FB02, 0x03E50202,
+    0x03E52602, 0x03E52A02, 0x03E53302, 0x03E54801, 0x03E55002, 0x03E55501, 0x03E55A01, 0x03E55C01, 0x03E57802, 0x03E57A02, 0x03E58002, 0x03E58102,
+    0x03E5EB04, 0x03E5FB01, 0x03E62A01, 0x03E63802, 0x03E63902, 0x03E63A06, 0x03E63E04, 0x03E64201, 0x03E68006, 0x03E6CD02, 0x03E6E302, 0x03E6F902,
+    0x03E6FA02, 0x03E70B02, 0x03E73302, 0x03E74406, 0x03E75D01, 0x03E76102, 0x03E76201, 0x03E78E02, 0x03E79902, 0x03E7C106, 0x03E7C502, 0x03E7D801,
+    0x03E7DD02, 0x03E7DE04, 0x03E7DF01, 0x03E7E001, 0x03E7E102, 0x03E7E201, 0x03E7E301, 0x03E7E401, 0x03E7E502, 0x03E7E602, 0x03E7F502, 0x03E7FE02,
+    0x03E80702, 0x03E80902, 0x03E81001, 0x03E81302, 0x03E81602, 0x03E82801, 0x03E84C04, 0x03E84E01, 0x03E85101, 0x03E86002, 0x03E86D02, 0x03E89202,
+    0x03E8A502, 0x03E8BC02, 0x03E94701, 0x03E96001, 0x03E96401, 0x03E96F01, 0x03E97302, 0x03E97402, 0x03E97D04, 0x03E98D01, 0x03E99001, 0x03E99A01,
+    0x03E9A801, 0x03E9BE02, 0x03E9BF02, 0x03E9D002, 0x03E9DA01, 0x03E9EF02, 0x03EA0A02, 0x03EA1C01, 0x03EA3101, 0x03EA3506, 0x03EA3902, 0x03EA3A01,
+    0x03EA4F02, 0x03EA5002, 0x03EA5502, 0x03EA5802, 0x03EA9102, 0x03EA9502, 0x03EA9701, 0x03EA9E02, 0x03EAA602, 0x03EAA702, 0x03EAAA02, 0x03EAAF01,
+    0x03EAB002, 0x03EAC302, 0x03EAC701, 0x03EADF02, 0x03EB1E02, 0x03EB2101, 0x03EB2206, 0x03EB3F01, 0x03EB7701, 0x03EB7F01, 0x03EB8406, 0x03EB8506,
+    0x03EB8801, 0x03EB8901, 0x03EB8A01, 0x03EB8B01, 0x03EB8C01, 0x03EBC604, 0x03EBC804, 0x03EBED01, 0x03EBF001, 0x03EC0201, 0x03EC0601, 0x03EC0901,
+    0x03EC1201, 0x03EC1402, 0x03EC1506, 0x03EC1802, 0x03EC1904, 0x03EC2901, 0x03EC2B02, 0x03EC3606, 0x03EC3801, 0x03EC3901, 0x03EC3A01, 0x03EC3B01,
+    0x03EC4101, 0x03EC4601, 0x03EC4A01, 0x03EC5F01, 0x03EC8501, 0x03EC9A02, 0x03ECB702, 0x03ECC201, 0x03ECCD02, 0x03ECCE02, 0x03ECD202, 0x03ECFA01,
+    0x03ECFC06, 0x03ED0201, 0x03ED0306, 0x03ED0402, 0x03ED0506, 0x03ED1C01, 0x03ED1D01, 0x03ED2101, 0x03ED2D01, 0x03ED4901, 0x03ED5001, 0x03ED5101,
+    0x03ED5201, 0x03ED5501, 0x03ED5B01, 0x03ED7101, 0x03ED9F01, 0x03EDA601, 0x03EDAC01, 0x03EDB401, 0x03EDCA04, 0x03EDCB01, 0x03EDD201, 0x03EDD501,
+    0x03EDE102, 0x03EDE601, 0x03EDF001, 0x03EDF301, 0x03EE0102, 0x03EE0206, 0x03EE0502, 0x03EE0606, 0x03EE5002, 0x03EE5202, 0x03EE5406, 0x03EE5502,
+    0x03EE5602, 0x03EE5901, 0x03EE6F01, 0x03EE8101, 0x03EE8A02, 0x03EE8B06, 0x03EE9C01, 0x03EE9F01, 0x03EEA001, 0x03EEA101, 0x03EECA02, 0x03EECC02,
+    0x03EECE02, 0x03EED402, 0x03EED901, 0x03EEE704, 0x03EEEA01, 0x03EEF501, 0x03EEF601, 0x03EEFC01, 0x03EF0501, 0x03EF0601, 0x03EF0A04, 0x03EF1801,
+    0x03EF2A02, 0x03EF4D01, 0x03EF5E01, 0x03EF6302, 0x03EF6501, 0x03EF6E01, 0x03EF7701, 0x03EF8A01, 0x03EF8B01, 0x03EF9206, 0x03EF9802, 0x03EF9A02,
+    0x03EF9D01, 0x03EFA002, 0x03EFAA01, 0x03EFAB01, 0x03EFC301, 0x03EFD001, 0x03EFE501, 0x03EFEB01, 0x03EFF301, 0x03EFFD01, 0x03F00201, 0x03F01601,
+    0x03F01702, 0x03F03202, 0x03F03302, 0x03F03402, 0x03F03502, 0x03F03602, 0x03F03F02, 0x03F09401, 0x03F0A802, 0x03F0BA01, 0x03F0DC01, 0x03F0ED06,
+    0x03F11604, 0x03F13101, 0x03F13906, 0x03F14602, 0x03F14802, 0x03F23F01, 0x03F24001, 0x03F24401, 0x03F24A04, 0x03F24C02, 0x03F24D02, 0x03F25004,
+    0x03F25601, 0x03F25701, 0x03F26402, 0x03F28202, 0x03F29902, 0x03F29C01, 0x03F2A301, 0x03F2A901, 0x03F2B002, 0x03F2B202, 0x03F2B301, 0x03F2B802,
+    0x03F2BB02, 0x03F2BC02, 0x03F2C202, 0x03F2C302, 0x03F2D101, 0x03F2DE01, 0x03F2DF01, 0x03F2E302, 0x03F2EA01, 0x03F31501, 0x03F31701, 0x03F32201,
+    0x03F32C06, 0x03F33504, 0x03F34302, 0x03F34E01, 0x03F34F01, 0x03F36802, 0x03F36906, 0x03F36A06, 0x03F36D02, 0x03F36E06, 0x03F37601, 0x03F37901,
+    0x03F37B01, 0x03F3D601, 0x03F42E01, 0x03F42F01, 0x03F43A01, 0x03F43E02, 0x03F44B01, 0x03F46002, 0x03F4AB01, 0x03F4C301, 0x03F4C706, 0x03F4CD06,
+    0x03F4CE06, 0x03F4DD06, 0x03F51001, 0x03F53B06, 0x03F53C02, 0x03F53E02, 0x03F53F02, 0x03F54406, 0x03F54606, 0x03F5A102, 0x03F5A306, 0x03F5A702,
+    0x03F5A802, 0x03F5B401, 0x03F5B802, 0x03F5BC06, 0x03F5CD01, 0x03F5E402, 0x03F5E602, 0x03F5EB02, 0x03F60002, 0x03F60306, 0x03F64C01, 0x03F64D01,
+    0x03F64E01, 0x03F65F02, 0x03F66901, 0x03F67301, 0x03F67401, 0x03F68201, 0x03F68601, 0x03F68801, 0x03F6A901, 0x03F6AC01, 0x03F6B001, 0x03F6D701,
+    0x03F70A04, 0x03F71402, 0x03F72A01, 0x03F72E01, 0x03F74701, 0x03F77B01, 0x03F7CB01, 0x03F7CE02, 0x03F7D401, 0x03F7FA01, 0x03F80701, 0x03F83001,
+    0x03F83301, 0x03F87D02, 0x03F88002, 0x03F88402, 0x03F88602, 0x03F88706, 0x03F88B04, 0x03F89002, 0x03F89102, 0x03F89202, 0x03F89302, 0x03F89402,
+    0x03F89706, 0x03F89802, 0x03F89902, 0x03F8A102, 0x03F8A701, 0x03F8AA01, 0x03F8B404, 0x03F8B701, 0x03F8BD02, 0x03F8C906, 0x03F8D502, 0x03F8EB02,
+    0x03F8F104, 0x03F8FB02, 0x03F90501, 0x03F90901, 0x03F90F02, 0x03F91201, 0x03F91A01, 0x03F91D02, 0x03F91E02, 0x03F92202, 0x03F92302, 0x03F92902,
+    0x03F92B02, 0x03F93202, 0x03F93402, 0x03F94304, 0x03F94402, 0x03F95802, 0x03F95A02, 0x03F95B02, 0x03F96902, 0x03F9D302, 0x03F9D901, 0x03F9E901,
+    0x03FA0101, 0x03FA2306, 0x03FA5602, 0x03FA5E01, 0x03FA6101, 0x03FA6402, 0x03FA7E02, 0x03FA8D02, 0x03FAA302, 0x03FAB301, 0x03FABE06, 0x03FAC601,
+    0x03FACA01, 0x03FB0C06, 0x03FB0E02, 0x03FB1102, 0x03FB1202, 0x03FB1A02, 0x03FB5901, 0x03FBA406, 0x03FBE701, 0x03FC3401, 0x03FC6304, 0x03FCC104,
+    0x03FCF101, 0x03FCF201, 0x03FCFA01, 0x03FCFC01, 0x03FCFD01, 0x03FCFE01, 0x03FCFF01, 0x03FD0601, 0x03FD0701, 0x03FD0801, 0x03FD1B06, 0x03FD3501,
+    0x03FD4301, 0x03FD6701, 0x03FD6A01, 0x03FD6B01, 0x03FD7A01, 0x03FD9102, 0x03FD9602, 0x03FDD502, 0x03FDF702, 0x03FE0001, 0x03FE1E01, 0x03FE2B01,
+    0x03FE3202, 0x03FE3302, 0x03FE4001, 0x03FE4104, 0x03FE4E01, 0x03FE5202, 0x03FE5302, 0x03FE5B01, 0x03FE6001, 0x03FE7401, 0x03FE8702, 0x03FE8902,
+    0x03FEA104, 0x03FEB401, 0x03FEFA01, 0x03FF0001, 0x03FF3B06, 0x03FF5906, 0x03FF5A02, 0x03FF8F02, 0x03FFC003, 0x03FFDB02, 0x03FFE002, 0x03FFE202,
+    0x03FFE302, 0x03FFE506, 0x04000602, 0x04000D02, 0x04001106, 0x04001801, 0x04002002, 0x04002101, 0x04003001, 0x04005202, 0x04005302, 0x04005402,
+    0x04005702, 0x04005802, 0x04006A01, 0x04008B01, 0x0400A901, 0x0400AA01, 0x0400C502, 0x0400C602, 0x0400CD02, 0x0400FB02, 0x0400FC02, 0x0400FD02,
+    0x0400FE02, 0x0400FF02, 0x04010002, 0x04010102, 0x04011102, 0x04011302, 0x04014102, 0x04015402, 0x04015502, 0x04016C01, 0x04017001, 0x04017501,
+    0x04017901, 0x04017C02, 0x04018A04, 0x04018D01, 0x04019104, 0x0401DA02, 0x0401E002, 0x0401E302, 0x0401E502, 0x0401EA01, 0x0401ED01, 0x0401F702,
+    0x04020004, 0x04022501, 0x04023D02, 0x04024204, 0x04024504, 0x04024C04, 0x04028F02, 0x04029202, 0x04029B01, 0x0402C702, 0x0402E801, 0x0402EA02,
+    0x0402EE02, 0x0402FE02, 0x04031302, 0x04031402, 0x04031901, 0x04031E01, 0x04034902, 0x04034A02, 0x04034E01, 0x0403BA01, 0x0403CB01, 0x0403CC01,
+    0x0403DF02, 0x0403E401, 0x0403FD02, 0x04040A04, 0x04040B04, 0x04041901, 0x04041E01, 0x04042701, 0x04046E01, 0x04048001, 0x04049901, 0x04049E01,
+    0x0404A506, 0x0404B206, 0x0404CE01, 0x0404FA01, 0x0404FF02, 0x04051602, 0x04054301, 0x04054501, 0x04056A01, 0x04056B01, 0x04056C01, 0x04057C02,
+    0x0405A801, 0x0405B704, 0x0405DA02, 0x0405E002, 0x0405E402, 0x0405E802, 0x0405E901, 0x0405EA02, 0x0405F001, 0x0405F301, 0x0405F802, 0x04061301,
+    0x04061501, 0x04061C01, 0x04062302, 0x04062402, 0x04062901, 0x04067C01, 0x04067D01, 0x04068B02, 0x04069701, 0x04069901, 0x0406A002, 0x0406A102,
+    0x0406A802, 0x0406AC02, 0x0406AD02, 0x0406AE02, 0x0406B002, 0x0406B102, 0x0406B202, 0x0406B502, 0x0406B702, 0x0406B902, 0x0406BB02, 0x0406BC02,
+    0x0406BD02, 0x0406C701, 0x0406C801, 0x0406CF02, 0x0406D001, 0x0406D201, 0x0406D402, 0x0406E002, 0x0406EC02, 0x0406F002, 0x0406F102, 0x0406F602,
+    0x0406FE02, 0x04070202, 0x04070302, 0x04071B01, 0x04072902, 0x04072B02, 0x04072D02, 0x04073401, 0x04073F02, 0x04074002, 0x04074202, 0x04074402,
+    0x04075602, 0x04075702, 0x04076201, 0x04076701, 0x04076801, 0x04076B01, 0x04076C01, 0x04077902, 0x04079502, 0x04079602, 0x04079902, 0x0407A002,
+    0x0407A801, 0x0407AA03, 0x0407AB01, 0x0407B002, 0x0407B702, 0x0407C202, 0x0407CD01, 0x0407CE01, 0x0407EA01, 0x0407ED02, 0x0407F206, 0x0407F601,
+    0x0407F701, 0x0407FA02, 0x04081A01, 0x04083101, 0x04084101, 0x0408A802, 0x0408AC02, 0x0408AD02, 0x0408D301, 0x0408F101, 0x04090B01, 0x04094F01,
+    0x04095201, 0x04097B02, 0x04097E02, 0x04099601, 0x0409CC01, 0x0409D201, 0x0409DA01, 0x0409DB02, 0x0409DC02, 0x0409E101, 0x0409E401, 0x0409E701,
+    0x0409F102, 0x040A0801, 0x040A1F02, 0x040A4501, 0x040A6B01, 0x040A6C01, 0x040A6D01, 0x040A6E01, 0x040A6F01, 0x040A7101, 0x040A8A01, 0x040A8B01,
+    0x040AAA02, 0x040AEF01, 0x040B0802, 0x040B1802, 0x040B2102, 0x040B3501, 0x040B4002, 0x040B5001, 0x040B9B01, 0x040B9C03, 0x040BA901, 0x040BB401,
+    0x040BC506, 0x040BE302, 0x040BE506, 0x040C1501, 0x040C1D01, 0x040C2A02, 0x040C2B02, 0x040C3701, 0x040C3902, 0x040C3F06, 0x040C6202, 0x040C6902,
+    0x040C7B02, 0x040C8001, 0x040C8A01, 0x040CAF02, 0x040CC402, 0x040CEB01, 0x040CEC01, 0x040CEE01, 0x040CFD06, 0x040CFF01, 0x040D0401, 0x040D1201,
+    0x040D1701, 0x040D5001, 0x040D5101, 0x040D5301, 0x040D6601, 0x040D8201, 0x040D8801, 0x040D8901, 0x040D8B01, 0x040D8C01, 0x040D9202, 0x040DAF01,
+    0x040DB802, 0x040DD101, 0x040DD701, 0x040E9701, 0x040E9A01, 0x040EA006, 0x040EA702, 0x040EAA02, 0x040EBA01, 0x040ECB02, 0x040EDD02, 0x040EF701,
+    0x040F1001, 0x040F1901, 0x040F4806, 0x040F5D01, 0x040F6702, 0x040F9602, 0x040F9802, 0x040FBF03, 0x040FCF01, 0x040FE801, 0x040FFE01, 0x04100001,
+    0x04100101, 0x04102901, 0x04102A01, 0x0410D404, 0x0410E002, 0x0410FF01, 0x04121B02, 0x0412A902, 0x0412E401, 0x0412E601, 0x0412E702, 0x0412E901,
+    0x0412F301, 0x0412F602, 0x0412F802, 0x0412F902, 0x04131D01, 0x04132C02, 0x04132E02, 0x04133902, 0x04134801, 0x04135E02, 0x04135F01, 0x04136002,
+    0x04136B02, 0x04137A01, 0x04137B01, 0x04137D02, 0x04139601, 0x04139801, 0x04139901, 0x04139A01, 0x04139B01, 0x04139C01, 0x04139D01, 0x04139E01,
+    0x04139F01, 0x0413A001, 0x0413A102, 0x0413A302, 0x0413C606, 0x0413CA02, 0x0413CB02, 0x0413CC02, 0x0413CD06, 0x0413CE02, 0x0413CF02, 0x0413D002,
+    0x0413D102, 0x0413D202, 0x0413D701, 0x04141401, 0x04141501, 0x04141802, 0x04141D02, 0x04143402, 0x04144E06, 0x04145601, 0x04148001, 0x04148101,
+    0x04148701, 0x0414A101, 0x0414AE01, 0x0414AF01, 0x0414B201, 0x0414D806, 0x0414DF02, 0x0414E002, 0x0414F002, 0x0414F101, 0x0414F201, 0x0414F702,
+    0x04151D02, 0x04152A01, 0x04152B01, 0x04152C01, 0x04152D01, 0x04153402, 0x04153702, 0x04154602, 0x04154902, 0x04155502, 0x04155A02, 0x04155B02,
+    0x04156106, 0x04156402, 0x04156502, 0x04156A01, 0x04157902, 0x04157D02, 0x04158901, 0x04158B01, 0x04158C01, 0x04159206, 0x0415B501, 0x0415F001,
+    0x04160201, 0x04160F02, 0x04162601, 0x04162901, 0x04162B01, 0x04162D01, 0x04163701, 0x04163801, 0x04163D01, 0x04166201, 0x04166502, 0x04167001,
+    0x04167201, 0x04168001, 0x04168301, 0x04169202, 0x04169302, 0x0416B001, 0x0416BC06, 0x0416C303, 0x0416C402, 0x0416C702, 0x0416C802, 0x0416D202,
+    0x0416D302, 0x0416D402, 0x0416D502, 0x0416D702, 0x0416D802, 0x0416DA02, 0x0416DB02, 0x0416DC02, 0x0416DD06, 0x0416DF06, 0x0416E102, 0x0416E202,
+    0x04170C02, 0x04171D04, 0x04173001, 0x04173601, 0x04173F01, 0x04174301, 0x04175D01, 0x04178E01, 0x04178F02, 0x04179701, 0x04179A01, 0x0417AB01,
+    0x0417B401, 0x0417D701, 0x0417DD01, 0x0417ED01, 0x0417F201, 0x0417F501, 0x0417FB01, 0x0417FF01, 0x04183B04, 0x04184D01, 0x04185F01, 0x04187401,
+    0x04187601, 0x04188301, 0x04188706, 0x04188D02, 0x04189D01, 0x0418A101, 0x0418A401, 0x0418AB01, 0x0418B302, 0x0418B902, 0x0418BA02, 0x0418BB02,
+    0x04192C01, 0x04193901, 0x04193E01, 0x04194601, 0x04195401, 0x04195601, 0x04195901, 0x04195B01, 0x04197801, 0x04198F01, 0x04199001, 0x0419E701,
+    0x0419E901, 0x0419EA02, 0x0419EC02, 0x0419EF02, 0x0419FC01, 0x041A1003, 0x041A1501, 0x041A1601, 0x041A1901, 0x041A3001, 0x041A4701, 0x041A4903,
+    0x041A4D02, 0x041A7B01, 0x041A8E01, 0x041A9702, 0x041AA701, 0x041AA902, 0x041AAA01, 0x041AAE01, 0x041ABA01, 0x041AC301, 0x041ACA01, 0x041ACD06,
+    0x041AD401, 0x041AD601, 0x041AD701, 0x041AD801, 0x041AFD01, 0x041B2701, 0x041B3601, 0x041B6601, 0x041B6701, 0x041B8501, 0x041B8601, 0x041B9901,
+    0x041B9A01, 0x041B9B01, 0x041B9C01, 0x041BD302, 0x041BE204, 0x041C0701, 0x041C0A01, 0x041C1A01, 0x041C2802, 0x041C2B02, 0x041C2D02, 0x041C3101,
+    0x041C5501, 0x041C6B01, 0x041CB001, 0x041CB101, 0x041CBE02, 0x041CC802, 0x041CC902, 0x041CF801, 0x041D0102, 0x041D0302, 0x041D0803, 0x041D1501,
+    0x041D1601, 0x041D4C02, 0x041D5202, 0x041D7101, 0x041D7601, 0x041D7801, 0x041D9102, 0x041DB302, 0x041DB702, 0x041DB806, 0x041DBA02, 0x041DD104,
+    0x041DD204, 0x041DD904, 0x041DE901, 0x041DF201, 0x041DF302, 0x041DF701, 0x041DFF01, 0x041E0701, 0x041E0E01, 0x041E1A02, 0x041E5B01, 0x041E6C01,
+    0x041E7106, 0x041E8D01, 0x041EBC01, 0x041EC401, 0x041EED02, 0x041F3101, 0x041F4001, 0x041F4C01, 0x041F5302, 0x041F5B02, 0x041F6002, 0x041F7002,
+    0x041F7102, 0x041F7801, 0x041F8702, 0x041F9902, 0x041FA501, 0x041FA701, 0x041FAD01, 0x041FAE01, 0x041FAF01, 0x041FB001, 0x041FCE01, 0x041FCF01,
+    0x041FD101, 0x041FD201, 0x041FD401, 0x041FF302, 0x041FF906, 0x041FFC02, 0x041FFF02, 0x04200101, 0x04200206, 0x04200302, 0x04200702, 0x04201E01,
+    0x04203001, 0x04203101, 0x04203201, 0x04204201, 0x04205A01, 0x04205C01, 0x04206402, 0x04206502, 0x04207101, 0x04208904, 0x04209004, 0x04209106,
+    0x04209F01, 0x0420A501, 0x0420B801, 0x0420D102, 0x0420D402, 0x0420DD02, 0x0420DF02, 0x0420F502, 0x0420FD01, 0x04211C01, 0x04213A01, 0x04214202,
+    0x0421A501, 0x0421A601, 0x0421A701, 0x0421A801, 0x0421EA01, 0x0421F001, 0x04221401, 0x04221501, 0x04225301, 0x04225901, 0x04225C01, 0x04225D01,
+    0x04225E01, 0x04225F01, 0x04226001, 0x04226101, 0x04226201, 0x04226301, 0x04226401, 0x04226601, 0x04226701, 0x04229604, 0x0422A702, 0x0422AC02,
+    0x0422C101, 0x0422C502, 0x0422C806, 0x0422C902, 0x0422CA02, 0x0422D401, 0x0422D501, 0x0422D801, 0x0422D901, 0x0422DA01, 0x0422DB01, 0x0422E901,
+    0x0422EA01, 0x04230E01, 0x04230F01, 0x04231001, 0x04231201, 0x04231301, 0x04231401, 0x04231501, 0x04231601, 0x04231701, 0x04231801, 0x04231901,
+    0x04231A01, 0x04231B01, 0x04232E01, 0x04232F01, 0x04233001, 0x04233101, 0x04233201, 0x04233301, 0x04233401, 0x04233601, 0x04233701, 0x04233801,
+    0x04233901, 0x04233A01, 0x04236302, 0x04236402, 0x04236802, 0x04236A02, 0x04237201, 0x04237501, 0x04237901, 0x04238002, 0x04238102, 0x04238A01,
+    0x04239102, 0x0423E904, 0x04246802, 0x0424A701, 0x0424AE02, 0x0424B501, 0x0424CC01, 0x0424DD02, 0x04250906, 0x04251201, 0x04252501, 0x04253E01,
+    0x04254401, 0x04255C01, 0x04257801, 0x04258601, 0x04259A01, 0x04259E04, 0x0425A404, 0x0425AC06, 0x0425AD01, 0x0425BF01, 0x0425C101, 0x0425C301,
+    0x0425C804, 0x0425C904, 0x0425E801, 0x0425E901, 0x0425EC02, 0x04260502, 0x04260602, 0x04260906, 0x04260D01, 0x04261802, 0x04263402, 0x04264B01,
+    0x04266001, 0x04266202, 0x04266306, 0x04268101, 0x04268201, 0x04268C06, 0x04268D06, 0x04269201, 0x04269401, 0x04269A02, 0x0426B101, 0x04270302,
+    0x04270C01, 0x04271001, 0x04271201, 0x04271C06, 0x04272706, 0x04272C06, 0x04279904, 0x0427AE01, 0x0427C401, 0x0427C501, 0x0427C601, 0x0427CB01,
+    0x0427D001, 0x0427D201, 0x0427D401, 0x0427E504, 0x04280D01, 0x04281C02, 0x04281F04, 0x04282301, 0x04283006, 0x04283306, 0x04283402, 0x04283601,
+    0x04283706, 0x04283B02, 0x04283C01, 0x04284701, 0x04284901, 0x04286701, 0x04286B01, 0x04287501, 0x04287701, 0x04287C01, 0x04289701, 0x04289901,
+    0x04289A01, 0x04289B01, 0x04289C01, 0x04289F01, 0x0428A001, 0x0428AA01, 0x0428C601, 0x0428CD01, 0x0428D601, 0x0428EA01, 0x04290B02, 0x04291401,
+    0x04292402, 0x04292602, 0x04292702, 0x04292A02, 0x04295602, 0x04295802, 0x04295C01, 0x04296802, 0x04299602, 0x04299B02, 0x0429F704, 0x042A0401,
+    0x042A3E01, 0x042A7102, 0x042A9601, 0x042ACF01, 0x042AD604, 0x042AE501, 0x042AFF01, 0x042B0601, 0x042B0801, 0x042B0B01, 0x042B0D01, 0x042B1601,
+    0x042B1A01, 0x042B2301, 0x042B2401, 0x042B3501, 0x042B3601, 0x042B3701, 0x042B3801, 0x042B3A01, 0x042B3B01, 0x042B3C01, 0x042B3D01, 0x042B4502,
+    0x042B4A01, 0x042B7A01, 0x042B7D02, 0x042B8501, 0x042B8E01, 0x042B9401, 0x042BAB02, 0x042BAC06, 0x042BF701, 0x042BF801, 0x042BFC01, 0x042BFF01,
+    0x042C0201, 0x042C1101, 0x042C1201, 0x042C1A01, 0x042C1D01, 0x042C1E01, 0x042C4501, 0x042C4801, 0x042C4E01, 0x042C5701, 0x042C9201, 0x042CA701,
+    0x042CA801, 0x042CAB01, 0x042CAC01, 0x042CDB04, 0x042CDD01, 0x042CDF01, 0x042CE401, 0x042CE501, 0x042CE601, 0x042CE701, 0x042CF001, 0x042CF101,
+    0x042CF701, 0x042D0101, 0x042D3601, 0x042D3A01, 0x042D3B01, 0x042D3D01, 0x042D3E01, 0x042D4101, 0x042D4201, 0x042D4901, 0x042D4A01, 0x042D5301,
+    0x042D6804, 0x042D6A04, 0x042D7001, 0x042D7301, 0x042D7501, 0x042D7D01, 0x042D8101, 0x042D8501, 0x042D8901, 0x042D8A01, 0x042D8B01, 0x042D9301,
+    0x042DB404, 0x042DB504, 0x042DB702, 0x042DB802, 0x042DD501, 0x042DD601, 0x042DD701, 0x042DD801, 0x042DD901, 0x042DDA01, 0x042DDB01, 0x042DDC01,
+    0x042DDF02, 0x042DF501, 0x042E0201, 0x042E0501, 0x042E0601, 0x042E0801, 0x042E0901, 0x042E1701, 0x042E1A02, 0x042E1C02, 0x042E1F01, 0x042E2002,
+    0x042E2102, 0x042E2D01, 0x042E2E01, 0x042E3801, 0x042E3902, 0x042E3C02, 0x042E4002, 0x042E4901, 0x042E5902, 0x042E6701, 0x042E6C01, 0x042E6D01,
+    0x042E7301, 0x042E7402, 0x042E7501, 0x042EC101, 0x042EEC02, 0x042F0001, 0x042F1301, 0x042F4801, 0x042F4A01, 0x042F4B01, 0x042F5C01, 0x042F6906,
+    0x042F6A06, 0x042F6B06, 0x042F7401, 0x042F7702, 0x042F7902, 0x042F8501, 0x042FBA01, 0x042FD301, 0x042FD501, 0x042FE401, 0x042FE901, 0x042FF101,
+    0x042FF601, 0x042FF701, 0x04300601, 0x04301301, 0x04302501, 0x04305401, 0x0430BE01, 0x0430D001, 0x0430D101, 0x0430EA01, 0x0430EB01, 0x0430EC01,
+    0x0430ED01, 0x0430EE01, 0x0430F001, 0x0430F101, 0x0430F201, 0x0430F301, 0x0430F501, 0x0430F601, 0x0430F701, 0x0430F901, 0x0430FB02, 0x04310802,
+    0x04310F04, 0x04311A01, 0x04313B02, 0x04313C02, 0x04314901, 0x04315102, 0x04315502, 0x04315706, 0x04316F02, 0x04318A01, 0x04319201, 0x04319502,
+    0x04319606, 0x0431AE01, 0x0431C702, 0x0431CA01, 0x0431CD02, 0x0431FB01, 0x0431FE01, 0x04321002, 0x04321302, 0x04322401, 0x04322701, 0x04322D01,
+    0x04322E01, 0x04323701, 0x04324601, 0x04325801, 0x04326504, 0x04326801, 0x04326B01, 0x04326E01, 0x04327101, 0x04327301, 0x04328C01, 0x04329001,
+    0x04329D01, 0x0432AA01, 0x0432AB01, 0x0432B801, 0x0432CC06, 0x0432F501, 0x0432F701, 0x0432F901, 0x04330901, 0x04332001, 0x04335501, 0x04335601,
+    0x04335901, 0x04335A01, 0x04337C01, 0x04337E01, 0x04337F01, 0x04338001, 0x04338101, 0x04338201, 0x04338602, 0x04338702, 0x04338802, 0x04338A02,
+    0x04338B02, 0x0433B602, 0x0433B802, 0x0433E602, 0x0433E801, 0x04340302, 0x04340402, 0x04340502, 0x04340606, 0x04342D01, 0x04342E02, 0x04342F01,
+    0x04343101, 0x04343F01, 0x04344001, 0x04344101, 0x04344501, 0x04344D01, 0x04344E01, 0x04345001, 0x04346401, 0x0434AA01, 0x0434AB01, 0x0434BB01,
+    0x0434BD01, 0x0434F306, 0x0434F701, 0x04350F01, 0x04353001, 0x04353201, 0x04353501, 0x04353D06, 0x04354306, 0x04356104, 0x04357701, 0x04357C01,
+    0x04357F01, 0x04359001, 0x0435A201, 0x0435BC01, 0x0435CF01, 0x0435D201, 0x04361101, 0x04361701, 0x04362201, 0x04363702, 0x04363F01, 0x04364102,
+    0x04364A01, 0x04364B01, 0x04364C01, 0x04365102, 0x04365306, 0x04365401, 0x04365A02, 0x04365E01, 0x04365F01, 0x04366001, 0x04366601, 0x04366901,
+    0x04366B01, 0x04366D01, 0x04366F02, 0x04367302, 0x04367601, 0x04367702, 0x04368501, 0x04368F02, 0x04369002, 0x04369802, 0x0436B601, 0x0436BF01,
+    0x04370902, 0x04371801, 0x04372D01, 0x04372E01, 0x04372F01, 0x04373101, 0x04373C01, 0x04373D01, 0x04373E01, 0x04373F01, 0x04374001, 0x04374101,
+    0x04374D01, 0x0437C801, 0x0437D101, 0x04385802, 0x04385902, 0x0438DC01, 0x04391C01, 0x04392601, 0x04392901, 0x04393001, 0x04393D03, 0x04396201,
+    0x04396401, 0x04396502, 0x04396B01, 0x04396E02, 0x04397702, 0x04397F01, 0x04398B01, 0x04398D01, 0x0439A401, 0x0439BC01, 0x0439CA01, 0x0439DD01,
+    0x043A1704, 0x043A1804, 0x043A4E01, 0x043A5B01, 0x043A6401, 0x043A6601, 0x043A7101, 0x043A8502, 0x043A8602, 0x043A8A01, 0x043A9601, 0x043A9E01,
+    0x043AAD01, 0x043AAF01, 0x043AE204, 0x043AF202, 0x043B0401, 0x043BB801, 0x043C3101, 0x043C4B01, 0x043C4C01, 0x043C4D01, 0x043C5404, 0x043C8801,
+    0x043C8A01, 0x043C9201, 0x043CD501, 0x043CE701, 0x043CED04, 0x043CEF04, 0x043D1202, 0x043D1402, 0x043D1501, 0x043D1802, 0x043D1902, 0x043D1B02,
+    0x043D1C02, 0x043D1F01, 0x043D2002, 0x043D2102, 0x043D2B01, 0x043D3601, 0x043D4101, 0x043D9102, 0x043D9401, 0x043D9F01, 0x043DA502, 0x043DC102,
+    0x043DD801, 0x043E0402, 0x043E0602, 0x043E3501, 0x043E3A02, 0x043E3B02, 0x043E3C02, 0x043E4202, 0x043E5401, 0x043E5B02, 0x043E6202, 0x043E6701,
+    0x043E8601, 0x043EA501, 0x043EAA01, 0x043F0201, 0x043F0C02, 0x043F3101, 0x043F3602, 0x043F4E02, 0x043F7202, 0x043F8301, 0x043F8701, 0x043FA401,
+    0x043FB602, 0x043FC001, 0x043FC401, 0x043FCD01, 0x043FDA02, 0x043FDC02, 0x043FE002, 0x04402502, 0x04402C01, 0x04403701, 0x04404601, 0x04404B02,
+    0x04404C01, 0x04408C01, 0x0440C601, 0x0440F501, 0x0440F901, 0x04410301, 0x04410501, 0x04414302, 0x04416201, 0x04416901, 0x04417501, 0x04419501,
+    0x0441BC01, 0x0441D201, 0x0441E401, 0x0441EA01, 0x0441F701, 0x0441FB01, 0x04420307, 0x04426A04, 0x04426B04, 0x0442D101, 0x04430602, 0x04430706,
+    0x04430A02, 0x04432802, 0x04434202, 0x04436702, 0x04436802, 0x04437202, 0x04437F02, 0x0443E602, 0x0443E801, 0x0443FB04, 0x04440D04, 0x04440E01,
+    0x04441701, 0x04444402, 0x04444602, 0x04444702, 0x04444802, 0x04445502, 0x04446102, 0x04446402, 0x04446F01, 0x04447B01, 0x04448E01, 0x0444B103,
+    0x04453002, 0x04453F01, 0x04456602, 0x04456D02, 0x04457501, 0x04457D01, 0x04458602, 0x04458702, 0x04458C01, 0x04459C01, 0x04459D01, 0x0445C102,
+    0x0445E001, 0x04460502, 0x04460C01, 0x04463F02, 0x04465702, 0x04466201, 0x04468002, 0x04468502, 0x04469D01, 0x0446A001, 0x0446A201, 0x0446A701,
+    0x0446A901, 0x0446AA01, 0x0446AB01, 0x0446AD01, 0x0446B201, 0x0446B701, 0x0446B801, 0x0446C701, 0x0446CA01, 0x0446D001, 0x0446D101, 0x0446D301,
+    0x0446D901, 0x0446DB02, 0x0446FA01, 0x0446FC02, 0x04471501, 0x04471601, 0x04471B01, 0x04472401, 0x04472A04, 0x04472B01, 0x04472D02, 0x04473D02,
+    0x04474802, 0x04476201, 0x04476504, 0x04476704, 0x04477401, 0x04477704, 0x04477802, 0x04477F02, 0x0447AA01, 0x0447CE01, 0x0447F104, 0x0447F401,
+    0x0447F601, 0x04482201, 0x04482401, 0x04483D04, 0x04484801, 0x04484901, 0x04484A01, 0x04484B01, 0x04484C01, 0x04484F01, 0x04488B02, 0x04488C02,
+    0x04488D02, 0x04488F02, 0x04489006, 0x04489102, 0x04489B02, 0x04489F02, 0x0448A602, 0x0448A702, 0x0448A802, 0x0448A902, 0x0448AB02, 0x0448AC02,
+    0x0448AD02, 0x0448AF01, 0x0448C406, 0x0448C502, 0x0448C802, 0x0448E006, 0x0448E301, 0x04490E01, 0x04491106, 0x0449A201, 0x0449A501, 0x0449A701,
+    0x0449A802, 0x0449A902, 0x0449AA01, 0x0449AC01, 0x0449AD01, 0x0449AE01, 0x0449B201, 0x0449B801, 0x0449B901, 0x0449BA01, 0x0449BB01, 0x0449BC01,
+    0x0449C101, 0x0449C802, 0x0449C902, 0x0449CC02, 0x044A1801, 0x044A2601, 0x044A3B01, 0x044A5A02, 0x044A6501, 0x044A6B02, 0x044A7A06, 0x044A7E02,
+    0x044A9602, 0x044AB102, 0x044ADF02, 0x044AF901, 0x044AFA01, 0x044AFB01, 0x044AFC01, 0x044B0101, 0x044B0201, 0x044B0301, 0x044B1202, 0x044B3802,
+    0x044B3A02, 0x044B3B02, 0x044B3C02, 0x044B3D02, 0x044B3E02, 0x044B5102, 0x044B8101, 0x044B8A02, 0x044B9202, 0x044B9302, 0x044B9901, 0x044BB802,
+    0x044BB902, 0x044BC502, 0x044BC602, 0x044BEA01, 0x044BF701, 0x044BFE01, 0x044C6801, 0x044C8802, 0x044C8A02, 0x044C8B02, 0x044CBA02, 0x044CDE02,
+    0x044CE201, 0x044CF702, 0x044D0001, 0x044D0101, 0x044D0E02, 0x044D0F02, 0x044D2E02, 0x044D3D03, 0x044D3E03, 0x044D4103, 0x044D4203, 0x044D4303,
+    0x044D5802, 0x044D6302, 0x044D6401, 0x044D6506, 0x044D6701, 0x044D8C04, 0x044DAB01, 0x044DD504, 0x044DDA01, 0x044DF804, 0x044E0702, 0x044E0B02,
+    0x044E0E02, 0x044E1002, 0x044E1102, 0x044E1602, 0x044E1C02, 0x044E1F02, 0x044E2302, 0x044E2702, 0x044E2802, 0x044E2D02, 0x044E3002, 0x044E4A02,
+    0x044E5802, 0x044E6001, 0x044E6302, 0x044E6602, 0x044E6902, 0x044E6A02, 0x044E6E02, 0x044E6F02, 0x044E7103, 0x044E7303, 0x044E8101, 0x044E8802,
+    0x044E8902, 0x044E9706, 0x044EAD02, 0x044EAE02, 0x044EB502, 0x044EBB02, 0x044ECB02, 0x044ECC02, 0x044EDB02, 0x044EF202, 0x044F0202, 0x044F0302,
+    0x044F0402, 0x044F0502, 0x044F2801, 0x044F2E01, 0x044F3501, 0x044F3D01, 0x044F4501, 0x044F4602, 0x044F4702, 0x044F4802, 0x044F5002, 0x044F5106,
+    0x044F7002, 0x044F7404, 0x044F7D04, 0x044F8102, 0x044F8202, 0x044F8E02, 0x044FA002, 0x044FA202, 0x044FB801, 0x044FC601, 0x044FE406, 0x04500202,
+    0x04507F01, 0x04508301, 0x04508B04, 0x04509202, 0x04509501, 0x04509903, 0x04509B01, 0x0450DA01, 0x04510601, 0x04511506, 0x04511B02, 0x04511C02,
+    0x04515502, 0x04517E02, 0x0451A403, 0x0451AD01, 0x0451B002, 0x0451BD01, 0x0451D101, 0x0451E202, 0x0451E402, 0x0451EB01, 0x0451EC01, 0x0451EF01,
+    0x0451F001, 0x0451F904, 0x04521001, 0x04521201, 0x04521301, 0x04521C01, 0x04524301, 0x04524501, 0x04524901, 0x04525301, 0x04525401, 0x04526204,
+    0x04528D01, 0x0452D904, 0x0452DB01, 0x0452DC01, 0x0452F102, 0x04531301, 0x04531402, 0x04531502, 0x04531B02, 0x04532202, 0x04532502, 0x04532902,
+    0x04535401, 0x04536101, 0x04536202, 0x04536301, 0x04536401, 0x04536501, 0x04536601, 0x04536701, 0x04536A02, 0x04536B02, 0x04536D02, 0x04537A01,
+    0x04537D01, 0x04537E01, 0x04538002, 0x04538102, 0x04538202, 0x04538502, 0x04538601, 0x04538702, 0x04538802, 0x04538901, 0x04538A02, 0x04539B02,
+    0x0453A001, 0x0453A201, 0x0453A402, 0x0453A501, 0x0453A602, 0x0453A702, 0x0453A802, 0x0453A902, 0x0453B001, 0x0453B101, 0x0453BC02, 0x0453BE01,
+    0x0453BF01, 0x0453C002, 0x0453C102, 0x0453C402, 0x0453E202, 0x0453EE03, 0x0453F202, 0x0453FD02, 0x0453FE02, 0x0453FF02, 0x04540002, 0x04540102,
+    0x04540402, 0x04540702, 0x04540A02, 0x04540B02, 0x04540C02, 0x04540D02, 0x04541302, 0x04541402, 0x04541803, 0x04541C02, 0x04542102, 0x04542F02,
+    0x04543302, 0x04543402, 0x04543601, 0x04543701, 0x04543C02, 0x04544702, 0x04544802, 0x04546102, 0x04546802, 0x04547203, 0x04547802, 0x04547A02,
+    0x04547B02, 0x04547C02, 0x04547D02, 0x04547E02, 0x04547F02, 0x04548002, 0x04548102, 0x04548202, 0x0454B504, 0x0454BC04, 0x0454C004, 0x0454E001,
+    0x0454E101, 0x0454E201, 0x0454E301, 0x04553602, 0x04553702, 0x04553801, 0x04553A02, 0x04553D02, 0x0455F201, 0x04563601, 0x04563902, 0x04563A02,
+    0x04563F02, 0x04564402, 0x04565D02, 0x04565E02, 0x04565F02, 0x04566102, 0x04566202, 0x04566704, 0x04566A02, 0x04566B02, 0x04567702, 0x04567C02,
+    0x04568F01, 0x04569001, 0x04569203, 0x04569B02, 0x0456B503, 0x0456B603, 0x0456D101, 0x0456D702, 0x0456DA02, 0x0456DB02, 0x0456DD02, 0x0456E002,
+    0x0456F102, 0x0456F202, 0x0456F902, 0x0456FB02, 0x0456FC02, 0x0456FE02, 0x04570801, 0x04570E02, 0x04570F02, 0x04571702, 0x04572701, 0x04573801,
+    0x04574502, 0x04574D01, 0x04574E01, 0x04575A02, 0x04575C02, 0x04575F02, 0x04576002, 0x04576701, 0x04576F01, 0x04577301, 0x04577501, 0x04577701,
+    0x04577801, 0x04577901, 0x04577A01, 0x04577B01, 0x04577D01, 0x04578201, 0x04578A04, 0x04578C01, 0x04578E01, 0x04579701, 0x04579D01, 0x04579E01,
+    0x04579F01, 0x0457A101, 0x0457B901, 0x0457C202, 0x0457C301, 0x0457CC01, 0x0457CD02, 0x0457CE02, 0x0457D701, 0x0457D801, 0x0457D901, 0x0457E501,
+    0x0457F801, 0x04580401, 0x04581F02, 0x04582102, 0x04583D01, 0x04585A04, 0x04586D04, 0x04587A01, 0x04587B01, 0x04587E01, 0x04588101, 0x04588201,
+    0x04588901, 0x04588E01, 0x04589101, 0x0458A802, 0x0458AC02, 0x0458BA02, 0x0458BC02, 0x0458C702, 0x0458CA02, 0x0458D101, 0x0458D301, 0x0458DD01,
+    0x0458DE01, 0x0458DF01, 0x04591701, 0x04591901, 0x04592802, 0x04594A01, 0x04595201, 0x04597D02, 0x04597E02, 0x04597F01, 0x04599301, 0x0459AD02,
+    0x0459C002, 0x0459C602, 0x0459C702, 0x0459CF02, 0x0459D402, 0x0459D502, 0x0459D602, 0x0459D702, 0x0459D802, 0x0459D902, 0x0459DA02, 0x0459DC02,
+    0x0459DD02, 0x0459E302, 0x0459ED02, 0x0459F201, 0x0459F704, 0x045A0B01, 0x045A1601, 0x045A1E01, 0x045A1F01, 0x045A2001, 0x045A2701, 0x045A2A01,
+    0x045A2C02, 0x045A2E02, 0x045A3002, 0x045A3702, 0x045A4A03, 0x045A5202, 0x045A5302, 0x045A5402, 0x045A5503, 0x045A5602, 0x045A6402, 0x045A6603,
+    0x045A6803, 0x045A6903, 0x045A6A02, 0x045A6C01, 0x045A7601, 0x045A9704, 0x045AA501, 0x045ABB01, 0x045AC201, 0x045AC506, 0x045AD501, 0x045ADE01,
+    0x045ADF01, 0x045AF201, 0x045B0301, 0x045B0C06, 0x045B1A06, 0x045B2501, 0x045B2701, 0x045B3D01, 0x045B4401, 0x045B7C02, 0x045B7E01, 0x045B8404,
+    0x045B8D02, 0x045B9102, 0x045B9A03, 0x045B9B01, 0x045BBC01, 0x045BC201, 0x045BCB02, 0x045BCE02, 0x045BD501, 0x045BDB01, 0x045BDC01, 0x045BDE02,
+    0x045BEC01, 0x045BEF04, 0x045BF004, 0x045BF104, 0x045C6601, 0x045CC801, 0x045CDD01, 0x045D2C01, 0x045D2E01, 0x045D3D01, 0x045D3E01, 0x045D4B02,
+    0x045D8601, 0x045D8B01, 0x045D8C01, 0x045DB801, 0x045E2F02, 0x045E4601, 0x045E6B01, 0x045EA501, 0x045EC401, 0x045EC901, 0x045EE201, 0x045EE301,
+    0x045EE701, 0x045F0201, 0x045F1001, 0x045F1E01, 0x045F1F01, 0x045F2501, 0x045F2B01, 0x045F3101, 0x045F3401, 0x045F5C02, 0x045FAE01, 0x045FAF01,
+    0x045FB201, 0x045FB301, 0x045FB601, 0x045FD601, 0x045FD701, 0x045FD801, 0x045FEA01, 0x045FF702, 0x04601B01, 0x04602101, 0x04602201, 0x04603201,
+    0x04606501, 0x04607601, 0x04608602, 0x0460F702, 0x04610002, 0x04612001, 0x04612201, 0x04612401, 0x04612501, 0x04612601, 0x04615401, 0x04616201,
+    0x04616902, 0x04616A03, 0x04616B03, 0x04616C03, 0x0461AB01, 0x0461FA01, 0x04620002, 0x04621602, 0x04623504, 0x04623C01, 0x04623E01, 0x04623F01,
+    0x04624001, 0x04624C01, 0x04624E01, 0x04625001, 0x04625101, 0x04625201, 0x04625802, 0x04625902, 0x04625D01, 0x04626302, 0x04626A02, 0x04627902,
+    0x04628501, 0x04628901, 0x0462AC02, 0x0462C001, 0x0462CE01, 0x0462DD01, 0x0462E501, 0x0462F601, 0x04630F02, 0x04631002, 0x04632701, 0x04633201,
+    0x04635901, 0x04636001, 0x04636F02, 0x04637606, 0x04637802, 0x04637A02, 0x04639D01, 0x0463A502, 0x0463D601, 0x04640301, 0x04640D01, 0x04641B03,
+    0x04642901, 0x04643601, 0x04648001, 0x04648201, 0x04648501, 0x04648D01, 0x04649301, 0x0464CB02, 0x0464E202, 0x0464E402, 0x0464E602, 0x0464F901,
+    0x04650401, 0x04650B01, 0x04652501, 0x04654D01, 0x04656001, 0x04657D02, 0x04658501, 0x04658E01, 0x04659001, 0x04659802, 0x0465A601, 0x0465A901,
+    0x0465BC01, 0x0465BD01, 0x0465C101, 0x0465C202, 0x04662901, 0x04663301, 0x04663701, 0x04664501, 0x04668801, 0x04668A01, 0x04668B02, 0x04669302,
+    0x04669E01, 0x0466A001, 0x0466A301, 0x0466DD02, 0x0466FD02, 0x04671601, 0x04672002, 0x04672202, 0x04672402, 0x04673901, 0x04673C01, 0x04674001,
+    0x04675702, 0x04675E02, 0x04676301, 0x04676502, 0x04676D02, 0x04677101, 0x04677201, 0x04677301, 0x04677801, 0x04677C02, 0x04678B01, 0x04679901,
+    0x04679A01, 0x04679B02, 0x0467C901, 0x0467DD02, 0x0467F101, 0x04681801, 0x04681F01, 0x04682601, 0x04682801, 0x04682901, 0x04682A01, 0x04685103,
+    0x04686501, 0x04686A01, 0x0468AB01, 0x0468AC01, 0x0468B401, 0x0468BC02, 0x0468C202, 0x0468D102, 0x0468D601, 0x0468E502, 0x0468FE02, 0x04696C01,
+    0x04697201, 0x04697401, 0x0469B401, 0x0469BC02, 0x0469BF04, 0x0469C501, 0x0469CA01, 0x0469D502, 0x0469D903, 0x046A0E01, 0x046A1C02, 0x046A1F02,
+    0x046A2002, 0x046A2E02, 0x046A3002, 0x046A4702, 0x046A4A02, 0x046A4D04, 0x046A4E02, 0x046A6B01, 0x046A6E01, 0x046A7101, 0x046A7501, 0x046A7D01,
+    0x046A7E01, 0x046A7F01, 0x046A8001, 0x046A8401, 0x046A9F02, 0x046AB701, 0x046AD802, 0x046B1F02, 0x046B2902, 0x046B7702, 0x046B7902, 0x046B8203,
+    0x046C0A01, 0x046C3D01, 0x046C4101, 0x046C4501, 0x046C4A01, 0x046C4E04, 0x046C5202, 0x046C5E01, 0x046C7101, 0x046C7E01, 0x046C8202, 0x046C8601,
+    0x046C8801, 0x046C9502, 0x046CA702, 0x046CAC01, 0x046CCD02, 0x046CD402, 0x046CDC02, 0x046CDD02, 0x046CED02, 0x046CF302, 0x046D0101, 0x046D1501,
+    0x046D1601, 0x046D2501, 0x046D2B02, 0x046D3302, 0x046D3902, 0x046D3A02, 0x046D3B04, 0x046D3C02, 0x046D3D03, 0x046D3E06, 0x046D3F02, 0x046D4002,
+    0x046D4202, 0x046D5A02, 0x046D5B02, 0x046D5C02, 0x046D5D02, 0x046D5E02, 0x046D5F02, 0x046D6002, 0x046D6102, 0x046D6202, 0x046D6402, 0x046D6501,
+    0x046D8B02, 0x046DA502, 0x046DCA02, 0x046DCE02, 0x046DDF02, 0x046DE002, 0x046DE402, 0x046DE502, 0x046DE602, 0x046DE902, 0x046DEA02, 0x046DEE02,
+    0x046DEF02, 0x046DF002, 0x046DF302, 0x046DF402, 0x046DF602, 0x046DF802, 0x046DF902, 0x046E0401, 0x046E1202, 0x046E1302, 0x046E1C02, 0x046E3601,
+    0x046E3F01, 0x046E5B02, 0x046E6302, 0x046E6502, 0x046E6602, 0x046E6B02, 0x046E6C02, 0x046E6F02, 0x046E7102, 0x046E7602, 0x046E7702, 0x046E7802,
+    0x046E7902, 0x046E7B02, 0x046E7C02, 0x046E7E02, 0x046E7F02, 0x046E8002, 0x046E8302, 0x046E8602, 0x046E8702, 0x046E8902, 0x046E9001, 0x046E9D03,
+    0x046EBA02, 0x046EBB02, 0x046EBE02, 0x046EBF02, 0x046EC002, 0x046EC102, 0x046EC202, 0x046EC402, 0x046EC502, 0x046ECF01, 0x046ED002, 0x046ED101,
+    0x046EDD02, 0x046EE102, 0x046EE602, 0x046EE902, 0x046EEA02, 0x046EEB02, 0x046EEC02, 0x046EED02, 0x046EEE02, 0x046EF602, 0x046EFB02, 0x046EFD02,
+    0x046EFE02, 0x046F0102, 0x046F0402, 0x046F0602, 0x046F0702, 0x046F0F01, 0x046F1602, 0x046F1702, 0x046F1C02, 0x046F2002, 0x046F3201, 0x046F3402,
+    0x046F4502, 0x046F4602, 0x046F4702, 0x046F4E02, 0x046F5002, 0x046F5102, 0x046F5202, 0x046F5402, 0x046F5506, 0x046F5602, 0x046F5801, 0x046F9001,
+    0x046FDB04, 0x046FE002, 0x046FE104, 0x046FE402, 0x046FE802, 0x046FE902, 0x04700102, 0x04700303, 0x04700402, 0x04703D02, 0x04704101, 0x04704901,
+    0x04704D02, 0x04704E02, 0x04705202, 0x04708B04, 0x04710306, 0x04712001, 0x04712302, 0x04712402, 0x04714A01, 0x04715E01, 0x04717B02, 0x04719F01,
+    0x0471BC01, 0x0471F402, 0x0471F602, 0x04720102, 0x04720402, 0x04720602, 0x04720702, 0x04720802, 0x04720F06, 0x04721106, 0x04721402, 0x04721502,
+    0x04721702, 0x04721902, 0x04721B06, 0x04721C06, 0x04722304, 0x04722402, 0x04722602, 0x04722702, 0x04722902, 0x04723F02, 0x04726A01, 0x04728802,
+    0x04728902, 0x04740302, 0x04741502, 0x04744A01, 0x04744B01, 0x04746301, 0x04747501, 0x04748F01, 0x04749201, 0x0474AA02, 0x0474AB02, 0x0474BD02,
+    0x0474C202, 0x0474C803, 0x0474D602, 0x0474D702, 0x0474D802, 0x04751D01, 0x04751F01, 0x04752501, 0x04752B02, 0x04752C02, 0x04752D02, 0x04752E02,
+    0x04753602, 0x04753802, 0x04753B02, 0x04753C02, 0x04753E02, 0x04754402, 0x04754902, 0x04757601, 0x04757E02, 0x04758002, 0x04758602, 0x0475A401,
+    0x0475AA02, 0x0475AF01, 0x0475B001, 0x0475B101, 0x0475B302, 0x0475BB01, 0x0475BC01, 0x0475BD01, 0x0475C401, 0x0475C602, 0x0475C902, 0x0475CC02,
+    0x0475D202, 0x0475D301, 0x0475D601, 0x04763602, 0x04764F02, 0x04765B01, 0x04766106, 0x04766202, 0x04768A02, 0x04768B02, 0x04768D02, 0x0476D902,
+    0x0476DE01, 0x0476DF02, 0x0476E002, 0x0476E101, 0x0476EB02, 0x0476F002, 0x0476F402, 0x0476F602, 0x0476F702, 0x0476F902, 0x04770002, 0x04770102,
+    0x04770202, 0x04770302, 0x04771002, 0x04771102, 0x04771202, 0x04771302, 0x04771403, 0x04771502, 0x04772301, 0x04772902, 0x04773302, 0x04773702,
+    0x04773802, 0x04773C02, 0x04773D02, 0x04774002, 0x04774102, 0x04775C02, 0x04775D02, 0x04775E02, 0x04775F02, 0x04776002, 0x04776702, 0x04776902,
+    0x04776B01, 0x04777E02, 0x04778602, 0x0477CD06, 0x0477F102, 0x0477FC01, 0x04781001, 0x04784B01, 0x04784C01, 0x04786301, 0x04786B01, 0x04789101,
+    0x04789502, 0x04789902, 0x04789B02, 0x04789C02, 0x0478A702, 0x0478AA02, 0x0478B501, 0x0478BB01, 0x0478CF01, 0x04796801, 0x04798401, 0x047A1C02,
+    0x047A6D01, 0x047A7001, 0x047A7902, 0x047A8501, 0x047AAB02, 0x047AB001, 0x047ACB01, 0x047AD901, 0x047B1B01, 0x047B2101, 0x047B4501, 0x047B5F01,
+    0x047BA301, 0x047BD002, 0x047BEA02, 0x047BFF02, 0x047C0202, 0x047C0302, 0x047C0602, 0x047C0702, 0x047C6104, 0x047C6A02, 0x047C8402, 0x047C8901,
+    0x047C8A01, 0x047CB802, 0x047CDD04, 0x047CF502, 0x047CFE02, 0x047D0B02, 0x047D1102, 0x047D1302, 0x047D3601, 0x047D4E04, 0x047D5801, 0x047D7901,
+    0x047D9404, 0x047DCB01, 0x047DDC01, 0x047DEE01, 0x047E1704, 0x047E2504, 0x047E2801, 0x047E2C01, 0x047E3401, 0x047E3901, 0x047E6401, 0x047E6801,
+    0x047E8701, 0x047E8E01, 0x047E9501, 0x047E9604, 0x047E9701, 0x047EAC06, 0x047ECF01, 0x047EDE01, 0x047EFA02, 0x047EFD02, 0x047EFF02, 0x047F0C02,
+    0x047F1D02, 0x047F1F02, 0x047F2002, 0x047F2102, 0x047FC801, 0x047FC901, 0x047FCA01, 0x047FCB01, 0x047FDC04, 0x047FDD01, 0x047FEB01, 0x047FFA02,
+    0x047FFB02, 0x047FFC02, 0x047FFD02, 0x047FFE02, 0x04800002, 0x04800702, 0x04800802, 0x04800A02, 0x04800E03, 0x04802102, 0x04802203, 0x04802A01,
+    0x04802D01, 0x04803101, 0x04803301, 0x04803402, 0x04803902, 0x04803A02, 0x04803C02, 0x04805301, 0x04808501, 0x04808602, 0x04808702, 0x04808802,
+    0x04808A01, 0x04808B01, 0x0480A602, 0x0480B201, 0x0480BA02, 0x0480BF01, 0x0480C001, 0x0480C101, 0x0480C201, 0x0480CA02, 0x0480CD02, 0x0480CF02,
+    0x0480D801, 0x0480D902, 0x0480DC02, 0x0480E102, 0x0480E801, 0x0480F701, 0x0480F802, 0x0480FC02, 0x0480FD02, 0x0480FE02, 0x04810801, 0x04810B01,
+    0x04811202, 0x04811401, 0x04812602, 0x04812802, 0x04812902, 0x04812A02, 0x04813F03, 0x04814602, 0x04814702, 0x04814802, 0x04814901, 0x04814D01,
+    0x04814E02, 0x04815002, 0x04815302, 0x04815402, 0x04815502, 0x04815A02, 0x04815C01, 0x04815D02, 0x04815E02, 0x04815F02, 0x04816002, 0x04816701,
+    0x04816802, 0x04816902, 0x04816A01, 0x04817202, 0x04817302, 0x04817B02, 0x04817D02, 0x04818202, 0x04818701, 0x04818802, 0x04818902, 0x04818A02,
+    0x04818B02, 0x04818C02, 0x04818D02, 0x04818E02, 0x04818F02, 0x04819502, 0x04819802, 0x04819C02, 0x04819D02, 0x04819F01, 0x0481A502, 0x0481A902,
+    0x0481AA02, 0x0481AB02, 0x0481AF02, 0x0481B502, 0x0481B702, 0x0481B802, 0x0481B902, 0x0481BA02, 0x0481BD02, 0x0481BE02, 0x0481C302, 0x0481C502,
+    0x0481C602, 0x0481C702, 0x0481C803, 0x0481C902, 0x0481CC02, 0x0481CD02, 0x0481CE02, 0x0481CF02, 0x0481D002, 0x0481D103, 0x0481D202, 0x0481D302,
+    0x0481D402, 0x0481D502, 0x0481D803, 0x0481F102, 0x0481F201, 0x0481FA02, 0x0481FC02, 0x0481FE02, 0x0481FF01, 0x04820002, 0x04820102, 0x04820E02,
+    0x04821A01, 0x04822101, 0x04822203, 0x04822302, 0x04823701, 0x04827101, 0x04827502, 0x04827702, 0x04827902, 0x04827A02, 0x04827B02, 0x04827C02,
+    0x04829602, 0x04829802, 0x04829902, 0x04829C02, 0x04829E02, 0x0482A002, 0x0482B402, 0x0482B901, 0x0482C202, 0x0482C702, 0x0482C802, 0x0482E602,
+    0x0482E702, 0x0482F402, 0x0482F502, 0x0482F602, 0x0482FC06, 0x0482FF02, 0x04830002, 0x04831202, 0x04831801, 0x04831901, 0x04831A02, 0x04831E02,
+    0x04832002, 0x04832901, 0x04832A02, 0x04832D02, 0x04833502, 0x04833802, 0x04833A04, 0x04834202, 0x04834302, 0x04834402, 0x04834502, 0x04834C02,
+    0x04835202, 0x04835402, 0x04835702, 0x04836702, 0x04836902, 0x04836B02, 0x04836C02, 0x04837701, 0x04837F01, 0x04838001, 0x04838601, 0x04839402,
+    0x04839A02, 0x04839B02, 0x04839C02, 0x04839D02, 0x04839E02, 0x04839F02, 0x0483A002, 0x0483A102, 0x0483A302, 0x0483A402, 0x0483A502, 0x0483A602,
+    0x0483AA01, 0x0483AF02, 0x0483B002, 0x0483BA01, 0x0483BF02, 0x0483C002, 0x0483C102, 0x0483C202, 0x0483C302, 0x0483C602, 0x0483C702, 0x0483CA02,
+    0x0483CB02, 0x0483CC02, 0x0483D402, 0x0483D502, 0x0483D602, 0x0483D804, 0x0483DA02, 0x0483DB02, 0x0483DC02, 0x0483DD02, 0x0483E202, 0x0483EA01,
+    0x0483F702, 0x04840901, 0x04840A02, 0x04840B02, 0x04840D01, 0x04840F02, 0x04841002, 0x04841102, 0x04841A01, 0x04841E02, 0x04842701, 0x04843301,
+    0x04843F01, 0x04844F01, 0x04845201, 0x04845501, 0x04846104, 0x04846304, 0x04846804, 0x04847D03, 0x0484AE01, 0x0484AF01, 0x0484B201, 0x0484B701,
+    0x04850B02, 0x04850E01, 0x04851002, 0x04855701, 0x04858002, 0x04858102, 0x04858202, 0x04858402, 0x04858502, 0x04858602, 0x04858702, 0x04858802,
+    0x04858A03, 0x04858B01, 0x0485C601, 0x0485C801, 0x0485CB01, 0x0485D201, 0x0485E501, 0x04860002, 0x04862D01, 0x04863C01, 0x04865B01, 0x04866301,
+    0x04866902, 0x04866D02, 0x04866E02, 0x04867001, 0x04867A01, 0x04868202, 0x04868402, 0x04868502, 0x04868802, 0x04868902, 0x04868F02, 0x04869002,
+    0x0486B601, 0x0486BD02, 0x0486FE01, 0x04870201, 0x04870301, 0x04873001, 0x04875A02, 0x04878F01, 0x0487A601, 0x0487B801, 0x0487C001, 0x0487D803,
+    0x0487EA01, 0x0487EB01, 0x0487EC01, 0x0487ED01, 0x0487EE01, 0x0487EF01, 0x0487F001, 0x04882A01, 0x04883E01, 0x04884E01, 0x04885D01, 0x04886C02,
+    0x04889402, 0x0488A002, 0x0488A202, 0x0488A602, 0x0488BB02, 0x0488BC01, 0x0488CA02, 0x0488D002, 0x0488D902, 0x0488DA02, 0x0488E501, 0x0488EF01,
+    0x0488F001, 0x0488FA01, 0x04890D01, 0x04891D01, 0x04892401, 0x04892601, 0x04895F01, 0x0489A202, 0x0489C302, 0x0489EF01, 0x048A4101, 0x048A4602,
+    0x048A4802, 0x048A4A02, 0x048A4B02, 0x048A5E01, 0x048A6402, 0x048A6904, 0x048A6A01, 0x048A6E01, 0x048A7201, 0x048A7901, 0x048A7A01, 0x048A7E01,
+    0x048AC401, 0x048AC801, 0x048AC901, 0x048AFA04, 0x048B0803, 0x048B0903, 0x048B0A03, 0x048B0B03, 0x048B1103, 0x048B7A02, 0x048B8A02, 0x048B8C02,
+    0x048B8D02, 0x048BB901, 0x048BCF02, 0x048C0401, 0x048C3001, 0x048C3401, 0x048C3601, 0x048C3701, 0x048C3801, 0x048C4901, 0x048C6002, 0x048C6102,
+    0x048C6202, 0x048C6302, 0x048C6A01, 0x048C9202, 0x048CB401, 0x048CB802, 0x048CB902, 0x048CBE02, 0x048CC602, 0x048CC702, 0x048CC802, 0x048CC902,
+    0x048CCA02, 0x048CD001, 0x048CD102, 0x048CD301, 0x048CEF01, 0x048D1C02, 0x048D2102, 0x048D2202, 0x048D2302, 0x048D2502, 0x048D3501, 0x048D3901,
+    0x048D3E02, 0x048D3F01, 0x048D4002, 0x048D4A01, 0x048D4E02, 0x048D5102, 0x048D5402, 0x048D5502, 0x048D5702, 0x048D5802, 0x048D5902, 0x048D5A02,
+    0x048D5B02, 0x048D5C02, 0x048D5D02, 0x048D5E02, 0x048D6102, 0x048D6302, 0x048D6702, 0x048D6F02, 0x048D7002, 0x048D7102, 0x048D7502, 0x048D8502,
+    0x048D8802, 0x048D8902, 0x048DA402, 0x048DA502, 0x048DA702, 0x048DA902, 0x048DCC02, 0x048DCD02, 0x048DD002, 0x048DD102, 0x048DD202, 0x048DD402,
+    0x048DD502, 0x048DD702, 0x048DD802, 0x048DD902, 0x048E0001, 0x048E1201, 0x048E2E01, 0x048E3C02, 0x048E4901, 0x048E5602, 0x048E6301, 0x048E6A01,
+    0x048E8302, 0x048E8402, 0x048ECA02, 0x048ECB02, 0x048F0A02, 0x048F0D02, 0x048F1501, 0x048F1701, 0x048F1A01, 0x048F1C01, 0x048F4601, 0x048F4801,
+    0x048F4901, 0x048FBC01, 0x04902606, 0x04902A04, 0x04903202, 0x04904304, 0x04905501, 0x04907301, 0x04907401, 0x04909001, 0x0490BD01, 0x0490CA01,
+    0x0490F802, 0x0490FA02, 0x04910402, 0x04910A02, 0x04910B02, 0x04910D02, 0x04914502, 0x04914602, 0x04914702, 0x04914802, 0x04914902, 0x04914A02,
+    0x04914F02, 0x04915102, 0x04915202, 0x04915302, 0x04915402, 0x04915502, 0x04915602, 0x04915902, 0x04915A02, 0x04915B02, 0x04915D02, 0x04915E02,
+    0x04915F02, 0x04916002, 0x04916102, 0x04916201, 0x04916402, 0x04916702, 0x04916802, 0x04916902, 0x04916A02, 0x04916B02, 0x04916C02, 0x04916D02,
+    0x04916E02, 0x04916F02, 0x04917002, 0x04917102, 0x04917202, 0x0491C401, 0x0491E901, 0x0491FE02, 0x0491FF02, 0x04920002, 0x04920102, 0x04920202,
+    0x04920302, 0x04920902, 0x04920A02, 0x04921602, 0x04921802, 0x04922702, 0x04922802, 0x04922C02, 0x04923401, 0x04923B01, 0x04923E01, 0x04924701,
+    0x04925F01, 0x04926001, 0x04926501, 0x04928302, 0x04928F01, 0x04929B01, 0x0492B601, 0x0492B701, 0x0492BA01, 0x0492BB01, 0x0492BD01, 0x0492BF01,
+    0x0492C701, 0x0492C801, 0x0492C901, 0x0492CA01, 0x04931101, 0x04932501, 0x04936102, 0x04936E01, 0x04937702, 0x0493BE01, 0x0493C101, 0x0493C601,
+    0x0493CC01, 0x0493CD02, 0x0493D002, 0x0493D102, 0x0493D402, 0x0493D502, 0x0493D702, 0x0493DB02, 0x0493E203, 0x0493E303, 0x0493E402, 0x0493E502,
+    0x0493E902, 0x0493EA02, 0x0493EC02, 0x0493ED02, 0x0493EF02, 0x0493F002, 0x04940A01, 0x04940D01, 0x04942702, 0x04943B02, 0x04945802, 0x04946501,
+    0x04948301, 0x04948501, 0x0494D401, 0x04950402, 0x04954C01, 0x04956701, 0x04958E01, 0x0495C201, 0x0495C301, 0x0495D401, 0x0495EF01, 0x0495F001,
+    0x0495F401, 0x04960101, 0x04960501, 0x04961602, 0x04961701, 0x04961801, 0x04961A01, 0x04962201, 0x04962401, 0x04962501, 0x04962601, 0x04962801,
+    0x04962901, 0x04962A01, 0x04962F01, 0x04963201, 0x04963501, 0x04964001, 0x04964401, 0x04964502, 0x04964702, 0x04966B02, 0x04966C01, 0x04966D01,
+    0x04966E01, 0x04967104, 0x04968301, 0x0496AB01, 0x0496AF01, 0x0496BB01, 0x0496BC01, 0x0496C904, 0x0496CB06, 0x04972B02, 0x04973001, 0x04973201,
+    0x04973302, 0x04974D01, 0x04975C02, 0x04977301, 0x04977702, 0x04978801, 0x0497A101, 0x0497A201, 0x0497C001, 0x04980502, 0x04981302, 0x04981E01,
+    0x04982201, 0x04982701, 0x04985802, 0x04986B01, 0x04986C01, 0x04987101, 0x04987702, 0x04987B01, 0x04987C01, 0x04988002, 0x0498F301, 0x0498FC01,
+    0x04992301, 0x04997201, 0x04997301, 0x04997501, 0x04997901, 0x0499B401, 0x0499CC01, 0x0499D801, 0x0499F901, 0x049A9A04, 0x049AEA01, 0x049AEB01,
+    0x049B2402, 0x049B5701, 0x049B9001, 0x049BCD01, 0x049BDF01, 0x049C4101, 0x049C7601, 0x049C7801, 0x049C7A01, 0x049C8502, 0x049C8701, 0x049C8B01,
+    0x049CF902, 0x049D1002, 0x049D5202, 0x049D9C01, 0x049DA402, 0x049DA701, 0x049DA801, 0x049DDB02, 0x049DF903, 0x049DFC01, 0x049DFD01, 0x049E0901,
+    0x049E0B01, 0x049E0D01, 0x049E0E01, 0x049E4003, 0x049E4103, 0x049E5801, 0x049E5E01, 0x049E8B02, 0x049E8C02, 0x049EA901, 0x049EAA01, 0x049EB202,
+    0x049EBA02, 0x049EBC02, 0x049EC301, 0x049ED301, 0x049EFF02, 0x049F1002, 0x049F1201, 0x049F1301, 0x049F1E01, 0x049F3E02, 0x049F4402, 0x049F4502,
+    0x049F4701, 0x049F5402, 0x049F6601, 0x049F6802, 0x049F6902, 0x049F6D02, 0x049F7102, 0x049F7202, 0x049F8301, 0x049F8602, 0x049F8702, 0x049F8802,
+    0x049F8902, 0x049FB302, 0x049FED01, 0x04A04F02, 0x04A05401, 0x04A06001, 0x04A06A01, 0x04A07801, 0x04A09E01, 0x04A0A601, 0x04A0A901, 0x04A0C101,
+    0x04A0CA01, 0x04A0EE02, 0x04A0F002, 0x04A0F102, 0x04A0F302, 0x04A0F502, 0x04A0F702, 0x04A10B02, 0x04A11402, 0x04A12602, 0x04A12702, 0x04A13402,
+    0x04A13E01, 0x04A16001, 0x04A16C02, 0x04A16D02, 0x04A17801, 0x04A18A01, 0x04A1A901, 0x04A1B701, 0x04A1B801, 0x04A1CF01, 0x04A1E101, 0x04A20301,
+    0x04A20901, 0x04A24003, 0x04A27F01, 0x04A28902, 0x04A28F01, 0x04A2B901, 0x04A2C001, 0x04A2CB01, 0x04A2D401, 0x04A31402, 0x04A31A01, 0x04A34601,
+    0x04A34901, 0x04A35601, 0x04A35C01, 0x04A36001, 0x04A38601, 0x04A39C02, 0x04A39D02, 0x04A39F02, 0x04A3A002, 0x04A3A202, 0x04A3A302, 0x04A3A702,
+    0x04A3A902, 0x04A3AB01, 0x04A3AC02, 0x04A3AD02, 0x04A3AE02, 0x04A3B201, 0x04A3B302, 0x04A3B401, 0x04A3B501, 0x04A3B601, 0x04A3B802, 0x04A3B901,
+    0x04A3BA01, 0x04A3BB01, 0x04A3BC01, 0x04A3BD01, 0x04A3C003, 0x04A3C501, 0x04A3C601, 0x04A3C701, 0x04A3C801, 0x04A3C901, 0x04A3CE01, 0x04A3D001,
+    0x04A3D102, 0x04A3D201, 0x04A3D401, 0x04A3D501, 0x04A3DA01, 0x04A3DB01, 0x04A3DC01, 0x04A3FF01, 0x04A40001, 0x04A40801, 0x04A40E01, 0x04A43903,
+    0x04A44A02, 0x04A49901, 0x04A4EB01, 0x04A4ED01, 0x04A4EF01, 0x04A4F001, 0x04A51A01, 0x04A54C01, 0x04A57502, 0x04A57F01, 0x04A59701, 0x04A59904,
+    0x04A59B04, 0x04A5A801, 0x04A5F802, 0x04A5F902, 0x04A64801, 0x04A65002, 0x04A67001, 0x04A67101, 0x04A67201, 0x04A67301, 0x04A67401, 0x04A67D01,
+    0x04A68702, 0x04A69801, 0x04A6D301, 0x04A6F201, 0x04A70401, 0x04A70E01, 0x04A71801, 0x04A71C01, 0x04A71D01, 0x04A72C01, 0x04A72E01, 0x04A73F01,
+    0x04A74601, 0x04A74A01, 0x04A75501, 0x04A75601, 0x04A75701, 0x04A75801, 0x04A75901, 0x04A75A01, 0x04A75B01, 0x04A75C01, 0x04A75D01, 0x04A76501,
+    0x04A79304, 0x04A79504, 0x04A79B04, 0x04A79D04, 0x04A7BB01, 0x04A7BD01, 0x04A7EB01, 0x04A7EC01, 0x04A7ED01, 0x04A7EF01, 0x04A7F101, 0x04A7F301,
+    0x04A82C01, 0x04A86B01, 0x04A88501, 0x04A89002, 0x04A89E02, 0x04A8A501, 0x04A8B602, 0x04A8C201, 0x04A8CF02, 0x04A8D002, 0x04A8DD01, 0x04A8F002,
+    0x04A8F202, 0x04A8F302, 0x04A8F701, 0x04A8F801, 0x04A8FB01, 0x04A8FC01, 0x04A94B02, 0x04A94C02, 0x04A94D02, 0x04A95201, 0x04A95301, 0x04A95806,
+    0x04A95902, 0x04A95B01, 0x04A98F01, 0x04A9A701, 0x04A9C101, 0x04A9C301, 0x04A9CA01, 0x04A9CB01, 0x04A9CD01, 0x04A9CE01, 0x04A9D001, 0x04A9D201,
+    0x04A9D301, 0x04A9D801, 0x04AA0801, 0x04AA0A01, 0x04AA1401, 0x04AA1E02, 0x04AA3001, 0x04AA4F01, 0x04AA5D01, 0x04AA7704, 0x04AAFC01, 0x04AB3801,
+    0x04AB4001, 0x04AB4101, 0x04AB5301, 0x04AB5F01, 0x04AB9901, 0x04ABCD02, 0x04ABE806, 0x04ABEC01, 0x04ABF001, 0x04AC2101, 0x04AC3101, 0x04AC3502,
+    0x04AC3602, 0x04AC4701, 0x04AC5006, 0x04AC5101, 0x04AC6A01, 0x04ACF401, 0x04AD0601, 0x04AD5C01, 0x04AD6B01, 0x04AD9B01, 0x04ADB301, 0x04ADCA01,
+    0x04ADCD01, 0x04ADD501, 0x04ADEE01, 0x04AE3A01, 0x04AE5401, 0x04AE5C01, 0x04AE6301, 0x04AE8801, 0x04AE8E02, 0x04AEBB01, 0x04AEF401, 0x04AF0B01,
+    0x04AF1601, 0x04AF1701, 0x04AF2B01, 0x04AF2D01, 0x04AF3101, 0x04AF3201, 0x04AF3501, 0x04AF3701, 0x04AF4501, 0x04AF4F01, 0x04AF6606, 0x04AF6D01,
+    0x04AF6E02, 0x04AF8002, 0x04AF8D01, 0x04AF8E01, 0x04AFAB01, 0x04AFB802, 0x04AFF801, 0x04AFFA01, 0x04B00702, 0x04B02101, 0x04B02D01, 0x04B06704,
+    0x04B06B04, 0x04B07501, 0x04B08001, 0x04B0C502, 0x04B0DD01, 0x04B0F306, 0x04B14601, 0x04B14901, 0x04B15101, 0x04B15901, 0x04B16002, 0x04B18201,
+    0x04B19202, 0x04B19902, 0x04B19C02, 0x04B1C404, 0x04B26501, 0x04B26E01, 0x04B29F06, 0x04B2D301, 0x04B2DA01, 0x04B2F001, 0x04B2F202, 0x04B2F301,
+    0x04B2F501, 0x04B2F902, 0x04B2FB02, 0x04B30001, 0x04B34501, 0x04B35B01, 0x04B35E02, 0x04B36001, 0x04B36201, 0x04B38501, 0x04B3B501, 0x04B3E001,
+    0x04B41E01, 0x04B41F01, 0x04B42001, 0x04B43402, 0x04B49901, 0x04B4C201, 0x04B4EB04, 0x04B50B02, 0x04B50F06, 0x04B51202, 0x04B5C701, 0x04B5C801,
+    0x04B63D01, 0x04B64304, 0x04B66601, 0x04B67601, 0x04B67701, 0x04B68901, 0x04B6CF01, 0x04B74604, 0x04B74704, 0x04B83D01, 0x04B85002, 0x04B85102,
+    0x04B85F01, 0x04B8C002, 0x04B8C102, 0x04B8C702, 0x04B8CD04, 0x04B8F702, 0x04B8F902, 0x04B8FB02, 0x04B8FC02, 0x04B8FD02, 0x04B90301, 0x04B93A02,
+    0x04B99301, 0x04B99401, 0x04B99801, 0x04B99901, 0x04B9B001, 0x04B9B804, 0x04B9C801, 0x04B9CF04, 0x04B9E501, 0x04BA0E01, 0x04BA2A04, 0x04BA2F04,
+    0x04BA5D01, 0x04BADA01, 0x04BAFE01, 0x04BB0301, 0x04BB0401, 0x04BB0601, 0x04BB6904, 0x04BBE702, 0x04BC3201, 0x04BC5701, 0x04BC7101, 0x04BC7D01,
+    0x04BC8001, 0x04BC8601, 0x04BCB701, 0x04BCCE02, 0x04BCE303, 0x04BD0202, 0x04BD2101, 0x04BD4002, 0x04BD4302, 0x04BD4502, 0x04BD4702, 0x04BD4802,
+    0x04BD4902, 0x04BD4A02, 0x04BD4B02, 0x04BD4C02, 0x04BD4D02, 0x04BD4E02, 0x04BD4F02, 0x04BD5002, 0x04BD5102, 0x04BD7D01, 0x04BD9801, 0x04BD9902,
+    0x04BDA202, 0x04BDB102, 0x04BDB602, 0x04BDB702, 0x04BDB802, 0x04BDD502, 0x04BDF901, 0x04BE3001, 0x04BEC401, 0x04BECD02, 0x04BED103, 0x04BED203,
+    0x04BED403, 0x04BEFA01, 0x04BF3901, 0x04BF4B03, 0x04BF5302, 0x04BF6901, 0x04BF7801, 0x04BF7C01, 0x04BF7E02, 0x04BF7F02, 0x04BF8902, 0x04BF9802,
+    0x04BF9902, 0x04BF9A02, 0x04BF9B02, 0x04BF9D02, 0x04BF9E02, 0x04BFA103, 0x04BFA202, 0x04BFA302, 0x04BFA501, 0x04BFA602, 0x04BFA702, 0x04BFA902,
+    0x04BFAA02, 0x04BFAB02, 0x04BFAC02, 0x04BFAD02, 0x04BFFD02, 0x04C00602, 0x04C00702, 0x04C00802, 0x04C00A02, 0x04C04201, 0x04C04B02, 0x04C04C02,
+    0x04C0FC03, 0x04C16002, 0x04C16302, 0x04C17C01, 0x04C18002, 0x04C19006, 0x04C19102, 0x04C19202, 0x04C19302, 0x04C19A02, 0x04C1A202, 0x04C1A302,
+    0x04C1B206, 0x04C1DA01, 0x04C1E001, 0x04C27A02, 0x04C28B02, 0x04C29702, 0x04C29C02, 0x04C2A702, 0x04C2A902, 0x04C32301, 0x04C32A02, 0x04C32B02,
+    0x04C33202, 0x04C35801, 0x04C37002, 0x04C37202, 0x04C38A02, 0x04C40104, 0x04C40401, 0x04C42D02, 0x04C43B02, 0x04C44701, 0x04C4DB01, 0x04C4E202,
+    0x04C51701, 0x04C51E01, 0x04C52101, 0x04C52401, 0x04C55101, 0x04C56001, 0x04C59502, 0x04C59E02, 0x04C5AD02, 0x04C5BC02, 0x04C5C002, 0x04C5C202,
+    0x04C5C302, 0x04C5C502, 0x04C5C602, 0x04C5C702, 0x04C5F001, 0x04C5F801, 0x04C61402, 0x04C61502, 0x04C63A02, 0x04C65302, 0x04C65C02, 0x04C68404,
+    0x04C68B01, 0x04C68F01, 0x04C71501, 0x04C71A01, 0x04C73C02, 0x04C74701, 0x04C75401, 0x04C77501, 0x04C77F01, 0x04C78102, 0x04C78C01, 0x04C7BA01,
+    0x04C7BB01, 0x04C7D701, 0x04C7DE02, 0x04C7E601, 0x04C89B01, 0x04C8AA02, 0x04C8BB02, 0x04C92B02, 0x04C94301, 0x04C94801, 0x04C95401, 0x04C99F01,
+    0x04C9A201, 0x04C9A301, 0x04C9A501, 0x04CA3E02, 0x04CA3F02, 0x04CA4002, 0x04CA4102, 0x04CA4202, 0x04CA5201, 0x04CA6701, 0x04CA9901, 0x04CADA01,
+    0x04CAEC01, 0x04CB3101, 0x04CB4A02, 0x04CB7D01, 0x04CB8D03, 0x04CBBC01, 0x04CBBD01, 0x04CBEF01, 0x04CBFD01, 0x04CBFE01, 0x04CC0E01, 0x04CC2E01,
+    0x04CC3204, 0x04CC3E01, 0x04CC5203, 0x04CC6101, 0x04CC6906, 0x04CC7901, 0x04CC9802, 0x04CC9F01, 0x04CCA506, 0x04CCBF03, 0x04CCD602, 0x04CCDF01,
+    0x04CCE801, 0x04CCF501, 0x04CCFA01, 0x04CD0906, 0x04CD0D01, 0x04CD1101, 0x04CD2204, 0x04CD2604, 0x04CD5E01, 0x04CD6501, 0x04CD6701, 0x04CD7001,
+    0x04CD7604, 0x04CDAC01, 0x04CDE201, 0x04CDFF01, 0x04CE1801, 0x04CE1A01, 0x04CE2001, 0x04CE2E01, 0x04CE7101, 0x04CE7201, 0x04CE8501, 0x04CEB001,
+    0x04CEB601, 0x04CEB701, 0x04CEBA01, 0x04CECA04, 0x04CF1901, 0x04CF2102, 0x04CF3A01, 0x04CF3D01, 0x04CF7A01, 0x04CF8901, 0x04CF8E01, 0x04CF9901,
+    0x04CFAF01, 0x04CFB401, 0x04CFCD06, 0x04CFE402, 0x04CFFF02, 0x04D00002, 0x04D03202, 0x04D03302, 0x04D06802, 0x04D06901, 0x04D07402, 0x04D07801,
+    0x04D07D01, 0x04D0B101, 0x04D0C002, 0x04D0C106, 0x04D0E801, 0x04D0F501, 0x04D13301, 0x04D13D01, 0x04D13E01, 0x04D14301, 0x04D14601, 0x04D14802,
+    0x04D17401, 0x04D1AB06, 0x04D1B301, 0x04D1B501, 0x04D1C201, 0x04D1C304, 0x04D1E801, 0x04D20001, 0x04D22204, 0x04D22304, 0x04D22402, 0x04D22502,
+    0x04D22804, 0x04D23004, 0x04D23906, 0x04D26702, 0x04D26C01, 0x04D28401, 0x04D28D02, 0x04D29101, 0x04D2AE01, 0x04D2C302, 0x04D32801, 0x04D33B02,
+    0x04D33C02, 0x04D34F06, 0x04D35701, 0x04D36602, 0x04D36F01, 0x04D3C601, 0x04D41302, 0x04D42102, 0x04D44401, 0x04D44A04, 0x04D45101, 0x04D45E01,
+    0x04D47302, 0x04D47504, 0x04D47A04, 0x04D47D01, 0x04D47E01, 0x04D4B102, 0x04D4B302, 0x04D4B701, 0x04D4B801, 0x04D4BD02, 0x04D4D201, 0x04D4E303,
+    0x04D4EC01, 0x04D50801, 0x04D53D02, 0x04D55701, 0x04D55A01, 0x04D55F01, 0x04D56001, 0x04D56401, 0x04D56601, 0x04D57501, 0x04D58D01, 0x04D59202,
+    0x04D59A02, 0x04D5A302, 0x04D5BE01, 0x04D5CC01, 0x04D63402, 0x04D64901, 0x04D69002, 0x04D69102, 0x04D6AB02, 0x04D6AC02, 0x04D6AF01, 0x04D6B001,
+    0x04D6CA03, 0x04D6CB02, 0x04D6DD01, 0x04D72504, 0x04D74804, 0x04D74A04, 0x04D75102, 0x04D75804, 0x04D78802, 0x04D79301, 0x04D7A502, 0x04D7D401,
+    0x04D7F502, 0x04D7F602, 0x04D82B06, 0x04D82D02, 0x04D83006, 0x04D83106, 0x04D83302, 0x04D83804, 0x04D83902, 0x04D83D01, 0x04D85102, 0x04D87A02,
+    0x04D87F01, 0x04D89506, 0x04D8AA02, 0x04D8AE02, 0x04D90102, 0x04D90802, 0x04D90A02, 0x04D90B02, 0x04D95002, 0x04D95F06, 0x04D96006, 0x04D9A701,
+    0x04D9AA02, 0x04D9BA01, 0x04D9BC01, 0x04DA0301, 0x04DA1401, 0x04DA3C01, 0x04DA5C02, 0x04DAAD06, 0x04DABC01, 0x04DAC502, 0x04DAC702, 0x04DAC802,
+    0x04DACA02, 0x04DACF02, 0x04DAD202, 0x04DAD302, 0x04DAE901, 0x04DAF101, 0x04DB0E01, 0x04DB1A01, 0x04DB4C01, 0x04DB5001, 0x04DB5201, 0x04DB5301,
+    0x04DB5401, 0x04DB6201, 0x04DB9701, 0x04DBA501, 0x04DBB102, 0x04DBFE01, 0x04DC0C02, 0x04DC1906, 0x04DC1A06, 0x04DC4D02, 0x04DC6501, 0x04DCDD01,
+    0x04DCF101, 0x04DD1801, 0x04DD2C01, 0x04DD4B01, 0x04DD6E01, 0x04DD8901, 0x04DDAE01, 0x04DDC102, 0x04DE5702, 0x04DE8302, 0x04DEA601, 0x04DEC706,
+    0x04DED606, 0x04DEE901, 0x04DF0406, 0x04DF0606, 0x04DF0B06, 0x04DF1703, 0x04DF3201, 0x04DF7201, 0x04DF7301, 0x04DFA901, 0x04DFAA01, 0x04DFBC01,
+    0x04DFCF02, 0x04E01002, 0x04E02F01, 0x04E07201, 0x04E07606, 0x04E07B01, 0x04E09501, 0x04E0A501, 0x04E0B802, 0x04E0BA02, 0x04E0C901, 0x04E12202,
+    0x04E14501, 0x04E15C06, 0x04E15D01, 0x04E19901, 0x04E19E01, 0x04E1B001, 0x04E1BA02, 0x04E1C201, 0x04E1C801, 0x04E1CD02, 0x04E1FD01, 0x04E20601,
+    0x04E22306, 0x04E23601, 0x04E23B01, 0x04E23E01, 0x04E24A02, 0x04E24C02, 0x04E25202, 0x04E25302, 0x04E26901, 0x04E27901, 0x04E27D06, 0x04E28001,
+    0x04E29B01, 0x04E2A002, 0x04E2A602, 0x04E2B201, 0x04E2B701, 0x04E2D802, 0x04E2DA02, 0x04E2EA01, 0x04E31301, 0x04E32902, 0x04E33001, 0x04E33401,
+    0x04E33F01, 0x04E34B02, 0x04E34E06, 0x04E35202, 0x04E35506, 0x04E35602, 0x04E35702, 0x04E38901, 0x04E39001, 0x04E39101, 0x04E39601, 0x04E40301,
+    0x04E40401, 0x04E40802, 0x04E40903, 0x04E41702, 0x04E43E01, 0x04E46501, 0x04E46701, 0x04E46B02, 0x04E48601, 0x04E48A01, 0x04E4A401, 0x04E4D601,
+    0x04E4DE01, 0x04E4EC02, 0x04E4ED02, 0x04E4EF02, 0x04E4F006, 0x04E4FA02, 0x04E50002, 0x04E50F02, 0x04E51201, 0x04E51B01, 0x04E51D01, 0x04E52202,
+    0x04E52701, 0x04E52A01, 0x04E52D02, 0x04E52F01, 0x04E53302, 0x04E53502, 0x04E53C01, 0x04E54802, 0x04E54A02, 0x04E54D01, 0x04E55201, 0x04E55302,
+    0x04E55F02, 0x04E5D006, 0x04E60901, 0x04E61702, 0x04E65D02, 0x04E65E01, 0x04E67002, 0x04E68401, 0x04E68702, 0x04E68C02, 0x04E68D02, 0x04E69902,
+    0x04E69B01, 0x04E6A202, 0x04E6AB01, 0x04E6B901, 0x04E6C901, 0x04E6DA01, 0x04E6DE01, 0x04E6E301, 0x04E6EE01, 0x04E6FA01, 0x04E6FB01, 0x04E70001,
+    0x04E70201, 0x04E70B02, 0x04E70F02, 0x04E71D01, 0x04E71E02, 0x04E71F02, 0x04E72601, 0x04E72701, 0x04E73102, 0x04E74202, 0x04E74E02, 0x04E75201,
+    0x04E75302, 0x04E76302, 0x04E77302, 0x04E7AD02, 0x04E7B402, 0x04E7B502, 0x04E7BC02, 0x04E7BD02, 0x04E7DF02, 0x04E7E202, 0x04E7E302, 0x04E7EC01,
+    0x04E7F101, 0x04E7F201, 0x04E7FA02, 0x04E80202, 0x04E81E01, 0x04E85701, 0x04E85801, 0x04E85901, 0x04E85A01, 0x04E88901, 0x04E88D02, 0x04E88E01,
+    0x04E89502, 0x04E89602, 0x04E89F02, 0x04E8A502, 0x04E8B002, 0x04E8B301, 0x04E8B501, 0x04E96101, 0x04E96C01, 0x04E96D01, 0x04E97101, 0x04E97501,
+    0x04E9A701, 0x04E9C101, 0x04E9C301, 0x04E9CB02, 0x04EA3502, 0x04EA3702, 0x04EA3D03, 0x04EA3F03, 0x04EA4502, 0x04EA4602, 0x04EA4702, 0x04EA4901,
+    0x04EA4A01, 0x04EA7706, 0x04EA7801, 0x04EA7A02, 0x04EA7E01, 0x04EA8101, 0x04EA9A01, 0x04EB0701, 0x04EB1401, 0x04EB3401, 0x04EB7F02, 0x04EB8A02,
+    0x04EB9902, 0x04EB9A02, 0x04EB9B02, 0x04EB9C02, 0x04EB9D02, 0x04EB9E02, 0x04EB9F02, 0x04EBA002, 0x04EBA401, 0x04EBCB02, 0x04EBEC02, 0x04EC1001,
+    0x04EC5801, 0x04EC6001, 0x04EC7D01, 0x04EC7E01, 0x04EC9001, 0x04EC9101, 0x04ECA902, 0x04ECBA01, 0x04ECC501, 0x04ECE501, 0x04ECE901, 0x04ED4601,
+    0x04ED4801, 0x04ED6701, 0x04EDBA01, 0x04EDD902, 0x04EE0A01, 0x04EE0B01, 0x04EE0C01, 0x04EE0D01, 0x04EE0E01, 0x04EE2B01, 0x04EE3A01, 0x04EE4F01,
+    0x04EE6301, 0x04EE7B01, 0x04EE7E01, 0x04EEDC01, 0x04EEF501, 0x04EEF601, 0x04EEF801, 0x04EF2501, 0x04EF2D01, 0x04EF4E01, 0x04EF6C01, 0x04EF6F01,
+    0x04EF7101, 0x04EF7404, 0x04EF7802, 0x04EF9904, 0x04EFB501, 0x04EFDB06, 0x04EFE501, 0x04EFF501, 0x04EFFD01, 0x04EFFE01, 0x04F00702, 0x04F02D01,
+    0x04F04606, 0x04F04801, 0x04F04A02, 0x04F04B02, 0x04F04C06, 0x04F04E03, 0x04F05904, 0x04F06801, 0x04F07E06, 0x04F08402, 0x04F0A601, 0x04F0AE02,
+    0x04F0C601, 0x04F0D001, 0x04F0D606, 0x04F0D801, 0x04F0DA06, 0x04F0E301, 0x04F0F701, 0x04F0F801, 0x04F0FF01, 0x04F10001, 0x04F10401, 0x04F10801,
+    0x04F11A02, 0x04F12901, 0x04F13001, 0x04F14C02, 0x04F15E01, 0x04F16301, 0x04F16601, 0x04F16C01, 0x04F16D01, 0x04F17501, 0x04F19701, 0x04F1A101,
+    0x04F1BA01, 0x04F1BB01, 0x04F1D402, 0x04F1E902, 0x04F1EA06, 0x04F1FC01, 0x04F20101, 0x04F20D01, 0x04F22002, 0x04F22D01, 0x04F23504, 0x04F24402,
+    0x04F24503, 0x04F27C02, 0x04F29501, 0x04F2B101, 0x04F2B201, 0x04F2B501, 0x04F2B601, 0x04F2BB01, 0x04F2DB01, 0x04F2E502, 0x04F2E602, 0x04F2EF01,
+    0x04F32202, 0x04F32504, 0x04F32901, 0x04F33502, 0x04F33602, 0x04F33802, 0x04F34404, 0x04F39506, 0x04F3A201, 0x04F3A501, 0x04F3A702, 0x04F3A806,
+    0x04F3AA02, 0x04F3B802, 0x04F3BB01, 0x04F3BC06, 0x04F3C502, 0x04F3EE01, 0x04F42E04, 0x04F44201, 0x04F44301, 0x04F46001, 0x04F46501, 0x04F46701,
+    0x04F46801, 0x04F47101, 0x04F49101, 0x04F4A101, 0x04F4AD01, 0x04F4BF01, 0x04F4CD01, 0x04F4CE01, 0x04F4D401, 0x04F4EF01, 0x04F53701, 0x04F59C06,
+    0x04F5A701, 0x04F5A801, 0x04F5AD04, 0x04F5B102, 0x04F5D704, 0x04F5D901, 0x04F5DF01, 0x04F5E402, 0x04F5E502, 0x04F5FE02, 0x04F60A06, 0x04F62106,
+    0x04F62302, 0x04F63602, 0x04F63902, 0x04F64D02, 0x04F64E01, 0x04F64F01, 0x04F65001, 0x04F65902, 0x04F65B02, 0x04F65C02, 0x04F65D02, 0x04F66002,
+    0x04F66103, 0x04F66203, 0x04F66301, 0x04F66C01, 0x04F68301, 0x04F68401, 0x04F68701, 0x04F68B01, 0x04F68F01, 0x04F69101, 0x04F69402, 0x04F69C01,
+    0x04F69F01, 0x04F6A101, 0x04F6A201, 0x04F6A306, 0x04F6BA01, 0x04F6BB01, 0x04F6C301, 0x04F6C801, 0x04F6C902, 0x04F6CE06, 0x04F6CF01, 0x04F6D301,
+    0x04F6E501, 0x04F6E601, 0x04F6E701, 0x04F6EA01, 0x04F6ED01, 0x04F6FD04, 0x04F74602, 0x04F75506, 0x04F75806, 0x04F77301, 0x04F78001, 0x04F78901,
+    0x04F7AC02, 0x04F7BB02, 0x04F7BC02, 0x04F7BD02, 0x04F7C002, 0x04F7C102, 0x04F7C203, 0x04F7C402, 0x04F7D501, 0x04F80701, 0x04F81201, 0x04F81601,
+    0x04F82001, 0x04F82201, 0x04F82301, 0x04F83A01, 0x04F84301, 0x04F84601, 0x04F85301, 0x04F85F02, 0x04F86701, 0x04F87402, 0x04F89C02, 0x04F8B402,
+    0x04F8B602, 0x04F8CA01, 0x04F8D002, 0x04F8ED02, 0x04F8FB06, 0x04F8FE04, 0x04F90502, 0x04F96006, 0x04F98101, 0x04F98801, 0x04F98B01, 0x04F9A601,
+    0x04F9A801, 0x04F9AE06, 0x04F9AF01, 0x04F9BE01, 0x04F9C304, 0x04F9EC01, 0x04F9EF01, 0x04FA6F01, 0x04FA7C01, 0x04FA7D01, 0x04FA7E01, 0x04FAA501,
+    0x04FB2202, 0x04FB4501, 0x04FB6201, 0x04FB7401, 0x04FB7801, 0x04FB7C01, 0x04FB9901, 0x04FB9E01, 0x04FB9F01, 0x04FBE901, 0x04FBFE02, 0x04FC0002,
+    0x04FC0602, 0x04FC0B01, 0x04FC0C02, 0x04FC0D02, 0x04FC1702, 0x04FC1802, 0x04FC1B02, 0x04FC2102, 0x04FC2202, 0x04FC2402, 0x04FC2602, 0x04FC2802,
+    0x04FC2902, 0x04FC3601, 0x04FC4B06, 0x04FC4C02, 0x04FC5502, 0x04FC5D01, 0x04FC7F01, 0x04FC8401, 0x04FC8601, 0x04FC9502, 0x04FC9803, 0x04FCC201,
+    0x04FCC401, 0x04FCC702, 0x04FCCD01, 0x04FCD302, 0x04FCDC01, 0x04FCFF02, 0x04FD0603, 0x04FD0C01, 0x04FD2601, 0x04FD3101, 0x04FD3702, 0x04FD4001,
+    0x04FD4102, 0x04FD4803, 0x04FD5902, 0x04FD5F02, 0x04FD8201, 0x04FD9304, 0x04FDAA02, 0x04FDB402, 0x04FDB502, 0x04FDB702, 0x04FDB802, 0x04FDBB04,
+    0x04FDBC01, 0x04FDC002, 0x04FDC301, 0x04FDED01, 0x04FDFA04, 0x04FE2B01, 0x04FE3902, 0x04FE4601, 0x04FE5A06, 0x04FE6006, 0x04FE6C02, 0x04FEBA02,
+    0x04FEBB02, 0x04FEE901, 0x04FEF701, 0x04FEF901, 0x04FF4002, 0x04FF4A04, 0x04FF4E01, 0x04FF6B01, 0x04FF7101, 0x04FF7201, 0x04FF7C01, 0x04FF7D01,
+    0x04FF8902, 0x04FF9603, 0x04FFBB06, 0x04FFEB01, 0x05005001, 0x05005801, 0x05005F01, 0x05006401, 0x05006D01, 0x05007101, 0x05007201, 0x05007701,
+    0x05009F02, 0x0500A001, 0x0500A301, 0x0500A601, 0x0500AD01, 0x0500AE01, 0x0500B201, 0x0500BE01, 0x0500C301, 0x0500C401, 0x0500D001, 0x0500DE01,
+    0x0500E201, 0x0500EB01, 0x0500EC01, 0x05011D03, 0x05012101, 0x05012201, 0x05012301, 0x05012401, 0x05016B01, 0x05017301, 0x05017601, 0x05018201,
+    0x05018B01, 0x05018C01, 0x05019206, 0x05019502, 0x0501A201, 0x0501BB01, 0x0501C001, 0x0501CB01, 0x0501CE01, 0x0501D401, 0x0501F301, 0x0501F501,
+    0x05020C06, 0x05021401, 0x05022101, 0x05025B02, 0x05025C02, 0x05026C01, 0x05026F01, 0x05027102, 0x05027206, 0x05029F01, 0x0502A101, 0x0502B101,
+    0x0502CB02, 0x0502D601, 0x0502F602, 0x05032501, 0x05032C01, 0x05032E01, 0x05032F01, 0x05033401, 0x05033701, 0x05033801, 0x05033E01, 0x05035202,
+    0x05035C01, 0x05036101, 0x05036306, 0x05038001, 0x05038301, 0x0503D801, 0x0503EF01, 0x05041301, 0x05041502, 0x05042C03, 0x05043504, 0x05043B01,
+    0x05044602, 0x05045801, 0x05045A01, 0x05045E01, 0x05046701, 0x05046A01, 0x05046B01, 0x05048001, 0x05048504, 0x0504B701, 0x0504CA02, 0x0504E004,
+    0x0504E201, 0x0504F401, 0x0504F602, 0x0504F702, 0x0504F802, 0x0504F903, 0x0504FA02, 0x0504FB02, 0x0504FC02, 0x0504FD02, 0x0504FF02, 0x05050003,
+    0x05051502, 0x05052E02, 0x05054001, 0x05054101, 0x05054902, 0x05054E02, 0x05054F01, 0x05055202, 0x05055F01, 0x05056002, 0x05056101, 0x05058D01,
+    0x0505A201, 0x0505AE01, 0x0505B101, 0x0505C604, 0x0505DB01, 0x0505DC01, 0x0505FC01, 0x05061A02, 0x05062C01, 0x05062D02, 0x05062F01, 0x05063001,
+    0x05063102, 0x05063302, 0x05063A04, 0x05063E02, 0x05066201, 0x05068C01, 0x05068D01, 0x0506B602, 0x0506DA02, 0x0506F101, 0x0506FD01, 0x05074502,
+    0x05079701, 0x0507B701, 0x0507BE01, 0x0507DA02, 0x0507E401, 0x0507FD01, 0x05083F01, 0x05084902, 0x0508A802, 0x0508A901, 0x0508AB01, 0x0508D002,
+    0x05090B01, 0x05091401, 0x05092D01, 0x05092E01, 0x05094701, 0x05095101, 0x05095501, 0x05096501, 0x05096C01, 0x05096E01, 0x05096F01, 0x05097401,
+    0x05097601, 0x05098501, 0x05098701, 0x05098D01, 0x05099501, 0x05099701, 0x05099802, 0x050A3901, 0x050A5502, 0x050A5E02, 0x050A9B01, 0x050AE601,
+    0x050AEC01, 0x050B1001, 0x050B2401, 0x050B2901, 0x050B5802, 0x050B5C02, 0x050B5E01, 0x050B6D01, 0x050B9801, 0x050BA004, 0x050BA802, 0x050BF201,
+    0x050C2101, 0x050C3E01, 0x050C6A02, 0x050C7902, 0x050C8806, 0x050C9206, 0x050C9502, 0x050C9706, 0x050C9902, 0x050C9A04, 0x050C9B06, 0x050C9F06,
+    0x050CC101, 0x050CC501, 0x050CC601, 0x050CCB01, 0x050CFC01, 0x050D3801, 0x050D6501, 0x050D6D02, 0x050D7402, 0x050D8C01, 0x050D8D01, 0x050D8F01,
+    0x050D9101, 0x050D9201, 0x050D9904, 0x050D9B04, 0x050DA401, 0x050DB001, 0x050DD101, 0x050E1101, 0x050E1201, 0x050E2201, 0x050E2601, 0x050E2B01,
+    0x050E2C01, 0x050E3A01, 0x050E3B01, 0x050E3C02, 0x050E4001, 0x050E4102, 0x050E4201, 0x050E4302, 0x050E4601, 0x050E4702, 0x050E5E01, 0x050E6101,
+    0x050E6D01, 0x050E6E01, 0x050E7501, 0x050EA702, 0x050EA801, 0x050EA906, 0x050EC401, 0x050ECA01, 0x050ECB01, 0x050EDC01, 0x050EE402, 0x050EE502,
+    0x050EE902, 0x050F0F02, 0x050F1003, 0x050F6901, 0x050F6A01, 0x050F6C04, 0x050F7201, 0x050F7601, 0x050F7701, 0x050F7A02, 0x050F7B02, 0x050F7C02,
+    0x050F7D02, 0x050FB901, 0x050FBA01, 0x050FBC01, 0x050FC501, 0x050FC701, 0x05100801, 0x05101901, 0x05103502, 0x05104A06, 0x05105A02, 0x05108D02,
+    0x0510B702, 0x0510BA06, 0x0510C601, 0x05116901, 0x05116A01, 0x05116B01, 0x05116E01, 0x05117902, 0x05118406, 0x0511A501, 0x0511AF01, 0x0511BB01,
+    0x0511BC01, 0x0511BF03, 0x0511D101, 0x05123C01, 0x05123D01, 0x05124D02, 0x05125201, 0x05126D01, 0x05127601, 0x05129C01, 0x0512B406, 0x0512B506,
+    0x0512B602, 0x0512BB01, 0x0512C701, 0x0512D201, 0x0512F302, 0x05130002, 0x05130302, 0x05130701, 0x05132B01, 0x05132D01, 0x05133602, 0x05134104,
+    0x05134601, 0x05134801, 0x05135901, 0x05135E01, 0x05137E01, 0x05139504, 0x0513C701, 0x0513E506, 0x05141701, 0x05141D02, 0x05141F02, 0x05144E01,
+    0x05146401, 0x05147101, 0x05149702, 0x05149C01, 0x0514D601, 0x0514E602, 0x0514EF01, 0x0514F001, 0x0514F701, 0x0514F801, 0x0514F902, 0x0514FB01,
+    0x0514FC01, 0x0514FE01, 0x0514FF01, 0x05151B02, 0x05151D02, 0x05151F02, 0x05153606, 0x05153D02, 0x05153E02, 0x05154002, 0x05156101, 0x05157501,
+    0x05157A01, 0x05159101, 0x0515C401, 0x0515CA01, 0x0515F204, 0x0515F401, 0x0515F501, 0x05160C01, 0x05164A02, 0x05164D06, 0x05168B01, 0x05169E02,
+    0x0516CA03, 0x0516D701, 0x0516DC01, 0x0516FD01, 0x0516FE01, 0x05170001, 0x05170101, 0x05170301, 0x05170401, 0x05170501, 0x05170601, 0x05170801,
+    0x05170901, 0x05170A01, 0x05171201, 0x05171301, 0x05171401, 0x05171501, 0x05171601, 0x05171701, 0x05171901, 0x05171A01, 0x05171B01, 0x05171C01,
+    0x05173301, 0x05173B01, 0x05173D01, 0x05174D01, 0x05174E02, 0x05175701, 0x0517A501, 0x0517AF01, 0x0517C403, 0x0517C706, 0x0517F301, 0x0517F402,
+    0x0517FE01, 0x0517FF01, 0x05181602, 0x05182404, 0x05184402, 0x05185001, 0x05185F02, 0x05186002, 0x05186502, 0x05188502, 0x05189602, 0x05189906,
+    0x0518BB01, 0x0518D102, 0x0518D901, 0x0518DE02, 0x0518F301, 0x0518F906, 0x05191201, 0x05191901, 0x05192301, 0x05192401, 0x05192601, 0x05192901,
+    0x05192A01, 0x05192C01, 0x05192D01, 0x05192E01, 0x05192F01, 0x05195401, 0x05195501, 0x05195802, 0x05195F02, 0x05196402, 0x05196702, 0x05197201,
+    0x05197302, 0x05197402, 0x0519DE02, 0x051A5A01, 0x051A6702, 0x051AA401, 0x051AB201, 0x051AB301, 0x051AB401, 0x051AB501, 0x051AB601, 0x051AB701,
+    0x051AB801, 0x051AB901, 0x051AF502, 0x051AF902, 0x051AFF02, 0x051B1801, 0x051B2E01, 0x051B2F01, 0x051B3702, 0x051B5101, 0x051B5401, 0x051B5A01,
+    0x051B6502, 0x051B6701, 0x051B7902, 0x051B8702, 0x051B8901, 0x051B9501, 0x051B9601, 0x051B9701, 0x051B9E02, 0x051BA301, 0x051BB301, 0x051BF402,
+    0x051BF502, 0x051C0306, 0x051C2202, 0x051C2802, 0x051C2901, 0x051C2D01, 0x051C3402, 0x051C4701, 0x051C6502, 0x051CCC02, 0x051CF806, 0x051CF902,
+    0x051CFA06, 0x051CFC06, 0x051D3901, 0x051D4602, 0x051D4702, 0x051D5502, 0x051D8202, 0x051D8302, 0x051D8402, 0x051D9702, 0x051DBD01, 0x051DBF01,
+    0x051E0001, 0x051E0101, 0x051E0F01, 0x051E1101, 0x051E5901, 0x051E6B02, 0x051E6C01, 0x051E6F01, 0x051E7901, 0x051E7B01, 0x051E7E02, 0x051E9001,
+    0x051EAE01, 0x051EBA04, 0x051EC201, 0x051EDC01, 0x051EE101, 0x051EFA01, 0x051EFE04, 0x051F1901, 0x051F3201, 0x051F3301, 0x051F7602, 0x051F8803,
+    0x051F8D02, 0x051FA301, 0x051FAC01, 0x051FB701, 0x051FBD01, 0x051FCA01, 0x051FD601, 0x051FE101, 0x05201C01, 0x05202903, 0x05204801, 0x05204901,
+    0x05204A01, 0x05205001, 0x05205801, 0x05206E01, 0x05207202, 0x05208501, 0x05209201, 0x05209301, 0x0520A001, 0x0520A101, 0x0520A301, 0x0520A801,
+    0x0520AB01, 0x0520AC01, 0x0520E901, 0x0520FE02, 0x05210002, 0x05210601, 0x05210702, 0x05210802, 0x05210B02, 0x05210E01, 0x05211102, 0x05211202,
+    0x05212701, 0x05213101, 0x05213901, 0x05215802, 0x05217801, 0x05218301, 0x05218501, 0x05218701, 0x05218901, 0x05221102, 0x05225702, 0x0522A802,
+    0x0522B401, 0x0522B501, 0x0522CD01, 0x0522CE01, 0x0522F301, 0x0522FD02, 0x0522FE02, 0x0522FF02, 0x05230202, 0x05236402, 0x05239A01, 0x05239B03,
+    0x0523C002, 0x0523E806, 0x0523F902, 0x05240002, 0x05240304, 0x05240804, 0x05244E01, 0x05249D04, 0x0524C202, 0x0524C802, 0x0524F101, 0x05250302,
+    0x05252A01, 0x05253102, 0x05254902, 0x05254A01, 0x05255C02, 0x05256902, 0x05259202, 0x05259302, 0x05259F01, 0x0525A401, 0x0525B402, 0x0525BC02,
+    0x0525BD02, 0x0525BE06, 0x05264402, 0x05266904, 0x05266E02, 0x05267A04, 0x05268701, 0x05268C02, 0x05268D02, 0x05268E06, 0x05269B01, 0x05269C01,
+    0x05269F02, 0x0526A102, 0x0526A202, 0x0526AB01, 0x0526BA02, 0x0526C002, 0x0526CE04, 0x0526D701, 0x0526E602, 0x0526EB01, 0x0526EE01, 0x0526FA01,
+    0x0526FB04, 0x05271102, 0x05272302, 0x05272D02, 0x05273801, 0x05274A01, 0x05275202, 0x05277102, 0x05277B01, 0x05279402, 0x05279B06, 0x0527A002,
+    0x0527A102, 0x0527A702, 0x0527AE02, 0x0527B702, 0x0527BA02, 0x0527BB02, 0x0527BC02, 0x0527D701, 0x0527D801, 0x0527EC01, 0x0527FE01, 0x05280601,
+    0x05280704, 0x05281002, 0x05281401, 0x05281601, 0x05282801, 0x05283502, 0x05284801, 0x05286801, 0x05286E02, 0x05286F02, 0x05287902, 0x05289C04,
+    0x0528AD02, 0x0528D601, 0x0528DD01, 0x05295A02, 0x05298802, 0x05299102, 0x05299401, 0x05299601, 0x0529BF01, 0x0529CE02, 0x0529EB01, 0x0529EC01,
+    0x052A0602, 0x052A0701, 0x052A0F01, 0x052A1701, 0x052A2A01, 0x052A4502, 0x052A5C01, 0x052A5D01, 0x052A9201, 0x052AA101, 0x052B0E01, 0x052B2701,
+    0x052B6401, 0x052B7402, 0x052B9202, 0x052BEB04, 0x052BEC01, 0x052BED02, 0x052BEE04, 0x052BEF02, 0x052BF102, 0x052BF302, 0x052C0501, 0x052C4C01,
+    0x052C4E01, 0x052C6001, 0x052C6B02, 0x052C7B01, 0x052C8801, 0x052CA901, 0x052CB101, 0x052CF302, 0x052D1D02, 0x052D2201, 0x052D3301, 0x052D4302,
+    0x052D6203, 0x052D8301, 0x052D8401, 0x052DB001, 0x052DB906, 0x052DBF04, 0x052DC004, 0x052DC801, 0x052DFE01, 0x052E1A02, 0x052E2A02, 0x052E3701,
+    0x052E4C04, 0x052E5203, 0x052E6D01, 0x052E7601, 0x052EC602, 0x052ED501, 0x052ED801, 0x052EED01, 0x052EFB01, 0x052F2001, 0x052F4E01, 0x052F7102,
+    0x052FAD01, 0x052FAE01, 0x052FB502, 0x052FB606, 0x052FBF01, 0x052FCD01, 0x052FCF01, 0x052FE801, 0x052FE902, 0x05301202, 0x05305801, 0x05305901,
+    0x05305A01, 0x0530C603, 0x0530D601, 0x0530DF01, 0x0530E101, 0x0530EB04, 0x0530F301, 0x05310301, 0x05313101, 0x05316401, 0x05316502, 0x05316B01,
+    0x05316D01, 0x05316E01, 0x05316F02, 0x05317501, 0x05318301, 0x0531B901, 0x0531BD01, 0x0531C601, 0x0531C701, 0x0531CA02, 0x0531CF01, 0x0531D101,
+    0x0531D601, 0x0531D801, 0x0531DC01, 0x0531DF01, 0x0531E701, 0x0531EC01, 0x0531F701, 0x0531F901, 0x05323501, 0x05323E01, 0x05325901, 0x05325B04,
+    0x05326301, 0x05326402, 0x05326602, 0x05326702, 0x05326802, 0x05327501, 0x05327802, 0x05327902, 0x05327B02, 0x05328401, 0x05328601, 0x05329001,
+    0x0532A101, 0x0532AD04, 0x0532BE01, 0x0532C101, 0x0532C501, 0x0532D401, 0x0532D701, 0x0532E001, 0x0532E901, 0x0532FF02, 0x05330801, 0x05330B01,
+    0x05335701, 0x05335902, 0x05335A02, 0x05337D01, 0x05338E04, 0x05346C04, 0x05347A02, 0x05347B02, 0x05347D02, 0x05347E02, 0x05349404, 0x0534AF02,
+    0x0534D401, 0x0534DF01, 0x0534E301, 0x0534E401, 0x0534F802, 0x05350D01, 0x05350F02, 0x05351902, 0x05351D06, 0x05352202, 0x05352B02, 0x05355C06,
+    0x05357E02, 0x05357F01, 0x05359902, 0x0535A001, 0x0535E901, 0x0535EE01, 0x0535F302, 0x05360601, 0x05360A01, 0x05361601, 0x05361A02, 0x05361D02,
+    0x05362506, 0x05362E02, 0x05364402, 0x05364C04, 0x05365C04, 0x05366101, 0x05366201, 0x05369501, 0x05369601, 0x05369701, 0x0536C401, 0x0536D501,
+    0x0536FA01, 0x05370301, 0x05370501, 0x05370901, 0x05371701, 0x05371A02, 0x05372701, 0x05373601, 0x05373A01, 0x05376402, 0x05377501, 0x05377A04,
+    0x05378204, 0x05378901, 0x05379F01, 0x0537C101, 0x0537C301, 0x0537D201, 0x0537D401, 0x0537D804, 0x0537E201, 0x0537E501, 0x05380801, 0x05380901,
+    0x05381701, 0x05381B01, 0x05382102, 0x05382401, 0x05382801, 0x05383901, 0x05385701, 0x05387202, 0x05389501, 0x05389601, 0x0538B401, 0x0538B801,
+    0x0538D806, 0x0538E006, 0x0538E202, 0x0538E302, 0x0538E502, 0x0538E602, 0x0538E702, 0x0538E902, 0x0538FA01, 0x05393A02, 0x05395502, 0x05396502,
+    0x05396706, 0x05397902, 0x0539B201, 0x0539B301, 0x0539B401, 0x0539F301, 0x053A3601, 0x053A7F01, 0x053A8301, 0x053AAA01, 0x053AAC01, 0x053B2102,
+    0x053B4401, 0x053B4501, 0x053B4906, 0x053B4B01, 0x053B4D01, 0x053B6001, 0x053B6401, 0x053B7E01, 0x053B9A02, 0x053BA501, 0x053BA802, 0x053BDF01,
+    0x053BFD04, 0x053C3201, 0x053C6606, 0x053C6702, 0x053C6903, 0x053C7802, 0x053C8202, 0x053C8502, 0x053CB002, 0x053CB106, 0x053CC702, 0x053CD102,
+    0x053CFE06, 0x053CFF06, 0x053D0A01, 0x053D3501, 0x053D3B06, 0x053D3C01, 0x053D4204, 0x053D4801, 0x053D5703, 0x053D5801, 0x053D7C01, 0x053D7E01,
+    0x053D9001, 0x053D9301, 0x053D9501, 0x053D9701, 0x053D9801, 0x053DDA01, 0x053DE001, 0x053DE201, 0x053DE702, 0x053DE801, 0x053DF302, 0x053DF702,
+    0x053DF801, 0x053DF901, 0x053DFA01, 0x053E3E01, 0x053E4202, 0x053E4B01, 0x053E4F01, 0x053E5401, 0x053E6601, 0x053E8A02, 0x053EA906, 0x053EAC06,
+    0x053EAF02, 0x053EB902, 0x053EC401, 0x053ED401, 0x053ED903, 0x053EE301, 0x053EF401, 0x053F0902, 0x053F0A02, 0x053F0B02, 0x053F0C03, 0x053F1002,
+    0x053F1201, 0x053F1701, 0x053F1801, 0x053F5101, 0x053F7101, 0x053F8601, 0x053F8C02, 0x053FC602, 0x053FC802, 0x053FD502, 0x053FDA02, 0x053FE303,
+    0x053FEA01, 0x053FEB01, 0x053FEC01, 0x053FED01, 0x053FEE01, 0x053FEF01, 0x053FF001, 0x053FF101, 0x053FFB02, 0x053FFC02, 0x053FFD02, 0x05400802,
+    0x05400902, 0x05400A02, 0x05400F02, 0x05401002, 0x05401102, 0x05401802, 0x05401A02, 0x05401D02, 0x05403806, 0x05403906, 0x05405E01, 0x05406E02,
+    0x05407302, 0x05407501, 0x05409801, 0x05409902, 0x05409A02, 0x05409B02, 0x05409C02, 0x0540AF02, 0x0540B002, 0x05410402, 0x05411002, 0x05411102,
+    0x05411202, 0x05411302, 0x05411602, 0x05411702, 0x05411A02, 0x05411B02, 0x05411C02, 0x05411D02, 0x05411E02, 0x05411F02, 0x05412002, 0x05412102,
+    0x05412502, 0x05414A01, 0x05415D01, 0x0541A404, 0x0541AC01, 0x0541B601, 0x0541D801, 0x0541D901, 0x0541DA01, 0x0541E001, 0x0541E101, 0x0541E406,
+    0x0541FC06, 0x05420604, 0x05420A01, 0x05420B02, 0x05421502, 0x05421602, 0x05421B02, 0x05423001, 0x05424502, 0x05425001, 0x05425202, 0x05428B01,
+    0x05429602, 0x0542AC06, 0x0542AF02, 0x0542B006, 0x0542B102, 0x0542B202, 0x0542CF01, 0x05431B02, 0x05431E02, 0x05432502, 0x05433501, 0x05433601,
+    0x05433C01, 0x05434402, 0x05434D01, 0x05435402, 0x05435902, 0x05436901, 0x05436B02, 0x05437001, 0x05437101, 0x05437B06, 0x05438D01, 0x0543B101,
+    0x0543F901, 0x0543FA01, 0x0543FB01, 0x0543FC01, 0x05442106, 0x05442203, 0x05442A03, 0x05443B01, 0x05443C01, 0x05444E01, 0x05445501, 0x05447001,
+    0x05447802, 0x05447902, 0x05447B01, 0x05448202, 0x05448302, 0x0544E406, 0x0544EB01, 0x05450001, 0x05450201, 0x05453D01, 0x05454D01, 0x05454F01,
+    0x0545AE01, 0x0545E102, 0x0545F501, 0x05460701, 0x05460D01, 0x05461901, 0x05461E01, 0x05461F01, 0x05462401, 0x05464001, 0x05464302, 0x05464402,
+    0x05464C01, 0x05466E02, 0x05467202, 0x05467A01, 0x05467F06, 0x05469701, 0x0546A401, 0x0546A701, 0x0546AB02, 0x0546B001, 0x0546B101, 0x0546B201,
+    0x0546B301, 0x0546E502, 0x05472E01, 0x05473A02, 0x05477101, 0x05479202, 0x0547F704, 0x0547FF03, 0x05480002, 0x05483501, 0x05487401, 0x05488701,
+    0x0548A402, 0x0548BD01, 0x0548D801, 0x05490202, 0x05492201, 0x05492301, 0x05492D01, 0x05494201, 0x05494E01, 0x05495D01, 0x05496501, 0x05498302,
+    0x05498402, 0x05498706, 0x05498802, 0x05498906, 0x05499E01, 0x0549B001, 0x0549EA06, 0x0549F001, 0x054A2906, 0x054A7C01, 0x054A8F01, 0x054A9101,
+    0x054A9301, 0x054A9B01, 0x054A9C01, 0x054AD004, 0x054AD901, 0x054AF001, 0x054B0001, 0x054B0101, 0x054B3401, 0x054B6501, 0x054B6801, 0x054B7501,
+    0x054B7804, 0x054B8002, 0x054B9D02, 0x054BA101, 0x054BA401, 0x054BB701, 0x054BD301, 0x054C1104, 0x054C1501, 0x054C2001, 0x054C4E01, 0x054C5101,
+    0x054C6E01, 0x054C7B01, 0x054C8301, 0x054C9C01, 0x054CB901, 0x054CC702, 0x054CC901, 0x054CD601, 0x054CE006, 0x054CE101, 0x054CE206, 0x054CE306,
+    0x054CF701, 0x054D0B02, 0x054D1E01, 0x054D1F01, 0x054D2101, 0x054D2701, 0x054D2A01, 0x054D3E01, 0x054D4301, 0x054D5802, 0x054D7E01, 0x054D8101,
+    0x054DA902, 0x054DB402, 0x054DBC02, 0x054DC901, 0x054DCB01, 0x054DCE01, 0x054DDC01, 0x054DE502, 0x054DE902, 0x054DFF02, 0x054E0201, 0x054E0302,
+    0x054E0401, 0x054E0502, 0x054E0802, 0x054E0901, 0x054E0B02, 0x054E0D01, 0x054E7502, 0x054E7B01, 0x054EB202, 0x054ED901, 0x054F0A02, 0x054F0B02,
+    0x054F0C02, 0x054F0D02, 0x054F0E02, 0x054F0F02, 0x054F1002, 0x054F1102, 0x054F1B01, 0x054F1F01, 0x054F4201, 0x054F4601, 0x054F5201, 0x054F5601,
+    0x054F5701, 0x054F6201, 0x054F6301, 0x054F6702, 0x054F6F01, 0x054F8A01, 0x054F8C01, 0x054F8D01, 0x054F9101, 0x054F9C01, 0x054F9D01, 0x054FDD01,
+    0x054FDE01, 0x054FE301, 0x054FEE01, 0x05500801, 0x05500901, 0x05501101, 0x05501201, 0x05501B01, 0x05503F01, 0x05506B02, 0x05509201, 0x0550AF01,
+    0x0550B102, 0x0550CE01, 0x05510C01, 0x05511501, 0x05511F01, 0x05512101, 0x05512201, 0x05512301, 0x05513601, 0x05513D03, 0x05513F03, 0x05514403,
+    0x05514503, 0x05514602, 0x05514902, 0x05515703, 0x05516001, 0x05516701, 0x05516801, 0x05516C01, 0x05517001, 0x05517401, 0x05517F01, 0x05518201,
+    0x0551A904, 0x0551BA04, 0x0551BE01, 0x0551BF01, 0x0551C001, 0x0551C101, 0x0551C601, 0x0551C701, 0x0551C801, 0x0551D001, 0x0551DD02, 0x0551F101,
+    0x0551F201, 0x0551F301, 0x05524002, 0x05525902, 0x05526001, 0x05526901, 0x05527D01, 0x0552C302, 0x0552DE02, 0x0552ED03, 0x05535901, 0x05535B01,
+    0x05538601, 0x0553AD01, 0x05555801, 0x05555B01, 0x05556F01, 0x0555BB01, 0x0555BC01, 0x05563E02, 0x05565E01, 0x05567001, 0x0556C901, 0x0556CE01,
+    0x0556DD02, 0x05570301, 0x05573304, 0x05573D01, 0x05576F06, 0x0557A702, 0x0557AA04, 0x0557B302, 0x0557B502, 0x0557C801, 0x0557CF06, 0x0557E901,
+    0x0557FC02, 0x05581502, 0x05583601, 0x05583701, 0x05583D02, 0x05588801, 0x0558D701, 0x0558D801, 0x0558EC01, 0x0558ED01, 0x0558F201, 0x0558F701,
+    0x0558F901, 0x05591601, 0x05591901, 0x05591D01, 0x05592701, 0x05593101, 0x05593601, 0x05593701, 0x05593801, 0x05595001, 0x05595D02, 0x05598D02,
+    0x0559A706, 0x055A0E01, 0x055A5701, 0x055A8301, 0x055A9801, 0x055ACF01, 0x055B5402, 0x055B6203, 0x055B7A01, 0x055B7B01, 0x055BA406, 0x055BA601,
+    0x055BA701, 0x055BA901, 0x055BC801, 0x055BD701, 0x055BD901, 0x055BE901, 0x055C0402, 0x055C0702, 0x055C4901, 0x055C5802, 0x055C6002, 0x055C6202,
+    0x055C6A02, 0x055C8A01, 0x055CDD01, 0x055CFE01, 0x055D2E01, 0x055D3D01, 0x055D4102, 0x055D6801, 0x055D7A01, 0x055D8001, 0x055D8301, 0x055D8802,
+    0x055D8F01, 0x055D9302, 0x055DD903, 0x055E5101, 0x055E8601, 0x055E8801, 0x055EE501, 0x055EE701, 0x055EEA02, 0x055EF102, 0x055F4301, 0x055F4604,
+    0x055F6304, 0x055F9004, 0x055FE701, 0x05600001, 0x05601602, 0x05603301, 0x05603C01, 0x05605801, 0x05607402, 0x05608001, 0x05608301, 0x05608801,
+    0x05608D01, 0x05609301, 0x0560A801, 0x0560AB02, 0x0560C002, 0x0560C302, 0x0560D001, 0x0560D201, 0x0560D901, 0x0560EB01, 0x05610804, 0x05613102,
+    0x05613202, 0x05622201, 0x05622E01, 0x05623601, 0x05626701, 0x05627D01, 0x05628B01, 0x0562A301, 0x0562B902, 0x0562E602, 0x05630601, 0x05630F01,
+    0x05632B02, 0x05632C02, 0x05633601, 0x05633A02, 0x05633C03, 0x05634C02, 0x05634E02, 0x05634F02, 0x05635002, 0x05636C06, 0x05637501, 0x05638F02,
+    0x05639F01, 0x0563E401, 0x05640501, 0x05642702, 0x05642E01, 0x05644401, 0x05645202, 0x05647C01, 0x0564AC01, 0x0564B801, 0x0564C102, 0x0564DE02,
+    0x0564DF02, 0x0564E402, 0x0564E502, 0x05650A02, 0x05651502, 0x05653002, 0x05654D01, 0x05655E01, 0x0565A702, 0x0565B802, 0x0565BC01, 0x0565C102,
+    0x0565D001, 0x0565DF02, 0x0565F102, 0x0565F801, 0x0565F901, 0x0565FC02, 0x05661001, 0x05661504, 0x05663801, 0x05663901, 0x05664F02, 0x05665F02,
+    0x05666C01, 0x05667F01, 0x05669002, 0x05669102, 0x05669202, 0x0566A101, 0x0566C601, 0x0566EA02, 0x0566EB01, 0x0566EE01, 0x0566F101, 0x0566F402,
+    0x05671301, 0x05672802, 0x05672E01, 0x05673B01, 0x05674A01, 0x05674C02, 0x05675202, 0x05677C01, 0x05678D03, 0x05679402, 0x05679D02, 0x0567A001,
+    0x0567CD02, 0x0567CF01, 0x0567D202, 0x0567F001, 0x0567F101, 0x0567F701, 0x05682502, 0x05682702, 0x05682802, 0x05682B02, 0x05682C03, 0x05686602,
+    0x05687402, 0x05687902, 0x05689D01, 0x0568B902, 0x0568BE01, 0x0568C101, 0x0568EC02, 0x0568ED02, 0x0568FC02, 0x05690801, 0x05690B02, 0x05692D01,
+    0x05693101, 0x05693202, 0x05693801, 0x05694F01, 0x05695203, 0x05699201, 0x0569C802, 0x0569E402, 0x0569FD02, 0x056A0202, 0x056A0402, 0x056A0902,
+    0x056A0B02, 0x056A0F06, 0x056A1B02, 0x056A1C02, 0x056A1D02, 0x056A1F02, 0x056A2106, 0x056A4D01, 0x056A4F02, 0x056A5002, 0x056A5102, 0x056A9401,
+    0x056ACE01, 0x056AD301, 0x056AD501, 0x056AD601, 0x056AD801, 0x056ADF01, 0x056AE101, 0x056AE301, 0x056AF201, 0x056B4101, 0x056B6501, 0x056BA101,
+    0x056BA301, 0x056BD101, 0x056BF901, 0x056C1E02, 0x056C3F01, 0x056C6B02, 0x056C8301, 0x056C9801, 0x056C9F01, 0x056CDC02, 0x056CEB01, 0x056CF401,
+    0x056CF501, 0x056CF702, 0x056CFD01, 0x056D0502, 0x056D0C02, 0x056D1E02, 0x056D2702, 0x056D2B02, 0x056D2E02, 0x056D3202, 0x056D4501, 0x056D5901,
+    0x056D6901, 0x056D6A01, 0x056D6F01, 0x056D7602, 0x056D7702, 0x056D7802, 0x056D7902, 0x056D7A02, 0x056D8602, 0x056D9102, 0x056DB801, 0x056DB901,
+    0x056DBC02, 0x056DC302, 0x056DCC01, 0x056E0B02, 0x056E1202, 0x056E1B02, 0x056E3403, 0x056E3603, 0x056E3902, 0x056E3A02, 0x056E4801, 0x056E4902,
+    0x056E4C02, 0x056E4D02, 0x056E5B01, 0x056E6002, 0x056E6502, 0x056E8801, 0x056E9B02, 0x056EAC01, 0x056EAF02, 0x056EB002, 0x056EB401, 0x056ECF02,
+    0x056ED201, 0x056EE603, 0x056EF402, 0x056EFE01, 0x056F3201, 0x056F3E01, 0x056F5501, 0x056F9601, 0x056FEF02, 0x056FF102, 0x056FFA01, 0x05700102,
+    0x05700406, 0x05700F02, 0x05701601, 0x05702101, 0x05704901, 0x05704F06, 0x05705001, 0x05707A04, 0x05709E02, 0x05709F01, 0x0570AE01, 0x0570B701,
+    0x0570C001, 0x0570F401, 0x0570F501, 0x05710C01, 0x05711904, 0x05716302, 0x05716D02, 0x05716F06, 0x0571A502, 0x0571A602, 0x0571AD02, 0x0571B606,
+    0x0571B702, 0x0571BA01, 0x0571C902, 0x0571CA02, 0x0571D002, 0x0571D301, 0x0571DA01, 0x0571EE01, 0x0571F401, 0x0571F601, 0x0571F901, 0x05722001,
+    0x05722201, 0x05722401, 0x05722801, 0x05725F02, 0x05726202, 0x05726B04, 0x05726F01, 0x05727002, 0x05727901, 0x05728302, 0x05728C01, 0x05729A02,
+    0x05729D02, 0x0572A602, 0x0572E701, 0x0572F901, 0x05731402, 0x05731C02, 0x05731D01, 0x05733202, 0x05735802, 0x05735906, 0x05735B02, 0x05735C06,
+    0x05735E02, 0x05737F02, 0x05738402, 0x05739202, 0x0573B402, 0x0573B602, 0x0573BC01, 0x0573BD01, 0x0573BE01, 0x0573BF01, 0x0573C001, 0x0573C101,
+    0x0573C201, 0x0573C301, 0x0573C401, 0x0573C501, 0x0573CA01, 0x0573D204, 0x0573D402, 0x05740102, 0x05740302, 0x05742101, 0x05742B02, 0x05746902,
+    0x05747702, 0x05747C02, 0x05748E02, 0x05749101, 0x0574BC02, 0x0574CE01, 0x0574D001, 0x0574E701, 0x0574FD02, 0x05750001, 0x05751202, 0x05754E01,
+    0x05755002, 0x05755306, 0x05757501, 0x05757601, 0x05757701, 0x05758802, 0x0575B601, 0x0575B801, 0x0575BD01, 0x0575BF01, 0x0575C001, 0x0575C101,
+    0x0575C201, 0x0575C701, 0x0575C901, 0x0575CB01, 0x0575CC01, 0x0575D001, 0x0575D201, 0x0575DD01, 0x0575DF01, 0x0575E801, 0x0575E901, 0x0575EE01,
+    0x0575F201, 0x0575FA01, 0x05760701, 0x05760C01, 0x05761D02, 0x05761E06, 0x05763901, 0x05766801, 0x05766901, 0x05766A01, 0x05766B01, 0x05771A01,
+    0x05773201, 0x05773501, 0x05773601, 0x05773701, 0x05775B01, 0x05776301, 0x05776A03, 0x05776D01, 0x05777C02, 0x0577E201, 0x0577F102, 0x05781801,
+    0x05782D01, 0x05783101, 0x05783201, 0x05783C01, 0x05787602, 0x05787802, 0x05787902, 0x05787A02, 0x05787B01, 0x05788002, 0x0578A002, 0x0578B701,
+    0x0578DE01, 0x05790202, 0x05794B02, 0x05794D03, 0x05794E02, 0x05794F02, 0x05795002, 0x05796702, 0x05797D01, 0x05798102, 0x05798502, 0x05799401,
+    0x0579B001, 0x0579B901, 0x0579BA01, 0x0579C301, 0x0579C701, 0x0579E601, 0x0579E901, 0x0579EA01, 0x0579EB01, 0x0579EC01, 0x057A1101, 0x057A3C01,
+    0x057A3D01, 0x057A6302, 0x057A8D02, 0x057AA506, 0x057AA602, 0x057AB202, 0x057ABC01, 0x057ABE02, 0x057ACB02, 0x057ACF01, 0x057AF001, 0x057AFC01,
+    0x057AFE01, 0x057BE602, 0x057BE706, 0x057C0202, 0x057C0404, 0x057C1602, 0x057C1702, 0x057C1B02, 0x057C1C02, 0x057C3102, 0x057C3701, 0x057C4B04,
+    0x057C5A01, 0x057C6502, 0x057C8D02, 0x057CA801, 0x057CC202, 0x057CEB01, 0x057CEC01, 0x057D5304, 0x057D5404, 0x057D5504, 0x057D6601, 0x057D6901,
+    0x057D6B01, 0x057D8302, 0x057D8A01, 0x057D9401, 0x057D9E01, 0x057D9F01, 0x057DBB01, 0x057E0B04, 0x057E4502, 0x057E4902, 0x057E4B02, 0x057E7601,
+    0x057E7E02, 0x057EA201, 0x057EAA01, 0x057EB702, 0x057EC402, 0x057ED001, 0x057ED401, 0x057ED601, 0x057EDF01, 0x057EE001, 0x057EEA01, 0x057EEE01,
+    0x057EEF01, 0x057F0202, 0x057F3101, 0x057F5A01, 0x057F7C02, 0x057FBC01, 0x057FD301, 0x057FE901, 0x05800401, 0x05800501, 0x05800E01, 0x05801101,
+    0x05801501, 0x05805001, 0x05805D02, 0x05805F02, 0x05806302, 0x05806402, 0x0580A901, 0x0580EF01, 0x0580F001, 0x0580FA01, 0x0580FC01, 0x05810301,
+    0x05816602, 0x05817702, 0x05817A02, 0x05817B02, 0x05817C02, 0x05817D03, 0x05817E02, 0x05818002, 0x0581AF01, 0x0581B102, 0x0581B302, 0x0581BF02,
+    0x0581C402, 0x0581FB02, 0x05820906, 0x05822302, 0x05822C01, 0x05823B01, 0x05824502, 0x05825901, 0x05826B01, 0x05827102, 0x05827803, 0x05827A03,
+    0x05827C03, 0x0582D702, 0x0582DA02, 0x0582EB02, 0x0582FD01, 0x05830B02, 0x05831506, 0x05833002, 0x05833102, 0x05833302, 0x05834401, 0x05834C01,
+    0x05835301, 0x05835602, 0x05835702, 0x05835901, 0x05835E01, 0x05836D01, 0x05839102, 0x0583FD02, 0x05841C06, 0x05842502, 0x05842F02, 0x05843901,
+    0x05847A01, 0x0584B402, 0x0584BB01, 0x0584BE01, 0x0584BF01, 0x0584C101, 0x0584ED02, 0x0584F002, 0x0584F902, 0x0584FC02, 0x05850901, 0x05853501,
+    0x05854601, 0x05857701, 0x05858301, 0x05858501, 0x0585AE01, 0x0585CC01, 0x05860F01, 0x05862302, 0x05862501, 0x05863902, 0x05864201, 0x05864301,
+    0x05867601, 0x05869701, 0x0586BA02, 0x0586C502, 0x0586F402, 0x05871E01, 0x05874301, 0x05874702, 0x05874F01, 0x05875E01, 0x05876401, 0x05877001,
+    0x05877101, 0x05877201, 0x05877A02, 0x05879401, 0x05879D01, 0x0587A401, 0x0587C501, 0x0587EF01, 0x0587F101, 0x0587F602, 0x0587F701, 0x0587FF01,
+    0x05880601, 0x05880901, 0x05881701, 0x05881A01, 0x05884204, 0x05885A01, 0x05887201, 0x05887301, 0x05888E02, 0x0588CB02, 0x0588D302, 0x0588D902,
+    0x0588E902, 0x05890501, 0x05891101, 0x05893201, 0x05895501, 0x05895E01, 0x05897A02, 0x05897D02, 0x05898001, 0x05899201, 0x0589D906, 0x0589DA01,
+    0x0589E402, 0x0589E701, 0x0589F602, 0x0589FC01, 0x058A0601, 0x058A2102, 0x058A4901, 0x058A5F01, 0x058A6101, 0x058A7102, 0x058A8601, 0x058A8702,
+    0x058A8802, 0x058A8902, 0x058A9801, 0x058A9A01, 0x058A9C01, 0x058A9E01, 0x058AE301, 0x058AF201, 0x058B5202, 0x058B7002, 0x058B8D03, 0x058B9501,
+    0x058B9801, 0x058BCC01, 0x058BD004, 0x058BE301, 0x058BE602, 0x058BEE02, 0x058BF402, 0x058BF602, 0x058C0E03, 0x058C1802, 0x058C3101, 0x058C3202,
+    0x058C3E01, 0x058C5802, 0x058C6201, 0x058C6701, 0x058C7801, 0x058C7D01, 0x058C7F01, 0x058C8802, 0x058C8901, 0x058C8B01, 0x058CAD01, 0x058CCB01,
+    0x058CE001, 0x058CE401, 0x058D0D04, 0x058D1A01, 0x058D2901, 0x058D3602, 0x058D7A02, 0x058D8601, 0x058D8C02, 0x058D9802, 0x058D9A01, 0x058D9B01,
+    0x058D9C02, 0x058D9D02, 0x058D9F02, 0x058DA502, 0x058DAD02, 0x058DB401, 0x058DB501, 0x058DB701, 0x058DB801, 0x058E1601, 0x058E1701, 0x058E1901,
+    0x058E2301, 0x058E2701, 0x058E2A01, 0x058E3101, 0x058E5D01, 0x058E8B01, 0x058E8D02, 0x058EA502, 0x058ECE02, 0x058EE504, 0x058EE604, 0x058EF102,
+    0x058F0201, 0x058F3602, 0x058F3702, 0x058F3801, 0x058F5302, 0x058F8C02, 0x058F9E02, 0x058FAF01, 0x05901101, 0x05901201, 0x05901501, 0x05903C01,
+    0x05907E01, 0x05908E02, 0x0590CE02, 0x0590CF02, 0x05913201, 0x05917802, 0x05919002, 0x0591A802, 0x0591AE01, 0x0591B901, 0x0591DF02, 0x0591EE01,
+    0x05921501, 0x05921701, 0x05921802, 0x05922902, 0x05926501, 0x05926601, 0x05927A01, 0x05927B01, 0x05928F02, 0x05929203, 0x05929B02, 0x0592A601,
+    0x0592A701, 0x0592A801, 0x0592B101, 0x0592C601, 0x0592D102, 0x0592D501, 0x0592E001, 0x0592FA01, 0x05931501, 0x05931C02, 0x05932502, 0x05932606,
+    0x05932B02, 0x05933002, 0x05933202, 0x05933C03, 0x0593A602, 0x05940702, 0x05941102, 0x05941601, 0x05944806, 0x0594B302, 0x0594BF02, 0x0594E901,
+    0x0594F402, 0x05950C02, 0x05953E01, 0x05954101, 0x05956D02, 0x05957102, 0x0595CC01, 0x0595E801, 0x05960402, 0x05960D01, 0x05960E01, 0x05960F01,
+    0x05961001, 0x05964B02, 0x05964D02, 0x05965D02, 0x05966302, 0x05966801, 0x05968E02, 0x05969801, 0x0596BC01, 0x0596E701, 0x0596F302, 0x0596F502,
+    0x0596FA02, 0x05970601, 0x05974501, 0x05974601, 0x05974801, 0x05974A01, 0x05975601, 0x05975F01, 0x05976101, 0x05979401, 0x05979902, 0x0597BA02,
+    0x0597BC02, 0x0597F301, 0x05982B01, 0x05983602, 0x05985A01, 0x05987702, 0x05988E02, 0x05989C02, 0x0598AE01, 0x0598BE01, 0x0598C901, 0x0598D601,
+    0x0598D701, 0x0598D801, 0x0598D901, 0x0598E501, 0x05991D02, 0x05992B02, 0x05992D01, 0x05995301, 0x05995501, 0x05996302, 0x05997B06, 0x059A5D01,
+    0x059A5E01, 0x059A6001, 0x059A7E02, 0x059A7F02, 0x059AE201, 0x059AE902, 0x059AEC02, 0x059AF201, 0x059AFA01, 0x059B0402, 0x059B1B02, 0x059B1C02,
+    0x059B1F02, 0x059B2002, 0x059B2502, 0x059B2702, 0x059B6502, 0x059BE001, 0x059C0E01, 0x059C3F02, 0x059C4002, 0x059C9F01, 0x059CAB01, 0x059CCB06,
+    0x059CD702, 0x059D2502, 0x059D5C01, 0x059D5D01, 0x059D6B02, 0x059D6C02, 0x059D7C02, 0x059D8F01, 0x059D9101, 0x059DCA01, 0x059DD101, 0x059E2B01,
+    0x059E3201, 0x059E9302, 0x059E9401, 0x059EA102, 0x059EC101, 0x059EEC02, 0x059F0701, 0x059F1A01, 0x059F1C02, 0x059F1F02, 0x059F2D02, 0x059F2E02,
+    0x059F3006, 0x059F3302, 0x059F4202, 0x059F6E01, 0x059F9D01, 0x059F9F01, 0x059FA201, 0x059FA301, 0x059FA501, 0x059FA601, 0x059FA801, 0x059FA901,
+    0x059FC401, 0x059FC702, 0x059FC801, 0x059FCF01, 0x059FD001, 0x059FD101, 0x059FDC01, 0x059FDD01, 0x059FE401, 0x05A01401, 0x05A05C01, 0x05A05E01,
+    0x05A08602, 0x05A0C201, 0x05A0C602, 0x05A0C902, 0x05A0CF02, 0x05A0D601, 0x05A0D701, 0x05A0D801, 0x05A0D901, 0x05A0FB01, 0x05A10401, 0x05A13601,
+    0x05A13B01, 0x05A14A02, 0x05A19E02, 0x05A1C102, 0x05A1C202, 0x05A1C302, 0x05A1D201, 0x05A1D401, 0x05A1E501, 0x05A1E802, 0x05A20D02, 0x05A23701,
+    0x05A25201, 0x05A26F01, 0x05A27B01, 0x05A28101, 0x05A28A01, 0x05A29102, 0x05A29302, 0x05A2B102, 0x05A2DC02, 0x05A2DE06, 0x05A2DF02, 0x05A2F604,
+    0x05A30501, 0x05A30804, 0x05A33302, 0x05A33402, 0x05A33502, 0x05A35201, 0x05A35302, 0x05A35F02, 0x05A3A001, 0x05A44502, 0x05A47401, 0x05A49001,
+    0x05A49B02, 0x05A4B501, 0x05A4B602, 0x05A4F402, 0x05A4F502, 0x05A4F902, 0x05A51302, 0x05A53202, 0x05A53801, 0x05A54602, 0x05A55A01, 0x05A59804,
+    0x05A5C401, 0x05A5E001, 0x05A6C306, 0x05A6D402, 0x05A6E902, 0x05A6EC02, 0x05A71406, 0x05A71602, 0x05A71702, 0x05A72A02, 0x05A72D01, 0x05A73D01,
+    0x05A74F01, 0x05A76902, 0x05A77902, 0x05A7AF01, 0x05A7E902, 0x05A7EA02, 0x05A7EB02, 0x05A85D02, 0x05A85F02, 0x05A86701, 0x05A88001, 0x05A88202,
+    0x05A88302, 0x05A88502, 0x05A88A01, 0x05A89502, 0x05A89702, 0x05A89802, 0x05A89B02, 0x05A89C02, 0x05A89D02, 0x05A8AD02, 0x05A8AE02, 0x05A8B302,
+    0x05A8BA01, 0x05A8C602, 0x05A8C702, 0x05A8C802, 0x05A8C902, 0x05A8D102, 0x05A8D202, 0x05A8D502, 0x05A91002, 0x05A91202, 0x05A91606, 0x05A91902,
+    0x05A91B01, 0x05A92803, 0x05A93402, 0x05A94401, 0x05A94802, 0x05A94D01, 0x05A95802, 0x05A95A02, 0x05A95E02, 0x05A95F01, 0x05A96A01, 0x05A96B01,
+    0x05A97D01, 0x05A97E01, 0x05A9C302, 0x05A9D301, 0x05AA2401, 0x05AA3902, 0x05AA3A02, 0x05AA4602, 0x05AA4C02, 0x05AAE202, 0x05AAF103, 0x05AAF502,
+    0x05AB0301, 0x05AB5201, 0x05AB5501, 0x05AB5A01, 0x05AB5B01, 0x05AB9A01, 0x05ABA901, 0x05ABB201, 0x05AC3704, 0x05AC4A04, 0x05AC5B02, 0x05AC5E02,
+    0x05AC5F02, 0x05AC6802, 0x05AC6902, 0x05AC7802, 0x05AC7E02, 0x05AC8A01, 0x05AC9F02, 0x05ACA502, 0x05ACA703, 0x05ACC102, 0x05ACEF04, 0x05AD0901,
+    0x05AD0B01, 0x05AD0D01, 0x05AD0E02, 0x05AD1801, 0x05AD1901, 0x05AD1C04, 0x05AD2E01, 0x05AD5002, 0x05AD7D01, 0x05AD9202, 0x05AD9302, 0x05ADBE01,
+    0x05ADC701, 0x05ADD201, 0x05ADF001, 0x05AE0902, 0x05AE0A02, 0x05AE1502, 0x05AE5302, 0x05AE5502, 0x05AE7301, 0x05AE7902, 0x05AE7E02, 0x05AE8202,
+    0x05AE8602, 0x05AE9202, 0x05AEEB01, 0x05AEF502, 0x05AEF602, 0x05AF1902, 0x05AF2F02, 0x05AF5302, 0x05AF5702, 0x05AF5B02, 0x05AF6601, 0x05AF6F02,
+    0x05AF7702, 0x05AF7A02, 0x05AF8802, 0x05AF8902, 0x05AF8C01, 0x05AF9E01, 0x05AFAC01, 0x05AFDE01, 0x05AFE001, 0x05AFF801, 0x05B00301, 0x05B01802,
+    0x05B01902, 0x05B03002, 0x05B03302, 0x05B03702, 0x05B05801, 0x05B06302, 0x05B06602, 0x05B06802, 0x05B06D02, 0x05B06F02, 0x05B0E902, 0x05B0EC02,
+    0x05B0ED01, 0x05B0F702, 0x05B10201, 0x05B10B02, 0x05B12B02, 0x05B12C01, 0x05B12E02, 0x05B13102, 0x05B13902, 0x05B13A02, 0x05B13C02, 0x05B13E02,
+    0x05B14102, 0x05B14202, 0x05B14601, 0x05B14902, 0x05B18201, 0x05B18902, 0x05B18A06, 0x05B19402, 0x05B19502, 0x05B1BA06, 0x05B1C402, 0x05B1DA02,
+    0x05B1E102, 0x05B1E502, 0x05B1E702, 0x05B1ED02, 0x05B1F002, 0x05B1FD02, 0x05B21302, 0x05B21403, 0x05B21602, 0x05B21902, 0x05B21F06, 0x05B22002,
+    0x05B23806, 0x05B23B03, 0x05B23E02, 0x05B26A03, 0x05B28A02, 0x05B28B06, 0x05B28F01, 0x05B29603, 0x05B2A401, 0x05B2B306, 0x05B2C001, 0x05B2C102,
+    0x05B2C206, 0x05B2D803, 0x05B2E902, 0x05B30A02, 0x05B31301, 0x05B35901, 0x05B3AA01, 0x05B3BE01, 0x05B3C001, 0x05B3C101, 0x05B3D601, 0x05B3D701,
+    0x05B3F704, 0x05B40604, 0x05B43001, 0x05B44A02, 0x05B44B02, 0x05B45701, 0x05B45801, 0x05B45901, 0x05B45C04, 0x05B46E01, 0x05B4A101, 0x05B4AE02,
+    0x05B4F903, 0x05B50801, 0x05B50901, 0x05B53E01, 0x05B58A01, 0x05B5CE01, 0x05B5D302, 0x05B5D502, 0x05B5D701, 0x05B5E501, 0x05B5EB02, 0x05B60E02,
+    0x05B61201, 0x05B61501, 0x05B61E01, 0x05B64A02, 0x05B64C02, 0x05B64D02, 0x05B65602, 0x05B66302, 0x05B66901, 0x05B67102, 0x05B68501, 0x05B68703,
+    0x05B6A301, 0x05B6C001, 0x05B6D901, 0x05B6DC01, 0x05B71D02, 0x05B74E02, 0x05B75801, 0x05B76901, 0x05B78301, 0x05B7C601, 0x05B7D704, 0x05B7EB01,
+    0x05B7F802, 0x05B81B01, 0x05B83B01, 0x05B83F01, 0x05B85001, 0x05B86101, 0x05B88401, 0x05B88501, 0x05B88601, 0x05B88F01, 0x05B8B802, 0x05B8C401,
+    0x05B8CF01, 0x05B8DE01, 0x05B90901, 0x05B92F02, 0x05B9A401, 0x05B9BA02, 0x05B9BD02, 0x05B9BE02, 0x05B9C202, 0x05B9C602, 0x05B9C802, 0x05B9D402,
+    0x05B9D502, 0x05B9D602, 0x05B9D702, 0x05B9D802, 0x05B9D902, 0x05B9DA02, 0x05BA6E02, 0x05BA9302, 0x05BAAF01, 0x05BABB01, 0x05BAC101, 0x05BAD302,
+    0x05BAD402, 0x05BAD602, 0x05BADD02, 0x05BAE002, 0x05BAE802, 0x05BAF602, 0x05BAF802, 0x05BB0202, 0x05BB0402, 0x05BB0902, 0x05BB1001, 0x05BB1602,
+    0x05BB1902, 0x05BB1F02, 0x05BB4202, 0x05BBA902, 0x05BBAA02, 0x05BBAD02, 0x05BBC801, 0x05BBCD02, 0x05BBE102, 0x05BBE702, 0x05BBF201, 0x05BBF402,
+    0x05BBF502, 0x05BBF902, 0x05BBFA02, 0x05BC1E01, 0x05BC2001, 0x05BC2101, 0x05BC4C06, 0x05BC5002, 0x05BC5506, 0x05BC5D06, 0x05BC6102, 0x05BC6301,
+    0x05BC6401, 0x05BC6501, 0x05BC6806, 0x05BC7201, 0x05BC7801, 0x05BC7B01, 0x05BC8002, 0x05BC8206, 0x05BC8302, 0x05BC9402, 0x05BC9902, 0x05BC9A02,
+    0x05BC9B06, 0x05BC9C02, 0x05BC9F01, 0x05BCA101, 0x05BCA201, 0x05BCA502, 0x05BCB006, 0x05BCBA02, 0x05BCDB01, 0x05BCE402, 0x05BCE502, 0x05BCE602,
+    0x05BCE706, 0x05BCED02, 0x05BCEF02, 0x05BCF002, 0x05BCF401, 0x05BCF702, 0x05BD1006, 0x05BD1102, 0x05BD1302, 0x05BD1402, 0x05BD1502, 0x05BD1602,
+    0x05BD2706, 0x05BD4A02, 0x05BD5602, 0x05BD5C02, 0x05BD6402, 0x05BD6602, 0x05BD7302, 0x05BD7702, 0x05BD8C02, 0x05BD8F02, 0x05BD9202, 0x05BDAC02,
+    0x05BDAD02, 0x05BDAF02, 0x05BDB002, 0x05BDB602, 0x05BDB702, 0x05BDDE02, 0x05BE0501, 0x05BE0D01, 0x05BE7602, 0x05BFB001, 0x05BFD402, 0x05BFE602,
+    0x05BFEA02, 0x05C00002, 0x05C01202, 0x05C02702, 0x05C02802, 0x05C03102, 0x05C03802, 0x05C03902, 0x05C03A02, 0x05C03B06, 0x05C04301, 0x05C04B02,
+    0x05C05206, 0x05C05306, 0x05C06202, 0x05C06801, 0x05C08801, 0x05C0A402, 0x05C0B802, 0x05C0BE01, 0x05C0C801, 0x05C0CD01, 0x05C0CF01, 0x05C0D302,
+    0x05C0D802, 0x05C0DD02, 0x05C0E902, 0x05C0EA02, 0x05C0FA02, 0x05C0FB02, 0x05C0FE02, 0x05C10002, 0x05C10301, 0x05C10601, 0x05C10802, 0x05C10B02,
+    0x05C10C02, 0x05C10E02, 0x05C14301, 0x05C15401, 0x05C17A02, 0x05C19B02, 0x05C19D06, 0x05C1A202, 0x05C1A502, 0x05C20B02, 0x05C20D02, 0x05C20F02,
+    0x05C26002, 0x05C26502, 0x05C2A502, 0x05C2AA02, 0x05C2C102, 0x05C2C402, 0x05C2C601, 0x05C2C702, 0x05C2E402, 0x05C2E902, 0x05C2EC02, 0x05C2F102,
+    0x05C2F302, 0x05C2F602, 0x05C2F802, 0x05C31D02, 0x05C32101, 0x05C32806, 0x05C32A06, 0x05C33702, 0x05C34702, 0x05C3B401, 0x05C3BE03, 0x05C3E101,
+    0x05C42601, 0x05C43902, 0x05C49102, 0x05C49202, 0x05C49402, 0x05C49702, 0x05C49A02, 0x05C4A006, 0x05C4A702, 0x05C4C601, 0x05C4CE01, 0x05C4E102,
+    0x05C4E801, 0x05C4ED01, 0x05C4F902, 0x05C55402, 0x05C55D02, 0x05C55F02, 0x05C56102, 0x05C56202, 0x05C56401, 0x05C56503, 0x05C56702, 0x05C56B01,
+    0x05C58402, 0x05C5AD02, 0x05C5AE06, 0x05C5AF01, 0x05C5CF01, 0x05C62502, 0x05C62C02, 0x05C64402, 0x05C64502, 0x05C64602, 0x05C64902, 0x05C64C02,
+    0x05C66002, 0x05C6E504, 0x05C76E01, 0x05C77402, 0x05C77D02, 0x05C78402, 0x05C78802, 0x05C79102, 0x05C79202, 0x05C79302, 0x05C79402, 0x05C79502,
+    0x05C79602, 0x05C7B702, 0x05C7BD02, 0x05C7DA01, 0x05C7E102, 0x05C80002, 0x05C81902, 0x05C82702, 0x05C82A02, 0x05C82F01, 0x05C84D06, 0x05C88902,
+    0x05C88C01, 0x05C89506, 0x05C8A302, 0x05C8A902, 0x05D13B01, 0x05D16C04, 0x05D20B02, 0x05D21601, 0x05D22A01, 0x05D26602, 0x05D26702, 0x05D2B302,
+    0x05D2B402, 0x05D2B502, 0x05D2B602, 0x05D2B802, 0x05D2BA02, 0x05D2BB02, 0x05D2BC02, 0x05D2BE02, 0x05D2BF02, 0x05D2C002, 0x05D2C202, 0x05D2C502,
+    0x05D2C802, 0x05D2E002, 0x05D2E502, 0x05D2E801, 0x05D2E902, 0x05D31D06, 0x05D32402, 0x05D32D02, 0x05D33202, 0x05D33402, 0x05D33502, 0x05D33602,
+    0x05D33702, 0x05D33802, 0x05D33902, 0x05D33A02, 0x05D33C02, 0x05D33D02, 0x05D33E02, 0x05D34D02, 0x05D36502, 0x05D36602, 0x05D36702, 0x05D36802,
+    0x05D36902, 0x05D36A02, 0x05D38C02, 0x05D39502, 0x05D39602, 0x05D3A901, 0x05D3B502, 0x05D3B602, 0x05D3BD02, 0x05D3E102, 0x05D3E202, 0x05D3E302,
+    0x05D42102, 0x05D42402, 0x05D42502, 0x05D42602, 0x05D43301, 0x05D43901, 0x05D44102, 0x05D44802, 0x05D45202, 0x05D45902, 0x05D45F02, 0x05D49702,
+    0x05D49A02, 0x05D49D02, 0x05D4A001, 0x05D4AA02, 0x05D4BE01, 0x05D51E02, 0x05D52502, 0x05D53402, 0x05D54001, 0x05D54302, 0x05D55202, 0x05D56602,
+    0x05D56703, 0x05D5CD02, 0x05D5D201, 0x05D5ED06, 0x05D60001, 0x05D61402, 0x05D62802, 0x05D62902, 0x05D62A02, 0x05D62B02, 0x05D62F02, 0x05D63102,
+    0x05D63202, 0x05D63C02, 0x05D63D02, 0x05D64002, 0x05D65701, 0x05D67E06, 0x05D69602, 0x05D6A401, 0x05D6A601, 0x05D6E002, 0x05D6FF03, 0x05D71602,
+    0x05D71A02, 0x05D74A02, 0x05D74C06, 0x05D75801, 0x05D7A701, 0x05D7ED01, 0x05D81601, 0x05D81D02, 0x05D82502, 0x05D82602, 0x05D82702, 0x05D85506,
+    0x05D88001, 0x05D89102, 0x05D8A002, 0x05D8AE02, 0x05D8B102, 0x05D8BA02, 0x05D8D102, 0x05D8E802, 0x05D8F201, 0x05D8FB01, 0x05D90302, 0x05D91701,
+    0x05D92502, 0x05D93102, 0x05D93302, 0x05D93801, 0x05D93A02, 0x05D93C02, 0x05D94501, 0x05D94603, 0x05D94903, 0x05D95006, 0x05D95106, 0x05D95302,
+    0x05D96006, 0x05D96402, 0x05D96C02, 0x05D96F02, 0x05D97002, 0x05D97102, 0x05D97202, 0x05D97703, 0x05D97C02, 0x05D98001, 0x05D99201, 0x05D9A402,
+    0x05D9A701, 0x05D9AC02, 0x05D9AD02, 0x05D9B202, 0x05D9B606, 0x05D9C302, 0x05D9ED06, 0x05D9F402, 0x05D9F706, 0x05D9FD02, 0x05D9FE02, 0x05DA7802,
+    0x05DA7A02, 0x05DA7E02, 0x05DA8202, 0x05DA9502, 0x05DAA002, 0x05DAA503, 0x05DAA903, 0x05DAAA03, 0x05DAC601, 0x05DAD501, 0x05DADA07, 0x05DAFB02,
+    0x05DB0602, 0x05DB0D02, 0x05DB1201, 0x05DB2702, 0x05DB4202, 0x05DB4302, 0x05DB7D02, 0x05DB7E02, 0x05DB9902, 0x05DB9A02, 0x05DBAB06, 0x05DBB106,
+    0x05DBC801, 0x05DBDE01, 0x05DBE202, 0x05DBF706, 0x05DBFA02, 0x05DBFB02, 0x05DBFD02, 0x05DC1201, 0x05DC2B02, 0x05DC3801, 0x05DC4502, 0x05DC4E01,
+    0x05DC5903, 0x05DC5A06, 0x05DC6402, 0x05DC6602, 0x05DC6E03, 0x05DC9E01, 0x05DD0401, 0x05DD1001, 0x05DD1502, 0x05DD1802, 0x05DD3E06, 0x05DD6006,
+    0x05DD6A01, 0x05DD8706, 0x05DDAD01, 0x05DDB101, 0x05DDC101, 0x05DDD801, 0x05DE2D01, 0x05DE3A01, 0x05DE5901, 0x05DE7706, 0x05DE9402, 0x05DE9B02,
+    0x05DEA502, 0x05DEAD03, 0x05DEAF02, 0x05DEB102, 0x05DEB302, 0x05DEF802, 0x05DEFE02, 0x05DEFF02, 0x05DF2A01, 0x05DF2F02, 0x05DF5001, 0x05DF5E02,
+    0x05DF5F02, 0x05DF6002, 0x05DF7D01, 0x05DF7F01, 0x05DF8201, 0x05DF8601, 0x05DF8701, 0x05DFC503, 0x05DFD502, 0x05DFDA02, 0x05DFE501, 0x05E02302,
+    0x05E02406, 0x05E02506, 0x05E02606, 0x05E02D01, 0x05E03A02, 0x05E04301, 0x05E04501, 0x05E04B06, 0x05E05701, 0x05E06301, 0x05E06502, 0x05E06902,
+    0x05E06F01, 0x05E07D02, 0x05E07F01, 0x05E08901, 0x05E09603, 0x05E0CC06, 0x05E0D106, 0x05E0D206, 0x05E11701, 0x05E14402, 0x05E14802, 0x05E14902,
+    0x05E14A06, 0x05E15801, 0x05E16102, 0x05E16F02, 0x05E17B01, 0x05E17C01, 0x05E18002, 0x05E19006, 0x05E1B802, 0x05E1EA02, 0x05E20401, 0x05E25006,
+    0x05E25B06, 0x05E26603, 0x05E26E02, 0x05E27B01, 0x05E27C01, 0x05E27E01, 0x05E28201, 0x05E28301, 0x05E28401, 0x05E28501, 0x05E28601, 0x05E28701,
+    0x05E28801, 0x05E28A01, 0x05E28B01, 0x05E28C01, 0x05E28D01, 0x05E28E01, 0x05E28F01, 0x05E29001, 0x05E29201, 0x05E29301, 0x05E29401, 0x05E29501,
+    0x05E29601, 0x05E29701, 0x05E29801, 0x05E29901, 0x05E29A01, 0x05E2A002, 0x05E2A404, 0x05E2BA02, 0x05E2BB06, 0x05E2BF02, 0x05E2CC01, 0x05E2D302,
+    0x05E2D802, 0x05E2DA02, 0x05E30101, 0x05E30203, 0x05E30A03, 0x05E30E03, 0x05E31806, 0x05E32B02, 0x05E33202, 0x05E33802, 0x05E34F02, 0x05E36207,
+    0x05E36906, 0x05E37302, 0x05E37501, 0x05E37A01, 0x05E38501, 0x05E38801, 0x05E39C02, 0x05E39D02, 0x05E39F02, 0x05E3A002, 0x05E3A102, 0x05E3A206,
+    0x05E3A802, 0x05E3BD01, 0x05E3D001, 0x05E3DD06, 0x05E3DE02, 0x05E3ED02, 0x05E3F202, 0x05E40102, 0x05E41702, 0x05E41902, 0x05E42103, 0x05E44801,
+    0x05E47502, 0x05E49901, 0x05E4BB02, 0x05E4BD02, 0x05E4CB02, 0x05E4D906, 0x05E4DE02, 0x05E4E002, 0x05E4E203, 0x05E4E303, 0x05E4E402, 0x05E4EB02,
+    0x05E4EE02, 0x05E50502, 0x05E51302, 0x05E52002, 0x05E52602, 0x05E52802, 0x05E52C02, 0x05E53102, 0x05E53502, 0x05E54602, 0x05E55A02, 0x05E55D03,
+    0x05E55F02, 0x05E56106, 0x05E56206, 0x05E56502, 0x05E59006, 0x05E5C501, 0x05E5D301, 0x05E5D401, 0x05E5EC02, 0x05E5EE02, 0x05E5F906, 0x05E61301,
+    0x05E61501, 0x05E62101, 0x05E62201, 0x05E62301, 0x05E62401, 0x05E62501, 0x05E62601, 0x05E62901, 0x05E63106, 0x05E63603, 0x05E63C02, 0x05E63D03,
+    0x05E64802, 0x05E65D02, 0x05E66302, 0x05E68B06, 0x05E68E02, 0x05E6BA01, 0x05E6C806, 0x05E6D202, 0x05E6EF01, 0x05E70702, 0x05E71102, 0x05E72A02,
+    0x05E72D02, 0x05E73002, 0x05E73402, 0x05E73602, 0x05E73B02, 0x05E75F06, 0x05E77302, 0x05E78702, 0x05E78F03, 0x05E7B502, 0x05E7BA01, 0x05E7BC01,
+    0x05E82402, 0x05E82502, 0x05E82602, 0x05E82903, 0x05E82E01, 0x05E84001, 0x05E85802, 0x05E85902, 0x05E85A06, 0x05E86202, 0x05E86606, 0x05E86B02,
+    0x05E88007, 0x05E88A01, 0x05E8B602, 0x05E8B802, 0x05E8CE02, 0x05E90D02, 0x05E91002, 0x05E91602, 0x05E91F01, 0x05E95701, 0x05E99702, 0x05E9AE03,
+    0x05E9DB06, 0x05E9F601, 0x05EA0602, 0x05EA1002, 0x05EA1102, 0x05EA1202, 0x05EA1302, 0x05EA1402, 0x05EA1502, 0x05EA2506, 0x05EA3A02, 0x05EA6E01,
+    0x05EA7701, 0x05EA9201, 0x05EAB102, 0x05EAB201, 0x05EAB302, 0x05EAC502, 0x05EACB02, 0x05EB0602, 0x05EB0702, 0x05EB2801, 0x05EB2E01, 0x05EB5801,
+    0x05EB8802, 0x05EB8B02, 0x05EB8F02, 0x05EB9002, 0x05EB9106, 0x05EB9202, 0x05EB9A01, 0x05EB9F02, 0x05EBA301, 0x05EBA801, 0x05EBA903, 0x05EBAC02,
+    0x05EBB803, 0x05EBB902, 0x05EBC303, 0x05EBC602, 0x05EBC702, 0x05EBCA02, 0x05EBCD02, 0x05EBD002, 0x05EBD102, 0x05EBD802, 0x05EBD902, 0x05EBDF01,
+    0x05EBE302, 0x05EBE402, 0x05EBE606, 0x05EBF305, 0x05EC0A02, 0x05EC0B02, 0x05EC0C02, 0x05EC0D02, 0x05EC0E02, 0x05EC0F02, 0x05EC1102, 0x05EC1202,
+    0x05EC1402, 0x05EC1602, 0x05EC4401, 0x05EC4E01, 0x05EC5B01, 0x05EC5E01, 0x05EC6102, 0x05EC6906, 0x05EC6B02, 0x05EC6F06, 0x05EC7702, 0x05ECF701,
+    0x05ED1304, 0x05ED1E04, 0x05ED7102, 0x05ED8003, 0x05ED9501, 0x05ED9A01, 0x05EDA201, 0x05EDBB02, 0x05EDC402, 0x05EDDB01, 0x05EDEC01, 0x05EDF601,
+    0x05EDF701, 0x05EDF801, 0x05EDFA01, 0x05EE0106, 0x05EE0702, 0x05EE3502, 0x05EE3702, 0x05EE3C02, 0x05EE4E02, 0x05EE5D02, 0x05EE7104, 0x05EEB201,
+    0x05EEB401, 0x05EEC801, 0x05EEED04, 0x05EF0306, 0x05EF0401, 0x05EF6D02, 0x05EF8501, 0x05EF8F01, 0x05EF9301, 0x05EF9B02, 0x05EFA702, 0x05EFB101,
+    0x05EFB501, 0x05EFD002, 0x05EFE302, 0x05EFE804, 0x05EFEA04, 0x05EFF501, 0x05EFF601, 0x05F06402, 0x05F09D06, 0x05F0BA02, 0x05F0CD03, 0x05F0D002,
+    0x05F0F702, 0x05F0FC03, 0x05F13801, 0x05F14501, 0x05F14803, 0x05F16401, 0x05F1A302, 0x05F1A506, 0x05F1C602, 0x05F1C702, 0x05F1C902, 0x05F1CA02,
+    0x05F1CB02, 0x05F1FF02, 0x05F23102, 0x05F23402, 0x05F23502, 0x05F23802, 0x05F23F02, 0x05F24002, 0x05F25102, 0x05F25202, 0x05F25302, 0x05F25A02,
+    0x05F25C02, 0x05F26102, 0x05F26402, 0x05F27402, 0x05F28302, 0x05F28E02, 0x05F29502, 0x05F29702, 0x05F29D02, 0x05F2A202, 0x05F2A702, 0x05F2AF02,
+    0x05F2B102, 0x05F2B202, 0x05F2B502, 0x05F2B702, 0x05F2BF02, 0x05F2C402, 0x05F2C702, 0x05F2CA01, 0x05F2CC01, 0x05F2D201, 0x05F2D702, 0x05F2E202,
+    0x05F2E406, 0x05F2F401, 0x05F2F802, 0x05F2F903, 0x05F30202, 0x05F33602, 0x05F33702, 0x05F34602, 0x05F35802, 0x05F35B01, 0x05F36102, 0x05F36D02,
+    0x05F3D102, 0x05F3D902, 0x05F3DA01, 0x05F3DB01, 0x05F3DC01, 0x05F3DD01, 0x05F3DE01, 0x05F3F906, 0x05F3FB02, 0x05F3FE02, 0x05F40102, 0x05F40402,
+    0x05F40B02, 0x05F41302, 0x05F41B02, 0x05F42503, 0x05F43002, 0x05F43302, 0x05F43402, 0x05F43503, 0x05F43901, 0x05F44402, 0x05F44502, 0x05F44C06,
+    0x05F45806, 0x05F45E01, 0x05F45F02, 0x05F46F06, 0x05F47201, 0x05F47501, 0x05F47702, 0x05F47C02, 0x05F47F03, 0x05F48402, 0x05F48702, 0x05F48F03,
+    0x05F4B601, 0x05F4DA02, 0x05F4EA02, 0x05F4F202, 0x05F4F504, 0x05F50E02, 0x05F51D01, 0x05F53D01, 0x05F55402, 0x05F57402, 0x05F5D402, 0x05F5D606,
+    0x05F5DA02, 0x05F60502, 0x05F63A02, 0x05F69802, 0x05F6BC02, 0x05F6BD06, 0x05F6EB01, 0x05F70201, 0x05F73406, 0x05F73B02, 0x05F73C02, 0x05F74202,
+    0x05F74502, 0x05F74B01, 0x05F76D01, 0x05F78E02, 0x05F79206, 0x05F7A602, 0x05F7BE02, 0x05F7C002, 0x05F7C502, 0x05F7C602, 0x05F7D302, 0x05F7E403,
+    0x05F7E602, 0x05F7F202, 0x05F7F402, 0x05F7F706, 0x05F7F802, 0x05F80302, 0x05F80602, 0x05F81202, 0x05F81702, 0x05F82501, 0x05F82802, 0x05F82F02,
+    0x05F85401, 0x05F85501, 0x05F85D01, 0x05F86501, 0x05F86A01, 0x05F86B02, 0x05F87602, 0x05F88D02, 0x05F89603, 0x05F89801, 0x05F89903, 0x05F8A301,
+    0x05F8B302, 0x05F8B901, 0x05F8BC02, 0x05F8C902, 0x05F8CB03, 0x05F8CE06, 0x05F8D206, 0x05F8DD01, 0x05F8E806, 0x05F8EB02, 0x05F8F102, 0x05F8FB01,
+    0x05F90001, 0x05F91601, 0x05F91A02, 0x05F91E01, 0x05F95D02, 0x05F95F02, 0x05F96702, 0x05F97B02, 0x05F98E02, 0x05F99002, 0x05F9B001, 0x05F9C602,
+    0x05F9CF02, 0x05FA0302, 0x05FA0802, 0x05FA1E06, 0x05FA6A02, 0x05FAC302, 0x05FAD002, 0x05FAD102, 0x05FAD302, 0x05FB2A02, 0x05FB6604, 0x05FB7A06,
+    0x05FB7C02, 0x05FB7D02, 0x05FBB501, 0x05FBBC02, 0x05FBBF01, 0x05FBD202, 0x05FBD302, 0x05FBD501, 0x05FBE002, 0x05FBE601, 0x05FBEB01, 0x05FC2A01,
+    0x05FC3F03, 0x05FC4401, 0x05FC4702, 0x05FC4802, 0x05FC4C02, 0x05FCAB01, 0x05FCB702, 0x05FCC002, 0x05FCC202, 0x05FCC302, 0x05FCC402, 0x05FCD102,
+    0x05FCD302, 0x05FCD502, 0x05FCE101, 0x05FD2702, 0x05FD2A02, 0x05FD4001, 0x05FD4B02, 0x05FD5902, 0x05FD7602, 0x05FDAE02, 0x05FE1801, 0x05FE3001,
+    0x05FE4A02, 0x05FE5602, 0x05FE5802, 0x05FEB502, 0x05FEB601, 0x05FEC701, 0x05FECB02, 0x05FEE002, 0x05FEEA02, 0x05FEFC03, 0x05FEFF06, 0x05FF0602,
+    0x05FF0F01, 0x05FF1702, 0x05FF1E02, 0x05FF2402, 0x05FF3602, 0x05FF4302, 0x05FF4502, 0x05FF4602, 0x05FF4B06, 0x05FF5002, 0x05FF5702, 0x05FF5802,
+    0x05FF5902, 0x05FF5A02, 0x05FF5E06, 0x05FF5F06, 0x05FF6006, 0x05FF9402, 0x05FF9A02, 0x06003702, 0x06004901, 0x06005101, 0x06005E01, 0x06005F01,
+    0x06007F01, 0x06008801, 0x0600D701, 0x0600F601, 0x0600FB01, 0x06010802, 0x06012002, 0x06012102, 0x06012202, 0x06012801, 0x06012A03, 0x06012B02,
+    0x06012C02, 0x06013901, 0x06015A01, 0x06015E04, 0x06016002, 0x06016601, 0x06016C02, 0x06018B02, 0x06019202, 0x0601BB02, 0x0601C402, 0x0601E602,
+    0x0601E702, 0x0601EA02, 0x06022B02, 0x06022E02, 0x06023102, 0x06023A02, 0x06024301, 0x06024803, 0x06025B01, 0x06025E02, 0x06026A06, 0x06026E01,
+    0x06029702, 0x0602A702, 0x0602AB02, 0x0602CB02, 0x0602D702, 0x0602DF02, 0x0602E002, 0x0602EE02, 0x0602EF02, 0x0602F002, 0x0602F102, 0x0602F202,
+    0x0602F303, 0x0602F402, 0x06032503, 0x06032702, 0x06032A06, 0x06032D02, 0x06032F06, 0x06033402, 0x06033E06, 0x06033F06, 0x06034D03, 0x06034E06,
+    0x06034F02, 0x06036F02, 0x06037502, 0x06037A02, 0x06037F06, 0x06038002, 0x0603BD02, 0x0603FB02, 0x0603FD02, 0x0603FE06, 0x06040302, 0x06040402,
+    0x06040606, 0x06040D02, 0x06040E02, 0x06041202, 0x06042001, 0x06043A02, 0x06044202, 0x06044802, 0x06044902, 0x06045002, 0x06045102, 0x06045402,
+    0x06045506, 0x06045606, 0x06045706, 0x06045806, 0x06045902, 0x06045B02, 0x06047003, 0x06047203, 0x06047801, 0x06047E02, 0x06048301, 0x06048601,
+    0x0604A601, 0x0604AC02, 0x0604AE02, 0x0604B401, 0x0604DA01, 0x0604DB04, 0x0604EB01, 0x0604F602, 0x06050801, 0x06050E01, 0x06050F01, 0x06051202,
+    0x06051301, 0x06051501, 0x06051601, 0x06051901, 0x06051A01, 0x06051B01, 0x06051E01, 0x06052101, 0x06052901, 0x06052A01, 0x06052B01, 0x06052D01,
+    0x06052E01, 0x06052F01, 0x06053101, 0x06053201, 0x06053301, 0x06053401, 0x06053701, 0x06053901, 0x06053A01, 0x06053B01, 0x06053C01, 0x06053D01,
+    0x06054502, 0x06056001, 0x06056201, 0x06056801, 0x06056901, 0x06056D01, 0x06057102, 0x06057301, 0x06057401, 0x06058002, 0x06058201, 0x06058301,
+    0x06058501, 0x06058601, 0x06058701, 0x06058801, 0x06058901, 0x06058A01, 0x06058B01, 0x06058C01, 0x06058D01, 0x06058E01, 0x06059A01, 0x06059B02,
+    0x06059F01, 0x0605A001, 0x0605A101, 0x0605AB02, 0x0605AE02, 0x0605B502, 0x0605E902, 0x06060506, 0x06060602, 0x06060901, 0x06061802, 0x06062002,
+    0x06063102, 0x06065301, 0x06066F02, 0x06067B01, 0x06067F02, 0x06068401, 0x06068802, 0x06069002, 0x06069302, 0x06069602, 0x0606AF03, 0x0606B102,
+    0x0606B202, 0x0606B302, 0x0606B402, 0x0606B602, 0x0606B702, 0x0606C002, 0x0606C502, 0x0606CE02, 0x0606DF02, 0x0606E002, 0x0606E306, 0x0606E902,
+    0x0606F902, 0x06070C02, 0x06071F02, 0x06072002, 0x06072102, 0x06072202, 0x06079002, 0x06079102, 0x06079502, 0x06079806, 0x0607A701, 0x0607AA01,
+    0x0607AC02, 0x0607D801, 0x0607D901, 0x0607F501, 0x0607F801, 0x0607FC01, 0x06080302, 0x06080D02, 0x06080E01, 0x06081101, 0x06081602, 0x06081702,
+    0x06081902, 0x06082002, 0x06084E02, 0x06085502, 0x06085A01, 0x06089502, 0x06089602, 0x06089E02, 0x0608A002, 0x0608DF02, 0x0608E202, 0x0608E601,
+    0x0608FF06, 0x06090106, 0x06097F01, 0x06098901, 0x0609AF01, 0x0609D202, 0x0609E002, 0x0609E102, 0x0609F801, 0x0609FD01, 0x0609FF01, 0x060A0001,
+    0x060A0101, 0x060A0201, 0x060A0301, 0x060A0401, 0x060A3201, 0x060AA601, 0x060ADC02, 0x060B0B02, 0x060B2001, 0x060B3501, 0x060B4601, 0x060B4A01,
+    0x060B4D01, 0x060B5101, 0x060B6A01, 0x060B7801, 0x060B9A02, 0x060B9B02, 0x060BA501, 0x060BA901, 0x060BAF01, 0x060BB401, 0x060BBC01, 0x060BBE01,
+    0x060BC801, 0x060BC901, 0x060BCD01, 0x060BD201, 0x060BD301, 0x060C0006, 0x060C1101, 0x060C6802, 0x060CFB01, 0x060D0501, 0x060D0601, 0x060D0D02,
+    0x060D1B02, 0x060D4F02, 0x060D7F02, 0x060D9502, 0x060DAE06, 0x060DAF06, 0x060DCD02, 0x060DD002, 0x060DE201, 0x060DE801, 0x060DFB01, 0x060E2501,
+    0x060E4601, 0x060E5602, 0x060E5F06, 0x060E6F01, 0x060EA701, 0x060EAA01, 0x060EC302, 0x060ECD03, 0x060F3002, 0x060F8401, 0x060FDD02, 0x060FEA01,
+    0x06102101, 0x06103402, 0x06103E02, 0x0610AD01, 0x0610FD02, 0x06110302, 0x0611AD01, 0x0611B002, 0x0611C802, 0x0611E301, 0x0611FE01, 0x0611FF01,
+    0x06122E02, 0x06122F01, 0x06123101, 0x06123301, 0x06123501, 0x06124201, 0x06124601, 0x06124E01, 0x06125101, 0x06127801, 0x0612E001, 0x06130A01,
+    0x06132F02, 0x06137801, 0x06138E01, 0x0613C802, 0x06142501, 0x06143402, 0x06143E01, 0x06146E01, 0x06147D01, 0x06148301, 0x06149701, 0x0614A901,
+    0x0614E401, 0x0614E501, 0x0614E701, 0x0614E801, 0x0614E901, 0x0614EA01, 0x0615A801, 0x0615D401, 0x06168A02, 0x06168B02, 0x0617CF01, 0x06180A02,
+    0x06188302, 0x06188602, 0x06188802, 0x06188902, 0x06189602, 0x06192706, 0x06194002, 0x06194503, 0x061A4401, 0x061A5301, 0x061A8602, 0x061AC506,
+    0x061B1103, 0x061B1203, 0x061B2902, 0x061B2B02, 0x061B3902, 0x061B3B02, 0x061B4A03, 0x061B4C01, 0x061B4E06, 0x061B5F02, 0x061B7E06, 0x061BE807,
+    0x061BF203, 0x061BFE04, 0x061C0E01, 0x061C3101, 0x061C5A01, 0x061C9B01, 0x061CB001, 0x061D2301, 0x061D3101, 0x061D3401, 0x061D8F02, 0x061D9502,
+    0x061DA402, 0x061DA506, 0x061DA602, 0x061DC601, 0x061ECC01, 0x061EFE02, 0x061F2B01, 0x061F4D01, 0x061F6001, 0x061F6902, 0x061F7101, 0x061F7801,
+    0x061F7D01, 0x061F7E01, 0x061F8101, 0x061FB901, 0x061FBC01, 0x061FCF04, 0x061FDF02, 0x061FE602, 0x061FF201, 0x06202301, 0x06202F01, 0x06204502,
+    0x06207D01, 0x06213601, 0x06215C02, 0x06215E02, 0x06216C02, 0x06216D02, 0x0621CB01, 0x06228001, 0x06228301, 0x06228401, 0x06228D01, 0x06230C01,
+    0x06231F01, 0x06237701, 0x06237B01, 0x06253B01, 0x06253E01, 0x06254A01, 0x06254B01, 0x06256B01, 0x06257C01, 0x06258801, 0x06263401, 0x06266401,
+    0x06266F01, 0x06268902, 0x0626B404, 0x06270802, 0x06270C01, 0x06270E01, 0x06271D01, 0x06274002, 0x06274102, 0x06274201, 0x06275F02, 0x06276002,
+    0x06276E01, 0x06277001, 0x06277201, 0x06277401, 0x06277701, 0x06277A01, 0x06277C01, 0x06278001, 0x06278F01, 0x0627A501, 0x0627A701, 0x0627AF01,
+    0x06280401, 0x06283801, 0x06283B01, 0x06283C02, 0x06283F01, 0x06284401, 0x06284A02, 0x06285D02, 0x06286701, 0x06286A01, 0x06286C01, 0x06287D01,
+    0x06288101, 0x06288401, 0x0628DA01, 0x0628DB01, 0x0628EF02, 0x0628FB01, 0x06290F02, 0x06292E02, 0x06293002, 0x06293802, 0x06293E01, 0x06294301,
+    0x06296302, 0x06296502, 0x0629A402, 0x0629D202, 0x0629FE01, 0x0629FF01, 0x062A1501, 0x062AAB06, 0x062AAC02, 0x062ACD01, 0x062AD001, 0x062AE302,
+    0x062AE402, 0x062AF901, 0x062AFA01, 0x062B1101, 0x062B2F01, 0x062B3501, 0x062B5202, 0x062B5301, 0x062B5601, 0x062B7401, 0x062B8301, 0x062B8401,
+    0x062B8502, 0x062B8606, 0x062B9102, 0x062B9601, 0x062B9701, 0x062B9801, 0x062B9A01, 0x062B9B01, 0x062B9C01, 0x062B9D02, 0x062BA101, 0x062BCD02,
+    0x062BCE02, 0x062C2204, 0x062C3004, 0x062C3C02, 0x062C3E02, 0x062C5501, 0x062C7B01, 0x062C8A01, 0x062CA501, 0x062CC401, 0x062CFE01, 0x062D0901,
+    0x062D0F01, 0x062D1002, 0x062D3601, 0x062D6202, 0x062D7101, 0x062DAC03, 0x062DBC01, 0x062DC001, 0x062DCE02, 0x062DF102, 0x062E0601, 0x062E1A04,
+    0x062E1B04, 0x062E1F01, 0x062E2201, 0x062E2301, 0x062E2701, 0x062E2901, 0x062E2A01, 0x062E2D01, 0x062E4601, 0x062E4C01, 0x062E4D02, 0x062E8801,
+    0x062E8901, 0x062E8A01, 0x062E8C01, 0x062E8D01, 0x062E8F01, 0x062E9801, 0x062EB301, 0x062EC502, 0x062EC902, 0x062EDD01, 0x062EDE01, 0x062EE002,
+    0x062EF102, 0x062F1B01, 0x062F2101, 0x062F2804, 0x062F2B01, 0x062F2D01, 0x062F2F02, 0x062F5D01, 0x062F6106, 0x062F6606, 0x062F6701, 0x062F7501,
+    0x062F9506, 0x062FB206, 0x062FB602, 0x062FD101, 0x062FF101, 0x06300E02, 0x06304A02, 0x06307F01, 0x06308801, 0x06309302, 0x06309402, 0x06309B02,
+    0x0630B106, 0x0630C701, 0x0630CD01, 0x0630DD01, 0x0630F202, 0x06310202, 0x06310802, 0x06311E02, 0x06312A02, 0x06312C02, 0x06315401, 0x06315501,
+    0x06315601, 0x06315801, 0x06317202, 0x0631A701, 0x0631CB02, 0x06321902, 0x06321B03, 0x06322603, 0x06323002, 0x06323E02, 0x06324302, 0x06325502,
+    0x06327B02, 0x0632A602, 0x0632CC02, 0x0632DC01, 0x0632E702, 0x0632F201, 0x0632F603, 0x06331E04, 0x06336C02, 0x06337102, 0x06338E01, 0x06339301,
+    0x06339902, 0x06339E04, 0x0633A301, 0x06340102, 0x06340D01, 0x06347706, 0x06347802, 0x06348002, 0x06348302, 0x06348506, 0x0634B801, 0x0634B901,
+    0x0634CC02, 0x0634CE01, 0x0634E301, 0x0634F902, 0x0634FE01, 0x06350402, 0x06350502, 0x06353102, 0x06353202, 0x06353F01, 0x06356A02, 0x06357802,
+    0x06357B02, 0x06358401, 0x06358701, 0x0635AD06, 0x0635BB02, 0x0635BF02, 0x0635C707, 0x0635C802, 0x0635E501, 0x0635F402, 0x0635F702, 0x0635F802,
+    0x0635F902, 0x06361202, 0x06361902, 0x06364C01, 0x06365A01, 0x06366A02, 0x06367501, 0x06369D02, 0x0636A302, 0x0636BE01, 0x0636C501, 0x0636CB02,
+    0x0636CC02, 0x0636D602, 0x0636F401, 0x0636F901, 0x06376C02, 0x06376D02, 0x06376F01, 0x06377001, 0x06377101, 0x06377301, 0x0637AA06, 0x0637AB01,
+    0x0637B606, 0x0637B806, 0x0637C902, 0x06381D02, 0x06381E02, 0x06385101, 0x0638A301, 0x0638E501, 0x0638ED02, 0x0638F101, 0x0638FF01, 0x06390101,
+    0x06390201, 0x06390602, 0x06391E01, 0x06391F01, 0x06393A02, 0x06393D02, 0x06394402, 0x06399D01, 0x0639AB02, 0x0639AC02, 0x0639B602, 0x0639C202,
+    0x0639C402, 0x0639C502, 0x063A0701, 0x063A1302, 0x063A4601, 0x063A6701, 0x063A6D01, 0x063AA802, 0x063AA902, 0x063AAA02, 0x063AAD04, 0x063AD302,
+    0x063ADD02, 0x063AF606, 0x063B3F02, 0x063B4106, 0x063B4202, 0x063B4A01, 0x063B4F01, 0x063B5001, 0x063B5D01, 0x063B5F01, 0x063B7201, 0x063B8901,
+    0x063B8A02, 0x063B8B02, 0x063B8D01, 0x063BB801, 0x063BC602, 0x063BDF02, 0x063BE002, 0x063BE202, 0x063BEC01, 0x063BFB02, 0x063C0302, 0x063C3604,
+    0x063C3F01, 0x063C4001, 0x063C5301, 0x063C8701, 0x063C8E02, 0x063C9004, 0x063C9104, 0x063C9504, 0x063C9804, 0x063C9B04, 0x063C9C04, 0x063C9E04,
+    0x063CBB01, 0x063CC702, 0x063CC901, 0x063D0601, 0x063D0701, 0x063D2901, 0x063D7301, 0x063DAD01, 0x063DDB02, 0x063DDE02, 0x063E0102, 0x063E2101,
+    0x063E2902, 0x063E3301, 0x063E3B02, 0x063E4304, 0x063E5102, 0x063E5202, 0x063E5F01, 0x063EB302, 0x063ECF01, 0x063ED802, 0x063EDF02, 0x063EF102,
+    0x063F1B01, 0x063F2C01, 0x063F3C02, 0x063F3D02, 0x063F5C02, 0x063F5F02, 0x063F6102, 0x063F8602, 0x063F8B01, 0x063FBB02, 0x063FD802, 0x063FF201,
+    0x063FF401, 0x06400401, 0x06400501, 0x06400F01, 0x06402002, 0x06403301, 0x06404C02, 0x06407A02, 0x0640B003, 0x0640B902, 0x0640ED01, 0x06411101,
+    0x06412102, 0x06412206, 0x06412602, 0x06412702, 0x06415301, 0x06417F02, 0x06418602, 0x06418802, 0x06418902, 0x06418A02, 0x0641E701, 0x0641E902,
+    0x06421A02, 0x06421B04, 0x06422902, 0x06422F02, 0x06424F02, 0x06426B06, 0x06428701, 0x06428802, 0x06428D02, 0x06429002, 0x06429302, 0x06429402,
+    0x06429502, 0x06429702, 0x06429902, 0x06429E01, 0x06429F01, 0x0642AC02, 0x0642AD01, 0x0642AF01, 0x0642CD01, 0x0642DE02, 0x0642EA02, 0x0642F002,
+    0x0642F101, 0x0642F302, 0x0642F602, 0x0642FC02, 0x06438602, 0x06438C02, 0x06438F01, 0x06439501, 0x0643B002, 0x06441201, 0x06441302, 0x06441B02,
+    0x06442B01, 0x06443D02, 0x06443F02, 0x06444402, 0x06444602, 0x06449902, 0x0644A002, 0x0644A302, 0x0644A606, 0x0644CB01, 0x06452501, 0x06452601,
+    0x06452801, 0x06453601, 0x06454901, 0x06458801, 0x06459001, 0x0645AF02, 0x0645B401, 0x0645BF01, 0x0645C701, 0x0645C901, 0x0645DC02, 0x0645DE02,
+    0x0645DF01, 0x0645EA01, 0x06460702, 0x06460802, 0x06460A02, 0x06461301, 0x06461C02, 0x06461D02, 0x06464C02, 0x06464F01, 0x06465A02, 0x06466501,
+    0x06466601, 0x06467302, 0x06468202, 0x06468302, 0x06468502, 0x06468602, 0x06469802, 0x0646A302, 0x0646D002, 0x0646E701, 0x06470401, 0x06472E01,
+    0x06473901, 0x06478B02, 0x06479B06, 0x0647B501, 0x0647BD01, 0x0647CA01, 0x0647F101, 0x0647F706, 0x0647FB04, 0x06480904, 0x06483706, 0x06484D01,
+    0x06487402, 0x0648FC01, 0x06490101, 0x06491001, 0x06491802, 0x06491902, 0x06491A02, 0x06491C02, 0x0649E901, 0x064A1402, 0x064A4301, 0x064A8002,
+    0x064A8E01, 0x064A8F01, 0x064A9001, 0x064A9101, 0x064A9201, 0x064A9301, 0x064A9401, 0x064A9501, 0x064A9A02, 0x064AAB01, 0x064AC901, 0x064AFC01,
+    0x064B0F01, 0x064B3501, 0x064B3E01, 0x064BAF02, 0x064BB302, 0x064BB602, 0x064BCC02, 0x064BD101, 0x064BD502, 0x064BD901, 0x064C0101, 0x064C0F01,
+    0x064C1402, 0x064C2602, 0x064C2902, 0x064C3302, 0x064C3D02, 0x064C6602, 0x064CD701, 0x064DED01, 0x064DEE01, 0x064E2F07, 0x064E4E01, 0x064E5302,
+    0x064E5B01, 0x064E6801, 0x064E7F01, 0x064E8B01, 0x064E8C01, 0x064E8F01, 0x064EB301, 0x064ED102, 0x064EE502, 0x064EF102, 0x064EF701, 0x064F0201,
+    0x064F5502, 0x064F8101, 0x064FD602, 0x064FE302, 0x064FE502, 0x064FF401, 0x06504501, 0x06505A01, 0x0650B002, 0x0650BC02, 0x0650BE02, 0x0650C101,
+    0x0650C202, 0x0650DA02, 0x0650E402, 0x0650E802, 0x0650F202, 0x06512002, 0x06514302, 0x06514602, 0x0651A102, 0x0651A202, 0x0651C901, 0x0651CF01,
+    0x0651E002, 0x0651F102, 0x0651F402, 0x06522E02, 0x06523002, 0x06523101, 0x06523B02, 0x06529402, 0x0652AD06, 0x0652C701, 0x0652CB02, 0x0652DA01,
+    0x0652DB01, 0x0652EB02, 0x0652F006, 0x0652F202, 0x0652FE01, 0x06534F01, 0x06536C01, 0x06539506, 0x0653C203, 0x0653C302, 0x0653C403, 0x0653C502,
+    0x0653C602, 0x0653C702, 0x06540002, 0x06544501, 0x0654D902, 0x0654F602, 0x0654F902, 0x06551602, 0x06553E02, 0x06555101, 0x06557306, 0x06559E01,
+    0x0655C902, 0x06560B01, 0x06564902, 0x06569C02, 0x06571001, 0x06571C02, 0x06573501, 0x06575101, 0x06579601, 0x06579701, 0x06579801, 0x06579901,
+    0x06579A01, 0x06579B01, 0x06579C01, 0x0657A102, 0x0657A201, 0x0657A302, 0x0657A401, 0x0657A501, 0x0657A601, 0x0657A701, 0x0657A801, 0x0657A901,
+    0x0657AA01, 0x0657AB01, 0x0657AC01, 0x0657AD01, 0x0657AE01, 0x0657AF01, 0x0657B001, 0x0657B101, 0x0657B201, 0x0657B401, 0x0657B501, 0x0657B601,
+    0x0657B701, 0x06582D01, 0x06582E01, 0x06582F01, 0x06583001, 0x06583101, 0x06583201, 0x06583301, 0x06583401, 0x06583501, 0x06583601, 0x06583701,
+    0x06583801, 0x06587A01, 0x06587B01, 0x06587C01, 0x06587D01, 0x06587E01, 0x06587F01, 0x06588001, 0x06588101, 0x06588201, 0x06588301, 0x06588401,
+    0x06588501, 0x06588601, 0x06588701, 0x06588801, 0x06588901, 0x06594801, 0x06597D02, 0x06598701, 0x0659DB02, 0x0659E502, 0x065A4A02, 0x065A5002,
+    0x065A5302, 0x065A5802, 0x065A6002, 0x065A6802, 0x065A6C02, 0x065A6E02, 0x065A7002, 0x065B6A06, 0x065BBB06, 0x065BF304, 0x065BF504, 0x065BF604,
+    0x065BF704, 0x065C3C02, 0x065C4701, 0x065C4801, 0x065C4901, 0x065C4A01, 0x065C4B01, 0x065C4C01, 0x065C4D01, 0x065C4E01, 0x065C4F01, 0x065C5001,
+    0x065C5101, 0x065C5201, 0x065C5301, 0x065C5401, 0x065C5501, 0x065C5701, 0x065C5901, 0x065CE801, 0x065D0B01, 0x065D1801, 0x065D1A02, 0x065DA702,
+    0x065E0A02, 0x065E2104, 0x065E2204, 0x065E4C02, 0x065E5E02, 0x065E6602, 0x065E6702, 0x065E7A02, 0x065EA902, 0x065ECE02, 0x065ECF02, 0x065ED002,
+    0x065ED102, 0x065ED202, 0x065EE602, 0x065EF902, 0x065F0102, 0x065F0A02, 0x065F0B02, 0x065F1801, 0x065F1B01, 0x065F1C01, 0x065F1D01, 0x065F1E01,
+    0x065F2A01, 0x065F2B01, 0x065F2E01, 0x065F3601, 0x065F4001, 0x065F6101, 0x065F9001, 0x065F9904, 0x065FAA01, 0x065FEB01, 0x065FFD01, 0x06600301,
+    0x06600401, 0x06601501, 0x06604501, 0x06605302, 0x06607701, 0x06609001, 0x0660A801, 0x0660DB01, 0x0660DF02, 0x0660E904, 0x06612001, 0x06613502,
+    0x06614A01, 0x06614F02, 0x06615401, 0x06616602, 0x06617301, 0x06618201, 0x06618B01, 0x0661F302, 0x06620B01, 0x06621D04, 0x06621F04, 0x06622302,
+    0x06623806, 0x0662F302, 0x06630E01, 0x06631702, 0x06634B01, 0x0663AF03, 0x0663D502, 0x0663D602, 0x0663D702, 0x0663D802, 0x06641401, 0x06641F01,
+    0x0664F001, 0x0664F701, 0x06652204, 0x06653101, 0x06653301, 0x06653501, 0x06655E02, 0x06655F02, 0x06658902, 0x06659101, 0x0665D901, 0x0665DC01,
+    0x06661002, 0x06667701, 0x06668202, 0x06668601, 0x0666B001, 0x0666B801, 0x0666C802, 0x0666D102, 0x0666D202, 0x0666E601, 0x0666E702, 0x0666E902,
+    0x0666F301, 0x0666FD01, 0x0666FE01, 0x06670501, 0x06670601, 0x06672D01, 0x06672E01, 0x06672F01, 0x06678A01, 0x06679901, 0x0667A101, 0x0667A201,
+    0x0667BA01, 0x0667D803, 0x0667F802, 0x0667F902, 0x06680101, 0x06681001, 0x06681101, 0x06684801, 0x06684901, 0x06684D01, 0x06685701, 0x06685A01,
+    0x06685B01, 0x06686401, 0x06687101, 0x0668AB01, 0x0668FB02, 0x0668FC02, 0x0668FE02, 0x06690602, 0x06692301, 0x06695602, 0x06695702, 0x06695C01,
+    0x06695E01, 0x06696401, 0x06696B02, 0x06697302, 0x06697403, 0x06697802, 0x06697902, 0x06697A02, 0x06697B02, 0x06697C02, 0x06697D02, 0x0669A302,
+    0x0669A402, 0x0669A702, 0x0669AA02, 0x0669B506, 0x0669B902, 0x0669BA02, 0x0669BD02, 0x0669CD02, 0x0669D102, 0x0669D802, 0x0669DA02, 0x0669E002,
+    0x0669E102, 0x0669EA02, 0x066A0602, 0x066A1A02, 0x066A1B02, 0x066A1C02, 0x066A4A02, 0x066A6901, 0x066A7502, 0x066A7A02, 0x066A7F02, 0x066A8202,
+    0x066A8302, 0x066A8801, 0x066ACA01, 0x066AFC01, 0x066B1001, 0x066BC804, 0x066D5701, 0x066D6201, 0x066D6C01, 0x066DCC01, 0x066E3601, 0x066E3A02,
+    0x066E4301, 0x066E4D02, 0x066EA706, 0x066EA802, 0x066ED701, 0x066EF501, 0x066F0701, 0x066F0801, 0x066FB701, 0x06701502, 0x06705702, 0x06705802,
+    0x06705B03, 0x0670C501, 0x0670C601, 0x0670CA02, 0x0670CE02, 0x0670F301, 0x06717A01, 0x06718801, 0x0671A101, 0x0671A601, 0x0671CB04, 0x0671D201,
+    0x0671D301, 0x0671D401, 0x0671D501, 0x0671D601, 0x0671D701, 0x0671D801, 0x0671D901, 0x0671DA01, 0x0671E401, 0x0671E801, 0x0671EE02, 0x06728302,
+    0x0672C201, 0x0672D001, 0x06734001, 0x06735002, 0x06737B01, 0x06738101, 0x06738D01, 0x0673C402, 0x0673D602, 0x0673D702, 0x0673E202, 0x06740302,
+    0x06744C01, 0x06748D02, 0x06748E02, 0x0674BC01, 0x0674D301, 0x0674E002, 0x06751901, 0x06753901, 0x0675CF01, 0x0675F601, 0x0675F801, 0x06762203,
+    0x06766201, 0x06767F01, 0x0676A004, 0x0676A602, 0x0676A702, 0x0676A906, 0x0676BC02, 0x0676C202, 0x0676F601, 0x0676FD01, 0x0676FE01, 0x0676FF01,
+    0x06771401, 0x06771702, 0x06773606, 0x06776B01, 0x06777B02, 0x06777F01, 0x06778601, 0x06778D02, 0x06779301, 0x06779401, 0x06779501, 0x06779A01,
+    0x06779E01, 0x0677C202, 0x0677CC02, 0x0677CD02, 0x0677CE06, 0x06784701, 0x06784B01, 0x06785101, 0x06785501, 0x06785801, 0x06786C02, 0x06788202,
+    0x06789002, 0x06789102, 0x0678B803, 0x0678BE01, 0x0678BF01, 0x0678C101, 0x0678C201, 0x0678C301, 0x0678C501, 0x0678C601, 0x0678C701, 0x0678DB02,
+    0x06793E02, 0x06795B01, 0x06797B02, 0x0679D202, 0x0679EC06, 0x0679F701, 0x067A1003, 0x067A2301, 0x067A2B01, 0x067A2C01, 0x067A4102, 0x067A4C01,
+    0x067A5501, 0x067A6C02, 0x067A7101, 0x067A7202, 0x067A7402, 0x067A7C02, 0x067A8E06, 0x067A9502, 0x067AB002, 0x067AB101, 0x067AD701, 0x067AD801,
+    0x067AE701, 0x067B1701, 0x067B3002, 0x067B6204, 0x067C1B01, 0x067C2E02, 0x067C5704, 0x067C5901, 0x067C7501, 0x067C9A01, 0x067CC401, 0x067D2D01,
+    0x067D2E01, 0x067D5201, 0x067D5301, 0x067D8101, 0x067D9001, 0x067DAD01, 0x067DAE01, 0x067DC601, 0x067DDB02, 0x067DE801, 0x067E0B01, 0x067E3906,
+    0x067E8A01, 0x067EB102, 0x067EC804, 0x067ECD01, 0x067EDC01, 0x067F1402, 0x067F4C02, 0x067F8101, 0x067F8401, 0x067FED02, 0x06800001, 0x06800101,
+    0x06800301, 0x06800401, 0x06800501, 0x06800601, 0x06800701, 0x06800901, 0x06802101, 0x06802401, 0x06802501, 0x06802601, 0x06802701, 0x06802801,
+    0x06802901, 0x06802A01, 0x06802B01, 0x06802C01, 0x06802D01, 0x06802E01, 0x06802F01, 0x06803001, 0x06805B02, 0x0680C802, 0x0680CA02, 0x0680E302,
+    0x0680E402, 0x0680E502, 0x0680E602, 0x0680EA02, 0x0680EB02, 0x06810002, 0x06811202, 0x06811602, 0x06811A02, 0x06811C06, 0x06811E02, 0x06812C01,
+    0x06813102, 0x06815802, 0x06815F02, 0x06816101, 0x06816502, 0x06817202, 0x0681A102, 0x0681A403, 0x0681B602, 0x0681B802, 0x0681BA02, 0x0681C602,
+    0x0681C702, 0x0681CF01, 0x0681D702, 0x0681D902, 0x0681DB02, 0x0681DC02, 0x0681DE02, 0x0681E102, 0x0681E902, 0x0681EA01, 0x0681EB02, 0x0681EC02,
+    0x0681ED02, 0x0681EE02, 0x0681F302, 0x0681F502, 0x0681F802, 0x06821402, 0x06823A01, 0x06824F01, 0x06825506, 0x06825A02, 0x06825D02, 0x06825F02,
+    0x06826006, 0x06826102, 0x06826202, 0x06826302, 0x06826A02, 0x06826D02, 0x06829D04, 0x06829F01, 0x0682AA02, 0x0682CF06, 0x0682EA04, 0x0682FB04,
+    0x06830401, 0x06830504, 0x06830D01, 0x06833301, 0x06833501, 0x06834402, 0x06835104, 0x06835401, 0x0683C704, 0x06840201, 0x06841202, 0x06841602,
+    0x06841706, 0x06841902, 0x06842602, 0x06842D02, 0x06843802, 0x06845D01, 0x06849701, 0x06849A01, 0x0684A101, 0x0684BD01, 0x0684C101, 0x0684C401,
+    0x0684CB01, 0x0684D301, 0x0684D401, 0x0684D501, 0x0684DC02, 0x0684F901, 0x06850601, 0x06850802, 0x06851501, 0x06852002, 0x06853401, 0x06854D01,
+    0x06855B01, 0x06856B01, 0x06858502, 0x06858E02, 0x06859E01, 0x06859F01, 0x0685DF01, 0x0685E201, 0x0685E501, 0x0685E701, 0x0685E801, 0x06862A01,
+    0x06865B02, 0x06867802, 0x06867902, 0x06869001, 0x0686A802, 0x0686BA02, 0x0686D101, 0x0686E302, 0x0686FD02, 0x0686FF02, 0x06870902, 0x06871102,
+    0x06873F02, 0x06875102, 0x06875B02, 0x06876102, 0x06877302, 0x06877D02, 0x06878006, 0x06878106, 0x06878206, 0x06878306, 0x06878406, 0x06878502,
+    0x06878606, 0x06878706, 0x06878802, 0x06878902, 0x06878A02, 0x06878B02, 0x06878C06, 0x06878D02, 0x06878E02, 0x0687AB02, 0x0687BB01, 0x0687DB01,
+    0x0687EE01, 0x0687F201, 0x0687F401, 0x0687F501, 0x06880D02, 0x06880E01, 0x06881001, 0x06881101, 0x06881202, 0x06882C02, 0x06882E04, 0x06882F01,
+    0x06883001, 0x06888002, 0x0688A802, 0x0688C302, 0x0688C902, 0x0688E002, 0x0688E102, 0x06894902, 0x06894A02, 0x06894B02, 0x06894C02, 0x06896902,
+    0x06897202, 0x06899703, 0x0689A201, 0x0689A704, 0x0689AD01, 0x0689B402, 0x0689B602, 0x0689C602, 0x0689C703, 0x0689C803, 0x0689CC02, 0x0689CD01,
+    0x0689E302, 0x0689EB02, 0x0689ED02, 0x0689FB01, 0x068A0D02, 0x068A1901, 0x068A3401, 0x068A3B02, 0x068A3F02, 0x068A4003, 0x068A4401, 0x068A4E02,
+    0x068A6704, 0x068A9B04, 0x068AC002, 0x068AF101, 0x068AF201, 0x068AF901, 0x068B6C02, 0x068B7601, 0x068B8D02, 0x068B9201, 0x068BE901, 0x068C5402,
+    0x068C5502, 0x068C6101, 0x068C8001, 0x068C8601, 0x068C8801, 0x068C8C01, 0x068C9B02, 0x068CA004, 0x068CB604, 0x068CF101, 0x068D0501, 0x068D3502,
+    0x068D3A02, 0x068D5901, 0x068D6404, 0x068D7701, 0x068D9D02, 0x068DA302, 0x068DAD02, 0x068DC102, 0x068E0202, 0x068E0502, 0x068E0702, 0x068E3104,
+    0x068E3306, 0x068E3A02, 0x068E3B02, 0x068E5402, 0x068E5602, 0x068E5B02, 0x068E5F02, 0x068E6A02, 0x068E8102, 0x068E8F02, 0x068E9201, 0x068ECC01,
+    0x068EE401, 0x068EF402, 0x068F1402, 0x068F7F06, 0x068FC706, 0x068FD302, 0x06906101, 0x06908A04, 0x06908B04, 0x06909004, 0x06916A01, 0x06918B01,
+    0x0691C102, 0x0691D202, 0x0691D602, 0x06924F04, 0x06926604, 0x06926E01, 0x0692BC01, 0x0692D302, 0x0692D602, 0x0692E102, 0x0692E902, 0x0692F302,
+    0x0692FC02, 0x0692FE02, 0x06935702, 0x0693CB01, 0x0693CC01, 0x06942902, 0x06942C02, 0x06942F02, 0x06943002, 0x06943402, 0x06943502, 0x06943C02,
+    0x06943D02, 0x06945802, 0x0694B602, 0x0694C101, 0x0694C201, 0x06957301, 0x06959D01, 0x0695A601, 0x0695D202, 0x0695F501, 0x0695FD01, 0x0696B601,
+    0x0696B701, 0x0696B801, 0x0696B901, 0x0696BA01, 0x0696BB01, 0x0696BC01, 0x0696BD01, 0x0696BE01, 0x0696BF01, 0x0696C001, 0x0696C101, 0x0696C201,
+    0x0697AB01, 0x0697AC01, 0x0697AD01, 0x0697AE01, 0x0697AF01, 0x0697B001, 0x0697B101, 0x0697B201, 0x0697B301, 0x0697B401, 0x0697B601, 0x0697B701,
+    0x06981A02, 0x06988501, 0x069A0C02, 0x069A0F02, 0x069A1202, 0x069A1502, 0x069A2202, 0x069A8402, 0x069A8A02, 0x069B3A02, 0x069B7401, 0x069B7901,
+    0x069B7D01, 0x069B7E01, 0x069B8001, 0x069B8D01, 0x069B9A01, 0x069B9F01, 0x069BB402, 0x069BB502, 0x069BB902, 0x069BBB02, 0x069BBE01, 0x069BDD01,
+    0x069C1301, 0x069C1601, 0x069D2B02, 0x069D2C02, 0x069D3002, 0x069D3B02, 0x069D3C02, 0x069D3D02, 0x069D7C02, 0x069D7D02, 0x069D7E02, 0x069D7F02,
+    0x069E0C02, 0x069E3702, 0x069E3902, 0x069E3C02, 0x069E4902, 0x069EF601, 0x069F4002, 0x069F4E03, 0x06AA0001, 0x06B23102, 0x06BBBD02,
+  };
+}
+
+std::uint8_t dbc::spell_attributes(std::uint64_t spell_id) noexcept {
+  if (spell_id > pack::SPELL_ID_MAX) {
+    return 0;
+  }
+  const auto entries = pack::table(pack::Section::spell_attributes, std::span<const std::uint32_t>{ SPELL_ATTRIBUTES });
+  const auto found = std::lower_bound(entries.begin(), entries.end(), static_cast<std::uint32_t>(spell_id << 8));
+  if (found == entries.end() || (*found >> 8) != spell_id) {
+    return 0;
+  }
+  return static_cast<std::uint8_t>(*found & 0xFF);
+}
+
@@ -1,5123 +0,0 @@
-#include <prescience_helper/sim/dbc/spell_effect.hpp>
-#include <unordered_set>
-namespace dbc = prescience_helper::sim::dbc;
-
-namespace {
-  struct Spell_effect {
-    std::unordered_set<std::uint64_t> scales_with_primary;
-
-    Spell_effect();
-  } const SPELL_EFFECT;
-
-  __declspec(noinline) void emplace(std::unordered_set<std::uint64_t>& into, std::uint64_t id) {
-    into.insert(id);
-  }
-}
-bool dbc::scales_with_primary(std::uint64_t spell_id) noexcept {
-  return SPELL_EFFECT.scales_with_primary.contains(spell_id);
-}
-
-Spell_effect::Spell_effect() {
-  ::emplace(this->scales_with_primary, 337053);
-  ::emplace(this->scales_with_primary, 337342);
-  ::emplace(this->scales_with_primary, 337513);
-  ::emplace(this->scales_with_primary, 337530);
-  ::emplace(this->scales_with_primary, 337550);
-  ::emplace(this->scales_with_primary, 337614);
-  ::emplace(this->scales_with_primary, 337659);
-  ::emplace(this->scales_with_primary, 337819);
-  ::emplace(this->scales_with_primary, 337927);
-  ::emplace(this->scales_with_primary, 337659);
-  ::emplace(this->scales_with_primary, 338076);
-  ::emplace(this->scales_with_primary, 338923);
-  ::emplace(this->scales_with_primary, 338926);
-  ::emplace(this->scales_with_primary, 339385);
-  ::emplace(this->scales_with_primary, 339391);
-  ::emplace(this->scales_with_primary, 339392);
-  ::emplace(this->scales_with_primary, 339532);
-  ::emplace(this->scales_with_primary, 339894);
-  ::emplace(this->scales_with_primary, 340203);
-  ::emplace(this->scales_with_primary, 340571);
-  ::emplace(this->scales_with_primary, 340653);
-  ::emplace(this->scales_with_primary, 340878);
-  ::emplace(this->scales_with_primary, 341100);
-  ::emplace(this->scales_with_primary, 341140);
-  ::emplace(this->scales_with_primary, 341277);
-  ::emplace(this->scales_with_primary, 34914);
-  ::emplace(this->scales_with_primary, 341340);
-  ::emplace(this->scales_with_primary, 341541);
-  ::emplace(this->scales_with_primary, 341580);
-  ::emplace(this->scales_with_primary, 341596);
-  ::emplace(this->scales_with_primary, 341882);
-  ::emplace(this->scales_with_primary, 341890);
-  ::emplace(this->scales_with_primary, 341976);
-  ::emplace(this->scales_with_primary, 342232);
-  ::emplace(this->scales_with_primary, 342240);
-  ::emplace(this->scales_with_primary, 324501);
-  ::emplace(this->scales_with_primary, 342375);
-  ::emplace(this->scales_with_primary, 342857);
-  ::emplace(this->scales_with_primary, 343037);
-  ::emplace(this->scales_with_primary, 343142);
-  ::emplace(this->scales_with_primary, 343294);
-  ::emplace(this->scales_with_primary, 343295);
-  ::emplace(this->scales_with_primary, 207289);
-  ::emplace(this->scales_with_primary, 343355);
-  ::emplace(this->scales_with_primary, 343362);
-  ::emplace(this->scales_with_primary, 343721);
-  ::emplace(this->scales_with_primary, 343724);
-  ::emplace(this->scales_with_primary, 344120);
-  ::emplace(this->scales_with_primary, 344121);
-  ::emplace(this->scales_with_primary, 344484);
-  ::emplace(this->scales_with_primary, 344548);
-  ::emplace(this->scales_with_primary, 344572);
-  ::emplace(this->scales_with_primary, 344582);
-  ::emplace(this->scales_with_primary, 344748);
-  ::emplace(this->scales_with_primary, 344752);
-  ::emplace(this->scales_with_primary, 344955);
-  ::emplace(this->scales_with_primary, 345121);
-  ::emplace(this->scales_with_primary, 345316);
-  ::emplace(this->scales_with_primary, 328837);
-  ::emplace(this->scales_with_primary, 345727);
-  ::emplace(this->scales_with_primary, 346103);
-  ::emplace(this->scales_with_primary, 212739);
-  ::emplace(this->scales_with_primary, 346503);
-  ::emplace(this->scales_with_primary, 346505);
-  ::emplace(this->scales_with_primary, 346602);
-  ::emplace(this->scales_with_primary, 346665);
-  ::emplace(this->scales_with_primary, 330898);
-  ::emplace(this->scales_with_primary, 346832);
-  ::emplace(this->scales_with_primary, 347000);
-  ::emplace(this->scales_with_primary, 347153);
-  ::emplace(this->scales_with_primary, 347360);
-  ::emplace(this->scales_with_primary, 347362);
-  ::emplace(this->scales_with_primary, 347363);
-  ::emplace(this->scales_with_primary, 343217);
-  ::emplace(this->scales_with_primary, 348585);
-  ::emplace(this->scales_with_primary, 348602);
-  ::emplace(this->scales_with_primary, 350003);
-  ::emplace(this->scales_with_primary, 350063);
-  ::emplace(this->scales_with_primary, 350122);
-  ::emplace(this->scales_with_primary, 350159);
-  ::emplace(this->scales_with_primary, 350631);
-  ::emplace(this->scales_with_primary, 351140);
-  ::emplace(this->scales_with_primary, 352070);
-  ::emplace(this->scales_with_primary, 352099);
-  ::emplace(this->scales_with_primary, 352144);
-  ::emplace(this->scales_with_primary, 352520);
-  ::emplace(this->scales_with_primary, 353132);
-  ::emplace(this->scales_with_primary, 353813);
-  ::emplace(this->scales_with_primary, 354831);
-  ::emplace(this->scales_with_primary, 354831);
-  ::emplace(this->scales_with_primary, 354849);
-  ::emplace(this->scales_with_primary, 356431);
-  ::emplace(this->scales_with_primary, 356474);
-  ::emplace(this->scales_with_primary, 356633);
-  ::emplace(this->scales_with_primary, 356719);
-  ::emplace(this->scales_with_primary, 356790);
-  ::emplace(this->scales_with_primary, 356971);
-  ::emplace(this->scales_with_primary, 357209);
-  ::emplace(this->scales_with_primary, 357212);
-  ::emplace(this->scales_with_primary, 357330);
-  ::emplace(this->scales_with_primary, 357715);
-  ::emplace(this->scales_with_primary, 357918);
-  ::emplace(this->scales_with_primary, 356356);
-  ::emplace(this->scales_with_primary, 359077);
-  ::emplace(this->scales_with_primary, 359399);
-  ::emplace(this->scales_with_primary, 359428);
-  ::emplace(this->scales_with_primary, 359499);
-  ::emplace(this->scales_with_primary, 359763);
-  ::emplace(this->scales_with_primary, 359764);
-  ::emplace(this->scales_with_primary, 359765);
-  ::emplace(this->scales_with_primary, 359947);
-  ::emplace(this->scales_with_primary, 324149);
-  ::emplace(this->scales_with_primary, 360969);
-  ::emplace(this->scales_with_primary, 361237);
-  ::emplace(this->scales_with_primary, 361500);
-  ::emplace(this->scales_with_primary, 362562);
-  ::emplace(this->scales_with_primary, 362969);
-  ::emplace(this->scales_with_primary, 363472);
-  ::emplace(this->scales_with_primary, 363789);
-  ::emplace(this->scales_with_primary, 364261);
-  ::emplace(this->scales_with_primary, 364262);
-  ::emplace(this->scales_with_primary, 365350);
-  ::emplace(this->scales_with_primary, 365640);
-  ::emplace(this->scales_with_primary, 366971);
-  ::emplace(this->scales_with_primary, 367819);
-  ::emplace(this->scales_with_primary, 368432);
-  ::emplace(this->scales_with_primary, 369374);
-  ::emplace(this->scales_with_primary, 369398);
-  ::emplace(this->scales_with_primary, 369416);
-  ::emplace(this->scales_with_primary, 370072);
-  ::emplace(this->scales_with_primary, 370371);
-  ::emplace(this->scales_with_primary, 370966);
-  ::emplace(this->scales_with_primary, 371767);
-  ::emplace(this->scales_with_primary, 371786);
-  ::emplace(this->scales_with_primary, 371951);
-  ::emplace(this->scales_with_primary, 371996);
-  ::emplace(this->scales_with_primary, 373130);
-  ::emplace(this->scales_with_primary, 373178);
-  ::emplace(this->scales_with_primary, 373279);
-  ::emplace(this->scales_with_primary, 373304);
-  ::emplace(this->scales_with_primary, 373387);
-  ::emplace(this->scales_with_primary, 373442);
-  ::emplace(this->scales_with_primary, 373751);
-  ::emplace(this->scales_with_primary, 373766);
-  ::emplace(this->scales_with_primary, 373852);
-  ::emplace(this->scales_with_primary, 374743);
-  ::emplace(this->scales_with_primary, 375884);
-  ::emplace(this->scales_with_primary, 375893);
-  ::emplace(this->scales_with_primary, 375901);
-  ::emplace(this->scales_with_primary, 375912);
-  ::emplace(this->scales_with_primary, 375938);
-  ::emplace(this->scales_with_primary, 375963);
-  ::emplace(this->scales_with_primary, 375984);
-  ::emplace(this->scales_with_primary, 376039);
-  ::emplace(this->scales_with_primary, 376080);
-  ::emplace(this->scales_with_primary, 376103);
-  ::emplace(this->scales_with_primary, 376891);
-  ::emplace(this->scales_with_primary, 376914);
-  ::emplace(this->scales_with_primary, 376915);
-  ::emplace(this->scales_with_primary, 377245);
-  ::emplace(this->scales_with_primary, 377642);
-  ::emplace(this->scales_with_primary, 378016);
-  ::emplace(this->scales_with_primary, 378286);
-  ::emplace(this->scales_with_primary, 378597);
-  ::emplace(this->scales_with_primary, 378957);
-  ::emplace(this->scales_with_primary, 379029);
-  ::emplace(this->scales_with_primary, 381292);
-  ::emplace(this->scales_with_primary, 381725);
-  ::emplace(this->scales_with_primary, 382445);
-  ::emplace(this->scales_with_primary, 382590);
-  ::emplace(this->scales_with_primary, 382796);
-  ::emplace(this->scales_with_primary, 383061);
-  ::emplace(this->scales_with_primary, 383312);
-  ::emplace(this->scales_with_primary, 383313);
-  ::emplace(this->scales_with_primary, 383328);
-  ::emplace(this->scales_with_primary, 383414);
-  ::emplace(this->scales_with_primary, 383469);
-  ::emplace(this->scales_with_primary, 383479);
-  ::emplace(this->scales_with_primary, 383706);
-  ::emplace(this->scales_with_primary, 383915);
-  ::emplace(this->scales_with_primary, 383921);
-  ::emplace(this->scales_with_primary, 383991);
-  ::emplace(this->scales_with_primary, 384090);
-  ::emplace(this->scales_with_primary, 384318);
-  ::emplace(this->scales_with_primary, 384391);
-  ::emplace(this->scales_with_primary, 384631);
-  ::emplace(this->scales_with_primary, 385060);
-  ::emplace(this->scales_with_primary, 385061);
-  ::emplace(this->scales_with_primary, 385062);
-  ::emplace(this->scales_with_primary, 385099);
-  ::emplace(this->scales_with_primary, 385228);
-  ::emplace(this->scales_with_primary, 385233);
-  ::emplace(this->scales_with_primary, 385234);
-  ::emplace(this->scales_with_primary, 385354);
-  ::emplace(this->scales_with_primary, 385424);
-  ::emplace(this->scales_with_primary, 385616);
-  ::emplace(this->scales_with_primary, 385627);
-  ::emplace(this->scales_with_primary, 385700);
-  ::emplace(this->scales_with_primary, 370452);
-  ::emplace(this->scales_with_primary, 385723);
-  ::emplace(this->scales_with_primary, 385816);
-  ::emplace(this->scales_with_primary, 385890);
-  ::emplace(this->scales_with_primary, 385897);
-  ::emplace(this->scales_with_primary, 385954);
-  ::emplace(this->scales_with_primary, 385954);
-  ::emplace(this->scales_with_primary, 386013);
-  ::emplace(this->scales_with_primary, 386265);
-  ::emplace(this->scales_with_primary, 386401);
-  ::emplace(this->scales_with_primary, 386402);
-  ::emplace(this->scales_with_primary, 386448);
-  ::emplace(this->scales_with_primary, 386553);
-  ::emplace(this->scales_with_primary, 386609);
-  ::emplace(this->scales_with_primary, 386699);
-  ::emplace(this->scales_with_primary, 386760);
-  ::emplace(this->scales_with_primary, 386911);
-  ::emplace(this->scales_with_primary, 387162);
-  ::emplace(this->scales_with_primary, 387174);
-  ::emplace(this->scales_with_primary, 387200);
-  ::emplace(this->scales_with_primary, 387547);
-  ::emplace(this->scales_with_primary, 387621);
-  ::emplace(this->scales_with_primary, 387985);
-  ::emplace(this->scales_with_primary, 388070);
-  ::emplace(this->scales_with_primary, 388083);
-  ::emplace(this->scales_with_primary, 388201);
-  ::emplace(this->scales_with_primary, 388207);
-  ::emplace(this->scales_with_primary, 388371);
-  ::emplace(this->scales_with_primary, 388382);
-  ::emplace(this->scales_with_primary, 388609);
-  ::emplace(this->scales_with_primary, 388721);
-  ::emplace(this->scales_with_primary, 388845);
-  ::emplace(this->scales_with_primary, 388867);
-  ::emplace(this->scales_with_primary, 389096);
-  ::emplace(this->scales_with_primary, 389098);
-  ::emplace(this->scales_with_primary, 389277);
-  ::emplace(this->scales_with_primary, 389541);
-  ::emplace(this->scales_with_primary, 389860);
-  ::emplace(this->scales_with_primary, 390137);
-  ::emplace(this->scales_with_primary, 390220);
-  ::emplace(this->scales_with_primary, 390232);
-  ::emplace(this->scales_with_primary, 390255);
-  ::emplace(this->scales_with_primary, 384352);
-  ::emplace(this->scales_with_primary, 390389);
-  ::emplace(this->scales_with_primary, 390614);
-  ::emplace(this->scales_with_primary, 390614);
-  ::emplace(this->scales_with_primary, 390845);
-  ::emplace(this->scales_with_primary, 390964);
-  ::emplace(this->scales_with_primary, 391058);
-  ::emplace(this->scales_with_primary, 391159);
-  ::emplace(this->scales_with_primary, 391374);
-  ::emplace(this->scales_with_primary, 391378);
-  ::emplace(this->scales_with_primary, 391400);
-  ::emplace(this->scales_with_primary, 391710);
-  ::emplace(this->scales_with_primary, 392038);
-  ::emplace(this->scales_with_primary, 392058);
-  ::emplace(this->scales_with_primary, 392058);
-  ::emplace(this->scales_with_primary, 392959);
-  ::emplace(this->scales_with_primary, 393035);
-  ::emplace(this->scales_with_primary, 393054);
-  ::emplace(this->scales_with_primary, 393055);
-  ::emplace(this->scales_with_primary, 393056);
-  ::emplace(this->scales_with_primary, 377640);
-  ::emplace(this->scales_with_primary, 393566);
-  ::emplace(this->scales_with_primary, 393834);
-  ::emplace(this->scales_with_primary, 373427);
-  ::emplace(this->scales_with_primary, 394026);
-  ::emplace(this->scales_with_primary, 394031);
-  ::emplace(this->scales_with_primary, 394047);
-  ::emplace(this->scales_with_primary, 394062);
-  ::emplace(this->scales_with_primary, 394111);
-  ::emplace(this->scales_with_primary, 394238);
-  ::emplace(this->scales_with_primary, 394246);
-  ::emplace(this->scales_with_primary, 394325);
-  ::emplace(this->scales_with_primary, 394326);
-  ::emplace(this->scales_with_primary, 394327);
-  ::emplace(this->scales_with_primary, 394328);
-  ::emplace(this->scales_with_primary, 394459);
-  ::emplace(this->scales_with_primary, 394757);
-  ::emplace(this->scales_with_primary, 394979);
-  ::emplace(this->scales_with_primary, 395160);
-  ::emplace(this->scales_with_primary, 395519);
-  ::emplace(this->scales_with_primary, 395521);
-  ::emplace(this->scales_with_primary, 396288);
-  ::emplace(this->scales_with_primary, 396718);
-  ::emplace(this->scales_with_primary, 396719);
-  ::emplace(this->scales_with_primary, 396895);
-  ::emplace(this->scales_with_primary, 399655);
-  ::emplace(this->scales_with_primary, 400069);
-  ::emplace(this->scales_with_primary, 400206);
-  ::emplace(this->scales_with_primary, 400254);
-  ::emplace(this->scales_with_primary, 400360);
-  ::emplace(this->scales_with_primary, 400382);
-  ::emplace(this->scales_with_primary, 400805);
-  ::emplace(this->scales_with_primary, 401359);
-  ::emplace(this->scales_with_primary, 403124);
-  ::emplace(this->scales_with_primary, 404139);
-  ::emplace(this->scales_with_primary, 404358);
-  ::emplace(this->scales_with_primary, 404514);
-  ::emplace(this->scales_with_primary, 404528);
-  ::emplace(this->scales_with_primary, 405018);
-  ::emplace(this->scales_with_primary, 405019);
-  ::emplace(this->scales_with_primary, 405288);
-  ::emplace(this->scales_with_primary, 405345);
-  ::emplace(this->scales_with_primary, 405350);
-  ::emplace(this->scales_with_primary, 405397);
-  ::emplace(this->scales_with_primary, 405426);
-  ::emplace(this->scales_with_primary, 405681);
-  ::emplace(this->scales_with_primary, 406302);
-  ::emplace(this->scales_with_primary, 406430);
-  ::emplace(this->scales_with_primary, 406647);
-  ::emplace(this->scales_with_primary, 406661);
-  ::emplace(this->scales_with_primary, 406957);
-  ::emplace(this->scales_with_primary, 406983);
-  ::emplace(this->scales_with_primary, 406983);
-  ::emplace(this->scales_with_primary, 407466);
-  ::emplace(this->scales_with_primary, 407478);
-  ::emplace(this->scales_with_primary, 407480);
-  ::emplace(this->scales_with_primary, 408237);
-  ::emplace(this->scales_with_primary, 408310);
-  ::emplace(this->scales_with_primary, 408385);
-  ::emplace(this->scales_with_primary, 408630);
-  ::emplace(this->scales_with_primary, 408720);
-  ::emplace(this->scales_with_primary, 408721);
-  ::emplace(this->scales_with_primary, 408725);
-  ::emplace(this->scales_with_primary, 408728);
-  ::emplace(this->scales_with_primary, 408731);
-  ::emplace(this->scales_with_primary, 408732);
-  ::emplace(this->scales_with_primary, 408734);
-  ::emplace(this->scales_with_primary, 409155);
-  ::emplace(this->scales_with_primary, 409890);
-  ::emplace(this->scales_with_primary, 409890);
-  ::emplace(this->scales_with_primary, 410139);
-  ::emplace(this->scales_with_primary, 410219);
-  ::emplace(this->scales_with_primary, 410790);
-  ::emplace(this->scales_with_primary, 411547);
-  ::emplace(this->scales_with_primary, 411639);
-  ::emplace(this->scales_with_primary, 411643);
-  ::emplace(this->scales_with_primary, 411657);
-  ::emplace(this->scales_with_primary, 411703);
-  ::emplace(this->scales_with_primary, 413231);
-  ::emplace(this->scales_with_primary, 414381);
-  ::emplace(this->scales_with_primary, 414448);
-  ::emplace(this->scales_with_primary, 414613);
-  ::emplace(this->scales_with_primary, 415091);
-  ::emplace(this->scales_with_primary, 416618);
-  ::emplace(this->scales_with_primary, 416699);
-  ::emplace(this->scales_with_primary, 416755);
-  ::emplace(this->scales_with_primary, 416757);
-  ::emplace(this->scales_with_primary, 416758);
-  ::emplace(this->scales_with_primary, 416759);
-  ::emplace(this->scales_with_primary, 417313);
-  ::emplace(this->scales_with_primary, 417314);
-  ::emplace(this->scales_with_primary, 417689);
-  ::emplace(this->scales_with_primary, 418025);
-  ::emplace(this->scales_with_primary, 418333);
-  ::emplace(this->scales_with_primary, 418335);
-  ::emplace(this->scales_with_primary, 418360);
-  ::emplace(this->scales_with_primary, 419106);
-  ::emplace(this->scales_with_primary, 420277);
-  ::emplace(this->scales_with_primary, 420808);
-  ::emplace(this->scales_with_primary, 421543);
-  ::emplace(this->scales_with_primary, 422347);
-  ::emplace(this->scales_with_primary, 423584);
-  ::emplace(this->scales_with_primary, 423593);
-  ::emplace(this->scales_with_primary, 423734);
-  ::emplace(this->scales_with_primary, 423886);
-  ::emplace(this->scales_with_primary, 424428);
-  ::emplace(this->scales_with_primary, 424590);
-  ::emplace(this->scales_with_primary, 424802);
-  ::emplace(this->scales_with_primary, 425047);
-  ::emplace(this->scales_with_primary, 425529);
-  ::emplace(this->scales_with_primary, 425672);
-  ::emplace(this->scales_with_primary, 426581);
-  ::emplace(this->scales_with_primary, 426592);
-  ::emplace(this->scales_with_primary, 426653);
-  ::emplace(this->scales_with_primary, 426703);
-  ::emplace(this->scales_with_primary, 426730);
-  ::emplace(this->scales_with_primary, 426747);
-  ::emplace(this->scales_with_primary, 426757);
-  ::emplace(this->scales_with_primary, 426833);
-  ::emplace(this->scales_with_primary, 426951);
-  ::emplace(this->scales_with_primary, 427031);
-  ::emplace(this->scales_with_primary, 427904);
-  ::emplace(this->scales_with_primary, 427905);
-  ::emplace(this->scales_with_primary, 427906);
-  ::emplace(this->scales_with_primary, 427907);
-  ::emplace(this->scales_with_primary, 427908);
-  ::emplace(this->scales_with_primary, 427910);
-  ::emplace(this->scales_with_primary, 427911);
-  ::emplace(this->scales_with_primary, 427916);
-  ::emplace(this->scales_with_primary, 428078);
-  ::emplace(this->scales_with_primary, 394046);
-  ::emplace(this->scales_with_primary, 428455);
-  ::emplace(this->scales_with_primary, 428647);
-  ::emplace(this->scales_with_primary, 428699);
-  ::emplace(this->scales_with_primary, 429216);
-  ::emplace(this->scales_with_primary, 429238);
-  ::emplace(this->scales_with_primary, 429412);
-  ::emplace(this->scales_with_primary, 429617);
-  ::emplace(this->scales_with_primary, 429619);
-  ::emplace(this->scales_with_primary, 426268);
-  ::emplace(this->scales_with_primary, 429951);
-  ::emplace(this->scales_with_primary, 430023);
-  ::emplace(this->scales_with_primary, 430218);
-  ::emplace(this->scales_with_primary, 430219);
-  ::emplace(this->scales_with_primary, 430224);
-  ::emplace(this->scales_with_primary, 430671);
-  ::emplace(this->scales_with_primary, 430694);
-  ::emplace(this->scales_with_primary, 20271);
-  ::emplace(this->scales_with_primary, 53);
-  ::emplace(this->scales_with_primary, 59);
-  ::emplace(this->scales_with_primary, 101);
-  ::emplace(this->scales_with_primary, 120);
-  ::emplace(this->scales_with_primary, 122);
-  ::emplace(this->scales_with_primary, 133);
-  ::emplace(this->scales_with_primary, 348);
-  ::emplace(this->scales_with_primary, 568);
-  ::emplace(this->scales_with_primary, 585);
-  ::emplace(this->scales_with_primary, 589);
-  ::emplace(this->scales_with_primary, 686);
-  ::emplace(this->scales_with_primary, 772);
-  ::emplace(this->scales_with_primary, 845);
-  ::emplace(this->scales_with_primary, 1050);
-  ::emplace(this->scales_with_primary, 1464);
-  ::emplace(this->scales_with_primary, 1752);
-  ::emplace(this->scales_with_primary, 1822);
-  ::emplace(this->scales_with_primary, 2098);
-  ::emplace(this->scales_with_primary, 2606);
-  ::emplace(this->scales_with_primary, 2676);
-  ::emplace(this->scales_with_primary, 2812);
-  ::emplace(this->scales_with_primary, 2948);
-  ::emplace(this->scales_with_primary, 3052);
-  ::emplace(this->scales_with_primary, 3053);
-  ::emplace(this->scales_with_primary, 3054);
-  ::emplace(this->scales_with_primary, 3055);
-  ::emplace(this->scales_with_primary, 3106);
-  ::emplace(this->scales_with_primary, 3110);
-  ::emplace(this->scales_with_primary, 3121);
-  ::emplace(this->scales_with_primary, 3129);
-  ::emplace(this->scales_with_primary, 3143);
-  ::emplace(this->scales_with_primary, 3204);
-  ::emplace(this->scales_with_primary, 3205);
-  ::emplace(this->scales_with_primary, 3206);
-  ::emplace(this->scales_with_primary, 3207);
-  ::emplace(this->scales_with_primary, 3234);
-  ::emplace(this->scales_with_primary, 3322);
-  ::emplace(this->scales_with_primary, 3339);
-  ::emplace(this->scales_with_primary, 3606);
-  ::emplace(this->scales_with_primary, 5113);
-  ::emplace(this->scales_with_primary, 5176);
-  ::emplace(this->scales_with_primary, 5221);
-  ::emplace(this->scales_with_primary, 5255);
-  ::emplace(this->scales_with_primary, 5263);
-  ::emplace(this->scales_with_primary, 5401);
-  ::emplace(this->scales_with_primary, 5403);
-  ::emplace(this->scales_with_primary, 5679);
-  ::emplace(this->scales_with_primary, 5857);
-  ::emplace(this->scales_with_primary, 5938);
-  ::emplace(this->scales_with_primary, 6252);
-  ::emplace(this->scales_with_primary, 6255);
-  ::emplace(this->scales_with_primary, 6304);
-  ::emplace(this->scales_with_primary, 6305);
-  ::emplace(this->scales_with_primary, 6343);
-  ::emplace(this->scales_with_primary, 6353);
-  ::emplace(this->scales_with_primary, 6435);
-  ::emplace(this->scales_with_primary, 6572);
-  ::emplace(this->scales_with_primary, 6636);
-  ::emplace(this->scales_with_primary, 6725);
-  ::emplace(this->scales_with_primary, 6807);
-  ::emplace(this->scales_with_primary, 6917);
-  ::emplace(this->scales_with_primary, 6949);
-  ::emplace(this->scales_with_primary, 7082);
-  ::emplace(this->scales_with_primary, 7101);
-  ::emplace(this->scales_with_primary, 7268);
-  ::emplace(this->scales_with_primary, 7384);
-  ::emplace(this->scales_with_primary, 7668);
-  ::emplace(this->scales_with_primary, 7814);
-  ::emplace(this->scales_with_primary, 8000);
-  ::emplace(this->scales_with_primary, 8042);
-  ::emplace(this->scales_with_primary, 8092);
-  ::emplace(this->scales_with_primary, 8150);
-  ::emplace(this->scales_with_primary, 8187);
-  ::emplace(this->scales_with_primary, 8208);
-  ::emplace(this->scales_with_primary, 8242);
-  ::emplace(this->scales_with_primary, 8246);
-  ::emplace(this->scales_with_primary, 8293);
-  ::emplace(this->scales_with_primary, 8435);
-  ::emplace(this->scales_with_primary, 8598);
-  ::emplace(this->scales_with_primary, 8646);
-  ::emplace(this->scales_with_primary, 8676);
-  ::emplace(this->scales_with_primary, 8680);
-  ::emplace(this->scales_with_primary, 8714);
-  ::emplace(this->scales_with_primary, 8732);
-  ::emplace(this->scales_with_primary, 8800);
-  ::emplace(this->scales_with_primary, 9002);
-  ::emplace(this->scales_with_primary, 9003);
-  ::emplace(this->scales_with_primary, 9004);
-  ::emplace(this->scales_with_primary, 9053);
-  ::emplace(this->scales_with_primary, 9081);
-  ::emplace(this->scales_with_primary, 9433);
-  ::emplace(this->scales_with_primary, 9481);
-  ::emplace(this->scales_with_primary, 9483);
-  ::emplace(this->scales_with_primary, 9488);
-  ::emplace(this->scales_with_primary, 9573);
-  ::emplace(this->scales_with_primary, 9575);
-  ::emplace(this->scales_with_primary, 9591);
-  ::emplace(this->scales_with_primary, 9613);
-  ::emplace(this->scales_with_primary, 9654);
-  ::emplace(this->scales_with_primary, 9672);
-  ::emplace(this->scales_with_primary, 9734);
-  ::emplace(this->scales_with_primary, 9739);
-  ::emplace(this->scales_with_primary, 9770);
-  ::emplace(this->scales_with_primary, 9771);
-  ::emplace(this->scales_with_primary, 9773);
-  ::emplace(this->scales_with_primary, 9776);
-  ::emplace(this->scales_with_primary, 9779);
-  ::emplace(this->scales_with_primary, 9874);
-  ::emplace(this->scales_with_primary, 9915);
-  ::emplace(this->scales_with_primary, 10017);
-  ::emplace(this->scales_with_primary, 10018);
-  ::emplace(this->scales_with_primary, 10253);
-  ::emplace(this->scales_with_primary, 10267);
-  ::emplace(this->scales_with_primary, 10346);
-  ::emplace(this->scales_with_primary, 10451);
-  ::emplace(this->scales_with_primary, 10455);
-  ::emplace(this->scales_with_primary, 10733);
-  ::emplace(this->scales_with_primary, 10734);
-  ::emplace(this->scales_with_primary, 11021);
-  ::emplace(this->scales_with_primary, 11082);
-  ::emplace(this->scales_with_primary, 11084);
-  ::emplace(this->scales_with_primary, 11085);
-  ::emplace(this->scales_with_primary, 11131);
-  ::emplace(this->scales_with_primary, 11264);
-  ::emplace(this->scales_with_primary, 11366);
-  ::emplace(this->scales_with_primary, 11391);
-  ::emplace(this->scales_with_primary, 11430);
-  ::emplace(this->scales_with_primary, 11481);
-  ::emplace(this->scales_with_primary, 11824);
-  ::emplace(this->scales_with_primary, 11829);
-  ::emplace(this->scales_with_primary, 11839);
-  ::emplace(this->scales_with_primary, 11921);
-  ::emplace(this->scales_with_primary, 11962);
-  ::emplace(this->scales_with_primary, 11968);
-  ::emplace(this->scales_with_primary, 11969);
-  ::emplace(this->scales_with_primary, 11970);
-  ::emplace(this->scales_with_primary, 11975);
-  ::emplace(this->scales_with_primary, 11978);
-  ::emplace(this->scales_with_primary, 11983);
-  ::emplace(this->scales_with_primary, 11985);
-  ::emplace(this->scales_with_primary, 11988);
-  ::emplace(this->scales_with_primary, 11989);
-  ::emplace(this->scales_with_primary, 12167);
-  ::emplace(this->scales_with_primary, 12170);
-  ::emplace(this->scales_with_primary, 12188);
-  ::emplace(this->scales_with_primary, 12294);
-  ::emplace(this->scales_with_primary, 12354);
-  ::emplace(this->scales_with_primary, 12466);
-  ::emplace(this->scales_with_primary, 12468);
-  ::emplace(this->scales_with_primary, 12470);
-  ::emplace(this->scales_with_primary, 12471);
-  ::emplace(this->scales_with_primary, 12533);
-  ::emplace(this->scales_with_primary, 12548);
-  ::emplace(this->scales_with_primary, 12549);
-  ::emplace(this->scales_with_primary, 12557);
-  ::emplace(this->scales_with_primary, 12611);
-  ::emplace(this->scales_with_primary, 12625);
-  ::emplace(this->scales_with_primary, 12674);
-  ::emplace(this->scales_with_primary, 12675);
-  ::emplace(this->scales_with_primary, 12737);
-  ::emplace(this->scales_with_primary, 12739);
-  ::emplace(this->scales_with_primary, 12744);
-  ::emplace(this->scales_with_primary, 12748);
-  ::emplace(this->scales_with_primary, 12884);
-  ::emplace(this->scales_with_primary, 12891);
-  ::emplace(this->scales_with_primary, 13140);
-  ::emplace(this->scales_with_primary, 13261);
-  ::emplace(this->scales_with_primary, 13319);
-  ::emplace(this->scales_with_primary, 13319);
-  ::emplace(this->scales_with_primary, 13322);
-  ::emplace(this->scales_with_primary, 13376);
-  ::emplace(this->scales_with_primary, 13398);
-  ::emplace(this->scales_with_primary, 13729);
-  ::emplace(this->scales_with_primary, 13745);
-  ::emplace(this->scales_with_primary, 13748);
-  ::emplace(this->scales_with_primary, 13812);
-  ::emplace(this->scales_with_primary, 13878);
-  ::emplace(this->scales_with_primary, 13895);
-  ::emplace(this->scales_with_primary, 13899);
-  ::emplace(this->scales_with_primary, 13900);
-  ::emplace(this->scales_with_primary, 13901);
-  ::emplace(this->scales_with_primary, 14034);
-  ::emplace(this->scales_with_primary, 14200);
-  ::emplace(this->scales_with_primary, 14297);
-  ::emplace(this->scales_with_primary, 14797);
-  ::emplace(this->scales_with_primary, 14871);
-  ::emplace(this->scales_with_primary, 14887);
-  ::emplace(this->scales_with_primary, 14907);
-  ::emplace(this->scales_with_primary, 14914);
-  ::emplace(this->scales_with_primary, 15037);
-  ::emplace(this->scales_with_primary, 15039);
-  ::emplace(this->scales_with_primary, 15040);
-  ::emplace(this->scales_with_primary, 15043);
-  ::emplace(this->scales_with_primary, 15063);
-  ::emplace(this->scales_with_primary, 15095);
-  ::emplace(this->scales_with_primary, 15096);
-  ::emplace(this->scales_with_primary, 15117);
-  ::emplace(this->scales_with_primary, 15228);
-  ::emplace(this->scales_with_primary, 15230);
-  ::emplace(this->scales_with_primary, 15232);
-  ::emplace(this->scales_with_primary, 15234);
-  ::emplace(this->scales_with_primary, 15236);
-  ::emplace(this->scales_with_primary, 15238);
-  ::emplace(this->scales_with_primary, 15241);
-  ::emplace(this->scales_with_primary, 15242);
-  ::emplace(this->scales_with_primary, 15243);
-  ::emplace(this->scales_with_primary, 15244);
-  ::emplace(this->scales_with_primary, 15249);
-  ::emplace(this->scales_with_primary, 15253);
-  ::emplace(this->scales_with_primary, 15254);
-  ::emplace(this->scales_with_primary, 15305);
-  ::emplace(this->scales_with_primary, 15306);
-  ::emplace(this->scales_with_primary, 15451);
-  ::emplace(this->scales_with_primary, 15453);
-  ::emplace(this->scales_with_primary, 15472);
-  ::emplace(this->scales_with_primary, 15475);
-  ::emplace(this->scales_with_primary, 15497);
-  ::emplace(this->scales_with_primary, 15498);
-  ::emplace(this->scales_with_primary, 15499);
-  ::emplace(this->scales_with_primary, 15500);
-  ::emplace(this->scales_with_primary, 15501);
-  ::emplace(this->scales_with_primary, 15505);
-  ::emplace(this->scales_with_primary, 15530);
-  ::emplace(this->scales_with_primary, 15531);
-  ::emplace(this->scales_with_primary, 15532);
-  ::emplace(this->scales_with_primary, 15536);
-  ::emplace(this->scales_with_primary, 15537);
-  ::emplace(this->scales_with_primary, 15538);
-  ::emplace(this->scales_with_primary, 15547);
-  ::emplace(this->scales_with_primary, 15549);
-  ::emplace(this->scales_with_primary, 15570);
-  ::emplace(this->scales_with_primary, 15574);
-  ::emplace(this->scales_with_primary, 15575);
-  ::emplace(this->scales_with_primary, 15587);
-  ::emplace(this->scales_with_primary, 15605);
-  ::emplace(this->scales_with_primary, 15607);
-  ::emplace(this->scales_with_primary, 15610);
-  ::emplace(this->scales_with_primary, 15611);
-  ::emplace(this->scales_with_primary, 15612);
-  ::emplace(this->scales_with_primary, 15614);
-  ::emplace(this->scales_with_primary, 15616);
-  ::emplace(this->scales_with_primary, 15618);
-  ::emplace(this->scales_with_primary, 15619);
-  ::emplace(this->scales_with_primary, 15620);
-  ::emplace(this->scales_with_primary, 15643);
-  ::emplace(this->scales_with_primary, 15653);
-  ::emplace(this->scales_with_primary, 15655);
-  ::emplace(this->scales_with_primary, 15659);
-  ::emplace(this->scales_with_primary, 15664);
-  ::emplace(this->scales_with_primary, 15665);
-  ::emplace(this->scales_with_primary, 15668);
-  ::emplace(this->scales_with_primary, 15691);
-  ::emplace(this->scales_with_primary, 15692);
-  ::emplace(this->scales_with_primary, 15736);
-  ::emplace(this->scales_with_primary, 15743);
-  ::emplace(this->scales_with_primary, 15791);
-  ::emplace(this->scales_with_primary, 15795);
-  ::emplace(this->scales_with_primary, 15797);
-  ::emplace(this->scales_with_primary, 15798);
-  ::emplace(this->scales_with_primary, 15801);
-  ::emplace(this->scales_with_primary, 15968);
-  ::emplace(this->scales_with_primary, 15969);
-  ::emplace(this->scales_with_primary, 15979);
-  ::emplace(this->scales_with_primary, 16000);
-  ::emplace(this->scales_with_primary, 16006);
-  ::emplace(this->scales_with_primary, 16033);
-  ::emplace(this->scales_with_primary, 16034);
-  ::emplace(this->scales_with_primary, 16079);
-  ::emplace(this->scales_with_primary, 16094);
-  ::emplace(this->scales_with_primary, 16099);
-  ::emplace(this->scales_with_primary, 16100);
-  ::emplace(this->scales_with_primary, 16102);
-  ::emplace(this->scales_with_primary, 16168);
-  ::emplace(this->scales_with_primary, 16186);
-  ::emplace(this->scales_with_primary, 16243);
-  ::emplace(this->scales_with_primary, 16249);
-  ::emplace(this->scales_with_primary, 16250);
-  ::emplace(this->scales_with_primary, 16340);
-  ::emplace(this->scales_with_primary, 16346);
-  ::emplace(this->scales_with_primary, 16350);
-  ::emplace(this->scales_with_primary, 16359);
-  ::emplace(this->scales_with_primary, 16390);
-  ::emplace(this->scales_with_primary, 16419);
-  ::emplace(this->scales_with_primary, 16496);
-  ::emplace(this->scales_with_primary, 16511);
-  ::emplace(this->scales_with_primary, 16552);
-  ::emplace(this->scales_with_primary, 16554);
-  ::emplace(this->scales_with_primary, 16564);
-  ::emplace(this->scales_with_primary, 16565);
-  ::emplace(this->scales_with_primary, 16570);
-  ::emplace(this->scales_with_primary, 16576);
-  ::emplace(this->scales_with_primary, 16583);
-  ::emplace(this->scales_with_primary, 16635);
-  ::emplace(this->scales_with_primary, 16786);
-  ::emplace(this->scales_with_primary, 16799);
-  ::emplace(this->scales_with_primary, 16803);
-  ::emplace(this->scales_with_primary, 16804);
-  ::emplace(this->scales_with_primary, 16827);
-  ::emplace(this->scales_with_primary, 16868);
-  ::emplace(this->scales_with_primary, 16997);
-  ::emplace(this->scales_with_primary, 17086);
-  ::emplace(this->scales_with_primary, 17087);
-  ::emplace(this->scales_with_primary, 17088);
-  ::emplace(this->scales_with_primary, 17089);
-  ::emplace(this->scales_with_primary, 17090);
-  ::emplace(this->scales_with_primary, 17091);
-  ::emplace(this->scales_with_primary, 17092);
-  ::emplace(this->scales_with_primary, 17093);
-  ::emplace(this->scales_with_primary, 17094);
-  ::emplace(this->scales_with_primary, 17095);
-  ::emplace(this->scales_with_primary, 17097);
-  ::emplace(this->scales_with_primary, 17140);
-  ::emplace(this->scales_with_primary, 17141);
-  ::emplace(this->scales_with_primary, 17142);
-  ::emplace(this->scales_with_primary, 17147);
-  ::emplace(this->scales_with_primary, 17149);
-  ::emplace(this->scales_with_primary, 17157);
-  ::emplace(this->scales_with_primary, 17158);
-  ::emplace(this->scales_with_primary, 17170);
-  ::emplace(this->scales_with_primary, 17171);
-  ::emplace(this->scales_with_primary, 17194);
-  ::emplace(this->scales_with_primary, 17195);
-  ::emplace(this->scales_with_primary, 17203);
-  ::emplace(this->scales_with_primary, 17228);
-  ::emplace(this->scales_with_primary, 17234);
-  ::emplace(this->scales_with_primary, 17253);
-  ::emplace(this->scales_with_primary, 17273);
-  ::emplace(this->scales_with_primary, 17274);
-  ::emplace(this->scales_with_primary, 17287);
-  ::emplace(this->scales_with_primary, 17289);
-  ::emplace(this->scales_with_primary, 17290);
-  ::emplace(this->scales_with_primary, 17294);
-  ::emplace(this->scales_with_primary, 17353);
-  ::emplace(this->scales_with_primary, 17366);
-  ::emplace(this->scales_with_primary, 17399);
-  ::emplace(this->scales_with_primary, 17439);
-  ::emplace(this->scales_with_primary, 17445);
-  ::emplace(this->scales_with_primary, 17503);
-  ::emplace(this->scales_with_primary, 17689);
-  ::emplace(this->scales_with_primary, 17689);
-  ::emplace(this->scales_with_primary, 17739);
-  ::emplace(this->scales_with_primary, 17745);
-  ::emplace(this->scales_with_primary, 17877);
-  ::emplace(this->scales_with_primary, 17962);
-  ::emplace(this->scales_with_primary, 18147);
-  ::emplace(this->scales_with_primary, 18164);
-  ::emplace(this->scales_with_primary, 18165);
-  ::emplace(this->scales_with_primary, 18351);
-  ::emplace(this->scales_with_primary, 18352);
-  ::emplace(this->scales_with_primary, 18353);
-  ::emplace(this->scales_with_primary, 18354);
-  ::emplace(this->scales_with_primary, 18355);
-  ::emplace(this->scales_with_primary, 18356);
-  ::emplace(this->scales_with_primary, 18357);
-  ::emplace(this->scales_with_primary, 18358);
-  ::emplace(this->scales_with_primary, 18359);
-  ::emplace(this->scales_with_primary, 18360);
-  ::emplace(this->scales_with_primary, 18361);
-  ::emplace(this->scales_with_primary, 18392);
-  ::emplace(this->scales_with_primary, 18399);
-  ::emplace(this->scales_with_primary, 18432);
-  ::emplace(this->scales_with_primary, 18435);
-  ::emplace(this->scales_with_primary, 18500);
-  ::emplace(this->scales_with_primary, 18543);
-  ::emplace(this->scales_with_primary, 18561);
-  ::emplace(this->scales_with_primary, 18564);
-  ::emplace(this->scales_with_primary, 18565);
-  ::emplace(this->scales_with_primary, 18566);
-  ::emplace(this->scales_with_primary, 18567);
-  ::emplace(this->scales_with_primary, 18568);
-  ::emplace(this->scales_with_primary, 18569);
-  ::emplace(this->scales_with_primary, 18570);
-  ::emplace(this->scales_with_primary, 18571);
-  ::emplace(this->scales_with_primary, 18572);
-  ::emplace(this->scales_with_primary, 18573);
-  ::emplace(this->scales_with_primary, 18574);
-  ::emplace(this->scales_with_primary, 18575);
-  ::emplace(this->scales_with_primary, 18576);
-  ::emplace(this->scales_with_primary, 18578);
-  ::emplace(this->scales_with_primary, 18579);
-  ::emplace(this->scales_with_primary, 18580);
-  ::emplace(this->scales_with_primary, 18581);
-  ::emplace(this->scales_with_primary, 18582);
-  ::emplace(this->scales_with_primary, 18583);
-  ::emplace(this->scales_with_primary, 18584);
-  ::emplace(this->scales_with_primary, 18585);
-  ::emplace(this->scales_with_primary, 18586);
-  ::emplace(this->scales_with_primary, 18587);
-  ::emplace(this->scales_with_primary, 18588);
-  ::emplace(this->scales_with_primary, 18589);
-  ::emplace(this->scales_with_primary, 18590);
-  ::emplace(this->scales_with_primary, 18591);
-  ::emplace(this->scales_with_primary, 18592);
-  ::emplace(this->scales_with_primary, 18593);
-  ::emplace(this->scales_with_primary, 18594);
-  ::emplace(this->scales_with_primary, 18595);
-  ::emplace(this->scales_with_primary, 18596);
-  ::emplace(this->scales_with_primary, 18597);
-  ::emplace(this->scales_with_primary, 18598);
-  ::emplace(this->scales_with_primary, 18599);
-  ::emplace(this->scales_with_primary, 18600);
-  ::emplace(this->scales_with_primary, 18601);
-  ::emplace(this->scales_with_primary, 18602);
-  ::emplace(this->scales_with_primary, 18603);
-  ::emplace(this->scales_with_primary, 18604);
-  ::emplace(this->scales_with_primary, 18605);
-  ::emplace(this->scales_with_primary, 18606);
-  ::emplace(this->scales_with_primary, 18607);
-  ::emplace(this->scales_with_primary, 18609);
-  ::emplace(this->scales_with_primary, 18611);
-  ::emplace(this->scales_with_primary, 18612);
-  ::emplace(this->scales_with_primary, 18613);
-  ::emplace(this->scales_with_primary, 18614);
-  ::emplace(this->scales_with_primary, 18615);
-  ::emplace(this->scales_with_primary, 18616);
-  ::emplace(this->scales_with_primary, 18617);
-  ::emplace(this->scales_with_primary, 18618);
-  ::emplace(this->scales_with_primary, 18619);
-  ::emplace(this->scales_with_primary, 18620);
-  ::emplace(this->scales_with_primary, 18621);
-  ::emplace(this->scales_with_primary, 18622);
-  ::emplace(this->scales_with_primary, 18623);
-  ::emplace(this->scales_with_primary, 18624);
-  ::emplace(this->scales_with_primary, 18625);
-  ::emplace(this->scales_with_primary, 18626);
-  ::emplace(this->scales_with_primary, 18627);
-  ::emplace(this->scales_with_primary, 18628);
-  ::emplace(this->scales_with_primary, 18649);
-  ::emplace(this->scales_with_primary, 18663);
-  ::emplace(this->scales_with_primary, 18944);
-  ::emplace(this->scales_with_primary, 18958);
-  ::emplace(this->scales_with_primary, 18977);
-  ::emplace(this->scales_with_primary, 19129);
-  ::emplace(this->scales_with_primary, 19130);
-  ::emplace(this->scales_with_primary, 19133);
-  ::emplace(this->scales_with_primary, 19136);
-  ::emplace(this->scales_with_primary, 19196);
-  ::emplace(this->scales_with_primary, 19237);
-  ::emplace(this->scales_with_primary, 19272);
-  ::emplace(this->scales_with_primary, 19391);
-  ::emplace(this->scales_with_primary, 19434);
-  ::emplace(this->scales_with_primary, 19450);
-  ::emplace(this->scales_with_primary, 19452);
-  ::emplace(this->scales_with_primary, 19460);
-  ::emplace(this->scales_with_primary, 19463);
-  ::emplace(this->scales_with_primary, 19497);
-  ::emplace(this->scales_with_primary, 19513);
-  ::emplace(this->scales_with_primary, 19627);
-  ::emplace(this->scales_with_primary, 19628);
-  ::emplace(this->scales_with_primary, 19630);
-  ::emplace(this->scales_with_primary, 19637);
-  ::emplace(this->scales_with_primary, 19698);
-  ::emplace(this->scales_with_primary, 19701);
-  ::emplace(this->scales_with_primary, 19712);
-  ::emplace(this->scales_with_primary, 19728);
-  ::emplace(this->scales_with_primary, 19729);
-  ::emplace(this->scales_with_primary, 19767);
-  ::emplace(this->scales_with_primary, 19780);
-  ::emplace(this->scales_with_primary, 19781);
-  ::emplace(this->scales_with_primary, 19785);
-  ::emplace(this->scales_with_primary, 19798);
-  ::emplace(this->scales_with_primary, 19811);
-  ::emplace(this->scales_with_primary, 19816);
-  ::emplace(this->scales_with_primary, 20153);
-  ::emplace(this->scales_with_primary, 20203);
-  ::emplace(this->scales_with_primary, 20228);
-  ::emplace(this->scales_with_primary, 20229);
-  ::emplace(this->scales_with_primary, 20271);
-  ::emplace(this->scales_with_primary, 20294);
-  ::emplace(this->scales_with_primary, 20295);
-  ::emplace(this->scales_with_primary, 20296);
-  ::emplace(this->scales_with_primary, 20297);
-  ::emplace(this->scales_with_primary, 20298);
-  ::emplace(this->scales_with_primary, 20299);
-  ::emplace(this->scales_with_primary, 20420);
-  ::emplace(this->scales_with_primary, 20463);
-  ::emplace(this->scales_with_primary, 20476);
-  ::emplace(this->scales_with_primary, 20479);
-  ::emplace(this->scales_with_primary, 20483);
-  ::emplace(this->scales_with_primary, 20527);
-  ::emplace(this->scales_with_primary, 20532);
-  ::emplace(this->scales_with_primary, 20535);
-  ::emplace(this->scales_with_primary, 20536);
-  ::emplace(this->scales_with_primary, 20543);
-  ::emplace(this->scales_with_primary, 20564);
-  ::emplace(this->scales_with_primary, 20566);
-  ::emplace(this->scales_with_primary, 20602);
-  ::emplace(this->scales_with_primary, 20603);
-  ::emplace(this->scales_with_primary, 20615);
-  ::emplace(this->scales_with_primary, 20627);
-  ::emplace(this->scales_with_primary, 20629);
-  ::emplace(this->scales_with_primary, 20630);
-  ::emplace(this->scales_with_primary, 20657);
-  ::emplace(this->scales_with_primary, 20678);
-  ::emplace(this->scales_with_primary, 20690);
-  ::emplace(this->scales_with_primary, 20692);
-  ::emplace(this->scales_with_primary, 20694);
-  ::emplace(this->scales_with_primary, 20695);
-  ::emplace(this->scales_with_primary, 20696);
-  ::emplace(this->scales_with_primary, 20698);
-  ::emplace(this->scales_with_primary, 20712);
-  ::emplace(this->scales_with_primary, 20717);
-  ::emplace(this->scales_with_primary, 20720);
-  ::emplace(this->scales_with_primary, 20741);
-  ::emplace(this->scales_with_primary, 20791);
-  ::emplace(this->scales_with_primary, 20792);
-  ::emplace(this->scales_with_primary, 20793);
-  ::emplace(this->scales_with_primary, 20794);
-  ::emplace(this->scales_with_primary, 20797);
-  ::emplace(this->scales_with_primary, 20801);
-  ::emplace(this->scales_with_primary, 20802);
-  ::emplace(this->scales_with_primary, 20805);
-  ::emplace(this->scales_with_primary, 20806);
-  ::emplace(this->scales_with_primary, 20807);
-  ::emplace(this->scales_with_primary, 20808);
-  ::emplace(this->scales_with_primary, 20811);
-  ::emplace(this->scales_with_primary, 20813);
-  ::emplace(this->scales_with_primary, 20815);
-  ::emplace(this->scales_with_primary, 20816);
-  ::emplace(this->scales_with_primary, 20819);
-  ::emplace(this->scales_with_primary, 20820);
-  ::emplace(this->scales_with_primary, 20821);
-  ::emplace(this->scales_with_primary, 20822);
-  ::emplace(this->scales_with_primary, 20823);
-  ::emplace(this->scales_with_primary, 20824);
-  ::emplace(this->scales_with_primary, 20825);
-  ::emplace(this->scales_with_primary, 20827);
-  ::emplace(this->scales_with_primary, 20828);
-  ::emplace(this->scales_with_primary, 20829);
-  ::emplace(this->scales_with_primary, 20830);
-  ::emplace(this->scales_with_primary, 20831);
-  ::emplace(this->scales_with_primary, 21008);
-  ::emplace(this->scales_with_primary, 21027);
-  ::emplace(this->scales_with_primary, 21030);
-  ::emplace(this->scales_with_primary, 21047);
-  ::emplace(this->scales_with_primary, 21059);
-  ::emplace(this->scales_with_primary, 21066);
-  ::emplace(this->scales_with_primary, 21071);
-  ::emplace(this->scales_with_primary, 21072);
-  ::emplace(this->scales_with_primary, 21073);
-  ::emplace(this->scales_with_primary, 21077);
-  ::emplace(this->scales_with_primary, 21098);
-  ::emplace(this->scales_with_primary, 21099);
-  ::emplace(this->scales_with_primary, 21132);
-  ::emplace(this->scales_with_primary, 21133);
-  ::emplace(this->scales_with_primary, 21135);
-  ::emplace(this->scales_with_primary, 21136);
-  ::emplace(this->scales_with_primary, 21137);
-  ::emplace(this->scales_with_primary, 21138);
-  ::emplace(this->scales_with_primary, 21139);
-  ::emplace(this->scales_with_primary, 21155);
-  ::emplace(this->scales_with_primary, 21158);
-  ::emplace(this->scales_with_primary, 21333);
-  ::emplace(this->scales_with_primary, 21341);
-  ::emplace(this->scales_with_primary, 21369);
-  ::emplace(this->scales_with_primary, 21401);
-  ::emplace(this->scales_with_primary, 21549);
-  ::emplace(this->scales_with_primary, 21667);
-  ::emplace(this->scales_with_primary, 21668);
-  ::emplace(this->scales_with_primary, 21669);
-  ::emplace(this->scales_with_primary, 21687);
-  ::emplace(this->scales_with_primary, 21807);
-  ::emplace(this->scales_with_primary, 21912);
-  ::emplace(this->scales_with_primary, 21971);
-  ::emplace(this->scales_with_primary, 22088);
-  ::emplace(this->scales_with_primary, 22121);
-  ::emplace(this->scales_with_primary, 22206);
-  ::emplace(this->scales_with_primary, 22267);
-  ::emplace(this->scales_with_primary, 22271);
-  ::emplace(this->scales_with_primary, 22273);
-  ::emplace(this->scales_with_primary, 22275);
-  ::emplace(this->scales_with_primary, 22290);
-  ::emplace(this->scales_with_primary, 22312);
-  ::emplace(this->scales_with_primary, 22336);
-  ::emplace(this->scales_with_primary, 22355);
-  ::emplace(this->scales_with_primary, 22357);
-  ::emplace(this->scales_with_primary, 22411);
-  ::emplace(this->scales_with_primary, 22414);
-  ::emplace(this->scales_with_primary, 22423);
-  ::emplace(this->scales_with_primary, 22425);
-  ::emplace(this->scales_with_primary, 22433);
-  ::emplace(this->scales_with_primary, 22460);
-  ::emplace(this->scales_with_primary, 22498);
-  ::emplace(this->scales_with_primary, 22519);
-  ::emplace(this->scales_with_primary, 22539);
-  ::emplace(this->scales_with_primary, 22559);
-  ::emplace(this->scales_with_primary, 22560);
-  ::emplace(this->scales_with_primary, 22568);
-  ::emplace(this->scales_with_primary, 22575);
-  ::emplace(this->scales_with_primary, 22582);
-  ::emplace(this->scales_with_primary, 22642);
-  ::emplace(this->scales_with_primary, 22643);
-  ::emplace(this->scales_with_primary, 22645);
-  ::emplace(this->scales_with_primary, 22665);
-  ::emplace(this->scales_with_primary, 22677);
-  ::emplace(this->scales_with_primary, 22694);
-  ::emplace(this->scales_with_primary, 22699);
-  ::emplace(this->scales_with_primary, 22703);
-  ::emplace(this->scales_with_primary, 22746);
-  ::emplace(this->scales_with_primary, 22878);
-  ::emplace(this->scales_with_primary, 22885);
-  ::emplace(this->scales_with_primary, 22887);
-  ::emplace(this->scales_with_primary, 22893);
-  ::emplace(this->scales_with_primary, 22907);
-  ::emplace(this->scales_with_primary, 22937);
-  ::emplace(this->scales_with_primary, 22972);
-  ::emplace(this->scales_with_primary, 22975);
-  ::emplace(this->scales_with_primary, 22976);
-  ::emplace(this->scales_with_primary, 22977);
-  ::emplace(this->scales_with_primary, 22978);
-  ::emplace(this->scales_with_primary, 22979);
-  ::emplace(this->scales_with_primary, 22980);
-  ::emplace(this->scales_with_primary, 22981);
-  ::emplace(this->scales_with_primary, 22982);
-  ::emplace(this->scales_with_primary, 22983);
-  ::emplace(this->scales_with_primary, 22984);
-  ::emplace(this->scales_with_primary, 22985);
-  ::emplace(this->scales_with_primary, 23011);
-  ::emplace(this->scales_with_primary, 23038);
-  ::emplace(this->scales_with_primary, 23073);
-  ::emplace(this->scales_with_primary, 23102);
-  ::emplace(this->scales_with_primary, 23104);
-  ::emplace(this->scales_with_primary, 23105);
-  ::emplace(this->scales_with_primary, 23106);
-  ::emplace(this->scales_with_primary, 23114);
-  ::emplace(this->scales_with_primary, 23115);
-  ::emplace(this->scales_with_primary, 23187);
-  ::emplace(this->scales_with_primary, 23189);
-  ::emplace(this->scales_with_primary, 23206);
-  ::emplace(this->scales_with_primary, 23269);
-  ::emplace(this->scales_with_primary, 23275);
-  ::emplace(this->scales_with_primary, 23278);
-  ::emplace(this->scales_with_primary, 23308);
-  ::emplace(this->scales_with_primary, 23309);
-  ::emplace(this->scales_with_primary, 23331);
-  ::emplace(this->scales_with_primary, 23337);
-  ::emplace(this->scales_with_primary, 23339);
-  ::emplace(this->scales_with_primary, 23341);
-  ::emplace(this->scales_with_primary, 23364);
-  ::emplace(this->scales_with_primary, 23379);
-  ::emplace(this->scales_with_primary, 23380);
-  ::emplace(this->scales_with_primary, 23391);
-  ::emplace(this->scales_with_primary, 23392);
-  ::emplace(this->scales_with_primary, 23411);
-  ::emplace(this->scales_with_primary, 23412);
-  ::emplace(this->scales_with_primary, 23413);
-  ::emplace(this->scales_with_primary, 23461);
-  ::emplace(this->scales_with_primary, 23462);
-  ::emplace(this->scales_with_primary, 23504);
-  ::emplace(this->scales_with_primary, 23512);
-  ::emplace(this->scales_with_primary, 23580);
-  ::emplace(this->scales_with_primary, 23722);
-  ::emplace(this->scales_with_primary, 23858);
-  ::emplace(this->scales_with_primary, 23881);
-  ::emplace(this->scales_with_primary, 23918);
-  ::emplace(this->scales_with_primary, 23922);
-  ::emplace(this->scales_with_primary, 23931);
-  ::emplace(this->scales_with_primary, 23970);
-  ::emplace(this->scales_with_primary, 23972);
-  ::emplace(this->scales_with_primary, 24011);
-  ::emplace(this->scales_with_primary, 24020);
-  ::emplace(this->scales_with_primary, 24024);
-  ::emplace(this->scales_with_primary, 24050);
-  ::emplace(this->scales_with_primary, 24099);
-  ::emplace(this->scales_with_primary, 24112);
-  ::emplace(this->scales_with_primary, 24192);
-  ::emplace(this->scales_with_primary, 24275);
-  ::emplace(this->scales_with_primary, 24334);
-  ::emplace(this->scales_with_primary, 24340);
-  ::emplace(this->scales_with_primary, 24374);
-  ::emplace(this->scales_with_primary, 24458);
-  ::emplace(this->scales_with_primary, 24611);
-  ::emplace(this->scales_with_primary, 24612);
-  ::emplace(this->scales_with_primary, 24616);
-  ::emplace(this->scales_with_primary, 24649);
-  ::emplace(this->scales_with_primary, 24668);
-  ::emplace(this->scales_with_primary, 24671);
-  ::emplace(this->scales_with_primary, 24680);
-  ::emplace(this->scales_with_primary, 24682);
-  ::emplace(this->scales_with_primary, 24683);
-  ::emplace(this->scales_with_primary, 24685);
-  ::emplace(this->scales_with_primary, 24687);
-  ::emplace(this->scales_with_primary, 24688);
-  ::emplace(this->scales_with_primary, 24698);
-  ::emplace(this->scales_with_primary, 24767);
-  ::emplace(this->scales_with_primary, 24819);
-  ::emplace(this->scales_with_primary, 24820);
-  ::emplace(this->scales_with_primary, 24821);
-  ::emplace(this->scales_with_primary, 24822);
-  ::emplace(this->scales_with_primary, 24823);
-  ::emplace(this->scales_with_primary, 24826);
-  ::emplace(this->scales_with_primary, 24835);
-  ::emplace(this->scales_with_primary, 24836);
-  ::emplace(this->scales_with_primary, 24837);
-  ::emplace(this->scales_with_primary, 24838);
-  ::emplace(this->scales_with_primary, 24839);
-  ::emplace(this->scales_with_primary, 24857);
-  ::emplace(this->scales_with_primary, 24942);
-  ::emplace(this->scales_with_primary, 24957);
-  ::emplace(this->scales_with_primary, 25021);
-  ::emplace(this->scales_with_primary, 25025);
-  ::emplace(this->scales_with_primary, 25030);
-  ::emplace(this->scales_with_primary, 25031);
-  ::emplace(this->scales_with_primary, 25033);
-  ::emplace(this->scales_with_primary, 25034);
-  ::emplace(this->scales_with_primary, 25049);
-  ::emplace(this->scales_with_primary, 25052);
-  ::emplace(this->scales_with_primary, 25053);
-  ::emplace(this->scales_with_primary, 25054);
-  ::emplace(this->scales_with_primary, 25055);
-  ::emplace(this->scales_with_primary, 25170);
-  ::emplace(this->scales_with_primary, 25188);
-  ::emplace(this->scales_with_primary, 25262);
-  ::emplace(this->scales_with_primary, 25322);
-  ::emplace(this->scales_with_primary, 25383);
-  ::emplace(this->scales_with_primary, 25424);
-  ::emplace(this->scales_with_primary, 25425);
-  ::emplace(this->scales_with_primary, 25497);
-  ::emplace(this->scales_with_primary, 25504);
-  ::emplace(this->scales_with_primary, 25586);
-  ::emplace(this->scales_with_primary, 25651);
-  ::emplace(this->scales_with_primary, 25654);
-  ::emplace(this->scales_with_primary, 25672);
-  ::emplace(this->scales_with_primary, 25679);
-  ::emplace(this->scales_with_primary, 25699);
-  ::emplace(this->scales_with_primary, 25743);
-  ::emplace(this->scales_with_primary, 25744);
-  ::emplace(this->scales_with_primary, 25748);
-  ::emplace(this->scales_with_primary, 25749);
-  ::emplace(this->scales_with_primary, 25756);
-  ::emplace(this->scales_with_primary, 25811);
-  ::emplace(this->scales_with_primary, 25812);
-  ::emplace(this->scales_with_primary, 25819);
-  ::emplace(this->scales_with_primary, 25912);
-  ::emplace(this->scales_with_primary, 25991);
-  ::emplace(this->scales_with_primary, 25993);
-  ::emplace(this->scales_with_primary, 26006);
-  ::emplace(this->scales_with_primary, 26048);
-  ::emplace(this->scales_with_primary, 26052);
-  ::emplace(this->scales_with_primary, 26059);
-  ::emplace(this->scales_with_primary, 26073);
-  ::emplace(this->scales_with_primary, 26093);
-  ::emplace(this->scales_with_primary, 26098);
-  ::emplace(this->scales_with_primary, 26102);
-  ::emplace(this->scales_with_primary, 26103);
-  ::emplace(this->scales_with_primary, 26134);
-  ::emplace(this->scales_with_primary, 26141);
-  ::emplace(this->scales_with_primary, 26192);
-  ::emplace(this->scales_with_primary, 26194);
-  ::emplace(this->scales_with_primary, 26211);
-  ::emplace(this->scales_with_primary, 26233);
-  ::emplace(this->scales_with_primary, 26282);
-  ::emplace(this->scales_with_primary, 26339);
-  ::emplace(this->scales_with_primary, 26458);
-  ::emplace(this->scales_with_primary, 26546);
-  ::emplace(this->scales_with_primary, 26550);
-  ::emplace(this->scales_with_primary, 26554);
-  ::emplace(this->scales_with_primary, 26555);
-  ::emplace(this->scales_with_primary, 26558);
-  ::emplace(this->scales_with_primary, 26601);
-  ::emplace(this->scales_with_primary, 26622);
-  ::emplace(this->scales_with_primary, 26623);
-  ::emplace(this->scales_with_primary, 26624);
-  ::emplace(this->scales_with_primary, 26625);
-  ::emplace(this->scales_with_primary, 26643);
-  ::emplace(this->scales_with_primary, 26649);
-  ::emplace(this->scales_with_primary, 26686);
-  ::emplace(this->scales_with_primary, 27285);
-  ::emplace(this->scales_with_primary, 27286);
-  ::emplace(this->scales_with_primary, 27338);
-  ::emplace(this->scales_with_primary, 27383);
-  ::emplace(this->scales_with_primary, 27554);
-  ::emplace(this->scales_with_primary, 27557);
-  ::emplace(this->scales_with_primary, 27567);
-  ::emplace(this->scales_with_primary, 27584);
-  ::emplace(this->scales_with_primary, 27611);
-  ::emplace(this->scales_with_primary, 27613);
-  ::emplace(this->scales_with_primary, 27620);
-  ::emplace(this->scales_with_primary, 27633);
-  ::emplace(this->scales_with_primary, 27635);
-  ::emplace(this->scales_with_primary, 27646);
-  ::emplace(this->scales_with_primary, 27807);
-  ::emplace(this->scales_with_primary, 27812);
-  ::emplace(this->scales_with_primary, 27831);
-  ::emplace(this->scales_with_primary, 27891);
-  ::emplace(this->scales_with_primary, 27919);
-  ::emplace(this->scales_with_primary, 27988);
-  ::emplace(this->scales_with_primary, 27989);
-  ::emplace(this->scales_with_primary, 28167);
-  ::emplace(this->scales_with_primary, 28269);
-  ::emplace(this->scales_with_primary, 28293);
-  ::emplace(this->scales_with_primary, 28322);
-  ::emplace(this->scales_with_primary, 28341);
-  ::emplace(this->scales_with_primary, 28358);
-  ::emplace(this->scales_with_primary, 28361);
-  ::emplace(this->scales_with_primary, 28407);
-  ::emplace(this->scales_with_primary, 28433);
-  ::emplace(this->scales_with_primary, 28448);
-  ::emplace(this->scales_with_primary, 28450);
-  ::emplace(this->scales_with_primary, 28459);
-  ::emplace(this->scales_with_primary, 28478);
-  ::emplace(this->scales_with_primary, 28479);
-  ::emplace(this->scales_with_primary, 28599);
-  ::emplace(this->scales_with_primary, 28741);
-  ::emplace(this->scales_with_primary, 28796);
-  ::emplace(this->scales_with_primary, 28882);
-  ::emplace(this->scales_with_primary, 28883);
-  ::emplace(this->scales_with_primary, 28884);
-  ::emplace(this->scales_with_primary, 28900);
-  ::emplace(this->scales_with_primary, 28993);
-  ::emplace(this->scales_with_primary, 29106);
-  ::emplace(this->scales_with_primary, 29148);
-  ::emplace(this->scales_with_primary, 29221);
-  ::emplace(this->scales_with_primary, 29317);
-  ::emplace(this->scales_with_primary, 29386);
-  ::emplace(this->scales_with_primary, 29425);
-  ::emplace(this->scales_with_primary, 29477);
-  ::emplace(this->scales_with_primary, 29487);
-  ::emplace(this->scales_with_primary, 29496);
-  ::emplace(this->scales_with_primary, 29512);
-  ::emplace(this->scales_with_primary, 29514);
-  ::emplace(this->scales_with_primary, 29522);
-  ::emplace(this->scales_with_primary, 29560);
-  ::emplace(this->scales_with_primary, 29563);
-  ::emplace(this->scales_with_primary, 29575);
-  ::emplace(this->scales_with_primary, 29579);
-  ::emplace(this->scales_with_primary, 29582);
-  ::emplace(this->scales_with_primary, 29586);
-  ::emplace(this->scales_with_primary, 29609);
-  ::emplace(this->scales_with_primary, 29618);
-  ::emplace(this->scales_with_primary, 29666);
-  ::emplace(this->scales_with_primary, 29676);
-  ::emplace(this->scales_with_primary, 29677);
-  ::emplace(this->scales_with_primary, 29680);
-  ::emplace(this->scales_with_primary, 29684);
-  ::emplace(this->scales_with_primary, 29711);
-  ::emplace(this->scales_with_primary, 29712);
-  ::emplace(this->scales_with_primary, 29717);
-  ::emplace(this->scales_with_primary, 29765);
-  ::emplace(this->scales_with_primary, 29766);
-  ::emplace(this->scales_with_primary, 29815);
-  ::emplace(this->scales_with_primary, 29849);
-  ::emplace(this->scales_with_primary, 29864);
-  ::emplace(this->scales_with_primary, 29885);
-  ::emplace(this->scales_with_primary, 29904);
-  ::emplace(this->scales_with_primary, 29905);
-  ::emplace(this->scales_with_primary, 29922);
-  ::emplace(this->scales_with_primary, 29923);
-  ::emplace(this->scales_with_primary, 29924);
-  ::emplace(this->scales_with_primary, 29925);
-  ::emplace(this->scales_with_primary, 29926);
-  ::emplace(this->scales_with_primary, 29927);
-  ::emplace(this->scales_with_primary, 29928);
-  ::emplace(this->scales_with_primary, 29939);
-  ::emplace(this->scales_with_primary, 29949);
-  ::emplace(this->scales_with_primary, 29953);
-  ::emplace(this->scales_with_primary, 29954);
-  ::emplace(this->scales_with_primary, 29956);
-  ::emplace(this->scales_with_primary, 29957);
-  ::emplace(this->scales_with_primary, 29958);
-  ::emplace(this->scales_with_primary, 29959);
-  ::emplace(this->scales_with_primary, 29973);
-  ::emplace(this->scales_with_primary, 29978);
-  ::emplace(this->scales_with_primary, 30043);
-  ::emplace(this->scales_with_primary, 30050);
-  ::emplace(this->scales_with_primary, 30055);
-  ::emplace(this->scales_with_primary, 30091);
-  ::emplace(this->scales_with_primary, 30094);
-  ::emplace(this->scales_with_primary, 30095);
-  ::emplace(this->scales_with_primary, 30096);
-  ::emplace(this->scales_with_primary, 30109);
-  ::emplace(this->scales_with_primary, 30111);
-  ::emplace(this->scales_with_primary, 30138);
-  ::emplace(this->scales_with_primary, 30153);
-  ::emplace(this->scales_with_primary, 30180);
-  ::emplace(this->scales_with_primary, 30210);
-  ::emplace(this->scales_with_primary, 30218);
-  ::emplace(this->scales_with_primary, 30235);
-  ::emplace(this->scales_with_primary, 30266);
-  ::emplace(this->scales_with_primary, 30267);
-  ::emplace(this->scales_with_primary, 30282);
-  ::emplace(this->scales_with_primary, 30354);
-  ::emplace(this->scales_with_primary, 30383);
-  ::emplace(this->scales_with_primary, 30451);
-  ::emplace(this->scales_with_primary, 30460);
-  ::emplace(this->scales_with_primary, 30510);
-  ::emplace(this->scales_with_primary, 30534);
-  ::emplace(this->scales_with_primary, 30599);
-  ::emplace(this->scales_with_primary, 30600);
-  ::emplace(this->scales_with_primary, 30605);
-  ::emplace(this->scales_with_primary, 30606);
-  ::emplace(this->scales_with_primary, 30607);
-  ::emplace(this->scales_with_primary, 30608);
-  ::emplace(this->scales_with_primary, 30609);
-  ::emplace(this->scales_with_primary, 30624);
-  ::emplace(this->scales_with_primary, 30633);
-  ::emplace(this->scales_with_primary, 30686);
-  ::emplace(this->scales_with_primary, 30688);
-  ::emplace(this->scales_with_primary, 30691);
-  ::emplace(this->scales_with_primary, 30860);
-  ::emplace(this->scales_with_primary, 30917);
-  ::emplace(this->scales_with_primary, 30926);
-  ::emplace(this->scales_with_primary, 30927);
-  ::emplace(this->scales_with_primary, 30930);
-  ::emplace(this->scales_with_primary, 30941);
-  ::emplace(this->scales_with_primary, 30942);
-  ::emplace(this->scales_with_primary, 30943);
-  ::emplace(this->scales_with_primary, 30967);
-  ::emplace(this->scales_with_primary, 30971);
-  ::emplace(this->scales_with_primary, 30979);
-  ::emplace(this->scales_with_primary, 30989);
-  ::emplace(this->scales_with_primary, 31249);
-  ::emplace(this->scales_with_primary, 31250);
-  ::emplace(this->scales_with_primary, 31262);
-  ::emplace(this->scales_with_primary, 31263);
-  ::emplace(this->scales_with_primary, 31270);
-  ::emplace(this->scales_with_primary, 31281);
-  ::emplace(this->scales_with_primary, 31283);
-  ::emplace(this->scales_with_primary, 31296);
-  ::emplace(this->scales_with_primary, 31302);
-  ::emplace(this->scales_with_primary, 31330);
-  ::emplace(this->scales_with_primary, 31401);
-  ::emplace(this->scales_with_primary, 31425);
-  ::emplace(this->scales_with_primary, 31436);
-  ::emplace(this->scales_with_primary, 31445);
-  ::emplace(this->scales_with_primary, 31472);
-  ::emplace(this->scales_with_primary, 31473);
-  ::emplace(this->scales_with_primary, 31475);
-  ::emplace(this->scales_with_primary, 31478);
-  ::emplace(this->scales_with_primary, 31486);
-  ::emplace(this->scales_with_primary, 31516);
-  ::emplace(this->scales_with_primary, 31608);
-  ::emplace(this->scales_with_primary, 31618);
-  ::emplace(this->scales_with_primary, 31620);
-  ::emplace(this->scales_with_primary, 31622);
-  ::emplace(this->scales_with_primary, 31627);
-  ::emplace(this->scales_with_primary, 31661);
-  ::emplace(this->scales_with_primary, 31664);
-  ::emplace(this->scales_with_primary, 31688);
-  ::emplace(this->scales_with_primary, 31707);
-  ::emplace(this->scales_with_primary, 31717);
-  ::emplace(this->scales_with_primary, 31740);
-  ::emplace(this->scales_with_primary, 31743);
-  ::emplace(this->scales_with_primary, 31756);
-  ::emplace(this->scales_with_primary, 31758);
-  ::emplace(this->scales_with_primary, 31759);
-  ::emplace(this->scales_with_primary, 31764);
-  ::emplace(this->scales_with_primary, 31784);
-  ::emplace(this->scales_with_primary, 31804);
-  ::emplace(this->scales_with_primary, 31914);
-  ::emplace(this->scales_with_primary, 31935);
-  ::emplace(this->scales_with_primary, 31962);
-  ::emplace(this->scales_with_primary, 31964);
-  ::emplace(this->scales_with_primary, 31969);
-  ::emplace(this->scales_with_primary, 31971);
-  ::emplace(this->scales_with_primary, 31984);
-  ::emplace(this->scales_with_primary, 32014);
-  ::emplace(this->scales_with_primary, 32026);
-  ::emplace(this->scales_with_primary, 32079);
-  ::emplace(this->scales_with_primary, 32093);
-  ::emplace(this->scales_with_primary, 32103);
-  ::emplace(this->scales_with_primary, 32110);
-  ::emplace(this->scales_with_primary, 32111);
-  ::emplace(this->scales_with_primary, 32132);
-  ::emplace(this->scales_with_primary, 32133);
-  ::emplace(this->scales_with_primary, 32167);
-  ::emplace(this->scales_with_primary, 32168);
-  ::emplace(this->scales_with_primary, 32175);
-  ::emplace(this->scales_with_primary, 32176);
-  ::emplace(this->scales_with_primary, 32190);
-  ::emplace(this->scales_with_primary, 32192);
-  ::emplace(this->scales_with_primary, 32193);
-  ::emplace(this->scales_with_primary, 32202);
-  ::emplace(this->scales_with_primary, 32248);
-  ::emplace(this->scales_with_primary, 32302);
-  ::emplace(this->scales_with_primary, 32309);
-  ::emplace(this->scales_with_primary, 32327);
-  ::emplace(this->scales_with_primary, 32328);
-  ::emplace(this->scales_with_primary, 32330);
-  ::emplace(this->scales_with_primary, 32337);
-  ::emplace(this->scales_with_primary, 32364);
-  ::emplace(this->scales_with_primary, 32365);
-  ::emplace(this->scales_with_primary, 32369);
-  ::emplace(this->scales_with_primary, 32370);
-  ::emplace(this->scales_with_primary, 32379);
-  ::emplace(this->scales_with_primary, 32414);
-  ::emplace(this->scales_with_primary, 32415);
-  ::emplace(this->scales_with_primary, 32422);
-  ::emplace(this->scales_with_primary, 32445);
-  ::emplace(this->scales_with_primary, 32491);
-  ::emplace(this->scales_with_primary, 32492);
-  ::emplace(this->scales_with_primary, 32614);
-  ::emplace(this->scales_with_primary, 32645);
-  ::emplace(this->scales_with_primary, 32666);
-  ::emplace(this->scales_with_primary, 32677);
-  ::emplace(this->scales_with_primary, 32690);
-  ::emplace(this->scales_with_primary, 32711);
-  ::emplace(this->scales_with_primary, 32735);
-  ::emplace(this->scales_with_primary, 32739);
-  ::emplace(this->scales_with_primary, 32741);
-  ::emplace(this->scales_with_primary, 32742);
-  ::emplace(this->scales_with_primary, 32772);
-  ::emplace(this->scales_with_primary, 32774);
-  ::emplace(this->scales_with_primary, 32778);
-  ::emplace(this->scales_with_primary, 32846);
-  ::emplace(this->scales_with_primary, 32860);
-  ::emplace(this->scales_with_primary, 32903);
-  ::emplace(this->scales_with_primary, 32914);
-  ::emplace(this->scales_with_primary, 32917);
-  ::emplace(this->scales_with_primary, 32935);
-  ::emplace(this->scales_with_primary, 32950);
-  ::emplace(this->scales_with_primary, 32963);
-  ::emplace(this->scales_with_primary, 32967);
-  ::emplace(this->scales_with_primary, 32969);
-  ::emplace(this->scales_with_primary, 32984);
-  ::emplace(this->scales_with_primary, 33047);
-  ::emplace(this->scales_with_primary, 33061);
-  ::emplace(this->scales_with_primary, 33175);
-  ::emplace(this->scales_with_primary, 33237);
-  ::emplace(this->scales_with_primary, 33417);
-  ::emplace(this->scales_with_primary, 33452);
-  ::emplace(this->scales_with_primary, 33462);
-  ::emplace(this->scales_with_primary, 33463);
-  ::emplace(this->scales_with_primary, 33501);
-  ::emplace(this->scales_with_primary, 33526);
-  ::emplace(this->scales_with_primary, 33527);
-  ::emplace(this->scales_with_primary, 33528);
-  ::emplace(this->scales_with_primary, 33529);
-  ::emplace(this->scales_with_primary, 33534);
-  ::emplace(this->scales_with_primary, 33553);
-  ::emplace(this->scales_with_primary, 33554);
-  ::emplace(this->scales_with_primary, 33620);
-  ::emplace(this->scales_with_primary, 33623);
-  ::emplace(this->scales_with_primary, 33632);
-  ::emplace(this->scales_with_primary, 33643);
-  ::emplace(this->scales_with_primary, 33657);
-  ::emplace(this->scales_with_primary, 33665);
-  ::emplace(this->scales_with_primary, 33707);
-  ::emplace(this->scales_with_primary, 33750);
-  ::emplace(this->scales_with_primary, 33775);
-  ::emplace(this->scales_with_primary, 33792);
-  ::emplace(this->scales_with_primary, 33793);
-  ::emplace(this->scales_with_primary, 33794);
-  ::emplace(this->scales_with_primary, 33833);
-  ::emplace(this->scales_with_primary, 33841);
-  ::emplace(this->scales_with_primary, 33846);
-  ::emplace(this->scales_with_primary, 33860);
-  ::emplace(this->scales_with_primary, 33871);
-  ::emplace(this->scales_with_primary, 33959);
-  ::emplace(this->scales_with_primary, 33967);
-  ::emplace(this->scales_with_primary, 33970);
-  ::emplace(this->scales_with_primary, 33971);
-  ::emplace(this->scales_with_primary, 33975);
-  ::emplace(this->scales_with_primary, 33989);
-  ::emplace(this->scales_with_primary, 34039);
-  ::emplace(this->scales_with_primary, 34072);
-  ::emplace(this->scales_with_primary, 34083);
-  ::emplace(this->scales_with_primary, 34111);
-  ::emplace(this->scales_with_primary, 34164);
-  ::emplace(this->scales_with_primary, 34232);
-  ::emplace(this->scales_with_primary, 34234);
-  ::emplace(this->scales_with_primary, 34268);
-  ::emplace(this->scales_with_primary, 34269);
-  ::emplace(this->scales_with_primary, 34290);
-  ::emplace(this->scales_with_primary, 34344);
-  ::emplace(this->scales_with_primary, 34345);
-  ::emplace(this->scales_with_primary, 34346);
-  ::emplace(this->scales_with_primary, 34347);
-  ::emplace(this->scales_with_primary, 34348);
-  ::emplace(this->scales_with_primary, 34352);
-  ::emplace(this->scales_with_primary, 34353);
-  ::emplace(this->scales_with_primary, 34354);
-  ::emplace(this->scales_with_primary, 34359);
-  ::emplace(this->scales_with_primary, 34363);
-  ::emplace(this->scales_with_primary, 34428);
-  ::emplace(this->scales_with_primary, 34447);
-  ::emplace(this->scales_with_primary, 34517);
-  ::emplace(this->scales_with_primary, 34528);
-  ::emplace(this->scales_with_primary, 34618);
-  ::emplace(this->scales_with_primary, 34641);
-  ::emplace(this->scales_with_primary, 34645);
-  ::emplace(this->scales_with_primary, 34653);
-  ::emplace(this->scales_with_primary, 34660);
-  ::emplace(this->scales_with_primary, 34672);
-  ::emplace(this->scales_with_primary, 34715);
-  ::emplace(this->scales_with_primary, 34745);
-  ::emplace(this->scales_with_primary, 34758);
-  ::emplace(this->scales_with_primary, 34780);
-  ::emplace(this->scales_with_primary, 34785);
-  ::emplace(this->scales_with_primary, 34791);
-  ::emplace(this->scales_with_primary, 34793);
-  ::emplace(this->scales_with_primary, 34797);
-  ::emplace(this->scales_with_primary, 34798);
-  ::emplace(this->scales_with_primary, 34802);
-  ::emplace(this->scales_with_primary, 34820);
-  ::emplace(this->scales_with_primary, 34824);
-  ::emplace(this->scales_with_primary, 34829);
-  ::emplace(this->scales_with_primary, 34856);
-  ::emplace(this->scales_with_primary, 34933);
-  ::emplace(this->scales_with_primary, 34934);
-  ::emplace(this->scales_with_primary, 34940);
-  ::emplace(this->scales_with_primary, 34944);
-  ::emplace(this->scales_with_primary, 35010);
-  ::emplace(this->scales_with_primary, 35012);
-  ::emplace(this->scales_with_primary, 35014);
-  ::emplace(this->scales_with_primary, 35015);
-  ::emplace(this->scales_with_primary, 35034);
-  ::emplace(this->scales_with_primary, 35040);
-  ::emplace(this->scales_with_primary, 35059);
-  ::emplace(this->scales_with_primary, 35072);
-  ::emplace(this->scales_with_primary, 35106);
-  ::emplace(this->scales_with_primary, 35108);
-  ::emplace(this->scales_with_primary, 35124);
-  ::emplace(this->scales_with_primary, 35132);
-  ::emplace(this->scales_with_primary, 35152);
-  ::emplace(this->scales_with_primary, 35178);
-  ::emplace(this->scales_with_primary, 35181);
-  ::emplace(this->scales_with_primary, 35236);
-  ::emplace(this->scales_with_primary, 35243);
-  ::emplace(this->scales_with_primary, 35250);
-  ::emplace(this->scales_with_primary, 35255);
-  ::emplace(this->scales_with_primary, 35261);
-  ::emplace(this->scales_with_primary, 35262);
-  ::emplace(this->scales_with_primary, 35267);
-  ::emplace(this->scales_with_primary, 35276);
-  ::emplace(this->scales_with_primary, 35283);
-  ::emplace(this->scales_with_primary, 35314);
-  ::emplace(this->scales_with_primary, 35316);
-  ::emplace(this->scales_with_primary, 35318);
-  ::emplace(this->scales_with_primary, 35320);
-  ::emplace(this->scales_with_primary, 35334);
-  ::emplace(this->scales_with_primary, 35351);
-  ::emplace(this->scales_with_primary, 35373);
-  ::emplace(this->scales_with_primary, 35377);
-  ::emplace(this->scales_with_primary, 35395);
-  ::emplace(this->scales_with_primary, 35401);
-  ::emplace(this->scales_with_primary, 35470);
-  ::emplace(this->scales_with_primary, 35486);
-  ::emplace(this->scales_with_primary, 35499);
-  ::emplace(this->scales_with_primary, 35735);
-  ::emplace(this->scales_with_primary, 35759);
-  ::emplace(this->scales_with_primary, 35767);
-  ::emplace(this->scales_with_primary, 35845);
-  ::emplace(this->scales_with_primary, 35853);
-  ::emplace(this->scales_with_primary, 35873);
-  ::emplace(this->scales_with_primary, 35891);
-  ::emplace(this->scales_with_primary, 35895);
-  ::emplace(this->scales_with_primary, 35913);
-  ::emplace(this->scales_with_primary, 35920);
-  ::emplace(this->scales_with_primary, 35925);
-  ::emplace(this->scales_with_primary, 35927);
-  ::emplace(this->scales_with_primary, 35946);
-  ::emplace(this->scales_with_primary, 36033);
-  ::emplace(this->scales_with_primary, 36040);
-  ::emplace(this->scales_with_primary, 36057);
-  ::emplace(this->scales_with_primary, 36148);
-  ::emplace(this->scales_with_primary, 36152);
-  ::emplace(this->scales_with_primary, 36176);
-  ::emplace(this->scales_with_primary, 36179);
-  ::emplace(this->scales_with_primary, 36214);
-  ::emplace(this->scales_with_primary, 36225);
-  ::emplace(this->scales_with_primary, 36227);
-  ::emplace(this->scales_with_primary, 36228);
-  ::emplace(this->scales_with_primary, 36238);
-  ::emplace(this->scales_with_primary, 36247);
-  ::emplace(this->scales_with_primary, 36249);
-  ::emplace(this->scales_with_primary, 36252);
-  ::emplace(this->scales_with_primary, 36255);
-  ::emplace(this->scales_with_primary, 36275);
-  ::emplace(this->scales_with_primary, 36277);
-  ::emplace(this->scales_with_primary, 36278);
-  ::emplace(this->scales_with_primary, 36279);
-  ::emplace(this->scales_with_primary, 36404);
-  ::emplace(this->scales_with_primary, 36470);
-  ::emplace(this->scales_with_primary, 36489);
-  ::emplace(this->scales_with_primary, 36500);
-  ::emplace(this->scales_with_primary, 36533);
-  ::emplace(this->scales_with_primary, 36534);
-  ::emplace(this->scales_with_primary, 36594);
-  ::emplace(this->scales_with_primary, 36607);
-  ::emplace(this->scales_with_primary, 36608);
-  ::emplace(this->scales_with_primary, 36609);
-  ::emplace(this->scales_with_primary, 36619);
-  ::emplace(this->scales_with_primary, 36623);
-  ::emplace(this->scales_with_primary, 36625);
-  ::emplace(this->scales_with_primary, 36627);
-  ::emplace(this->scales_with_primary, 36638);
-  ::emplace(this->scales_with_primary, 36645);
-  ::emplace(this->scales_with_primary, 36647);
-  ::emplace(this->scales_with_primary, 36654);
-  ::emplace(this->scales_with_primary, 36705);
-  ::emplace(this->scales_with_primary, 36706);
-  ::emplace(this->scales_with_primary, 36710);
-  ::emplace(this->scales_with_primary, 36711);
-  ::emplace(this->scales_with_primary, 36712);
-  ::emplace(this->scales_with_primary, 36713);
-  ::emplace(this->scales_with_primary, 36714);
-  ::emplace(this->scales_with_primary, 36717);
-  ::emplace(this->scales_with_primary, 36722);
-  ::emplace(this->scales_with_primary, 36731);
-  ::emplace(this->scales_with_primary, 36736);
-  ::emplace(this->scales_with_primary, 36738);
-  ::emplace(this->scales_with_primary, 36740);
-  ::emplace(this->scales_with_primary, 36741);
-  ::emplace(this->scales_with_primary, 36742);
-  ::emplace(this->scales_with_primary, 36743);
-  ::emplace(this->scales_with_primary, 36786);
-  ::emplace(this->scales_with_primary, 36807);
-  ::emplace(this->scales_with_primary, 36820);
-  ::emplace(this->scales_with_primary, 36827);
-  ::emplace(this->scales_with_primary, 36837);
-  ::emplace(this->scales_with_primary, 36841);
-  ::emplace(this->scales_with_primary, 36862);
-  ::emplace(this->scales_with_primary, 36864);
-  ::emplace(this->scales_with_primary, 36868);
-  ::emplace(this->scales_with_primary, 36876);
-  ::emplace(this->scales_with_primary, 36891);
-  ::emplace(this->scales_with_primary, 36894);
-  ::emplace(this->scales_with_primary, 36905);
-  ::emplace(this->scales_with_primary, 36906);
-  ::emplace(this->scales_with_primary, 36915);
-  ::emplace(this->scales_with_primary, 36920);
-  ::emplace(this->scales_with_primary, 36921);
-  ::emplace(this->scales_with_primary, 36947);
-  ::emplace(this->scales_with_primary, 36970);
-  ::emplace(this->scales_with_primary, 36971);
-  ::emplace(this->scales_with_primary, 36972);
-  ::emplace(this->scales_with_primary, 36980);
-  ::emplace(this->scales_with_primary, 36985);
-  ::emplace(this->scales_with_primary, 36986);
-  ::emplace(this->scales_with_primary, 36987);
-  ::emplace(this->scales_with_primary, 36989);
-  ::emplace(this->scales_with_primary, 36990);
-  ::emplace(this->scales_with_primary, 37078);
-  ::emplace(this->scales_with_primary, 37089);
-  ::emplace(this->scales_with_primary, 37102);
-  ::emplace(this->scales_with_primary, 37106);
-  ::emplace(this->scales_with_primary, 37109);
-  ::emplace(this->scales_with_primary, 37111);
-  ::emplace(this->scales_with_primary, 37123);
-  ::emplace(this->scales_with_primary, 37126);
-  ::emplace(this->scales_with_primary, 37129);
-  ::emplace(this->scales_with_primary, 37132);
-  ::emplace(this->scales_with_primary, 37133);
-  ::emplace(this->scales_with_primary, 37157);
-  ::emplace(this->scales_with_primary, 37158);
-  ::emplace(this->scales_with_primary, 37161);
-  ::emplace(this->scales_with_primary, 37250);
-  ::emplace(this->scales_with_primary, 37251);
-  ::emplace(this->scales_with_primary, 37255);
-  ::emplace(this->scales_with_primary, 37258);
-  ::emplace(this->scales_with_primary, 37259);
-  ::emplace(this->scales_with_primary, 37261);
-  ::emplace(this->scales_with_primary, 37262);
-  ::emplace(this->scales_with_primary, 37265);
-  ::emplace(this->scales_with_primary, 37267);
-  ::emplace(this->scales_with_primary, 37271);
-  ::emplace(this->scales_with_primary, 37272);
-  ::emplace(this->scales_with_primary, 37273);
-  ::emplace(this->scales_with_primary, 37289);
-  ::emplace(this->scales_with_primary, 37319);
-  ::emplace(this->scales_with_primary, 37328);
-  ::emplace(this->scales_with_primary, 37329);
-  ::emplace(this->scales_with_primary, 37332);
-  ::emplace(this->scales_with_primary, 37361);
-  ::emplace(this->scales_with_primary, 37371);
-  ::emplace(this->scales_with_primary, 37372);
-  ::emplace(this->scales_with_primary, 37488);
-  ::emplace(this->scales_with_primary, 37531);
-  ::emplace(this->scales_with_primary, 37628);
-  ::emplace(this->scales_with_primary, 37629);
-  ::emplace(this->scales_with_primary, 37638);
-  ::emplace(this->scales_with_primary, 37664);
-  ::emplace(this->scales_with_primary, 37665);
-  ::emplace(this->scales_with_primary, 37667);
-  ::emplace(this->scales_with_primary, 37669);
-  ::emplace(this->scales_with_primary, 37672);
-  ::emplace(this->scales_with_primary, 37675);
-  ::emplace(this->scales_with_primary, 37730);
-  ::emplace(this->scales_with_primary, 37734);
-  ::emplace(this->scales_with_primary, 37764);
-  ::emplace(this->scales_with_primary, 37839);
-  ::emplace(this->scales_with_primary, 37841);
-  ::emplace(this->scales_with_primary, 37856);
-  ::emplace(this->scales_with_primary, 37862);
-  ::emplace(this->scales_with_primary, 37864);
-  ::emplace(this->scales_with_primary, 37865);
-  ::emplace(this->scales_with_primary, 37930);
-  ::emplace(this->scales_with_primary, 37944);
-  ::emplace(this->scales_with_primary, 37945);
-  ::emplace(this->scales_with_primary, 37966);
-  ::emplace(this->scales_with_primary, 37990);
-  ::emplace(this->scales_with_primary, 37997);
-  ::emplace(this->scales_with_primary, 38030);
-  ::emplace(this->scales_with_primary, 38032);
-  ::emplace(this->scales_with_primary, 38033);
-  ::emplace(this->scales_with_primary, 38043);
-  ::emplace(this->scales_with_primary, 38052);
-  ::emplace(this->scales_with_primary, 38058);
-  ::emplace(this->scales_with_primary, 38085);
-  ::emplace(this->scales_with_primary, 38094);
-  ::emplace(this->scales_with_primary, 38109);
-  ::emplace(this->scales_with_primary, 38110);
-  ::emplace(this->scales_with_primary, 38113);
-  ::emplace(this->scales_with_primary, 38135);
-  ::emplace(this->scales_with_primary, 38136);
-  ::emplace(this->scales_with_primary, 38138);
-  ::emplace(this->scales_with_primary, 38141);
-  ::emplace(this->scales_with_primary, 38142);
-  ::emplace(this->scales_with_primary, 38143);
-  ::emplace(this->scales_with_primary, 38146);
-  ::emplace(this->scales_with_primary, 38147);
-  ::emplace(this->scales_with_primary, 38150);
-  ::emplace(this->scales_with_primary, 38183);
-  ::emplace(this->scales_with_primary, 38193);
-  ::emplace(this->scales_with_primary, 38197);
-  ::emplace(this->scales_with_primary, 38204);
-  ::emplace(this->scales_with_primary, 38205);
-  ::emplace(this->scales_with_primary, 38233);
-  ::emplace(this->scales_with_primary, 38234);
-  ::emplace(this->scales_with_primary, 38237);
-  ::emplace(this->scales_with_primary, 38238);
-  ::emplace(this->scales_with_primary, 38239);
-  ::emplace(this->scales_with_primary, 38253);
-  ::emplace(this->scales_with_primary, 38259);
-  ::emplace(this->scales_with_primary, 38264);
-  ::emplace(this->scales_with_primary, 38296);
-  ::emplace(this->scales_with_primary, 38309);
-  ::emplace(this->scales_with_primary, 38340);
-  ::emplace(this->scales_with_primary, 38354);
-  ::emplace(this->scales_with_primary, 38367);
-  ::emplace(this->scales_with_primary, 38368);
-  ::emplace(this->scales_with_primary, 38369);
-  ::emplace(this->scales_with_primary, 38372);
-  ::emplace(this->scales_with_primary, 38378);
-  ::emplace(this->scales_with_primary, 38382);
-  ::emplace(this->scales_with_primary, 38384);
-  ::emplace(this->scales_with_primary, 38386);
-  ::emplace(this->scales_with_primary, 38391);
-  ::emplace(this->scales_with_primary, 38401);
-  ::emplace(this->scales_with_primary, 38445);
-  ::emplace(this->scales_with_primary, 38459);
-  ::emplace(this->scales_with_primary, 38465);
-  ::emplace(this->scales_with_primary, 38468);
-  ::emplace(this->scales_with_primary, 38472);
-  ::emplace(this->scales_with_primary, 38496);
-  ::emplace(this->scales_with_primary, 38498);
-  ::emplace(this->scales_with_primary, 38509);
-  ::emplace(this->scales_with_primary, 38524);
-  ::emplace(this->scales_with_primary, 38533);
-  ::emplace(this->scales_with_primary, 38534);
-  ::emplace(this->scales_with_primary, 38535);
-  ::emplace(this->scales_with_primary, 38536);
-  ::emplace(this->scales_with_primary, 38537);
-  ::emplace(this->scales_with_primary, 38539);
-  ::emplace(this->scales_with_primary, 38582);
-  ::emplace(this->scales_with_primary, 38584);
-  ::emplace(this->scales_with_primary, 38585);
-  ::emplace(this->scales_with_primary, 38589);
-  ::emplace(this->scales_with_primary, 38593);
-  ::emplace(this->scales_with_primary, 38625);
-  ::emplace(this->scales_with_primary, 38628);
-  ::emplace(this->scales_with_primary, 38633);
-  ::emplace(this->scales_with_primary, 38634);
-  ::emplace(this->scales_with_primary, 38636);
-  ::emplace(this->scales_with_primary, 38641);
-  ::emplace(this->scales_with_primary, 38644);
-  ::emplace(this->scales_with_primary, 38645);
-  ::emplace(this->scales_with_primary, 38655);
-  ::emplace(this->scales_with_primary, 38712);
-  ::emplace(this->scales_with_primary, 38723);
-  ::emplace(this->scales_with_primary, 38725);
-  ::emplace(this->scales_with_primary, 38728);
-  ::emplace(this->scales_with_primary, 38733);
-  ::emplace(this->scales_with_primary, 38765);
-  ::emplace(this->scales_with_primary, 38783);
-  ::emplace(this->scales_with_primary, 38797);
-  ::emplace(this->scales_with_primary, 38806);
-  ::emplace(this->scales_with_primary, 38807);
-  ::emplace(this->scales_with_primary, 38808);
-  ::emplace(this->scales_with_primary, 38809);
-  ::emplace(this->scales_with_primary, 38811);
-  ::emplace(this->scales_with_primary, 38813);
-  ::emplace(this->scales_with_primary, 38814);
-  ::emplace(this->scales_with_primary, 38823);
-  ::emplace(this->scales_with_primary, 38824);
-  ::emplace(this->scales_with_primary, 38825);
-  ::emplace(this->scales_with_primary, 38826);
-  ::emplace(this->scales_with_primary, 38827);
-  ::emplace(this->scales_with_primary, 38829);
-  ::emplace(this->scales_with_primary, 38831);
-  ::emplace(this->scales_with_primary, 38835);
-  ::emplace(this->scales_with_primary, 38836);
-  ::emplace(this->scales_with_primary, 38837);
-  ::emplace(this->scales_with_primary, 38838);
-  ::emplace(this->scales_with_primary, 38839);
-  ::emplace(this->scales_with_primary, 38840);
-  ::emplace(this->scales_with_primary, 38843);
-  ::emplace(this->scales_with_primary, 38845);
-  ::emplace(this->scales_with_primary, 38849);
-  ::emplace(this->scales_with_primary, 38852);
-  ::emplace(this->scales_with_primary, 38863);
-  ::emplace(this->scales_with_primary, 38881);
-  ::emplace(this->scales_with_primary, 38886);
-  ::emplace(this->scales_with_primary, 38892);
-  ::emplace(this->scales_with_primary, 38893);
-  ::emplace(this->scales_with_primary, 38897);
-  ::emplace(this->scales_with_primary, 38903);
-  ::emplace(this->scales_with_primary, 38904);
-  ::emplace(this->scales_with_primary, 38912);
-  ::emplace(this->scales_with_primary, 38924);
-  ::emplace(this->scales_with_primary, 38930);
-  ::emplace(this->scales_with_primary, 38934);
-  ::emplace(this->scales_with_primary, 38935);
-  ::emplace(this->scales_with_primary, 38936);
-  ::emplace(this->scales_with_primary, 38940);
-  ::emplace(this->scales_with_primary, 38941);
-  ::emplace(this->scales_with_primary, 38967);
-  ::emplace(this->scales_with_primary, 38973);
-  ::emplace(this->scales_with_primary, 38974);
-  ::emplace(this->scales_with_primary, 38999);
-  ::emplace(this->scales_with_primary, 39001);
-  ::emplace(this->scales_with_primary, 39006);
-  ::emplace(this->scales_with_primary, 39016);
-  ::emplace(this->scales_with_primary, 39022);
-  ::emplace(this->scales_with_primary, 39023);
-  ::emplace(this->scales_with_primary, 39025);
-  ::emplace(this->scales_with_primary, 39026);
-  ::emplace(this->scales_with_primary, 39028);
-  ::emplace(this->scales_with_primary, 39033);
-  ::emplace(this->scales_with_primary, 39035);
-  ::emplace(this->scales_with_primary, 39036);
-  ::emplace(this->scales_with_primary, 39037);
-  ::emplace(this->scales_with_primary, 39038);
-  ::emplace(this->scales_with_primary, 39039);
-  ::emplace(this->scales_with_primary, 39049);
-  ::emplace(this->scales_with_primary, 39054);
-  ::emplace(this->scales_with_primary, 39056);
-  ::emplace(this->scales_with_primary, 39058);
-  ::emplace(this->scales_with_primary, 39060);
-  ::emplace(this->scales_with_primary, 39062);
-  ::emplace(this->scales_with_primary, 39063);
-  ::emplace(this->scales_with_primary, 39064);
-  ::emplace(this->scales_with_primary, 39065);
-  ::emplace(this->scales_with_primary, 39066);
-  ::emplace(this->scales_with_primary, 39079);
-  ::emplace(this->scales_with_primary, 39082);
-  ::emplace(this->scales_with_primary, 39083);
-  ::emplace(this->scales_with_primary, 39120);
-  ::emplace(this->scales_with_primary, 39121);
-  ::emplace(this->scales_with_primary, 39128);
-  ::emplace(this->scales_with_primary, 39129);
-  ::emplace(this->scales_with_primary, 39132);
-  ::emplace(this->scales_with_primary, 39133);
-  ::emplace(this->scales_with_primary, 39138);
-  ::emplace(this->scales_with_primary, 39139);
-  ::emplace(this->scales_with_primary, 39175);
-  ::emplace(this->scales_with_primary, 39192);
-  ::emplace(this->scales_with_primary, 39204);
-  ::emplace(this->scales_with_primary, 39252);
-  ::emplace(this->scales_with_primary, 39263);
-  ::emplace(this->scales_with_primary, 39267);
-  ::emplace(this->scales_with_primary, 39297);
-  ::emplace(this->scales_with_primary, 39309);
-  ::emplace(this->scales_with_primary, 39329);
-  ::emplace(this->scales_with_primary, 39337);
-  ::emplace(this->scales_with_primary, 39340);
-  ::emplace(this->scales_with_primary, 39348);
-  ::emplace(this->scales_with_primary, 39349);
-  ::emplace(this->scales_with_primary, 39365);
-  ::emplace(this->scales_with_primary, 39385);
-  ::emplace(this->scales_with_primary, 39414);
-  ::emplace(this->scales_with_primary, 39419);
-  ::emplace(this->scales_with_primary, 39429);
-  ::emplace(this->scales_with_primary, 39449);
-  ::emplace(this->scales_with_primary, 39529);
-  ::emplace(this->scales_with_primary, 39580);
-  ::emplace(this->scales_with_primary, 39587);
-  ::emplace(this->scales_with_primary, 39590);
-  ::emplace(this->scales_with_primary, 39593);
-  ::emplace(this->scales_with_primary, 39631);
-  ::emplace(this->scales_with_primary, 39632);
-  ::emplace(this->scales_with_primary, 39809);
-  ::emplace(this->scales_with_primary, 39945);
-  ::emplace(this->scales_with_primary, 40062);
-  ::emplace(this->scales_with_primary, 40064);
-  ::emplace(this->scales_with_primary, 40070);
-  ::emplace(this->scales_with_primary, 40078);
-  ::emplace(this->scales_with_primary, 40082);
-  ::emplace(this->scales_with_primary, 40083);
-  ::emplace(this->scales_with_primary, 40088);
-  ::emplace(this->scales_with_primary, 40089);
-  ::emplace(this->scales_with_primary, 40095);
-  ::emplace(this->scales_with_primary, 40096);
-  ::emplace(this->scales_with_primary, 40103);
-  ::emplace(this->scales_with_primary, 40124);
-  ::emplace(this->scales_with_primary, 40185);
-  ::emplace(this->scales_with_primary, 40265);
-  ::emplace(this->scales_with_primary, 40317);
-  ::emplace(this->scales_with_primary, 40344);
-  ::emplace(this->scales_with_primary, 40392);
-  ::emplace(this->scales_with_primary, 40413);
-  ::emplace(this->scales_with_primary, 40420);
-  ::emplace(this->scales_with_primary, 40424);
-  ::emplace(this->scales_with_primary, 40425);
-  ::emplace(this->scales_with_primary, 40428);
-  ::emplace(this->scales_with_primary, 40429);
-  ::emplace(this->scales_with_primary, 40430);
-  ::emplace(this->scales_with_primary, 40433);
-  ::emplace(this->scales_with_primary, 40496);
-  ::emplace(this->scales_with_primary, 40508);
-  ::emplace(this->scales_with_primary, 40536);
-  ::emplace(this->scales_with_primary, 40554);
-  ::emplace(this->scales_with_primary, 40562);
-  ::emplace(this->scales_with_primary, 40592);
-  ::emplace(this->scales_with_primary, 40593);
-  ::emplace(this->scales_with_primary, 40595);
-  ::emplace(this->scales_with_primary, 40633);
-  ::emplace(this->scales_with_primary, 40672);
-  ::emplace(this->scales_with_primary, 40718);
-  ::emplace(this->scales_with_primary, 40719);
-  ::emplace(this->scales_with_primary, 40721);
-  ::emplace(this->scales_with_primary, 40736);
-  ::emplace(this->scales_with_primary, 40810);
-  ::emplace(this->scales_with_primary, 40827);
-  ::emplace(this->scales_with_primary, 40843);
-  ::emplace(this->scales_with_primary, 40871);
-  ::emplace(this->scales_with_primary, 40873);
-  ::emplace(this->scales_with_primary, 40876);
-  ::emplace(this->scales_with_primary, 40877);
-  ::emplace(this->scales_with_primary, 40878);
-  ::emplace(this->scales_with_primary, 40898);
-  ::emplace(this->scales_with_primary, 40937);
-  ::emplace(this->scales_with_primary, 40939);
-  ::emplace(this->scales_with_primary, 40976);
-  ::emplace(this->scales_with_primary, 41063);
-  ::emplace(this->scales_with_primary, 41067);
-  ::emplace(this->scales_with_primary, 41069);
-  ::emplace(this->scales_with_primary, 41076);
-  ::emplace(this->scales_with_primary, 41093);
-  ::emplace(this->scales_with_primary, 41115);
-  ::emplace(this->scales_with_primary, 41116);
-  ::emplace(this->scales_with_primary, 41169);
-  ::emplace(this->scales_with_primary, 41172);
-  ::emplace(this->scales_with_primary, 41177);
-  ::emplace(this->scales_with_primary, 41180);
-  ::emplace(this->scales_with_primary, 41183);
-  ::emplace(this->scales_with_primary, 41184);
-  ::emplace(this->scales_with_primary, 41188);
-  ::emplace(this->scales_with_primary, 41195);
-  ::emplace(this->scales_with_primary, 41197);
-  ::emplace(this->scales_with_primary, 41229);
-  ::emplace(this->scales_with_primary, 41245);
-  ::emplace(this->scales_with_primary, 41265);
-  ::emplace(this->scales_with_primary, 41276);
-  ::emplace(this->scales_with_primary, 41280);
-  ::emplace(this->scales_with_primary, 41282);
-  ::emplace(this->scales_with_primary, 41353);
-  ::emplace(this->scales_with_primary, 41356);
-  ::emplace(this->scales_with_primary, 41357);
-  ::emplace(this->scales_with_primary, 41368);
-  ::emplace(this->scales_with_primary, 41370);
-  ::emplace(this->scales_with_primary, 41374);
-  ::emplace(this->scales_with_primary, 41375);
-  ::emplace(this->scales_with_primary, 41379);
-  ::emplace(this->scales_with_primary, 41380);
-  ::emplace(this->scales_with_primary, 41383);
-  ::emplace(this->scales_with_primary, 41384);
-  ::emplace(this->scales_with_primary, 41395);
-  ::emplace(this->scales_with_primary, 41438);
-  ::emplace(this->scales_with_primary, 41440);
-  ::emplace(this->scales_with_primary, 41444);
-  ::emplace(this->scales_with_primary, 41445);
-  ::emplace(this->scales_with_primary, 41470);
-  ::emplace(this->scales_with_primary, 41471);
-  ::emplace(this->scales_with_primary, 41472);
-  ::emplace(this->scales_with_primary, 41481);
-  ::emplace(this->scales_with_primary, 41483);
-  ::emplace(this->scales_with_primary, 41484);
-  ::emplace(this->scales_with_primary, 41486);
-  ::emplace(this->scales_with_primary, 41524);
-  ::emplace(this->scales_with_primary, 41572);
-  ::emplace(this->scales_with_primary, 41578);
-  ::emplace(this->scales_with_primary, 41596);
-  ::emplace(this->scales_with_primary, 41957);
-  ::emplace(this->scales_with_primary, 41958);
-  ::emplace(this->scales_with_primary, 41960);
-  ::emplace(this->scales_with_primary, 41982);
-  ::emplace(this->scales_with_primary, 41984);
-  ::emplace(this->scales_with_primary, 42024);
-  ::emplace(this->scales_with_primary, 42139);
-  ::emplace(this->scales_with_primary, 42223);
-  ::emplace(this->scales_with_primary, 42270);
-  ::emplace(this->scales_with_primary, 42362);
-  ::emplace(this->scales_with_primary, 42372);
-  ::emplace(this->scales_with_primary, 42382);
-  ::emplace(this->scales_with_primary, 42384);
-  ::emplace(this->scales_with_primary, 42441);
-  ::emplace(this->scales_with_primary, 42475);
-  ::emplace(this->scales_with_primary, 42476);
-  ::emplace(this->scales_with_primary, 42502);
-  ::emplace(this->scales_with_primary, 42579);
-  ::emplace(this->scales_with_primary, 42580);
-  ::emplace(this->scales_with_primary, 42719);
-  ::emplace(this->scales_with_primary, 42787);
-  ::emplace(this->scales_with_primary, 42829);
-  ::emplace(this->scales_with_primary, 42870);
-  ::emplace(this->scales_with_primary, 43083);
-  ::emplace(this->scales_with_primary, 43132);
-  ::emplace(this->scales_with_primary, 43150);
-  ::emplace(this->scales_with_primary, 43215);
-  ::emplace(this->scales_with_primary, 43267);
-  ::emplace(this->scales_with_primary, 43268);
-  ::emplace(this->scales_with_primary, 43294);
-  ::emplace(this->scales_with_primary, 43299);
-  ::emplace(this->scales_with_primary, 43325);
-  ::emplace(this->scales_with_primary, 43330);
-  ::emplace(this->scales_with_primary, 43413);
-  ::emplace(this->scales_with_primary, 43426);
-  ::emplace(this->scales_with_primary, 43427);
-  ::emplace(this->scales_with_primary, 43428);
-  ::emplace(this->scales_with_primary, 43435);
-  ::emplace(this->scales_with_primary, 43465);
-  ::emplace(this->scales_with_primary, 43510);
-  ::emplace(this->scales_with_primary, 43543);
-  ::emplace(this->scales_with_primary, 43562);
-  ::emplace(this->scales_with_primary, 43579);
-  ::emplace(this->scales_with_primary, 43582);
-  ::emplace(this->scales_with_primary, 43583);
-  ::emplace(this->scales_with_primary, 43584);
-  ::emplace(this->scales_with_primary, 43619);
-  ::emplace(this->scales_with_primary, 43649);
-  ::emplace(this->scales_with_primary, 43667);
-  ::emplace(this->scales_with_primary, 43757);
-  ::emplace(this->scales_with_primary, 43802);
-  ::emplace(this->scales_with_primary, 43829);
-  ::emplace(this->scales_with_primary, 43903);
-  ::emplace(this->scales_with_primary, 43928);
-  ::emplace(this->scales_with_primary, 43930);
-  ::emplace(this->scales_with_primary, 43991);
-  ::emplace(this->scales_with_primary, 44005);
-  ::emplace(this->scales_with_primary, 44033);
-  ::emplace(this->scales_with_primary, 44120);
-  ::emplace(this->scales_with_primary, 44164);
-  ::emplace(this->scales_with_primary, 44176);
-  ::emplace(this->scales_with_primary, 44177);
-  ::emplace(this->scales_with_primary, 44187);
-  ::emplace(this->scales_with_primary, 44188);
-  ::emplace(this->scales_with_primary, 44190);
-  ::emplace(this->scales_with_primary, 44267);
-  ::emplace(this->scales_with_primary, 44286);
-  ::emplace(this->scales_with_primary, 44314);
-  ::emplace(this->scales_with_primary, 44318);
-  ::emplace(this->scales_with_primary, 44319);
-  ::emplace(this->scales_with_primary, 44417);
-  ::emplace(this->scales_with_primary, 44418);
-  ::emplace(this->scales_with_primary, 44425);
-  ::emplace(this->scales_with_primary, 44477);
-  ::emplace(this->scales_with_primary, 44503);
-  ::emplace(this->scales_with_primary, 44504);
-  ::emplace(this->scales_with_primary, 44518);
-  ::emplace(this->scales_with_primary, 44519);
-  ::emplace(this->scales_with_primary, 44536);
-  ::emplace(this->scales_with_primary, 44538);
-  ::emplace(this->scales_with_primary, 44606);
-  ::emplace(this->scales_with_primary, 44640);
-  ::emplace(this->scales_with_primary, 44799);
-  ::emplace(this->scales_with_primary, 44843);
-  ::emplace(this->scales_with_primary, 44844);
-  ::emplace(this->scales_with_primary, 44949);
-  ::emplace(this->scales_with_primary, 44957);
-  ::emplace(this->scales_with_primary, 44961);
-  ::emplace(this->scales_with_primary, 44966);
-  ::emplace(this->scales_with_primary, 45018);
-  ::emplace(this->scales_with_primary, 45031);
-  ::emplace(this->scales_with_primary, 45065);
-  ::emplace(this->scales_with_primary, 45122);
-  ::emplace(this->scales_with_primary, 45232);
-  ::emplace(this->scales_with_primary, 45270);
-  ::emplace(this->scales_with_primary, 45284);
-  ::emplace(this->scales_with_primary, 45297);
-  ::emplace(this->scales_with_primary, 45329);
-  ::emplace(this->scales_with_primary, 45336);
-  ::emplace(this->scales_with_primary, 45578);
-  ::emplace(this->scales_with_primary, 45580);
-  ::emplace(this->scales_with_primary, 45664);
-  ::emplace(this->scales_with_primary, 45748);
-  ::emplace(this->scales_with_primary, 45768);
-  ::emplace(this->scales_with_primary, 45770);
-  ::emplace(this->scales_with_primary, 45779);
-  ::emplace(this->scales_with_primary, 45900);
-  ::emplace(this->scales_with_primary, 45905);
-  ::emplace(this->scales_with_primary, 45906);
-  ::emplace(this->scales_with_primary, 46035);
-  ::emplace(this->scales_with_primary, 46042);
-  ::emplace(this->scales_with_primary, 46043);
-  ::emplace(this->scales_with_primary, 46101);
-  ::emplace(this->scales_with_primary, 46150);
-  ::emplace(this->scales_with_primary, 46163);
-  ::emplace(this->scales_with_primary, 46180);
-  ::emplace(this->scales_with_primary, 46189);
-  ::emplace(this->scales_with_primary, 46191);
-  ::emplace(this->scales_with_primary, 46194);
-  ::emplace(this->scales_with_primary, 46279);
-  ::emplace(this->scales_with_primary, 46380);
-  ::emplace(this->scales_with_primary, 46381);
-  ::emplace(this->scales_with_primary, 46457);
-  ::emplace(this->scales_with_primary, 46480);
-  ::emplace(this->scales_with_primary, 46481);
-  ::emplace(this->scales_with_primary, 46551);
-  ::emplace(this->scales_with_primary, 46553);
-  ::emplace(this->scales_with_primary, 46555);
-  ::emplace(this->scales_with_primary, 46564);
-  ::emplace(this->scales_with_primary, 46608);
-  ::emplace(this->scales_with_primary, 46762);
-  ::emplace(this->scales_with_primary, 46771);
-  ::emplace(this->scales_with_primary, 46968);
-  ::emplace(this->scales_with_primary, 46984);
-  ::emplace(this->scales_with_primary, 46987);
-  ::emplace(this->scales_with_primary, 46988);
-  ::emplace(this->scales_with_primary, 47001);
-  ::emplace(this->scales_with_primary, 47071);
-  ::emplace(this->scales_with_primary, 47072);
-  ::emplace(this->scales_with_primary, 47074);
-  ::emplace(this->scales_with_primary, 47076);
-  ::emplace(this->scales_with_primary, 47077);
-  ::emplace(this->scales_with_primary, 47081);
-  ::emplace(this->scales_with_primary, 47248);
-  ::emplace(this->scales_with_primary, 47251);
-  ::emplace(this->scales_with_primary, 47629);
-  ::emplace(this->scales_with_primary, 47632);
-  ::emplace(this->scales_with_primary, 47666);
-  ::emplace(this->scales_with_primary, 47697);
-  ::emplace(this->scales_with_primary, 47723);
-  ::emplace(this->scales_with_primary, 47751);
-  ::emplace(this->scales_with_primary, 47773);
-  ::emplace(this->scales_with_primary, 48096);
-  ::emplace(this->scales_with_primary, 48132);
-  ::emplace(this->scales_with_primary, 48140);
-  ::emplace(this->scales_with_primary, 48179);
-  ::emplace(this->scales_with_primary, 48181);
-  ::emplace(this->scales_with_primary, 48246);
-  ::emplace(this->scales_with_primary, 48282);
-  ::emplace(this->scales_with_primary, 48283);
-  ::emplace(this->scales_with_primary, 48379);
-  ::emplace(this->scales_with_primary, 48423);
-  ::emplace(this->scales_with_primary, 48548);
-  ::emplace(this->scales_with_primary, 48619);
-  ::emplace(this->scales_with_primary, 48698);
-  ::emplace(this->scales_with_primary, 48699);
-  ::emplace(this->scales_with_primary, 48783);
-  ::emplace(this->scales_with_primary, 48854);
-  ::emplace(this->scales_with_primary, 48895);
-  ::emplace(this->scales_with_primary, 49084);
-  ::emplace(this->scales_with_primary, 49090);
-  ::emplace(this->scales_with_primary, 49091);
-  ::emplace(this->scales_with_primary, 49110);
-  ::emplace(this->scales_with_primary, 49111);
-  ::emplace(this->scales_with_primary, 49113);
-  ::emplace(this->scales_with_primary, 49161);
-  ::emplace(this->scales_with_primary, 49184);
-  ::emplace(this->scales_with_primary, 49205);
-  ::emplace(this->scales_with_primary, 49241);
-  ::emplace(this->scales_with_primary, 49317);
-  ::emplace(this->scales_with_primary, 49354);
-  ::emplace(this->scales_with_primary, 49366);
-  ::emplace(this->scales_with_primary, 49418);
-  ::emplace(this->scales_with_primary, 49454);
-  ::emplace(this->scales_with_primary, 49475);
-  ::emplace(this->scales_with_primary, 49512);
-  ::emplace(this->scales_with_primary, 49537);
-  ::emplace(this->scales_with_primary, 49549);
-  ::emplace(this->scales_with_primary, 49656);
-  ::emplace(this->scales_with_primary, 49696);
-  ::emplace(this->scales_with_primary, 49715);
-  ::emplace(this->scales_with_primary, 49716);
-  ::emplace(this->scales_with_primary, 49863);
-  ::emplace(this->scales_with_primary, 49884);
-  ::emplace(this->scales_with_primary, 49906);
-  ::emplace(this->scales_with_primary, 49966);
-  ::emplace(this->scales_with_primary, 49998);
-  ::emplace(this->scales_with_primary, 50092);
-  ::emplace(this->scales_with_primary, 50100);
-  ::emplace(this->scales_with_primary, 50107);
-  ::emplace(this->scales_with_primary, 50183);
-  ::emplace(this->scales_with_primary, 50198);
-  ::emplace(this->scales_with_primary, 50232);
-  ::emplace(this->scales_with_primary, 50302);
-  ::emplace(this->scales_with_primary, 50401);
-  ::emplace(this->scales_with_primary, 50455);
-  ::emplace(this->scales_with_primary, 50521);
-  ::emplace(this->scales_with_primary, 50522);
-  ::emplace(this->scales_with_primary, 50545);
-  ::emplace(this->scales_with_primary, 50578);
-  ::emplace(this->scales_with_primary, 50588);
-  ::emplace(this->scales_with_primary, 50622);
-  ::emplace(this->scales_with_primary, 50653);
-  ::emplace(this->scales_with_primary, 50702);
-  ::emplace(this->scales_with_primary, 50705);
-  ::emplace(this->scales_with_primary, 50721);
-  ::emplace(this->scales_with_primary, 50740);
-  ::emplace(this->scales_with_primary, 50752);
-  ::emplace(this->scales_with_primary, 50759);
-  ::emplace(this->scales_with_primary, 50785);
-  ::emplace(this->scales_with_primary, 50804);
-  ::emplace(this->scales_with_primary, 50830);
-  ::emplace(this->scales_with_primary, 50832);
-  ::emplace(this->scales_with_primary, 50838);
-  ::emplace(this->scales_with_primary, 50842);
-  ::emplace(this->scales_with_primary, 50843);
-  ::emplace(this->scales_with_primary, 50853);
-  ::emplace(this->scales_with_primary, 50854);
-  ::emplace(this->scales_with_primary, 50997);
-  ::emplace(this->scales_with_primary, 51021);
-  ::emplace(this->scales_with_primary, 51073);
-  ::emplace(this->scales_with_primary, 51103);
-  ::emplace(this->scales_with_primary, 51110);
-  ::emplace(this->scales_with_primary, 51144);
-  ::emplace(this->scales_with_primary, 51153);
-  ::emplace(this->scales_with_primary, 51218);
-  ::emplace(this->scales_with_primary, 51219);
-  ::emplace(this->scales_with_primary, 51243);
-  ::emplace(this->scales_with_primary, 51287);
-  ::emplace(this->scales_with_primary, 51334);
-  ::emplace(this->scales_with_primary, 51337);
-  ::emplace(this->scales_with_primary, 51339);
-  ::emplace(this->scales_with_primary, 51363);
-  ::emplace(this->scales_with_primary, 51432);
-  ::emplace(this->scales_with_primary, 51490);
-  ::emplace(this->scales_with_primary, 51587);
-  ::emplace(this->scales_with_primary, 51588);
-  ::emplace(this->scales_with_primary, 51608);
-  ::emplace(this->scales_with_primary, 51609);
-  ::emplace(this->scales_with_primary, 51618);
-  ::emplace(this->scales_with_primary, 51723);
-  ::emplace(this->scales_with_primary, 51725);
-  ::emplace(this->scales_with_primary, 51751);
-  ::emplace(this->scales_with_primary, 51768);
-  ::emplace(this->scales_with_primary, 51785);
-  ::emplace(this->scales_with_primary, 51806);
-  ::emplace(this->scales_with_primary, 51817);
-  ::emplace(this->scales_with_primary, 51818);
-  ::emplace(this->scales_with_primary, 51820);
-  ::emplace(this->scales_with_primary, 51830);
-  ::emplace(this->scales_with_primary, 51879);
-  ::emplace(this->scales_with_primary, 51898);
-  ::emplace(this->scales_with_primary, 51963);
-  ::emplace(this->scales_with_primary, 52105);
-  ::emplace(this->scales_with_primary, 52146);
-  ::emplace(this->scales_with_primary, 52174);
-  ::emplace(this->scales_with_primary, 52212);
-  ::emplace(this->scales_with_primary, 52257);
-  ::emplace(this->scales_with_primary, 52269);
-  ::emplace(this->scales_with_primary, 52282);
-  ::emplace(this->scales_with_primary, 52341);
-  ::emplace(this->scales_with_primary, 52383);
-  ::emplace(this->scales_with_primary, 52411);
-  ::emplace(this->scales_with_primary, 52433);
-  ::emplace(this->scales_with_primary, 52445);
-  ::emplace(this->scales_with_primary, 52492);
-  ::emplace(this->scales_with_primary, 52493);
-  ::emplace(this->scales_with_primary, 52501);
-  ::emplace(this->scales_with_primary, 52502);
-  ::emplace(this->scales_with_primary, 52526);
-  ::emplace(this->scales_with_primary, 52531);
-  ::emplace(this->scales_with_primary, 52534);
-  ::emplace(this->scales_with_primary, 52535);
-  ::emplace(this->scales_with_primary, 52566);
-  ::emplace(this->scales_with_primary, 52592);
-  ::emplace(this->scales_with_primary, 52671);
-  ::emplace(this->scales_with_primary, 52705);
-  ::emplace(this->scales_with_primary, 52722);
-  ::emplace(this->scales_with_primary, 52743);
-  ::emplace(this->scales_with_primary, 52754);
-  ::emplace(this->scales_with_primary, 52758);
-  ::emplace(this->scales_with_primary, 52761);
-  ::emplace(this->scales_with_primary, 52764);
-  ::emplace(this->scales_with_primary, 52807);
-  ::emplace(this->scales_with_primary, 52812);
-  ::emplace(this->scales_with_primary, 52818);
-  ::emplace(this->scales_with_primary, 52836);
-  ::emplace(this->scales_with_primary, 52870);
-  ::emplace(this->scales_with_primary, 52926);
-  ::emplace(this->scales_with_primary, 52931);
-  ::emplace(this->scales_with_primary, 52943);
-  ::emplace(this->scales_with_primary, 52944);
-  ::emplace(this->scales_with_primary, 52973);
-  ::emplace(this->scales_with_primary, 53043);
-  ::emplace(this->scales_with_primary, 53044);
-  ::emplace(this->scales_with_primary, 53051);
-  ::emplace(this->scales_with_primary, 53072);
-  ::emplace(this->scales_with_primary, 53086);
-  ::emplace(this->scales_with_primary, 53167);
-  ::emplace(this->scales_with_primary, 53314);
-  ::emplace(this->scales_with_primary, 53318);
-  ::emplace(this->scales_with_primary, 53327);
-  ::emplace(this->scales_with_primary, 53332);
-  ::emplace(this->scales_with_primary, 53333);
-  ::emplace(this->scales_with_primary, 53351);
-  ::emplace(this->scales_with_primary, 53363);
-  ::emplace(this->scales_with_primary, 53394);
-  ::emplace(this->scales_with_primary, 53493);
-  ::emplace(this->scales_with_primary, 53498);
-  ::emplace(this->scales_with_primary, 53595);
-  ::emplace(this->scales_with_primary, 53600);
-  ::emplace(this->scales_with_primary, 53616);
-  ::emplace(this->scales_with_primary, 53617);
-  ::emplace(this->scales_with_primary, 53638);
-  ::emplace(this->scales_with_primary, 53788);
-  ::emplace(this->scales_with_primary, 54049);
-  ::emplace(this->scales_with_primary, 54085);
-  ::emplace(this->scales_with_primary, 54094);
-  ::emplace(this->scales_with_primary, 54095);
-  ::emplace(this->scales_with_primary, 54096);
-  ::emplace(this->scales_with_primary, 54098);
-  ::emplace(this->scales_with_primary, 54113);
-  ::emplace(this->scales_with_primary, 54122);
-  ::emplace(this->scales_with_primary, 54195);
-  ::emplace(this->scales_with_primary, 54211);
-  ::emplace(this->scales_with_primary, 54226);
-  ::emplace(this->scales_with_primary, 54237);
-  ::emplace(this->scales_with_primary, 54261);
-  ::emplace(this->scales_with_primary, 54282);
-  ::emplace(this->scales_with_primary, 54326);
-  ::emplace(this->scales_with_primary, 54331);
-  ::emplace(this->scales_with_primary, 54334);
-  ::emplace(this->scales_with_primary, 54379);
-  ::emplace(this->scales_with_primary, 54380);
-  ::emplace(this->scales_with_primary, 54400);
-  ::emplace(this->scales_with_primary, 54431);
-  ::emplace(this->scales_with_primary, 54511);
-  ::emplace(this->scales_with_primary, 54531);
-  ::emplace(this->scales_with_primary, 54583);
-  ::emplace(this->scales_with_primary, 54617);
-  ::emplace(this->scales_with_primary, 54668);
-  ::emplace(this->scales_with_primary, 54684);
-  ::emplace(this->scales_with_primary, 54761);
-  ::emplace(this->scales_with_primary, 54769);
-  ::emplace(this->scales_with_primary, 54791);
-  ::emplace(this->scales_with_primary, 54847);
-  ::emplace(this->scales_with_primary, 54889);
-  ::emplace(this->scales_with_primary, 54890);
-  ::emplace(this->scales_with_primary, 54891);
-  ::emplace(this->scales_with_primary, 54916);
-  ::emplace(this->scales_with_primary, 54920);
-  ::emplace(this->scales_with_primary, 55087);
-  ::emplace(this->scales_with_primary, 55088);
-  ::emplace(this->scales_with_primary, 55090);
-  ::emplace(this->scales_with_primary, 55217);
-  ::emplace(this->scales_with_primary, 55274);
-  ::emplace(this->scales_with_primary, 55319);
-  ::emplace(this->scales_with_primary, 55323);
-  ::emplace(this->scales_with_primary, 55324);
-  ::emplace(this->scales_with_primary, 55467);
-  ::emplace(this->scales_with_primary, 55519);
-  ::emplace(this->scales_with_primary, 55607);
-  ::emplace(this->scales_with_primary, 55609);
-  ::emplace(this->scales_with_primary, 55613);
-  ::emplace(this->scales_with_primary, 55624);
-  ::emplace(this->scales_with_primary, 55635);
-  ::emplace(this->scales_with_primary, 55638);
-  ::emplace(this->scales_with_primary, 55659);
-  ::emplace(this->scales_with_primary, 55704);
-  ::emplace(this->scales_with_primary, 55765);
-  ::emplace(this->scales_with_primary, 55802);
-  ::emplace(this->scales_with_primary, 55807);
-  ::emplace(this->scales_with_primary, 55811);
-  ::emplace(this->scales_with_primary, 55850);
-  ::emplace(this->scales_with_primary, 55851);
-  ::emplace(this->scales_with_primary, 55856);
-  ::emplace(this->scales_with_primary, 55984);
-  ::emplace(this->scales_with_primary, 56032);
-  ::emplace(this->scales_with_primary, 56063);
-  ::emplace(this->scales_with_primary, 56064);
-  ::emplace(this->scales_with_primary, 56065);
-  ::emplace(this->scales_with_primary, 56067);
-  ::emplace(this->scales_with_primary, 56326);
-  ::emplace(this->scales_with_primary, 56405);
-  ::emplace(this->scales_with_primary, 56407);
-  ::emplace(this->scales_with_primary, 56441);
-  ::emplace(this->scales_with_primary, 56491);
-  ::emplace(this->scales_with_primary, 56506);
-  ::emplace(this->scales_with_primary, 56524);
-  ::emplace(this->scales_with_primary, 56581);
-  ::emplace(this->scales_with_primary, 56586);
-  ::emplace(this->scales_with_primary, 56641);
-  ::emplace(this->scales_with_primary, 56701);
-  ::emplace(this->scales_with_primary, 56733);
-  ::emplace(this->scales_with_primary, 56775);
-  ::emplace(this->scales_with_primary, 56776);
-  ::emplace(this->scales_with_primary, 56825);
-  ::emplace(this->scales_with_primary, 56837);
-  ::emplace(this->scales_with_primary, 56854);
-  ::emplace(this->scales_with_primary, 56858);
-  ::emplace(this->scales_with_primary, 56860);
-  ::emplace(this->scales_with_primary, 56861);
-  ::emplace(this->scales_with_primary, 56891);
-  ::emplace(this->scales_with_primary, 56908);
-  ::emplace(this->scales_with_primary, 56910);
-  ::emplace(this->scales_with_primary, 56920);
-  ::emplace(this->scales_with_primary, 56926);
-  ::emplace(this->scales_with_primary, 56934);
-  ::emplace(this->scales_with_primary, 56938);
-  ::emplace(this->scales_with_primary, 57051);
-  ::emplace(this->scales_with_primary, 57062);
-  ::emplace(this->scales_with_primary, 57076);
-  ::emplace(this->scales_with_primary, 57088);
-  ::emplace(this->scales_with_primary, 57091);
-  ::emplace(this->scales_with_primary, 57369);
-  ::emplace(this->scales_with_primary, 57374);
-  ::emplace(this->scales_with_primary, 57376);
-  ::emplace(this->scales_with_primary, 57377);
-  ::emplace(this->scales_with_primary, 57381);
-  ::emplace(this->scales_with_primary, 57464);
-  ::emplace(this->scales_with_primary, 57465);
-  ::emplace(this->scales_with_primary, 57466);
-  ::emplace(this->scales_with_primary, 57467);
-  ::emplace(this->scales_with_primary, 57477);
-  ::emplace(this->scales_with_primary, 57491);
-  ::emplace(this->scales_with_primary, 57557);
-  ::emplace(this->scales_with_primary, 57562);
-  ::emplace(this->scales_with_primary, 57570);
-  ::emplace(this->scales_with_primary, 57581);
-  ::emplace(this->scales_with_primary, 57585);
-  ::emplace(this->scales_with_primary, 57589);
-  ::emplace(this->scales_with_primary, 57591);
-  ::emplace(this->scales_with_primary, 57616);
-  ::emplace(this->scales_with_primary, 57617);
-  ::emplace(this->scales_with_primary, 57628);
-  ::emplace(this->scales_with_primary, 57629);
-  ::emplace(this->scales_with_primary, 57641);
-  ::emplace(this->scales_with_primary, 57644);
-  ::emplace(this->scales_with_primary, 57648);
-  ::emplace(this->scales_with_primary, 57652);
-  ::emplace(this->scales_with_primary, 57665);
-  ::emplace(this->scales_with_primary, 57668);
-  ::emplace(this->scales_with_primary, 57725);
-  ::emplace(this->scales_with_primary, 57755);
-  ::emplace(this->scales_with_primary, 57783);
-  ::emplace(this->scales_with_primary, 57790);
-  ::emplace(this->scales_with_primary, 57801);
-  ::emplace(this->scales_with_primary, 57815);
-  ::emplace(this->scales_with_primary, 57825);
-  ::emplace(this->scales_with_primary, 57841);
-  ::emplace(this->scales_with_primary, 57842);
-  ::emplace(this->scales_with_primary, 57942);
-  ::emplace(this->scales_with_primary, 57976);
-  ::emplace(this->scales_with_primary, 57984);
-  ::emplace(this->scales_with_primary, 58044);
-  ::emplace(this->scales_with_primary, 58455);
-  ::emplace(this->scales_with_primary, 58456);
-  ::emplace(this->scales_with_primary, 58457);
-  ::emplace(this->scales_with_primary, 58458);
-  ::emplace(this->scales_with_primary, 58462);
-  ::emplace(this->scales_with_primary, 58463);
-  ::emplace(this->scales_with_primary, 58531);
-  ::emplace(this->scales_with_primary, 58532);
-  ::emplace(this->scales_with_primary, 58534);
-  ::emplace(this->scales_with_primary, 58535);
-  ::emplace(this->scales_with_primary, 58536);
-  ::emplace(this->scales_with_primary, 58747);
-  ::emplace(this->scales_with_primary, 58809);
-  ::emplace(this->scales_with_primary, 58822);
-  ::emplace(this->scales_with_primary, 58827);
-  ::emplace(this->scales_with_primary, 58850);
-  ::emplace(this->scales_with_primary, 58903);
-  ::emplace(this->scales_with_primary, 58940);
-  ::emplace(this->scales_with_primary, 58956);
-  ::emplace(this->scales_with_primary, 58957);
-  ::emplace(this->scales_with_primary, 58971);
-  ::emplace(this->scales_with_primary, 58972);
-  ::emplace(this->scales_with_primary, 58973);
-  ::emplace(this->scales_with_primary, 58975);
-  ::emplace(this->scales_with_primary, 59001);
-  ::emplace(this->scales_with_primary, 59006);
-  ::emplace(this->scales_with_primary, 59013);
-  ::emplace(this->scales_with_primary, 59016);
-  ::emplace(this->scales_with_primary, 59024);
-  ::emplace(this->scales_with_primary, 59038);
-  ::emplace(this->scales_with_primary, 59081);
-  ::emplace(this->scales_with_primary, 59082);
-  ::emplace(this->scales_with_primary, 59104);
-  ::emplace(this->scales_with_primary, 59109);
-  ::emplace(this->scales_with_primary, 59126);
-  ::emplace(this->scales_with_primary, 59128);
-  ::emplace(this->scales_with_primary, 59141);
-  ::emplace(this->scales_with_primary, 59142);
-  ::emplace(this->scales_with_primary, 59146);
-  ::emplace(this->scales_with_primary, 59148);
-  ::emplace(this->scales_with_primary, 59152);
-  ::emplace(this->scales_with_primary, 59168);
-  ::emplace(this->scales_with_primary, 59169);
-  ::emplace(this->scales_with_primary, 59182);
-  ::emplace(this->scales_with_primary, 59210);
-  ::emplace(this->scales_with_primary, 59211);
-  ::emplace(this->scales_with_primary, 59212);
-  ::emplace(this->scales_with_primary, 59215);
-  ::emplace(this->scales_with_primary, 59220);
-  ::emplace(this->scales_with_primary, 59223);
-  ::emplace(this->scales_with_primary, 59241);
-  ::emplace(this->scales_with_primary, 59245);
-  ::emplace(this->scales_with_primary, 59246);
-  ::emplace(this->scales_with_primary, 59248);
-  ::emplace(this->scales_with_primary, 59249);
-  ::emplace(this->scales_with_primary, 59251);
-  ::emplace(this->scales_with_primary, 59253);
-  ::emplace(this->scales_with_primary, 59254);
-  ::emplace(this->scales_with_primary, 59255);
-  ::emplace(this->scales_with_primary, 59257);
-  ::emplace(this->scales_with_primary, 59258);
-  ::emplace(this->scales_with_primary, 59270);
-  ::emplace(this->scales_with_primary, 59273);
-  ::emplace(this->scales_with_primary, 59280);
-  ::emplace(this->scales_with_primary, 59304);
-  ::emplace(this->scales_with_primary, 59344);
-  ::emplace(this->scales_with_primary, 59346);
-  ::emplace(this->scales_with_primary, 59351);
-  ::emplace(this->scales_with_primary, 59357);
-  ::emplace(this->scales_with_primary, 59358);
-  ::emplace(this->scales_with_primary, 59359);
-  ::emplace(this->scales_with_primary, 59360);
-  ::emplace(this->scales_with_primary, 59366);
-  ::emplace(this->scales_with_primary, 59368);
-  ::emplace(this->scales_with_primary, 59372);
-  ::emplace(this->scales_with_primary, 59377);
-  ::emplace(this->scales_with_primary, 59381);
-  ::emplace(this->scales_with_primary, 59382);
-  ::emplace(this->scales_with_primary, 59389);
-  ::emplace(this->scales_with_primary, 59392);
-  ::emplace(this->scales_with_primary, 59452);
-  ::emplace(this->scales_with_primary, 59469);
-  ::emplace(this->scales_with_primary, 59477);
-  ::emplace(this->scales_with_primary, 59485);
-  ::emplace(this->scales_with_primary, 59507);
-  ::emplace(this->scales_with_primary, 59514);
-  ::emplace(this->scales_with_primary, 59516);
-  ::emplace(this->scales_with_primary, 59517);
-  ::emplace(this->scales_with_primary, 59519);
-  ::emplace(this->scales_with_primary, 59520);
-  ::emplace(this->scales_with_primary, 59530);
-  ::emplace(this->scales_with_primary, 59575);
-  ::emplace(this->scales_with_primary, 59601);
-  ::emplace(this->scales_with_primary, 59610);
-  ::emplace(this->scales_with_primary, 59633);
-  ::emplace(this->scales_with_primary, 59638);
-  ::emplace(this->scales_with_primary, 59678);
-  ::emplace(this->scales_with_primary, 59683);
-  ::emplace(this->scales_with_primary, 59684);
-  ::emplace(this->scales_with_primary, 59692);
-  ::emplace(this->scales_with_primary, 59700);
-  ::emplace(this->scales_with_primary, 59701);
-  ::emplace(this->scales_with_primary, 59703);
-  ::emplace(this->scales_with_primary, 59710);
-  ::emplace(this->scales_with_primary, 59715);
-  ::emplace(this->scales_with_primary, 59716);
-  ::emplace(this->scales_with_primary, 59717);
-  ::emplace(this->scales_with_primary, 59742);
-  ::emplace(this->scales_with_primary, 59772);
-  ::emplace(this->scales_with_primary, 59792);
-  ::emplace(this->scales_with_primary, 59834);
-  ::emplace(this->scales_with_primary, 59844);
-  ::emplace(this->scales_with_primary, 59853);
-  ::emplace(this->scales_with_primary, 59863);
-  ::emplace(this->scales_with_primary, 59881);
-  ::emplace(this->scales_with_primary, 59894);
-  ::emplace(this->scales_with_primary, 59963);
-  ::emplace(this->scales_with_primary, 59975);
-  ::emplace(this->scales_with_primary, 59986);
-  ::emplace(this->scales_with_primary, 59993);
-  ::emplace(this->scales_with_primary, 59994);
-  ::emplace(this->scales_with_primary, 59995);
-  ::emplace(this->scales_with_primary, 60008);
-  ::emplace(this->scales_with_primary, 60011);
-  ::emplace(this->scales_with_primary, 60015);
-  ::emplace(this->scales_with_primary, 60017);
-  ::emplace(this->scales_with_primary, 60103);
-  ::emplace(this->scales_with_primary, 60182);
-  ::emplace(this->scales_with_primary, 60205);
-  ::emplace(this->scales_with_primary, 60239);
-  ::emplace(this->scales_with_primary, 60447);
-  ::emplace(this->scales_with_primary, 60453);
-  ::emplace(this->scales_with_primary, 60500);
-  ::emplace(this->scales_with_primary, 60646);
-  ::emplace(this->scales_with_primary, 60667);
-  ::emplace(this->scales_with_primary, 60814);
-  ::emplace(this->scales_with_primary, 60845);
-  ::emplace(this->scales_with_primary, 60851);
-  ::emplace(this->scales_with_primary, 60859);
-  ::emplace(this->scales_with_primary, 60926);
-  ::emplace(this->scales_with_primary, 61016);
-  ::emplace(this->scales_with_primary, 61087);
-  ::emplace(this->scales_with_primary, 61163);
-  ::emplace(this->scales_with_primary, 61170);
-  ::emplace(this->scales_with_primary, 61193);
-  ::emplace(this->scales_with_primary, 61215);
-  ::emplace(this->scales_with_primary, 61362);
-  ::emplace(this->scales_with_primary, 61374);
-  ::emplace(this->scales_with_primary, 61376);
-  ::emplace(this->scales_with_primary, 61402);
-  ::emplace(this->scales_with_primary, 61461);
-  ::emplace(this->scales_with_primary, 61462);
-  ::emplace(this->scales_with_primary, 61463);
-  ::emplace(this->scales_with_primary, 61491);
-  ::emplace(this->scales_with_primary, 61515);
-  ::emplace(this->scales_with_primary, 61528);
-  ::emplace(this->scales_with_primary, 61558);
-  ::emplace(this->scales_with_primary, 61572);
-  ::emplace(this->scales_with_primary, 61577);
-  ::emplace(this->scales_with_primary, 61584);
-  ::emplace(this->scales_with_primary, 61589);
-  ::emplace(this->scales_with_primary, 61590);
-  ::emplace(this->scales_with_primary, 61591);
-  ::emplace(this->scales_with_primary, 61593);
-  ::emplace(this->scales_with_primary, 61594);
-  ::emplace(this->scales_with_primary, 61597);
-  ::emplace(this->scales_with_primary, 61598);
-  ::emplace(this->scales_with_primary, 61602);
-  ::emplace(this->scales_with_primary, 61730);
-  ::emplace(this->scales_with_primary, 61747);
-  ::emplace(this->scales_with_primary, 61879);
-  ::emplace(this->scales_with_primary, 61893);
-  ::emplace(this->scales_with_primary, 61909);
-  ::emplace(this->scales_with_primary, 61924);
-  ::emplace(this->scales_with_primary, 62129);
-  ::emplace(this->scales_with_primary, 62131);
-  ::emplace(this->scales_with_primary, 62249);
-  ::emplace(this->scales_with_primary, 62250);
-  ::emplace(this->scales_with_primary, 62316);
-  ::emplace(this->scales_with_primary, 62327);
-  ::emplace(this->scales_with_primary, 62332);
-  ::emplace(this->scales_with_primary, 62335);
-  ::emplace(this->scales_with_primary, 62402);
-  ::emplace(this->scales_with_primary, 62417);
-  ::emplace(this->scales_with_primary, 62420);
-  ::emplace(this->scales_with_primary, 62443);
-  ::emplace(this->scales_with_primary, 62445);
-  ::emplace(this->scales_with_primary, 62469);
-  ::emplace(this->scales_with_primary, 62580);
-  ::emplace(this->scales_with_primary, 62583);
-  ::emplace(this->scales_with_primary, 62597);
-  ::emplace(this->scales_with_primary, 62601);
-  ::emplace(this->scales_with_primary, 62604);
-  ::emplace(this->scales_with_primary, 62605);
-  ::emplace(this->scales_with_primary, 62648);
-  ::emplace(this->scales_with_primary, 62649);
-  ::emplace(this->scales_with_primary, 62714);
-  ::emplace(this->scales_with_primary, 62793);
-  ::emplace(this->scales_with_primary, 62938);
-  ::emplace(this->scales_with_primary, 62939);
-  ::emplace(this->scales_with_primary, 63002);
-  ::emplace(this->scales_with_primary, 63038);
-  ::emplace(this->scales_with_primary, 63157);
-  ::emplace(this->scales_with_primary, 63233);
-  ::emplace(this->scales_with_primary, 63247);
-  ::emplace(this->scales_with_primary, 63259);
-  ::emplace(this->scales_with_primary, 63479);
-  ::emplace(this->scales_with_primary, 63541);
-  ::emplace(this->scales_with_primary, 63548);
-  ::emplace(this->scales_with_primary, 63568);
-  ::emplace(this->scales_with_primary, 63569);
-  ::emplace(this->scales_with_primary, 63757);
-  ::emplace(this->scales_with_primary, 63775);
-  ::emplace(this->scales_with_primary, 63779);
-  ::emplace(this->scales_with_primary, 63803);
-  ::emplace(this->scales_with_primary, 63884);
-  ::emplace(this->scales_with_primary, 63912);
-  ::emplace(this->scales_with_primary, 63913);
-  ::emplace(this->scales_with_primary, 64141);
-  ::emplace(this->scales_with_primary, 64213);
-  ::emplace(this->scales_with_primary, 64215);
-  ::emplace(this->scales_with_primary, 64363);
-  ::emplace(this->scales_with_primary, 64365);
-  ::emplace(this->scales_with_primary, 64377);
-  ::emplace(this->scales_with_primary, 64390);
-  ::emplace(this->scales_with_primary, 64599);
-  ::emplace(this->scales_with_primary, 64607);
-  ::emplace(this->scales_with_primary, 64645);
-  ::emplace(this->scales_with_primary, 64655);
-  ::emplace(this->scales_with_primary, 64663);
-  ::emplace(this->scales_with_primary, 64697);
-  ::emplace(this->scales_with_primary, 64698);
-  ::emplace(this->scales_with_primary, 64699);
-  ::emplace(this->scales_with_primary, 64720);
-  ::emplace(this->scales_with_primary, 64721);
-  ::emplace(this->scales_with_primary, 64737);
-  ::emplace(this->scales_with_primary, 64758);
-  ::emplace(this->scales_with_primary, 64759);
-  ::emplace(this->scales_with_primary, 64870);
-  ::emplace(this->scales_with_primary, 64991);
-  ::emplace(this->scales_with_primary, 65128);
-  ::emplace(this->scales_with_primary, 65209);
-  ::emplace(this->scales_with_primary, 65260);
-  ::emplace(this->scales_with_primary, 65792);
-  ::emplace(this->scales_with_primary, 65987);
-  ::emplace(this->scales_with_primary, 66042);
-  ::emplace(this->scales_with_primary, 66044);
-  ::emplace(this->scales_with_primary, 66188);
-  ::emplace(this->scales_with_primary, 66196);
-  ::emplace(this->scales_with_primary, 66198);
-  ::emplace(this->scales_with_primary, 66489);
-  ::emplace(this->scales_with_primary, 66528);
-  ::emplace(this->scales_with_primary, 66536);
-  ::emplace(this->scales_with_primary, 66538);
-  ::emplace(this->scales_with_primary, 66546);
-  ::emplace(this->scales_with_primary, 66619);
-  ::emplace(this->scales_with_primary, 66813);
-  ::emplace(this->scales_with_primary, 67289);
-  ::emplace(this->scales_with_primary, 67793);
-  ::emplace(this->scales_with_primary, 68551);
-  ::emplace(this->scales_with_primary, 68847);
-  ::emplace(this->scales_with_primary, 68866);
-  ::emplace(this->scales_with_primary, 68884);
-  ::emplace(this->scales_with_primary, 69019);
-  ::emplace(this->scales_with_primary, 69028);
-  ::emplace(this->scales_with_primary, 69058);
-  ::emplace(this->scales_with_primary, 69060);
-  ::emplace(this->scales_with_primary, 69068);
-  ::emplace(this->scales_with_primary, 69080);
-  ::emplace(this->scales_with_primary, 69148);
-  ::emplace(this->scales_with_primary, 69273);
-  ::emplace(this->scales_with_primary, 69274);
-  ::emplace(this->scales_with_primary, 69387);
-  ::emplace(this->scales_with_primary, 69490);
-  ::emplace(this->scales_with_primary, 69520);
-  ::emplace(this->scales_with_primary, 69528);
-  ::emplace(this->scales_with_primary, 69567);
-  ::emplace(this->scales_with_primary, 69570);
-  ::emplace(this->scales_with_primary, 69571);
-  ::emplace(this->scales_with_primary, 69573);
-  ::emplace(this->scales_with_primary, 69576);
-  ::emplace(this->scales_with_primary, 69577);
-  ::emplace(this->scales_with_primary, 69581);
-  ::emplace(this->scales_with_primary, 69582);
-  ::emplace(this->scales_with_primary, 69771);
-  ::emplace(this->scales_with_primary, 69772);
-  ::emplace(this->scales_with_primary, 69965);
-  ::emplace(this->scales_with_primary, 69967);
-  ::emplace(this->scales_with_primary, 69968);
-  ::emplace(this->scales_with_primary, 70043);
-  ::emplace(this->scales_with_primary, 70074);
-  ::emplace(this->scales_with_primary, 70080);
-  ::emplace(this->scales_with_primary, 70145);
-  ::emplace(this->scales_with_primary, 70327);
-  ::emplace(this->scales_with_primary, 70386);
-  ::emplace(this->scales_with_primary, 70392);
-  ::emplace(this->scales_with_primary, 70395);
-  ::emplace(this->scales_with_primary, 70407);
-  ::emplace(this->scales_with_primary, 70512);
-  ::emplace(this->scales_with_primary, 70516);
-  ::emplace(this->scales_with_primary, 70754);
-  ::emplace(this->scales_with_primary, 70759);
-  ::emplace(this->scales_with_primary, 70866);
-  ::emplace(this->scales_with_primary, 70985);
-  ::emplace(this->scales_with_primary, 71088);
-  ::emplace(this->scales_with_primary, 71250);
-  ::emplace(this->scales_with_primary, 71253);
-  ::emplace(this->scales_with_primary, 71254);
-  ::emplace(this->scales_with_primary, 71320);
-  ::emplace(this->scales_with_primary, 71341);
-  ::emplace(this->scales_with_primary, 71361);
-  ::emplace(this->scales_with_primary, 71386);
-  ::emplace(this->scales_with_primary, 71393);
-  ::emplace(this->scales_with_primary, 71405);
-  ::emplace(this->scales_with_primary, 71420);
-  ::emplace(this->scales_with_primary, 71546);
-  ::emplace(this->scales_with_primary, 71778);
-  ::emplace(this->scales_with_primary, 71815);
-  ::emplace(this->scales_with_primary, 71927);
-  ::emplace(this->scales_with_primary, 71928);
-  ::emplace(this->scales_with_primary, 71929);
-  ::emplace(this->scales_with_primary, 71933);
-  ::emplace(this->scales_with_primary, 71936);
-  ::emplace(this->scales_with_primary, 71938);
-  ::emplace(this->scales_with_primary, 72123);
-  ::emplace(this->scales_with_primary, 72166);
-  ::emplace(this->scales_with_primary, 72169);
-  ::emplace(this->scales_with_primary, 72208);
-  ::emplace(this->scales_with_primary, 72255);
-  ::emplace(this->scales_with_primary, 72268);
-  ::emplace(this->scales_with_primary, 72320);
-  ::emplace(this->scales_with_primary, 72380);
-  ::emplace(this->scales_with_primary, 72728);
-  ::emplace(this->scales_with_primary, 72901);
-  ::emplace(this->scales_with_primary, 72905);
-  ::emplace(this->scales_with_primary, 72960);
-  ::emplace(this->scales_with_primary, 72999);
-  ::emplace(this->scales_with_primary, 73079);
-  ::emplace(this->scales_with_primary, 73510);
-  ::emplace(this->scales_with_primary, 73899);
-  ::emplace(this->scales_with_primary, 73975);
-  ::emplace(this->scales_with_primary, 74414);
-  ::emplace(this->scales_with_primary, 74525);
-  ::emplace(this->scales_with_primary, 74531);
-  ::emplace(this->scales_with_primary, 74762);
-  ::emplace(this->scales_with_primary, 74806);
-  ::emplace(this->scales_with_primary, 75168);
-  ::emplace(this->scales_with_primary, 75314);
-  ::emplace(this->scales_with_primary, 75327);
-  ::emplace(this->scales_with_primary, 75329);
-  ::emplace(this->scales_with_primary, 75330);
-  ::emplace(this->scales_with_primary, 75332);
-  ::emplace(this->scales_with_primary, 75362);
-  ::emplace(this->scales_with_primary, 75383);
-  ::emplace(this->scales_with_primary, 75384);
-  ::emplace(this->scales_with_primary, 75412);
-  ::emplace(this->scales_with_primary, 75413);
-  ::emplace(this->scales_with_primary, 75423);
-  ::emplace(this->scales_with_primary, 75483);
-  ::emplace(this->scales_with_primary, 76533);
-  ::emplace(this->scales_with_primary, 77575);
-  ::emplace(this->scales_with_primary, 77758);
-  ::emplace(this->scales_with_primary, 78674);
-  ::emplace(this->scales_with_primary, 78723);
-  ::emplace(this->scales_with_primary, 79136);
-  ::emplace(this->scales_with_primary, 80313);
-  ::emplace(this->scales_with_primary, 3356);
-  ::emplace(this->scales_with_primary, 6254);
-  ::emplace(this->scales_with_primary, 6257);
-  ::emplace(this->scales_with_primary, 7588);
-  ::emplace(this->scales_with_primary, 7803);
-  ::emplace(this->scales_with_primary, 7951);
-  ::emplace(this->scales_with_primary, 8078);
-  ::emplace(this->scales_with_primary, 8142);
-  ::emplace(this->scales_with_primary, 8147);
-  ::emplace(this->scales_with_primary, 8292);
-  ::emplace(this->scales_with_primary, 8398);
-  ::emplace(this->scales_with_primary, 8555);
-  ::emplace(this->scales_with_primary, 8600);
-  ::emplace(this->scales_with_primary, 9435);
-  ::emplace(this->scales_with_primary, 11831);
-  ::emplace(this->scales_with_primary, 12058);
-  ::emplace(this->scales_with_primary, 12540);
-  ::emplace(this->scales_with_primary, 12553);
-  ::emplace(this->scales_with_primary, 12555);
-  ::emplace(this->scales_with_primary, 12626);
-  ::emplace(this->scales_with_primary, 12742);
-  ::emplace(this->scales_with_primary, 13281);
-  ::emplace(this->scales_with_primary, 13579);
-  ::emplace(this->scales_with_primary, 13608);
-  ::emplace(this->scales_with_primary, 14030);
-  ::emplace(this->scales_with_primary, 15089);
-  ::emplace(this->scales_with_primary, 15091);
-  ::emplace(this->scales_with_primary, 15548);
-  ::emplace(this->scales_with_primary, 15588);
-  ::emplace(this->scales_with_primary, 15609);
-  ::emplace(this->scales_with_primary, 15661);
-  ::emplace(this->scales_with_primary, 15732);
-  ::emplace(this->scales_with_primary, 15744);
-  ::emplace(this->scales_with_primary, 16046);
-  ::emplace(this->scales_with_primary, 16844);
-  ::emplace(this->scales_with_primary, 16866);
-  ::emplace(this->scales_with_primary, 17145);
-  ::emplace(this->scales_with_primary, 17277);
-  ::emplace(this->scales_with_primary, 17393);
-  ::emplace(this->scales_with_primary, 17434);
-  ::emplace(this->scales_with_primary, 17435);
-  ::emplace(this->scales_with_primary, 17466);
-  ::emplace(this->scales_with_primary, 17631);
-  ::emplace(this->scales_with_primary, 17883);
-  ::emplace(this->scales_with_primary, 18099);
-  ::emplace(this->scales_with_primary, 18270);
-  ::emplace(this->scales_with_primary, 20565);
-  ::emplace(this->scales_with_primary, 20667);
-  ::emplace(this->scales_with_primary, 20716);
-  ::emplace(this->scales_with_primary, 20787);
-  ::emplace(this->scales_with_primary, 20800);
-  ::emplace(this->scales_with_primary, 20826);
-  ::emplace(this->scales_with_primary, 21067);
-  ::emplace(this->scales_with_primary, 21748);
-  ::emplace(this->scales_with_primary, 21749);
-  ::emplace(this->scales_with_primary, 21832);
-  ::emplace(this->scales_with_primary, 21868);
-  ::emplace(this->scales_with_primary, 22419);
-  ::emplace(this->scales_with_primary, 22422);
-  ::emplace(this->scales_with_primary, 22424);
-  ::emplace(this->scales_with_primary, 22595);
-  ::emplace(this->scales_with_primary, 22709);
-  ::emplace(this->scales_with_primary, 22743);
-  ::emplace(this->scales_with_primary, 22920);
-  ::emplace(this->scales_with_primary, 22924);
-  ::emplace(this->scales_with_primary, 22938);
-  ::emplace(this->scales_with_primary, 22940);
-  ::emplace(this->scales_with_primary, 22945);
-  ::emplace(this->scales_with_primary, 23039);
-  ::emplace(this->scales_with_primary, 23113);
-  ::emplace(this->scales_with_primary, 30092);
-  ::emplace(this->scales_with_primary, 32224);
-  ::emplace(this->scales_with_primary, 32707);
-  ::emplace(this->scales_with_primary, 37668);
-  ::emplace(this->scales_with_primary, 38064);
-  ::emplace(this->scales_with_primary, 38858);
-  ::emplace(this->scales_with_primary, 39592);
-  ::emplace(this->scales_with_primary, 49711);
-  ::emplace(this->scales_with_primary, 50086);
-  ::emplace(this->scales_with_primary, 50273);
-  ::emplace(this->scales_with_primary, 51783);
-  ::emplace(this->scales_with_primary, 51797);
-  ::emplace(this->scales_with_primary, 53113);
-  ::emplace(this->scales_with_primary, 57780);
-  ::emplace(this->scales_with_primary, 58970);
-  ::emplace(this->scales_with_primary, 59217);
-  ::emplace(this->scales_with_primary, 59260);
-  ::emplace(this->scales_with_primary, 60290);
-  ::emplace(this->scales_with_primary, 61871);
-  ::emplace(this->scales_with_primary, 62342);
-  ::emplace(this->scales_with_primary, 62682);
-  ::emplace(this->scales_with_primary, 62818);
-  ::emplace(this->scales_with_primary, 62975);
-  ::emplace(this->scales_with_primary, 62982);
-  ::emplace(this->scales_with_primary, 63758);
-  ::emplace(this->scales_with_primary, 64041);
-  ::emplace(this->scales_with_primary, 65060);
-  ::emplace(this->scales_with_primary, 65172);
-  ::emplace(this->scales_with_primary, 65624);
-  ::emplace(this->scales_with_primary, 66117);
-  ::emplace(this->scales_with_primary, 66275);
-  ::emplace(this->scales_with_primary, 66277);
-  ::emplace(this->scales_with_primary, 66966);
-  ::emplace(this->scales_with_primary, 66968);
-  ::emplace(this->scales_with_primary, 68208);
-  ::emplace(this->scales_with_primary, 68209);
-  ::emplace(this->scales_with_primary, 68246);
-  ::emplace(this->scales_with_primary, 68263);
-  ::emplace(this->scales_with_primary, 68549);
-  ::emplace(this->scales_with_primary, 68670);
-  ::emplace(this->scales_with_primary, 69041);
-  ::emplace(this->scales_with_primary, 69591);
-  ::emplace(this->scales_with_primary, 71791);
-  ::emplace(this->scales_with_primary, 71812);
-  ::emplace(this->scales_with_primary, 71973);
-  ::emplace(this->scales_with_primary, 72991);
-  ::emplace(this->scales_with_primary, 73087);
-  ::emplace(this->scales_with_primary, 73124);
-  ::emplace(this->scales_with_primary, 73212);
-  ::emplace(this->scales_with_primary, 73254);
-  ::emplace(this->scales_with_primary, 73255);
-  ::emplace(this->scales_with_primary, 73527);
-  ::emplace(this->scales_with_primary, 73564);
-  ::emplace(this->scales_with_primary, 73722);
-  ::emplace(this->scales_with_primary, 73872);
-  ::emplace(this->scales_with_primary, 73963);
-  ::emplace(this->scales_with_primary, 74019);
-  ::emplace(this->scales_with_primary, 74020);
-  ::emplace(this->scales_with_primary, 74021);
-  ::emplace(this->scales_with_primary, 74045);
-  ::emplace(this->scales_with_primary, 74121);
-  ::emplace(this->scales_with_primary, 74122);
-  ::emplace(this->scales_with_primary, 74374);
-  ::emplace(this->scales_with_primary, 74498);
-  ::emplace(this->scales_with_primary, 74588);
-  ::emplace(this->scales_with_primary, 74613);
-  ::emplace(this->scales_with_primary, 74716);
-  ::emplace(this->scales_with_primary, 74724);
-  ::emplace(this->scales_with_primary, 74726);
-  ::emplace(this->scales_with_primary, 74811);
-  ::emplace(this->scales_with_primary, 74814);
-  ::emplace(this->scales_with_primary, 74817);
-  ::emplace(this->scales_with_primary, 74888);
-  ::emplace(this->scales_with_primary, 74906);
-  ::emplace(this->scales_with_primary, 75019);
-  ::emplace(this->scales_with_primary, 75023);
-  ::emplace(this->scales_with_primary, 75062);
-  ::emplace(this->scales_with_primary, 75068);
-  ::emplace(this->scales_with_primary, 75073);
-  ::emplace(this->scales_with_primary, 75153);
-  ::emplace(this->scales_with_primary, 75702);
-  ::emplace(this->scales_with_primary, 75761);
-  ::emplace(this->scales_with_primary, 75775);
-  ::emplace(this->scales_with_primary, 75851);
-  ::emplace(this->scales_with_primary, 75946);
-  ::emplace(this->scales_with_primary, 76002);
-  ::emplace(this->scales_with_primary, 76007);
-  ::emplace(this->scales_with_primary, 76059);
-  ::emplace(this->scales_with_primary, 76067);
-  ::emplace(this->scales_with_primary, 76070);
-  ::emplace(this->scales_with_primary, 76110);
-  ::emplace(this->scales_with_primary, 76134);
-  ::emplace(this->scales_with_primary, 76146);
-  ::emplace(this->scales_with_primary, 76160);
-  ::emplace(this->scales_with_primary, 76171);
-  ::emplace(this->scales_with_primary, 76186);
-  ::emplace(this->scales_with_primary, 76246);
-  ::emplace(this->scales_with_primary, 76328);
-  ::emplace(this->scales_with_primary, 76402);
-  ::emplace(this->scales_with_primary, 76430);
-  ::emplace(this->scales_with_primary, 76473);
-  ::emplace(this->scales_with_primary, 76478);
-  ::emplace(this->scales_with_primary, 76506);
-  ::emplace(this->scales_with_primary, 76508);
-  ::emplace(this->scales_with_primary, 76509);
-  ::emplace(this->scales_with_primary, 76572);
-  ::emplace(this->scales_with_primary, 76584);
-  ::emplace(this->scales_with_primary, 76589);
-  ::emplace(this->scales_with_primary, 76612);
-  ::emplace(this->scales_with_primary, 76618);
-  ::emplace(this->scales_with_primary, 76621);
-  ::emplace(this->scales_with_primary, 76680);
-  ::emplace(this->scales_with_primary, 76682);
-  ::emplace(this->scales_with_primary, 76717);
-  ::emplace(this->scales_with_primary, 76718);
-  ::emplace(this->scales_with_primary, 76732);
-  ::emplace(this->scales_with_primary, 76733);
-  ::emplace(this->scales_with_primary, 76735);
-  ::emplace(this->scales_with_primary, 76783);
-  ::emplace(this->scales_with_primary, 76815);
-  ::emplace(this->scales_with_primary, 76843);
-  ::emplace(this->scales_with_primary, 76876);
-  ::emplace(this->scales_with_primary, 76881);
-  ::emplace(this->scales_with_primary, 77065);
-  ::emplace(this->scales_with_primary, 77069);
-  ::emplace(this->scales_with_primary, 77160);
-  ::emplace(this->scales_with_primary, 77209);
-  ::emplace(this->scales_with_primary, 77213);
-  ::emplace(this->scales_with_primary, 77216);
-  ::emplace(this->scales_with_primary, 77345);
-  ::emplace(this->scales_with_primary, 77425);
-  ::emplace(this->scales_with_primary, 77427);
-  ::emplace(this->scales_with_primary, 77496);
-  ::emplace(this->scales_with_primary, 77500);
-  ::emplace(this->scales_with_primary, 77570);
-  ::emplace(this->scales_with_primary, 77663);
-  ::emplace(this->scales_with_primary, 77695);
-  ::emplace(this->scales_with_primary, 77703);
-  ::emplace(this->scales_with_primary, 77718);
-  ::emplace(this->scales_with_primary, 77722);
-  ::emplace(this->scales_with_primary, 77731);
-  ::emplace(this->scales_with_primary, 77805);
-  ::emplace(this->scales_with_primary, 77889);
-  ::emplace(this->scales_with_primary, 77921);
-  ::emplace(this->scales_with_primary, 78143);
-  ::emplace(this->scales_with_primary, 78162);
-  ::emplace(this->scales_with_primary, 78331);
-  ::emplace(this->scales_with_primary, 78509);
-  ::emplace(this->scales_with_primary, 78521);
-  ::emplace(this->scales_with_primary, 78542);
-  ::emplace(this->scales_with_primary, 78702);
-  ::emplace(this->scales_with_primary, 78743);
-  ::emplace(this->scales_with_primary, 78755);
-  ::emplace(this->scales_with_primary, 78772);
-  ::emplace(this->scales_with_primary, 78802);
-  ::emplace(this->scales_with_primary, 78808);
-  ::emplace(this->scales_with_primary, 78832);
-  ::emplace(this->scales_with_primary, 78842);
-  ::emplace(this->scales_with_primary, 78907);
-  ::emplace(this->scales_with_primary, 78916);
-  ::emplace(this->scales_with_primary, 78921);
-  ::emplace(this->scales_with_primary, 79085);
-  ::emplace(this->scales_with_primary, 79086);
-  ::emplace(this->scales_with_primary, 79087);
-  ::emplace(this->scales_with_primary, 79091);
-  ::emplace(this->scales_with_primary, 79174);
-  ::emplace(this->scales_with_primary, 79353);
-  ::emplace(this->scales_with_primary, 79454);
-  ::emplace(this->scales_with_primary, 79465);
-  ::emplace(this->scales_with_primary, 79539);
-  ::emplace(this->scales_with_primary, 79558);
-  ::emplace(this->scales_with_primary, 79565);
-  ::emplace(this->scales_with_primary, 79571);
-  ::emplace(this->scales_with_primary, 79604);
-  ::emplace(this->scales_with_primary, 79610);
-  ::emplace(this->scales_with_primary, 79765);
-  ::emplace(this->scales_with_primary, 79822);
-  ::emplace(this->scales_with_primary, 79846);
-  ::emplace(this->scales_with_primary, 79847);
-  ::emplace(this->scales_with_primary, 79850);
-  ::emplace(this->scales_with_primary, 79852);
-  ::emplace(this->scales_with_primary, 79854);
-  ::emplace(this->scales_with_primary, 79856);
-  ::emplace(this->scales_with_primary, 79857);
-  ::emplace(this->scales_with_primary, 79858);
-  ::emplace(this->scales_with_primary, 79859);
-  ::emplace(this->scales_with_primary, 79868);
-  ::emplace(this->scales_with_primary, 79884);
-  ::emplace(this->scales_with_primary, 79886);
-  ::emplace(this->scales_with_primary, 79890);
-  ::emplace(this->scales_with_primary, 79913);
-  ::emplace(this->scales_with_primary, 79925);
-  ::emplace(this->scales_with_primary, 79932);
-  ::emplace(this->scales_with_primary, 79937);
-  ::emplace(this->scales_with_primary, 79938);
-  ::emplace(this->scales_with_primary, 79939);
-  ::emplace(this->scales_with_primary, 79965);
-  ::emplace(this->scales_with_primary, 80127);
-  ::emplace(this->scales_with_primary, 80173);
-  ::emplace(this->scales_with_primary, 80206);
-  ::emplace(this->scales_with_primary, 80272);
-  ::emplace(this->scales_with_primary, 80331);
-  ::emplace(this->scales_with_primary, 80336);
-  ::emplace(this->scales_with_primary, 80338);
-  ::emplace(this->scales_with_primary, 80344);
-  ::emplace(this->scales_with_primary, 80380);
-  ::emplace(this->scales_with_primary, 80391);
-  ::emplace(this->scales_with_primary, 80453);
-  ::emplace(this->scales_with_primary, 80546);
-  ::emplace(this->scales_with_primary, 80646);
-  ::emplace(this->scales_with_primary, 80649);
-  ::emplace(this->scales_with_primary, 80750);
-  ::emplace(this->scales_with_primary, 80780);
-  ::emplace(this->scales_with_primary, 80781);
-  ::emplace(this->scales_with_primary, 80944);
-  ::emplace(this->scales_with_primary, 80998);
-  ::emplace(this->scales_with_primary, 81013);
-  ::emplace(this->scales_with_primary, 81029);
-  ::emplace(this->scales_with_primary, 81030);
-  ::emplace(this->scales_with_primary, 81038);
-  ::emplace(this->scales_with_primary, 81109);
-  ::emplace(this->scales_with_primary, 81167);
-  ::emplace(this->scales_with_primary, 81181);
-  ::emplace(this->scales_with_primary, 81205);
-  ::emplace(this->scales_with_primary, 81224);
-  ::emplace(this->scales_with_primary, 81236);
-  ::emplace(this->scales_with_primary, 81249);
-  ::emplace(this->scales_with_primary, 81253);
-  ::emplace(this->scales_with_primary, 81305);
-  ::emplace(this->scales_with_primary, 81418);
-  ::emplace(this->scales_with_primary, 81429);
-  ::emplace(this->scales_with_primary, 81430);
-  ::emplace(this->scales_with_primary, 81439);
-  ::emplace(this->scales_with_primary, 81440);
-  ::emplace(this->scales_with_primary, 81521);
-  ::emplace(this->scales_with_primary, 81561);
-  ::emplace(this->scales_with_primary, 81576);
-  ::emplace(this->scales_with_primary, 81650);
-  ::emplace(this->scales_with_primary, 81655);
-  ::emplace(this->scales_with_primary, 81695);
-  ::emplace(this->scales_with_primary, 81297);
-  ::emplace(this->scales_with_primary, 81995);
-  ::emplace(this->scales_with_primary, 81996);
-  ::emplace(this->scales_with_primary, 82119);
-  ::emplace(this->scales_with_primary, 82533);
-  ::emplace(this->scales_with_primary, 82622);
-  ::emplace(this->scales_with_primary, 82637);
-  ::emplace(this->scales_with_primary, 82640);
-  ::emplace(this->scales_with_primary, 82641);
-  ::emplace(this->scales_with_primary, 82669);
-  ::emplace(this->scales_with_primary, 82698);
-  ::emplace(this->scales_with_primary, 82744);
-  ::emplace(this->scales_with_primary, 82765);
-  ::emplace(this->scales_with_primary, 82812);
-  ::emplace(this->scales_with_primary, 82816);
-  ::emplace(this->scales_with_primary, 82935);
-  ::emplace(this->scales_with_primary, 83002);
-  ::emplace(this->scales_with_primary, 78799);
-  ::emplace(this->scales_with_primary, 83021);
-  ::emplace(this->scales_with_primary, 83068);
-  ::emplace(this->scales_with_primary, 83264);
-  ::emplace(this->scales_with_primary, 83381);
-  ::emplace(this->scales_with_primary, 83385);
-  ::emplace(this->scales_with_primary, 83455);
-  ::emplace(this->scales_with_primary, 83492);
-  ::emplace(this->scales_with_primary, 83498);
-  ::emplace(this->scales_with_primary, 83574);
-  ::emplace(this->scales_with_primary, 83578);
-  ::emplace(this->scales_with_primary, 83596);
-  ::emplace(this->scales_with_primary, 83597);
-  ::emplace(this->scales_with_primary, 83721);
-  ::emplace(this->scales_with_primary, 83725);
-  ::emplace(this->scales_with_primary, 83734);
-  ::emplace(this->scales_with_primary, 83791);
-  ::emplace(this->scales_with_primary, 83794);
-  ::emplace(this->scales_with_primary, 83795);
-  ::emplace(this->scales_with_primary, 83799);
-  ::emplace(this->scales_with_primary, 83855);
-  ::emplace(this->scales_with_primary, 83914);
-  ::emplace(this->scales_with_primary, 83918);
-  ::emplace(this->scales_with_primary, 83920);
-  ::emplace(this->scales_with_primary, 84014);
-  ::emplace(this->scales_with_primary, 84032);
-  ::emplace(this->scales_with_primary, 84125);
-  ::emplace(this->scales_with_primary, 84150);
-  ::emplace(this->scales_with_primary, 84309);
-  ::emplace(this->scales_with_primary, 84402);
-  ::emplace(this->scales_with_primary, 84439);
-  ::emplace(this->scales_with_primary, 84443);
-  ::emplace(this->scales_with_primary, 84451);
-  ::emplace(this->scales_with_primary, 84466);
-  ::emplace(this->scales_with_primary, 84469);
-  ::emplace(this->scales_with_primary, 84490);
-  ::emplace(this->scales_with_primary, 84545);
-  ::emplace(this->scales_with_primary, 84618);
-  ::emplace(this->scales_with_primary, 84630);
-  ::emplace(this->scales_with_primary, 84634);
-  ::emplace(this->scales_with_primary, 84659);
-  ::emplace(this->scales_with_primary, 84665);
-  ::emplace(this->scales_with_primary, 84675);
-  ::emplace(this->scales_with_primary, 84721);
-  ::emplace(this->scales_with_primary, 84763);
-  ::emplace(this->scales_with_primary, 84766);
-  ::emplace(this->scales_with_primary, 84816);
-  ::emplace(this->scales_with_primary, 84825);
-  ::emplace(this->scales_with_primary, 84829);
-  ::emplace(this->scales_with_primary, 84833);
-  ::emplace(this->scales_with_primary, 84869);
-  ::emplace(this->scales_with_primary, 84872);
-  ::emplace(this->scales_with_primary, 85083);
-  ::emplace(this->scales_with_primary, 85232);
-  ::emplace(this->scales_with_primary, 85384);
-  ::emplace(this->scales_with_primary, 85536);
-  ::emplace(this->scales_with_primary, 85562);
-  ::emplace(this->scales_with_primary, 85563);
-  ::emplace(this->scales_with_primary, 85687);
-  ::emplace(this->scales_with_primary, 85692);
-  ::emplace(this->scales_with_primary, 85714);
-  ::emplace(this->scales_with_primary, 85715);
-  ::emplace(this->scales_with_primary, 85786);
-  ::emplace(this->scales_with_primary, 85800);
-  ::emplace(this->scales_with_primary, 85802);
-  ::emplace(this->scales_with_primary, 85948);
-  ::emplace(this->scales_with_primary, 85963);
-  ::emplace(this->scales_with_primary, 85964);
-  ::emplace(this->scales_with_primary, 85965);
-  ::emplace(this->scales_with_primary, 86040);
-  ::emplace(this->scales_with_primary, 86392);
-  ::emplace(this->scales_with_primary, 86633);
-  ::emplace(this->scales_with_primary, 86704);
-  ::emplace(this->scales_with_primary, 86798);
-  ::emplace(this->scales_with_primary, 86800);
-  ::emplace(this->scales_with_primary, 87215);
-  ::emplace(this->scales_with_primary, 87235);
-  ::emplace(this->scales_with_primary, 87276);
-  ::emplace(this->scales_with_primary, 87387);
-  ::emplace(this->scales_with_primary, 87393);
-  ::emplace(this->scales_with_primary, 87480);
-  ::emplace(this->scales_with_primary, 87553);
-  ::emplace(this->scales_with_primary, 87593);
-  ::emplace(this->scales_with_primary, 87660);
-  ::emplace(this->scales_with_primary, 87727);
-  ::emplace(this->scales_with_primary, 88032);
-  ::emplace(this->scales_with_primary, 88075);
-  ::emplace(this->scales_with_primary, 88082);
-  ::emplace(this->scales_with_primary, 88084);
-  ::emplace(this->scales_with_primary, 88188);
-  ::emplace(this->scales_with_primary, 88263);
-  ::emplace(this->scales_with_primary, 88357);
-  ::emplace(this->scales_with_primary, 88625);
-  ::emplace(this->scales_with_primary, 88660);
-  ::emplace(this->scales_with_primary, 88751);
-  ::emplace(this->scales_with_primary, 88771);
-  ::emplace(this->scales_with_primary, 88814);
-  ::emplace(this->scales_with_primary, 88876);
-  ::emplace(this->scales_with_primary, 88886);
-  ::emplace(this->scales_with_primary, 88902);
-  ::emplace(this->scales_with_primary, 88959);
-  ::emplace(this->scales_with_primary, 89091);
-  ::emplace(this->scales_with_primary, 89497);
-  ::emplace(this->scales_with_primary, 89507);
-  ::emplace(this->scales_with_primary, 89538);
-  ::emplace(this->scales_with_primary, 89539);
-  ::emplace(this->scales_with_primary, 89710);
-  ::emplace(this->scales_with_primary, 89753);
-  ::emplace(this->scales_with_primary, 89902);
-  ::emplace(this->scales_with_primary, 89905);
-  ::emplace(this->scales_with_primary, 89909);
-  ::emplace(this->scales_with_primary, 90051);
-  ::emplace(this->scales_with_primary, 90052);
-  ::emplace(this->scales_with_primary, 90053);
-  ::emplace(this->scales_with_primary, 90073);
-  ::emplace(this->scales_with_primary, 90215);
-  ::emplace(this->scales_with_primary, 90255);
-  ::emplace(this->scales_with_primary, 90273);
-  ::emplace(this->scales_with_primary, 90275);
-  ::emplace(this->scales_with_primary, 90381);
-  ::emplace(this->scales_with_primary, 90387);
-  ::emplace(this->scales_with_primary, 90446);
-  ::emplace(this->scales_with_primary, 90550);
-  ::emplace(this->scales_with_primary, 90625);
-  ::emplace(this->scales_with_primary, 90702);
-  ::emplace(this->scales_with_primary, 91562);
-  ::emplace(this->scales_with_primary, 91611);
-  ::emplace(this->scales_with_primary, 91622);
-  ::emplace(this->scales_with_primary, 91623);
-  ::emplace(this->scales_with_primary, 91677);
-  ::emplace(this->scales_with_primary, 91776);
-  ::emplace(this->scales_with_primary, 91797);
-  ::emplace(this->scales_with_primary, 91800);
-  ::emplace(this->scales_with_primary, 91853);
-  ::emplace(this->scales_with_primary, 91997);
-  ::emplace(this->scales_with_primary, 91998);
-  ::emplace(this->scales_with_primary, 92007);
-  ::emplace(this->scales_with_primary, 92008);
-  ::emplace(this->scales_with_primary, 92011);
-  ::emplace(this->scales_with_primary, 92182);
-  ::emplace(this->scales_with_primary, 92266);
-  ::emplace(this->scales_with_primary, 92621);
-  ::emplace(this->scales_with_primary, 92627);
-  ::emplace(this->scales_with_primary, 92700);
-  ::emplace(this->scales_with_primary, 92713);
-  ::emplace(this->scales_with_primary, 92915);
-  ::emplace(this->scales_with_primary, 92919);
-  ::emplace(this->scales_with_primary, 93044);
-  ::emplace(this->scales_with_primary, 93047);
-  ::emplace(this->scales_with_primary, 93331);
-  ::emplace(this->scales_with_primary, 93505);
-  ::emplace(this->scales_with_primary, 93661);
-  ::emplace(this->scales_with_primary, 93697);
-  ::emplace(this->scales_with_primary, 93711);
-  ::emplace(this->scales_with_primary, 93723);
-  ::emplace(this->scales_with_primary, 93738);
-  ::emplace(this->scales_with_primary, 93824);
-  ::emplace(this->scales_with_primary, 94336);
-  ::emplace(this->scales_with_primary, 5374);
-  ::emplace(this->scales_with_primary, 27576);
-  ::emplace(this->scales_with_primary, 95440);
-  ::emplace(this->scales_with_primary, 95454);
-  ::emplace(this->scales_with_primary, 2643);
-  ::emplace(this->scales_with_primary, 95714);
-  ::emplace(this->scales_with_primary, 95725);
-  ::emplace(this->scales_with_primary, 95738);
-  ::emplace(this->scales_with_primary, 95817);
-  ::emplace(this->scales_with_primary, 95970);
-  ::emplace(this->scales_with_primary, 96004);
-  ::emplace(this->scales_with_primary, 96103);
-  ::emplace(this->scales_with_primary, 96137);
-  ::emplace(this->scales_with_primary, 96189);
-  ::emplace(this->scales_with_primary, 20243);
-  ::emplace(this->scales_with_primary, 96340);
-  ::emplace(this->scales_with_primary, 96415);
-  ::emplace(this->scales_with_primary, 96416);
-  ::emplace(this->scales_with_primary, 96422);
-  ::emplace(this->scales_with_primary, 96426);
-  ::emplace(this->scales_with_primary, 96427);
-  ::emplace(this->scales_with_primary, 96454);
-  ::emplace(this->scales_with_primary, 96516);
-  ::emplace(this->scales_with_primary, 96650);
-  ::emplace(this->scales_with_primary, 96651);
-  ::emplace(this->scales_with_primary, 96690);
-  ::emplace(this->scales_with_primary, 96710);
-  ::emplace(this->scales_with_primary, 96712);
-  ::emplace(this->scales_with_primary, 96731);
-  ::emplace(this->scales_with_primary, 96789);
-  ::emplace(this->scales_with_primary, 96849);
-  ::emplace(this->scales_with_primary, 96859);
-  ::emplace(this->scales_with_primary, 96871);
-  ::emplace(this->scales_with_primary, 96909);
-  ::emplace(this->scales_with_primary, 97155);
-  ::emplace(this->scales_with_primary, 97161);
-  ::emplace(this->scales_with_primary, 97173);
-  ::emplace(this->scales_with_primary, 97226);
-  ::emplace(this->scales_with_primary, 97496);
-  ::emplace(this->scales_with_primary, 97511);
-  ::emplace(this->scales_with_primary, 97515);
-  ::emplace(this->scales_with_primary, 97516);
-  ::emplace(this->scales_with_primary, 97637);
-  ::emplace(this->scales_with_primary, 97721);
-  ::emplace(this->scales_with_primary, 98100);
-  ::emplace(this->scales_with_primary, 98471);
-  ::emplace(this->scales_with_primary, 98598);
-  ::emplace(this->scales_with_primary, 98711);
-  ::emplace(this->scales_with_primary, 98993);
-  ::emplace(this->scales_with_primary, 98994);
-  ::emplace(this->scales_with_primary, 98995);
-  ::emplace(this->scales_with_primary, 99115);
-  ::emplace(this->scales_with_primary, 99118);
-  ::emplace(this->scales_with_primary, 99283);
-  ::emplace(this->scales_with_primary, 99376);
-  ::emplace(this->scales_with_primary, 99393);
-  ::emplace(this->scales_with_primary, 99506);
-  ::emplace(this->scales_with_primary, 99576);
-  ::emplace(this->scales_with_primary, 99626);
-  ::emplace(this->scales_with_primary, 99647);
-  ::emplace(this->scales_with_primary, 99814);
-  ::emplace(this->scales_with_primary, 99845);
-  ::emplace(this->scales_with_primary, 99850);
-  ::emplace(this->scales_with_primary, 99861);
-  ::emplace(this->scales_with_primary, 99865);
-  ::emplace(this->scales_with_primary, 99934);
-  ::emplace(this->scales_with_primary, 99974);
-  ::emplace(this->scales_with_primary, 100012);
-  ::emplace(this->scales_with_primary, 100015);
-  ::emplace(this->scales_with_primary, 100016);
-  ::emplace(this->scales_with_primary, 100032);
-  ::emplace(this->scales_with_primary, 100033);
-  ::emplace(this->scales_with_primary, 100035);
-  ::emplace(this->scales_with_primary, 100040);
-  ::emplace(this->scales_with_primary, 100094);
-  ::emplace(this->scales_with_primary, 100095);
-  ::emplace(this->scales_with_primary, 100130);
-  ::emplace(this->scales_with_primary, 100150);
-  ::emplace(this->scales_with_primary, 100191);
-  ::emplace(this->scales_with_primary, 100229);
-  ::emplace(this->scales_with_primary, 100270);
-  ::emplace(this->scales_with_primary, 100516);
-  ::emplace(this->scales_with_primary, 100724);
-  ::emplace(this->scales_with_primary, 100780);
-  ::emplace(this->scales_with_primary, 100784);
-  ::emplace(this->scales_with_primary, 100806);
-  ::emplace(this->scales_with_primary, 100980);
-  ::emplace(this->scales_with_primary, 101152);
-  ::emplace(this->scales_with_primary, 101223);
-  ::emplace(this->scales_with_primary, 101283);
-  ::emplace(this->scales_with_primary, 101381);
-  ::emplace(this->scales_with_primary, 101412);
-  ::emplace(this->scales_with_primary, 101504);
-  ::emplace(this->scales_with_primary, 101684);
-  ::emplace(this->scales_with_primary, 101809);
-  ::emplace(this->scales_with_primary, 101810);
-  ::emplace(this->scales_with_primary, 102049);
-  ::emplace(this->scales_with_primary, 102063);
-  ::emplace(this->scales_with_primary, 102263);
-  ::emplace(this->scales_with_primary, 102265);
-  ::emplace(this->scales_with_primary, 102266);
-  ::emplace(this->scales_with_primary, 102356);
-  ::emplace(this->scales_with_primary, 102358);
-  ::emplace(this->scales_with_primary, 102361);
-  ::emplace(this->scales_with_primary, 102478);
-  ::emplace(this->scales_with_primary, 102482);
-  ::emplace(this->scales_with_primary, 102582);
-  ::emplace(this->scales_with_primary, 102593);
-  ::emplace(this->scales_with_primary, 102967);
-  ::emplace(this->scales_with_primary, 102998);
-  ::emplace(this->scales_with_primary, 103554);
-  ::emplace(this->scales_with_primary, 103577);
-  ::emplace(this->scales_with_primary, 103855);
-  ::emplace(this->scales_with_primary, 103904);
-  ::emplace(this->scales_with_primary, 104130);
-  ::emplace(this->scales_with_primary, 104318);
-  ::emplace(this->scales_with_primary, 104347);
-  ::emplace(this->scales_with_primary, 104849);
-  ::emplace(this->scales_with_primary, 104888);
-  ::emplace(this->scales_with_primary, 104909);
-  ::emplace(this->scales_with_primary, 105289);
-  ::emplace(this->scales_with_primary, 105368);
-  ::emplace(this->scales_with_primary, 105370);
-  ::emplace(this->scales_with_primary, 105416);
-  ::emplace(this->scales_with_primary, 105461);
-  ::emplace(this->scales_with_primary, 105468);
-  ::emplace(this->scales_with_primary, 105485);
-  ::emplace(this->scales_with_primary, 105546);
-  ::emplace(this->scales_with_primary, 105762);
-  ::emplace(this->scales_with_primary, 105898);
-  ::emplace(this->scales_with_primary, 106740);
-  ::emplace(this->scales_with_primary, 106763);
-  ::emplace(this->scales_with_primary, 106830);
-  ::emplace(this->scales_with_primary, 106871);
-  ::emplace(this->scales_with_primary, 107106);
-  ::emplace(this->scales_with_primary, 107111);
-  ::emplace(this->scales_with_primary, 107112);
-  ::emplace(this->scales_with_primary, 107270);
-  ::emplace(this->scales_with_primary, 107570);
-  ::emplace(this->scales_with_primary, 108005);
-  ::emplace(this->scales_with_primary, 108196);
-  ::emplace(this->scales_with_primary, 108693);
-  ::emplace(this->scales_with_primary, 108853);
-  ::emplace(this->scales_with_primary, 109079);
-  ::emplace(this->scales_with_primary, 109080);
-  ::emplace(this->scales_with_primary, 109308);
-  ::emplace(this->scales_with_primary, 109348);
-  ::emplace(this->scales_with_primary, 109391);
-  ::emplace(this->scales_with_primary, 109497);
-  ::emplace(this->scales_with_primary, 109738);
-  ::emplace(this->scales_with_primary, 109798);
-  ::emplace(this->scales_with_primary, 109800);
-  ::emplace(this->scales_with_primary, 110651);
-  ::emplace(this->scales_with_primary, 110947);
-  ::emplace(this->scales_with_primary, 110963);
-  ::emplace(this->scales_with_primary, 110968);
-  ::emplace(this->scales_with_primary, 111010);
-  ::emplace(this->scales_with_primary, 111240);
-  ::emplace(this->scales_with_primary, 111667);
-  ::emplace(this->scales_with_primary, 112894);
-  ::emplace(this->scales_with_primary, 112998);
-  ::emplace(this->scales_with_primary, 113136);
-  ::emplace(this->scales_with_primary, 113141);
-  ::emplace(this->scales_with_primary, 113504);
-  ::emplace(this->scales_with_primary, 113698);
-  ::emplace(this->scales_with_primary, 113780);
-  ::emplace(this->scales_with_primary, 2120);
-  ::emplace(this->scales_with_primary, 113967);
-  ::emplace(this->scales_with_primary, 114014);
-  ::emplace(this->scales_with_primary, 114074);
-  ::emplace(this->scales_with_primary, 114160);
-  ::emplace(this->scales_with_primary, 114181);
-  ::emplace(this->scales_with_primary, 114249);
-  ::emplace(this->scales_with_primary, 114474);
-  ::emplace(this->scales_with_primary, 114683);
-  ::emplace(this->scales_with_primary, 114738);
-  ::emplace(this->scales_with_primary, 114848);
-  ::emplace(this->scales_with_primary, 114852);
-  ::emplace(this->scales_with_primary, 114855);
-  ::emplace(this->scales_with_primary, 114859);
-  ::emplace(this->scales_with_primary, 114864);
-  ::emplace(this->scales_with_primary, 114871);
-  ::emplace(this->scales_with_primary, 114872);
-  ::emplace(this->scales_with_primary, 114919);
-  ::emplace(this->scales_with_primary, 114954);
-  ::emplace(this->scales_with_primary, 114998);
-  ::emplace(this->scales_with_primary, 115181);
-  ::emplace(this->scales_with_primary, 115185);
-  ::emplace(this->scales_with_primary, 115234);
-  ::emplace(this->scales_with_primary, 115240);
-  ::emplace(this->scales_with_primary, 115357);
-  ::emplace(this->scales_with_primary, 115360);
-  ::emplace(this->scales_with_primary, 115746);
-  ::emplace(this->scales_with_primary, 115748);
-  ::emplace(this->scales_with_primary, 115770);
-  ::emplace(this->scales_with_primary, 115778);
-  ::emplace(this->scales_with_primary, 115832);
-  ::emplace(this->scales_with_primary, 115874);
-  ::emplace(this->scales_with_primary, 116016);
-  ::emplace(this->scales_with_primary, 116076);
-  ::emplace(this->scales_with_primary, 116406);
-  ::emplace(this->scales_with_primary, 116433);
-  ::emplace(this->scales_with_primary, 116835);
-  ::emplace(this->scales_with_primary, 116858);
-  ::emplace(this->scales_with_primary, 116977);
-  ::emplace(this->scales_with_primary, 117014);
-  ::emplace(this->scales_with_primary, 116969);
-  ::emplace(this->scales_with_primary, 117406);
-  ::emplace(this->scales_with_primary, 117418);
-  ::emplace(this->scales_with_primary, 117588);
-  ::emplace(this->scales_with_primary, 117702);
-  ::emplace(this->scales_with_primary, 117767);
-  ::emplace(this->scales_with_primary, 117779);
-  ::emplace(this->scales_with_primary, 117931);
-  ::emplace(this->scales_with_primary, 117935);
-  ::emplace(this->scales_with_primary, 118000);
-  ::emplace(this->scales_with_primary, 118022);
-  ::emplace(this->scales_with_primary, 118251);
-  ::emplace(this->scales_with_primary, 118297);
-  ::emplace(this->scales_with_primary, 118525);
-  ::emplace(this->scales_with_primary, 118537);
-  ::emplace(this->scales_with_primary, 118592);
-  ::emplace(this->scales_with_primary, 118681);
-  ::emplace(this->scales_with_primary, 118783);
-  ::emplace(this->scales_with_primary, 119071);
-  ::emplace(this->scales_with_primary, 119086);
-  ::emplace(this->scales_with_primary, 119438);
-  ::emplace(this->scales_with_primary, 119524);
-  ::emplace(this->scales_with_primary, 119577);
-  ::emplace(this->scales_with_primary, 119662);
-  ::emplace(this->scales_with_primary, 120148);
-  ::emplace(this->scales_with_primary, 120149);
-  ::emplace(this->scales_with_primary, 120208);
-  ::emplace(this->scales_with_primary, 120361);
-  ::emplace(this->scales_with_primary, 120588);
-  ::emplace(this->scales_with_primary, 120595);
-  ::emplace(this->scales_with_primary, 120696);
-  ::emplace(this->scales_with_primary, 120761);
-  ::emplace(this->scales_with_primary, 120788);
-  ::emplace(this->scales_with_primary, 121165);
-  ::emplace(this->scales_with_primary, 121166);
-  ::emplace(this->scales_with_primary, 121167);
-  ::emplace(this->scales_with_primary, 121181);
-  ::emplace(this->scales_with_primary, 121241);
-  ::emplace(this->scales_with_primary, 121255);
-  ::emplace(this->scales_with_primary, 121263);
-  ::emplace(this->scales_with_primary, 121414);
-  ::emplace(this->scales_with_primary, 121473);
-  ::emplace(this->scales_with_primary, 121474);
-  ::emplace(this->scales_with_primary, 121733);
-  ::emplace(this->scales_with_primary, 122034);
-  ::emplace(this->scales_with_primary, 122128);
-  ::emplace(this->scales_with_primary, 122542);
-  ::emplace(this->scales_with_primary, 122797);
-  ::emplace(this->scales_with_primary, 122799);
-  ::emplace(this->scales_with_primary, 122979);
-  ::emplace(this->scales_with_primary, 123260);
-  ::emplace(this->scales_with_primary, 123330);
-  ::emplace(this->scales_with_primary, 123429);
-  ::emplace(this->scales_with_primary, 123586);
-  ::emplace(this->scales_with_primary, 123654);
-  ::emplace(this->scales_with_primary, 123685);
-  ::emplace(this->scales_with_primary, 123691);
-  ::emplace(this->scales_with_primary, 123996);
-  ::emplace(this->scales_with_primary, 124080);
-  ::emplace(this->scales_with_primary, 124107);
-  ::emplace(this->scales_with_primary, 124472);
-  ::emplace(this->scales_with_primary, 53385);
-  ::emplace(this->scales_with_primary, 124516);
-  ::emplace(this->scales_with_primary, 124692);
-  ::emplace(this->scales_with_primary, 124944);
-  ::emplace(this->scales_with_primary, 125062);
-  ::emplace(this->scales_with_primary, 125076);
-  ::emplace(this->scales_with_primary, 125185);
-  ::emplace(this->scales_with_primary, 125278);
-  ::emplace(this->scales_with_primary, 125878);
-  ::emplace(this->scales_with_primary, 125951);
-  ::emplace(this->scales_with_primary, 125959);
-  ::emplace(this->scales_with_primary, 125960);
-  ::emplace(this->scales_with_primary, 125971);
-  ::emplace(this->scales_with_primary, 126061);
-  ::emplace(this->scales_with_primary, 126139);
-  ::emplace(this->scales_with_primary, 126256);
-  ::emplace(this->scales_with_primary, 126257);
-  ::emplace(this->scales_with_primary, 126283);
-  ::emplace(this->scales_with_primary, 126328);
-  ::emplace(this->scales_with_primary, 126664);
-  ::emplace(this->scales_with_primary, 126742);
-  ::emplace(this->scales_with_primary, 127111);
-  ::emplace(this->scales_with_primary, 127714);
-  ::emplace(this->scales_with_primary, 127733);
-  ::emplace(this->scales_with_primary, 128032);
-  ::emplace(this->scales_with_primary, 128064);
-  ::emplace(this->scales_with_primary, 128094);
-  ::emplace(this->scales_with_primary, 128100);
-  ::emplace(this->scales_with_primary, 128103);
-  ::emplace(this->scales_with_primary, 128123);
-  ::emplace(this->scales_with_primary, 128195);
-  ::emplace(this->scales_with_primary, 128213);
-  ::emplace(this->scales_with_primary, 128233);
-  ::emplace(this->scales_with_primary, 128249);
-  ::emplace(this->scales_with_primary, 128462);
-  ::emplace(this->scales_with_primary, 128631);
-  ::emplace(this->scales_with_primary, 128644);
-  ::emplace(this->scales_with_primary, 128658);
-  ::emplace(this->scales_with_primary, 128918);
-  ::emplace(this->scales_with_primary, 128998);
-  ::emplace(this->scales_with_primary, 128999);
-  ::emplace(this->scales_with_primary, 129002);
-  ::emplace(this->scales_with_primary, 129032);
-  ::emplace(this->scales_with_primary, 129082);
-  ::emplace(this->scales_with_primary, 129112);
-  ::emplace(this->scales_with_primary, 129113);
-  ::emplace(this->scales_with_primary, 129205);
-  ::emplace(this->scales_with_primary, 129437);
-  ::emplace(this->scales_with_primary, 129531);
-  ::emplace(this->scales_with_primary, 129566);
-  ::emplace(this->scales_with_primary, 129575);
-  ::emplace(this->scales_with_primary, 129922);
-  ::emplace(this->scales_with_primary, 130081);
-  ::emplace(this->scales_with_primary, 130205);
-  ::emplace(this->scales_with_primary, 130228);
-  ::emplace(this->scales_with_primary, 130310);
-  ::emplace(this->scales_with_primary, 130404);
-  ::emplace(this->scales_with_primary, 131376);
-  ::emplace(this->scales_with_primary, 131412);
-  ::emplace(this->scales_with_primary, 131838);
-  ::emplace(this->scales_with_primary, 131900);
-  ::emplace(this->scales_with_primary, 131979);
-  ::emplace(this->scales_with_primary, 132157);
-  ::emplace(this->scales_with_primary, 132331);
-  ::emplace(this->scales_with_primary, 132425);
-  ::emplace(this->scales_with_primary, 132467);
-  ::emplace(this->scales_with_primary, 132668);
-  ::emplace(this->scales_with_primary, 132672);
-  ::emplace(this->scales_with_primary, 132728);
-  ::emplace(this->scales_with_primary, 132738);
-  ::emplace(this->scales_with_primary, 132751);
-  ::emplace(this->scales_with_primary, 133063);
-  ::emplace(this->scales_with_primary, 133066);
-  ::emplace(this->scales_with_primary, 133077);
-  ::emplace(this->scales_with_primary, 133123);
-  ::emplace(this->scales_with_primary, 133231);
-  ::emplace(this->scales_with_primary, 133238);
-  ::emplace(this->scales_with_primary, 133322);
-  ::emplace(this->scales_with_primary, 133327);
-  ::emplace(this->scales_with_primary, 133332);
-  ::emplace(this->scales_with_primary, 133361);
-  ::emplace(this->scales_with_primary, 133395);
-  ::emplace(this->scales_with_primary, 133654);
-  ::emplace(this->scales_with_primary, 133655);
-  ::emplace(this->scales_with_primary, 133811);
-  ::emplace(this->scales_with_primary, 134004);
-  ::emplace(this->scales_with_primary, 134058);
-  ::emplace(this->scales_with_primary, 134245);
-  ::emplace(this->scales_with_primary, 30213);
-  ::emplace(this->scales_with_primary, 134741);
-  ::emplace(this->scales_with_primary, 134826);
-  ::emplace(this->scales_with_primary, 134878);
-  ::emplace(this->scales_with_primary, 135237);
-  ::emplace(this->scales_with_primary, 135271);
-  ::emplace(this->scales_with_primary, 135285);
-  ::emplace(this->scales_with_primary, 135337);
-  ::emplace(this->scales_with_primary, 135503);
-  ::emplace(this->scales_with_primary, 135584);
-  ::emplace(this->scales_with_primary, 135613);
-  ::emplace(this->scales_with_primary, 135614);
-  ::emplace(this->scales_with_primary, 135664);
-  ::emplace(this->scales_with_primary, 115625);
-  ::emplace(this->scales_with_primary, 135693);
-  ::emplace(this->scales_with_primary, 135831);
-  ::emplace(this->scales_with_primary, 136055);
-  ::emplace(this->scales_with_primary, 136098);
-  ::emplace(this->scales_with_primary, 136333);
-  ::emplace(this->scales_with_primary, 136428);
-  ::emplace(this->scales_with_primary, 136438);
-  ::emplace(this->scales_with_primary, 136439);
-  ::emplace(this->scales_with_primary, 136606);
-  ::emplace(this->scales_with_primary, 136607);
-  ::emplace(this->scales_with_primary, 136828);
-  ::emplace(this->scales_with_primary, 136985);
-  ::emplace(this->scales_with_primary, 137343);
-  ::emplace(this->scales_with_primary, 137382);
-  ::emplace(this->scales_with_primary, 137392);
-  ::emplace(this->scales_with_primary, 137597);
-  ::emplace(this->scales_with_primary, 137706);
-  ::emplace(this->scales_with_primary, 137716);
-  ::emplace(this->scales_with_primary, 137884);
-  ::emplace(this->scales_with_primary, 137998);
-  ::emplace(this->scales_with_primary, 138438);
-  ::emplace(this->scales_with_primary, 138492);
-  ::emplace(this->scales_with_primary, 138604);
-  ::emplace(this->scales_with_primary, 138682);
-  ::emplace(this->scales_with_primary, 138696);
-  ::emplace(this->scales_with_primary, 138698);
-  ::emplace(this->scales_with_primary, 138782);
-  ::emplace(this->scales_with_primary, 139295);
-  ::emplace(this->scales_with_primary, 139309);
-  ::emplace(this->scales_with_primary, 139310);
-  ::emplace(this->scales_with_primary, 139413);
-  ::emplace(this->scales_with_primary, 139415);
-  ::emplace(this->scales_with_primary, 139416);
-  ::emplace(this->scales_with_primary, 139418);
-  ::emplace(this->scales_with_primary, 139419);
-  ::emplace(this->scales_with_primary, 139771);
-  ::emplace(this->scales_with_primary, 139797);
-  ::emplace(this->scales_with_primary, 139914);
-  ::emplace(this->scales_with_primary, 139963);
-  ::emplace(this->scales_with_primary, 140106);
-  ::emplace(this->scales_with_primary, 140177);
-  ::emplace(this->scales_with_primary, 140279);
-  ::emplace(this->scales_with_primary, 140327);
-  ::emplace(this->scales_with_primary, 140445);
-  ::emplace(this->scales_with_primary, 140469);
-  ::emplace(this->scales_with_primary, 140496);
-  ::emplace(this->scales_with_primary, 140539);
-  ::emplace(this->scales_with_primary, 140541);
-  ::emplace(this->scales_with_primary, 140624);
-  ::emplace(this->scales_with_primary, 140817);
-  ::emplace(this->scales_with_primary, 140893);
-  ::emplace(this->scales_with_primary, 141004);
-  ::emplace(this->scales_with_primary, 141182);
-  ::emplace(this->scales_with_primary, 141264);
-  ::emplace(this->scales_with_primary, 141235);
-  ::emplace(this->scales_with_primary, 141374);
-  ::emplace(this->scales_with_primary, 141397);
-  ::emplace(this->scales_with_primary, 141425);
-  ::emplace(this->scales_with_primary, 142211);
-  ::emplace(this->scales_with_primary, 142819);
-  ::emplace(this->scales_with_primary, 143217);
-  ::emplace(this->scales_with_primary, 143323);
-  ::emplace(this->scales_with_primary, 143380);
-  ::emplace(this->scales_with_primary, 143543);
-  ::emplace(this->scales_with_primary, 144965);
-  ::emplace(this->scales_with_primary, 144968);
-  ::emplace(this->scales_with_primary, 145002);
-  ::emplace(this->scales_with_primary, 145137);
-  ::emplace(this->scales_with_primary, 145264);
-  ::emplace(this->scales_with_primary, 145406);
-  ::emplace(this->scales_with_primary, 146481);
-  ::emplace(this->scales_with_primary, 146591);
-  ::emplace(this->scales_with_primary, 146670);
-  ::emplace(this->scales_with_primary, 146688);
-  ::emplace(this->scales_with_primary, 146715);
-  ::emplace(this->scales_with_primary, 147038);
-  ::emplace(this->scales_with_primary, 147060);
-  ::emplace(this->scales_with_primary, 147089);
-  ::emplace(this->scales_with_primary, 147090);
-  ::emplace(this->scales_with_primary, 147102);
-  ::emplace(this->scales_with_primary, 147600);
-  ::emplace(this->scales_with_primary, 147601);
-  ::emplace(this->scales_with_primary, 147620);
-  ::emplace(this->scales_with_primary, 147688);
-  ::emplace(this->scales_with_primary, 147713);
-  ::emplace(this->scales_with_primary, 147820);
-  ::emplace(this->scales_with_primary, 147891);
-  ::emplace(this->scales_with_primary, 147922);
-  ::emplace(this->scales_with_primary, 148008);
-  ::emplace(this->scales_with_primary, 148022);
-  ::emplace(this->scales_with_primary, 148135);
-  ::emplace(this->scales_with_primary, 148187);
-  ::emplace(this->scales_with_primary, 148520);
-  ::emplace(this->scales_with_primary, 148742);
-  ::emplace(this->scales_with_primary, 148952);
-  ::emplace(this->scales_with_primary, 149188);
-  ::emplace(this->scales_with_primary, 149413);
-  ::emplace(this->scales_with_primary, 149722);
-  ::emplace(this->scales_with_primary, 149723);
-  ::emplace(this->scales_with_primary, 149276);
-  ::emplace(this->scales_with_primary, 150290);
-  ::emplace(this->scales_with_primary, 150405);
-  ::emplace(this->scales_with_primary, 150421);
-  ::emplace(this->scales_with_primary, 150504);
-  ::emplace(this->scales_with_primary, 150543);
-  ::emplace(this->scales_with_primary, 150589);
-  ::emplace(this->scales_with_primary, 150705);
-  ::emplace(this->scales_with_primary, 150849);
-  ::emplace(this->scales_with_primary, 151072);
-  ::emplace(this->scales_with_primary, 151503);
-  ::emplace(this->scales_with_primary, 151506);
-  ::emplace(this->scales_with_primary, 152108);
-  ::emplace(this->scales_with_primary, 153257);
-  ::emplace(this->scales_with_primary, 153309);
-  ::emplace(this->scales_with_primary, 153596);
-  ::emplace(this->scales_with_primary, 153640);
-  ::emplace(this->scales_with_primary, 154081);
-  ::emplace(this->scales_with_primary, 154193);
-  ::emplace(this->scales_with_primary, 154395);
-  ::emplace(this->scales_with_primary, 154450);
-  ::emplace(this->scales_with_primary, 70890);
-  ::emplace(this->scales_with_primary, 154836);
-  ::emplace(this->scales_with_primary, 155166);
-  ::emplace(this->scales_with_primary, 33917);
-  ::emplace(this->scales_with_primary, 155625);
-  ::emplace(this->scales_with_primary, 156000);
-  ::emplace(this->scales_with_primary, 156185);
-  ::emplace(this->scales_with_primary, 156287);
-  ::emplace(this->scales_with_primary, 152150);
-  ::emplace(this->scales_with_primary, 156796);
-  ::emplace(this->scales_with_primary, 157122);
-  ::emplace(this->scales_with_primary, 157331);
-  ::emplace(this->scales_with_primary, 157348);
-  ::emplace(this->scales_with_primary, 157563);
-  ::emplace(this->scales_with_primary, 157980);
-  ::emplace(this->scales_with_primary, 157981);
-  ::emplace(this->scales_with_primary, 157997);
-  ::emplace(this->scales_with_primary, 158201);
-  ::emplace(this->scales_with_primary, 158221);
-  ::emplace(this->scales_with_primary, 158429);
-  ::emplace(this->scales_with_primary, 106785);
-  ::emplace(this->scales_with_primary, 159386);
-  ::emplace(this->scales_with_primary, 159412);
-  ::emplace(this->scales_with_primary, 160124);
-  ::emplace(this->scales_with_primary, 160163);
-  ::emplace(this->scales_with_primary, 160290);
-  ::emplace(this->scales_with_primary, 161173);
-  ::emplace(this->scales_with_primary, 161732);
-  ::emplace(this->scales_with_primary, 161791);
-  ::emplace(this->scales_with_primary, 161792);
-  ::emplace(this->scales_with_primary, 162105);
-  ::emplace(this->scales_with_primary, 162119);
-  ::emplace(this->scales_with_primary, 162120);
-  ::emplace(this->scales_with_primary, 162243);
-  ::emplace(this->scales_with_primary, 162425);
-  ::emplace(this->scales_with_primary, 162541);
-  ::emplace(this->scales_with_primary, 162546);
-  ::emplace(this->scales_with_primary, 162578);
-  ::emplace(this->scales_with_primary, 162627);
-  ::emplace(this->scales_with_primary, 163011);
-  ::emplace(this->scales_with_primary, 163151);
-  ::emplace(this->scales_with_primary, 121253);
-  ::emplace(this->scales_with_primary, 163558);
-  ::emplace(this->scales_with_primary, 163791);
-  ::emplace(this->scales_with_primary, 163798);
-  ::emplace(this->scales_with_primary, 163884);
-  ::emplace(this->scales_with_primary, 163888);
-  ::emplace(this->scales_with_primary, 164071);
-  ::emplace(this->scales_with_primary, 164436);
-  ::emplace(this->scales_with_primary, 164469);
-  ::emplace(this->scales_with_primary, 164498);
-  ::emplace(this->scales_with_primary, 164812);
-  ::emplace(this->scales_with_primary, 164815);
-  ::emplace(this->scales_with_primary, 165146);
-  ::emplace(this->scales_with_primary, 165569);
-  ::emplace(this->scales_with_primary, 165715);
-  ::emplace(this->scales_with_primary, 165717);
-  ::emplace(this->scales_with_primary, 165719);
-  ::emplace(this->scales_with_primary, 165738);
-  ::emplace(this->scales_with_primary, 165741);
-  ::emplace(this->scales_with_primary, 165749);
-  ::emplace(this->scales_with_primary, 165874);
-  ::emplace(this->scales_with_primary, 165875);
-  ::emplace(this->scales_with_primary, 165884);
-  ::emplace(this->scales_with_primary, 166234);
-  ::emplace(this->scales_with_primary, 166242);
-  ::emplace(this->scales_with_primary, 166604);
-  ::emplace(this->scales_with_primary, 166637);
-  ::emplace(this->scales_with_primary, 166815);
-  ::emplace(this->scales_with_primary, 166864);
-  ::emplace(this->scales_with_primary, 166991);
-  ::emplace(this->scales_with_primary, 167105);
-  ::emplace(this->scales_with_primary, 167242);
-  ::emplace(this->scales_with_primary, 1715);
-  ::emplace(this->scales_with_primary, 167810);
-  ::emplace(this->scales_with_primary, 167993);
-  ::emplace(this->scales_with_primary, 167994);
-  ::emplace(this->scales_with_primary, 168380);
-  ::emplace(this->scales_with_primary, 168877);
-  ::emplace(this->scales_with_primary, 168878);
-  ::emplace(this->scales_with_primary, 168879);
-  ::emplace(this->scales_with_primary, 168880);
-  ::emplace(this->scales_with_primary, 168881);
-  ::emplace(this->scales_with_primary, 168955);
-  ::emplace(this->scales_with_primary, 169426);
-  ::emplace(this->scales_with_primary, 169429);
-  ::emplace(this->scales_with_primary, 170176);
-  ::emplace(this->scales_with_primary, 170177);
-  ::emplace(this->scales_with_primary, 170379);
-  ::emplace(this->scales_with_primary, 170435);
-  ::emplace(this->scales_with_primary, 170512);
-  ::emplace(this->scales_with_primary, 170637);
-  ::emplace(this->scales_with_primary, 170640);
-  ::emplace(this->scales_with_primary, 170679);
-  ::emplace(this->scales_with_primary, 170764);
-  ::emplace(this->scales_with_primary, 170828);
-  ::emplace(this->scales_with_primary, 170851);
-  ::emplace(this->scales_with_primary, 171017);
-  ::emplace(this->scales_with_primary, 171018);
-  ::emplace(this->scales_with_primary, 171030);
-  ::emplace(this->scales_with_primary, 171041);
-  ::emplace(this->scales_with_primary, 171156);
-  ::emplace(this->scales_with_primary, 171454);
-  ::emplace(this->scales_with_primary, 171457);
-  ::emplace(this->scales_with_primary, 171524);
-  ::emplace(this->scales_with_primary, 171572);
-  ::emplace(this->scales_with_primary, 171805);
-  ::emplace(this->scales_with_primary, 171807);
-  ::emplace(this->scales_with_primary, 171852);
-  ::emplace(this->scales_with_primary, 171858);
-  ::emplace(this->scales_with_primary, 172538);
-  ::emplace(this->scales_with_primary, 172728);
-  ::emplace(this->scales_with_primary, 173043);
-  ::emplace(this->scales_with_primary, 173491);
-  ::emplace(this->scales_with_primary, 174849);
-  ::emplace(this->scales_with_primary, 175003);
-  ::emplace(this->scales_with_primary, 175008);
-  ::emplace(this->scales_with_primary, 175009);
-  ::emplace(this->scales_with_primary, 175259);
-  ::emplace(this->scales_with_primary, 175388);
-  ::emplace(this->scales_with_primary, 175806);
-  ::emplace(this->scales_with_primary, 175837);
-  ::emplace(this->scales_with_primary, 175915);
-  ::emplace(this->scales_with_primary, 176040);
-  ::emplace(this->scales_with_primary, 176142);
-  ::emplace(this->scales_with_primary, 176327);
-  ::emplace(this->scales_with_primary, 177289);
-  ::emplace(this->scales_with_primary, 177566);
-  ::emplace(this->scales_with_primary, 178009);
-  ::emplace(this->scales_with_primary, 178010);
-  ::emplace(this->scales_with_primary, 178680);
-  ::emplace(this->scales_with_primary, 178784);
-  ::emplace(this->scales_with_primary, 178786);
-  ::emplace(this->scales_with_primary, 178808);
-  ::emplace(this->scales_with_primary, 179095);
-  ::emplace(this->scales_with_primary, 179096);
-  ::emplace(this->scales_with_primary, 179416);
-  ::emplace(this->scales_with_primary, 179417);
-  ::emplace(this->scales_with_primary, 179564);
-  ::emplace(this->scales_with_primary, 180290);
-  ::emplace(this->scales_with_primary, 180407);
-  ::emplace(this->scales_with_primary, 180448);
-  ::emplace(this->scales_with_primary, 180781);
-  ::emplace(this->scales_with_primary, 181778);
-  ::emplace(this->scales_with_primary, 182700);
-  ::emplace(this->scales_with_primary, 182776);
-  ::emplace(this->scales_with_primary, 183197);
-  ::emplace(this->scales_with_primary, 183255);
-  ::emplace(this->scales_with_primary, 183354);
-  ::emplace(this->scales_with_primary, 183569);
-  ::emplace(this->scales_with_primary, 183597);
-  ::emplace(this->scales_with_primary, 183625);
-  ::emplace(this->scales_with_primary, 183768);
-  ::emplace(this->scales_with_primary, 184196);
-  ::emplace(this->scales_with_primary, 179057);
-  ::emplace(this->scales_with_primary, 184477);
-  ::emplace(this->scales_with_primary, 184575);
-  ::emplace(this->scales_with_primary, 184707);
-  ::emplace(this->scales_with_primary, 184709);
-  ::emplace(this->scales_with_primary, 184720);
-  ::emplace(this->scales_with_primary, 184721);
-  ::emplace(this->scales_with_primary, 184857);
-  ::emplace(this->scales_with_primary, 185099);
-  ::emplace(this->scales_with_primary, 185127);
-  ::emplace(this->scales_with_primary, 185306);
-  ::emplace(this->scales_with_primary, 185304);
-  ::emplace(this->scales_with_primary, 185358);
-  ::emplace(this->scales_with_primary, 185395);
-  ::emplace(this->scales_with_primary, 185419);
-  ::emplace(this->scales_with_primary, 185438);
-  ::emplace(this->scales_with_primary, 185565);
-  ::emplace(this->scales_with_primary, 185763);
-  ::emplace(this->scales_with_primary, 185795);
-  ::emplace(this->scales_with_primary, 185809);
-  ::emplace(this->scales_with_primary, 186181);
-  ::emplace(this->scales_with_primary, 186270);
-  ::emplace(this->scales_with_primary, 186387);
-  ::emplace(this->scales_with_primary, 186469);
-  ::emplace(this->scales_with_primary, 186474);
-  ::emplace(this->scales_with_primary, 186724);
-  ::emplace(this->scales_with_primary, 186744);
-  ::emplace(this->scales_with_primary, 186873);
-  ::emplace(this->scales_with_primary, 186968);
-  ::emplace(this->scales_with_primary, 186971);
-  ::emplace(this->scales_with_primary, 187096);
-  ::emplace(this->scales_with_primary, 187144);
-  ::emplace(this->scales_with_primary, 187394);
-  ::emplace(this->scales_with_primary, 187420);
-  ::emplace(this->scales_with_primary, 187565);
-  ::emplace(this->scales_with_primary, 187708);
-  ::emplace(this->scales_with_primary, 187773);
-  ::emplace(this->scales_with_primary, 187874);
-  ::emplace(this->scales_with_primary, 188009);
-  ::emplace(this->scales_with_primary, 188046);
-  ::emplace(this->scales_with_primary, 188196);
-  ::emplace(this->scales_with_primary, 188214);
-  ::emplace(this->scales_with_primary, 188389);
-  ::emplace(this->scales_with_primary, 188443);
-  ::emplace(this->scales_with_primary, 188498);
-  ::emplace(this->scales_with_primary, 188618);
-  ::emplace(this->scales_with_primary, 188660);
-  ::emplace(this->scales_with_primary, 188667);
-  ::emplace(this->scales_with_primary, 188764);
-  ::emplace(this->scales_with_primary, 188768);
-  ::emplace(this->scales_with_primary, 188912);
-  ::emplace(this->scales_with_primary, 188924);
-  ::emplace(this->scales_with_primary, 188927);
-  ::emplace(this->scales_with_primary, 188935);
-  ::emplace(this->scales_with_primary, 188952);
-  ::emplace(this->scales_with_primary, 189048);
-  ::emplace(this->scales_with_primary, 189112);
-  ::emplace(this->scales_with_primary, 189222);
-  ::emplace(this->scales_with_primary, 189720);
-  ::emplace(this->scales_with_primary, 189723);
-  ::emplace(this->scales_with_primary, 189724);
-  ::emplace(this->scales_with_primary, 189872);
-  ::emplace(this->scales_with_primary, 190190);
-  ::emplace(this->scales_with_primary, 190231);
-  ::emplace(this->scales_with_primary, 190330);
-  ::emplace(this->scales_with_primary, 190332);
-  ::emplace(this->scales_with_primary, 190357);
-  ::emplace(this->scales_with_primary, 190780);
-  ::emplace(this->scales_with_primary, 190815);
-  ::emplace(this->scales_with_primary, 190928);
-  ::emplace(this->scales_with_primary, 190984);
-  ::emplace(this->scales_with_primary, 191037);
-  ::emplace(this->scales_with_primary, 191043);
-  ::emplace(this->scales_with_primary, 191070);
-  ::emplace(this->scales_with_primary, 191213);
-  ::emplace(this->scales_with_primary, 191685);
-  ::emplace(this->scales_with_primary, 1449);
-  ::emplace(this->scales_with_primary, 191726);
-  ::emplace(this->scales_with_primary, 191732);
-  ::emplace(this->scales_with_primary, 191758);
-  ::emplace(this->scales_with_primary, 191764);
-  ::emplace(this->scales_with_primary, 191799);
-  ::emplace(this->scales_with_primary, 192087);
-  ::emplace(this->scales_with_primary, 192101);
-  ::emplace(this->scales_with_primary, 192109);
-  ::emplace(this->scales_with_primary, 192178);
-  ::emplace(this->scales_with_primary, 192231);
-  ::emplace(this->scales_with_primary, 192434);
-  ::emplace(this->scales_with_primary, 192611);
-  ::emplace(this->scales_with_primary, 192651);
-  ::emplace(this->scales_with_primary, 192660);
-  ::emplace(this->scales_with_primary, 192945);
-  ::emplace(this->scales_with_primary, 192955);
-  ::emplace(this->scales_with_primary, 192991);
-  ::emplace(this->scales_with_primary, 193258);
-  ::emplace(this->scales_with_primary, 193265);
-  ::emplace(this->scales_with_primary, 193315);
-  ::emplace(this->scales_with_primary, 193439);
-  ::emplace(this->scales_with_primary, 193455);
-  ::emplace(this->scales_with_primary, 193584);
-  ::emplace(this->scales_with_primary, 194098);
-  ::emplace(this->scales_with_primary, 194153);
-  ::emplace(this->scales_with_primary, 194188);
-  ::emplace(this->scales_with_primary, 194275);
-  ::emplace(this->scales_with_primary, 194311);
-  ::emplace(this->scales_with_primary, 194392);
-  ::emplace(this->scales_with_primary, 194408);
-  ::emplace(this->scales_with_primary, 194429);
-  ::emplace(this->scales_with_primary, 194430);
-  ::emplace(this->scales_with_primary, 194432);
-  ::emplace(this->scales_with_primary, 194458);
-  ::emplace(this->scales_with_primary, 194466);
-  ::emplace(this->scales_with_primary, 194547);
-  ::emplace(this->scales_with_primary, 194548);
-  ::emplace(this->scales_with_primary, 194885);
-  ::emplace(this->scales_with_primary, 195182);
-  ::emplace(this->scales_with_primary, 195292);
-  ::emplace(this->scales_with_primary, 195584);
-  ::emplace(this->scales_with_primary, 195592);
-  ::emplace(this->scales_with_primary, 195750);
-  ::emplace(this->scales_with_primary, 195975);
-  ::emplace(this->scales_with_primary, 196061);
-  ::emplace(this->scales_with_primary, 196100);
-  ::emplace(this->scales_with_primary, 196148);
-  ::emplace(this->scales_with_primary, 196158);
-  ::emplace(this->scales_with_primary, 196159);
-  ::emplace(this->scales_with_primary, 196196);
-  ::emplace(this->scales_with_primary, 196197);
-  ::emplace(this->scales_with_primary, 196199);
-  ::emplace(this->scales_with_primary, 196206);
-  ::emplace(this->scales_with_primary, 196218);
-  ::emplace(this->scales_with_primary, 196242);
-  ::emplace(this->scales_with_primary, 196243);
-  ::emplace(this->scales_with_primary, 196253);
-  ::emplace(this->scales_with_primary, 196278);
-  ::emplace(this->scales_with_primary, 29722);
-  ::emplace(this->scales_with_primary, 196448);
-  ::emplace(this->scales_with_primary, 196528);
-  ::emplace(this->scales_with_primary, 196657);
-  ::emplace(this->scales_with_primary, 196670);
-  ::emplace(this->scales_with_primary, 196733);
-  ::emplace(this->scales_with_primary, 196748);
-  ::emplace(this->scales_with_primary, 196771);
-  ::emplace(this->scales_with_primary, 196811);
-  ::emplace(this->scales_with_primary, 196812);
-  ::emplace(this->scales_with_primary, 196819);
-  ::emplace(this->scales_with_primary, 45902);
-  ::emplace(this->scales_with_primary, 196840);
-  ::emplace(this->scales_with_primary, 196937);
-  ::emplace(this->scales_with_primary, 196944);
-  ::emplace(this->scales_with_primary, 197028);
-  ::emplace(this->scales_with_primary, 197035);
-  ::emplace(this->scales_with_primary, 197062);
-  ::emplace(this->scales_with_primary, 197144);
-  ::emplace(this->scales_with_primary, 197214);
-  ::emplace(this->scales_with_primary, 197346);
-  ::emplace(this->scales_with_primary, 197370);
-  ::emplace(this->scales_with_primary, 197393);
-  ::emplace(this->scales_with_primary, 197397);
-  ::emplace(this->scales_with_primary, 197428);
-  ::emplace(this->scales_with_primary, 197534);
-  ::emplace(this->scales_with_primary, 197611);
-  ::emplace(this->scales_with_primary, 197626);
-  ::emplace(this->scales_with_primary, 197628);
-  ::emplace(this->scales_with_primary, 197745);
-  ::emplace(this->scales_with_primary, 197785);
-  ::emplace(this->scales_with_primary, 197800);
-  ::emplace(this->scales_with_primary, 197834);
-  ::emplace(this->scales_with_primary, 197835);
-  ::emplace(this->scales_with_primary, 197959);
-  ::emplace(this->scales_with_primary, 198030);
-  ::emplace(this->scales_with_primary, 198033);
-  ::emplace(this->scales_with_primary, 198137);
-  ::emplace(this->scales_with_primary, 198036);
-  ::emplace(this->scales_with_primary, 198222);
-  ::emplace(this->scales_with_primary, 198455);
-  ::emplace(this->scales_with_primary, 198480);
-  ::emplace(this->scales_with_primary, 198483);
-  ::emplace(this->scales_with_primary, 198485);
-  ::emplace(this->scales_with_primary, 198547);
-  ::emplace(this->scales_with_primary, 198618);
-  ::emplace(this->scales_with_primary, 198623);
-  ::emplace(this->scales_with_primary, 198625);
-  ::emplace(this->scales_with_primary, 198626);
-  ::emplace(this->scales_with_primary, 198627);
-  ::emplace(this->scales_with_primary, 198629);
-  ::emplace(this->scales_with_primary, 198632);
-  ::emplace(this->scales_with_primary, 198633);
-  ::emplace(this->scales_with_primary, 198634);
-  ::emplace(this->scales_with_primary, 198636);
-  ::emplace(this->scales_with_primary, 198637);
-  ::emplace(this->scales_with_primary, 198653);
-  ::emplace(this->scales_with_primary, 198655);
-  ::emplace(this->scales_with_primary, 198656);
-  ::emplace(this->scales_with_primary, 198657);
-  ::emplace(this->scales_with_primary, 198659);
-  ::emplace(this->scales_with_primary, 198660);
-  ::emplace(this->scales_with_primary, 198662);
-  ::emplace(this->scales_with_primary, 198663);
-  ::emplace(this->scales_with_primary, 198667);
-  ::emplace(this->scales_with_primary, 198668);
-  ::emplace(this->scales_with_primary, 198669);
-  ::emplace(this->scales_with_primary, 198670);
-  ::emplace(this->scales_with_primary, 198670);
-  ::emplace(this->scales_with_primary, 198672);
-  ::emplace(this->scales_with_primary, 198673);
-  ::emplace(this->scales_with_primary, 198676);
-  ::emplace(this->scales_with_primary, 198677);
-  ::emplace(this->scales_with_primary, 198678);
-  ::emplace(this->scales_with_primary, 198679);
-  ::emplace(this->scales_with_primary, 198680);
-  ::emplace(this->scales_with_primary, 198681);
-  ::emplace(this->scales_with_primary, 198682);
-  ::emplace(this->scales_with_primary, 198683);
-  ::emplace(this->scales_with_primary, 198684);
-  ::emplace(this->scales_with_primary, 198685);
-  ::emplace(this->scales_with_primary, 198686);
-  ::emplace(this->scales_with_primary, 198687);
-  ::emplace(this->scales_with_primary, 198689);
-  ::emplace(this->scales_with_primary, 198690);
-  ::emplace(this->scales_with_primary, 198691);
-  ::emplace(this->scales_with_primary, 198693);
-  ::emplace(this->scales_with_primary, 198694);
-  ::emplace(this->scales_with_primary, 198695);
-  ::emplace(this->scales_with_primary, 198696);
-  ::emplace(this->scales_with_primary, 198697);
-  ::emplace(this->scales_with_primary, 198698);
-  ::emplace(this->scales_with_primary, 198699);
-  ::emplace(this->scales_with_primary, 198700);
-  ::emplace(this->scales_with_primary, 198712);
-  ::emplace(this->scales_with_primary, 198715);
-  ::emplace(this->scales_with_primary, 198728);
-  ::emplace(this->scales_with_primary, 198813);
-  ::emplace(this->scales_with_primary, 198928);
-  ::emplace(this->scales_with_primary, 199022);
-  ::emplace(this->scales_with_primary, 199053);
-  ::emplace(this->scales_with_primary, 199054);
-  ::emplace(this->scales_with_primary, 199116);
-  ::emplace(this->scales_with_primary, 199205);
-  ::emplace(this->scales_with_primary, 199373);
-  ::emplace(this->scales_with_primary, 199433);
-  ::emplace(this->scales_with_primary, 199512);
-  ::emplace(this->scales_with_primary, 199547);
-  ::emplace(this->scales_with_primary, 199552);
-  ::emplace(this->scales_with_primary, 199581);
-  ::emplace(this->scales_with_primary, 199658);
-  ::emplace(this->scales_with_primary, 199667);
-  ::emplace(this->scales_with_primary, 199753);
-  ::emplace(this->scales_with_primary, 199799);
-  ::emplace(this->scales_with_primary, 199850);
-  ::emplace(this->scales_with_primary, 199851);
-  ::emplace(this->scales_with_primary, 199852);
-  ::emplace(this->scales_with_primary, 200167);
-  ::emplace(this->scales_with_primary, 200166);
-  ::emplace(this->scales_with_primary, 200550);
-  ::emplace(this->scales_with_primary, 200614);
-  ::emplace(this->scales_with_primary, 200642);
-  ::emplace(this->scales_with_primary, 200669);
-  ::emplace(this->scales_with_primary, 200685);
-  ::emplace(this->scales_with_primary, 200758);
-  ::emplace(this->scales_with_primary, 200880);
-  ::emplace(this->scales_with_primary, 200996);
-  ::emplace(this->scales_with_primary, 201102);
-  ::emplace(this->scales_with_primary, 201199);
-  ::emplace(this->scales_with_primary, 201363);
-  ::emplace(this->scales_with_primary, 201364);
-  ::emplace(this->scales_with_primary, 201411);
-  ::emplace(this->scales_with_primary, 201428);
-  ::emplace(this->scales_with_primary, 201429);
-  ::emplace(this->scales_with_primary, 201594);
-  ::emplace(this->scales_with_primary, 201642);
-  ::emplace(this->scales_with_primary, 201686);
-  ::emplace(this->scales_with_primary, 201754);
-  ::emplace(this->scales_with_primary, 201837);
-  ::emplace(this->scales_with_primary, 201877);
-  ::emplace(this->scales_with_primary, 201991);
-  ::emplace(this->scales_with_primary, 202028);
-  ::emplace(this->scales_with_primary, 202077);
-  ::emplace(this->scales_with_primary, 202085);
-  ::emplace(this->scales_with_primary, 202168);
-  ::emplace(this->scales_with_primary, 202244);
-  ::emplace(this->scales_with_primary, 202347);
-  ::emplace(this->scales_with_primary, 202388);
-  ::emplace(this->scales_with_primary, 202390);
-  ::emplace(this->scales_with_primary, 202439);
-  ::emplace(this->scales_with_primary, 202446);
-  ::emplace(this->scales_with_primary, 202497);
-  ::emplace(this->scales_with_primary, 202767);
-  ::emplace(this->scales_with_primary, 202768);
-  ::emplace(this->scales_with_primary, 202771);
-  ::emplace(this->scales_with_primary, 202774);
-  ::emplace(this->scales_with_primary, 202895);
-  ::emplace(this->scales_with_primary, 202895);
-  ::emplace(this->scales_with_primary, 202895);
-  ::emplace(this->scales_with_primary, 202895);
-  ::emplace(this->scales_with_primary, 203001);
-  ::emplace(this->scales_with_primary, 203166);
-  ::emplace(this->scales_with_primary, 203171);
-  ::emplace(this->scales_with_primary, 203173);
-  ::emplace(this->scales_with_primary, 203413);
-  ::emplace(this->scales_with_primary, 203525);
-  ::emplace(this->scales_with_primary, 203526);
-  ::emplace(this->scales_with_primary, 203559);
-  ::emplace(this->scales_with_primary, 203655);
-  ::emplace(this->scales_with_primary, 203782);
-  ::emplace(this->scales_with_primary, 203796);
-  ::emplace(this->scales_with_primary, 203831);
-  ::emplace(this->scales_with_primary, 203832);
-  ::emplace(this->scales_with_primary, 203856);
-  ::emplace(this->scales_with_primary, 203980);
-  ::emplace(this->scales_with_primary, 204021);
-  ::emplace(this->scales_with_primary, 204167);
-  ::emplace(this->scales_with_primary, 204197);
-  ::emplace(this->scales_with_primary, 204301);
-  ::emplace(this->scales_with_primary, 204342);
-  ::emplace(this->scales_with_primary, 204350);
-  ::emplace(this->scales_with_primary, 204395);
-  ::emplace(this->scales_with_primary, 204408);
-  ::emplace(this->scales_with_primary, 204460);
-  ::emplace(this->scales_with_primary, 204536);
-  ::emplace(this->scales_with_primary, 204598);
-  ::emplace(this->scales_with_primary, 204939);
-  ::emplace(this->scales_with_primary, 204959);
-  ::emplace(this->scales_with_primary, 205164);
-  ::emplace(this->scales_with_primary, 205165);
-  ::emplace(this->scales_with_primary, 205181);
-  ::emplace(this->scales_with_primary, 205196);
-  ::emplace(this->scales_with_primary, 205202);
-  ::emplace(this->scales_with_primary, 205231);
-  ::emplace(this->scales_with_primary, 205273);
-  ::emplace(this->scales_with_primary, 205310);
-  ::emplace(this->scales_with_primary, 205313);
-  ::emplace(this->scales_with_primary, 205315);
-  ::emplace(this->scales_with_primary, 205345);
-  ::emplace(this->scales_with_primary, 205386);
-  ::emplace(this->scales_with_primary, 205448);
-  ::emplace(this->scales_with_primary, 205472);
-  ::emplace(this->scales_with_primary, 205523);
-  ::emplace(this->scales_with_primary, 205533);
-  ::emplace(this->scales_with_primary, 113656);
-  ::emplace(this->scales_with_primary, 205750);
-  ::emplace(this->scales_with_primary, 205750);
-  ::emplace(this->scales_with_primary, 205762);
-  ::emplace(this->scales_with_primary, 206025);
-  ::emplace(this->scales_with_primary, 206318);
-  ::emplace(this->scales_with_primary, 206328);
-  ::emplace(this->scales_with_primary, 206427);
-  ::emplace(this->scales_with_primary, 206444);
-  ::emplace(this->scales_with_primary, 206579);
-  ::emplace(this->scales_with_primary, 206685);
-  ::emplace(this->scales_with_primary, 206930);
-  ::emplace(this->scales_with_primary, 207097);
-  ::emplace(this->scales_with_primary, 207150);
-  ::emplace(this->scales_with_primary, 207230);
-  ::emplace(this->scales_with_primary, 207267);
-  ::emplace(this->scales_with_primary, 207324);
-  ::emplace(this->scales_with_primary, 207764);
-  ::emplace(this->scales_with_primary, 207946);
-  ::emplace(this->scales_with_primary, 207948);
-  ::emplace(this->scales_with_primary, 208618);
-  ::emplace(this->scales_with_primary, 208645);
-  ::emplace(this->scales_with_primary, 208734);
-  ::emplace(this->scales_with_primary, 208941);
-  ::emplace(this->scales_with_primary, 208943);
-  ::emplace(this->scales_with_primary, 209202);
-  ::emplace(this->scales_with_primary, 209287);
-  ::emplace(this->scales_with_primary, 209331);
-  ::emplace(this->scales_with_primary, 209478);
-  ::emplace(this->scales_with_primary, 209700);
-  ::emplace(this->scales_with_primary, 209733);
-  ::emplace(this->scales_with_primary, 209851);
-  ::emplace(this->scales_with_primary, 209854);
-  ::emplace(this->scales_with_primary, 209912);
-  ::emplace(this->scales_with_primary, 209913);
-  ::emplace(this->scales_with_primary, 209885);
-  ::emplace(this->scales_with_primary, 210083);
-  ::emplace(this->scales_with_primary, 210153);
-  ::emplace(this->scales_with_primary, 210155);
-  ::emplace(this->scales_with_primary, 210167);
-  ::emplace(this->scales_with_primary, 210477);
-  ::emplace(this->scales_with_primary, 210478);
-  ::emplace(this->scales_with_primary, 210479);
-  ::emplace(this->scales_with_primary, 210687);
-  ::emplace(this->scales_with_primary, 210714);
-  ::emplace(this->scales_with_primary, 210723);
-  ::emplace(this->scales_with_primary, 210764);
-  ::emplace(this->scales_with_primary, 210817);
-  ::emplace(this->scales_with_primary, 210846);
-  ::emplace(this->scales_with_primary, 210937);
-  ::emplace(this->scales_with_primary, 211012);
-  ::emplace(this->scales_with_primary, 211052);
-  ::emplace(this->scales_with_primary, 211088);
-  ::emplace(this->scales_with_primary, 211094);
-  ::emplace(this->scales_with_primary, 211316);
-  ::emplace(this->scales_with_primary, 211406);
-  ::emplace(this->scales_with_primary, 211412);
-  ::emplace(this->scales_with_primary, 211545);
-  ::emplace(this->scales_with_primary, 211578);
-  ::emplace(this->scales_with_primary, 211581);
-  ::emplace(this->scales_with_primary, 211727);
-  ::emplace(this->scales_with_primary, 211736);
-  ::emplace(this->scales_with_primary, 211796);
-  ::emplace(this->scales_with_primary, 211797);
-  ::emplace(this->scales_with_primary, 211813);
-  ::emplace(this->scales_with_primary, 211881);
-  ::emplace(this->scales_with_primary, 211946);
-  ::emplace(this->scales_with_primary, 212105);
-  ::emplace(this->scales_with_primary, 212164);
-  ::emplace(this->scales_with_primary, 212332);
-  ::emplace(this->scales_with_primary, 212335);
-  ::emplace(this->scales_with_primary, 212337);
-  ::emplace(this->scales_with_primary, 212338);
-  ::emplace(this->scales_with_primary, 212436);
-  ::emplace(this->scales_with_primary, 212548);
-  ::emplace(this->scales_with_primary, 212680);
-  ::emplace(this->scales_with_primary, 212739);
-  ::emplace(this->scales_with_primary, 212881);
-  ::emplace(this->scales_with_primary, 212980);
-  ::emplace(this->scales_with_primary, 213084);
-  ::emplace(this->scales_with_primary, 213151);
-  ::emplace(this->scales_with_primary, 213229);
-  ::emplace(this->scales_with_primary, 213243);
-  ::emplace(this->scales_with_primary, 213391);
-  ::emplace(this->scales_with_primary, 213427);
-  ::emplace(this->scales_with_primary, 213678);
-  ::emplace(this->scales_with_primary, 213688);
-  ::emplace(this->scales_with_primary, 213691);
-  ::emplace(this->scales_with_primary, 213709);
-  ::emplace(this->scales_with_primary, 213771);
-  ::emplace(this->scales_with_primary, 213791);
-  ::emplace(this->scales_with_primary, 213795);
-  ::emplace(this->scales_with_primary, 213797);
-  ::emplace(this->scales_with_primary, 213826);
-  ::emplace(this->scales_with_primary, 213829);
-  ::emplace(this->scales_with_primary, 213842);
-  ::emplace(this->scales_with_primary, 213843);
-  ::emplace(this->scales_with_primary, 213844);
-  ::emplace(this->scales_with_primary, 214326);
-  ::emplace(this->scales_with_primary, 214581);
-  ::emplace(this->scales_with_primary, 214692);
-  ::emplace(this->scales_with_primary, 207407);
-  ::emplace(this->scales_with_primary, 214743);
-  ::emplace(this->scales_with_primary, 214777);
-  ::emplace(this->scales_with_primary, 215279);
-  ::emplace(this->scales_with_primary, 215661);
-  ::emplace(this->scales_with_primary, 215775);
-  ::emplace(this->scales_with_primary, 215802);
-  ::emplace(this->scales_with_primary, 215830);
-  ::emplace(this->scales_with_primary, 215999);
-  ::emplace(this->scales_with_primary, 216095);
-  ::emplace(this->scales_with_primary, 216136);
-  ::emplace(this->scales_with_primary, 216145);
-  ::emplace(this->scales_with_primary, 216444);
-  ::emplace(this->scales_with_primary, 194859);
-  ::emplace(this->scales_with_primary, 217020);
-  ::emplace(this->scales_with_primary, 217058);
-  ::emplace(this->scales_with_primary, 217092);
-  ::emplace(this->scales_with_primary, 217207);
-  ::emplace(this->scales_with_primary, 44461);
-  ::emplace(this->scales_with_primary, 217742);
-  ::emplace(this->scales_with_primary, 217916);
-  ::emplace(this->scales_with_primary, 218013);
-  ::emplace(this->scales_with_primary, 218098);
-  ::emplace(this->scales_with_primary, 218105);
-  ::emplace(this->scales_with_primary, 207311);
-  ::emplace(this->scales_with_primary, 218253);
-  ::emplace(this->scales_with_primary, 218321);
-  ::emplace(this->scales_with_primary, 218345);
-  ::emplace(this->scales_with_primary, 218353);
-  ::emplace(this->scales_with_primary, 218406);
-  ::emplace(this->scales_with_primary, 218617);
-  ::emplace(this->scales_with_primary, 218635);
-  ::emplace(this->scales_with_primary, 218677);
-  ::emplace(this->scales_with_primary, 218851);
-  ::emplace(this->scales_with_primary, 219091);
-  ::emplace(this->scales_with_primary, 219146);
-  ::emplace(this->scales_with_primary, 219202);
-  ::emplace(this->scales_with_primary, 219271);
-  ::emplace(this->scales_with_primary, 219372);
-  ::emplace(this->scales_with_primary, 219396);
-  ::emplace(this->scales_with_primary, 219430);
-  ::emplace(this->scales_with_primary, 219432);
-  ::emplace(this->scales_with_primary, 219479);
-  ::emplace(this->scales_with_primary, 219522);
-  ::emplace(this->scales_with_primary, 219544);
-  ::emplace(this->scales_with_primary, 219548);
-  ::emplace(this->scales_with_primary, 220017);
-  ::emplace(this->scales_with_primary, 220116);
-  ::emplace(this->scales_with_primary, 220128);
-  ::emplace(this->scales_with_primary, 220138);
-  ::emplace(this->scales_with_primary, 220166);
-  ::emplace(this->scales_with_primary, 215969);
-  ::emplace(this->scales_with_primary, 220233);
-  ::emplace(this->scales_with_primary, 220238);
-  ::emplace(this->scales_with_primary, 220283);
-  ::emplace(this->scales_with_primary, 220285);
-  ::emplace(this->scales_with_primary, 220304);
-  ::emplace(this->scales_with_primary, 220308);
-  ::emplace(this->scales_with_primary, 220371);
-  ::emplace(this->scales_with_primary, 220494);
-  ::emplace(this->scales_with_primary, 220501);
-  ::emplace(this->scales_with_primary, 220671);
-  ::emplace(this->scales_with_primary, 220673);
-  ::emplace(this->scales_with_primary, 220675);
-  ::emplace(this->scales_with_primary, 220850);
-  ::emplace(this->scales_with_primary, 220857);
-  ::emplace(this->scales_with_primary, 220877);
-  ::emplace(this->scales_with_primary, 220893);
-  ::emplace(this->scales_with_primary, 220897);
-  ::emplace(this->scales_with_primary, 220913);
-  ::emplace(this->scales_with_primary, 220926);
-  ::emplace(this->scales_with_primary, 220932);
-  ::emplace(this->scales_with_primary, 220944);
-  ::emplace(this->scales_with_primary, 220945);
-  ::emplace(this->scales_with_primary, 221303);
-  ::emplace(this->scales_with_primary, 221403);
-  ::emplace(this->scales_with_primary, 221405);
-  ::emplace(this->scales_with_primary, 221512);
-  ::emplace(this->scales_with_primary, 222024);
-  ::emplace(this->scales_with_primary, 222026);
-  ::emplace(this->scales_with_primary, 222031);
-  ::emplace(this->scales_with_primary, 222076);
-  ::emplace(this->scales_with_primary, 222087);
-  ::emplace(this->scales_with_primary, 222090);
-  ::emplace(this->scales_with_primary, 222122);
-  ::emplace(this->scales_with_primary, 222196);
-  ::emplace(this->scales_with_primary, 222221);
-  ::emplace(this->scales_with_primary, 222291);
-  ::emplace(this->scales_with_primary, 222323);
-  ::emplace(this->scales_with_primary, 222826);
-  ::emplace(this->scales_with_primary, 222881);
-  ::emplace(this->scales_with_primary, 222897);
-  ::emplace(this->scales_with_primary, 222935);
-  ::emplace(this->scales_with_primary, 223058);
-  ::emplace(this->scales_with_primary, 223107);
-  ::emplace(this->scales_with_primary, 223130);
-  ::emplace(this->scales_with_primary, 223329);
-  ::emplace(this->scales_with_primary, 223362);
-  ::emplace(this->scales_with_primary, 223731);
-  ::emplace(this->scales_with_primary, 223732);
-  ::emplace(this->scales_with_primary, 223769);
-  ::emplace(this->scales_with_primary, 223829);
-  ::emplace(this->scales_with_primary, 223869);
-  ::emplace(this->scales_with_primary, 223919);
-  ::emplace(this->scales_with_primary, 223952);
-  ::emplace(this->scales_with_primary, 224024);
-  ::emplace(this->scales_with_primary, 224025);
-  ::emplace(this->scales_with_primary, 224171);
-  ::emplace(this->scales_with_primary, 224239);
-  ::emplace(this->scales_with_primary, 224261);
-  ::emplace(this->scales_with_primary, 224266);
-  ::emplace(this->scales_with_primary, 224374);
-  ::emplace(this->scales_with_primary, 224377);
-  ::emplace(this->scales_with_primary, 224716);
-  ::emplace(this->scales_with_primary, 225119);
-  ::emplace(this->scales_with_primary, 225411);
-  ::emplace(this->scales_with_primary, 225427);
-  ::emplace(this->scales_with_primary, 225446);
-  ::emplace(this->scales_with_primary, 225447);
-  ::emplace(this->scales_with_primary, 225448);
-  ::emplace(this->scales_with_primary, 224637);
-  ::emplace(this->scales_with_primary, 225588);
-  ::emplace(this->scales_with_primary, 225919);
-  ::emplace(this->scales_with_primary, 225921);
-  ::emplace(this->scales_with_primary, 226104);
-  ::emplace(this->scales_with_primary, 226376);
-  ::emplace(this->scales_with_primary, 226377);
-  ::emplace(this->scales_with_primary, 226408);
-  ::emplace(this->scales_with_primary, 226511);
-  ::emplace(this->scales_with_primary, 226874);
-  ::emplace(this->scales_with_primary, 226885);
-  ::emplace(this->scales_with_primary, 227104);
-  ::emplace(this->scales_with_primary, 227291);
-  ::emplace(this->scales_with_primary, 227314);
-  ::emplace(this->scales_with_primary, 227382);
-  ::emplace(this->scales_with_primary, 91778);
-  ::emplace(this->scales_with_primary, 227518);
-  ::emplace(this->scales_with_primary, 227542);
-  ::emplace(this->scales_with_primary, 227575);
-  ::emplace(this->scales_with_primary, 227681);
-  ::emplace(this->scales_with_primary, 227854);
-  ::emplace(this->scales_with_primary, 227877);
-  ::emplace(this->scales_with_primary, 228322);
-  ::emplace(this->scales_with_primary, 228354);
-  ::emplace(this->scales_with_primary, 228360);
-  ::emplace(this->scales_with_primary, 228361);
-  ::emplace(this->scales_with_primary, 228396);
-  ::emplace(this->scales_with_primary, 228478);
-  ::emplace(this->scales_with_primary, 228597);
-  ::emplace(this->scales_with_primary, 228598);
-  ::emplace(this->scales_with_primary, 228599);
-  ::emplace(this->scales_with_primary, 228600);
-  ::emplace(this->scales_with_primary, 228625);
-  ::emplace(this->scales_with_primary, 228645);
-  ::emplace(this->scales_with_primary, 228649);
-  ::emplace(this->scales_with_primary, 228672);
-  ::emplace(this->scales_with_primary, 228700);
-  ::emplace(this->scales_with_primary, 228867);
-  ::emplace(this->scales_with_primary, 230031);
-  ::emplace(this->scales_with_primary, 230034);
-  ::emplace(this->scales_with_primary, 230035);
-  ::emplace(this->scales_with_primary, 194858);
-  ::emplace(this->scales_with_primary, 212423);
-  ::emplace(this->scales_with_primary, 231004);
-  ::emplace(this->scales_with_primary, 231006);
-  ::emplace(this->scales_with_primary, 231317);
-  ::emplace(this->scales_with_primary, 231411);
-  ::emplace(this->scales_with_primary, 231489);
-  ::emplace(this->scales_with_primary, 185855);
-  ::emplace(this->scales_with_primary, 231710);
-  ::emplace(this->scales_with_primary, 231828);
-  ::emplace(this->scales_with_primary, 232056);
-  ::emplace(this->scales_with_primary, 232161);
-  ::emplace(this->scales_with_primary, 232226);
-  ::emplace(this->scales_with_primary, 232315);
-  ::emplace(this->scales_with_primary, 232332);
-  ::emplace(this->scales_with_primary, 232670);
-  ::emplace(this->scales_with_primary, 232673);
-  ::emplace(this->scales_with_primary, 232752);
-  ::emplace(this->scales_with_primary, 233159);
-  ::emplace(this->scales_with_primary, 233162);
-  ::emplace(this->scales_with_primary, 233408);
-  ::emplace(this->scales_with_primary, 234581);
-  ::emplace(this->scales_with_primary, 234582);
-  ::emplace(this->scales_with_primary, 234583);
-  ::emplace(this->scales_with_primary, 234584);
-  ::emplace(this->scales_with_primary, 234680);
-  ::emplace(this->scales_with_primary, 235041);
-  ::emplace(this->scales_with_primary, 235235);
-  ::emplace(this->scales_with_primary, 235285);
-  ::emplace(this->scales_with_primary, 235314);
-  ::emplace(this->scales_with_primary, 235523);
-  ::emplace(this->scales_with_primary, 235709);
-  ::emplace(this->scales_with_primary, 235792);
-  ::emplace(this->scales_with_primary, 235846);
-  ::emplace(this->scales_with_primary, 235856);
-  ::emplace(this->scales_with_primary, 235877);
-  ::emplace(this->scales_with_primary, 235918);
-  ::emplace(this->scales_with_primary, 235964);
-  ::emplace(this->scales_with_primary, 236026);
-  ::emplace(this->scales_with_primary, 236076);
-  ::emplace(this->scales_with_primary, 236164);
-  ::emplace(this->scales_with_primary, 236165);
-  ::emplace(this->scales_with_primary, 236223);
-  ::emplace(this->scales_with_primary, 236282);
-  ::emplace(this->scales_with_primary, 236777);
-  ::emplace(this->scales_with_primary, 236977);
-  ::emplace(this->scales_with_primary, 237680);
-  ::emplace(this->scales_with_primary, 238677);
-  ::emplace(this->scales_with_primary, 238994);
-  ::emplace(this->scales_with_primary, 239688);
-  ::emplace(this->scales_with_primary, 239736);
-  ::emplace(this->scales_with_primary, 239846);
-  ::emplace(this->scales_with_primary, 240258);
-  ::emplace(this->scales_with_primary, 240281);
-  ::emplace(this->scales_with_primary, 240350);
-  ::emplace(this->scales_with_primary, 240689);
-  ::emplace(this->scales_with_primary, 240739);
-  ::emplace(this->scales_with_primary, 241280);
-  ::emplace(this->scales_with_primary, 241456);
-  ::emplace(this->scales_with_primary, 241535);
-  ::emplace(this->scales_with_primary, 240739);
-  ::emplace(this->scales_with_primary, 241774);
-  ::emplace(this->scales_with_primary, 241864);
-  ::emplace(this->scales_with_primary, 242056);
-  ::emplace(this->scales_with_primary, 242098);
-  ::emplace(this->scales_with_primary, 242216);
-  ::emplace(this->scales_with_primary, 242316);
-  ::emplace(this->scales_with_primary, 242390);
-  ::emplace(this->scales_with_primary, 242663);
-  ::emplace(this->scales_with_primary, 242668);
-  ::emplace(this->scales_with_primary, 242688);
-  ::emplace(this->scales_with_primary, 242715);
-  ::emplace(this->scales_with_primary, 242735);
-  ::emplace(this->scales_with_primary, 242798);
-  ::emplace(this->scales_with_primary, 242832);
-  ::emplace(this->scales_with_primary, 242834);
-  ::emplace(this->scales_with_primary, 242851);
-  ::emplace(this->scales_with_primary, 242943);
-  ::emplace(this->scales_with_primary, 242957);
-  ::emplace(this->scales_with_primary, 243011);
-  ::emplace(this->scales_with_primary, 243050);
-  ::emplace(this->scales_with_primary, 243073);
-  ::emplace(this->scales_with_primary, 243121);
-  ::emplace(this->scales_with_primary, 243122);
-  ::emplace(this->scales_with_primary, 243160);
-  ::emplace(this->scales_with_primary, 243228);
-  ::emplace(this->scales_with_primary, 243234);
-  ::emplace(this->scales_with_primary, 243298);
-  ::emplace(this->scales_with_primary, 243313);
-  ::emplace(this->scales_with_primary, 243829);
-  ::emplace(this->scales_with_primary, 244663);
-  ::emplace(this->scales_with_primary, 244785);
-  ::emplace(this->scales_with_primary, 245129);
-  ::emplace(this->scales_with_primary, 245191);
-  ::emplace(this->scales_with_primary, 245200);
-  ::emplace(this->scales_with_primary, 245291);
-  ::emplace(this->scales_with_primary, 245316);
-  ::emplace(this->scales_with_primary, 245317);
-  ::emplace(this->scales_with_primary, 245388);
-  ::emplace(this->scales_with_primary, 245503);
-  ::emplace(this->scales_with_primary, 245518);
-  ::emplace(this->scales_with_primary, 246353);
-  ::emplace(this->scales_with_primary, 246770);
-  ::emplace(this->scales_with_primary, 246923);
-  ::emplace(this->scales_with_primary, 247455);
-  ::emplace(this->scales_with_primary, 247678);
-  ::emplace(this->scales_with_primary, 248346);
-  ::emplace(this->scales_with_primary, 248347);
-  ::emplace(this->scales_with_primary, 248348);
-  ::emplace(this->scales_with_primary, 248367);
-  ::emplace(this->scales_with_primary, 248397);
-  ::emplace(this->scales_with_primary, 248484);
-  ::emplace(this->scales_with_primary, 248487);
-  ::emplace(this->scales_with_primary, 248488);
-  ::emplace(this->scales_with_primary, 248658);
-  ::emplace(this->scales_with_primary, 248794);
-  ::emplace(this->scales_with_primary, 249276);
-  ::emplace(this->scales_with_primary, 250803);
-  ::emplace(this->scales_with_primary, 252623);
-  ::emplace(this->scales_with_primary, 252747);
-  ::emplace(this->scales_with_primary, 253590);
-  ::emplace(this->scales_with_primary, 253597);
-  ::emplace(this->scales_with_primary, 253598);
-  ::emplace(this->scales_with_primary, 253606);
-  ::emplace(this->scales_with_primary, 253827);
-  ::emplace(this->scales_with_primary, 254348);
-  ::emplace(this->scales_with_primary, 255057);
-  ::emplace(this->scales_with_primary, 255467);
-  ::emplace(this->scales_with_primary, 255546);
-  ::emplace(this->scales_with_primary, 255550);
-  ::emplace(this->scales_with_primary, 255616);
-  ::emplace(this->scales_with_primary, 255812);
-  ::emplace(this->scales_with_primary, 255937);
-  ::emplace(this->scales_with_primary, 255966);
-  ::emplace(this->scales_with_primary, 256076);
-  ::emplace(this->scales_with_primary, 256381);
-  ::emplace(this->scales_with_primary, 256565);
-  ::emplace(this->scales_with_primary, 256802);
-  ::emplace(this->scales_with_primary, 256900);
-  ::emplace(this->scales_with_primary, 256901);
-  ::emplace(this->scales_with_primary, 256966);
-  ::emplace(this->scales_with_primary, 256968);
-  ::emplace(this->scales_with_primary, 257045);
-  ::emplace(this->scales_with_primary, 257049);
-  ::emplace(this->scales_with_primary, 257078);
-  ::emplace(this->scales_with_primary, 257276);
-  ::emplace(this->scales_with_primary, 257283);
-  ::emplace(this->scales_with_primary, 257285);
-  ::emplace(this->scales_with_primary, 257482);
-  ::emplace(this->scales_with_primary, 257538);
-  ::emplace(this->scales_with_primary, 257542);
-  ::emplace(this->scales_with_primary, 257620);
-  ::emplace(this->scales_with_primary, 257675);
-  ::emplace(this->scales_with_primary, 257767);
-  ::emplace(this->scales_with_primary, 257802);
-  ::emplace(this->scales_with_primary, 257938);
-  ::emplace(this->scales_with_primary, 258285);
-  ::emplace(this->scales_with_primary, 258326);
-  ::emplace(this->scales_with_primary, 258361);
-  ::emplace(this->scales_with_primary, 258634);
-  ::emplace(this->scales_with_primary, 258640);
-  ::emplace(this->scales_with_primary, 258860);
-  ::emplace(this->scales_with_primary, 258869);
-  ::emplace(this->scales_with_primary, 258921);
-  ::emplace(this->scales_with_primary, 258922);
-  ::emplace(this->scales_with_primary, 258926);
-  ::emplace(this->scales_with_primary, 259271);
-  ::emplace(this->scales_with_primary, 259277);
-  ::emplace(this->scales_with_primary, 259278);
-  ::emplace(this->scales_with_primary, 259293);
-  ::emplace(this->scales_with_primary, 259387);
-  ::emplace(this->scales_with_primary, 259396);
-  ::emplace(this->scales_with_primary, 259398);
-  ::emplace(this->scales_with_primary, 259491);
-  ::emplace(this->scales_with_primary, 259516);
-  ::emplace(this->scales_with_primary, 259587);
-  ::emplace(this->scales_with_primary, 259850);
-  ::emplace(this->scales_with_primary, 260231);
-  ::emplace(this->scales_with_primary, 260235);
-  ::emplace(this->scales_with_primary, 260247);
-  ::emplace(this->scales_with_primary, 260276);
-  ::emplace(this->scales_with_primary, 260297);
-  ::emplace(this->scales_with_primary, 260337);
-  ::emplace(this->scales_with_primary, 260419);
-  ::emplace(this->scales_with_primary, 260643);
-  ::emplace(this->scales_with_primary, 260798);
-  ::emplace(this->scales_with_primary, 260876);
-  ::emplace(this->scales_with_primary, 261028);
-  ::emplace(this->scales_with_primary, 261219);
-  ::emplace(this->scales_with_primary, 261313);
-  ::emplace(this->scales_with_primary, 261403);
-  ::emplace(this->scales_with_primary, 261697);
-  ::emplace(this->scales_with_primary, 261793);
-  ::emplace(this->scales_with_primary, 261947);
-  ::emplace(this->scales_with_primary, 261977);
-  ::emplace(this->scales_with_primary, 262117);
-  ::emplace(this->scales_with_primary, 262161);
-  ::emplace(this->scales_with_primary, 262538);
-  ::emplace(this->scales_with_primary, 262545);
-  ::emplace(this->scales_with_primary, 262656);
-  ::emplace(this->scales_with_primary, 262722);
-  ::emplace(this->scales_with_primary, 262725);
-  ::emplace(this->scales_with_primary, 262732);
-  ::emplace(this->scales_with_primary, 263178);
-  ::emplace(this->scales_with_primary, 263179);
-  ::emplace(this->scales_with_primary, 263333);
-  ::emplace(this->scales_with_primary, 263346);
-  ::emplace(this->scales_with_primary, 263607);
-  ::emplace(this->scales_with_primary, 264178);
-  ::emplace(this->scales_with_primary, 265157);
-  ::emplace(this->scales_with_primary, 265189);
-  ::emplace(this->scales_with_primary, 265279);
-  ::emplace(this->scales_with_primary, 265469);
-  ::emplace(this->scales_with_primary, 265888);
-  ::emplace(this->scales_with_primary, 266056);
-  ::emplace(this->scales_with_primary, 266452);
-  ::emplace(this->scales_with_primary, 267206);
-  ::emplace(this->scales_with_primary, 267213);
-  ::emplace(this->scales_with_primary, 267342);
-  ::emplace(this->scales_with_primary, 267480);
-  ::emplace(this->scales_with_primary, 267617);
-  ::emplace(this->scales_with_primary, 267666);
-  ::emplace(this->scales_with_primary, 267964);
-  ::emplace(this->scales_with_primary, 267997);
-  ::emplace(this->scales_with_primary, 267999);
-  ::emplace(this->scales_with_primary, 268061);
-  ::emplace(this->scales_with_primary, 268347);
-  ::emplace(this->scales_with_primary, 268423);
-  ::emplace(this->scales_with_primary, 269005);
-  ::emplace(this->scales_with_primary, 269282);
-  ::emplace(this->scales_with_primary, 269752);
-  ::emplace(this->scales_with_primary, 269777);
-  ::emplace(this->scales_with_primary, 269778);
-  ::emplace(this->scales_with_primary, 269785);
-  ::emplace(this->scales_with_primary, 269937);
-  ::emplace(this->scales_with_primary, 270329);
-  ::emplace(this->scales_with_primary, 270338);
-  ::emplace(this->scales_with_primary, 270473);
-  ::emplace(this->scales_with_primary, 270480);
-  ::emplace(this->scales_with_primary, 270481);
-  ::emplace(this->scales_with_primary, 270998);
-  ::emplace(this->scales_with_primary, 271048);
-  ::emplace(this->scales_with_primary, 271337);
-  ::emplace(this->scales_with_primary, 271625);
-  ::emplace(this->scales_with_primary, 271774);
-  ::emplace(this->scales_with_primary, 271780);
-  ::emplace(this->scales_with_primary, 271788);
-  ::emplace(this->scales_with_primary, 271816);
-  ::emplace(this->scales_with_primary, 271817);
-  ::emplace(this->scales_with_primary, 271881);
-  ::emplace(this->scales_with_primary, 271971);
-  ::emplace(this->scales_with_primary, 272012);
-  ::emplace(this->scales_with_primary, 272013);
-  ::emplace(this->scales_with_primary, 272156);
-  ::emplace(this->scales_with_primary, 272156);
-  ::emplace(this->scales_with_primary, 272167);
-  ::emplace(this->scales_with_primary, 272172);
-  ::emplace(this->scales_with_primary, 272172);
-  ::emplace(this->scales_with_primary, 272172);
-  ::emplace(this->scales_with_primary, 272172);
-  ::emplace(this->scales_with_primary, 272281);
-  ::emplace(this->scales_with_primary, 272357);
-  ::emplace(this->scales_with_primary, 272415);
-  ::emplace(this->scales_with_primary, 272432);
-  ::emplace(this->scales_with_primary, 272435);
-  ::emplace(this->scales_with_primary, 272439);
-  ::emplace(this->scales_with_primary, 272887);
-  ::emplace(this->scales_with_primary, 273110);
-  ::emplace(this->scales_with_primary, 273324);
-  ::emplace(this->scales_with_primary, 273627);
-  ::emplace(this->scales_with_primary, 273768);
-  ::emplace(this->scales_with_primary, 273770);
-  ::emplace(this->scales_with_primary, 273844);
-  ::emplace(this->scales_with_primary, 273845);
-  ::emplace(this->scales_with_primary, 274281);
-  ::emplace(this->scales_with_primary, 274282);
-  ::emplace(this->scales_with_primary, 274283);
-  ::emplace(this->scales_with_primary, 274703);
-  ::emplace(this->scales_with_primary, 274775);
-  ::emplace(this->scales_with_primary, 274838);
-  ::emplace(this->scales_with_primary, 275045);
-  ::emplace(this->scales_with_primary, 275148);
-  ::emplace(this->scales_with_primary, 275462);
-  ::emplace(this->scales_with_primary, 275699);
-  ::emplace(this->scales_with_primary, 275773);
-  ::emplace(this->scales_with_primary, 275779);
-  ::emplace(this->scales_with_primary, 275809);
-  ::emplace(this->scales_with_primary, 276051);
-  ::emplace(this->scales_with_primary, 277015);
-  ::emplace(this->scales_with_primary, 277016);
-  ::emplace(this->scales_with_primary, 277218);
-  ::emplace(this->scales_with_primary, 277588);
-  ::emplace(this->scales_with_primary, 277741);
-  ::emplace(this->scales_with_primary, 277743);
-  ::emplace(this->scales_with_primary, 279043);
-  ::emplace(this->scales_with_primary, 279146);
-  ::emplace(this->scales_with_primary, 279147);
-  ::emplace(this->scales_with_primary, 279303);
-  ::emplace(this->scales_with_primary, 279547);
-  ::emplace(this->scales_with_primary, 279565);
-  ::emplace(this->scales_with_primary, 280362);
-  ::emplace(this->scales_with_primary, 280421);
-  ::emplace(this->scales_with_primary, 280423);
-  ::emplace(this->scales_with_primary, 280439);
-  ::emplace(this->scales_with_primary, 280561);
-  ::emplace(this->scales_with_primary, 280637);
-  ::emplace(this->scales_with_primary, 280720);
-  ::emplace(this->scales_with_primary, 280772);
-  ::emplace(this->scales_with_primary, 280800);
-  ::emplace(this->scales_with_primary, 280849);
-  ::emplace(this->scales_with_primary, 281210);
-  ::emplace(this->scales_with_primary, 196448);
-  ::emplace(this->scales_with_primary, 281957);
-  ::emplace(this->scales_with_primary, 281996);
-  ::emplace(this->scales_with_primary, 282069);
-  ::emplace(this->scales_with_primary, 282104);
-  ::emplace(this->scales_with_primary, 282263);
-  ::emplace(this->scales_with_primary, 282449);
-  ::emplace(this->scales_with_primary, 282484);
-  ::emplace(this->scales_with_primary, 282493);
-  ::emplace(this->scales_with_primary, 282596);
-  ::emplace(this->scales_with_primary, 282763);
-  ::emplace(this->scales_with_primary, 282901);
-  ::emplace(this->scales_with_primary, 283129);
-  ::emplace(this->scales_with_primary, 283234);
-  ::emplace(this->scales_with_primary, 283353);
-  ::emplace(this->scales_with_primary, 283829);
-  ::emplace(this->scales_with_primary, 283836);
-  ::emplace(this->scales_with_primary, 283840);
-  ::emplace(this->scales_with_primary, 284263);
-  ::emplace(this->scales_with_primary, 284554);
-  ::emplace(this->scales_with_primary, 284762);
-  ::emplace(this->scales_with_primary, 284781);
-  ::emplace(this->scales_with_primary, 285175);
-  ::emplace(this->scales_with_primary, 285335);
-  ::emplace(this->scales_with_primary, 285381);
-  ::emplace(this->scales_with_primary, 285452);
-  ::emplace(this->scales_with_primary, 285466);
-  ::emplace(this->scales_with_primary, 285572);
-  ::emplace(this->scales_with_primary, 285679);
-  ::emplace(this->scales_with_primary, 285680);
-  ::emplace(this->scales_with_primary, 285681);
-  ::emplace(this->scales_with_primary, 287285);
-  ::emplace(this->scales_with_primary, 287606);
-  ::emplace(this->scales_with_primary, 289215);
-  ::emplace(this->scales_with_primary, 289357);
-  ::emplace(this->scales_with_primary, 289870);
-  ::emplace(this->scales_with_primary, 290107);
-  ::emplace(this->scales_with_primary, 290110);
-  ::emplace(this->scales_with_primary, 290645);
-  ::emplace(this->scales_with_primary, 290779);
-  ::emplace(this->scales_with_primary, 290785);
-  ::emplace(this->scales_with_primary, 290955);
-  ::emplace(this->scales_with_primary, 291075);
-  ::emplace(this->scales_with_primary, 291343);
-  ::emplace(this->scales_with_primary, 291345);
-  ::emplace(this->scales_with_primary, 291355);
-  ::emplace(this->scales_with_primary, 291356);
-  ::emplace(this->scales_with_primary, 291363);
-  ::emplace(this->scales_with_primary, 292449);
-  ::emplace(this->scales_with_primary, 292813);
-  ::emplace(this->scales_with_primary, 293985);
-  ::emplace(this->scales_with_primary, 294109);
-  ::emplace(this->scales_with_primary, 294222);
-  ::emplace(this->scales_with_primary, 294292);
-  ::emplace(this->scales_with_primary, 294423);
-  ::emplace(this->scales_with_primary, 294437);
-  ::emplace(this->scales_with_primary, 294550);
-  ::emplace(this->scales_with_primary, 294572);
-  ::emplace(this->scales_with_primary, 294876);
-  ::emplace(this->scales_with_primary, 295676);
-  ::emplace(this->scales_with_primary, 295738);
-  ::emplace(this->scales_with_primary, 295896);
-  ::emplace(this->scales_with_primary, 296033);
-  ::emplace(this->scales_with_primary, 296035);
-  ::emplace(this->scales_with_primary, 296040);
-  ::emplace(this->scales_with_primary, 297577);
-  ::emplace(this->scales_with_primary, 297722);
-  ::emplace(this->scales_with_primary, 299046);
-  ::emplace(this->scales_with_primary, 299050);
-  ::emplace(this->scales_with_primary, 299075);
-  ::emplace(this->scales_with_primary, 300657);
-  ::emplace(this->scales_with_primary, 300745);
-  ::emplace(this->scales_with_primary, 300747);
-  ::emplace(this->scales_with_primary, 301722);
-  ::emplace(this->scales_with_primary, 304537);
-  ::emplace(this->scales_with_primary, 304539);
-  ::emplace(this->scales_with_primary, 305043);
-  ::emplace(this->scales_with_primary, 305045);
-  ::emplace(this->scales_with_primary, 305051);
-  ::emplace(this->scales_with_primary, 305053);
-  ::emplace(this->scales_with_primary, 305496);
-  ::emplace(this->scales_with_primary, 305783);
-  ::emplace(this->scales_with_primary, 306152);
-  ::emplace(this->scales_with_primary, 306256);
-  ::emplace(this->scales_with_primary, 22570);
-  ::emplace(this->scales_with_primary, 307046);
-  ::emplace(this->scales_with_primary, 307303);
-  ::emplace(this->scales_with_primary, 307307);
-  ::emplace(this->scales_with_primary, 307443);
-  ::emplace(this->scales_with_primary, 307652);
-  ::emplace(this->scales_with_primary, 307871);
-  ::emplace(this->scales_with_primary, 308459);
-  ::emplace(this->scales_with_primary, 308495);
-  ::emplace(this->scales_with_primary, 308803);
-  ::emplace(this->scales_with_primary, 309062);
-  ::emplace(this->scales_with_primary, 309063);
-  ::emplace(this->scales_with_primary, 309453);
-  ::emplace(this->scales_with_primary, 309688);
-  ::emplace(this->scales_with_primary, 309711);
-  ::emplace(this->scales_with_primary, 309802);
-  ::emplace(this->scales_with_primary, 309807);
-  ::emplace(this->scales_with_primary, 310121);
-  ::emplace(this->scales_with_primary, 311696);
-  ::emplace(this->scales_with_primary, 311730);
-  ::emplace(this->scales_with_primary, 312321);
-  ::emplace(this->scales_with_primary, 312964);
-  ::emplace(this->scales_with_primary, 314418);
-  ::emplace(this->scales_with_primary, 314473);
-  ::emplace(this->scales_with_primary, 314473);
-  ::emplace(this->scales_with_primary, 314533);
-  ::emplace(this->scales_with_primary, 314633);
-  ::emplace(this->scales_with_primary, 314658);
-  ::emplace(this->scales_with_primary, 314662);
-  ::emplace(this->scales_with_primary, 314742);
-  ::emplace(this->scales_with_primary, 315082);
-  ::emplace(this->scales_with_primary, 315341);
-  ::emplace(this->scales_with_primary, 315585);
-  ::emplace(this->scales_with_primary, 315819);
-  ::emplace(this->scales_with_primary, 315843);
-  ::emplace(this->scales_with_primary, 315938);
-  ::emplace(this->scales_with_primary, 315939);
-  ::emplace(this->scales_with_primary, 315944);
-  ::emplace(this->scales_with_primary, 315952);
-  ::emplace(this->scales_with_primary, 315961);
-  ::emplace(this->scales_with_primary, 316239);
-  ::emplace(this->scales_with_primary, 316490);
-  ::emplace(this->scales_with_primary, 316533);
-  ::emplace(this->scales_with_primary, 316538);
-  ::emplace(this->scales_with_primary, 317221);
-  ::emplace(this->scales_with_primary, 317256);
-  ::emplace(this->scales_with_primary, 317258);
-  ::emplace(this->scales_with_primary, 317272);
-  ::emplace(this->scales_with_primary, 317483);
-  ::emplace(this->scales_with_primary, 317488);
-  ::emplace(this->scales_with_primary, 317489);
-  ::emplace(this->scales_with_primary, 317496);
-  ::emplace(this->scales_with_primary, 317589);
-  ::emplace(this->scales_with_primary, 317791);
-  ::emplace(this->scales_with_primary, 317792);
-  ::emplace(this->scales_with_primary, 318125);
-  ::emplace(this->scales_with_primary, 318489);
-  ::emplace(this->scales_with_primary, 318490);
-  ::emplace(this->scales_with_primary, 319175);
-  ::emplace(this->scales_with_primary, 319190);
-  ::emplace(this->scales_with_primary, 319236);
-  ::emplace(this->scales_with_primary, 319238);
-  ::emplace(this->scales_with_primary, 319243);
-  ::emplace(this->scales_with_primary, 319606);
-  ::emplace(this->scales_with_primary, 319836);
-  ::emplace(this->scales_with_primary, 320035);
-  ::emplace(this->scales_with_primary, 320125);
-  ::emplace(this->scales_with_primary, 320334);
-  ::emplace(this->scales_with_primary, 320341);
-  ::emplace(this->scales_with_primary, 320752);
-  ::emplace(this->scales_with_primary, 320976);
-  ::emplace(this->scales_with_primary, 322167);
-  ::emplace(this->scales_with_primary, 323444);
-  ::emplace(this->scales_with_primary, 323481);
-  ::emplace(this->scales_with_primary, 323547);
-  ::emplace(this->scales_with_primary, 323654);
-  ::emplace(this->scales_with_primary, 323660);
-  ::emplace(this->scales_with_primary, 323673);
-  ::emplace(this->scales_with_primary, 323798);
-  ::emplace(this->scales_with_primary, 323710);
-  ::emplace(this->scales_with_primary, 323802);
-  ::emplace(this->scales_with_primary, 324074);
-  ::emplace(this->scales_with_primary, 324389);
-  ::emplace(this->scales_with_primary, 324420);
-  ::emplace(this->scales_with_primary, 324520);
-  ::emplace(this->scales_with_primary, 324540);
-  ::emplace(this->scales_with_primary, 324654);
-  ::emplace(this->scales_with_primary, 325020);
-  ::emplace(this->scales_with_primary, 325037);
-  ::emplace(this->scales_with_primary, 325079);
-  ::emplace(this->scales_with_primary, 325130);
-  ::emplace(this->scales_with_primary, 325153);
-  ::emplace(this->scales_with_primary, 325283);
-  ::emplace(this->scales_with_primary, 325326);
-  ::emplace(this->scales_with_primary, 325373);
-  ::emplace(this->scales_with_primary, 325461);
-  ::emplace(this->scales_with_primary, 325464);
-  ::emplace(this->scales_with_primary, 325883);
-  ::emplace(this->scales_with_primary, 325886);
-  ::emplace(this->scales_with_primary, 287285);
-  ::emplace(this->scales_with_primary, 325984);
-  ::emplace(this->scales_with_primary, 326062);
-  ::emplace(this->scales_with_primary, 326083);
-  ::emplace(this->scales_with_primary, 326731);
-  ::emplace(this->scales_with_primary, 327059);
-  ::emplace(this->scales_with_primary, 327099);
-  ::emplace(this->scales_with_primary, 327162);
-  ::emplace(this->scales_with_primary, 327258);
-  ::emplace(this->scales_with_primary, 327264);
-  ::emplace(this->scales_with_primary, 327498);
-  ::emplace(this->scales_with_primary, 327611);
-  ::emplace(this->scales_with_primary, 328082);
-  ::emplace(this->scales_with_primary, 328204);
-  ::emplace(this->scales_with_primary, 328306);
-  ::emplace(this->scales_with_primary, 328547);
-  ::emplace(this->scales_with_primary, 328757);
-  ::emplace(this->scales_with_primary, 328928);
-  ::emplace(this->scales_with_primary, 329158);
-  ::emplace(this->scales_with_primary, 329274);
-  ::emplace(this->scales_with_primary, 330656);
-  ::emplace(this->scales_with_primary, 330888);
-  ::emplace(this->scales_with_primary, 330903);
-  ::emplace(this->scales_with_primary, 330906);
-  ::emplace(this->scales_with_primary, 330907);
-  ::emplace(this->scales_with_primary, 330911);
-  ::emplace(this->scales_with_primary, 331161);
-  ::emplace(this->scales_with_primary, 331163);
-  ::emplace(this->scales_with_primary, 331433);
-  ::emplace(this->scales_with_primary, 331628);
-  ::emplace(this->scales_with_primary, 331850);
-  ::emplace(this->scales_with_primary, 331962);
-  ::emplace(this->scales_with_primary, 332164);
-  ::emplace(this->scales_with_primary, 332468);
-  ::emplace(this->scales_with_primary, 332469);
-  ::emplace(this->scales_with_primary, 332609);
-  ::emplace(this->scales_with_primary, 332693);
-  ::emplace(this->scales_with_primary, 332773);
-  ::emplace(this->scales_with_primary, 333110);
-  ::emplace(this->scales_with_primary, 333298);
-  ::emplace(this->scales_with_primary, 333389);
-  ::emplace(this->scales_with_primary, 333767);
-  ::emplace(this->scales_with_primary, 333860);
-  ::emplace(this->scales_with_primary, 333977);
-  ::emplace(this->scales_with_primary, 334073);
-  ::emplace(this->scales_with_primary, 172);
-  ::emplace(this->scales_with_primary, 334851);
-  ::emplace(this->scales_with_primary, 335096);
-  ::emplace(this->scales_with_primary, 335098);
-  ::emplace(this->scales_with_primary, 335100);
-  ::emplace(this->scales_with_primary, 335546);
-  ::emplace(this->scales_with_primary, 335614);
-  ::emplace(this->scales_with_primary, 336872);
-  ::emplace(this->scales_with_primary, 336899);
-  ::emplace(this->scales_with_primary, 336904);
-}
-
@@ -0,0 +1,539 @@
+#include <prescience_helper/encounter_cache.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace encounter_cache = prescience_helper::encounter_cache;
+
+namespace {
+  constexpr std::uint32_t MAGIC = 0x43454850; //"PHEC"
+  constexpr std::uint32_t NO_UNIT = std::numeric_limits<std::uint32_t>::max();
+
+  struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+  };
+
+  //records are 8 byte aligned, every array in the file starts on an 8 byte boundary
+  struct Aura_record {
+    std::int64_t when;
+    std::uint64_t id;
+    std::uint32_t caster;
+    std::uint8_t caster_is_player;
+    std::uint8_t stacks;
+    std::uint8_t padding[2];
+  };
+  struct Spell_record {
+    std::int64_t when;
+    std::uint64_t id;
+    std::int64_t damage_done;
+    std::uint32_t target;
+    std::uint8_t crit;
+    std::uint8_t attributes;
+    std::uint8_t padding[2];
+  };
+  struct Swing_record {
+    std::int64_t when;
+    std::int64_t damage_done;
+    std::uint32_t target;
+    std::uint8_t crit;
+    std::uint8_t padding[3];
+  };
+  struct Pet_swing_record {
+    std::int64_t when;
+    std::int64_t damage_done;
+    std::uint32_t target;
+    std::uint32_t name;
+    std::uint8_t crit;
+    std::uint8_t padding[7];
+  };
+  struct Item_record {
+    std::uint64_t item_id;
+    std::int64_t permanent_enchant_id;
+    std::uint16_t ilvl;
+    std::uint8_t has_permanent_enchant;
+    std::uint8_t padding[5];
+  };
+
+  static_assert(sizeof(Aura_record) == 24);
+  static_assert(sizeof(Spell_record) == 32);
+  static_assert(sizeof(Swing_record) == 24);
+  static_assert(sizeof(Pet_swing_record) == 32);
+  static_assert(sizeof(Item_record) == 24);
+
+  struct Writer {
+  public:
+    template<typename T>
+    void put(T const& value) requires std::is_trivially_copyable_v<T> {
+      const auto bytes = std::as_bytes(std::span<const T, 1>{ &value, 1 });
+      out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+
+    //a count, then the records, both 8 byte aligned
+    template<typename T>
+    void put_array(std::span<const T> values) requires std::is_trivially_copyable_v<T> {
+      align();
+      put(static_cast<std::uint64_t>(values.size()));
+      const auto bytes = std::as_bytes(values);
+      out.insert(out.end(), bytes.begin(), bytes.end());
+      align();
+    }
+
+    void align() {
+      out.resize((out.size() + 7) / 8 * 8);
+    }
+
+    std::vector<std::byte> out;
+  };
+
+  struct Reader {
+  public:
+    template<typename T>
+    T get() requires std::is_trivially_copyable_v<T> {
+      T returning;
+      std::memcpy(&returning, take_(sizeof(T)), sizeof(T));
+      return returning;
+    }
+
+    template<typename T>
+    std::span<const T> get_array() requires std::is_trivially_copyable_v<T> {
+      align();
+      const auto count = get<std::uint64_t>();
+      if (count > (in.size() - pos) / std::max<std::size_t>(1, sizeof(T))) {
+        throw std::runtime_error("Encounter cache file is cut short");
+      }
+      //8 byte aligned in the file, and the file is read into 8 byte aligned memory
+      const auto returning = std::span<const T>{ reinterpret_cast<const T*>(take_(static_cast<std::size_t>(count) * sizeof(T))), static_cast<std::size_t>(count) };
+      align();
+      return returning;
+    }
+
+    void align() {
+      pos = std::min(in.size(), (pos + 7) / 8 * 8);
+    }
+
+    std::span<const std::byte> in;
+    std::size_t pos = 0;
+  private:
+    const std::byte* take_(std::size_t size) {
+      if (in.size() - pos < size) {
+        throw std::runtime_error("Encounter cache file is cut short");
+      }
+      const auto returning = in.data() + pos;
+      pos += size;
+      return returning;
+    }
+  };
+
+  //every string the file refers to, written once
+  struct String_table {
+  public:
+    std::uint32_t index_of(std::string_view string) {
+      const auto [found, inserted] = indexes.try_emplace(string, static_cast<std::uint32_t>(strings.size()));
+      if (inserted) {
+        strings.push_back(string);
+      }
+      return found->second;
+    }
+
+    std::unordered_map<std::string_view, std::uint32_t> indexes;
+    std::vector<std::string_view> strings;
+  };
+
+  void put_timestamp(Writer& writer, clogparser::Timestamp const& timestamp) {
+    writer.put(static_cast<std::int64_t>(timestamp.month));
+    writer.put(static_cast<std::int64_t>(timestamp.day));
+    writer.put(static_cast<std::int64_t>(timestamp.hour));
+    writer.put(static_cast<std::int64_t>(timestamp.minute));
+    writer.put(static_cast<std::int64_t>(timestamp.second));
+    writer.put(static_cast<std::int64_t>(timestamp.millisecond));
+  }
+
+  clogparser::Timestamp get_timestamp(Reader& reader) {
+    clogparser::Timestamp returning{};
+    returning.month = static_cast<decltype(returning.month)>(reader.get<std::int64_t>());
+    returning.day = static_cast<decltype(returning.day)>(reader.get<std::int64_t>());
+    returning.hour = static_cast<decltype(returning.hour)>(reader.get<std::int64_t>());
+    returning.minute = static_cast<decltype(returning.minute)>(reader.get<std::int64_t>());
+    returning.second = static_cast<decltype(returning.second)>(reader.get<std::int64_t>());
+    returning.millisecond = static_cast<decltype(returning.millisecond)>(reader.get<std::int64_t>());
+    return returning;
+  }
+
+  //the column's events sorted by when, spilled runs first so ties keep the order simulating merges them in
+  template<typename T>
+  std::vector<prescience_helper::Event<T>> all_events(prescience_helper::Event_column<T> const& column, prescience_helper::Spill_file* spill) {
+    std::vector<prescience_helper::Event<T>> returning;
+    returning.reserve(column.size());
+    for (auto const& segment : column.spilled) {
+      if (spill == nullptr) {
+        throw std::runtime_error("Internal logic error");
+      }
+      prescience_helper::Spill_reader<prescience_helper::Event<T>> reader{ *spill, segment };
+      while (auto event = reader.next()) {
+        returning.push_back(*event);
+      }
+    }
+    returning.insert(returning.end(), column.in_memory.begin(), column.in_memory.end());
+    std::stable_sort(returning.begin(), returning.end(), [](auto const& e1, auto const& e2) {
+      return e1.when < e2.when;
+      });
+    return returning;
+  }
+
+  template<typename T, typename Record, typename To_record>
+  void put_column(Writer& writer, prescience_helper::Event_column<T> const& column, prescience_helper::Spill_file* spill, To_record&& to_record) {
+    const auto events = all_events(column, spill);
+    std::vector<Record> records;
+    records.reserve(events.size());
+    for (auto const& event : events) {
+      Record record{};
+      record.when = event.when.count();
+      to_record(event.what, record);
+      records.push_back(record);
+    }
+    writer.put_array(std::span<const Record>{ records });
+  }
+
+  template<typename T, typename Record, typename From_record>
+  void get_column(Reader& reader, prescience_helper::Event_column<T>& column, From_record&& from_record) {
+    const auto records = reader.get_array<Record>();
+    column.in_memory.reserve(records.size());
+    for (auto const& record : records) {
+      column.in_memory.push_back(prescience_helper::Event<T>{ clogparser::Period{ record.when }, from_record(record) });
+    }
+  }
+
+  void put_times(Writer& writer, std::vector<prescience_helper::Event<void>> const& events) {
+    std::vector<std::int64_t> times;
+    times.reserve(events.size());
+    for (auto const& event : events) {
+      times.push_back(event.when.count());
+    }
+    writer.put_array(std::span<const std::int64_t>{ times });
+  }
+
+  void get_times(Reader& reader, std::vector<prescience_helper::Event<void>>& events) {
+    const auto times = reader.get_array<std::int64_t>();
+    events.reserve(times.size());
+    for (const auto when : times) {
+      events.push_back(prescience_helper::Event<void>{ clogparser::Period{ when } });
+    }
+  }
+}
+
+
+void encounter_cache::write(std::filesystem::path const& path, Encounter const& encounter) {
+  PRESCIENCE_HELPER_TRACE_SPAN("write encounter cache");
+
+  //units are numbered targets first, then players
+  std::unordered_map<const Target*, std::uint32_t> unit_indexes;
+  std::vector<std::pair<std::string_view, Target const*>> targets;
+  std::vector<std::pair<std::string_view, Player const*>> players;
+  for (auto const& [guid, target] : encounter.targets) {
+    unit_indexes.emplace(&target, static_cast<std::uint32_t>(targets.size()));
+    targets.emplace_back(guid, &target);
+  }
+  for (auto const& [guid, player] : encounter.players) {
+    unit_indexes.emplace(&player, static_cast<std::uint32_t>(targets.size() + players.size()));
+    players.emplace_back(guid, &player);
+  }
+  const auto unit_index = [&unit_indexes](const Target* unit) {
+    const auto found = unit_indexes.find(unit);
+    return found == unit_indexes.end() ? NO_UNIT : found->second;
+  };
+
+  String_table strings;
+  Writer body;
+  auto* const spill = encounter.spill.get();
+
+  put_timestamp(body, encounter.start_time);
+  put_timestamp(body, encounter.end_time);
+  body.put(static_cast<std::int64_t>(encounter.start.encounter_id));
+  body.put(static_cast<std::int64_t>(encounter.start.difficulty_id));
+  body.put(static_cast<std::int64_t>(encounter.start.instance_size));
+  body.put(strings.index_of(encounter.start.encounter_name));
+  body.put(static_cast<std::uint8_t>(encounter.build.has_value()));
+  const auto build = encounter.build.value_or(clogparser::events::Combat_log_version::Build_version{});
+  body.put(static_cast<std::uint8_t>(build.expac));
+  body.put(static_cast<std::uint8_t>(build.patch));
+  body.put(static_cast<std::uint8_t>(build.minor));
+  body.align();
+
+  //every unit before any event, so reading has them all to point events at
+  body.put(static_cast<std::uint64_t>(targets.size()));
+  for (auto const& [guid, target] : targets) {
+    body.put(strings.index_of(guid));
+    body.put(strings.index_of(target->name));
+  }
+  body.align();
+  body.put(static_cast<std::uint64_t>(players.size()));
+  for (auto const& [guid, player] : players) {
+    auto const& info = player->info;
+    body.put(strings.index_of(guid));
+    body.put(strings.index_of(player->name));
+    body.put(strings.index_of(info.guid));
+    body.put(static_cast<std::int64_t>(info.current_spec_id));
+
+    std::vector<Item_record> items;
+    items.reserve(info.items.size());
+    for (auto const& item : info.items) {
+      Item_record record{};
+      record.item_id = static_cast<std::uint64_t>(item.item_id);
+      record.ilvl = static_cast<std::uint16_t>(item.ilvl);
+      record.has_permanent_enchant = item.permanent_enchant_id.has_value();
+      record.permanent_enchant_id = static_cast<std::int64_t>(item.permanent_enchant_id.value_or(0));
+      items.push_back(record);
+    }
+    body.put_array(std::span<const Item_record>{ items });
+
+    std::vector<std::uint64_t> talents;
+    talents.reserve(info.talents.size());
+    for (auto const& talent : info.talents) {
+      talents.push_back(static_cast<std::uint64_t>(talent.trait_node_entry_id));
+    }
+    body.put_array(std::span<const std::uint64_t>{ talents });
+
+    std::vector<std::uint64_t> auras;
+    auras.reserve(info.interesting_auras.size());
+    for (auto const& aura : info.interesting_auras) {
+      auras.push_back(static_cast<std::uint64_t>(aura.spell_id));
+    }
+    body.put_array(std::span<const std::uint64_t>{ auras });
+  }
+
+  const auto put_auras = [&](Target const& unit) {
+    put_column<Aura_changed, Aura_record>(body, unit.aura_changed, spill, [&](Aura_changed const& what, Aura_record& record) {
+      record.id = what.id;
+      record.stacks = what.stacks;
+      record.caster_is_player = static_cast<std::uint8_t>(what.caster.index());
+      record.caster = std::visit([&](auto const* caster) { return unit_index(caster); }, what.caster);
+      });
+  };
+  const auto to_spell = [&](auto const& what, Spell_record& record) {
+    record.id = what.id;
+    record.crit = what.crit;
+    record.attributes = what.attributes;
+    record.damage_done = what.damage_done;
+    record.target = unit_index(what.target);
+  };
+
+  for (auto const& [guid, target] : targets) {
+    put_auras(*target);
+  }
+  for (auto const& [guid, player] : players) {
+    put_auras(*player);
+    put_column<Spell_impact, Spell_record>(body, player->spell_impact, spill, to_spell);
+    put_column<Spell_tick, Spell_record>(body, player->spell_tick, spill, to_spell);
+    put_column<Swing, Swing_record>(body, player->swing, spill, [&](Swing const& what, Swing_record& record) {
+      record.crit = what.crit;
+      record.damage_done = what.damage_done;
+      record.target = unit_index(what.target);
+      });
+    put_column<Pet_swing, Pet_swing_record>(body, player->pet_swing, spill, [&](Pet_swing const& what, Pet_swing_record& record) {
+      record.name = strings.index_of(what.name);
+      record.crit = what.swing.crit;
+      record.damage_done = what.swing.damage_done;
+      record.target = unit_index(what.swing.target);
+      });
+    put_times(body, player->died);
+    put_times(body, player->rezzed);
+  }
+
+  //strings go first, so reading can resolve indexes as it goes
+  Writer file;
+  file.put(Header{ MAGIC, VERSION });
+  file.put(static_cast<std::uint64_t>(strings.strings.size()));
+  for (const auto string : strings.strings) {
+    file.put_array(std::span<const char>{ string });
+  }
+  file.out.insert(file.out.end(), body.out.begin(), body.out.end());
+
+  //written next to it and renamed, so a reader never sees half a file
+  auto writing = path;
+  writing += ".tmp";
+  {
+    std::ofstream out{ writing, std::ios::binary | std::ios::trunc };
+    out.write(reinterpret_cast<const char*>(file.out.data()), static_cast<std::streamsize>(file.out.size()));
+    if (!out) {
+      throw std::runtime_error("Couldn't write encounter cache file " + writing.string());
+    }
+  }
+  std::filesystem::rename(writing, path);
+}
+
+prescience_helper::Encounter encounter_cache::read(std::filesystem::path const& path, clogparser::String_store& strings) {
+  PRESCIENCE_HELPER_TRACE_SPAN("read encounter cache");
+
+  std::ifstream in{ path, std::ios::binary | std::ios::ate };
+  if (!in) {
+    throw std::runtime_error("Couldn't open encounter cache file " + path.string());
+  }
+  const auto size = static_cast<std::size_t>(in.tellg());
+  in.seekg(0);
+  //u64s, so the records are aligned where they are
+  std::vector<std::uint64_t> storage((size + 7) / 8);
+  in.read(reinterpret_cast<char*>(storage.data()), static_cast<std::streamsize>(size));
+  if (static_cast<std::size_t>(in.gcount()) != size) {
+    throw std::runtime_error("Couldn't read encounter cache file " + path.string());
+  }
+
+  Reader reader{ std::as_bytes(std::span<const std::uint64_t>{ storage }).first(size) };
+  const auto header = reader.get<Header>();
+  if (header.magic != MAGIC) {
+    throw std::runtime_error(path.string() + " isn't an encounter cache file");
+  }
+  if (header.version != VERSION) {
+    throw std::runtime_error(path.string() + " is encounter cache version " + std::to_string(header.version)
+      + ", this build reads version " + std::to_string(VERSION));
+  }
+
+  std::vector<std::string_view> table(static_cast<std::size_t>(std::min<std::uint64_t>(reader.get<std::uint64_t>(), size)));
+  for (auto& string : table) {
+    const auto bytes = reader.get_array<char>();
+    string = strings.get(std::string_view{ bytes.data(), bytes.size() });
+  }
+  const auto string_at = [&table](std::uint32_t index) {
+    if (index >= table.size()) {
+      throw std::runtime_error("Encounter cache file is corrupt");
+    }
+    return table[index];
+  };
+
+  Encounter returning;
+  returning.start_time = get_timestamp(reader);
+  returning.end_time = get_timestamp(reader);
+  returning.start.encounter_id = static_cast<decltype(returning.start.encounter_id)>(reader.get<std::int64_t>());
+  returning.start.difficulty_id = static_cast<decltype(returning.start.difficulty_id)>(reader.get<std::int64_t>());
+  returning.start.instance_size = static_cast<decltype(returning.start.instance_size)>(reader.get<std::int64_t>());
+  returning.start.encounter_name = string_at(reader.get<std::uint32_t>());
+  const bool has_build = reader.get<std::uint8_t>() != 0;
+  clogparser::events::Combat_log_version::Build_version build{};
+  build.expac = reader.get<std::uint8_t>();
+  build.patch = reader.get<std::uint8_t>();
+  build.minor = reader.get<std::uint8_t>();
+  if (has_build) {
+    returning.build = build;
+  }
+  reader.align();
+
+  std::vector<Target*> units;
+  std::vector<Player*> players;
+
+  const auto target_count = static_cast<std::size_t>(reader.get<std::uint64_t>());
+  if (target_count > size) {
+    throw std::runtime_error("Encounter cache file is corrupt");
+  }
+  returning.targets.reserve(target_count);
+  for (std::size_t i = 0; i < target_count; ++i) {
+    const auto guid = string_at(reader.get<std::uint32_t>());
+    const auto name = string_at(reader.get<std::uint32_t>());
+    auto& target = returning.targets[guid];
+    target.name = name;
+    units.push_back(&target);
+  }
+  reader.align();
+
+  const auto player_count = static_cast<std::size_t>(reader.get<std::uint64_t>());
+  if (player_count > size) {
+    throw std::runtime_error("Encounter cache file is corrupt");
+  }
+  returning.players.reserve(player_count);
+  for (std::size_t i = 0; i < player_count; ++i) {
+    const auto guid = string_at(reader.get<std::uint32_t>());
+    auto& player = returning.players[guid];
+    player.name = string_at(reader.get<std::uint32_t>());
+    auto& info = player.info;
+    info.guid = string_at(reader.get<std::uint32_t>());
+    info.current_spec_id = static_cast<decltype(info.current_spec_id)>(reader.get<std::int64_t>());
+
+    for (auto const& record : reader.get_array<Item_record>()) {
+      typename decltype(info.items)::value_type item{};
+      item.item_id = static_cast<decltype(item.item_id)>(record.item_id);
+      item.ilvl = static_cast<decltype(item.ilvl)>(record.ilvl);
+      if (record.has_permanent_enchant) {
+        item.permanent_enchant_id = static_cast<typename decltype(item.permanent_enchant_id)::value_type>(record.permanent_enchant_id);
+      }
+      info.items.push_back(item);
+    }
+    for (const auto id : reader.get_array<std::uint64_t>()) {
+      typename decltype(info.talents)::value_type talent{};
+      talent.trait_node_entry_id = static_cast<decltype(talent.trait_node_entry_id)>(id);
+      info.talents.push_back(talent);
+    }
+    for (const auto id : reader.get_array<std::uint64_t>()) {
+      typename decltype(info.interesting_auras)::value_type aura{};
+      aura.spell_id = static_cast<decltype(aura.spell_id)>(id);
+      info.interesting_auras.push_back(aura);
+    }
+
+    units.push_back(&player);
+    players.push_back(&player);
+  }
+
+  const auto unit_at = [&units](std::uint32_t index) -> Target* {
+    if (index == NO_UNIT) {
+      return nullptr;
+    }
+    if (index >= units.size()) {
+      throw std::runtime_error("Encounter cache file is corrupt");
+    }
+    return units[index];
+  };
+  const auto player_at = [&](std::uint32_t index) -> Player* {
+    if (index == NO_UNIT) {
+      return nullptr;
+    }
+    if (index < target_count || index >= units.size()) {
+      throw std::runtime_error("Encounter cache file is corrupt");
+    }
+    return players[index - target_count];
+  };
+
+  const auto get_auras = [&](Target& unit) {
+    get_column<Aura_changed, Aura_record>(reader, unit.aura_changed, [&](Aura_record const& record) {
+      Aura_changed returning{ static_cast<Target*>(nullptr), record.id, record.stacks };
+      if (record.caster_is_player) {
+        returning.caster = player_at(record.caster);
+      }
+      else {
+        returning.caster = unit_at(record.caster);
+      }
+      return returning;
+      });
+  };
+  const auto from_spell = [&]<typename T>(Spell_record const& record) {
+    return T{ record.id, record.crit != 0, record.attributes, record.damage_done, unit_at(record.target) };
+  };
+
+  for (auto* const target : std::span{ units }.first(target_count)) {
+    get_auras(*target);
+  }
+  for (auto* const player : players) {
+    get_auras(*player);
+    get_column<Spell_impact, Spell_record>(reader, player->spell_impact, [&](Spell_record const& record) {
+      return from_spell.template operator()<Spell_impact>(record);
+      });
+    get_column<Spell_tick, Spell_record>(reader, player->spell_tick, [&](Spell_record const& record) {
+      return from_spell.template operator()<Spell_tick>(record);
+      });
+    get_column<Swing, Swing_record>(reader, player->swing, [&](Swing_record const& record) {
+      return Swing{ record.crit != 0, record.damage_done, unit_at(record.target) };
+      });
+    get_column<Pet_swing, Pet_swing_record>(reader, player->pet_swing, [&](Pet_swing_record const& record) {
+      return Pet_swing{ string_at(record.name), Swing{ record.crit != 0, record.damage_done, unit_at(record.target) } };
+      });
+    get_times(reader, player->died);
+    get_times(reader, player->rezzed);
+  }
+
+  return returning;
+}
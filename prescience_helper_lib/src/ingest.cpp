@@ -1,10 +1,15 @@
 #include <prescience_helper/ingest.hpp>
+#include <prescience_helper/memory.hpp>
 #include <clogparser/parser.hpp>
+#include <prescience_helper/trace.hpp>
+#include <prescience_helper/sim/dbc/spell_attributes.hpp>
 #include <cassert>
 #include <cstdint>
 #include <array>
 #include <sstream>
 #include <algorithm>
+#include <functional>
+#include <span>
 #include <unordered_map>
 
 namespace events = clogparser::events;
@@ -21,22 +26,45 @@ namespace {
     prescience_helper::Player* owner = nullptr;
   };
 
+  //measuring what we hold isn't free, so the memory budget is only checked every this many events
+  constexpr std::size_t BUDGET_CHECK_INTERVAL = 1 << 16;
+
   template<typename T>
-  void append(std::vector<T>& to, std::vector<T> const& from) {
-    to.insert(to.end(), from.begin(), from.end());
+  void append(prescience_helper::Event_column<T>& to, std::vector<prescience_helper::Event<T>> const& from) {
+    to.in_memory.insert(to.in_memory.end(), from.begin(), from.end());
   }
 
   template<typename T>
   void sort_event_vector(std::vector<prescience_helper::Event<T>>& vec) {
-    std::sort(vec.begin(), vec.end(), [](prescience_helper::Event<T> const& e1, prescience_helper::Event<T> const& e2) {
+    const auto earlier = [](prescience_helper::Event<T> const& e1, prescience_helper::Event<T> const& e2) {
       return e1.when < e2.when;
-      });
+    };
+    //usually already sorted, events come in log order
+    if (!std::is_sorted(vec.begin(), vec.end(), earlier)) {
+      std::sort(vec.begin(), vec.end(), earlier);
+    }
+  }
+
+  template<typename Func>
+  void for_each_column(prescience_helper::Encounter& encounter, Func&& func) {
+    for (auto& [guid, target] : encounter.targets) {
+      func(target.aura_changed);
+    }
+    for (auto& [guid, player] : encounter.players) {
+      func(player.aura_changed);
+      func(player.spell_impact);
+      func(player.spell_tick);
+      func(player.swing);
+      func(player.pet_swing);
+    }
   }
 
   struct State {
-    State(clogparser::String_store& strings, std::vector<prescience_helper::Encounter>& out) :
+    State(clogparser::String_store& strings, std::vector<prescience_helper::Encounter>& out, prescience_helper::Ingest_options const& options) :
       encounters(out),
-      strings(strings) {
+      strings(strings),
+      options(options),
+      first_encounter(out.size()) {
 
     }
     std::vector<prescience_helper::Encounter>& encounters;
@@ -44,7 +72,95 @@ namespace {
     std::unordered_map<std::string_view, std::string_view> guid_to_names;
     clogparser::String_store& strings;
     bool in_encounter = false;
+    //in an encounter options.skip_encounter matched, everything until it ends is ignored
+    bool skipping = false;
     std::optional<events::Combat_log_version::Build_version> build_version;
+    prescience_helper::Ingest_options const& options;
+    //encounters before this were in out before we started, they're not ours to spill
+    std::size_t first_encounter;
+    std::size_t events_since_budget_check = 0;
+    //the current encounter's spells' attributes, so each distinct spell is looked up once
+    std::unordered_map<std::uint64_t, std::uint8_t> spell_attributes;
+
+    std::uint8_t attributes_of(std::uint64_t spell_id) {
+      const auto [found, inserted] = spell_attributes.try_emplace(spell_id);
+      if (inserted) {
+        found->second = prescience_helper::sim::dbc::spell_attributes(spell_id);
+      }
+      return found->second;
+    }
+
+    std::size_t friendlies_bytes() const noexcept {
+      std::size_t returning = prescience_helper::memory::heap_bytes(friendlies);
+      for (auto const& [guid, friendly] : friendlies) {
+        returning += prescience_helper::memory::heap_bytes(friendly.spell_impact)
+          + prescience_helper::memory::heap_bytes(friendly.spell_tick)
+          + prescience_helper::memory::heap_bytes(friendly.swing);
+      }
+      return returning;
+    }
+
+    template<typename T>
+    void spill(prescience_helper::Encounter& encounter, prescience_helper::Event_column<T>& column) {
+      if (!encounter.spill) {
+        encounter.spill = std::make_shared<prescience_helper::Spill_file>(options.spill_directory.empty()
+          ? std::filesystem::temp_directory_path()
+          : options.spill_directory);
+      }
+      sort_event_vector(column.in_memory);
+      column.spilled.push_back(encounter.spill->write(std::span<const prescience_helper::Event<T>>{ column.in_memory }));
+      //clear() would keep the capacity
+      column.in_memory = {};
+    }
+
+    //spills the biggest columns until we're back to half the budget
+    void spill_if_over_budget() {
+      std::size_t resident = friendlies_bytes();
+      std::vector<std::size_t> column_bytes;
+      for (std::size_t i = first_encounter; i < encounters.size(); ++i) {
+        const auto usage = prescience_helper::memory::measure(encounters[i]);
+        resident += usage.targets + usage.players;
+        for_each_column(encounters[i], [&column_bytes](auto const& column) {
+          column_bytes.push_back(prescience_helper::memory::heap_bytes(column.in_memory));
+          });
+      }
+      if (resident <= options.memory_budget) {
+        return;
+      }
+      PRESCIENCE_HELPER_TRACE_SPAN("spill");
+
+      std::sort(column_bytes.begin(), column_bytes.end(), std::greater<>{});
+      const std::size_t to_free = resident - options.memory_budget / 2;
+      std::size_t freeing = 0;
+      std::size_t smallest_spilled = 0;
+      for (const auto bytes : column_bytes) {
+        if (freeing >= to_free || bytes == 0) {
+          break;
+        }
+        freeing += bytes;
+        smallest_spilled = bytes;
+      }
+      if (smallest_spilled == 0) {
+        return;
+      }
+
+      for (std::size_t i = first_encounter; i < encounters.size(); ++i) {
+        auto& encounter = encounters[i];
+        for_each_column(encounter, [this, &encounter, smallest_spilled](auto& column) {
+          if (!column.in_memory.empty() && prescience_helper::memory::heap_bytes(column.in_memory) >= smallest_spilled) {
+            spill(encounter, column);
+          }
+          });
+      }
+    }
+
+    void count_event() {
+      if (options.memory_budget == 0 || ++events_since_budget_check < BUDGET_CHECK_INTERVAL) {
+        return;
+      }
+      events_since_budget_check = 0;
+      spill_if_over_budget();
+    }
 
     prescience_helper::Target* get_target(std::string_view guid) {
       assert(!encounters.empty());
@@ -100,14 +216,22 @@ namespace {
       }
     }
     void handle(events::Combat_header const& combat_header) {
+      count_event();
       handle(combat_header.source);
       handle(combat_header.dest);
     }
 
     void end_encounter(clogparser::Timestamp when, std::optional<events::Encounter_end> end, std::size_t start_of_line) {
+      if (skipping) {
+        encounters.back().end_time = when;
+        encounters.back().end_byte = start_of_line;
+        skipping = false;
+        return;
+      }
       if (!in_encounter) {
         return;
       }
+      PRESCIENCE_HELPER_TRACE_SPAN("end_encounter");
       auto& encounter = encounters.back();
       if (end) {
         encounter.end = strings.get(*end);
@@ -135,11 +259,12 @@ namespace {
       set_name(friendlies);
       set_name(encounter.players);
 
+      encounter.friendlies_bytes = friendlies_bytes();
       for (auto const& [guid, friendly] : friendlies) {
         if (friendly.owner != nullptr) {
           append(friendly.owner->spell_impact, friendly.spell_impact);
           append(friendly.owner->spell_tick, friendly.spell_tick);
-          friendly.owner->pet_swing.reserve(friendly.owner->pet_swing.size() + friendly.swing.size());
+          friendly.owner->pet_swing.in_memory.reserve(friendly.owner->pet_swing.in_memory.size() + friendly.swing.size());
           for (auto const& e : friendly.swing) {
             friendly.owner->pet_swing.push_back({
               e.when,
@@ -150,11 +275,10 @@ namespace {
           }
         }
       }
-      for (auto& [guid,player] : encounter.players) {
-        sort_event_vector(player.spell_impact);
-        sort_event_vector(player.spell_tick);
-        sort_event_vector(player.pet_swing);
-      }
+      //simulating merges the sorted runs of every column
+      for_each_column(encounter, [](auto& column) {
+        sort_event_vector(column.in_memory);
+        });
 
       friendlies.clear();
     }
@@ -169,12 +293,22 @@ namespace {
         return;
       }
 
-      in_encounter = true;
+      //a skipped encounter that never ended is kept, like any other
+      skipping = false;
       encounters.emplace_back();
       encounters.back().start = strings.get(event);
       encounters.back().start_time = when;
       encounters.back().build = build_version;
       encounters.back().start_byte = start_of_line;
+
+      if (options.skip_encounter && options.skip_encounter(encounters.back())) {
+        encounters.back().skipped = true;
+        in_encounter = false;
+        skipping = true;
+        return;
+      }
+      in_encounter = true;
+      spell_attributes.clear();
     }
     void operator()(clogparser::Timestamp when, events::Combatant_info const& event, std::size_t start_of_line) {
       if (!in_encounter) {
@@ -202,6 +336,7 @@ namespace {
           prescience_helper::Spell_tick{
             event.spell.id,
             event.damage.crit,
+            attributes_of(event.spell.id),
             event.damage.final,
             get_target(event.combat_header.dest.guid) }
       };
@@ -228,6 +363,7 @@ namespace {
           prescience_helper::Spell_impact{
             event.spell.id,
             event.damage.crit,
+            attributes_of(event.spell.id),
             event.damage.final,
             get_target(event.combat_header.dest.guid) }
       };
@@ -242,6 +378,7 @@ namespace {
       if (!in_encounter) {
         return;
       }
+      count_event();
 
       auto& encounter = encounters.back();
 
@@ -384,8 +521,9 @@ namespace {
   };
 }
 
-void prescience_helper::ingest(File& log, clogparser::String_store& strings, std::vector<prescience_helper::Encounter>& out) {
-  State state{ strings, out };
+void prescience_helper::ingest(File& log, clogparser::String_store& strings, std::vector<prescience_helper::Encounter>& out, Ingest_options const& options) {
+  PRESCIENCE_HELPER_TRACE_SPAN("ingest");
+  State state{ strings, out, options };
 
   clogparser::Parser<State&> parser{ state };
 
@@ -393,7 +531,7 @@ void prescience_helper::ingest(File& log, clogparser::String_store& strings, std
     parser.parse(recved);
   }
 
-  if (state.in_encounter) {
+  if (state.in_encounter || state.skipping) {
     state.encounters.pop_back();
   }
 }
\ No newline at end of file
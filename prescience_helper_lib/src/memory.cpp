@@ -0,0 +1,86 @@
+#include <prescience_helper/memory.hpp>
+
+#include <array>
+#include <cstdio>
+
+namespace memory = prescience_helper::memory;
+
+std::size_t memory::heap_bytes(Target const& target) noexcept {
+  return heap_bytes(target.aura_changed);
+}
+
+std::size_t memory::heap_bytes(Player const& player) noexcept {
+  return heap_bytes(static_cast<Target const&>(player))
+    + heap_bytes(player.info.talents)
+    + heap_bytes(player.info.items)
+    + heap_bytes(player.info.interesting_auras)
+    + heap_bytes(player.spell_impact)
+    + heap_bytes(player.spell_tick)
+    + heap_bytes(player.swing)
+    + heap_bytes(player.pet_swing)
+    + heap_bytes(player.died)
+    + heap_bytes(player.rezzed);
+}
+
+std::size_t memory::heap_bytes(sim::Player_state const& player) noexcept {
+  return sizeof(sim::Player_state)
+    + heap_bytes(player.auras)
+    + heap_bytes(player.aug_buffs)
+    + heap_bytes(player.talents)
+    + heap_bytes(player.items);
+}
+
+std::size_t memory::heap_bytes(sim::on_rails::Encounter const& encounter) noexcept {
+  std::size_t returning = heap_bytes(encounter.players);
+  for (auto const& player : encounter.players) {
+    if (player.sim_player) {
+      returning += heap_bytes(*player.sim_player);
+    }
+    returning += heap_bytes(player.damage_events)
+      + player.stat_events.heap_bytes()
+      + heap_bytes(player.died)
+      + heap_bytes(player.rezzed);
+  }
+  return returning;
+}
+
+memory::Encounter_usage memory::measure(Encounter const& encounter) noexcept {
+  Encounter_usage returning;
+  returning.targets = heap_bytes(encounter.targets);
+  for (auto const& [guid, target] : encounter.targets) {
+    returning.targets += heap_bytes(target);
+  }
+  returning.players = heap_bytes(encounter.players);
+  for (auto const& [guid, player] : encounter.players) {
+    returning.players += heap_bytes(player);
+  }
+  returning.friendlies = encounter.friendlies_bytes;
+  returning.spilled = encounter.spill ? encounter.spill->size() : 0;
+  return returning;
+}
+
+std::size_t memory::measure_ingested(std::vector<Encounter> const& encounters) noexcept {
+  std::size_t returning = heap_bytes(encounters);
+  for (auto const& encounter : encounters) {
+    const auto usage = measure(encounter);
+    returning += usage.targets + usage.players;
+  }
+  return returning;
+}
+
+std::string memory::format_bytes(std::size_t bytes) {
+  constexpr std::array<const char*, 4> UNITS{ "KB", "MB", "GB", "TB" };
+  char buffer[32];
+  if (bytes < 1024) {
+    std::snprintf(buffer, sizeof(buffer), "%zuB", bytes);
+    return buffer;
+  }
+  double scaled = static_cast<double>(bytes) / 1024;
+  std::size_t unit = 0;
+  while (scaled >= 1024 && unit + 1 < UNITS.size()) {
+    scaled /= 1024;
+    ++unit;
+  }
+  std::snprintf(buffer, sizeof(buffer), "%.1f%s", scaled, UNITS[unit]);
+  return buffer;
+}
@@ -1,5 +1,10 @@
 #include <prescience_helper/sim/on_rails.hpp>
+#include <prescience_helper/sim/specs/registry.hpp>
+#include <prescience_helper/trace.hpp>
 #include <algorithm>
+#include <memory>
+#include <span>
+#include <stdexcept>
 
 namespace sim = prescience_helper::sim;
 
@@ -7,16 +12,27 @@ namespace {
   template<typename Parent, typename T>
   struct Event_wrapper {
     Parent* parent;
+    //the generated player the event is for, nullptr for targets
+    sim::on_rails::Player* player;
     T event;
   };
 
+  //player events are wrapped with their spec module's own type, so the visit in simulate is the only dispatch
+  template<typename List>
+  struct Event_variant;
+
+  template<typename ...Specs>
+  struct Event_variant<sim::specs::Spec_list<Specs...>> {
+    using type = std::variant<
+      Event_wrapper<sim::Target_state, prescience_helper::Aura_changed>,
+      Event_wrapper<Specs, prescience_helper::Spell_impact>...,
+      Event_wrapper<Specs, prescience_helper::Swing>...,
+      Event_wrapper<Specs, prescience_helper::Pet_swing>...>;
+  };
+
   struct Event {
     clogparser::Period when;
-    std::variant<
-      Event_wrapper<sim::Target_state, prescience_helper::Aura_changed>,
-      Event_wrapper<sim::Player_state, prescience_helper::Spell_impact>,
-      Event_wrapper<sim::Player_state, prescience_helper::Swing>,
-      Event_wrapper<sim::Player_state, prescience_helper::Pet_swing>> event_variant;
+    Event_variant<sim::specs::All>::type event_variant;
   };
 
   using Players = std::unordered_map<const prescience_helper::Player*, sim::Player_state*>;
@@ -25,86 +41,182 @@ namespace {
   const sim::Target_state* convert_to_sim(prescience_helper::Target* caster, Players const& players, Targets const& targets) {
     const auto found = targets.find(caster);
     if (found == targets.end()) {
-      throw std::exception("Internal logic error");
+      throw std::runtime_error("Internal logic error");
     }
     return &found->second;
   }
   sim::Player_state* convert_to_sim(prescience_helper::Player* caster, Players const& players, Targets const& targets) {
     const auto found = players.find(caster);
     if (found == players.end()) {
-      throw std::exception("Internal logic error");
+      throw std::runtime_error("Internal logic error");
     }
     return found->second;
   }
 
-  void do_event(sim::on_rails::Encounter& encounter, clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<sim::Target_state, prescience_helper::Aura_changed> const& event) {
+  void do_event(clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<sim::Target_state, prescience_helper::Aura_changed> const& event) {
     sim::Unit caster;
     std::visit([&caster, &players, &targets](auto const& caster_in) {
       caster = convert_to_sim(caster_in, players, targets);
       }, event.event.caster);
-    const auto found_generated_player = std::find_if(encounter.players.begin(), encounter.players.end(), [sim_player = event.parent](sim::on_rails::Player const& p) {
-      return p.sim_player.get() == sim_player;
-    });
-    if (found_generated_player != encounter.players.end()) {
-      const auto prev_stats = found_generated_player->sim_player->current_stats;
+    if (event.player != nullptr) {
+      const auto prev_stats = event.player->sim_player->current_stats;
       event.parent->aura_changed(caster, event.event.id, event.event.stacks);
-      if (prev_stats != found_generated_player->sim_player->current_stats) {
-        found_generated_player->stat_events.push_back(prescience_helper::Event<sim::Combat_stats>{
-          when,
-          found_generated_player->sim_player->current_stats
-        });
-      }
+      event.player->stat_events.push_back(when, prev_stats, event.player->sim_player->current_stats);
     } else {
       event.parent->aura_changed(caster, event.event.id, event.event.stacks);
     }
     
   }
-  void do_event(sim::on_rails::Encounter& encounter, clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<sim::Player_state, prescience_helper::Spell_impact> const& event) {
+  //Spec is final, so its impact, swing and pet_swing are called directly and can be inlined
+  template<typename Spec>
+  void do_event(clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<Spec, prescience_helper::Spell_impact> const& event) {
     const auto found_target = targets.find(event.event.target);
     assert(found_target != targets.end());
-    const auto damage = event.parent->impact(event.event.id, event.event.crit, found_target->second, event.event.damage_done);
-
-    const auto found_generated_player = std::find_if(encounter.players.begin(), encounter.players.end(), [sim_player = event.parent](sim::on_rails::Player const& p) {
-      return p.sim_player.get() == sim_player;
-      });
-    assert(found_generated_player != encounter.players.end());
-    found_generated_player->damage_events.push_back(prescience_helper::Event<sim::Damage>{
+    event.player->damage_events.push_back(prescience_helper::Event<sim::Damage>{
       when,
-      damage });
+      event.parent->impact(event.event.id, event.event.attributes, event.event.crit, found_target->second, event.event.damage_done) });
   }
-  void do_event(sim::on_rails::Encounter& encounter, clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<sim::Player_state, prescience_helper::Swing> const& event) {
+  template<typename Spec>
+  void do_event(clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<Spec, prescience_helper::Swing> const& event) {
     const auto found_target = targets.find(event.event.target);
     assert(found_target != targets.end());
-    const auto damage = event.parent->swing(event.event.crit, found_target->second, event.event.damage_done);
-
-    const auto found_generated_player = std::find_if(encounter.players.begin(), encounter.players.end(), [sim_player = event.parent](sim::on_rails::Player const& p) {
-      return p.sim_player.get() == sim_player;
-      });
-    assert(found_generated_player != encounter.players.end());
-    found_generated_player->damage_events.push_back(prescience_helper::Event<sim::Damage>{
+    event.player->damage_events.push_back(prescience_helper::Event<sim::Damage>{
       when,
-      damage });
+      event.parent->swing(event.event.crit, found_target->second, event.event.damage_done) });
   }
-  void do_event(sim::on_rails::Encounter& encounter, clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<sim::Player_state, prescience_helper::Pet_swing> const& event) {
+  template<typename Spec>
+  void do_event(clogparser::Period when, Players const& players, Targets const& targets, Event_wrapper<Spec, prescience_helper::Pet_swing> const& event) {
     const auto found_target = targets.find(event.event.swing.target);
     assert(found_target != targets.end());
-    const auto damage = event.parent->pet_swing(event.event.swing.crit, found_target->second, event.event.swing.damage_done);
-
-    const auto found_generated_player = std::find_if(encounter.players.begin(), encounter.players.end(), [sim_player = event.parent](sim::on_rails::Player const& p) {
-      return p.sim_player.get() == sim_player;
-      });
-    assert(found_generated_player != encounter.players.end());
-    found_generated_player->damage_events.push_back(prescience_helper::Event<sim::Damage>{
+    event.player->damage_events.push_back(prescience_helper::Event<sim::Damage>{
       when,
-      damage });
+      event.parent->pet_swing(event.event.swing.crit, found_target->second, event.event.swing.damage_done) });
   }
 
   constexpr sim::Combat_stats ZERO_STATS;
+
+  ::Event to_event(sim::Target_state* parent, sim::on_rails::Player* player, prescience_helper::Event<prescience_helper::Aura_changed> const& event) {
+    return ::Event{
+      event.when,
+      Event_wrapper<sim::Target_state, prescience_helper::Aura_changed>{
+        parent,
+        player,
+        event.what } };
+  }
+  template<typename Spec>
+  ::Event to_event(Spec* parent, sim::on_rails::Player* player, prescience_helper::Event<prescience_helper::Spell_impact> const& event) {
+    return ::Event{
+      event.when,
+      Event_wrapper<Spec, prescience_helper::Spell_impact>{
+        parent,
+        player,
+        event.what } };
+  }
+  template<typename Spec>
+  ::Event to_event(Spec* parent, sim::on_rails::Player* player, prescience_helper::Event<prescience_helper::Spell_tick> const& event) {
+    return ::Event{
+      event.when,
+      Event_wrapper<Spec, prescience_helper::Spell_impact>{
+        parent,
+        player,
+        prescience_helper::Spell_impact{
+          event.what.id,
+          event.what.crit,
+          event.what.attributes,
+          event.what.damage_done,
+          event.what.target } } };
+  }
+  template<typename Spec>
+  ::Event to_event(Spec* parent, sim::on_rails::Player* player, prescience_helper::Event<prescience_helper::Swing> const& event) {
+    return ::Event{
+      event.when,
+      Event_wrapper<Spec, prescience_helper::Swing>{
+        parent,
+        player,
+        event.what } };
+  }
+  template<typename Spec>
+  ::Event to_event(Spec* parent, sim::on_rails::Player* player, prescience_helper::Event<prescience_helper::Pet_swing> const& event) {
+    return ::Event{
+      event.when,
+      Event_wrapper<Spec, prescience_helper::Pet_swing>{
+        parent,
+        player,
+        event.what } };
+  }
+
+  //a sorted run of one unit's events of one kind
+  struct Run {
+    virtual ~Run() = default;
+    //false once the run is used up
+    virtual bool next(::Event& out) = 0;
+  };
+
+  template<typename Parent, typename T>
+  struct Memory_run final : public Run {
+    Memory_run(Parent* parent, sim::on_rails::Player* player, std::span<const prescience_helper::Event<T>> events) :
+      parent(parent),
+      player(player),
+      events(events) {
+
+    }
+
+    bool next(::Event& out) override {
+      if (pos == events.size()) {
+        return false;
+      }
+      out = to_event(parent, player, events[pos++]);
+      return true;
+    }
+
+    Parent* parent;
+    sim::on_rails::Player* player;
+    std::span<const prescience_helper::Event<T>> events;
+    std::size_t pos = 0;
+  };
+
+  //streamed back from the spill file a chunk at a time
+  template<typename Parent, typename T>
+  struct Spilled_run final : public Run {
+    Spilled_run(Parent* parent, sim::on_rails::Player* player, prescience_helper::Spill_file& file, prescience_helper::Spill_segment segment) :
+      parent(parent),
+      player(player),
+      reader(file, segment) {
+
+    }
+
+    bool next(::Event& out) override {
+      const auto read = reader.next();
+      if (!read) {
+        return false;
+      }
+      out = to_event(parent, player, *read);
+      return true;
+    }
+
+    Parent* parent;
+    sim::on_rails::Player* player;
+    prescience_helper::Spill_reader<prescience_helper::Event<T>> reader;
+  };
+
+  template<typename Parent, typename T>
+  void add_runs(std::vector<std::unique_ptr<Run>>& runs, Parent* parent, sim::on_rails::Player* player, prescience_helper::Event_column<T> const& column, prescience_helper::Spill_file* spill) {
+    if (!column.spilled.empty() && spill == nullptr) {
+      throw std::runtime_error("Internal logic error");
+    }
+    for (auto const& segment : column.spilled) {
+      runs.push_back(std::make_unique<Spilled_run<Parent, T>>(parent, player, *spill, segment));
+    }
+    if (!column.in_memory.empty()) {
+      runs.push_back(std::make_unique<Memory_run<Parent, T>>(parent, player, column.in_memory));
+    }
+  }
 }
 
-sim::on_rails::Encounter sim::on_rails::simulate(prescience_helper::Encounter const& encounter) {
+sim::on_rails::Encounter sim::on_rails::simulate(prescience_helper::Encounter const& encounter, Gear_cache* gear_cache) {
+  PRESCIENCE_HELPER_TRACE_SPAN("simulate");
 
-  std::vector<::Event> events;
+  std::vector<std::unique_ptr<Run>> runs;
   Players players;
   Targets targets;
   Encounter generating_encounter;
@@ -115,13 +227,7 @@ sim::on_rails::Encounter sim::on_rails::simulate(prescience_helper::Encounter co
 
   for (auto const& [guid, target] : encounter.targets) {
     const auto emplaced = &targets.emplace(&target, guid).first->second;
-    for (auto const& aura_changed : target.aura_changed) {
-      events.push_back(::Event{
-        aura_changed.when,
-        Event_wrapper<sim::Target_state, prescience_helper::Aura_changed>{
-          emplaced,
-          aura_changed.what } });
-    }
+    add_runs<sim::Target_state>(runs, emplaced, nullptr, target.aura_changed, encounter.spill.get());
   }
   players.reserve(encounter.players.size());
   generating_encounter.players.reserve(encounter.players.size());
@@ -129,64 +235,60 @@ sim::on_rails::Encounter sim::on_rails::simulate(prescience_helper::Encounter co
     generating_encounter.players.emplace_back();
     auto& generating_player = generating_encounter.players.back();
     generating_player.ingest_player = &player;
-    generating_player.sim_player = sim::Player_state::create(player.info);
-    generating_player.stat_events.push_back(Event<Combat_stats>{
-      clogparser::Period{ 0 },
-      generating_player.sim_player->current_stats
-    });
     generating_player.died = player.died;
     generating_player.rezzed = player.rezzed;
 
-    players.emplace(&player, generating_player.sim_player.get());
-    const auto added = generating_player.sim_player.get();
-
-    for (auto const& aura_changed : player.aura_changed) {
-      events.push_back(::Event{
-        aura_changed.when,
-        Event_wrapper<sim::Target_state, prescience_helper::Aura_changed>{
-          added,
-          aura_changed.what } });
-    }
-    for (auto const& spell_impact : player.spell_impact) {
-      events.push_back(::Event{
-        spell_impact.when,
-        Event_wrapper<sim::Player_state, prescience_helper::Spell_impact>{
-          added,
-          spell_impact.what } });
-    }
-    for (auto const& spell_tick : player.spell_tick) {
-      events.push_back(::Event{
-        spell_tick.when,
-        Event_wrapper<sim::Player_state, prescience_helper::Spell_impact>{
-          added,
-          prescience_helper::Spell_impact{
-            spell_tick.what.id,
-            spell_tick.what.crit,
-            spell_tick.what.damage_done,
-            spell_tick.what.target }
-      } });
-    }
-    for (auto const& aura_removed : player.swing) {
-      events.push_back(::Event{
-        aura_removed.when,
-        Event_wrapper<sim::Player_state, prescience_helper::Swing>{
-          added,
-          aura_removed.what } });
-    }
-    for (auto const& aura_removed : player.pet_swing) {
-      events.push_back(::Event{
-        aura_removed.when,
-        Event_wrapper<sim::Player_state, prescience_helper::Pet_swing>{
-          added,
-          aura_removed.what } });
-    }
+    //players' pointers stay valid, generating_encounter.players was reserved
+    sim::specs::create(player.info, gear_cache, [&](auto created) {
+      using Spec = typename decltype(created)::element_type;
+      const auto added = created.get();
+      generating_player.sim_player = std::move(created);
+      generating_player.stat_events.push_back(clogparser::Period{ 0 }, ZERO_STATS, generating_player.sim_player->current_stats);
+      players.emplace(&player, added);
+
+      add_runs<sim::Target_state>(runs, added, &generating_player, player.aura_changed, encounter.spill.get());
+      add_runs<Spec>(runs, added, &generating_player, player.spell_impact, encounter.spill.get());
+      add_runs<Spec>(runs, added, &generating_player, player.spell_tick, encounter.spill.get());
+      add_runs<Spec>(runs, added, &generating_player, player.swing, encounter.spill.get());
+      add_runs<Spec>(runs, added, &generating_player, player.pet_swing, encounter.spill.get());
+      });
   }
 
-  std::sort(events.begin(), events.end(), [](::Event const& e1, ::Event const& e2) { return e1.when < e2.when; });
+  //every run is sorted, so merging them visits events in time order without
+  //copying the whole encounter into one vector. Ties go to the earlier run
+  struct Pending {
+    ::Event event;
+    std::size_t run;
+  };
+  const auto later = [](Pending const& p1, Pending const& p2) {
+    if (p1.event.when != p2.event.when) {
+      return p1.event.when > p2.event.when;
+    }
+    return p1.run > p2.run;
+  };
 
-  for (auto const& event : events) {
-    std::visit([&targets, &players, &generating_encounter, when = event.when](auto const& event) { do_event(generating_encounter, when, players, targets, event); },
-      event.event_variant);
+  std::vector<Pending> pending;
+  pending.reserve(runs.size());
+  for (std::size_t i = 0; i < runs.size(); ++i) {
+    pending.emplace_back();
+    if (runs[i]->next(pending.back().event)) {
+      pending.back().run = i;
+    } else {
+      pending.pop_back();
+    }
+  }
+  std::make_heap(pending.begin(), pending.end(), later);
+
+  while (!pending.empty()) {
+    std::pop_heap(pending.begin(), pending.end(), later);
+    auto& current = pending.back();
+    std::visit([&targets, &players, when = current.event.when](auto const& event) { do_event(when, players, targets, event); },
+      current.event.event_variant);
+    if (runs[current.run]->next(current.event)) {
+      std::push_heap(pending.begin(), pending.end(), later);
+    } else {
+      pending.pop_back();
+    }
   }
 
   return generating_encounter;
@@ -194,10 +296,11 @@ sim::on_rails::Encounter sim::on_rails::simulate(prescience_helper::Encounter co
 
 std::vector<prescience_helper::Event<sim::Combat_stats>> sim::on_rails::aggregate_stats(
   std::span<const clogparser::Period> duration,
-  std::span<const std::vector<Event<sim::Combat_stats>>> stats,
+  std::span<const sim::Stats_timeline> stats,
   std::span<const std::vector<Event<void>>> dieds,
   std::span<const std::vector<Event<void>>> rezzeds,
   std::span<const double> weights) noexcept {
+  PRESCIENCE_HELPER_TRACE_SPAN("aggregate_stats");
 
   std::vector<Event<Combat_stats>> returning;
 
@@ -209,7 +312,7 @@ std::vector<prescience_helper::Event<sim::Combat_stats>> sim::on_rails::aggregat
   }
 
   struct Stats_change {
-    Combat_stats to;
+    Stats_delta delta;
     Combat_stats* which;
   };
 
@@ -266,7 +369,7 @@ std::vector<prescience_helper::Event<sim::Combat_stats>> sim::on_rails::aggregat
     while (iter != events.end() && iter->when == now) {
       if (std::holds_alternative<Stats_change>(iter->what)) {
         auto const& what = std::get<Stats_change>(iter->what);
-        *what.which = what.to;
+        what.delta.apply(*what.which);
       } else if (std::holds_alternative<Died>(iter->what)) {
         auto const& what = std::get<Died>(iter->what);
         agging_valid[what.i] = false;
@@ -347,12 +450,13 @@ std::vector<prescience_helper::Event<sim::Calced_damage>> sim::on_rails::aggrega
   std::span<const Event<Combat_stats>> aug,
   std::span<const clogparser::Period> player_duration,
   std::span<const std::vector<Event<Damage>>> player_damage,
-  std::span<const std::vector<Event<Combat_stats>>> player_stats,
+  std::span<const Stats_timeline> player_stats,
   std::span<const std::vector<Event<void>>> player_died,
   std::span<const std::vector<Event<void>>> player_rezzed,
   std::span<const double> weights,
   bool fate_mirror,
   clogparser::Period window_size) noexcept {
+  PRESCIENCE_HELPER_TRACE_SPAN("aggregate_damage");
 
   std::vector<Event<Calced_damage>> returning;
 
@@ -372,7 +476,7 @@ std::vector<prescience_helper::Event<sim::Calced_damage>> sim::on_rails::aggrega
   };
 
   struct Stats_change {
-    Combat_stats to;
+    Stats_delta delta;
     std::size_t i = -1;
   };
 
@@ -448,7 +552,9 @@ std::vector<prescience_helper::Event<sim::Calced_damage>> sim::on_rails::aggrega
     if (stats.empty()) {
       return returning;
     }
-    agging_stats.push_back(stats.front().what);
+    //the first change is from zero stats, so applying it gives the starting stats
+    auto& starting = agging_stats.emplace_back();
+    (*stats.begin()).what.apply(starting);
   }
   agging_valid.resize(player_stats.size(), 1);
   agging_alive.resize(player_stats.size(), true);
@@ -469,7 +575,7 @@ std::vector<prescience_helper::Event<sim::Calced_damage>> sim::on_rails::aggrega
         }
       } else if (std::holds_alternative<Stats_change>(iter->what)) {
         auto const& what = std::get<Stats_change>(iter->what);
-        agging_stats[what.i] = what.to;
+        what.delta.apply(agging_stats[what.i]);
       } else if (std::holds_alternative<Aug_stats_change>(iter->what)) {
         auto const& what = std::get<Aug_stats_change>(iter->what);
         aug_stats = what.to;
@@ -2,12 +2,16 @@
 #include <prescience_helper/sim/dbc_constants.hpp>
 #include <prescience_helper/sim/spells.hpp>
 #include <prescience_helper/sim/helpers.hpp>
-#include <prescience_helper/sim/specs/aug.hpp>
+#include <prescience_helper/sim/specs/registry.hpp>
 #include <prescience_helper/sim/helpers.hpp>
 #include <prescience_helper/sim/dbc/rand_prop_points.hpp>
 #include <prescience_helper/sim/dbc/item_sparse.hpp>
+#include <prescience_helper/sim/dbc/pack.hpp>
 #include <prescience_helper/sim/dbc/combat_ratings_mult_by_ilvl.hpp>
 #include <cassert>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
 
 namespace sim = prescience_helper::sim;
 
@@ -107,18 +111,6 @@ namespace {
     }*/
   }
 
-  struct Nyi_spec final : sim::Player_state {
-    Nyi_spec(clogparser::events::Combatant_info const& c_info, clogparser::Attribute_rating primary) :
-      Player_state(c_info, primary) {
-      current_stats[sim::Combat_stat::crit_val] += 0.05;
-      current_stats[sim::Combat_stat::mastery_val] += 8;
-    }
-  };
-
-  std::unique_ptr<sim::Player_state> create_nyi(clogparser::events::Combatant_info const& c_info, clogparser::Attribute_rating primary) {
-    return std::make_unique<Nyi_spec>(c_info, primary);
-  }
-
   struct Weapon_enchants {
     std::optional<std::int32_t> mh;
     std::optional<std::int32_t> oh;
@@ -150,36 +142,36 @@ namespace {
   }
 
   float item_rating_mult(clogparser::Item_slot slot, std::uint16_t ilvl) {
-    const auto found = sim::dbc::COMBAT_RATINGS_MULT_BY_ILVL.find(ilvl);
-    if (found == sim::dbc::COMBAT_RATINGS_MULT_BY_ILVL.end()) {
+    const auto found = sim::dbc::combat_ratings_mult_by_ilvl(ilvl);
+    if (found == nullptr) {
       assert(false);
       return 0;
     }
     switch (slot) {
-    case clogparser::Item_slot::bow: return found->second.weapon;
-    case clogparser::Item_slot::ranged_2: return found->second.weapon;
-    case clogparser::Item_slot::two_hand: return found->second.weapon;
-    case clogparser::Item_slot::off_hand_weapon: return found->second.weapon;
-    case clogparser::Item_slot::one_hand: return found->second.weapon;
-    case clogparser::Item_slot::main_hand: return found->second.weapon;
-
-    case clogparser::Item_slot::head: return found->second.armor;
-    case clogparser::Item_slot::chest: return found->second.armor;
-    case clogparser::Item_slot::robe: return found->second.armor;
-    case clogparser::Item_slot::legs: return found->second.armor;
-    case clogparser::Item_slot::shoulder: return found->second.armor;
-    case clogparser::Item_slot::waist: return found->second.armor;
-    case clogparser::Item_slot::feet: return found->second.armor;
-    case clogparser::Item_slot::hands: return found->second.armor;
-    case clogparser::Item_slot::wrist: return found->second.armor;
-    case clogparser::Item_slot::back: return found->second.armor;
-    case clogparser::Item_slot::off_hand: return found->second.armor;
-    case clogparser::Item_slot::shield: return found->second.armor;
-
-    case clogparser::Item_slot::trinket: return found->second.trinket;
-
-    case clogparser::Item_slot::neck: return found->second.jewelry;
-    case clogparser::Item_slot::finger: return found->second.jewelry;
+    case clogparser::Item_slot::bow: return found->weapon;
+    case clogparser::Item_slot::ranged_2: return found->weapon;
+    case clogparser::Item_slot::two_hand: return found->weapon;
+    case clogparser::Item_slot::off_hand_weapon: return found->weapon;
+    case clogparser::Item_slot::one_hand: return found->weapon;
+    case clogparser::Item_slot::main_hand: return found->weapon;
+
+    case clogparser::Item_slot::head: return found->armor;
+    case clogparser::Item_slot::chest: return found->armor;
+    case clogparser::Item_slot::robe: return found->armor;
+    case clogparser::Item_slot::legs: return found->armor;
+    case clogparser::Item_slot::shoulder: return found->armor;
+    case clogparser::Item_slot::waist: return found->armor;
+    case clogparser::Item_slot::feet: return found->armor;
+    case clogparser::Item_slot::hands: return found->armor;
+    case clogparser::Item_slot::wrist: return found->armor;
+    case clogparser::Item_slot::back: return found->armor;
+    case clogparser::Item_slot::off_hand: return found->armor;
+    case clogparser::Item_slot::shield: return found->armor;
+
+    case clogparser::Item_slot::trinket: return found->trinket;
+
+    case clogparser::Item_slot::neck: return found->jewelry;
+    case clogparser::Item_slot::finger: return found->jewelry;
     default:
       assert(false);
       return 0;
@@ -188,20 +180,20 @@ namespace {
 
   sim::Combat_stats get_item_stats(clogparser::Attribute_rating primary, std::uint64_t item_id, std::uint16_t ilvl) {
     sim::Combat_stats returning;
-    const auto found_item = sim::dbc::ITEM_SPARSE.find(item_id);
-    if (found_item == sim::dbc::ITEM_SPARSE.end()) {
+    const auto found_item = sim::dbc::find_item_sparse(item_id);
+    if (!found_item) {
       assert(false);
       return returning;
     }
-    const auto found_rand_prop_point = sim::dbc::RAND_PROP_POINT.find(ilvl);
-    if (found_rand_prop_point == sim::dbc::RAND_PROP_POINT.end()) {
+    const auto found_rand_prop_point = sim::dbc::rand_prop_point(ilvl);
+    if (found_rand_prop_point == nullptr) {
       assert(false);
       return returning;
     }
 
     std::uint8_t prop_point_id = 0;
 
-    switch (found_item->second.slot) {
+    switch (found_item->slot) {
     case clogparser::Item_slot::bow: prop_point_id = 0; break;
     case clogparser::Item_slot::ranged_2: prop_point_id = 0; break;
     case clogparser::Item_slot::two_hand: prop_point_id = 0; break;
@@ -233,11 +225,11 @@ namespace {
     default: assert(false); return returning;
     }
 
-    const auto budget = found_rand_prop_point->second.budget[prop_point_id];
+    const auto budget = found_rand_prop_point->budget[prop_point_id];
 
     for (std::size_t i = 0; i < 10; ++i) {
-      const auto amount = budget * found_item->second.budget[i].amount * 0.0001;
-      switch (found_item->second.budget[i].type) {
+      const auto amount = budget * found_item->budget[i].amount * 0.0001;
+      switch (found_item->budget[i].type) {
       case sim::dbc::Item_sparse::Stat::Type::agility:
         if (primary == clogparser::Attribute_rating::agility) {
           returning[sim::Combat_stat::primary] += amount;
@@ -254,13 +246,13 @@ namespace {
         }
         break;
       case sim::dbc::Item_sparse::Stat::Type::critical_strike:
-        returning[sim::Combat_stat::crit_rating] += amount * item_rating_mult(found_item->second.slot, ilvl);
+        returning[sim::Combat_stat::crit_rating] += amount * item_rating_mult(found_item->slot, ilvl);
         break;
       case sim::dbc::Item_sparse::Stat::Type::versatility:
-        returning[sim::Combat_stat::vers_rating] += amount * item_rating_mult(found_item->second.slot, ilvl);
+        returning[sim::Combat_stat::vers_rating] += amount * item_rating_mult(found_item->slot, ilvl);
         break;
       case sim::dbc::Item_sparse::Stat::Type::mastery:
-        returning[sim::Combat_stat::mastery_rating] += amount * item_rating_mult(found_item->second.slot, ilvl);
+        returning[sim::Combat_stat::mastery_rating] += amount * item_rating_mult(found_item->slot, ilvl);
         break;
       case sim::dbc::Item_sparse::Stat::Type::agility_or_strength_or_intellect:
         returning[sim::Combat_stat::primary] += amount;
@@ -300,6 +292,41 @@ namespace {
     return player.aug_buffs.back();
   }
 
+  //what a spec and its gear give before talents and auras
+  sim::Combat_stats calc_base_stats(clogparser::SpecId spec, clogparser::Attribute_rating primary_stat, std::span<const clogparser::Item> items) {
+    sim::Combat_stats returning;
+    returning[sim::Combat_stat::primary] = base_primary(spec);
+    returning[sim::Combat_stat::primary_scaling] = 1;
+
+    for (auto const& item : items) {
+      if (item.item_id != 0) {
+        const auto got = get_item_stats(primary_stat, item.item_id, item.ilvl);
+        for (sim::Combat_stat i = sim::Combat_stat::INITIAL; i < sim::Combat_stat::COUNT; ++i) {
+          returning[i] += got[i];
+        }
+      }
+    }
+    return returning;
+  }
+
+  //FNV-1a, 8 bytes at a time
+  struct Fingerprint {
+    std::uint64_t value = 14695981039346656037ull;
+
+    void add(std::uint64_t adding) noexcept {
+      for (std::size_t i = 0; i < 8; ++i) {
+        value ^= (adding >> (8 * i)) & 0xFF;
+        value *= 1099511628211ull;
+      }
+    }
+  };
+
+  double crit_scaling(sim::Damage const& damage, double crit_chance) {
+    //clamp crit
+    crit_chance = std::min(1.0, crit_chance);
+    return 1 * (1 - crit_chance) + 2 * damage.amp.crit_amp * crit_chance;
+  }
+
   double calc_damage(sim::Damage const& damage, sim::Combat_stats const& damager, sim::Combat_stats const& aug, bool ebon_might, bool shifting_sands, bool prescience, bool fate_mirror) {
     double vers_scaling = 1 + calc_vers(damager);
     double primary = damager[sim::Combat_stat::primary];
@@ -322,12 +349,7 @@ namespace {
       }
     }
 
-    //clamp crit
-    crit_chance = std::min(1.0, crit_chance);
-    //calc crit scaling
-    const double crit_scaling = 1 * (1 - crit_chance) + 2 * damage.amp.crit_amp * crit_chance;
-
-    return damage.base_scaling * vers_scaling * (damage.scales_with_primary ? primary : 1) * crit_scaling * extra_scaling;
+    return damage.base_scaling * vers_scaling * (damage.scales_with_primary ? primary : 1) * crit_scaling(damage, crit_chance) * extra_scaling;
   }
 }
 
@@ -370,6 +392,56 @@ void sim::Target_state::aura_changed(Unit caster, std::uint64_t spell_id, std::u
 
 void sim::Target_state::handle_aura(Unit caster, std::uint64_t spell_id, std::uint8_t new_stacks, std::uint8_t old_stacks) { }
 
+void sim::Stats_timeline::push_back(clogparser::Period when, Combat_stats const& from, Combat_stats const& to) {
+  std::uint8_t changed = 0;
+  std::array<double, Combat_stats::size> values;
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < Combat_stats::size; ++i) {
+    const auto stat = static_cast<Combat_stat>(i);
+    if (from[stat] != to[stat]) {
+      changed |= 1 << i;
+      values[count++] = to[stat];
+    }
+  }
+  if (changed != 0) {
+    push_back(when, changed, std::span{ values }.first(count));
+  }
+}
+
+void sim::Stats_timeline::push_back(clogparser::Period when, std::uint8_t changed, std::span<const double> values) {
+  assert(values.size() == static_cast<std::size_t>(std::popcount(changed)));
+  assert(whens_.empty() || whens_.back() <= when);
+
+  if (whens_.empty() || whens_.back() != when) {
+    whens_.push_back(when);
+    changed_.push_back(changed);
+    values_.insert(values_.end(), values.begin(), values.end());
+    return;
+  }
+
+  //same time as the last change, fold this one into it so each time has one change
+  const std::uint8_t last_changed = changed_.back();
+  const std::size_t last_start = values_.size() - std::popcount(last_changed);
+  std::array<double, Combat_stats::size> merged;
+  std::size_t count = 0;
+  std::size_t last_value = last_start;
+  std::size_t value = 0;
+  for (std::size_t i = 0; i < Combat_stats::size; ++i) {
+    const bool in_last = (last_changed & (1 << i)) != 0;
+    const bool in_this = (changed & (1 << i)) != 0;
+    if (in_this) {
+      merged[count++] = values[value];
+    } else if (in_last) {
+      merged[count++] = values_[last_value];
+    }
+    last_value += in_last ? 1 : 0;
+    value += in_this ? 1 : 0;
+  }
+  values_.resize(last_start);
+  values_.insert(values_.end(), merged.begin(), merged.begin() + count);
+  changed_.back() = last_changed | changed;
+}
+
 sim::Calced_damage sim::Damage::calc(Combat_stats const& damager, Combat_stats const& aug, bool fate_mirror) const noexcept {
   Calced_damage returning;
   returning.base = calc_damage(*this, damager, aug, false, false, false, false);
@@ -381,99 +453,74 @@ sim::Calced_damage sim::Damage::calc(Combat_stats const& damager, Combat_stats c
   return returning;
 }
 
-std::unique_ptr<sim::Player_state> sim::Player_state::create(clogparser::events::Combatant_info const& c_info) {
-  switch (c_info.current_spec_id) {
-    //idk what to do with this
-  case clogparser::SpecId::invalid: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-
-  case clogparser::SpecId::dk_blood: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::dk_frost: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::dk_unholy: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::dk_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-
-  case clogparser::SpecId::dh_havoc: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::dh_vengeance: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::dh_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-
-  case clogparser::SpecId::druid_balance: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::druid_feral: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::druid_guardian: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::druid_restoration: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::druid_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-
-  case clogparser::SpecId::evoker_devastation: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::evoker_preservation: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::evoker_augmentation: return specs::create_aug(c_info);
-  case clogparser::SpecId::evoker_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-
-  case clogparser::SpecId::hunter_beast_mastery: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::hunter_marksmanship: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::hunter_survival: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::hunter_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-
-  case clogparser::SpecId::mage_arcane: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::mage_fire: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::mage_frost: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::mage_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-
-  case clogparser::SpecId::monk_brewmaster: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::monk_windwalker: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::monk_mistweaver: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::monk_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-
-  case clogparser::SpecId::paladin_holy: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::paladin_protection: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::paladin_retribution: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::paladin_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-
-  case clogparser::SpecId::priest_discipline: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::priest_holy: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::priest_shadow: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::priest_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-
-  case clogparser::SpecId::rogue_assassination: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::rogue_outlaw: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::rogue_subtlety: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::rogue_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-
-  case clogparser::SpecId::shaman_elemental: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::shaman_enhancement: return create_nyi(c_info, clogparser::Attribute_rating::agility);
-  case clogparser::SpecId::shaman_restoration: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::shaman_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-
-  case clogparser::SpecId::warlock_afflication: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::warlock_demonology: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::warlock_destruction: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-  case clogparser::SpecId::warlock_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::intelligence);
-
-  case clogparser::SpecId::warrior_arms: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::warrior_fury: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::warrior_protection: return create_nyi(c_info, clogparser::Attribute_rating::strength);
-  case clogparser::SpecId::warrior_unspecced: return create_nyi(c_info, clogparser::Attribute_rating::strength);
+sim::Damage_terms sim::Damage::terms(Combat_stats const& damager) const noexcept {
+  const double vers_scaling = 1 + calc_vers(damager);
+  const double primary = scales_with_primary ? damager[Combat_stat::primary] : 1;
+  const double crit_chance = calc_crit(damager) + amp.crit_chance_add;
+  const double crit = crit_scaling(*this, crit_chance);
+
+  Damage_terms returning;
+  returning.base = base_scaling * vers_scaling * primary * crit;
+  returning.ebon_might_per_primary = scales_with_primary ? base_scaling * vers_scaling * crit : 0;
+  returning.shifting_sands_per_vers = base_scaling * primary * crit;
+  returning.prescience = base_scaling * vers_scaling * primary * crit_scaling(*this, crit_chance + PRESCIENCE_CRIT_AMOUNT);
+  return returning;
+}
 
-  default:
-    throw std::exception("Unknown spec");
+sim::Combat_stats sim::Gear_cache::base_stats(clogparser::SpecId spec, clogparser::Attribute_rating primary_stat, std::span<const clogparser::Item> items) {
+  Key key{ 0, spec, primary_stat };
+  key.items.reserve(items.size());
+  Fingerprint fingerprint;
+  fingerprint.add(static_cast<std::uint64_t>(spec));
+  fingerprint.add(static_cast<std::uint64_t>(primary_stat));
+  for (auto const& item : items) {
+    key.items.push_back(Item_key{ item.item_id, item.ilvl, item.permanent_enchant_id });
+    fingerprint.add(item.item_id);
+    fingerprint.add(item.ilvl);
+    fingerprint.add(item.permanent_enchant_id ? static_cast<std::uint64_t>(*item.permanent_enchant_id) : ~std::uint64_t{ 0 });
   }
+  key.fingerprint = fingerprint.value;
+
+  {
+    std::lock_guard lock{ mutex_ };
+    if (const auto found = cache_.find(key); found != cache_.end()) {
+      ++stats_.hits;
+      return found->second;
+    }
+  }
+
+  //worked out unlocked, if two threads miss on the same gear they just both do the work
+  const auto calced = calc_base_stats(spec, primary_stat, items);
+
+  std::lock_guard lock{ mutex_ };
+  ++stats_.misses;
+  cache_.emplace(std::move(key), calced);
+  return calced;
+}
+
+sim::Gear_cache::Stats sim::Gear_cache::stats() const {
+  std::lock_guard lock{ mutex_ };
+  Stats returning = stats_;
+  returning.size = cache_.size();
+  return returning;
+}
+
+std::unique_ptr<sim::Player_state> sim::Player_state::create(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache) {
+  return specs::create(c_info, gear_cache, [](auto created) -> std::unique_ptr<Player_state> {
+    return created;
+    });
 }
 
-sim::Player_state::Player_state(clogparser::events::Combatant_info const& info, clogparser::Attribute_rating  primary_stat) :
+sim::Player_state::Player_state(clogparser::events::Combatant_info const& info, clogparser::Attribute_rating  primary_stat, Gear_cache* gear_cache) :
   Target_state(info.guid),
   spec(info.current_spec_id),
   primary_stat(primary_stat),
   talents(info.talents),
   items(info.items) {
 
-  current_stats[Combat_stat::primary] = base_primary(info.current_spec_id);
-  current_stats[Combat_stat::primary_scaling] = 1;
-
-  for (auto const& item : info.items) {
-    if (item.item_id != 0) {
-      const auto got = get_item_stats(primary_stat, item.item_id, item.ilvl);
-      for (Combat_stat i = Combat_stat::INITIAL; i < Combat_stat::COUNT; ++i) {
-        current_stats[i] += got[i];
-      }
-    }
-  }
+  current_stats = gear_cache == nullptr
+    ? calc_base_stats(info.current_spec_id, primary_stat, info.items)
+    : gear_cache->base_stats(info.current_spec_id, primary_stat, info.items);
 
   for (auto const& interesting_aura : info.interesting_auras) {
     aura_changed(this, interesting_aura.spell_id, 1);
@@ -487,11 +534,37 @@ sim::Damage sim::Player_state::pet_swing(bool crit, Target_state const& target,
   return calc_swing(crit, *this, target, historical_damage_done);
 }
 
-sim::Damage sim::Player_state::impact(std::uint64_t spell_id, bool crit, Target_state const& target, std::int64_t historical_damage_done) const {
-  return calc_spell(spell_id, crit, *this, target, historical_damage_done);
+sim::Damage sim::Player_state::impact(std::uint64_t spell_id, std::uint8_t attributes, bool crit, Target_state const& target, std::int64_t historical_damage_done) const {
+  return calc_spell(attributes, crit, *this, target, historical_damage_done);
+}
+
+void sim::Player_state::refresh_effective_stats_() const {
+  //most damage is done without any of our buffs, then the caster's stats are used as they are
+  std::optional<Combat_stats> buffed;
+  if (!aug_buffs.empty()) {
+    buffed.emplace(current_stats);
+  }
+  effective_.aug_versions.clear();
+  for (auto const& buff : aug_buffs) {
+    //prescience's crit doesn't change the damage that was done, only what it's worth
+    if (buff.ebon_might) {
+      (*buffed)[Combat_stat::primary] += 0.065 * buff.aug->current_stats[Combat_stat::primary] * buff.aug->current_stats[Combat_stat::primary_scaling];
+    }
+    if (buff.shifting_sands) {
+      (*buffed)[Combat_stat::vers_val] += calc_mastery(buff.aug->current_stats) * SHIFTING_SANDS_MASTERY_MULTIPLER;
+    }
+    effective_.aug_versions.push_back(buff.aug->stats_version_);
+  }
+  Combat_stats const& with_aug = buffed ? *buffed : current_stats;
+
+  effective_.stats.primary = with_aug[Combat_stat::primary];
+  effective_.stats.vers_mult = 1 + calc_vers(with_aug);
+  effective_.version = stats_version_;
 }
 
 void sim::Player_state::handle_aura(Unit caster, std::uint64_t spell_id, std::uint8_t new_stacks, std::uint8_t old_stacks) {
+  //every aura we handle changes current_stats or aug_buffs
+  mark_stats_dirty_();
   switch (spell_id) {
   case SPELL::mark_of_the_wild:
     current_stats[Combat_stat::vers_val] += get_aura_adder(0.03, new_stacks, old_stacks);
@@ -511,13 +584,13 @@ void sim::Player_state::handle_aura(Unit caster, std::uint64_t spell_id, std::ui
       break;
     }
 
-    const auto found_rand_pop_point = dbc::RAND_PROP_POINT.find(ilvl);
-    if (found_rand_pop_point == dbc::RAND_PROP_POINT.end()) {
+    const auto found_rand_pop_point = dbc::rand_prop_point(ilvl);
+    if (found_rand_pop_point == nullptr) {
       assert(false);
       break;
     }
 
-    const auto per_stack = COEFFICIENT::kindled_soul * found_rand_pop_point->second.budget[0];
+    const auto per_stack = COEFFICIENT::kindled_soul * found_rand_pop_point->budget[0];
     current_stats[Combat_stat::primary] += get_aura_adder(per_stack, new_stacks, old_stacks);
     break;
   }
@@ -540,13 +613,13 @@ void sim::Player_state::handle_aura(Unit caster, std::uint64_t spell_id, std::ui
         break;
       }
 
-      const auto found_rand_prop_point = dbc::RAND_PROP_POINT.find(ilvl);
-      if (found_rand_prop_point == dbc::RAND_PROP_POINT.end()) {
+      const auto found_rand_prop_point = dbc::rand_prop_point(ilvl);
+      if (found_rand_prop_point == nullptr) {
         assert(false);
         break;
       }
 
-      current_stats[Combat_stat::vers_rating] += get_aura_adder(COEFFICIENT::rallied_to_victory * found_rand_prop_point->second.damage_replace_stat, new_stacks, old_stacks);
+      current_stats[Combat_stat::vers_rating] += get_aura_adder(COEFFICIENT::rallied_to_victory * found_rand_prop_point->damage_replace_stat, new_stacks, old_stacks);
       break;
     }
     break;
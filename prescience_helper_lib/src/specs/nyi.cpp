@@ -0,0 +1,84 @@
+#include <prescience_helper/sim/specs/nyi.hpp>
+
+namespace sim = prescience_helper::sim;
+
+sim::specs::Nyi_spec::Nyi_spec(clogparser::events::Combatant_info const& c_info, Gear_cache* gear_cache) :
+  Player_state(c_info, *primary_stat_of(c_info.current_spec_id), gear_cache) {
+  current_stats[Combat_stat::crit_val] += 0.05;
+  current_stats[Combat_stat::mastery_val] += 8;
+}
+
+std::optional<clogparser::Attribute_rating> sim::specs::Nyi_spec::primary_stat_of(clogparser::SpecId spec) noexcept {
+  switch (spec) {
+    //idk what to do with this
+  case clogparser::SpecId::invalid: return clogparser::Attribute_rating::strength;
+
+  case clogparser::SpecId::dk_blood: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::dk_frost: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::dk_unholy: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::dk_unspecced: return clogparser::Attribute_rating::strength;
+
+  case clogparser::SpecId::dh_havoc: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::dh_vengeance: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::dh_unspecced: return clogparser::Attribute_rating::agility;
+
+  case clogparser::SpecId::druid_balance: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::druid_feral: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::druid_guardian: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::druid_restoration: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::druid_unspecced: return clogparser::Attribute_rating::intelligence;
+
+  case clogparser::SpecId::evoker_devastation: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::evoker_preservation: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::evoker_augmentation: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::evoker_unspecced: return clogparser::Attribute_rating::intelligence;
+
+  case clogparser::SpecId::hunter_beast_mastery: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::hunter_marksmanship: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::hunter_survival: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::hunter_unspecced: return clogparser::Attribute_rating::agility;
+
+  case clogparser::SpecId::mage_arcane: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::mage_fire: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::mage_frost: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::mage_unspecced: return clogparser::Attribute_rating::intelligence;
+
+  case clogparser::SpecId::monk_brewmaster: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::monk_windwalker: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::monk_mistweaver: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::monk_unspecced: return clogparser::Attribute_rating::agility;
+
+  case clogparser::SpecId::paladin_holy: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::paladin_protection: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::paladin_retribution: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::paladin_unspecced: return clogparser::Attribute_rating::strength;
+
+  case clogparser::SpecId::priest_discipline: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::priest_holy: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::priest_shadow: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::priest_unspecced: return clogparser::Attribute_rating::intelligence;
+
+  case clogparser::SpecId::rogue_assassination: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::rogue_outlaw: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::rogue_subtlety: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::rogue_unspecced: return clogparser::Attribute_rating::agility;
+
+  case clogparser::SpecId::shaman_elemental: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::shaman_enhancement: return clogparser::Attribute_rating::agility;
+  case clogparser::SpecId::shaman_restoration: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::shaman_unspecced: return clogparser::Attribute_rating::intelligence;
+
+  case clogparser::SpecId::warlock_afflication: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::warlock_demonology: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::warlock_destruction: return clogparser::Attribute_rating::intelligence;
+  case clogparser::SpecId::warlock_unspecced: return clogparser::Attribute_rating::intelligence;
+
+  case clogparser::SpecId::warrior_arms: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::warrior_fury: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::warrior_protection: return clogparser::Attribute_rating::strength;
+  case clogparser::SpecId::warrior_unspecced: return clogparser::Attribute_rating::strength;
+
+  default:
+    return std::nullopt;
+  }
+}
@@ -0,0 +1,49 @@
+#include <prescience_helper/spill.hpp>
+
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+  std::atomic<std::uint64_t> spill_files_created{ 0 };
+
+  std::filesystem::path unique_path(std::filesystem::path const& directory) {
+    static const auto process_tag = std::random_device{}();
+    return directory / ("prescience_helper_spill_"
+      + std::to_string(process_tag) + "_"
+      + std::to_string(spill_files_created++) + ".tmp");
+  }
+}
+
+prescience_helper::Spill_file::Spill_file(std::filesystem::path const& directory) :
+  path_(unique_path(directory)) {
+
+  file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file_) {
+    throw std::runtime_error("Couldn't create spill file " + path_.string());
+  }
+}
+
+prescience_helper::Spill_file::~Spill_file() {
+  file_.close();
+  std::error_code ignored;
+  std::filesystem::remove(path_, ignored);
+}
+
+void prescience_helper::Spill_file::write_bytes_(std::span<const std::byte> in) {
+  file_.seekp(static_cast<std::streamoff>(size_));
+  file_.write(reinterpret_cast<const char*>(in.data()), static_cast<std::streamsize>(in.size()));
+  if (!file_) {
+    throw std::runtime_error("Couldn't write to spill file " + path_.string());
+  }
+  size_ += in.size();
+}
+
+void prescience_helper::Spill_file::read_bytes_(std::uint64_t offset, std::span<std::byte> out) {
+  file_.seekg(static_cast<std::streamoff>(offset));
+  file_.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size()));
+  if (!file_) {
+    throw std::runtime_error("Couldn't read from spill file " + path_.string());
+  }
+}
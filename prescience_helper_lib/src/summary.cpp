@@ -0,0 +1,284 @@
+#include <prescience_helper/sim/summary.hpp>
+#include <prescience_helper/sim/helpers.hpp>
+#include <prescience_helper/trace.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <variant>
+
+namespace sim = prescience_helper::sim;
+namespace summary = prescience_helper::sim::summary;
+
+namespace {
+  double weight_of(std::int64_t age_ms, std::chrono::milliseconds half_life) {
+    if (half_life.count() <= 0) {
+      return 1;
+    }
+    return std::exp2(-static_cast<double>(age_ms) / half_life.count());
+  }
+
+  //what an aug gives in a slice, from its summary
+  struct Aug_gives {
+    double primary = 0;
+    double vers = 0;
+  };
+
+  Aug_gives aug_gives(double primary, double mastery_rating, double mastery_val) {
+    sim::Combat_stats stats;
+    stats[sim::Combat_stat::mastery_rating] = mastery_rating;
+    stats[sim::Combat_stat::mastery_val] = mastery_val;
+    return Aug_gives{
+      primary * sim::EBON_MIGHT_PRIMARY_SHARE,
+      sim::calc_mastery(stats) * sim::SHIFTING_SANDS_MASTERY_MULTIPLER
+    };
+  }
+}
+
+void summary::Summary::add_pull(Summary const& pull, std::chrono::milliseconds half_life) {
+  double weight = 1;
+  if (slices.empty() || pull.newest_start_ms > newest_start_ms) {
+    const double older = weight_of(pull.newest_start_ms - newest_start_ms, half_life);
+    for (auto& slice : slices) {
+      slice = slice * older;
+    }
+    newest_start_ms = pull.newest_start_ms;
+  } else {
+    weight = weight_of(newest_start_ms - pull.newest_start_ms, half_life);
+  }
+
+  if (slices.size() < pull.slices.size()) {
+    slices.resize(pull.slices.size());
+  }
+  for (std::size_t i = 0; i < pull.slices.size(); ++i) {
+    slices[i] += pull.slices[i] * weight;
+  }
+}
+
+summary::Summary summary::summarize(
+  std::int64_t start_ms,
+  clogparser::Period duration,
+  std::span<const Event<Damage>> damage,
+  Stats_timeline const& stats,
+  std::span<const Event<void>> died,
+  std::span<const Event<void>> rezzed) {
+  PRESCIENCE_HELPER_TRACE_SPAN("summarize");
+
+  Summary returning;
+  returning.newest_start_ms = start_ms;
+  if (duration.count() <= 0) {
+    return returning;
+  }
+  returning.slices.resize(static_cast<std::size_t>((duration + SLICE - clogparser::Period{ 1 }) / SLICE));
+
+  struct Died {};
+  struct Rezzed {};
+  using Change = Event<std::variant<Stats_delta, Died, Rezzed>>;
+
+  //at the same time stats change first, then deaths and rezzes, then damage is done
+  std::vector<Change> changes;
+  changes.reserve(stats.size() + died.size() + rezzed.size() + 1);
+  for (auto const& change : stats) {
+    changes.push_back(Change{ change.when, change.what });
+  }
+  for (auto const& event : died) {
+    changes.push_back(Change{ event.when, Died{} });
+  }
+  //the fight ending is a death, same as aggregate_damage
+  changes.push_back(Change{ duration, Died{} });
+  for (auto const& event : rezzed) {
+    changes.push_back(Change{ event.when, Rezzed{} });
+  }
+  std::stable_sort(changes.begin(), changes.end(), [](Change const& c1, Change const& c2) {
+    return c1.when < c2.when;
+    });
+
+  Combat_stats current;
+  bool alive = true;
+  clogparser::Period at{ 0 };
+
+  //adds what the player was for the time from at to until
+  const auto advance = [&returning, &current, &alive, &at](clogparser::Period until) {
+    while (at < until) {
+      const auto index = static_cast<std::size_t>(at / SLICE);
+      if (index >= returning.slices.size()) {
+        at = until;
+        return;
+      }
+      const auto slice_end = SLICE * static_cast<clogparser::Period::rep>(index + 1);
+      const auto to = std::min(until, slice_end);
+      if (alive) {
+        const double part = static_cast<double>((to - at).count()) / SLICE.count();
+        auto& slice = returning.slices[index];
+        slice[Field::alive] += part;
+        slice[Field::primary] += part * current[Combat_stat::primary] * current[Combat_stat::primary_scaling];
+        slice[Field::mastery_rating] += part * current[Combat_stat::mastery_rating];
+        slice[Field::mastery_val] += part * current[Combat_stat::mastery_val];
+      }
+      at = to;
+    }
+  };
+
+  std::size_t next_change = 0;
+  const auto apply_changes_until = [&](clogparser::Period until) {
+    while (next_change < changes.size() && changes[next_change].when <= until) {
+      auto const& change = changes[next_change++];
+      advance(change.when);
+      if (std::holds_alternative<Stats_delta>(change.what)) {
+        std::get<Stats_delta>(change.what).apply(current);
+      } else {
+        alive = std::holds_alternative<Rezzed>(change.what);
+      }
+    }
+  };
+
+  for (auto const& event : damage) {
+    apply_changes_until(event.when);
+    if (!alive || event.when.count() < 0) {
+      continue;
+    }
+    const auto index = static_cast<std::size_t>(event.when / SLICE);
+    if (index >= returning.slices.size()) {
+      continue;
+    }
+    const auto terms = event.what.terms(current);
+    auto& slice = returning.slices[index];
+    slice[Field::base] += terms.base;
+    slice[Field::ebon_might_per_primary] += terms.ebon_might_per_primary;
+    slice[Field::shifting_sands_per_vers] += terms.shifting_sands_per_vers;
+    slice[Field::prescience] += terms.prescience;
+  }
+  apply_changes_until(duration);
+  advance(duration);
+
+  return returning;
+}
+
+std::vector<prescience_helper::Event<sim::Calced_damage>> summary::aggregate_damage(
+  Summary const& player,
+  Summary const& aug,
+  bool fate_mirror,
+  clogparser::Period window_size) {
+  PRESCIENCE_HELPER_TRACE_SPAN("aggregate_damage summary");
+
+  std::vector<Event<Calced_damage>> returning;
+  if (player.slices.empty()) {
+    return returning;
+  }
+
+  //what the aug gives in each slice, and on average for slices no pull of the aug was alive for
+  std::vector<std::optional<Aug_gives>> gives(player.slices.size());
+  Slice aug_total;
+  std::size_t aug_alive_slices = 0;
+  for (std::size_t i = 0; i < aug.slices.size(); ++i) {
+    auto const& slice = aug.slices[i];
+    const double alive = slice[Field::alive];
+    if (alive == 0) {
+      continue;
+    }
+    const double primary = slice[Field::primary] / alive;
+    const double mastery_rating = slice[Field::mastery_rating] / alive;
+    const double mastery_val = slice[Field::mastery_val] / alive;
+    if (i < gives.size()) {
+      gives[i] = aug_gives(primary, mastery_rating, mastery_val);
+    }
+    aug_total[Field::primary] += primary;
+    aug_total[Field::mastery_rating] += mastery_rating;
+    aug_total[Field::mastery_val] += mastery_val;
+    ++aug_alive_slices;
+  }
+  if (aug_alive_slices == 0) {
+    return returning;
+  }
+  const auto aug_avg = aug_gives(
+    aug_total[Field::primary] / aug_alive_slices,
+    aug_total[Field::mastery_rating] / aug_alive_slices,
+    aug_total[Field::mastery_val] / aug_alive_slices);
+
+  const std::size_t per_window = std::max<std::size_t>(1, static_cast<std::size_t>(window_size / SLICE));
+  const double fate_mirror_scaling = fate_mirror ? 1.015 : 1;
+
+  std::vector<bool> returning_valid;
+  clogparser::Period until{ 0 };
+  for (std::size_t start = 0; start < player.slices.size(); start += per_window) {
+    double alive = 0;
+    double base = 0;
+    double with_ebon = 0;
+    double with_shifting_sands = 0;
+    double with_prescience = 0;
+    for (std::size_t i = start; i < std::min(start + per_window, player.slices.size()); ++i) {
+      auto const& slice = player.slices[i];
+      const auto& given = gives[i] ? *gives[i] : aug_avg;
+      alive += slice[Field::alive];
+      base += slice[Field::base];
+      with_ebon += slice[Field::base] + given.primary * slice[Field::ebon_might_per_primary];
+      with_shifting_sands += slice[Field::base] + given.vers * slice[Field::shifting_sands_per_vers];
+      with_prescience += slice[Field::prescience] * fate_mirror_scaling;
+    }
+
+    Calced_damage calced;
+    if (base != 0) {
+      calced.base = base;
+      calced.with_ebon_mult = with_ebon / base;
+      calced.with_shifting_sands_mult = with_shifting_sands / base;
+      calced.with_prescience_mult = with_prescience / base;
+    }
+
+    const double total_weight = alive / per_window;
+    if (total_weight != 0) {
+      calced /= total_weight;
+    }
+
+    const bool is_valid = total_weight != 0;
+
+    if (!(!returning.empty()
+      && calced == returning.back().what
+      && is_valid == returning_valid.back())) { //if NOT same as before
+
+      returning.push_back(Event<Calced_damage>{
+        SLICE * static_cast<clogparser::Period::rep>(start),
+        calced
+      });
+      returning_valid.push_back(is_valid);
+    }
+    until = SLICE * static_cast<clogparser::Period::rep>(start + per_window);
+  }
+
+  if (returning.empty()) {
+    return returning;
+  }
+
+  std::size_t total_windows{ 0 };
+  Calced_damage avg;
+  const clogparser::Period window = SLICE * static_cast<clogparser::Period::rep>(per_window);
+
+  //same as on_rails::aggregate_damage, invalid windows get the average of the valid ones
+  if (returning_valid.back()) {
+    returning.push_back({
+      until,
+      Calced_damage{}
+      });
+    returning_valid.push_back(false);
+  }
+
+  for (std::size_t i = 1; i < returning.size(); ++i) {
+    if (returning_valid[i - 1]) {
+      const std::size_t windows = (returning[i].when - returning[i - 1].when) / window;
+      avg += returning[i - 1].what * windows;
+      total_windows += windows;
+    }
+  }
+
+  //no valid window at all, the invalid ones are left at 0 rather than NaN
+  if (total_windows != 0) {
+    avg /= total_windows;
+  }
+
+  for (std::size_t i = 0; i < returning.size(); ++i) {
+    if (!returning_valid[i]) {
+      returning[i].what = avg;
+    }
+  }
+
+  return returning;
+}
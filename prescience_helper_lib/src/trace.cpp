@@ -0,0 +1,188 @@
+#include <prescience_helper/trace.hpp>
+
+#ifdef PRESCIENCE_HELPER_TRACING
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace trace = prescience_helper::trace;
+
+namespace {
+  struct Finished {
+    const char* name;
+    std::string detail;
+    std::int64_t start_us;
+    std::int64_t duration_us;
+  };
+
+  //a long serve or watch would otherwise grow without bound, past this the oldest spans are overwritten
+  constexpr std::size_t MAX_SPANS_PER_THREAD = 1 << 16;
+
+  //each thread appends to its own buffer, the lock is only contended while writing the trace out
+  struct Thread_buffer {
+    std::mutex mutex;
+    std::vector<Finished> spans;
+    //where the next span goes once spans is full
+    std::size_t oldest = 0;
+    std::string name;
+    std::uint32_t tid;
+  };
+
+  struct Registry {
+    std::mutex mutex;
+    //buffers outlive their threads, so spans from finished threads are still written
+    std::vector<std::shared_ptr<Thread_buffer>> buffers;
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+  };
+
+  Registry& registry() {
+    static Registry registry;
+    return registry;
+  }
+
+  Thread_buffer& local_buffer() {
+    thread_local const std::shared_ptr<Thread_buffer> buffer = []() {
+      auto& reg = registry();
+      auto returning = std::make_shared<Thread_buffer>();
+      std::lock_guard lock{ reg.mutex };
+      returning->tid = static_cast<std::uint32_t>(reg.buffers.size() + 1);
+      reg.buffers.push_back(returning);
+      return returning;
+    }();
+    return *buffer;
+  }
+
+  std::int64_t since_epoch_us(std::chrono::steady_clock::time_point when) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(when - registry().epoch).count();
+  }
+
+  void write_json_string(std::ostream& out, std::string_view in) {
+    out << '"';
+    for (const char c : in) {
+      switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\r':
+        out << "\\r";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+          out << escaped;
+        } else {
+          out << c;
+        }
+      }
+    }
+    out << '"';
+  }
+}
+
+trace::Span::Span(const char* name) noexcept :
+  name_(name),
+  start_(std::chrono::steady_clock::now()) {
+
+}
+
+trace::Span::Span(const char* name, std::string_view detail) :
+  name_(name),
+  detail_(detail),
+  start_(std::chrono::steady_clock::now()) {
+
+}
+
+trace::Span::~Span() {
+  const auto end = std::chrono::steady_clock::now();
+  auto& buffer = local_buffer();
+  Finished finished{
+    name_,
+    std::move(detail_),
+    since_epoch_us(start_),
+    std::chrono::duration_cast<std::chrono::microseconds>(end - start_).count() };
+  std::lock_guard lock{ buffer.mutex };
+  if (buffer.spans.size() < MAX_SPANS_PER_THREAD) {
+    buffer.spans.push_back(std::move(finished));
+  } else {
+    buffer.spans[buffer.oldest] = std::move(finished);
+    buffer.oldest = (buffer.oldest + 1) % MAX_SPANS_PER_THREAD;
+  }
+}
+
+void trace::name_thread(std::string_view name) {
+  auto& buffer = local_buffer();
+  std::lock_guard lock{ buffer.mutex };
+  buffer.name = name;
+}
+
+bool trace::write(std::filesystem::path const& path) {
+  std::ofstream out{ path, std::ios::binary | std::ios::trunc };
+  if (!out) {
+    return false;
+  }
+
+  auto& reg = registry();
+  std::vector<std::shared_ptr<Thread_buffer>> buffers;
+  {
+    std::lock_guard lock{ reg.mutex };
+    buffers = reg.buffers;
+  }
+
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  const auto separator = [&out, &first]() {
+    if (!first) {
+      out << ",\n";
+    }
+    first = false;
+  };
+
+  for (auto const& buffer : buffers) {
+    std::lock_guard lock{ buffer->mutex };
+    if (!buffer->name.empty()) {
+      separator();
+      out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":";
+      write_json_string(out, buffer->name);
+      out << "}}";
+    }
+    for (auto const& span : buffer->spans) {
+      separator();
+      out << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid
+        << ",\"ts\":" << span.start_us
+        << ",\"dur\":" << span.duration_us
+        << ",\"name\":";
+      write_json_string(out, span.name);
+      if (!span.detail.empty()) {
+        out << ",\"args\":{\"detail\":";
+        write_json_string(out, span.detail);
+        out << '}';
+      }
+      out << '}';
+    }
+  }
+  out << "]}\n";
+
+  return static_cast<bool>(out);
+}
+
+#else
+
+bool prescience_helper::trace::write(std::filesystem::path const&) {
+  return false;
+}
+
+#endif